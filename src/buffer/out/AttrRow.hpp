@@ -22,6 +22,7 @@ Revision History:
 
 #include "TextAttributeRun.hpp"
 #include "AttrRowIterator.hpp"
+#include "../../inc/containers.hpp"
 
 class ATTR_ROW final
 {
@@ -64,7 +65,9 @@ public:
     friend class AttrRowIterator;
 
 private:
-    std::vector<TextAttributeRun> _list;
+    // Most rows are a single run; inline storage for four means a row only
+    // allocates when someone actually paints a complicated line.
+    Microsoft::Console::Containers::small_vector<TextAttributeRun, 4> _list;
     size_t _cchRowWidth;
 
 #ifdef UNIT_TESTING
@@ -7,20 +7,157 @@
 #include "unicode.hpp"
 #include "Row.hpp"
 
+// The measurement scans below use SSE2 on x86/x64 (part of the baseline for
+// those architectures). Other architectures take the scalar paths.
+#if defined(_M_X64) || defined(_M_IX86)
+#define CHARROW_VECTORIZED_SCANS 1
+#include <emmintrin.h>
+#include <intrin.h>
+#endif
+
+// default glyph value, used for reseting the character data portion of a cell
+static constexpr wchar_t DefaultValue = UNICODE_SPACE;
+
+// Routine Description:
+// - finds the first column in the range whose inline code unit is not a blank
+// Arguments:
+// - chars - pointer to the first code unit to inspect
+// - count - how many code units to inspect
+// Return Value:
+// - index of the first non-blank code unit, or count if they're all blank
+static size_t s_FindFirstNonBlank(const wchar_t* const chars, const size_t count) noexcept
+{
+    size_t i = 0;
+
+#ifdef CHARROW_VECTORIZED_SCANS
+    const __m128i blank = _mm_set1_epi16(DefaultValue);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        const unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(v, blank));
+        if (mask != 0xFFFF)
+        {
+            unsigned long bit = 0;
+            _BitScanForward(&bit, ~mask & 0xFFFF);
+            return i + bit / 2;
+        }
+    }
+#endif
+
+    while (i < count && chars[i] == DefaultValue)
+    {
+        ++i;
+    }
+    return i;
+}
+
+// Routine Description:
+// - finds the extent of the text in the range by scanning backward over
+//   trailing blanks
+// Arguments:
+// - chars - pointer to the first code unit of the range
+// - count - how many code units are in the range
+// Return Value:
+// - one past the index of the last non-blank code unit, or 0 if they're all blank
+static size_t s_FindTextExtent(const wchar_t* const chars, const size_t count) noexcept
+{
+    size_t i = count;
+
+#ifdef CHARROW_VECTORIZED_SCANS
+    const __m128i blank = _mm_set1_epi16(DefaultValue);
+    while (i >= 8)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i - 8));
+        const unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(v, blank));
+        if (mask != 0xFFFF)
+        {
+            unsigned long bit = 0;
+            _BitScanReverse(&bit, ~mask & 0xFFFF);
+            return i - 8 + bit / 2 + 1;
+        }
+        i -= 8;
+    }
+#endif
+
+    while (i > 0 && chars[i - 1] == DefaultValue)
+    {
+        --i;
+    }
+    return i;
+}
+
+// Routine Description:
+// - checks whether any cell in the range has an overflow glyph stored for it
+// Arguments:
+// - attrs - pointer to the first DBCS attribute to inspect
+// - count - how many attributes to inspect
+// Return Value:
+// - true if at least one cell has a stored glyph
+static bool s_AnyGlyphStored(const DbcsAttribute* const attrs, const size_t count) noexcept
+{
+    size_t i = 0;
+
+#ifdef CHARROW_VECTORIZED_SCANS
+    // Derive the bit the glyph-stored flag occupies rather than assuming the
+    // compiler's bitfield layout. Flipping the flag on one object and diffing
+    // the raw bytes isolates exactly that bit.
+    static const BYTE glyphStoredMask = []() noexcept {
+        DbcsAttribute attr;
+        BYTE without;
+        memcpy(&without, &attr, sizeof(attr));
+        attr.SetGlyphStored(true);
+        BYTE with;
+        memcpy(&with, &attr, sizeof(attr));
+        return gsl::narrow_cast<BYTE>(with ^ without);
+    }();
+
+    static_assert(sizeof(DbcsAttribute) == 1, "the vectorized scan walks DBCS attributes as raw bytes");
+    const auto bytes = reinterpret_cast<const BYTE*>(attrs);
+    const __m128i flag = _mm_set1_epi8(glyphStoredMask);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, flag), flag)) != 0)
+        {
+            return true;
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        if (attrs[i].IsGlyphStored())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Routine Description:
 // - constructor
 // Arguments:
 // - rowWidth - the size (in wchar_t) of the char and attribute rows
 // - pParent - the parent ROW
+// - resource - the memory resource to allocate the char and attribute storage from
+// - deferred - if true, start the row in the packed blank state and don't
+//              allocate the expanded storage until the row is first visited
 // Return Value:
 // - instantiated object
 // Note: will through if unable to allocate char/attribute buffers
-CharRow::CharRow(size_t rowWidth, ROW* const pParent) :
+CharRow::CharRow(size_t rowWidth, ROW* const pParent, std::pmr::memory_resource* const resource, const bool deferred) :
     _wrapForced{ false },
     _doubleBytePadded{ false },
-    _data(rowWidth, value_type()),
+    _chars(deferred ? 0 : rowWidth, DefaultValue, resource),
+    _attrs{ resource },
+    _compressed{ nullptr },
     _pParent{ FAIL_FAST_IF_NULL(pParent) }
 {
+    if (deferred)
+    {
+        _compressed = std::make_unique<CompressedData>();
+        _compressed->width = rowWidth;
+    }
 }
 
 // Routine Description:
@@ -75,7 +212,7 @@ bool CharRow::WasDoubleBytePadded() const noexcept
 // - the size of the row
 size_t CharRow::size() const noexcept
 {
-    return _data.size();
+    return _compressed ? _compressed->width : _chars.size();
 }
 
 // Routine Description:
@@ -86,9 +223,21 @@ size_t CharRow::size() const noexcept
 // - <none>
 void CharRow::Reset()
 {
-    for (auto& cell : _data)
+    // a cold row resets in place; a blank packed row is nothing but its width.
+    if (_compressed)
+    {
+        _compressed->chars.clear();
+        _compressed->attrRuns.clear();
+        _compressed->overflow.clear();
+    }
+    else
     {
-        cell.Reset();
+        std::fill(_chars.begin(), _chars.end(), DefaultValue);
+        // a blank row is all single-byte cells; hand any materialized
+        // attribute storage back to the arena.
+        _attrs.clear();
+        _attrs.shrink_to_fit();
+        _overflow.clear();
     }
 
     _wrapForced = false;
@@ -105,34 +254,38 @@ void CharRow::Reset()
 {
     try
     {
-        const value_type insertVals;
-        _data.resize(newSize, insertVals);
+        // a packed row resizes in place as long as its populated prefix still
+        // fits; buffers with deep cold scrollback stay packed across resizes.
+        if (_compressed)
+        {
+            if (_compressed->chars.size() <= newSize)
+            {
+                _compressed->width = newSize;
+                return S_OK;
+            }
+            Decompress();
+        }
+
+        // drop any overflow glyphs that fall beyond the new width.
+        const auto firstOutside = std::lower_bound(_overflow.cbegin(),
+                                                   _overflow.cend(),
+                                                   newSize,
+                                                   [](const OverflowGlyph& entry, const size_t column) {
+                                                       return entry.column < column;
+                                                   });
+        _overflow.erase(firstOutside, _overflow.cend());
+
+        _chars.resize(newSize, DefaultValue);
+        if (!_attrs.empty())
+        {
+            _attrs.resize(newSize, DbcsAttribute{});
+        }
     }
     CATCH_RETURN();
 
     return S_OK;
 }
 
-typename CharRow::iterator CharRow::begin() noexcept
-{
-    return _data.begin();
-}
-
-typename CharRow::const_iterator CharRow::cbegin() const noexcept
-{
-    return _data.cbegin();
-}
-
-typename CharRow::iterator CharRow::end() noexcept
-{
-    return _data.end();
-}
-
-typename CharRow::const_iterator CharRow::cend() const noexcept
-{
-    return _data.cend();
-}
-
 // Routine Description:
 // - Inspects the current internal string to find the left edge of it
 // Arguments:
@@ -141,12 +294,22 @@ typename CharRow::const_iterator CharRow::cend() const noexcept
 // - The calculated left boundary of the internal string.
 size_t CharRow::MeasureLeft() const
 {
-    std::vector<value_type>::const_iterator it = _data.cbegin();
-    while (it != _data.cend() && it->IsSpace())
+    const size_t width = _chars.size();
+    const size_t firstText = s_FindFirstNonBlank(_chars.data(), width);
+
+    // A cell holding an overflow glyph can keep a stale blank as its inline
+    // code unit, so the blank prefix still has to be checked for stored glyphs.
+    if (_attrs.empty() || !s_AnyGlyphStored(_attrs.data(), firstText))
+    {
+        return firstText;
+    }
+
+    size_t column = 0;
+    while (column < width && _isSpace(column))
     {
-        ++it;
+        ++column;
     }
-    return it - _data.cbegin();
+    return column;
 }
 
 // Routine Description:
@@ -157,17 +320,35 @@ size_t CharRow::MeasureLeft() const
 // - The calculated right boundary of the internal string.
 size_t CharRow::MeasureRight() const noexcept
 {
-    std::vector<value_type>::const_reverse_iterator it = _data.crbegin();
-    while (it != _data.crend() && it->IsSpace())
+    const size_t width = _chars.size();
+    const size_t textExtent = s_FindTextExtent(_chars.data(), width);
+
+    // Same caveat as MeasureLeft: an overflow glyph can hide behind a blank
+    // inline code unit anywhere in the trailing margin.
+    if (_attrs.empty() || !s_AnyGlyphStored(_attrs.data() + textExtent, width - textExtent))
+    {
+        return textExtent;
+    }
+
+    size_t column = width;
+    while (column > 0 && _isSpace(column - 1))
     {
-        ++it;
+        --column;
     }
-    return _data.crend() - it;
+    return column;
 }
 
 void CharRow::ClearCell(const size_t column)
 {
-    _data.at(column).Reset();
+    if (!_attrs.empty())
+    {
+        if (_attrs.at(column).IsGlyphStored())
+        {
+            _eraseOverflow(column);
+        }
+        _attrs.at(column).Reset();
+    }
+    _chars.at(column) = DefaultValue;
 }
 
 // Routine Description:
@@ -178,9 +359,9 @@ void CharRow::ClearCell(const size_t column)
 // - True if there is valid text in this row. False otherwise.
 bool CharRow::ContainsText() const noexcept
 {
-    for (const value_type& cell : _data)
+    for (size_t column = 0; column < _chars.size(); ++column)
     {
-        if (!cell.IsSpace())
+        if (!_isSpace(column))
         {
             return true;
         }
@@ -197,7 +378,15 @@ bool CharRow::ContainsText() const noexcept
 // Note: will throw exception if column is out of bounds
 const DbcsAttribute& CharRow::DbcsAttrAt(const size_t column) const
 {
-    return _data.at(column).DbcsAttr();
+    // while the attributes are unmaterialized every cell is single-byte, so
+    // hand out a shared default instead of allocating per-cell storage.
+    if (_attrs.empty())
+    {
+        THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
+        static const DbcsAttribute s_defaultAttr;
+        return s_defaultAttr;
+    }
+    return _attrs.at(column);
 }
 
 // Routine Description:
@@ -207,9 +396,35 @@ const DbcsAttribute& CharRow::DbcsAttrAt(const size_t column) const
 // Return Value:
 // - the attribute
 // Note: will throw exception if column is out of bounds
+// Note: materializes the per-cell attribute storage on first use since the
+//       caller can write any value through the returned reference
 DbcsAttribute& CharRow::DbcsAttrAt(const size_t column)
 {
-    return const_cast<DbcsAttribute&>(static_cast<const CharRow* const>(this)->DbcsAttrAt(column));
+    if (_attrs.empty())
+    {
+        _attrs.assign(_chars.size(), DbcsAttribute{});
+    }
+    return _attrs.at(column);
+}
+
+// Routine Description:
+// - sets the attribute at the specified column
+// Arguments:
+// - column - the column to set the attribute for
+// - attr - the attribute to store
+// Return Value:
+// - <none>
+// Note: will throw exception if column is out of bounds
+// Note: storing the default attribute into an unmaterialized row is a no-op,
+//       so writing plain text never forces the per-cell storage into being
+void CharRow::SetDbcsAttr(const size_t column, const DbcsAttribute attr)
+{
+    if (_attrs.empty() && attr.IsSingle() && !attr.IsGlyphStored())
+    {
+        THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
+        return;
+    }
+    DbcsAttrAt(column) = attr;
 }
 
 // Routine Description:
@@ -221,7 +436,44 @@ DbcsAttribute& CharRow::DbcsAttrAt(const size_t column)
 // Note: will throw exception if column is out of bounds
 void CharRow::ClearGlyph(const size_t column)
 {
-    _data.at(column).EraseChars();
+    if (!_attrs.empty())
+    {
+        auto& attr = _attrs.at(column);
+        if (attr.IsGlyphStored())
+        {
+            _eraseOverflow(column);
+            attr.SetGlyphStored(false);
+        }
+    }
+    _chars.at(column) = DefaultValue;
+}
+
+// Routine Description:
+// - bulk-writes a run of single-code-unit narrow glyphs starting at the given
+//   column, resetting each covered cell's DBCS attribute and dropping any
+//   overflow glyphs the run overwrites
+// Arguments:
+// - startColumn - the first column to write into
+// - chars - one code unit per cell to copy into the row
+// Return Value:
+// - <none>
+// Note: will throw exception if the run extends past the end of the row
+void CharRow::WriteRun(const size_t startColumn, const std::wstring_view chars)
+{
+    THROW_HR_IF(E_INVALIDARG, startColumn + chars.size() > _chars.size());
+
+    const auto compareColumn = [](const OverflowGlyph& entry, const size_t col) {
+        return entry.column < col;
+    };
+    const auto first = std::lower_bound(_overflow.begin(), _overflow.end(), startColumn, compareColumn);
+    const auto last = std::lower_bound(first, _overflow.end(), startColumn + chars.size(), compareColumn);
+    _overflow.erase(first, last);
+
+    std::copy(chars.begin(), chars.end(), _chars.begin() + startColumn);
+    if (!_attrs.empty())
+    {
+        std::fill_n(_attrs.begin() + startColumn, chars.size(), DbcsAttribute{});
+    }
 }
 
 // Routine Description:
@@ -233,7 +485,7 @@ void CharRow::ClearGlyph(const size_t column)
 // - Note: will throw exception if column is out of bounds
 const CharRow::reference CharRow::GlyphAt(const size_t column) const
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _data.size());
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
     return { const_cast<CharRow&>(*this), column };
 }
 
@@ -246,7 +498,7 @@ const CharRow::reference CharRow::GlyphAt(const size_t column) const
 // - Note: will throw exception if column is out of bounds
 CharRow::reference CharRow::GlyphAt(const size_t column)
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _data.size());
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
     return { *this, column };
 }
 
@@ -260,9 +512,16 @@ CharRow::reference CharRow::GlyphAt(const size_t column)
 // - Note: will throw exception if out of memory
 std::wstring CharRow::GetTextRaw() const
 {
+    // with no DBCS attributes and no overflow glyphs the row's text is
+    // exactly its inline character storage.
+    if (_attrs.empty() && _overflow.empty())
+    {
+        return { _chars.cbegin(), _chars.cend() };
+    }
+
     std::wstring wstr;
-    wstr.reserve(_data.size());
-    for (size_t i = 0; i < _data.size(); ++i)
+    wstr.reserve(_chars.size());
+    for (size_t i = 0; i < _chars.size(); ++i)
     {
         auto glyph = GlyphAt(i);
         for (auto it = glyph.begin(); it != glyph.end(); ++it)
@@ -273,12 +532,29 @@ std::wstring CharRow::GetTextRaw() const
     return wstr;
 }
 
+// Routine Description:
+// - gets a view over the contiguous UTF-16 storage for the whole row. cells
+//   holding overflow glyphs only contribute their single inline code unit.
+// Return Value:
+// - view of the row's character storage
+std::wstring_view CharRow::Chars() const noexcept
+{
+    return { _chars.data(), _chars.size() };
+}
+
 std::wstring CharRow::GetText() const
 {
+    // a row without DBCS cells or overflow glyphs has no trailing cells to
+    // skip, so its text is exactly the inline character storage.
+    if (_attrs.empty() && _overflow.empty())
+    {
+        return { _chars.cbegin(), _chars.cend() };
+    }
+
     std::wstring wstr;
-    wstr.reserve(_data.size());
+    wstr.reserve(_chars.size());
 
-    for (size_t i = 0; i < _data.size(); ++i)
+    for (size_t i = 0; i < _chars.size(); ++i)
     {
         auto glyph = GlyphAt(i);
         if (!DbcsAttrAt(i).IsTrailing())
@@ -292,25 +568,148 @@ std::wstring CharRow::GetText() const
     return wstr;
 }
 
-UnicodeStorage& CharRow::GetUnicodeStorage()
+// Routine Description:
+// - copies another row's character data, overwriting whatever is stored here.
+//   used to build read-only buffer snapshots for the renderer.
+// Arguments:
+// - other - the row to copy from. must not be compressed.
+// Return Value:
+// - <none>
+// Note: will throw exception if the source row is compressed or on allocation failure
+void CharRow::CopyFrom(const CharRow& other)
 {
-    return _pParent->GetUnicodeStorage();
+    THROW_HR_IF(E_INVALIDARG, other.IsCompressed());
+
+    _compressed.reset();
+    _chars.assign(other._chars.cbegin(), other._chars.cend());
+    _attrs.assign(other._attrs.cbegin(), other._attrs.cend());
+    _overflow = other._overflow;
+    _wrapForced = other._wrapForced;
+    _doubleBytePadded = other._doubleBytePadded;
 }
 
-const UnicodeStorage& CharRow::GetUnicodeStorage() const
+// Routine Description:
+// - reports whether this row's character data is currently packed into the
+//   cold scrollback form
+// Arguments:
+// - <none>
+// Return Value:
+// - true if the row is compressed. false if the expanded storage is live.
+bool CharRow::IsCompressed() const noexcept
 {
-    return _pParent->GetUnicodeStorage();
+    return _compressed != nullptr;
+}
+
+// Routine Description:
+// - packs the character data into the compact cold-scrollback form and
+//   releases the expanded storage back to the arena. every accessor other
+//   than size(), Reset(), and Resize() requires the row to be decompressed
+//   first; the text buffer rehydrates rows as they're handed out.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+// Note: will throw exception if out of memory
+void CharRow::Compress()
+{
+    if (_compressed)
+    {
+        return;
+    }
+
+    auto data = std::make_unique<CompressedData>();
+    data->width = _chars.size();
+
+    // only cells whose glyph or DBCS attribute differs from the blank state
+    // need to survive; trim the trailing run of blanks off entirely.
+    const bool hasAttrs = !_attrs.empty();
+    size_t populated = _chars.size();
+    while (populated > 0 &&
+           _chars[populated - 1] == DefaultValue &&
+           (!hasAttrs || (_attrs[populated - 1].IsSingle() && !_attrs[populated - 1].IsGlyphStored())))
+    {
+        --populated;
+    }
+
+    data->chars.assign(_chars.cbegin(), _chars.cbegin() + populated);
+
+    // run length encode the DBCS attributes over the populated prefix. rows
+    // of plain text collapse to a single run.
+    if (hasAttrs)
+    {
+        for (size_t i = 0; i < populated; ++i)
+        {
+            if (data->attrRuns.empty() || !(data->attrRuns.back().first == _attrs[i]) ||
+                data->attrRuns.back().first.IsGlyphStored() != _attrs[i].IsGlyphStored())
+            {
+                data->attrRuns.emplace_back(_attrs[i], 1);
+            }
+            else
+            {
+                ++data->attrRuns.back().second;
+            }
+        }
+
+        // an all-default run carries no information; dropping it here keeps
+        // the row in the zero-metadata state when it's rehydrated.
+        if (data->attrRuns.size() == 1 &&
+            data->attrRuns.front().first.IsSingle() &&
+            !data->attrRuns.front().first.IsGlyphStored())
+        {
+            data->attrRuns.clear();
+        }
+    }
+
+    data->overflow = std::move(_overflow);
+    _overflow.clear();
+
+    _compressed = std::move(data);
+    _chars.clear();
+    _chars.shrink_to_fit();
+    _attrs.clear();
+    _attrs.shrink_to_fit();
 }
 
 // Routine Description:
-// - calculates the key used by the given column of the char row to store glyph data in UnicodeStorage
+// - rebuilds the expanded character storage from the compact form. no-op if
+//   the row is already hot.
 // Arguments:
-// - column - the column to generate the key for
+// - <none>
 // Return Value:
-// - the COORD key for data access from UnicodeStorage for the column
-COORD CharRow::GetStorageKey(const size_t column) const
+// - <none>
+// Note: will throw exception if out of memory
+void CharRow::Decompress()
 {
-    return { gsl::narrow<SHORT>(column), _pParent->GetId() };
+    if (!_compressed)
+    {
+        return;
+    }
+
+    const auto data = std::move(_compressed);
+
+    _chars.assign(data->width, DefaultValue);
+
+    std::copy(data->chars.cbegin(), data->chars.cend(), _chars.begin());
+
+    // rows that packed without any attribute runs were all single-byte;
+    // leave their per-cell attributes unmaterialized.
+    if (data->attrRuns.empty())
+    {
+        _attrs.clear();
+        _attrs.shrink_to_fit();
+    }
+    else
+    {
+        _attrs.assign(data->width, DbcsAttribute{});
+        size_t column = 0;
+        for (const auto& [attr, length] : data->attrRuns)
+        {
+            std::fill_n(_attrs.begin() + column, length, attr);
+            column += length;
+        }
+    }
+
+    _overflow = std::move(data->overflow);
 }
 
 // Routine Description:
@@ -321,3 +720,90 @@ void CharRow::UpdateParent(ROW* const pParent) noexcept
 {
     _pParent = FAIL_FAST_IF_NULL(pParent);
 }
+
+// Routine Description:
+// - checks if the glyph at the given column is a space
+// Arguments:
+// - column - the column to check
+// Return Value:
+// - true if the column contains a space glyph, false otherwise
+bool CharRow::_isSpace(const size_t column) const noexcept
+{
+    if (!_attrs.empty() && _attrs[column].IsGlyphStored())
+    {
+        return false;
+    }
+    return _chars[column] == UNICODE_SPACE;
+}
+
+// Routine Description:
+// - finds the overflow entry for the given column, if one is stored
+// Arguments:
+// - column - the column to search for
+// Return Value:
+// - iterator to the matching entry, or _overflow.cend() if the column has none
+std::vector<CharRow::OverflowGlyph>::const_iterator CharRow::_findOverflow(const size_t column) const noexcept
+{
+    const auto it = std::lower_bound(_overflow.cbegin(),
+                                     _overflow.cend(),
+                                     column,
+                                     [](const OverflowGlyph& entry, const size_t col) {
+                                         return entry.column < col;
+                                     });
+    if (it != _overflow.cend() && it->column == column)
+    {
+        return it;
+    }
+    return _overflow.cend();
+}
+
+// Routine Description:
+// - fetches the overflow glyph text stored for the given column
+// Arguments:
+// - column - the column to fetch the text for
+// Return Value:
+// - the stored glyph text
+// Note: will throw exception if no overflow glyph is stored for the column
+const std::wstring& CharRow::_overflowAt(const size_t column) const
+{
+    const auto it = _findOverflow(column);
+    THROW_HR_IF(E_NOT_VALID_STATE, it == _overflow.cend());
+    return it->chars;
+}
+
+// Routine Description:
+// - stores overflow glyph text for the given column, replacing any text
+//   already stored there
+// Arguments:
+// - column - the column the glyph occupies
+// - chars - the glyph text to store
+void CharRow::_storeOverflow(const size_t column, std::wstring chars)
+{
+    const auto it = std::lower_bound(_overflow.begin(),
+                                     _overflow.end(),
+                                     column,
+                                     [](const OverflowGlyph& entry, const size_t col) {
+                                         return entry.column < col;
+                                     });
+    if (it != _overflow.end() && it->column == column)
+    {
+        it->chars = std::move(chars);
+    }
+    else
+    {
+        _overflow.insert(it, { column, std::move(chars) });
+    }
+}
+
+// Routine Description:
+// - erases the overflow glyph text stored for the given column, if any
+// Arguments:
+// - column - the column to erase the text for
+void CharRow::_eraseOverflow(const size_t column) noexcept
+{
+    const auto it = _findOverflow(column);
+    if (it != _overflow.cend())
+    {
+        _overflow.erase(it);
+    }
+}
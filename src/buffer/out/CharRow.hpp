@@ -20,10 +20,10 @@ Revision History:
 
 #pragma once
 
+#include <memory_resource>
+
 #include "DbcsAttribute.hpp"
 #include "CharRowCellReference.hpp"
-#include "CharRowCell.hpp"
-#include "UnicodeStorage.hpp"
 
 class ROW;
 
@@ -41,12 +41,39 @@ class CharRow final
 {
 public:
     using glyph_type = typename wchar_t;
-    using value_type = typename CharRowCell;
-    using iterator = typename std::vector<value_type>::iterator;
-    using const_iterator = typename std::vector<value_type>::const_iterator;
     using reference = typename CharRowCellReference;
 
-    CharRow(size_t rowWidth, ROW* const pParent);
+    // a glyph that needed more than one UTF-16 code unit, stored against the
+    // column it occupies. rows rarely hold more than a handful of these, so a
+    // flat vector sorted by column is cheaper to search than any node-based
+    // container and travels with the row when the buffer scrolls or resizes.
+    struct OverflowGlyph
+    {
+        size_t column;
+        std::wstring chars;
+
+        friend bool operator==(const OverflowGlyph& a, const OverflowGlyph& b) noexcept
+        {
+            return a.column == b.column && a.chars == b.chars;
+        }
+    };
+
+    // packed form of a cold row's character data. the trailing run of blank
+    // cells is trimmed away and the DBCS attributes are run length encoded,
+    // so an idle scrollback row costs roughly its visible text instead of a
+    // full-width pair of arrays.
+    struct CompressedData
+    {
+        size_t width;
+        std::wstring chars;
+        std::vector<std::pair<DbcsAttribute, size_t>> attrRuns;
+        std::vector<OverflowGlyph> overflow;
+    };
+
+    CharRow(size_t rowWidth,
+            ROW* const pParent,
+            std::pmr::memory_resource* const resource = std::pmr::get_default_resource(),
+            const bool deferred = false);
 
     void SetWrapForced(const bool wrap) noexcept;
     bool WasWrapForced() const noexcept;
@@ -61,8 +88,12 @@ public:
     bool ContainsText() const noexcept;
     const DbcsAttribute& DbcsAttrAt(const size_t column) const;
     DbcsAttribute& DbcsAttrAt(const size_t column);
+    void SetDbcsAttr(const size_t column, const DbcsAttribute attr);
     void ClearGlyph(const size_t column);
+    void WriteRun(const size_t startColumn, const std::wstring_view chars);
+    void CopyFrom(const CharRow& other);
     std::wstring GetText() const;
+    std::wstring_view Chars() const noexcept;
 
     // other functions implemented at the template class level
     std::wstring GetTextRaw() const;
@@ -71,21 +102,15 @@ public:
     const reference GlyphAt(const size_t column) const;
     reference GlyphAt(const size_t column);
 
-    // iterators
-    iterator begin() noexcept;
-    const_iterator cbegin() const noexcept;
-
-    iterator end() noexcept;
-    const_iterator cend() const noexcept;
-
-    UnicodeStorage& GetUnicodeStorage();
-    const UnicodeStorage& GetUnicodeStorage() const;
-    COORD GetStorageKey(const size_t column) const;
+    // cold storage for scrollback rows
+    bool IsCompressed() const noexcept;
+    void Compress();
+    void Decompress();
 
     void UpdateParent(ROW* const pParent) noexcept;
 
     friend CharRowCellReference;
-    friend constexpr bool operator==(const CharRow& a, const CharRow& b) noexcept;
+    friend bool operator==(const CharRow& a, const CharRow& b) noexcept;
 
 protected:
     // Occurs when the user runs out of text in a given row and we're forced to wrap the cursor to the next line
@@ -94,28 +119,70 @@ protected:
     // Occurs when the user runs out of text to support a double byte character and we're forced to the next line
     bool _doubleBytePadded;
 
-    // storage for glyph data and dbcs attributes
-    std::vector<value_type> _data;
+    // structure-of-arrays storage for the row. the UTF-16 code unit for every
+    // column lives contiguously in _chars while the matching DBCS attributes
+    // are packed separately in _attrs, so measurement and render passes can
+    // walk the glyph data without striding over attribute bytes.
+    // _attrs is materialized lazily: while it's empty, every cell is
+    // single-byte with no stored glyph, so the pure-ASCII rows that dominate
+    // Western-locale buffers pay no per-cell DBCS metadata at all.
+    // both vectors draw from the arena owned by the parent text buffer (when
+    // one was supplied) so that row construction doesn't hit the global heap.
+    std::pmr::vector<glyph_type> _chars;
+    std::pmr::vector<DbcsAttribute> _attrs;
+
+    // glyphs too wide for a single wchar_t cell, sorted by column.
+    std::vector<OverflowGlyph> _overflow;
+
+    // set while the row is in the cold scrollback tier. the expanded vectors
+    // above are released back to the arena for the duration and everything
+    // needed to rebuild them lives here.
+    std::unique_ptr<CompressedData> _compressed;
 
     // ROW that this CharRow belongs to
     ROW* _pParent;
+
+private:
+    bool _isSpace(const size_t column) const noexcept;
+
+    std::vector<OverflowGlyph>::const_iterator _findOverflow(const size_t column) const noexcept;
+    const std::wstring& _overflowAt(const size_t column) const;
+    void _storeOverflow(const size_t column, std::wstring chars);
+    void _eraseOverflow(const size_t column) noexcept;
+
+#ifdef UNIT_TESTING
+    friend class TextBufferTests;
+#endif
 };
 
-constexpr bool operator==(const CharRow& a, const CharRow& b) noexcept
+inline bool operator==(const CharRow& a, const CharRow& b) noexcept
 {
+    // per-cell DBCS attributes are materialized lazily, so an empty attribute
+    // vector has to compare equal to one filled with the default attribute.
+    const auto allDefault = [](const std::pmr::vector<DbcsAttribute>& attrs) noexcept {
+        return std::all_of(attrs.cbegin(), attrs.cend(), [](const DbcsAttribute& attr) noexcept {
+            return attr.IsSingle() && !attr.IsGlyphStored();
+        });
+    };
+    const bool attrsEqual = a._attrs.size() == b._attrs.size() ?
+                                a._attrs == b._attrs :
+                                (a._attrs.empty() || b._attrs.empty()) && allDefault(a._attrs) && allDefault(b._attrs);
+
     return (a._wrapForced == b._wrapForced &&
             a._doubleBytePadded == b._doubleBytePadded &&
-            a._data == b._data);
+            a._chars == b._chars &&
+            attrsEqual &&
+            a._overflow == b._overflow);
 }
 
 template<typename InputIt1, typename InputIt2>
-void OverwriteColumns(InputIt1 startChars, InputIt1 endChars, InputIt2 startAttrs, CharRow::iterator outIt)
+void OverwriteColumns(InputIt1 startChars, InputIt1 endChars, InputIt2 startAttrs, CharRow& charRow, const size_t startIndex)
 {
-    std::transform(startChars,
-                   endChars,
-                   startAttrs,
-                   outIt,
-                   [](const wchar_t wch, const DbcsAttribute attr) {
-                       return CharRow::value_type{ wch, attr };
-                   });
+    size_t column = startIndex;
+    auto attrIt = startAttrs;
+    for (auto charIt = startChars; charIt != endChars; ++charIt, ++attrIt, ++column)
+    {
+        charRow.SetDbcsAttr(column, *attrIt);
+        charRow.GlyphAt(column) = { &*charIt, 1 };
+    }
 }
@@ -2,11 +2,10 @@
 // Licensed under the MIT license.
 
 #include "precomp.h"
-#include "UnicodeStorage.hpp"
 #include "CharRow.hpp"
 
 // Routine Description:
-// - assignment operator. will store extended glyph data in a separate storage location
+// - assignment operator. will store extended glyph data in the parent row's overflow storage
 // Arguments:
 // - chars - the glyph data to store
 void CharRowCellReference::operator=(const std::wstring_view chars)
@@ -14,15 +13,19 @@ void CharRowCellReference::operator=(const std::wstring_view chars)
     THROW_HR_IF(E_INVALIDARG, chars.empty());
     if (chars.size() == 1)
     {
-        _cellData().Char() = chars.front();
-        _cellData().DbcsAttr().SetGlyphStored(false);
+        // check through the const accessor so storing a plain narrow glyph
+        // doesn't force the parent row to materialize per-cell attributes.
+        if (static_cast<const CharRowCellReference&>(*this)._dbcsAttr().IsGlyphStored())
+        {
+            _parent._eraseOverflow(_index);
+            _dbcsAttr().SetGlyphStored(false);
+        }
+        _char() = chars.front();
     }
     else
     {
-        auto& storage = _parent.GetUnicodeStorage();
-        const auto key = _parent.GetStorageKey(_index);
-        storage.StoreGlyph(key, { chars.cbegin(), chars.cend() });
-        _cellData().DbcsAttr().SetGlyphStored(true);
+        _parent._storeOverflow(_index, { chars.cbegin(), chars.cend() });
+        _dbcsAttr().SetGlyphStored(true);
     }
 }
 
@@ -36,21 +39,41 @@ CharRowCellReference::operator std::wstring_view() const
 }
 
 // Routine Description:
-// - The CharRowCell this object "references"
+// - The glyph slot in the parent char row this object "references"
 // Return Value:
-// - ref to the CharRowCell
-CharRowCell& CharRowCellReference::_cellData()
+// - ref to the wchar_t
+wchar_t& CharRowCellReference::_char()
 {
-    return _parent._data.at(_index);
+    return _parent._chars.at(_index);
 }
 
 // Routine Description:
-// - The CharRowCell this object "references"
+// - The glyph slot in the parent char row this object "references"
 // Return Value:
-// - ref to the CharRowCell
-const CharRowCell& CharRowCellReference::_cellData() const
+// - ref to the wchar_t
+const wchar_t& CharRowCellReference::_char() const
 {
-    return _parent._data.at(_index);
+    return _parent._chars.at(_index);
+}
+
+// Routine Description:
+// - The DBCS attribute in the parent char row this object "references"
+// Return Value:
+// - ref to the DbcsAttribute
+DbcsAttribute& CharRowCellReference::_dbcsAttr()
+{
+    // route through the parent's accessor so the per-cell attribute storage
+    // is materialized before a reference to it is handed out.
+    return _parent.DbcsAttrAt(_index);
+}
+
+// Routine Description:
+// - The DBCS attribute in the parent char row this object "references"
+// Return Value:
+// - ref to the DbcsAttribute
+const DbcsAttribute& CharRowCellReference::_dbcsAttr() const
+{
+    return static_cast<const CharRow&>(_parent).DbcsAttrAt(_index);
 }
 
 // Routine Description:
@@ -59,15 +82,15 @@ const CharRowCell& CharRowCellReference::_cellData() const
 // - the glyph data
 std::wstring_view CharRowCellReference::_glyphData() const
 {
-    if (_cellData().DbcsAttr().IsGlyphStored())
+    if (_dbcsAttr().IsGlyphStored())
     {
-        const auto& text = _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index));
+        const auto& text = _parent._overflowAt(_index);
 
         return { text.data(), text.size() };
     }
     else
     {
-        return { &_cellData().Char(), 1 };
+        return { &_char(), 1 };
     }
 }
 
@@ -77,13 +100,13 @@ std::wstring_view CharRowCellReference::_glyphData() const
 // - iterator of the glyph data
 CharRowCellReference::const_iterator CharRowCellReference::begin() const
 {
-    if (_cellData().DbcsAttr().IsGlyphStored())
+    if (_dbcsAttr().IsGlyphStored())
     {
-        return _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index)).data();
+        return _parent._overflowAt(_index).data();
     }
     else
     {
-        return &_cellData().Char();
+        return &_char();
     }
 }
 
@@ -93,20 +116,20 @@ CharRowCellReference::const_iterator CharRowCellReference::begin() const
 // - end iterator of the glyph data
 CharRowCellReference::const_iterator CharRowCellReference::end() const
 {
-    if (_cellData().DbcsAttr().IsGlyphStored())
+    if (_dbcsAttr().IsGlyphStored())
     {
-        const auto& chars = _parent.GetUnicodeStorage().GetText(_parent.GetStorageKey(_index));
+        const auto& chars = _parent._overflowAt(_index);
         return chars.data() + chars.size();
     }
     else
     {
-        return &_cellData().Char() + 1;
+        return &_char() + 1;
     }
 }
 
 bool operator==(const CharRowCellReference& ref, const std::vector<wchar_t>& glyph)
 {
-    const DbcsAttribute& dbcsAttr = ref._cellData().DbcsAttr();
+    const DbcsAttribute& dbcsAttr = ref._dbcsAttr();
     if (glyph.size() == 1 && dbcsAttr.IsGlyphStored())
     {
         return false;
@@ -117,12 +140,12 @@ bool operator==(const CharRowCellReference& ref, const std::vector<wchar_t>& gly
     }
     else if (glyph.size() == 1 && !dbcsAttr.IsGlyphStored())
     {
-        return ref._cellData().Char() == glyph.front();
+        return ref._char() == glyph.front();
     }
     else
     {
-        const auto& chars = ref._parent.GetUnicodeStorage().GetText(ref._parent.GetStorageKey(ref._index));
-        return chars == glyph;
+        const auto& chars = ref._parent._overflowAt(ref._index);
+        return std::equal(chars.cbegin(), chars.cend(), glyph.cbegin(), glyph.cend());
     }
 }
 
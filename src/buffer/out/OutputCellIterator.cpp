@@ -311,6 +311,58 @@ OutputCellIterator OutputCellIterator::operator++(int)
     return temp;
 }
 
+// Routine Description:
+// - Provides a view of the upcoming run of plain text in the underlying data without
+//   advancing the iterator. Only the Loose and LooseTextOnly modes over printable ASCII
+//   qualify: those characters are guaranteed to occupy exactly one code unit and one
+//   column apiece, so a caller can copy the whole run straight into row storage and skip
+//   the per-cell view generation entirely.
+// Return Value:
+// - View of the upcoming simple characters. Empty if the current data doesn't qualify.
+std::wstring_view OutputCellIterator::PeekSimpleRun() const noexcept
+{
+    if (_mode == Mode::Loose || _mode == Mode::LooseTextOnly)
+    {
+        const auto run = std::get<std::wstring_view>(_run);
+        size_t end = _pos;
+        while (end < run.size() && run[end] >= L' ' && run[end] <= L'~')
+        {
+            ++end;
+        }
+        return run.substr(_pos, end - _pos);
+    }
+    return {};
+}
+
+// Routine Description:
+// - Advances the iterator past a number of cells previously obtained from PeekSimpleRun.
+//   Each of those cells consumes exactly one code unit of the underlying data, so this is
+//   a straight index jump with a single view regeneration at the landing position.
+// Arguments:
+// - cells - number of cells to advance past. Must not exceed the last PeekSimpleRun size.
+void OutputCellIterator::AdvanceBy(const size_t cells)
+{
+    FAIL_FAST_IF(!(_mode == Mode::Loose || _mode == Mode::LooseTextOnly));
+
+    const auto run = std::get<std::wstring_view>(_run);
+    FAIL_FAST_IF(_pos + cells > run.size());
+
+    _pos += cells;
+    _distance += cells;
+
+    if (operator bool())
+    {
+        if (_mode == Mode::Loose)
+        {
+            _currentView = s_GenerateView(run.substr(_pos), _attr);
+        }
+        else
+        {
+            _currentView = s_GenerateView(run.substr(_pos));
+        }
+    }
+}
+
 // Routine Description:
 // - Reference the view to fully-formed output cell data representing the underlying data source.
 // Return Value:
@@ -58,6 +58,9 @@ public:
     const OutputCellView& operator*() const;
     const OutputCellView* operator->() const;
 
+    std::wstring_view PeekSimpleRun() const noexcept;
+    void AdvanceBy(const size_t cells);
+
 private:
     enum class Mode
     {
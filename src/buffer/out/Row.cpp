@@ -14,12 +14,19 @@
 // - rowWidth - the width of the row, cell elements
 // - fillAttribute - the default text attribute
 // - pParent - the text buffer that this row belongs to
+// - deferred - if true, the row starts packed blank and materializes its
+//              character storage on first visit
 // Return Value:
 // - constructed object
-ROW::ROW(const SHORT rowId, const short rowWidth, const TextAttribute fillAttribute, TextBuffer* const pParent) :
+ROW::ROW(const SHORT rowId, const short rowWidth, const TextAttribute fillAttribute, TextBuffer* const pParent, const bool deferred) :
     _id{ rowId },
     _rowWidth{ gsl::narrow<size_t>(rowWidth) },
-    _charRow{ gsl::narrow<size_t>(rowWidth), this },
+    _version{ 0 },
+    _textVersion{ 0 },
+    _wordRunStarts{},
+    _firstWordRunIsDelim{ false },
+    _wordRunVersion{ SIZE_MAX },
+    _charRow{ gsl::narrow<size_t>(rowWidth), this, FAIL_FAST_IF_NULL(pParent)->GetRowStorageArena(), deferred },
     _attrRow{ gsl::narrow<UINT>(rowWidth), fillAttribute },
     _pParent{ pParent }
 {
@@ -37,6 +44,9 @@ const CharRow& ROW::GetCharRow() const
 
 CharRow& ROW::GetCharRow()
 {
+    // Mutable access is assumed to mean mutation - a spurious bump only costs
+    // one extra repaint of this row, while a missed one would leave it stale.
+    BumpVersion();
     return const_cast<CharRow&>(static_cast<const ROW* const>(this)->GetCharRow());
 }
 
@@ -47,6 +57,10 @@ const ATTR_ROW& ROW::GetAttrRow() const noexcept
 
 ATTR_ROW& ROW::GetAttrRow() noexcept
 {
+    // See the matching comment in the non-const GetCharRow. Attributes don't
+    // move any glyphs, though, so the text version stays put and retained
+    // text segmentations remain valid.
+    _version++;
     return const_cast<ATTR_ROW&>(static_cast<const ROW* const>(this)->GetAttrRow());
 }
 
@@ -60,6 +74,94 @@ void ROW::SetId(const SHORT id) noexcept
     _id = id;
 }
 
+// Routine Description:
+// - Retrieves the content version of this row. See BumpVersion.
+// Arguments:
+// - <none>
+// Return Value:
+// - The current version number.
+size_t ROW::GetVersion() const noexcept
+{
+    return _version;
+}
+
+// Routine Description:
+// - Retrieves the text version of this row: the subset of the content version
+//      that only moves when character data changes. Attribute-only changes
+//      (recoloring existing text) bump GetVersion but not this.
+// Arguments:
+// - <none>
+// Return Value:
+// - The current text version number.
+size_t ROW::GetTextVersion() const noexcept
+{
+    return _textVersion;
+}
+
+// Routine Description:
+// - Advances the content version of this row. Called by everything that can
+//      change how the row draws (character data, attributes, width), so the
+//      renderer can skip rows whose version it has already painted.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void ROW::BumpVersion() noexcept
+{
+    _version++;
+    _textVersion++;
+}
+
+// Routine Description:
+// - Retrieves the columns at which a new character run begins, where a run is
+//      a maximal stretch of cells that are all word delimiters or all
+//      non-delimiters under the given predicate. Computed once per content
+//      version and cached, so word-by-word navigation over a long row is a
+//      binary search over this vector instead of a per-cell rescan of the
+//      delimiter list.
+// Arguments:
+// - isWordDelim - predicate classifying a cell's glyph as a word delimiter
+// Return Value:
+// - Column indices of run starts, ascending. The first entry is always 0 for
+//      a non-empty row.
+const std::vector<SHORT>& ROW::GetWordRunStarts(const std::function<bool(const std::wstring_view)>& isWordDelim) const
+{
+    if (_wordRunVersion != _version)
+    {
+        _wordRunStarts.clear();
+
+        bool fPrevIsDelim = false;
+        for (size_t i = 0; i < _rowWidth; ++i)
+        {
+            const bool fCurrIsDelim = isWordDelim(_charRow.GlyphAt(i));
+            if (i == 0 || fCurrIsDelim != fPrevIsDelim)
+            {
+                if (i == 0)
+                {
+                    _firstWordRunIsDelim = fCurrIsDelim;
+                }
+                _wordRunStarts.push_back(gsl::narrow<SHORT>(i));
+            }
+            fPrevIsDelim = fCurrIsDelim;
+        }
+
+        _wordRunVersion = _version;
+    }
+    return _wordRunStarts;
+}
+
+// Routine Description:
+// - Classifies a run produced by GetWordRunStarts. Runs strictly alternate
+//      classes, so only the first run's class is stored.
+// Arguments:
+// - runIndex - index into the vector returned by GetWordRunStarts
+// Return Value:
+// - true if every cell of the run is a word delimiter
+bool ROW::IsWordRunDelim(const size_t runIndex) const noexcept
+{
+    return _firstWordRunIsDelim != ((runIndex & 1) != 0);
+}
+
 // Routine Description:
 // - Sets all properties of the ROW to default values
 // Arguments:
@@ -68,6 +170,7 @@ void ROW::SetId(const SHORT id) noexcept
 // - <none>
 bool ROW::Reset(const TextAttribute Attr)
 {
+    BumpVersion();
     _charRow.Reset();
     try
     {
@@ -89,6 +192,7 @@ bool ROW::Reset(const TextAttribute Attr)
 // - S_OK if successful, otherwise relevant error
 [[nodiscard]] HRESULT ROW::Resize(const size_t width)
 {
+    BumpVersion();
     RETURN_IF_FAILED(_charRow.Resize(width));
     try
     {
@@ -101,6 +205,40 @@ bool ROW::Reset(const TextAttribute Attr)
     return S_OK;
 }
 
+// Routine Description:
+// - reports whether the row currently lives in the cold scrollback tier
+// Arguments:
+// - <none>
+// Return Value:
+// - true if the row is compressed
+bool ROW::IsCompressed() const noexcept
+{
+    return _charRow.IsCompressed();
+}
+
+// Routine Description:
+// - packs the row into the compact cold-scrollback form. the row must be
+//   decompressed again before any of its cell data is touched.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void ROW::Compress()
+{
+    _charRow.Compress();
+}
+
+// Routine Description:
+// - rehydrates the row from the compact cold-scrollback form. no-op on a hot row.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void ROW::Decompress()
+{
+    _charRow.Decompress();
+}
+
 // Routine Description:
 // - clears char data in column in row
 // Arguments:
@@ -110,6 +248,7 @@ bool ROW::Reset(const TextAttribute Attr)
 void ROW::ClearColumn(const size_t column)
 {
     THROW_HR_IF(E_INVALIDARG, column >= _charRow.size());
+    BumpVersion();
     _charRow.ClearCell(column);
 }
 
@@ -132,16 +271,6 @@ RowCellIterator ROW::AsCellIter(const size_t startIndex, const size_t count) con
     return RowCellIterator(*this, startIndex, count);
 }
 
-UnicodeStorage& ROW::GetUnicodeStorage()
-{
-    return _pParent->GetUnicodeStorage();
-}
-
-const UnicodeStorage& ROW::GetUnicodeStorage() const
-{
-    return _pParent->GetUnicodeStorage();
-}
-
 // Routine Description:
 // - writes cell data to the row
 // Arguments:
@@ -155,6 +284,7 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
 {
     THROW_HR_IF(E_INVALIDARG, index >= _charRow.size());
     THROW_HR_IF(E_INVALIDARG, limitRight.value_or(0) >= _charRow.size());
+    BumpVersion();
     size_t currentIndex = index;
 
     // If we're given a right-side column limit, use it. Otherwise, the write limit is the final column index available in the char row.
@@ -162,6 +292,38 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
 
     while (it && currentIndex <= finalColumnInRow)
     {
+        // Bulk fast path: if the iterator is sitting on a run of plain narrow text,
+        // copy the whole run straight into the row's char storage and apply the
+        // color with a single attribute run insert instead of manufacturing a view
+        // per cell. This is the dominant shape of WriteCharsLegacy traffic.
+        if (const auto simpleRun = it.PeekSimpleRun(); simpleRun.size() > 1)
+        {
+            const size_t cellsAvailable = finalColumnInRow - currentIndex + 1;
+            const size_t fill = std::min(simpleRun.size(), cellsAvailable);
+
+            _charRow.WriteRun(currentIndex, simpleRun.substr(0, fill));
+
+            if (it->TextAttrBehavior() != TextAttributeBehavior::Current)
+            {
+                const TextAttributeRun attrRun{ fill, it->TextAttr() };
+                LOG_IF_FAILED(_attrRow.InsertAttrRuns({ &attrRun, 1 },
+                                                      currentIndex,
+                                                      currentIndex + fill - 1,
+                                                      _charRow.size()));
+            }
+
+            it.AdvanceBy(fill);
+            currentIndex += fill;
+
+            // If we're asked to set the wrap status and we just filled the last column with text, set wrap status on the row.
+            if (setWrap && currentIndex > finalColumnInRow)
+            {
+                _charRow.SetWrapForced(true);
+            }
+
+            continue;
+        }
+
         // Fill the color if the behavior isn't set to keeping the current color.
         if (it->TextAttrBehavior() != TextAttributeBehavior::Current)
         {
@@ -197,7 +359,7 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
             // Otherwise, copy the data given and increment the iterator.
             else
             {
-                _charRow.DbcsAttrAt(currentIndex) = it->DbcsAttr();
+                _charRow.SetDbcsAttr(currentIndex, it->DbcsAttr());
                 _charRow.GlyphAt(currentIndex) = it->Chars();
                 ++it;
             }
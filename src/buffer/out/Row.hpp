@@ -25,14 +25,13 @@ Revision History:
 #include "OutputCellIterator.hpp"
 #include "CharRow.hpp"
 #include "RowCellIterator.hpp"
-#include "UnicodeStorage.hpp"
 
 class TextBuffer;
 
 class ROW final
 {
 public:
-    ROW(const SHORT rowId, const short rowWidth, const TextAttribute fillAttribute, TextBuffer* const pParent);
+    ROW(const SHORT rowId, const short rowWidth, const TextAttribute fillAttribute, TextBuffer* const pParent, const bool deferred = false);
 
     size_t size() const noexcept;
 
@@ -45,18 +44,26 @@ public:
     SHORT GetId() const noexcept;
     void SetId(const SHORT id) noexcept;
 
+    size_t GetVersion() const noexcept;
+    size_t GetTextVersion() const noexcept;
+    void BumpVersion() noexcept;
+
+    const std::vector<SHORT>& GetWordRunStarts(const std::function<bool(const std::wstring_view)>& isWordDelim) const;
+    bool IsWordRunDelim(const size_t runIndex) const noexcept;
+
     bool Reset(const TextAttribute Attr);
     [[nodiscard]] HRESULT Resize(const size_t width);
 
+    bool IsCompressed() const noexcept;
+    void Compress();
+    void Decompress();
+
     void ClearColumn(const size_t column);
     std::wstring GetText() const;
 
     RowCellIterator AsCellIter(const size_t startIndex) const;
     RowCellIterator AsCellIter(const size_t startIndex, const size_t count) const;
 
-    UnicodeStorage& GetUnicodeStorage();
-    const UnicodeStorage& GetUnicodeStorage() const;
-
     OutputCellIterator WriteCells(OutputCellIterator it, const size_t index, const bool setWrap, std::optional<size_t> limitRight = std::nullopt);
 
     friend bool operator==(const ROW& a, const ROW& b) noexcept;
@@ -70,6 +77,20 @@ private:
     ATTR_ROW _attrRow;
     SHORT _id;
     size_t _rowWidth;
+    // Bumped by anything that can change how this row draws, so the renderer
+    // can recognize rows it has already painted. See BumpVersion.
+    size_t _version;
+    // Like _version, but left alone by attribute-only changes. Lets the
+    // renderer tell "the glyphs moved" apart from "only the colors moved",
+    // so text segmentation caches survive recoloring. See GetTextVersion.
+    size_t _textVersion;
+    // Columns at which a maximal run of one delimiter class starts, plus the
+    // class of the first run (runs strictly alternate). Rebuilt lazily when
+    // the content version moves, so writes invalidate it for free. See
+    // GetWordRunStarts.
+    mutable std::vector<SHORT> _wordRunStarts;
+    mutable bool _firstWordRunIsDelim;
+    mutable size_t _wordRunVersion;
     TextBuffer* _pParent; // non ownership pointer
 };
 
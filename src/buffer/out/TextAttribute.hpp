@@ -27,6 +27,8 @@ Revision History:
 #include "WexTestClass.h"
 #endif
 
+#pragma pack(push, 1)
+
 class TextAttribute final
 {
 public:
@@ -123,8 +125,6 @@ public:
 
     void Invert() noexcept;
 
-    friend constexpr bool operator==(const TextAttribute& a, const TextAttribute& b) noexcept;
-    friend constexpr bool operator!=(const TextAttribute& a, const TextAttribute& b) noexcept;
     friend constexpr bool operator==(const TextAttribute& attr, const WORD& legacyAttr) noexcept;
     friend constexpr bool operator!=(const TextAttribute& attr, const WORD& legacyAttr) noexcept;
     friend constexpr bool operator==(const WORD& legacyAttr, const TextAttribute& attr) noexcept;
@@ -169,6 +169,13 @@ private:
 #endif
 };
 
+#pragma pack(pop)
+
+// The attribute is packed (no padding) and every constructor writes every
+// byte, so equality can be one flat memory compare. Run splitting in
+// ATTR_ROW and the renderer compares attributes per cell, so this matters.
+static_assert(sizeof(TextAttribute) == 11, "TextAttribute should pack to exactly 11 bytes");
+
 enum class TextAttributeBehavior
 {
     Stored, // use contained text attribute
@@ -176,15 +183,12 @@ enum class TextAttributeBehavior
     StoredOnly, // only use the contained text attribute and skip the insertion of anything else
 };
 
-constexpr bool operator==(const TextAttribute& a, const TextAttribute& b) noexcept
+inline bool operator==(const TextAttribute& a, const TextAttribute& b) noexcept
 {
-    return a._wAttrLegacy == b._wAttrLegacy &&
-           a._foreground == b._foreground &&
-           a._background == b._background &&
-           a._isBold == b._isBold;
+    return ::memcmp(&a, &b, sizeof(TextAttribute)) == 0;
 }
 
-constexpr bool operator!=(const TextAttribute& a, const TextAttribute& b) noexcept
+inline bool operator!=(const TextAttribute& a, const TextAttribute& b) noexcept
 {
     return !(a == b);
 }
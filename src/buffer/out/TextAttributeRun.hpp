@@ -38,7 +38,9 @@ public:
     void SetAttributesFromLegacy(const WORD wNew) noexcept;
 
 private:
-    size_t _cchLength;
+    // a run can never be longer than a row is wide, so 32 bits is plenty;
+    // together with the packed attribute this keeps a run at 16 bytes.
+    UINT _cchLength;
     TextAttribute _attributes;
 
 #ifdef UNIT_TESTING
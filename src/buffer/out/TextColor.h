@@ -105,7 +105,10 @@ public:
     }
 
 private:
-    ColorType _meta : 2;
+    // deliberately a whole byte rather than a 2-bit field: the containing
+    // TextAttribute compares itself with one flat memory compare, which
+    // requires every bit of this object to be deterministically written.
+    ColorType _meta;
     union
     {
         BYTE _red, _index;
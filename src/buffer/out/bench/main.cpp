@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Micro-benchmark driver for the console text buffer.
+//
+// Builds as a plain console exe next to the BufferOut lib so perf-sensitive
+// buffer changes can be measured per-commit without standing up a console
+// host. Output is one tab-separated line per scenario:
+//
+//   <scenario>  <iterations>  <median-ns>  <min-ns>
+//
+// The median is the number to track across commits; the minimum shows how
+// much scheduling noise the run picked up.
+
+#include "precomp.h"
+
+#include "textBuffer.hpp"
+#include "AttrRow.hpp"
+#include "OutputCellIterator.hpp"
+#include "../../renderer/inc/DummyRenderTarget.hpp"
+
+namespace
+{
+    double s_NsPerQpcTick()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return 1.0e9 / static_cast<double>(frequency.QuadPart);
+    }
+
+    // Routine Description:
+    // - Times one scenario and prints a report line.
+    // - The body runs once untimed to warm caches and the allocator, then
+    //   `iterations` timed passes. We report the median so a single
+    //   descheduled pass doesn't skew the per-commit numbers.
+    // Arguments:
+    // - name - Stable scenario identifier printed in the report
+    // - iterations - Number of timed passes
+    // - body - The work to measure
+    template<typename TBody>
+    void s_RunScenario(const wchar_t* const name, const size_t iterations, TBody&& body)
+    {
+        static const double nsPerTick = s_NsPerQpcTick();
+
+        body();
+
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            LARGE_INTEGER start;
+            LARGE_INTEGER stop;
+            QueryPerformanceCounter(&start);
+            body();
+            QueryPerformanceCounter(&stop);
+            samples.push_back(static_cast<double>(stop.QuadPart - start.QuadPart) * nsPerTick);
+        }
+
+        std::sort(samples.begin(), samples.end());
+        wprintf(L"%-44s\t%zu\t%.0f\t%.0f\n", name, iterations, samples[samples.size() / 2], samples.front());
+    }
+
+    // One pass writes a full-width ASCII line into every row of the buffer,
+    // which is the shape of a full-screen repaint from a busy client.
+    void s_BenchWriteCells(Microsoft::Console::Render::IRenderTarget& renderTarget)
+    {
+        const COORD size{ 120, 1000 };
+        TextBuffer buffer(size, TextAttribute{}, 12, renderTarget);
+        const std::wstring line(gsl::narrow_cast<size_t>(size.X), L'x');
+        const TextAttribute attr{ FOREGROUND_RED | FOREGROUND_INTENSITY };
+
+        s_RunScenario(L"WriteCells/ascii-fill-120x1000", 50, [&]() {
+            for (SHORT y = 0; y < size.Y; ++y)
+            {
+                buffer.Write(OutputCellIterator(std::wstring_view{ line }, attr), { 0, y });
+            }
+        });
+    }
+
+    // Re-inserts an alternating coloring of the whole row so the run
+    // coalescing logic is exercised at several fragmentation levels.
+    void s_BenchInsertAttrRuns()
+    {
+        const UINT width = 128;
+        for (const UINT runCount : { 1u, 8u, 64u })
+        {
+            std::vector<TextAttributeRun> runs;
+            for (UINT i = 0; i < runCount; ++i)
+            {
+                runs.emplace_back(width / runCount, TextAttribute{ gsl::narrow_cast<WORD>((i % 15) + 1) });
+            }
+
+            wchar_t name[64];
+            swprintf_s(name, L"InsertAttrRuns/%u-runs-128-wide", runCount);
+
+            ATTR_ROW row(width, TextAttribute{});
+            s_RunScenario(name, 2000, [&]() {
+                LOG_IF_FAILED(row.InsertAttrRuns({ runs.data(), runs.size() }, 0, width - 1, width));
+            });
+        }
+    }
+
+    // Cycling the circular buffer is the per-scrolled-line cost of a client
+    // spewing output, so it is measured in a batch of 1000 rotations.
+    void s_BenchIncrementCircularBuffer(Microsoft::Console::Render::IRenderTarget& renderTarget)
+    {
+        TextBuffer buffer({ 80, 3000 }, TextAttribute{}, 12, renderTarget);
+
+        s_RunScenario(L"IncrementCircularBuffer/1000-rows-80x3000", 200, [&]() {
+            for (int i = 0; i < 1000; ++i)
+            {
+                buffer.IncrementCircularBuffer();
+            }
+        });
+    }
+
+    // Resizes alternate between two widths and then visit every row, so the
+    // timing includes the lazily-deferred reflow work rather than just the
+    // bookkeeping that ResizeTraditional does up front.
+    void s_BenchResizeReflow(Microsoft::Console::Render::IRenderTarget& renderTarget)
+    {
+        for (const SHORT rows : { 1000, 9000 })
+        {
+            const COORD size{ 120, rows };
+            TextBuffer buffer(size, TextAttribute{}, 12, renderTarget);
+            const std::wstring line(100, L'y');
+            for (SHORT y = 0; y < rows; ++y)
+            {
+                buffer.Write(OutputCellIterator(std::wstring_view{ line }), { 0, y });
+            }
+
+            wchar_t name[64];
+            swprintf_s(name, L"ResizeReflow/120x%d-all-rows-visited", rows);
+
+            SHORT width = size.X;
+            s_RunScenario(name, 20, [&]() {
+                width = (width == size.X) ? 100 : size.X;
+                LOG_IF_FAILED(buffer.ResizeTraditional({ width, rows }));
+                for (SHORT y = 0; y < rows; ++y)
+                {
+                    buffer.GetRowByOffset(y);
+                }
+            });
+        }
+    }
+}
+
+int __cdecl wmain(int /*argc*/, WCHAR* /*argv*/[])
+{
+    DummyRenderTarget renderTarget;
+
+    wprintf(L"%-44s\titerations\tmedian-ns\tmin-ns\n", L"scenario");
+
+    s_BenchWriteCells(renderTarget);
+    s_BenchInsertAttrRuns();
+    s_BenchIncrementCircularBuffer(renderTarget);
+    s_BenchResizeReflow(renderTarget);
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include "CharRow.hpp"
 
 #include "../types/inc/convert.hpp"
+#include "../../inc/AllocAccounting.hpp"
 
 #pragma hdrstop
 
@@ -27,16 +28,21 @@ TextBuffer::TextBuffer(const COORD screenBufferSize,
                        const UINT cursorSize,
                        Microsoft::Console::Render::IRenderTarget& renderTarget) :
     _firstRow{ 0 },
+    _coldBoundary{ 0 },
+    _rowWidth{ screenBufferSize.X },
     _currentAttributes{ defaultAttributes },
     _cursor{ cursorSize, *this },
+    _rowStorageArena{},
     _storage{},
-    _unicodeStorage{},
     _renderTarget{ renderTarget }
 {
-    // initialize ROWs
+    // initialize ROWs. they start packed blank and materialize their
+    // character storage the first time anything visits them, so a freshly
+    // created buffer with a deep scrollback costs almost nothing until the
+    // rows are actually used.
     for (size_t i = 0; i < static_cast<size_t>(screenBufferSize.Y); ++i)
     {
-        _storage.emplace_back(static_cast<SHORT>(i), screenBufferSize.X, _currentAttributes, this);
+        _storage.emplace_back(static_cast<SHORT>(i), screenBufferSize.X, _currentAttributes, this, true);
     }
 }
 
@@ -76,7 +82,15 @@ const ROW& TextBuffer::GetRowByOffset(const size_t index) const
 
     // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
     const size_t offsetIndex = (_firstRow + index) % totalRows;
-    return _storage[offsetIndex];
+    const ROW& row = _storage[offsetIndex];
+
+    // Rows are reshaped and rehydrated the moment they're handed out (the
+    // viewport scrolled back up, a search is walking the buffer, a resize
+    // left them at the old width, etc.) That work rebuilds contents that are
+    // observably identical, so it's logically const.
+    _MaterializeRow(const_cast<ROW&>(row));
+
+    return row;
 }
 
 // Routine Description:
@@ -182,10 +196,11 @@ bool TextBuffer::_AssertValidDoubleByteSequence(const DbcsAttribute dbcsAttribut
 {
     // To figure out if the sequence is valid, we have to look at the character that comes before the current one
     const COORD coordPrevPosition = _GetPreviousFromCursor();
-    ROW& prevRow = GetRowByOffset(coordPrevPosition.Y);
+    const ROW& prevRow = GetRowByOffset(coordPrevPosition.Y);
     DbcsAttribute prevDbcsAttr;
     try
     {
+        // const access: a read shouldn't materialize the row's attributes.
         prevDbcsAttr = prevRow.GetCharRow().DbcsAttrAt(coordPrevPosition.X);
     }
     catch (...)
@@ -347,13 +362,20 @@ OutputCellIterator TextBuffer::Write(const OutputCellIterator givenIt,
 // - target - Coordinate targeted within output buffer
 // - setWrap - Whether we should try to set the wrap flag if we write up to the end of the line and have more data
 // - limitRight - Optionally restrict the right boundary for writing (e.g. stop writing earlier than the end of line)
+// - notifyPaint - Whether to notify the renderer about the written region.
+//                 Rectangle writers pass false per row and invalidate the
+//                 whole rectangle once instead of once per row.
 // Return Value:
 // - The iterator, but advanced to where we stopped writing. Use to find input consumed length or cells written length.
 OutputCellIterator TextBuffer::WriteLine(const OutputCellIterator givenIt,
                                          const COORD target,
                                          const bool setWrap,
-                                         std::optional<size_t> limitRight)
+                                         std::optional<size_t> limitRight,
+                                         const bool notifyPaint)
 {
+    // Charge heap traffic below here to the buffer in accounting builds.
+    const AllocScope allocScope(AllocAccounting::Tag::Buffer);
+
     // If we're not in bounds, exit early.
     if (!GetSize().IsInBounds(target))
     {
@@ -365,9 +387,12 @@ OutputCellIterator TextBuffer::WriteLine(const OutputCellIterator givenIt,
     const auto newIt = row.WriteCells(givenIt, target.X, setWrap, limitRight);
 
     // Take the cell distance written and notify that it needs to be repainted.
-    const auto written = newIt.GetCellDistance(givenIt);
-    const Viewport paint = Viewport::FromDimensions(target, { gsl::narrow<SHORT>(written), 1 });
-    _NotifyPaint(paint);
+    if (notifyPaint)
+    {
+        const auto written = newIt.GetCellDistance(givenIt);
+        const Viewport paint = Viewport::FromDimensions(target, { gsl::narrow<SHORT>(written), 1 });
+        _NotifyPaint(paint);
+    }
 
     return newIt;
 }
@@ -404,7 +429,7 @@ bool TextBuffer::InsertCharacter(const std::wstring_view chars,
         try
         {
             charRow.GlyphAt(iCol) = chars;
-            charRow.DbcsAttrAt(iCol) = dbcsAttribute;
+            charRow.SetDbcsAttr(iCol, dbcsAttribute);
         }
         catch (...)
         {
@@ -533,12 +558,34 @@ bool TextBuffer::NewlineCursor()
 // - <none>
 //Return Value:
 // - true if we successfully incremented the buffer.
+// Routine Description:
+// - Sets the callback invoked on each row evicted by IncrementCircularBuffer.
+// Arguments:
+// - pfn - the callback. Must not throw; pass nullptr to remove it.
+void TextBuffer::SetRowEvictionCallback(std::function<void(const ROW&)> pfn)
+{
+    _pfnRowEvicted = std::move(pfn);
+}
+
 bool TextBuffer::IncrementCircularBuffer()
 {
     // FirstRow is at any given point in time the array index in the circular buffer that corresponds
     // to the logical position 0 in the window (cursor coordinates and all other coordinates).
     _renderTarget.TriggerCircling();
 
+    // Offer the row we're about to recycle to anyone retaining deeper history
+    // than the circular buffer itself. The row is usually sitting in the
+    // compressed cold tier by now (CompressScrollback packs rows long before
+    // they fall off the end), and a compressed CharRow reads back empty, so
+    // rehydrate it first; it's about to be reset anyway, so the work isn't
+    // wasted on a row anyone else would have kept cold.
+    if (_pfnRowEvicted)
+    {
+        ROW& evictedRow = _storage.at(_firstRow);
+        _MaterializeRow(evictedRow);
+        _pfnRowEvicted(evictedRow);
+    }
+
     // First, clean out the old "first row" as it will become the "last row" of the buffer after the circle is performed.
     bool fSuccess = _storage.at(_firstRow).Reset(_currentAttributes);
     if (fSuccess)
@@ -552,10 +599,64 @@ bool TextBuffer::IncrementCircularBuffer()
         {
             _firstRow = 0;
         }
+
+        // Everything slid up one logical row, so the cold/hot boundary did too.
+        _coldBoundary = std::max<SHORT>(0, _coldBoundary - 1);
     }
     return fSuccess;
 }
 
+// Routine Description:
+// - Packs rows that have scrolled out of the active region into the compact
+//   cold-scrollback form. Rows at offsets [0, firstActiveRow) are eligible;
+//   GetRowByOffset rehydrates them automatically the next time anything
+//   (viewport, search, selection) visits them.
+// - Only the span the boundary advanced over since the last call is walked,
+//   so this is cheap to call every time the active region moves.
+// Arguments:
+// - firstActiveRow - Offset of the first row still in the active region.
+// Return Value:
+// - <none>
+void TextBuffer::CompressScrollback(const SHORT firstActiveRow)
+{
+    const auto limit = std::clamp<SHORT>(firstActiveRow, 0, gsl::narrow<SHORT>(TotalRowCount()));
+    for (auto offset = _coldBoundary; offset < limit; ++offset)
+    {
+        const size_t offsetIndex = (_firstRow + offset) % TotalRowCount();
+        _storage[offsetIndex].Compress();
+    }
+    _coldBoundary = limit;
+}
+
+// Routine Description:
+// - Produces a deep copy of a band of rows so a consumer (the renderer) can
+//   read buffer contents after the console lock has been released. The copy
+//   shares nothing with this buffer; writes here never disturb the snapshot.
+// - The snapshot is a TextBuffer itself, so all the usual iterators work on it.
+// Arguments:
+// - firstRow - Offset of the first row to copy.
+// - rowCount - How many rows to copy.
+// Return Value:
+// - a buffer holding copies of the requested rows, rowCount tall.
+std::unique_ptr<TextBuffer> TextBuffer::MakeSnapshot(const size_t firstRow, const size_t rowCount) const
+{
+    const COORD snapshotSize{ GetSize().Dimensions().X, gsl::narrow<SHORT>(rowCount) };
+    auto snapshot = std::make_unique<TextBuffer>(snapshotSize,
+                                                 _currentAttributes,
+                                                 _cursor.GetSize(),
+                                                 _renderTarget);
+
+    for (size_t i = 0; i < rowCount; ++i)
+    {
+        const ROW& source = GetRowByOffset(firstRow + i);
+        ROW& dest = snapshot->GetRowByOffset(i);
+        dest.GetCharRow().CopyFrom(source.GetCharRow());
+        dest.GetAttrRow() = source.GetAttrRow();
+    }
+
+    return snapshot;
+}
+
 //Routine Description:
 // - Retrieves the position of the last non-space character on the final line of the text buffer.
 //Arguments:
@@ -629,7 +730,7 @@ const SHORT TextBuffer::GetFirstRowIndex() const
 }
 const Viewport TextBuffer::GetSize() const
 {
-    return Viewport::FromDimensions({ 0, 0 }, { gsl::narrow<SHORT>(_storage.at(0).size()), gsl::narrow<SHORT>(_storage.size()) });
+    return Viewport::FromDimensions({ 0, 0 }, { _rowWidth, gsl::narrow<SHORT>(_storage.size()) });
 }
 
 void TextBuffer::_SetFirstRowIndex(const SHORT FirstRowIndex)
@@ -647,14 +748,38 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
 
     // OK. We're about to play games by moving rows around within the deque to
     // scroll a massive region in a faster way than copying things.
-    // To make this easier, first correct the circular buffer to have the first row be 0 again.
-    if (_firstRow != 0)
+
+    // The full span of logical rows this move touches: the band being moved
+    // plus the rows it vacates or lands on.
+    const SHORT spanFirst = std::min<SHORT>(firstRow, firstRow + delta);
+    const SHORT spanEnd = std::max<SHORT>(firstRow + size, firstRow + size + delta); // exclusive
+    const SHORT totalRows = gsl::narrow<SHORT>(TotalRowCount());
+
+    // If that span occupies one contiguous run of backing storage (it doesn't
+    // straddle the circular seam at _firstRow), we can rotate just that run
+    // and renumber just those rows afterwards. Otherwise, straighten the
+    // circular buffer out first so logical and physical indices coincide.
+    // Straightening walks the entire storage - scrollback included - so we
+    // only pay for it when the seam actually cuts through the span.
+    const SHORT physFirst = (_firstRow + spanFirst) % totalRows;
+    const bool bandOnly = physFirst + (spanEnd - spanFirst) <= totalRows;
+    ptrdiff_t base;
+    if (bandOnly)
+    {
+        // Physical index of any logical row r within the span is base + r.
+        base = static_cast<ptrdiff_t>(physFirst) - spanFirst;
+    }
+    else
     {
-        // Rotate the buffer to put the first row at the front.
-        std::rotate(_storage.begin(), _storage.begin() + _firstRow, _storage.end());
+        if (_firstRow != 0)
+        {
+            // Rotate the buffer to put the first row at the front.
+            std::rotate(_storage.begin(), _storage.begin() + _firstRow, _storage.end());
 
-        // The first row is now at the top.
-        _firstRow = 0;
+            // The first row is now at the top.
+            _firstRow = 0;
+        }
+        base = 0;
     }
 
     // Rotate just the subsection specified
@@ -693,7 +818,7 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // | 10
         // | 11
         // - end
-        std::rotate(_storage.begin() + firstRow + delta, _storage.begin() + firstRow, _storage.begin() + firstRow + size);
+        std::rotate(_storage.begin() + base + firstRow + delta, _storage.begin() + base + firstRow, _storage.begin() + base + firstRow + size);
     }
     else
     {
@@ -730,12 +855,24 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         // | 10
         // | 11
         // - end
-        std::rotate(_storage.begin() + firstRow, _storage.begin() + firstRow + size, _storage.begin() + firstRow + size + delta);
+        std::rotate(_storage.begin() + base + firstRow, _storage.begin() + base + firstRow + size, _storage.begin() + base + firstRow + size + delta);
     }
 
     // Renumber the IDs now that we've rearranged where the rows sit within the buffer.
-    // Refreshing should also delegate to the UnicodeStorage to re-key all the stored unicode sequences (where applicable).
-    _RefreshRowIDs(std::nullopt);
+    if (bandOnly)
+    {
+        // Only the rows within the span moved; everything else kept its slot.
+        for (SHORT i = spanFirst; i < spanEnd; i++)
+        {
+            auto& row = _storage.at(base + i);
+            row.SetId(gsl::narrow_cast<SHORT>(base + i));
+            row.GetCharRow().UpdateParent(&row);
+        }
+    }
+    else
+    {
+        _RefreshRowIDs();
+    }
 }
 
 Cursor& TextBuffer::GetCursor()
@@ -770,6 +907,8 @@ void TextBuffer::Reset()
         row.GetCharRow().Reset();
         row.GetAttrRow().Reset(attr);
     }
+
+    _coldBoundary = 0;
 }
 
 // Routine Description:
@@ -783,6 +922,13 @@ void TextBuffer::Reset()
     RETURN_HR_IF(E_INVALIDARG, newSize.X < 0 || newSize.Y < 0);
 
     const auto currentSize = GetSize().Dimensions();
+
+    // Resizing to the shape we already have is a no-op; don't touch the rows.
+    if (newSize.X == currentSize.X && newSize.Y == currentSize.Y)
+    {
+        return S_OK;
+    }
+
     const auto attributes = GetCurrentAttributes();
 
     SHORT TopRow = 0; // new top row of the screen buffer
@@ -795,6 +941,12 @@ void TextBuffer::Reset()
     // rotate rows until the top row is at index 0
     try
     {
+        // If the top row is already in front, the buffer is in physical order
+        // and every row ID already matches its index, so both the rotation and
+        // the ID refresh below can be skipped. This is the common case when a
+        // deep-scrollback buffer that hasn't wrapped yet is drag-resized.
+        const bool fRotated = TopRowIndex != 0;
+
         const ROW& newTopRow = _storage[TopRowIndex];
         while (&newTopRow != &_storage.front())
         {
@@ -810,30 +962,39 @@ void TextBuffer::Reset()
         {
             _storage.pop_back();
         }
-        // add rows if we're growing
+        // add rows if we're growing. they materialize on first visit.
+        // (their IDs are correct on construction, so growth alone doesn't
+        // force an ID refresh either.)
         while (_storage.size() < static_cast<size_t>(newSize.Y))
         {
-            _storage.emplace_back(static_cast<short>(_storage.size()), newSize.X, attributes, this);
+            _storage.emplace_back(static_cast<short>(_storage.size()), newSize.X, attributes, this, true);
         }
 
         // Now that we've tampered with the row placement, refresh all the row IDs.
-        // Also take advantage of the row ID refresh loop to resize the rows in the X dimension
-        // and cleanup the UnicodeStorage characters that might fall outside the resized buffer.
-        _RefreshRowIDs(newSize.X);
+        if (fRotated)
+        {
+            _RefreshRowIDs();
+        }
+
+        // Publish the new width; each row reflows to it lazily the next time
+        // it's visited. Packed scrollback rows adjust their width in place
+        // without rehydrating, so dragging a window edge over a deep buffer
+        // only pays for the rows that are actually looked at.
+        _rowWidth = newSize.X;
     }
     CATCH_RETURN();
 
     return S_OK;
 }
 
-const UnicodeStorage& TextBuffer::GetUnicodeStorage() const
-{
-    return _unicodeStorage;
-}
-
-UnicodeStorage& TextBuffer::GetUnicodeStorage()
+// Routine Description:
+// - Retrieves the arena that rows belonging to this buffer allocate their
+//   character and DBCS attribute storage from.
+// Return Value:
+// - pointer to the pooled memory resource. Never nullptr.
+std::pmr::memory_resource* TextBuffer::GetRowStorageArena() noexcept
 {
-    return _unicodeStorage;
+    return &_rowStorageArena;
 }
 
 // Routine Description:
@@ -841,35 +1002,35 @@ UnicodeStorage& TextBuffer::GetUnicodeStorage()
 //   by shuffling pointers around.
 // - This will also update parent pointers that are stored in depth within the buffer
 //   (e.g. it will update CharRow parents pointing at Rows that might have been moved around)
-// - Optionally takes a new row width if we're resizing to perform a resize operation and cleanup
-//   any high unicode (UnicodeStorage) runs while we're already looping through the rows.
 // Arguments:
-// - newRowWidth - Optional new value for the row width.
-void TextBuffer::_RefreshRowIDs(std::optional<SHORT> newRowWidth)
+// - <none>
+void TextBuffer::_RefreshRowIDs()
 {
-    std::map<SHORT, SHORT> rowMap;
     SHORT i = 0;
     for (auto& it : _storage)
     {
-        // Build a map so we can update Unicode Storage
-        rowMap.emplace(it.GetId(), i);
-
         // Update the IDs
         it.SetId(i++);
 
         // Also update the char row parent pointers as they can get shuffled up in the rotates.
         it.GetCharRow().UpdateParent(&it);
+    }
+}
 
-        // Resize the rows in the X dimension if we have a new width
-        if (newRowWidth.has_value())
-        {
-            // Realloc in the X direction
-            THROW_IF_FAILED(it.Resize(newRowWidth.value()));
-        }
+// Routine Description:
+// - Brings a row into the shape callers expect: reflowed to the buffer's
+//   current width and rehydrated from the cold scrollback tier. Both steps
+//   are no-ops for a row that's already hot and current.
+// Arguments:
+// - row - the row to reshape and rehydrate.
+void TextBuffer::_MaterializeRow(ROW& row) const
+{
+    if (row.size() != gsl::narrow_cast<size_t>(_rowWidth))
+    {
+        THROW_IF_FAILED(row.Resize(_rowWidth));
     }
 
-    // Give the new mapping to Unicode Storage
-    _unicodeStorage.Remap(rowMap, newRowWidth);
+    row.Decompress();
 }
 
 void TextBuffer::_NotifyPaint(const Viewport& viewport) const
@@ -906,7 +1067,10 @@ ROW& TextBuffer::_GetPrevRowNoWrap(const ROW& Row)
     }
 
     THROW_HR_IF(E_FAIL, Row.GetId() == _firstRow);
-    return _storage[prevRowIndex];
+
+    ROW& prevRow = _storage[prevRowIndex];
+    _MaterializeRow(prevRow);
+    return prevRow;
 }
 
 // Method Description:
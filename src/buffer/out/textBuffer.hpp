@@ -49,10 +49,11 @@ filling in the last row, and updating the screen.
 
 #pragma once
 
+#include <memory_resource>
+
 #include "cursor.h"
 #include "Row.hpp"
 #include "TextAttribute.hpp"
-#include "UnicodeStorage.hpp"
 #include "../types/inc/Viewport.hpp"
 
 #include "../buffer/out/textBufferCellIterator.hpp"
@@ -94,7 +95,8 @@ public:
     OutputCellIterator WriteLine(const OutputCellIterator givenIt,
                                  const COORD target,
                                  const bool setWrap = false,
-                                 const std::optional<size_t> limitRight = std::nullopt);
+                                 const std::optional<size_t> limitRight = std::nullopt,
+                                 const bool notifyPaint = true);
 
     bool InsertCharacter(const wchar_t wch, const DbcsAttribute dbcsAttribute, const TextAttribute attr);
     bool InsertCharacter(const std::wstring_view chars, const DbcsAttribute dbcsAttribute, const TextAttribute attr);
@@ -104,6 +106,12 @@ public:
     // Scroll needs access to this to quickly rotate around the buffer.
     bool IncrementCircularBuffer();
 
+    void SetRowEvictionCallback(std::function<void(const ROW&)> pfn);
+
+    void CompressScrollback(const SHORT firstActiveRow);
+
+    std::unique_ptr<TextBuffer> MakeSnapshot(const size_t firstRow, const size_t rowCount) const;
+
     COORD GetLastNonSpaceCharacter() const;
 
     Cursor& GetCursor();
@@ -125,8 +133,7 @@ public:
 
     [[nodiscard]] HRESULT ResizeTraditional(const COORD newSize) noexcept;
 
-    const UnicodeStorage& GetUnicodeStorage() const;
-    UnicodeStorage& GetUnicodeStorage();
+    std::pmr::memory_resource* GetRowStorageArena() noexcept;
 
     Microsoft::Console::Render::IRenderTarget& GetRenderTarget();
 
@@ -145,17 +152,37 @@ public:
                                            std::function<COLORREF(TextAttribute&)> GetBackgroundColor) const;
 
 private:
+    // Arena that backs the per-row character storage. Rows allocate their
+    // glyph and DBCS attribute vectors from here in pooled slabs so that
+    // buffer construction, ResizeTraditional, and IncrementCircularBuffer
+    // don't hit the global heap once per row.
+    // NOTE: declared before _storage so it outlives the rows on destruction.
+    std::pmr::unsynchronized_pool_resource _rowStorageArena;
     std::deque<ROW> _storage;
     Cursor _cursor;
 
     SHORT _firstRow; // indexes top row (not necessarily 0)
 
+    // Offset of the first hot row; rows above this have been handed to the
+    // cold scrollback tier by CompressScrollback. Rows rehydrated on demand
+    // by GetRowByOffset stay hot until the boundary sweeps over them again.
+    SHORT _coldBoundary;
+
+    // The authoritative width of the buffer. Individual rows reflow to this
+    // lazily when they're next materialized, so a resize doesn't have to walk
+    // the whole scrollback synchronously.
+    SHORT _rowWidth;
+
     TextAttribute _currentAttributes;
 
-    // storage location for glyphs that can't fit into the buffer normally
-    UnicodeStorage _unicodeStorage;
+    // Invoked on the row about to be recycled by IncrementCircularBuffer,
+    // before its contents are reset, so an owner keeping deeper history than
+    // the circular buffer can serialize it (see Terminal's paged scrollback).
+    std::function<void(const ROW&)> _pfnRowEvicted;
+
+    void _RefreshRowIDs();
 
-    void _RefreshRowIDs(std::optional<SHORT> newRowWidth);
+    void _MaterializeRow(ROW& row) const;
 
     Microsoft::Console::Render::IRenderTarget& _renderTarget;
 
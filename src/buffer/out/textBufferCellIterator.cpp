@@ -265,3 +265,50 @@ const OutputCellView* TextBufferCellIterator::operator->() const noexcept
 {
     return &_view;
 }
+
+// Routine Description:
+// - Provides a view over the longest contiguous stretch of simple cells starting at the
+//   current position, bounded by the current row, the viewport limits, and the text
+//   attribute run the position sits in. A simple cell holds exactly one narrow UTF-16
+//   code unit inline in the row, so the returned view aliases the row storage directly
+//   and consumers can process the whole run without advancing cell by cell.
+// Return Value:
+// - Span of cell text plus the attribute that applies across all of it, or nullopt if
+//   the iterator is exhausted or the current cell is not simple (wide glyph or overflow
+//   glyph). Callers should fall back to per-cell iteration in that case.
+std::optional<TextBufferCellIterator::CellSpan> TextBufferCellIterator::TryGetSpan() const
+{
+    if (_exceeded || !_bounds.IsInBounds(_pos))
+    {
+        return std::nullopt;
+    }
+
+    const auto& charRow = _pRow->GetCharRow();
+    const auto& startAttr = charRow.DbcsAttrAt(_pos.X);
+    if (!startAttr.IsSingle() || startAttr.IsGlyphStored())
+    {
+        return std::nullopt;
+    }
+
+    // Find out how far the attribute run covering this position continues to apply.
+    size_t applies = 0;
+    const auto attr = _pRow->GetAttrRow().GetAttrByColumn(_pos.X, &applies);
+
+    // Clamp the run to the right edge of our bounds.
+    const auto cellsToRight = gsl::narrow_cast<size_t>(_bounds.RightInclusive() - _pos.X + 1);
+    const size_t maxCells = std::min(applies, cellsToRight);
+
+    // Extend across cells for as long as they stay simple.
+    size_t cells = 1;
+    while (cells < maxCells)
+    {
+        const auto& dbcsAttr = charRow.DbcsAttrAt(_pos.X + cells);
+        if (!dbcsAttr.IsSingle() || dbcsAttr.IsGlyphStored())
+        {
+            break;
+        }
+        ++cells;
+    }
+
+    return CellSpan{ charRow.Chars().substr(_pos.X, cells), attr };
+}
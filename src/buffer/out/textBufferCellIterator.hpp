@@ -49,6 +49,17 @@ public:
     const OutputCellView& operator*() const noexcept;
     const OutputCellView* operator->() const noexcept;
 
+    // A contiguous stretch of cells that share one text attribute where every
+    // cell holds exactly one narrow UTF-16 code unit inline in the row. The
+    // text view aliases the row storage directly, one code unit per cell.
+    struct CellSpan
+    {
+        std::wstring_view text;
+        TextAttribute attr;
+    };
+
+    std::optional<CellSpan> TryGetSpan() const;
+
 protected:
     void _SetPos(const COORD newPos);
     void _GenerateView();
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "App.h"
+#include <chrono>
 #include <winrt/Microsoft.UI.Xaml.XamlTypeInfo.h>
 
 #include "App.g.cpp"
@@ -31,6 +32,31 @@ namespace winrt
     using IInspectable = Windows::Foundation::IInspectable;
 }
 
+namespace
+{
+    // Wall-clock durations of the startup phases, recorded as they complete
+    // and published as one telemetry event once the first frame is up. They
+    // can't be emitted individually as they happen because settings load runs
+    // before the TraceLogging provider is registered.
+    struct StartupTimeline
+    {
+        std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+        double settingsLoadMs = 0;
+        double uiCreateMs = 0;
+        double firstTabMs = 0;
+        double firstFrameMs = 0;
+        bool reported = false;
+    };
+
+    StartupTimeline g_startupTimeline;
+
+    double _MillisecondsSince(const std::chrono::steady_clock::time_point start) noexcept
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::milli>(elapsed).count();
+    }
+}
+
 namespace winrt::TerminalApp::implementation
 {
     App::App() :
@@ -84,6 +110,8 @@ namespace winrt::TerminalApp::implementation
     //      and adds it to our list of tabs.
     void App::_Create()
     {
+        const auto uiCreateStart = std::chrono::steady_clock::now();
+
         _tabView = MUX::Controls::TabView{};
 
         _tabView.SelectionChanged({ this, &App::_OnTabSelectionChanged });
@@ -138,8 +166,9 @@ namespace winrt::TerminalApp::implementation
             this->_OpenNewTab(std::nullopt);
         });
 
-        // Populate the new tab button's flyout with entries for each profile
-        _CreateNewTabFlyout();
+        // The new tab button's flyout is populated after the first frame is
+        // rendered (see _OnLoaded) - it walks every profile to build menu
+        // items nobody can interact with until the window is up.
 
         _tabRow.Children().Append(_tabView);
         _tabRow.Children().Append(_newTabButton);
@@ -168,7 +197,11 @@ namespace winrt::TerminalApp::implementation
         // Apply the UI theme from our settings to our UI elements
         _ApplyTheme(_settings->GlobalSettings().GetRequestedTheme());
 
+        g_startupTimeline.uiCreateMs = _MillisecondsSince(uiCreateStart);
+
+        const auto firstTabStart = std::chrono::steady_clock::now();
         _OpenNewTab(std::nullopt);
+        g_startupTimeline.firstTabMs = _MillisecondsSince(firstTabStart);
 
         _root.Loaded({ this, &App::_OnLoaded });
     }
@@ -271,6 +304,32 @@ namespace winrt::TerminalApp::implementation
     void App::_OnLoaded(const IInspectable& /*sender*/,
                         const RoutedEventArgs& /*eventArgs*/)
     {
+        if (!g_startupTimeline.reported)
+        {
+            g_startupTimeline.reported = true;
+            g_startupTimeline.firstFrameMs = _MillisecondsSince(g_startupTimeline.origin);
+
+            // The Loaded event on our root element is the closest we can get
+            // to "the user can see a prompt" from inside the app, so that's
+            // the number we track release over release.
+            TraceLoggingWrite(
+                g_hTerminalAppProvider,
+                "StartupTimeline",
+                TraceLoggingDescription("Durations of the startup phases, through the first rendered frame"),
+                TraceLoggingFloat64(g_startupTimeline.settingsLoadMs, "SettingsLoadInMs", "Time spent loading and parsing the settings file"),
+                TraceLoggingFloat64(g_startupTimeline.uiCreateMs, "UICreateInMs", "Time spent building the initial XAML tree"),
+                TraceLoggingFloat64(g_startupTimeline.firstTabMs, "FirstTabInMs", "Time spent creating the first tab and its connection"),
+                TraceLoggingFloat64(g_startupTimeline.firstFrameMs, "FirstFrameInMs", "Total time from process start to the first frame"),
+                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
+            // Now that the first frame is up, run the deferred non-critical
+            // setup once the dispatcher goes idle.
+            _root.Dispatcher().RunAsync(CoreDispatcherPriority::Low, [this]() {
+                _CreateNewTabFlyout();
+            });
+        }
+
         if (FAILED(_settingsLoadedResult))
         {
             const winrt::hstring titleKey = L"InitialJsonParseErrorTitle";
@@ -494,6 +553,7 @@ namespace winrt::TerminalApp::implementation
         bindings.ScrollDownPage([this]() { _ScrollPage(1); });
         bindings.SwitchToTab([this](const auto index) { _SelectTab({ index }); });
         bindings.OpenSettings([this]() { _OpenSettings(); });
+        bindings.ToggleDebugHud([this]() { _ToggleDebugHud(); });
     }
 
     // Method Description:
@@ -536,6 +596,8 @@ namespace winrt::TerminalApp::implementation
     //      happening during startup, it'll need to happen on a background thread.
     void App::LoadSettings()
     {
+        const auto settingsLoadStart = std::chrono::steady_clock::now();
+
         // Attempt to load the settings.
         // If it fails,
         //  - use Default settings,
@@ -556,6 +618,8 @@ namespace winrt::TerminalApp::implementation
 
         _loadedInitialSettings = true;
 
+        g_startupTimeline.settingsLoadMs = _MillisecondsSince(settingsLoadStart);
+
         // Register for directory change notification.
         _RegisterSettingsChange();
     }
@@ -883,8 +947,8 @@ namespace winrt::TerminalApp::implementation
     // - settings: the TerminalSettings object to use to create the TerminalControl with.
     void App::_CreateNewTabFromSettings(GUID profileGuid, TerminalSettings settings)
     {
-        // Initialize the new tab
-        TermControl term{ settings };
+        // Initialize the new tab, reusing a recycled control if one is parked.
+        TermControl term = TermControl::GetRecycledOrCreate(settings);
 
         // Add the new tab to the list of our tabs.
         auto newTab = _tabs.emplace_back(std::make_shared<Tab>(profileGuid, term));
@@ -918,6 +982,15 @@ namespace winrt::TerminalApp::implementation
         // This kicks off TabView::SelectionChanged, in response to which we'll attach the terminal's
         // Xaml control to the Xaml root.
         _tabView.SelectedItem(tabViewItem);
+
+        // Refill the warm conhost pool once this tab is up, so the next tab
+        // of the same profile only pays for attaching - conhost spawn and
+        // initialization are the bulk of tab-open time. Low priority keeps it
+        // out of the way of presenting the tab we just made.
+        _tabView.Dispatcher().RunAsync(CoreDispatcherPriority::Low,
+                                       [cmdline = settings.Commandline(), directory = settings.StartingDirectory()]() {
+                                           TerminalConnection::ConhostConnection::PrewarmConhost(cmdline, directory, 30, 80);
+                                       });
     }
 
     // Method Description:
@@ -991,6 +1064,16 @@ namespace winrt::TerminalApp::implementation
         control.CopySelectionToClipboard(trimTrailingWhitespace);
     }
 
+    // Method Description:
+    // - Toggles the performance HUD overlay on the focused terminal control.
+    void App::_ToggleDebugHud()
+    {
+        if (auto control{ _GetFocusedControl() })
+        {
+            control.ToggleDebugHud();
+        }
+    }
+
     // Method Description:
     // - Sets focus to the tab to the right or left the currently selected tab.
     void App::_SelectNextTab(const bool bMoveRight)
@@ -1232,7 +1315,7 @@ namespace winrt::TerminalApp::implementation
         const auto realGuid = profileGuid ? profileGuid.value() :
                                             _settings->GlobalSettings().GetDefaultProfile();
         const auto controlSettings = _settings->MakeSettings(realGuid);
-        TermControl newControl{ controlSettings };
+        TermControl newControl = TermControl::GetRecycledOrCreate(controlSettings);
 
         const int focusedTabIndex = _GetFocusedTabIndex();
         auto focusedTab = _tabs[focusedTabIndex];
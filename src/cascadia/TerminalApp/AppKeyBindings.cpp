@@ -13,19 +13,83 @@ using namespace winrt::Windows::Data::Json;
 
 namespace winrt::TerminalApp::implementation
 {
+    // Method Description:
+    // - Packs a chord's modifiers and virtual key into a single int32_t so it
+    //   can key a flat integer-hashed map. The modifiers occupy the high half
+    //   and the vkey the low half, so distinct chords always pack distinctly.
+    // Arguments:
+    // - chord: the key chord to pack.
+    // Return Value:
+    // - the packed (modifiers, vkey) value.
+    int32_t AppKeyBindings::_PackKeyChord(Settings::KeyChord const& chord)
+    {
+        return (static_cast<int32_t>(chord.Modifiers()) << 16) | (chord.Vkey() & 0xFFFF);
+    }
+
     void AppKeyBindings::SetKeyBinding(const TerminalApp::ShortcutAction& action,
                                        const Settings::KeyChord& chord)
     {
-        _keyShortcuts[chord] = action;
+        // Fold in any pending bindings first, so an explicit binding set after
+        // deserialization wins over a queued one for the same chord.
+        _MaterializePendingKeyBindings();
+        _keyShortcuts[_PackKeyChord(chord)] = action;
+    }
+
+    // Method Description:
+    // - Queues a binding whose chord hasn't been parsed from its string form
+    //   yet. Deserialization uses this instead of SetKeyBinding so settings
+    //   load doesn't pay for tokenizing every chord up front - the strings
+    //   are parsed in _MaterializePendingKeyBindings on first lookup instead.
+    // Arguments:
+    // - action: the ShortcutAction to bind.
+    // - chordText: the serialized chord, e.g. "ctrl+shift+t".
+    void AppKeyBindings::AddPendingKeyBinding(TerminalApp::ShortcutAction const& action,
+                                              winrt::hstring const& chordText)
+    {
+        _pendingKeyBindings.emplace_back(action, chordText);
+    }
+
+    // Method Description:
+    // - Parses any bindings queued by AddPendingKeyBinding into _keyShortcuts.
+    //   Bindings whose chord strings fail to parse are dropped, the same as
+    //   they were when deserialization parsed them eagerly. No-ops (one empty
+    //   check) once the queue has been drained.
+    void AppKeyBindings::_MaterializePendingKeyBindings()
+    {
+        if (_pendingKeyBindings.empty())
+        {
+            return;
+        }
+
+        // Swap the queue out first - SetKeyBinding calls back into us, and
+        // parsing must not re-enter the loop.
+        std::vector<std::pair<TerminalApp::ShortcutAction, winrt::hstring>> pending;
+        pending.swap(_pendingKeyBindings);
+
+        for (const auto& [action, chordText] : pending)
+        {
+            try
+            {
+                const auto chord = KeyChordSerialization::FromString(chordText);
+                _keyShortcuts[_PackKeyChord(chord)] = action;
+            }
+            catch (...)
+            {
+                continue;
+            }
+        }
     }
 
     Microsoft::Terminal::Settings::KeyChord AppKeyBindings::GetKeyBinding(TerminalApp::ShortcutAction const& action)
     {
+        _MaterializePendingKeyBindings();
         for (auto& kv : _keyShortcuts)
         {
             if (kv.second == action)
             {
-                return kv.first;
+                const auto packed = kv.first;
+                return { static_cast<Settings::KeyModifiers>(packed >> 16),
+                         packed & 0xFFFF };
             }
         }
         return { nullptr };
@@ -33,7 +97,8 @@ namespace winrt::TerminalApp::implementation
 
     bool AppKeyBindings::TryKeyChord(const Settings::KeyChord& kc)
     {
-        const auto keyIter = _keyShortcuts.find(kc);
+        _MaterializePendingKeyBindings();
+        const auto keyIter = _keyShortcuts.find(_PackKeyChord(kc));
         if (keyIter != _keyShortcuts.end())
         {
             const auto action = keyIter->second;
@@ -58,6 +123,9 @@ namespace winrt::TerminalApp::implementation
         case ShortcutAction::OpenSettings:
             _OpenSettingsHandlers();
             return true;
+        case ShortcutAction::ToggleDebugHud:
+            _ToggleDebugHudHandlers();
+            return true;
 
         case ShortcutAction::NewTabProfile0:
             _NewTabWithProfileHandlers(0);
@@ -222,7 +290,7 @@ namespace winrt::TerminalApp::implementation
     DEFINE_EVENT(AppKeyBindings, SwitchToTab,       _SwitchToTabHandlers,       TerminalApp::SwitchToTabEventArgs);
     DEFINE_EVENT(AppKeyBindings, NextTab,           _NextTabHandlers,           TerminalApp::NextTabEventArgs);
     DEFINE_EVENT(AppKeyBindings, PrevTab,           _PrevTabHandlers,           TerminalApp::PrevTabEventArgs);
-    DEFINE_EVENT(AppKeyBindings, SplitVertical,     _SplitVerticalHandlers,     TerminalApp::SplitVerticalEventArgs);
+    DEFINE_EVENT(AppKeyBindings, SplitVertical,     _SplitVerticalHandlers,     TerminalApp::SplitVerticalEventArgs);
     DEFINE_EVENT(AppKeyBindings, SplitHorizontal,   _SplitHorizontalHandlers,   TerminalApp::SplitHorizontalEventArgs);
     DEFINE_EVENT(AppKeyBindings, IncreaseFontSize,  _IncreaseFontSizeHandlers,  TerminalApp::IncreaseFontSizeEventArgs);
     DEFINE_EVENT(AppKeyBindings, DecreaseFontSize,  _DecreaseFontSizeHandlers,  TerminalApp::DecreaseFontSizeEventArgs);
@@ -231,5 +299,6 @@ namespace winrt::TerminalApp::implementation
     DEFINE_EVENT(AppKeyBindings, ScrollUpPage,      _ScrollUpPageHandlers,      TerminalApp::ScrollUpPageEventArgs);
     DEFINE_EVENT(AppKeyBindings, ScrollDownPage,    _ScrollDownPageHandlers,    TerminalApp::ScrollDownPageEventArgs);
     DEFINE_EVENT(AppKeyBindings, OpenSettings,      _OpenSettingsHandlers,      TerminalApp::OpenSettingsEventArgs);
+    DEFINE_EVENT(AppKeyBindings, ToggleDebugHud,    _ToggleDebugHudHandlers,    TerminalApp::ToggleDebugHudEventArgs);
     // clang-format on
 }
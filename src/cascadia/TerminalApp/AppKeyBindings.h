@@ -8,26 +8,6 @@
 
 namespace winrt::TerminalApp::implementation
 {
-    struct KeyChordHash
-    {
-        std::size_t operator()(const winrt::Microsoft::Terminal::Settings::KeyChord& key) const
-        {
-            std::hash<int32_t> keyHash;
-            std::hash<winrt::Microsoft::Terminal::Settings::KeyModifiers> modifiersHash;
-            std::size_t hashedKey = keyHash(key.Vkey());
-            std::size_t hashedMods = modifiersHash(key.Modifiers());
-            return hashedKey ^ hashedMods;
-        }
-    };
-
-    struct KeyChordEquality
-    {
-        bool operator()(const winrt::Microsoft::Terminal::Settings::KeyChord& lhs, const winrt::Microsoft::Terminal::Settings::KeyChord& rhs) const
-        {
-            return lhs.Modifiers() == rhs.Modifiers() && lhs.Vkey() == rhs.Vkey();
-        }
-    };
-
     struct AppKeyBindings : AppKeyBindingsT<AppKeyBindings>
     {
         AppKeyBindings() = default;
@@ -36,6 +16,11 @@ namespace winrt::TerminalApp::implementation
         void SetKeyBinding(TerminalApp::ShortcutAction const& action, winrt::Microsoft::Terminal::Settings::KeyChord const& chord);
         Microsoft::Terminal::Settings::KeyChord GetKeyBinding(TerminalApp::ShortcutAction const& action);
 
+        // Not projected - only reachable through winrt::get_self within
+        // TerminalApp. Queues a binding whose chord is still a string, so
+        // deserialization doesn't have to tokenize it on the startup path.
+        void AddPendingKeyBinding(TerminalApp::ShortcutAction const& action, winrt::hstring const& chordText);
+
         static Windows::System::VirtualKeyModifiers ConvertVKModifiers(winrt::Microsoft::Terminal::Settings::KeyModifiers modifiers);
         static winrt::hstring FormatOverrideShortcutText(winrt::Microsoft::Terminal::Settings::KeyModifiers modifiers);
 
@@ -59,10 +44,24 @@ namespace winrt::TerminalApp::implementation
         DECLARE_EVENT(ScrollUpPage,      _ScrollUpPageHandlers,      TerminalApp::ScrollUpPageEventArgs);
         DECLARE_EVENT(ScrollDownPage,    _ScrollDownPageHandlers,    TerminalApp::ScrollDownPageEventArgs);
         DECLARE_EVENT(OpenSettings,      _OpenSettingsHandlers,      TerminalApp::OpenSettingsEventArgs);
+        DECLARE_EVENT(ToggleDebugHud,    _ToggleDebugHudHandlers,    TerminalApp::ToggleDebugHudEventArgs);
         // clang-format on
 
     private:
-        std::unordered_map<winrt::Microsoft::Terminal::Settings::KeyChord, TerminalApp::ShortcutAction, KeyChordHash, KeyChordEquality> _keyShortcuts;
+        // Bindings are keyed by the chord's (modifiers, vkey) pair packed into
+        // a single int32_t. Hashing and comparing a plain integer keeps the
+        // per-keystroke lookup from round-tripping through the KeyChord
+        // projection's property getters on every probe.
+        std::unordered_map<int32_t, TerminalApp::ShortcutAction> _keyShortcuts;
+
+        // Bindings deserialized from json whose chord strings haven't been
+        // parsed yet. They're folded into _keyShortcuts the first time anyone
+        // looks a binding up, so the per-keystroke path still hits the flat
+        // map above.
+        std::vector<std::pair<TerminalApp::ShortcutAction, winrt::hstring>> _pendingKeyBindings;
+        void _MaterializePendingKeyBindings();
+
+        static int32_t _PackKeyChord(winrt::Microsoft::Terminal::Settings::KeyChord const& chord);
         bool _DoAction(ShortcutAction action);
     };
 }
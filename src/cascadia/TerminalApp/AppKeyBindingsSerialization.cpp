@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "AppKeyBindingsSerialization.h"
+#include "AppKeyBindings.h"
 #include "KeyChordSerialization.h"
 #include "Utils.h"
 #include <winrt/Microsoft.Terminal.Settings.h>
@@ -49,6 +50,7 @@ static constexpr std::string_view SwitchToTab8Key{ "switchToTab8" };
 static constexpr std::string_view OpenSettingsKey{ "openSettings" };
 static constexpr std::string_view SplitHorizontalKey{ "splitHorizontal" };
 static constexpr std::string_view SplitVerticalKey{ "splitVertical" };
+static constexpr std::string_view ToggleDebugHudKey{ "toggleDebugHud" };
 
 // Specifically use a map here over an unordered_map. We want to be able to
 // iterate over these entries in-order when we're serializing the keybindings.
@@ -94,6 +96,7 @@ static const std::map<std::string_view, ShortcutAction, std::less<>> commandName
     { SplitHorizontalKey, ShortcutAction::SplitHorizontal },
     { SplitVerticalKey, ShortcutAction::SplitVertical },
     { OpenSettingsKey, ShortcutAction::OpenSettings },
+    { ToggleDebugHudKey, ShortcutAction::ToggleDebugHud },
 };
 
 // Function Description:
@@ -163,6 +166,9 @@ Json::Value AppKeyBindingsSerialization::ToJson(const winrt::TerminalApp::AppKey
 //   listed in `commandNames`, and `keys` is an array of keypresses. Currently,
 //   the array should contain a single string, which can be deserialized into a
 //   KeyChord.
+// - The chord strings are not parsed here - they're queued on the
+//   AppKeyBindings and tokenized lazily on the first binding lookup, keeping
+//   that work off the settings load path.
 // Arguments:
 // - json: and array of JsonObject's to deserialize into our _keyShortcuts mapping.
 // Return Value:
@@ -175,20 +181,20 @@ winrt::TerminalApp::AppKeyBindings AppKeyBindingsSerialization::FromJson(const J
     {
         if (value.isObject())
         {
-            const auto commandString = value[JsonKey(CommandKey)];
-            const auto keys = value[JsonKey(KeysKey)];
+            const auto commandString = JsonFind(value, CommandKey);
+            const auto keys = JsonFind(value, KeysKey);
 
             if (commandString && keys)
             {
-                if (!keys.isArray() || keys.size() != 1)
+                if (!keys->isArray() || keys->size() != 1)
                 {
                     continue;
                 }
-                const auto keyChordString = winrt::to_hstring(keys[0].asString());
+                const auto keyChordString = winrt::to_hstring((*keys)[0].asString());
                 ShortcutAction action;
 
                 // Try matching the command to one we have
-                const auto found = commandNames.find(commandString.asString());
+                const auto found = commandNames.find(commandString->asString());
                 if (found != commandNames.end())
                 {
                     action = found->second;
@@ -198,16 +204,10 @@ winrt::TerminalApp::AppKeyBindings AppKeyBindingsSerialization::FromJson(const J
                     continue;
                 }
 
-                // Try parsing the chord
-                try
-                {
-                    const auto chord = KeyChordSerialization::FromString(keyChordString);
-                    newBindings.SetKeyBinding(action, chord);
-                }
-                catch (...)
-                {
-                    continue;
-                }
+                // Queue the chord string - it's parsed on first lookup, not
+                // here. An unparseable string is dropped then, just as it
+                // would have been dropped here.
+                winrt::get_self<implementation::AppKeyBindings>(newBindings)->AddPendingKeyBinding(action, keyChordString);
             }
         }
     }
@@ -24,6 +24,33 @@ static constexpr std::wstring_view PACKAGED_PROFILE_ICON_PATH{ L"ms-appx:///Prof
 static constexpr std::wstring_view PACKAGED_PROFILE_ICON_EXTENSION{ L".png" };
 static constexpr std::wstring_view DEFAULT_LINUX_ICON_GUID{ L"{9acb9455-ca41-5af7-950f-6bca1bc9722f}" };
 
+// The identities of the well-known default profiles, precomputed at compile
+// time. Each GUID is the v5 UUID of the profile name in the namespace above,
+// and each icon path embeds its string form, so building one of these
+// profiles at launch costs no SHA-1 hashing and no GUID formatting. Profiles
+// only discovered at runtime (WSL distributions) still take the hashing path.
+struct PrecompiledProfileIdentity
+{
+    std::wstring_view name;
+    GUID guid;
+    std::wstring_view iconPath;
+};
+
+static constexpr PrecompiledProfileIdentity PRECOMPILED_PROFILE_IDENTITIES[] = {
+    // uuidv5(TERMINAL_PROFILE_NAMESPACE_GUID, L"cmd")
+    { L"cmd",
+      { 0x0caa0dad, 0x35be, 0x5f56, { 0xa8, 0xff, 0xaf, 0xce, 0xee, 0xaa, 0x61, 0x01 } },
+      L"ms-appx:///ProfileIcons/{0caa0dad-35be-5f56-a8ff-afceeeaa6101}.png" },
+    // uuidv5(TERMINAL_PROFILE_NAMESPACE_GUID, L"Windows PowerShell")
+    { L"Windows PowerShell",
+      { 0x61c54bbd, 0xc2c6, 0x5271, { 0x96, 0xe7, 0x00, 0x9a, 0x87, 0xff, 0x44, 0xbf } },
+      L"ms-appx:///ProfileIcons/{61c54bbd-c2c6-5271-96e7-009a87ff44bf}.png" },
+    // uuidv5(TERMINAL_PROFILE_NAMESPACE_GUID, L"PowerShell Core")
+    { L"PowerShell Core",
+      { 0x574e775e, 0x4f2a, 0x5b96, { 0xac, 0x1e, 0xa2, 0x96, 0x2a, 0x40, 0x23, 0x36 } },
+      L"ms-appx:///ProfileIcons/{574e775e-4f2a-5b96-ac1e-a2962a402336}.png" },
+};
+
 CascadiaSettings::CascadiaSettings() :
     _globals{},
     _profiles{}
@@ -261,6 +288,10 @@ void CascadiaSettings::_CreateDefaultKeybindings()
                               KeyChord{ KeyModifiers::Ctrl,
                                         VK_OEM_COMMA });
 
+    keyBindings.SetKeyBinding(ShortcutAction::ToggleDebugHud,
+                              KeyChord{ KeyModifiers::Ctrl | KeyModifiers::Shift,
+                                        VK_F12 });
+
     keyBindings.SetKeyBinding(ShortcutAction::NextTab,
                               KeyChord{ KeyModifiers::Ctrl,
                                         VK_TAB });
@@ -363,13 +394,25 @@ void CascadiaSettings::CreateDefaults()
 //      if there is no match.
 const Profile* CascadiaSettings::FindProfile(GUID profileGuid) const noexcept
 {
-    for (auto& profile : _profiles)
+    try
     {
-        if (profile.GetGuid() == profileGuid)
+        // (Re)build the index if profiles were added since the last lookup.
+        if (_profileIndex.size() != _profiles.size())
         {
-            return &profile;
+            _profileIndex.clear();
+            for (size_t i = 0; i < _profiles.size(); ++i)
+            {
+                _profileIndex.emplace(_profiles[i].GetGuid(), i);
+            }
+        }
+
+        const auto iter = _profileIndex.find(profileGuid);
+        if (iter != _profileIndex.end())
+        {
+            return &_profiles[iter->second];
         }
     }
+    CATCH_LOG();
     return nullptr;
 }
 
@@ -394,11 +437,23 @@ TerminalSettings CascadiaSettings::MakeSettings(std::optional<GUID> profileGuidA
         throw E_INVALIDARG;
     }
 
+    // Hand out the snapshot we already built for this profile, if we have
+    // one. The callers all treat the settings object as read-only, so tabs
+    // of the same profile can share a single instance; a settings reload
+    // replaces this whole CascadiaSettings object, cache included.
+    const auto cached = _settingsCache.find(profileGuid);
+    if (cached != _settingsCache.end())
+    {
+        return cached->second;
+    }
+
     TerminalSettings result = profile->CreateTerminalSettings(_globals.GetColorSchemes());
 
     // Place our appropriate global settings into the Terminal Settings
     _globals.ApplyToSettings(result);
 
+    _settingsCache.emplace(profileGuid, result);
+
     return result;
 }
 
@@ -594,6 +649,20 @@ std::wstring CascadiaSettings::ExpandEnvironmentVariableString(std::wstring_view
 // - A Profile, ready to be filled in
 Profile CascadiaSettings::_CreateDefaultProfile(const std::wstring_view name)
 {
+    // The well-known default profiles have their identities compiled in.
+    for (const auto& identity : PRECOMPILED_PROFILE_IDENTITIES)
+    {
+        if (identity.name == name)
+        {
+            Profile newProfile{ identity.guid };
+
+            newProfile.SetName(static_cast<std::wstring>(name));
+            newProfile.SetIconPath(identity.iconPath);
+
+            return newProfile;
+        }
+    }
+
     auto profileGuid{ Utils::CreateV5Uuid(TERMINAL_PROFILE_NAMESPACE_GUID, gsl::as_bytes(gsl::make_span(name))) };
     Profile newProfile{ profileGuid };
 
@@ -23,6 +23,23 @@ Author(s):
 namespace TerminalApp
 {
     class CascadiaSettings;
+
+    // Hashes a GUID byte-wise (FNV-1a) so profiles can be indexed by GUID in
+    // unordered containers.
+    struct GuidHash
+    {
+        size_t operator()(const GUID& guid) const noexcept
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&guid);
+            size_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < sizeof(GUID); ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    };
 };
 
 class TerminalApp::CascadiaSettings final
@@ -33,6 +50,7 @@ public:
 
     static std::unique_ptr<CascadiaSettings> LoadAll(const bool saveOnLoad = true);
     void SaveAll() const;
+    void SaveAllAsync() const;
 
     winrt::Microsoft::Terminal::Settings::TerminalSettings MakeSettings(std::optional<GUID> profileGuid) const;
 
@@ -51,16 +69,28 @@ public:
 
     void CreateDefaults();
 
+    static void WriteSettingsStringToDisk(const std::string_view content);
+
 private:
     GlobalAppSettings _globals;
     std::vector<Profile> _profiles;
 
+    // GUID-indexed views over _profiles, built lazily and rebuilt whenever
+    // the profile count changes. _settingsCache holds the TerminalSettings
+    // snapshot handed out for each profile, so opening the Nth tab of a
+    // profile shares the first tab's settings object instead of rebuilding
+    // the color table and strings again. Both are only touched from the UI
+    // thread, like the rest of this class.
+    mutable std::unordered_map<GUID, size_t, GuidHash> _profileIndex;
+    mutable std::unordered_map<GUID, winrt::Microsoft::Terminal::Settings::TerminalSettings, GuidHash> _settingsCache;
+
     void _CreateDefaultKeybindings();
     void _CreateDefaultSchemes();
     void _CreateDefaultProfiles();
 
     static bool _IsPackaged();
     static void _WriteSettings(const std::string_view content);
+    std::string _SerializeSettings() const;
     static std::optional<std::string> _ReadSettings();
 
     static bool _isPowerShellCoreInstalledInPath(const std::wstring_view programFileEnv, std::filesystem::path& cmdline);
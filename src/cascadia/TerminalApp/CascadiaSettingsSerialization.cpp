@@ -5,9 +5,11 @@
 #include <argb.h>
 #include "CascadiaSettings.h"
 #include "AppKeyBindingsSerialization.h"
+#include "Utils.h"
 #include "../../types/inc/utils.hpp"
 #include <appmodel.h>
 #include <shlobj.h>
+#include <chrono>
 
 using namespace ::TerminalApp;
 using namespace winrt::Microsoft::Terminal::TerminalControl;
@@ -24,6 +26,143 @@ static constexpr std::string_view SchemesKey{ "schemes" };
 
 static constexpr std::string_view Utf8Bom{ u8"\uFEFF" };
 
+// The schema-verification cache lives beside profiles.json. It records the
+// hash of the last file contents whose schema we verified as current, so warm
+// launches with an unchanged file skip the expensive re-serialize-and-compare
+// pass entirely. Bump the version whenever the serialized schema changes so
+// stale caches self-invalidate.
+static constexpr std::wstring_view VerifiedCacheFilename{ L"profiles.json.verified" };
+static constexpr std::string_view VerifiedCacheVersion{ "WTV1" };
+
+// Function Description:
+// - Hashes the raw settings file contents (FNV-1a, 64 bit). This only needs
+//   to detect edits between launches, not resist an adversary.
+static uint64_t _HashSettingsContents(const std::string_view contents) noexcept
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (const auto ch : contents)
+    {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Function Description:
+// - Returns the full path of the schema-verification cache file.
+static std::wstring _GetVerifiedCachePath()
+{
+    std::filesystem::path path{ CascadiaSettings::GetSettingsPath() };
+    path.replace_filename(VerifiedCacheFilename);
+    return path;
+}
+
+// Function Description:
+// - Reads the hash recorded by the last successful schema verification.
+// Return Value:
+// - the hash, or nullopt if there is no usable cache (missing file, wrong
+//   version, malformed contents).
+static std::optional<uint64_t> _ReadVerifiedHash() noexcept
+try
+{
+    wil::unique_hfile hFile{ CreateFileW(_GetVerifiedCachePath().c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL) };
+    if (!hFile)
+    {
+        return std::nullopt;
+    }
+
+    char buffer[64];
+    DWORD bytesRead = 0;
+    if (!ReadFile(hFile.get(), buffer, sizeof(buffer) - 1, &bytesRead, nullptr))
+    {
+        return std::nullopt;
+    }
+    buffer[bytesRead] = '\0';
+
+    const std::string_view contents{ buffer, bytesRead };
+    if (contents.compare(0, VerifiedCacheVersion.size(), VerifiedCacheVersion) != 0)
+    {
+        return std::nullopt;
+    }
+
+    const uint64_t hash = strtoull(buffer + VerifiedCacheVersion.size(), nullptr, 16);
+    if (hash == 0)
+    {
+        return std::nullopt;
+    }
+    return { hash };
+}
+catch (...)
+{
+    return std::nullopt;
+}
+
+namespace
+{
+    // Shared state for the background settings writer. Save requests land in
+    // pending; the writer thread waits for a quiet period so bursts (a future
+    // settings UI calling save per keystroke) collapse into one disk write,
+    // then performs the atomic file replace off the UI thread.
+    struct SettingsWriterState
+    {
+        std::mutex lock;
+        std::condition_variable wake;
+        std::optional<std::string> pending;
+        bool threadRunning = false;
+    };
+
+    SettingsWriterState& _GetSettingsWriterState()
+    {
+        static SettingsWriterState state;
+        return state;
+    }
+
+    constexpr auto SettingsWriteDebounce = std::chrono::milliseconds(350);
+
+    void _SettingsWriterThreadProc() noexcept
+    {
+        auto& state = _GetSettingsWriterState();
+        while (true)
+        {
+            std::string content;
+            {
+                std::unique_lock<std::mutex> guard{ state.lock };
+                // Wait until a request lands, then keep waiting while new
+                // requests keep replacing it, so we write once per burst.
+                state.wake.wait(guard, [&state] { return state.pending.has_value(); });
+                while (state.wake.wait_for(guard, SettingsWriteDebounce) != std::cv_status::timeout)
+                {
+                }
+                content = std::move(state.pending).value();
+                state.pending.reset();
+            }
+
+            try
+            {
+                CascadiaSettings::WriteSettingsStringToDisk(content);
+            }
+            CATCH_LOG();
+        }
+    }
+}
+
+// Function Description:
+// - Records the hash of settings file contents whose schema has been verified
+//   as current. Failures are logged and otherwise ignored; the cache is only
+//   an optimization.
+static void _WriteVerifiedHash(const uint64_t hash) noexcept
+try
+{
+    char buffer[64];
+    const int length = sprintf_s(buffer, "%.*s%016llx", static_cast<int>(VerifiedCacheVersion.size()), VerifiedCacheVersion.data(), hash);
+    THROW_HR_IF(E_UNEXPECTED, length <= 0);
+
+    wil::unique_hfile hFile{ CreateFileW(_GetVerifiedCachePath().c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL) };
+    THROW_LAST_ERROR_IF(!hFile);
+    THROW_LAST_ERROR_IF(!WriteFile(hFile.get(), buffer, static_cast<DWORD>(length), nullptr, nullptr));
+}
+CATCH_LOG()
+
 // Method Description:
 // - Creates a CascadiaSettings from whatever's saved on disk, or instantiates
 //      a new one with the default values. If we're running as a packaged app,
@@ -54,7 +193,11 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::LoadAll(const bool saveOnLoa
 
         // Parse the json data.
         Json::Value root;
-        std::unique_ptr<Json::CharReader> reader{ Json::CharReaderBuilder::CharReaderBuilder().newCharReader() };
+        Json::CharReaderBuilder readerBuilder;
+        // We never re-emit the user's comments (ToJson writes none), so
+        // there's no reason to allocate storage for them during the parse.
+        readerBuilder.settings_["collectComments"] = false;
+        std::unique_ptr<Json::CharReader> reader{ readerBuilder.newCharReader() };
         std::string errs; // This string will recieve any error text from failing to parse.
         // `parse` will return false if it fails.
         if (!reader->parse(actualDataStart, actualData.c_str() + actualData.size(), &root, &errs))
@@ -69,11 +212,31 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::LoadAll(const bool saveOnLoa
         {
             // Logically compare the json we've parsed from the file to what
             // we'd serialize at runtime. If the values are different, then
-            // write the updated schema back out.
-            const Json::Value reserialized = resultPtr->ToJson();
-            if (reserialized != root)
+            // write the updated schema back out. Running the whole tree back
+            // through jsoncpp on every launch is a measurable chunk of cold
+            // start, so the result of this check is cached by content hash
+            // and skipped while the file is unchanged.
+            const uint64_t contentsHash = _HashSettingsContents(actualData);
+            const auto verifiedHash = _ReadVerifiedHash();
+            if (!verifiedHash || verifiedHash.value() != contentsHash)
             {
-                resultPtr->SaveAll();
+                const Json::Value reserialized = resultPtr->ToJson();
+                if (reserialized != root)
+                {
+                    resultPtr->SaveAll();
+
+                    // Hash what we just wrote, so the next launch skips the
+                    // check against the rewritten file.
+                    const auto savedData = _ReadSettings();
+                    if (savedData)
+                    {
+                        _WriteVerifiedHash(_HashSettingsContents(savedData.value()));
+                    }
+                }
+                else
+                {
+                    _WriteVerifiedHash(contentsHash);
+                }
             }
         }
     }
@@ -98,14 +261,59 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::LoadAll(const bool saveOnLoa
 // Return Value:
 // - <none>
 void CascadiaSettings::SaveAll() const
+{
+    _WriteSettings(_SerializeSettings());
+}
+
+// Method Description:
+// - Queues a save of this settings structure to a background writer thread.
+//   Serialization happens here on the caller's thread (it's cheap and avoids
+//   racing later mutations of this object); the disk write - the part that
+//   can stall behind antivirus scans and storage latency - is debounced and
+//   performed off-thread with an atomic file replace. Rapid repeated calls
+//   collapse into a single write of the latest contents.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void CascadiaSettings::SaveAllAsync() const
+{
+    auto serializedString = _SerializeSettings();
+
+    auto& state = _GetSettingsWriterState();
+    {
+        std::lock_guard<std::mutex> guard{ state.lock };
+        state.pending = std::move(serializedString);
+        if (!state.threadRunning)
+        {
+            std::thread(_SettingsWriterThreadProc).detach();
+            state.threadRunning = true;
+        }
+    }
+    state.wake.notify_one();
+}
+
+// Method Description:
+// - Serializes these settings to their string form.
+// Return Value:
+// - the JSON text that SaveAll and SaveAllAsync write to the settings file.
+std::string CascadiaSettings::_SerializeSettings() const
 {
     const auto json = ToJson();
     Json::StreamWriterBuilder wbuilder;
     // Use 4 spaces to indent instead of \t
     wbuilder.settings_["indentation"] = "    ";
-    const auto serializedString = Json::writeString(wbuilder, json);
+    return Json::writeString(wbuilder, json);
+}
 
-    _WriteSettings(serializedString);
+// Method Description:
+// - Writes already-serialized settings text to the settings file. Public only
+//   for the background writer thread; use SaveAll/SaveAllAsync instead.
+// Arguments:
+// - content: the serialized settings text.
+void CascadiaSettings::WriteSettingsStringToDisk(const std::string_view content)
+{
+    _WriteSettings(content);
 }
 
 // Method Description:
@@ -148,11 +356,11 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::FromJson(const Json::Value&
 {
     std::unique_ptr<CascadiaSettings> resultPtr = std::make_unique<CascadiaSettings>();
 
-    if (auto globals{ json[GlobalsKey.data()] })
+    if (auto globals{ JsonFind(json, GlobalsKey) })
     {
-        if (globals.isObject())
+        if (globals->isObject())
         {
-            resultPtr->_globals = GlobalAppSettings::FromJson(globals);
+            resultPtr->_globals = GlobalAppSettings::FromJson(*globals);
         }
     }
     else
@@ -165,7 +373,7 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::FromJson(const Json::Value&
         // If we didn't find keybindings in the legacy path, then they probably
         // don't exist in the file. Create the default keybindings if we
         // couldn't find any keybindings.
-        auto keybindings{ json[KeybindingsKey.data()] };
+        auto keybindings{ JsonFind(json, KeybindingsKey) };
         if (!keybindings)
         {
             resultPtr->_CreateDefaultKeybindings();
@@ -182,9 +390,9 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::FromJson(const Json::Value&
     //      Or should we just recreate the default profiles?
 
     auto& resultSchemes = resultPtr->_globals.GetColorSchemes();
-    if (auto schemes{ json[SchemesKey.data()] })
+    if (auto schemes{ JsonFind(json, SchemesKey) })
     {
-        for (auto schemeJson : schemes)
+        for (const auto& schemeJson : *schemes)
         {
             if (schemeJson.isObject())
             {
@@ -194,14 +402,14 @@ std::unique_ptr<CascadiaSettings> CascadiaSettings::FromJson(const Json::Value&
         }
     }
 
-    if (auto profiles{ json[ProfilesKey.data()] })
+    if (auto profiles{ JsonFind(json, ProfilesKey) })
     {
-        for (auto profileJson : profiles)
+        for (const auto& profileJson : *profiles)
         {
             if (profileJson.isObject())
             {
                 auto profile = Profile::FromJson(profileJson);
-                resultPtr->_profiles.emplace_back(profile);
+                resultPtr->_profiles.emplace_back(std::move(profile));
             }
         }
     }
@@ -236,13 +444,19 @@ void CascadiaSettings::_WriteSettings(const std::string_view content)
 {
     auto pathToSettingsFile{ CascadiaSettings::GetSettingsPath() };
 
-    auto hOut = CreateFileW(pathToSettingsFile.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    // Write to a temporary file beside the target and swap it into place, so
+    // a crash or power loss mid-write can't leave a truncated settings file.
+    auto pathToTempFile{ pathToSettingsFile + L".tmp" };
+
+    auto hOut = CreateFileW(pathToTempFile.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
     if (hOut == INVALID_HANDLE_VALUE)
     {
         THROW_LAST_ERROR();
     }
     THROW_LAST_ERROR_IF(!WriteFile(hOut, content.data(), gsl::narrow<DWORD>(content.size()), 0, 0));
     CloseHandle(hOut);
+
+    THROW_LAST_ERROR_IF(!MoveFileExW(pathToTempFile.c_str(), pathToSettingsFile.c_str(), MOVEFILE_REPLACE_EXISTING));
 }
 
 // Method Description:
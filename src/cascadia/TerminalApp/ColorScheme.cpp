@@ -108,27 +108,27 @@ ColorScheme ColorScheme::FromJson(const Json::Value& json)
 {
     ColorScheme result{};
 
-    if (auto name{ json[JsonKey(NameKey)] })
+    if (auto name{ JsonFind(json, NameKey) })
     {
-        result._schemeName = winrt::to_hstring(name.asString());
+        result._schemeName = winrt::to_hstring(name->asString());
     }
-    if (auto fgString{ json[JsonKey(ForegroundKey)] })
+    if (auto fgString{ JsonFind(json, ForegroundKey) })
     {
-        const auto color = Utils::ColorFromHexString(fgString.asString());
+        const auto color = Utils::ColorFromHexString(fgString->asString());
         result._defaultForeground = color;
     }
-    if (auto bgString{ json[JsonKey(BackgroundKey)] })
+    if (auto bgString{ JsonFind(json, BackgroundKey) })
     {
-        const auto color = Utils::ColorFromHexString(bgString.asString());
+        const auto color = Utils::ColorFromHexString(bgString->asString());
         result._defaultBackground = color;
     }
 
     // Legacy Deserialization. Leave in place to allow forward compatibility
-    if (auto table{ json[JsonKey(TableKey)] })
+    if (auto table{ JsonFind(json, TableKey) })
     {
         int i = 0;
 
-        for (const auto& tableEntry : table)
+        for (const auto& tableEntry : *table)
         {
             if (tableEntry.isString())
             {
@@ -142,9 +142,9 @@ ColorScheme ColorScheme::FromJson(const Json::Value& json)
     int i = 0;
     for (const auto& current : TableColors)
     {
-        if (auto str{ json[JsonKey(current)] })
+        if (auto str{ JsonFind(json, current) })
         {
-            const auto color = Utils::ColorFromHexString(str.asString());
+            const auto color = Utils::ColorFromHexString(str->asString());
             result._table.at(i) = color;
         }
         i++;
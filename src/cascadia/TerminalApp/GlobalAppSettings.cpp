@@ -162,43 +162,43 @@ GlobalAppSettings GlobalAppSettings::FromJson(const Json::Value& json)
 {
     GlobalAppSettings result{};
 
-    if (auto defaultProfile{ json[JsonKey(DefaultProfileKey)] })
+    if (auto defaultProfile{ JsonFind(json, DefaultProfileKey) })
     {
-        auto guid = Utils::GuidFromString(GetWstringFromJson(defaultProfile));
+        auto guid = Utils::GuidFromString(GetWstringFromJson(*defaultProfile));
         result._defaultProfile = guid;
     }
 
-    if (auto alwaysShowTabs{ json[JsonKey(AlwaysShowTabsKey)] })
+    if (auto alwaysShowTabs{ JsonFind(json, AlwaysShowTabsKey) })
     {
-        result._alwaysShowTabs = alwaysShowTabs.asBool();
+        result._alwaysShowTabs = alwaysShowTabs->asBool();
     }
-    if (auto initialRows{ json[JsonKey(InitialRowsKey)] })
+    if (auto initialRows{ JsonFind(json, InitialRowsKey) })
     {
-        result._initialRows = initialRows.asInt();
+        result._initialRows = initialRows->asInt();
     }
-    if (auto initialCols{ json[JsonKey(InitialColsKey)] })
+    if (auto initialCols{ JsonFind(json, InitialColsKey) })
     {
-        result._initialCols = initialCols.asInt();
+        result._initialCols = initialCols->asInt();
     }
 
-    if (auto showTitleInTitlebar{ json[JsonKey(ShowTitleInTitlebarKey)] })
+    if (auto showTitleInTitlebar{ JsonFind(json, ShowTitleInTitlebarKey) })
     {
-        result._showTitleInTitlebar = showTitleInTitlebar.asBool();
+        result._showTitleInTitlebar = showTitleInTitlebar->asBool();
     }
 
-    if (auto showTabsInTitlebar{ json[JsonKey(ShowTabsInTitlebarKey)] })
+    if (auto showTabsInTitlebar{ JsonFind(json, ShowTabsInTitlebarKey) })
     {
-        result._showTabsInTitlebar = showTabsInTitlebar.asBool();
+        result._showTabsInTitlebar = showTabsInTitlebar->asBool();
     }
 
-    if (auto requestedTheme{ json[JsonKey(RequestedThemeKey)] })
+    if (auto requestedTheme{ JsonFind(json, RequestedThemeKey) })
     {
-        result._requestedTheme = _ParseTheme(GetWstringFromJson(requestedTheme));
+        result._requestedTheme = _ParseTheme(GetWstringFromJson(*requestedTheme));
     }
 
-    if (auto keybindings{ json[JsonKey(KeybindingsKey)] })
+    if (auto keybindings{ JsonFind(json, KeybindingsKey) })
     {
-        result._keybindings = AppKeyBindingsSerialization::FromJson(keybindings);
+        result._keybindings = AppKeyBindingsSerialization::FromJson(*keybindings);
     }
 
     return result;
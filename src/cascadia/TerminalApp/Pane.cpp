@@ -250,6 +250,48 @@ void Pane::UpdateSettings(const TerminalSettings& settings, const GUID& profile)
     }
 }
 
+// Method Description:
+// - Suspends rendering for every control in this pane's tree of panes. Used
+//   when the tab containing us moves to the background - the controls keep
+//   parsing their connections' output, but stop spending GPU and render
+//   thread time painting frames that aren't visible.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Pane::SuspendRendering()
+{
+    if (!_IsLeaf())
+    {
+        _firstChild->SuspendRendering();
+        _secondChild->SuspendRendering();
+    }
+    else
+    {
+        _control.SuspendRendering();
+    }
+}
+
+// Method Description:
+// - Resumes rendering for every control in this pane's tree of panes. Used
+//   when the tab containing us becomes the foreground tab again.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Pane::ResumeRendering()
+{
+    if (!_IsLeaf())
+    {
+        _firstChild->ResumeRendering();
+        _secondChild->ResumeRendering();
+    }
+    else
+    {
+        _control.ResumeRendering();
+    }
+}
+
 // Method Description:
 // - Closes one of our children. In doing so, takes the control from the other
 //   child, and makes this pane a leaf node again.
@@ -305,6 +347,10 @@ void Pane::_CloseChild(const bool closeFirst)
         _firstChild->_root.Children().Clear();
         _secondChild->_root.Children().Clear();
 
+        // The closed control is unparented and unhooked now - park it (and
+        // its GPU resources) for the next split instead of tearing it down.
+        TermControl::ReturnForRecycle(closedChild->_control);
+
         // Reset our UI:
         _root.Children().Clear();
         _root.ColumnDefinitions().Clear();
@@ -327,6 +373,12 @@ void Pane::_CloseChild(const bool closeFirst)
     }
     else
     {
+        // The closed child is always a leaf - unhook and unparent its
+        // control, then park it for the next split.
+        closedChild->_control.ConnectionClosed(closedChild->_connectionClosedToken);
+        closedChild->_root.Children().Clear();
+        TermControl::ReturnForRecycle(closedChild->_control);
+
         // First stash away references to the old panes and their tokens
         const auto oldFirstToken = _firstClosedToken;
         const auto oldSecondToken = _secondClosedToken;
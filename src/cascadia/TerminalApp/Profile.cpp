@@ -305,39 +305,39 @@ Profile Profile::FromJson(const Json::Value& json)
     Profile result{};
 
     // Profile-specific Settings
-    if (auto name{ json[JsonKey(NameKey)] })
+    if (auto name{ JsonFind(json, NameKey) })
     {
-        result._name = GetWstringFromJson(name);
+        result._name = GetWstringFromJson(*name);
     }
-    if (auto guid{ json[JsonKey(GuidKey)] })
+    if (auto guid{ JsonFind(json, GuidKey) })
     {
-        result._guid = Utils::GuidFromString(GetWstringFromJson(guid));
+        result._guid = Utils::GuidFromString(GetWstringFromJson(*guid));
     }
 
     // Core Settings
-    if (auto foreground{ json[JsonKey(ForegroundKey)] })
+    if (auto foreground{ JsonFind(json, ForegroundKey) })
     {
-        const auto color = Utils::ColorFromHexString(foreground.asString());
+        const auto color = Utils::ColorFromHexString(foreground->asString());
         result._defaultForeground = color;
     }
-    if (auto background{ json[JsonKey(BackgroundKey)] })
+    if (auto background{ JsonFind(json, BackgroundKey) })
     {
-        const auto color = Utils::ColorFromHexString(background.asString());
+        const auto color = Utils::ColorFromHexString(background->asString());
         result._defaultBackground = color;
     }
-    if (auto colorScheme{ json[JsonKey(ColorSchemeKey)] })
+    if (auto colorScheme{ JsonFind(json, ColorSchemeKey) })
     {
-        result._schemeName = GetWstringFromJson(colorScheme);
+        result._schemeName = GetWstringFromJson(*colorScheme);
     }
-    else if (auto colorScheme{ json[JsonKey(ColorSchemeKeyOld)] })
+    else if (auto colorScheme{ JsonFind(json, ColorSchemeKeyOld) })
     {
         // TODO:GH#1069 deprecate old settings key
-        result._schemeName = GetWstringFromJson(colorScheme);
+        result._schemeName = GetWstringFromJson(*colorScheme);
     }
-    else if (auto colortable{ json[JsonKey(ColorTableKey)] })
+    else if (auto colortable{ JsonFind(json, ColorTableKey) })
     {
         int i = 0;
-        for (const auto& tableEntry : colortable)
+        for (const auto& tableEntry : *colortable)
         {
             if (tableEntry.isString())
             {
@@ -347,81 +347,81 @@ Profile Profile::FromJson(const Json::Value& json)
             i++;
         }
     }
-    if (auto historySize{ json[JsonKey(HistorySizeKey)] })
+    if (auto historySize{ JsonFind(json, HistorySizeKey) })
     {
         // TODO:MSFT:20642297 - Use a sentinel value (-1) for "Infinite scrollback"
-        result._historySize = historySize.asInt();
+        result._historySize = historySize->asInt();
     }
-    if (auto snapOnInput{ json[JsonKey(SnapOnInputKey)] })
+    if (auto snapOnInput{ JsonFind(json, SnapOnInputKey) })
     {
-        result._snapOnInput = snapOnInput.asBool();
+        result._snapOnInput = snapOnInput->asBool();
     }
-    if (auto cursorColor{ json[JsonKey(CursorColorKey)] })
+    if (auto cursorColor{ JsonFind(json, CursorColorKey) })
     {
-        const auto color = Utils::ColorFromHexString(cursorColor.asString());
+        const auto color = Utils::ColorFromHexString(cursorColor->asString());
         result._cursorColor = color;
     }
-    if (auto cursorHeight{ json[JsonKey(CursorHeightKey)] })
+    if (auto cursorHeight{ JsonFind(json, CursorHeightKey) })
     {
-        result._cursorHeight = cursorHeight.asUInt();
+        result._cursorHeight = cursorHeight->asUInt();
     }
-    if (auto cursorShape{ json[JsonKey(CursorShapeKey)] })
+    if (auto cursorShape{ JsonFind(json, CursorShapeKey) })
     {
-        result._cursorShape = _ParseCursorShape(GetWstringFromJson(cursorShape));
+        result._cursorShape = _ParseCursorShape(GetWstringFromJson(*cursorShape));
     }
 
     // Control Settings
-    if (auto commandline{ json[JsonKey(CommandlineKey)] })
+    if (auto commandline{ JsonFind(json, CommandlineKey) })
     {
-        result._commandline = GetWstringFromJson(commandline);
+        result._commandline = GetWstringFromJson(*commandline);
     }
-    if (auto fontFace{ json[JsonKey(FontFaceKey)] })
+    if (auto fontFace{ JsonFind(json, FontFaceKey) })
     {
-        result._fontFace = GetWstringFromJson(fontFace);
+        result._fontFace = GetWstringFromJson(*fontFace);
     }
-    if (auto fontSize{ json[JsonKey(FontSizeKey)] })
+    if (auto fontSize{ JsonFind(json, FontSizeKey) })
     {
-        result._fontSize = fontSize.asInt();
+        result._fontSize = fontSize->asInt();
     }
-    if (auto acrylicTransparency{ json[JsonKey(AcrylicTransparencyKey)] })
+    if (auto acrylicTransparency{ JsonFind(json, AcrylicTransparencyKey) })
     {
-        result._acrylicTransparency = acrylicTransparency.asFloat();
+        result._acrylicTransparency = acrylicTransparency->asFloat();
     }
-    if (auto useAcrylic{ json[JsonKey(UseAcrylicKey)] })
+    if (auto useAcrylic{ JsonFind(json, UseAcrylicKey) })
     {
-        result._useAcrylic = useAcrylic.asBool();
+        result._useAcrylic = useAcrylic->asBool();
     }
-    if (auto closeOnExit{ json[JsonKey(CloseOnExitKey)] })
+    if (auto closeOnExit{ JsonFind(json, CloseOnExitKey) })
     {
-        result._closeOnExit = closeOnExit.asBool();
+        result._closeOnExit = closeOnExit->asBool();
     }
-    if (auto padding{ json[JsonKey(PaddingKey)] })
+    if (auto padding{ JsonFind(json, PaddingKey) })
     {
-        result._padding = GetWstringFromJson(padding);
+        result._padding = GetWstringFromJson(*padding);
     }
-    if (auto scrollbarState{ json[JsonKey(ScrollbarStateKey)] })
+    if (auto scrollbarState{ JsonFind(json, ScrollbarStateKey) })
     {
-        result._scrollbarState = GetWstringFromJson(scrollbarState);
+        result._scrollbarState = GetWstringFromJson(*scrollbarState);
     }
-    if (auto startingDirectory{ json[JsonKey(StartingDirectoryKey)] })
+    if (auto startingDirectory{ JsonFind(json, StartingDirectoryKey) })
     {
-        result._startingDirectory = GetWstringFromJson(startingDirectory);
+        result._startingDirectory = GetWstringFromJson(*startingDirectory);
     }
-    if (auto icon{ json[JsonKey(IconKey)] })
+    if (auto icon{ JsonFind(json, IconKey) })
     {
-        result._icon = GetWstringFromJson(icon);
+        result._icon = GetWstringFromJson(*icon);
     }
-    if (auto backgroundImage{ json[JsonKey(BackgroundImageKey)] })
+    if (auto backgroundImage{ JsonFind(json, BackgroundImageKey) })
     {
-        result._backgroundImage = GetWstringFromJson(backgroundImage);
+        result._backgroundImage = GetWstringFromJson(*backgroundImage);
     }
-    if (auto backgroundImageOpacity{ json[JsonKey(BackgroundImageOpacityKey)] })
+    if (auto backgroundImageOpacity{ JsonFind(json, BackgroundImageOpacityKey) })
     {
-        result._backgroundImageOpacity = backgroundImageOpacity.asFloat();
+        result._backgroundImageOpacity = backgroundImageOpacity->asFloat();
     }
-    if (auto backgroundImageStretchMode{ json[JsonKey(BackgroundimageStretchModeKey)] })
+    if (auto backgroundImageStretchMode{ JsonFind(json, BackgroundimageStretchModeKey) })
     {
-        result._backgroundImageStretchMode = ParseImageStretchMode(backgroundImageStretchMode.asString());
+        result._backgroundImageStretchMode = ParseImageStretchMode(backgroundImageStretchMode->asString());
     }
 
     return result;
@@ -81,8 +81,18 @@ void Tab::SetFocused(const bool focused)
 
     if (_focused)
     {
+        // Wake the renderers back up before the tab's content is shown, so
+        // the first visible frame is already current.
+        _rootPane->ResumeRendering();
         _Focus();
     }
+    else
+    {
+        // Background tabs keep consuming their connections' output so the
+        // buffer stays warm, but they don't need to paint it. Park their
+        // render threads until we're switched back to.
+        _rootPane->SuspendRendering();
+    }
 }
 
 // Method Description:
@@ -5,14 +5,21 @@
 #include "Utils.h"
 
 // Method Description:
-// - Contstructs a wstring from a given Json::Value object. Reads the object as
-//   a std::string using asString, then builds an hstring from that std::string,
-//   then converts that hstring into a std::wstring.
+// - Contstructs a wstring from a given Json::Value object. Converts straight
+//   from the value's internal character storage when it's a real string, so
+//   the only allocations are the hstring conversion and the returned wstring;
+//   falls back to asString for values needing stringification.
 // Arguments:
 // - json: the Json::Value to parse as a string
 // Return Value:
 // - the wstring equivalent of the value in json
 std::wstring GetWstringFromJson(const Json::Value& json)
 {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    if (json.getString(&begin, &end))
+    {
+        return winrt::to_hstring(std::string_view{ begin, gsl::narrow_cast<size_t>(end - begin) }).c_str();
+    }
     return winrt::to_hstring(json.asString()).c_str();
 }
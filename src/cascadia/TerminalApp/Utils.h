@@ -28,3 +28,19 @@ inline std::string JsonKey(const std::string_view key)
 {
     return static_cast<std::string>(key);
 }
+
+// Method Description:
+// - Look up a key in a Json::Value object without copying either the key or
+//   the value. The operator[]-with-JsonKey pattern costs a std::string for
+//   the key and a deep copy of the value at every field; a find against the
+//   raw key characters costs neither.
+// Arguments:
+// - json: the Json::Value to look the key up in
+// - key: the key to look up
+// Return Value:
+// - a pointer to the value for the key, or nullptr if json isn't an object or
+//   doesn't contain the key.
+inline const Json::Value* JsonFind(const Json::Value& json, const std::string_view key)
+{
+    return json.isObject() ? json.find(key.data(), key.data() + key.size()) : nullptr;
+}
@@ -14,10 +14,137 @@
 #include "ConhostConnection.g.cpp"
 
 #include <conpty-universal.h>
+#include <VtIoModes.hpp>
 #include "../../types/inc/Utils.hpp"
 
+#include <TraceLoggingProvider.h>
+#include <winmeta.h>
+#include <telemetry\ProjectTelemetry.h>
+
 using namespace ::Microsoft::Console;
 
+// Conpty latency instrumentation: the "pipe read" stage of the conpty
+// output pipeline. See tools\conptylatency for the consumer that lines
+// these markers up with the conhost-side events.
+TRACELOGGING_DEFINE_PROVIDER(
+    g_hTerminalConnectionProvider,
+    "Microsoft.Windows.Terminal.Connection",
+    // {f62733d0-a6ed-4ef4-9ccc-d8249976695f}
+    (0xf62733d0, 0xa6ed, 0x4ef4, 0x9c, 0xcc, 0xd8, 0x24, 0x99, 0x76, 0x69, 0x5f),
+    TraceLoggingOptionMicrosoftTelemetry());
+
+namespace
+{
+    // A single pre-spawned conhost kept warm for the next tab. Spawning and
+    // initializing conhost dominates new-tab latency, so the app keeps one
+    // instance with its pipes connected and its shell already starting;
+    // Start() adopts it when the profile matches instead of paying for a
+    // fresh spawn. The entry owns its job object, so displacing or abandoning
+    // it terminates the spare conhost.
+    struct WarmConhost
+    {
+        winrt::hstring commandline;
+        winrt::hstring startingDirectory;
+        winrt::guid guid{};
+        uint32_t rows = 0;
+        uint32_t cols = 0;
+        wil::unique_hfile inPipe;
+        wil::unique_hfile outPipe;
+        wil::unique_hfile signalPipe;
+        wil::unique_handle outputRingSection;
+        wil::unique_handle outputRingDataReady;
+        wil::unique_handle outputRingSpaceAvailable;
+        wil::unique_process_information piConhost;
+        wil::unique_handle hJob;
+    };
+
+    std::mutex g_warmConhostLock;
+    std::optional<WarmConhost> g_warmConhost;
+
+    // Function Description:
+    // - Launches a headless conhost, suspended, with the pipe plumbing, job
+    //   object, and WT_SESSION environment shared by the cold start path and
+    //   the prewarm path. The caller decides when to resume it.
+    // Arguments:
+    // - cmdline: the client commandline to hand to conhost.
+    // - startingDirectory: the directory to start the client in, if any.
+    // - rows/cols: the initial pty dimensions.
+    // - sessionGuid: the session identifier baked into WT_SESSION.
+    // - inPipe/outPipe/signalPipe/outputRing*/piConhost/hJob: receive the
+    //   spawned state. The ring handles stay empty when no ring could be
+    //   negotiated; output then arrives on outPipe alone.
+    void _SpawnConhost(const std::wstring& cmdline,
+                       const std::optional<std::wstring>& startingDirectory,
+                       const uint32_t rows,
+                       const uint32_t cols,
+                       const winrt::guid& sessionGuid,
+                       wil::unique_hfile& inPipe,
+                       wil::unique_hfile& outPipe,
+                       wil::unique_hfile& signalPipe,
+                       wil::unique_handle& outputRingSection,
+                       wil::unique_handle& outputRingDataReady,
+                       wil::unique_handle& outputRingSpaceAvailable,
+                       wil::unique_process_information& piConhost,
+                       wil::unique_handle& hJob)
+    {
+        EnvironmentVariableMapW extraEnvVars;
+        {
+            // Convert connection Guid to string and ignore the enclosing '{}'.
+            std::wstring wsGuid{ ::Microsoft::Console::Utils::GuidToString(sessionGuid) };
+            wsGuid.pop_back();
+
+            const wchar_t* const pwszGuid{ wsGuid.data() + 1 };
+
+            // Ensure every connection has the unique identifier in the environment.
+            extraEnvVars.emplace(L"WT_SESSION", pwszGuid);
+        }
+
+        // Ask for the shared-memory output ring alongside the pipes - frames
+        // ride the ring without a kernel copy or a syscall per chunk when the
+        // conhost adopts it.
+        ConptyRing::RingHandles outputRing;
+
+        // The conhost we spawn is the one packaged with us, so request the
+        // binary frame mode (see conpty-binary.h): it ships packed buffer
+        // deltas instead of VT text, and TerminalCore applies them directly
+        // without re-parsing escape sequences.
+        THROW_IF_FAILED(
+            CreateConPty(cmdline,
+                         startingDirectory,
+                         static_cast<short>(cols),
+                         static_cast<short>(rows),
+                         &inPipe,
+                         &outPipe,
+                         &signalPipe,
+                         &piConhost,
+                         CREATE_SUSPENDED,
+                         extraEnvVars,
+                         &outputRing,
+                         BINARY_STRING));
+
+        outputRingSection.reset(outputRing.Section);
+        outputRingDataReady.reset(outputRing.DataReady);
+        outputRingSpaceAvailable.reset(outputRing.SpaceAvailable);
+
+        hJob.reset(CreateJobObjectW(nullptr, nullptr));
+        THROW_LAST_ERROR_IF_NULL(hJob);
+
+        // We want the conhost and all associated descendant processes
+        // to be terminated when the tab is closed. GUI applications
+        // spawned from the shell tend to end up in their own jobs.
+        JOBOBJECT_EXTENDED_LIMIT_INFORMATION jobExtendedInformation{};
+        jobExtendedInformation.BasicLimitInformation.LimitFlags =
+            JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+
+        THROW_IF_WIN32_BOOL_FALSE(SetInformationJobObject(hJob.get(),
+                                                          JobObjectExtendedLimitInformation,
+                                                          &jobExtendedInformation,
+                                                          sizeof(jobExtendedInformation)));
+
+        THROW_IF_WIN32_BOOL_FALSE(AssignProcessToJobObject(hJob.get(), piConhost.hProcess));
+    }
+}
+
 namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 {
     ConhostConnection::ConhostConnection(const hstring& commandline,
@@ -31,6 +158,13 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         _startingDirectory{ startingDirectory },
         _guid{ initialGuid }
     {
+        // Register the provider once for the lifetime of the module.
+        static const bool providerRegistered = []() {
+            TraceLoggingRegister(g_hTerminalConnectionProvider);
+            return true;
+        }();
+        UNREFERENCED_PARAMETER(providerRegistered);
+
         if (_guid == guid{})
         {
             _guid = Utils::CreateGuid();
@@ -62,55 +196,127 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         _disconnectHandlers.remove(token);
     }
 
-    void ConhostConnection::Start()
+    // Function Description:
+    // - Spawns a conhost for the given profile ahead of need and parks it in
+    //   the warm pool, displacing (and thereby terminating) any previous
+    //   entry. The conhost is resumed immediately so it initializes and
+    //   launches its shell while no tab is waiting; by the time a tab
+    //   attaches, the first prompt is usually already sitting in the output
+    //   pipe. Prewarming is purely an optimization, so failures are logged
+    //   and swallowed.
+    // Arguments:
+    // - cmdline: the client commandline the next tab is expected to use.
+    // - startingDirectory: the starting directory for the client.
+    // - rows/cols: the initial pty dimensions; a mismatched tab resizes on attach.
+    void ConhostConnection::PrewarmConhost(const hstring& cmdline,
+                                           const hstring& startingDirectory,
+                                           const uint32_t rows,
+                                           const uint32_t cols)
+    try
     {
-        std::wstring cmdline{ _commandline.c_str() };
-        std::optional<std::wstring> startingDirectory;
-        if (!_startingDirectory.empty())
+        WarmConhost warm;
+        warm.commandline = cmdline;
+        warm.startingDirectory = startingDirectory;
+        warm.guid = Utils::CreateGuid();
+        warm.rows = rows;
+        warm.cols = cols;
+
+        std::optional<std::wstring> startingDir;
+        if (!startingDirectory.empty())
         {
-            startingDirectory = _startingDirectory;
+            startingDir = std::wstring{ startingDirectory };
         }
 
-        EnvironmentVariableMapW extraEnvVars;
-        {
-            // Convert connection Guid to string and ignore the enclosing '{}'.
-            std::wstring wsGuid{ Utils::GuidToString(_guid) };
-            wsGuid.pop_back();
+        _SpawnConhost(std::wstring{ cmdline },
+                      startingDir,
+                      rows,
+                      cols,
+                      warm.guid,
+                      warm.inPipe,
+                      warm.outPipe,
+                      warm.signalPipe,
+                      warm.outputRingSection,
+                      warm.outputRingDataReady,
+                      warm.outputRingSpaceAvailable,
+                      warm.piConhost,
+                      warm.hJob);
+
+        THROW_LAST_ERROR_IF(-1 == ResumeThread(warm.piConhost.hThread));
+
+        std::lock_guard<std::mutex> lock{ g_warmConhostLock };
+        g_warmConhost = std::move(warm);
+    }
+    CATCH_LOG()
 
-            const wchar_t* const pwszGuid{ wsGuid.data() + 1 };
+    void ConhostConnection::Start()
+    {
+        // If a matching conhost has been prewarmed, adopt it instead of
+        // paying for process spawn plus conhost initialization on the
+        // new-tab path.
+        {
+            std::lock_guard<std::mutex> lock{ g_warmConhostLock };
+            if (g_warmConhost.has_value() &&
+                g_warmConhost->commandline == _commandline &&
+                g_warmConhost->startingDirectory == _startingDirectory)
+            {
+                WarmConhost warm{ std::move(*g_warmConhost) };
+                g_warmConhost.reset();
+
+                // The pooled conhost was launched with its own session
+                // identifier baked into WT_SESSION, so this connection takes
+                // over that identity.
+                _guid = warm.guid;
+                _inPipe = std::move(warm.inPipe);
+                _outPipe = std::move(warm.outPipe);
+                _signalPipe = std::move(warm.signalPipe);
+                _outputRingSection = std::move(warm.outputRingSection);
+                _outputRingDataReady = std::move(warm.outputRingDataReady);
+                _outputRingSpaceAvailable = std::move(warm.outputRingSpaceAvailable);
+                _piConhost = std::move(warm.piConhost);
+                _hJob = std::move(warm.hJob);
+
+                // Create our own output handling thread
+                // Each connection needs to make sure to drain the output from its backing host.
+                _hOutputThread.reset(CreateThread(nullptr,
+                                                  0,
+                                                  StaticOutputThreadProc,
+                                                  this,
+                                                  0,
+                                                  nullptr));
+
+                // The conhost is already running; it just might be the wrong size.
+                if (warm.rows != _initialRows || warm.cols != _initialCols)
+                {
+                    SignalResizeWindow(_signalPipe.get(),
+                                       Utils::ClampToShortMax(_initialCols, 1),
+                                       Utils::ClampToShortMax(_initialRows, 1));
+                }
 
-            // Ensure every connection has the unique identifier in the environment.
-            extraEnvVars.emplace(L"WT_SESSION", pwszGuid);
+                _connected = true;
+                return;
+            }
         }
 
-        THROW_IF_FAILED(
-            CreateConPty(cmdline,
-                         startingDirectory,
-                         static_cast<short>(_initialCols),
-                         static_cast<short>(_initialRows),
-                         &_inPipe,
-                         &_outPipe,
-                         &_signalPipe,
-                         &_piConhost,
-                         CREATE_SUSPENDED,
-                         extraEnvVars));
-
-        _hJob.reset(CreateJobObjectW(nullptr, nullptr));
-        THROW_LAST_ERROR_IF_NULL(_hJob);
-
-        // We want the conhost and all associated descendant processes
-        // to be terminated when the tab is closed. GUI applications
-        // spawned from the shell tend to end up in their own jobs.
-        JOBOBJECT_EXTENDED_LIMIT_INFORMATION jobExtendedInformation{};
-        jobExtendedInformation.BasicLimitInformation.LimitFlags =
-            JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
-
-        THROW_IF_WIN32_BOOL_FALSE(SetInformationJobObject(_hJob.get(),
-                                                          JobObjectExtendedLimitInformation,
-                                                          &jobExtendedInformation,
-                                                          sizeof(jobExtendedInformation)));
+        std::wstring cmdline{ _commandline.c_str() };
+        std::optional<std::wstring> startingDirectory;
+        if (!_startingDirectory.empty())
+        {
+            startingDirectory = _startingDirectory;
+        }
 
-        THROW_IF_WIN32_BOOL_FALSE(AssignProcessToJobObject(_hJob.get(), _piConhost.hProcess));
+        _SpawnConhost(cmdline,
+                      startingDirectory,
+                      _initialRows,
+                      _initialCols,
+                      _guid,
+                      _inPipe,
+                      _outPipe,
+                      _signalPipe,
+                      _outputRingSection,
+                      _outputRingDataReady,
+                      _outputRingSpaceAvailable,
+                      _piConhost,
+                      _hJob);
 
         // Create our own output handling thread
         // Each connection needs to make sure to drain the output from its backing host.
@@ -171,6 +377,12 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
             WaitForSingleObject(_hOutputThread.get(), INFINITE);
             _hOutputThread.reset();
+
+            // The output thread uses these raw, so they only go away after
+            // it's been joined.
+            _outputRingSection.reset();
+            _outputRingDataReady.reset();
+            _outputRingSpaceAvailable.reset();
         }
     }
 
@@ -182,36 +394,146 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
     DWORD ConhostConnection::_OutputThread()
     {
-        const size_t bufferSize = 4096;
-        BYTE buffer[bufferSize];
-        DWORD dwRead;
+        // A fast producer fills a 4KB read instantly and each chunk costs an
+        // event round trip, so read into a large heap buffer and drain
+        // everything the transport has before delivering it, handing all
+        // currently available data to the handlers in one call.
+        // The conhost was launched in the binary frame VtIoMode, so the
+        // stream is packed records (see conpty-binary.h), not UTF-8 text.
+        // Each byte is widened into one wchar_t to cross the winrt event
+        // boundary; TerminalCore narrows them back and applies the records.
+        // Unlike UTF-8, chunk boundaries need no special care - the record
+        // framing tolerates arbitrary splits.
+        const DWORD bufferSize = 128 * 1024;
+        std::unique_ptr<char[]> buffer = std::make_unique<char[]>(bufferSize);
+        UINT64 cbTotalRead = 0; // lifetime bytes delivered, for the latency markers
+
+        // If a shared-memory ring was negotiated at spawn, frames arrive
+        // there instead of on the pipe - map it and wait on its data event.
+        // The ring has no notion of EOF, so the wait also watches the conhost
+        // process itself.
+        ConptyRing::Consumer ring;
+        wil::unique_handle hConhost;
+        bool fUseRing = false;
+        if (_outputRingSection)
+        {
+            fUseRing = SUCCEEDED(LOG_IF_FAILED(ring.Initialize(_outputRingSection.get(),
+                                                               _outputRingDataReady.get(),
+                                                               _outputRingSpaceAvailable.get())));
+
+            // Take our own reference to the process - Close() releases
+            // _piConhost while this thread may still be waiting on it.
+            if (fUseRing)
+            {
+                fUseRing = !!DuplicateHandle(GetCurrentProcess(),
+                                             _piConhost.hProcess,
+                                             GetCurrentProcess(),
+                                             &hConhost,
+                                             SYNCHRONIZE,
+                                             FALSE,
+                                             0);
+            }
+        }
+
         while (true)
         {
-            dwRead = 0;
-            bool fSuccess = false;
+            DWORD cbAvailable = 0;
 
-            fSuccess = !!ReadFile(_outPipe.get(), buffer, bufferSize, &dwRead, nullptr);
-            if (!fSuccess)
+            if (fUseRing)
             {
-                if (_closing.load())
+                DWORD dwRead = 0;
+                while (dwRead == 0)
                 {
-                    // This is okay, break out to kill the thread
-                    return 0;
+                    dwRead = static_cast<DWORD>(ring.Read(buffer.get(), bufferSize));
+                    if (dwRead > 0)
+                    {
+                        break;
+                    }
+
+                    const HANDLE waits[2] = { _outputRingDataReady.get(), hConhost.get() };
+                    const DWORD waitResult = WaitForMultipleObjects(2, waits, FALSE, INFINITE);
+                    if (_closing.load())
+                    {
+                        // This is okay, break out to kill the thread
+                        return 0;
+                    }
+                    if (waitResult == WAIT_OBJECT_0 + 1 || waitResult == WAIT_FAILED)
+                    {
+                        // conhost exited. Deliver whatever it published
+                        // before dying; once the ring is empty, we're done.
+                        dwRead = static_cast<DWORD>(ring.Read(buffer.get(), bufferSize));
+                        if (dwRead == 0)
+                        {
+                            _disconnectHandlers();
+                            return (DWORD)-1;
+                        }
+                        break;
+                    }
                 }
-                else
+                cbAvailable = dwRead;
+            }
+            else
+            {
+                DWORD dwRead = 0;
+                bool fSuccess = false;
+
+                fSuccess = !!ReadFile(_outPipe.get(), buffer.get(), bufferSize, &dwRead, nullptr);
+                if (!fSuccess)
+                {
+                    if (_closing.load())
+                    {
+                        // This is okay, break out to kill the thread
+                        return 0;
+                    }
+                    else
+                    {
+                        _disconnectHandlers();
+                        return (DWORD)-1;
+                    }
+                }
+                if (dwRead == 0)
+                {
+                    continue;
+                }
+
+                cbAvailable = dwRead;
+
+                // Aggregate whatever else has already arrived so one event covers it.
+                DWORD cbWaiting = 0;
+                while (cbAvailable < bufferSize &&
+                       PeekNamedPipe(_outPipe.get(), nullptr, 0, nullptr, &cbWaiting, nullptr) &&
+                       cbWaiting > 0)
                 {
-                    _disconnectHandlers();
-                    return (DWORD)-1;
+                    DWORD dwExtra = 0;
+                    if (!ReadFile(_outPipe.get(), buffer.get() + cbAvailable, bufferSize - cbAvailable, &dwExtra, nullptr) ||
+                        dwExtra == 0)
+                    {
+                        break;
+                    }
+                    cbAvailable += dwExtra;
                 }
             }
-            if (dwRead == 0)
+
+            // Widen each stream byte into one UTF-16 code unit. This is not
+            // a text conversion - it's how the raw record bytes survive the
+            // hstring event payload unchanged.
+            std::wstring wide(cbAvailable, L'\0');
+            for (DWORD i = 0; i < cbAvailable; i++)
+            {
+                wide[i] = static_cast<wchar_t>(static_cast<unsigned char>(buffer[i]));
+            }
+            winrt::hstring hstr{ wide };
+
+            cbTotalRead += cbAvailable;
+            if (TraceLoggingProviderEnabled(g_hTerminalConnectionProvider, WINEVENT_LEVEL_INFO, 0))
             {
-                continue;
+                TraceLoggingWrite(
+                    g_hTerminalConnectionProvider,
+                    "ConptyOutputRead",
+                    TraceLoggingUInt64(cbAvailable, "bytes"),
+                    TraceLoggingUInt64(cbTotalRead, "totalBytes"),
+                    TraceLoggingLevel(WINEVENT_LEVEL_INFO));
             }
-            // Convert buffer to hstring
-            char* pchStr = (char*)(buffer);
-            std::string str{ pchStr, dwRead };
-            auto hstr = winrt::to_hstring(str);
 
             // Pass the output to our registered event handlers
             _outputHandlers(hstr);
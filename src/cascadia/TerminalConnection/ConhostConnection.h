@@ -11,6 +11,8 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     {
         ConhostConnection(const hstring& cmdline, const hstring& startingDirectory, const uint32_t rows, const uint32_t cols, const guid& guid);
 
+        static void PrewarmConhost(const hstring& cmdline, const hstring& startingDirectory, const uint32_t rows, const uint32_t cols);
+
         winrt::event_token TerminalOutput(TerminalConnection::TerminalOutputEventArgs const& handler);
         void TerminalOutput(winrt::event_token const& token) noexcept;
         winrt::event_token TerminalDisconnected(TerminalConnection::TerminalDisconnectedEventArgs const& handler);
@@ -38,6 +40,12 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         wil::unique_hfile _inPipe; // The pipe for writing input to
         wil::unique_hfile _outPipe; // The pipe for reading output from
         wil::unique_hfile _signalPipe;
+        // The shared-memory output ring negotiated at spawn, if any. When
+        // these are valid, output arrives through the ring and _outPipe is
+        // only the fallback/liveness channel.
+        wil::unique_handle _outputRingSection;
+        wil::unique_handle _outputRingDataReady;
+        wil::unique_handle _outputRingSpaceAvailable;
         wil::unique_handle _hOutputThread;
         wil::unique_process_information _piConhost;
         wil::unique_handle _hJob;
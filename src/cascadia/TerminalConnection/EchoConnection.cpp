@@ -7,12 +7,31 @@
 
 #include "EchoConnection.g.cpp"
 
+using namespace std::chrono;
+
+// Each generator iteration aims for roughly this many UTF-16 code units.
+static constexpr size_t GeneratorChunkChars = 4096;
+
 namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 {
     EchoConnection::EchoConnection()
     {
     }
 
+    // Method Description:
+    // - Constructs an echo connection that, once started, produces synthetic
+    //   output instead of waiting for typed input. This gives a reproducible
+    //   load for benchmarking the TermControl -> Terminal -> Renderer
+    //   pipeline without spawning a real client process.
+    // Arguments:
+    // - generator: which flavor of synthetic output to produce.
+    // - bytesPerSecond: target output rate. 0 means unthrottled.
+    EchoConnection::EchoConnection(TerminalConnection::EchoLoadGenerator generator, uint32_t bytesPerSecond) :
+        _generator{ generator },
+        _bytesPerSecond{ bytesPerSecond }
+    {
+    }
+
     winrt::event_token EchoConnection::TerminalOutput(TerminalConnection::TerminalOutputEventArgs const& handler)
     {
         return _outputHandlers.add(handler);
@@ -36,6 +55,168 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
     void EchoConnection::Start()
     {
+        if (_generator != TerminalConnection::EchoLoadGenerator::None)
+        {
+            _generatorStart = steady_clock::now();
+            _hGeneratorThread.reset(CreateThread(nullptr,
+                                                 0,
+                                                 StaticGeneratorThreadProc,
+                                                 this,
+                                                 0,
+                                                 nullptr));
+            THROW_LAST_ERROR_IF_NULL(_hGeneratorThread.get());
+        }
+    }
+
+    DWORD WINAPI EchoConnection::StaticGeneratorThreadProc(LPVOID lpParameter)
+    {
+        EchoConnection* const pInstance = static_cast<EchoConnection*>(lpParameter);
+        return pInstance->_GeneratorThread();
+    }
+
+    // Method Description:
+    // - Builds one chunk of synthetic output for the configured generator.
+    // Arguments:
+    // - iteration: a counter the generators use to vary their output, so
+    //   frames and colors don't degenerate into identical repeated chunks.
+    // Return Value:
+    // - the chunk to push through the output handlers.
+    std::wstring EchoConnection::_GenerateChunk(const uint64_t iteration)
+    {
+        std::wstring chunk;
+        chunk.reserve(GeneratorChunkChars);
+
+        switch (_generator)
+        {
+        case TerminalConnection::EchoLoadGenerator::TextFirehose:
+        {
+            // Plain printable text with occasional newlines - parser fast
+            // path, no escape sequences at all.
+            static const std::wstring_view line{ L"the quick brown fox jumps over the lazy dog 0123456789 " };
+            while (chunk.size() + line.size() < GeneratorChunkChars)
+            {
+                chunk.append(line);
+                if (chunk.size() % 7 == 0)
+                {
+                    chunk.append(L"\r\n");
+                }
+            }
+            break;
+        }
+        case TerminalConnection::EchoLoadGenerator::ColorStorm:
+        {
+            // A new SGR sequence before every word; stresses attribute run
+            // handling and the state machine's CSI dispatch.
+            uint64_t color = iteration;
+            while (chunk.size() + 24 < GeneratorChunkChars)
+            {
+                chunk.append(L"\x1b[38;5;");
+                chunk.append(std::to_wstring(color % 256));
+                chunk.append(L"mstorm ");
+                ++color;
+            }
+            chunk.append(L"\x1b[m\r\n");
+            break;
+        }
+        case TerminalConnection::EchoLoadGenerator::TuiRepaint:
+        {
+            // Home the cursor and repaint the whole screen each iteration,
+            // like a full-screen TUI redrawing at speed.
+            const auto rows = _rows.load();
+            const auto cols = _cols.load();
+            const auto fill = gsl::narrow_cast<wchar_t>(L'!' + (iteration % 64));
+            chunk.append(L"\x1b[H");
+            for (uint32_t row = 0; row < rows; ++row)
+            {
+                chunk.append(cols, fill);
+                if (row + 1 < rows)
+                {
+                    chunk.append(L"\r\n");
+                }
+            }
+            break;
+        }
+        case TerminalConnection::EchoLoadGenerator::ScrollStorm:
+        {
+            // Short numbered lines, every one of which scrolls the buffer.
+            uint64_t lineNumber = iteration * 1000;
+            while (chunk.size() + 32 < GeneratorChunkChars)
+            {
+                chunk.append(L"scroll storm line ");
+                chunk.append(std::to_wstring(lineNumber));
+                chunk.append(L"\r\n");
+                ++lineNumber;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        return chunk;
+    }
+
+    // Method Description:
+    // - Generator thread body. Produces chunks at the configured rate until
+    //   the connection closes, timing each dispatch into the output handlers
+    //   and keeping running throughput counters for GetBenchmarkReport.
+    // Return Value:
+    // - 0 when the connection is closed.
+    DWORD EchoConnection::_GeneratorThread()
+    {
+        uint64_t iteration = 0;
+
+        while (!_closing.load())
+        {
+            const auto chunk = _GenerateChunk(iteration);
+            ++iteration;
+
+            const auto dispatchStart = steady_clock::now();
+            _outputHandlers(hstring{ chunk });
+            const uint64_t dispatchMicros = duration_cast<microseconds>(steady_clock::now() - dispatchStart).count();
+
+            _charsGenerated += chunk.size();
+            ++_chunksGenerated;
+            _handlerMicrosTotal += dispatchMicros;
+            if (dispatchMicros > _handlerMicrosMax.load())
+            {
+                _handlerMicrosMax = dispatchMicros;
+            }
+
+            if (_bytesPerSecond > 0)
+            {
+                // Pace to the requested rate, counting UTF-16 storage bytes.
+                const auto chunkBytes = chunk.size() * sizeof(wchar_t);
+                const auto millis = (chunkBytes * 1000) / _bytesPerSecond;
+                Sleep(gsl::narrow_cast<DWORD>(std::min<uint64_t>(millis, 1000)));
+            }
+        }
+
+        return 0;
+    }
+
+    // Method Description:
+    // - Reports what the generator has pushed so far: throughput and the
+    //   time spent inside the output handler chain per chunk. The handler
+    //   time is the synchronous cost of handing output to the control (its
+    //   staging and backpressure), which is the end-to-end piece visible
+    //   from the connection; frame completion is timed by the renderer.
+    // Return Value:
+    // - a human-readable multi-line report.
+    hstring EchoConnection::GetBenchmarkReport()
+    {
+        const auto chars = _charsGenerated.load();
+        const auto chunks = _chunksGenerated.load();
+        const auto totalMicros = _handlerMicrosTotal.load();
+        const double seconds = duration<double>(steady_clock::now() - _generatorStart).count();
+
+        std::wstringstream report;
+        report << L"elapsed: " << seconds << L" s\r\n";
+        report << L"chars: " << chars << L" (" << (seconds > 0 ? chars / seconds : 0) << L" chars/s)\r\n";
+        report << L"chunks: " << chunks << L"\r\n";
+        report << L"handler time avg: " << (chunks > 0 ? totalMicros / chunks : 0) << L" us";
+        report << L", max: " << _handlerMicrosMax.load() << L" us\r\n";
+        return hstring{ report.str() };
     }
 
     void EchoConnection::WriteInput(hstring const& data)
@@ -61,14 +242,19 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
     void EchoConnection::Resize(uint32_t rows, uint32_t columns)
     {
-        rows;
-        columns;
-
-        throw hresult_not_implemented();
+        _rows = rows;
+        _cols = columns;
     }
 
     void EchoConnection::Close()
     {
-        throw hresult_not_implemented();
+        if (!_closing.exchange(true))
+        {
+            if (_hGeneratorThread)
+            {
+                WaitForSingleObject(_hGeneratorThread.get(), INFINITE);
+                _hGeneratorThread.reset();
+            }
+        }
     }
 }
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "EchoConnection.g.h"
 
 namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
@@ -10,6 +12,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     struct EchoConnection : EchoConnectionT<EchoConnection>
     {
         EchoConnection();
+        EchoConnection(TerminalConnection::EchoLoadGenerator generator, uint32_t bytesPerSecond);
 
         winrt::event_token TerminalOutput(TerminalConnection::TerminalOutputEventArgs const& handler);
         void TerminalOutput(winrt::event_token const& token) noexcept;
@@ -20,8 +23,32 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         void Resize(uint32_t rows, uint32_t columns);
         void Close();
 
+        hstring GetBenchmarkReport();
+
     private:
         winrt::event<TerminalConnection::TerminalOutputEventArgs> _outputHandlers;
+
+        // Load generator configuration and state. The generator runs on its
+        // own thread and pushes synthetic output through the same handler
+        // path a real connection would, so the whole control/terminal/render
+        // pipeline is exercised without spawning a process.
+        TerminalConnection::EchoLoadGenerator _generator{ TerminalConnection::EchoLoadGenerator::None };
+        uint32_t _bytesPerSecond{ 0 };
+        std::atomic<bool> _closing{ false };
+        std::atomic<uint32_t> _rows{ 30 };
+        std::atomic<uint32_t> _cols{ 80 };
+        wil::unique_handle _hGeneratorThread;
+
+        // Benchmark counters, updated only by the generator thread.
+        std::chrono::steady_clock::time_point _generatorStart;
+        std::atomic<uint64_t> _charsGenerated{ 0 };
+        std::atomic<uint64_t> _chunksGenerated{ 0 };
+        std::atomic<uint64_t> _handlerMicrosTotal{ 0 };
+        std::atomic<uint64_t> _handlerMicrosMax{ 0 };
+
+        static DWORD WINAPI StaticGeneratorThreadProc(LPVOID lpParameter);
+        DWORD _GeneratorThread();
+        std::wstring _GenerateChunk(const uint64_t iteration);
     };
 }
 
@@ -8,10 +8,25 @@
 #include <unicode.hpp>
 #include <Utf16Parser.hpp>
 #include <WinUser.h>
+#include <Psapi.h>
 #include "..\..\types\inc\GlyphWidth.hpp"
 
 #include "TermControl.g.cpp"
 
+#include <TraceLoggingProvider.h>
+#include <winmeta.h>
+#include <telemetry\ProjectTelemetry.h>
+
+// Conpty latency instrumentation: the "terminal parse" stage of the conpty
+// output pipeline. See tools\conptylatency for the consumer that lines
+// these markers up with the connection- and conhost-side events.
+TRACELOGGING_DEFINE_PROVIDER(
+    g_hTerminalControlProvider,
+    "Microsoft.Windows.Terminal.Control",
+    // {20b99b57-f58c-4024-998d-bcbcd3b7ff09}
+    (0x20b99b57, 0xf58c, 0x4024, 0x99, 0x8d, 0xbc, 0xbc, 0xd3, 0xb7, 0xff, 0x09),
+    TraceLoggingOptionMicrosoftTelemetry());
+
 using namespace ::Microsoft::Console::Types;
 using namespace ::Microsoft::Terminal::Core;
 using namespace winrt::Windows::UI::Xaml;
@@ -19,6 +34,16 @@ using namespace winrt::Windows::UI::Core;
 using namespace winrt::Windows::System;
 using namespace winrt::Microsoft::Terminal::Settings;
 
+// Once this much text is pending for the parser, the connection output
+// handler blocks instead of queueing more. It runs on the connection's reader
+// thread, so blocking it pauses pipe reads and lets the pipe's own buffer
+// throttle a flooding client while the UI catches up.
+static constexpr size_t PendingOutputCapInBytes = 1024 * 1024;
+
+// Pastes longer than this are streamed to the connection in chunks of this
+// size from a background thread rather than written in one blocking call.
+static constexpr size_t PasteChunkLength = 4096;
+
 namespace winrt::Microsoft::Terminal::TerminalControl::implementation
 {
     TermControl::TermControl() :
@@ -39,8 +64,15 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         _actualFont{ DEFAULT_FONT_FACE.c_str(), 0, 10, { 0, DEFAULT_FONT_SIZE }, CP_UTF8, false },
         _touchAnchor{ std::nullopt },
         _leadingSurrogate{},
-        _cursorTimer{}
+        _cursorTimer{ nullptr }
     {
+        // Register the provider once for the lifetime of the module.
+        static const bool providerRegistered = []() {
+            TraceLoggingRegister(g_hTerminalControlProvider);
+            return true;
+        }();
+        UNREFERENCED_PARAMETER(providerRegistered);
+
         _Create();
     }
 
@@ -448,7 +480,7 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         _renderEngine = std::move(dxEngine);
 
         auto onRecieveOutputFn = [this](const hstring str) {
-            _terminal->Write(str.c_str());
+            _ConnectionOutputHandler(str);
         };
         _connectionOutputEventToken = _connection.TerminalOutput(onRecieveOutputFn);
 
@@ -536,16 +568,13 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         int blinkTime = GetCaretBlinkTime();
         if (blinkTime != INFINITE)
         {
-            // Create a timer
-            _cursorTimer = std::make_optional(DispatcherTimer());
-            _cursorTimer.value().Interval(std::chrono::milliseconds(blinkTime));
-            _cursorTimer.value().Tick({ this, &TermControl::_BlinkCursor });
-            _cursorTimer.value().Start();
+            _cursorBlinkInterval = std::chrono::milliseconds(blinkTime);
+            _StartCursorBlink();
         }
         else
         {
             // The user has disabled cursor blinking
-            _cursorTimer = std::nullopt;
+            _cursorBlinkInterval = std::chrono::milliseconds(0);
         }
 
         _gotFocusRevoker = _controlRoot.GotFocus(winrt::auto_revoke, { this, &TermControl::_GotFocusHandler });
@@ -627,6 +656,14 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
             return;
         }
 
+        // An in-flight streamed paste owns Esc: pressing it drops the rest
+        // of the paste instead of sending the key through to the app.
+        if (e.OriginalKey() == VirtualKey::Escape && _CancelStreamedPaste())
+        {
+            e.Handled(true);
+            return;
+        }
+
         auto modifiers = _GetPressedModifierKeys();
 
         const auto vkey = static_cast<WORD>(e.OriginalKey());
@@ -650,12 +687,15 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
                                               WI_IsFlagSet(modifiers, KeyModifiers::Alt),
                                               WI_IsFlagSet(modifiers, KeyModifiers::Shift));
 
-            if (_cursorTimer.has_value())
+            if (_cursorBlinkInterval.count() > 0)
             {
                 // Manually show the cursor when a key is pressed. Restarting
                 // the timer prevents flickering.
-                _terminal->SetCursorVisible(true);
-                _cursorTimer.value().Start();
+                {
+                    auto lock = _terminal->LockForWriting();
+                    _terminal->SetCursorVisible(true);
+                }
+                _StartCursorBlink();
             }
         }
 
@@ -721,9 +761,9 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
                 // paste selection, otherwise
                 else
                 {
-                    // attach TermControl::_SendInputToConnection() as the clipboardDataHandler.
+                    // attach TermControl::_SendPastedTextToConnection() as the clipboardDataHandler.
                     // This is called when the clipboard data is loaded.
-                    auto clipboardDataHandler = std::bind(&TermControl::_SendInputToConnection, this, std::placeholders::_1);
+                    auto clipboardDataHandler = std::bind(&TermControl::_SendPastedTextToConnection, this, std::placeholders::_1);
                     auto pasteArgs = winrt::make_self<PasteFromClipboardEventArgs>(clipboardDataHandler);
 
                     // send paste event up to TermApp
@@ -775,26 +815,19 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
 
             const float dy = newTouchPoint.Y - anchor.Y;
 
-            // If we've moved more than one row of text, we'll want to scroll the viewport
-            if (std::abs(dy) > fontHeight)
-            {
-                // Multiply by -1, because moving the touch point down will
-                // create a positive delta, but we want the viewport to move up,
-                // so we'll need a negative scroll amount (and the inverse for
-                // panning down)
-                const float numRows = -1.0f * (dy / fontHeight);
-
-                const auto currentOffset = this->GetScrollOffset();
-                const double newValue = (numRows) + (currentOffset);
+            // Multiply by -1, because moving the touch point down will
+            // create a positive delta, but we want the viewport to move up,
+            // so we'll need a negative scroll amount (and the inverse for
+            // panning down)
+            const float numRows = -1.0f * (dy / fontHeight);
 
-                // Clear our expected scroll offset. The viewport will now move
-                //      in response to our user input.
-                _lastScrollOffset = std::nullopt;
-                _scrollBar.Value(static_cast<int>(newValue));
+            // Stage the (possibly fractional) rows for the next coalesced
+            // apply. The accumulator carries sub-row remainders across
+            // events, so slow pans still add up to whole rows eventually.
+            _StageScrollDelta(numRows);
 
-                // Use this point as our new scroll anchor.
-                _touchAnchor = newTouchPoint;
-            }
+            // Use this point as our new scroll anchor.
+            _touchAnchor = newTouchPoint;
         }
         args.Handled(true);
     }
@@ -904,26 +937,74 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
     // - mouseDelta: the mouse wheel delta that triggered this event.
     void TermControl::_MouseScrollHandler(const double mouseDelta)
     {
-        const auto currentOffset = this->GetScrollOffset();
-
         // negative = down, positive = up
         // However, for us, the signs are flipped.
-        const auto rowDelta = mouseDelta < 0 ? 1.0 : -1.0;
-
         // TODO: Should we be getting some setting from the system
         //      for number of lines scrolled?
         // With one of the precision mouses, one click is always a multiple of 120,
-        // but the "smooth scrolling" mode results in non-int values
+        // but the "smooth scrolling" mode results in non-int values - dividing
+        // out WHEEL_DELTA keeps those fractional, and the staging accumulator
+        // carries the remainder rather than rounding each event.
 
-        // Conhost seems to use four lines at a time, so we'll emulate that for now.
-        double newValue = (4 * rowDelta) + (currentOffset);
+        // Conhost seems to use four lines per wheel notch, so we'll emulate
+        // that for now.
+        const auto rowDelta = -(mouseDelta / WHEEL_DELTA) * 4.0;
 
-        // Clear our expected scroll offset. The viewport will now move in
-        //      response to our user input.
-        _lastScrollOffset = std::nullopt;
-        // The scroll bar's ValueChanged handler will actually move the viewport
-        //      for us.
-        _scrollBar.Value(static_cast<int>(newValue));
+        _StageScrollDelta(rowDelta);
+    }
+
+    // Method Description:
+    // - Accumulates a scroll delta (in rows, possibly fractional) and
+    //   schedules a single coalesced apply on the dispatcher. Inertial
+    //   scrolling can deliver dozens of wheel or touch events per frame;
+    //   staging them here means the terminal's write lock is taken and a
+    //   redraw triggered once per UI tick instead of once per event.
+    // Arguments:
+    // - rowDelta: the number of rows to scroll, negative for up.
+    void TermControl::_StageScrollDelta(const double rowDelta)
+    {
+        _pendingScrollRows += rowDelta;
+
+        if (!_scrollApplyPending)
+        {
+            _scrollApplyPending = true;
+            // Low priority, so every scroll event already in the queue lands
+            // in the accumulator before we run.
+            _root.Dispatcher().RunAsync(CoreDispatcherPriority::Low, [this]() {
+                _ApplyPendingScroll();
+            });
+        }
+    }
+
+    // Method Description:
+    // - Applies whatever scroll delta has accumulated since the last apply.
+    //   Only the whole rows are consumed; any fractional remainder stays in
+    //   the accumulator for the next batch of input.
+    // Arguments:
+    // - <none>
+    void TermControl::_ApplyPendingScroll()
+    {
+        _scrollApplyPending = false;
+
+        if (_closing)
+        {
+            return;
+        }
+
+        const auto wholeRows = static_cast<int>(_pendingScrollRows);
+        _pendingScrollRows -= wholeRows;
+
+        if (wholeRows != 0)
+        {
+            const auto newValue = this->GetScrollOffset() + wholeRows;
+
+            // Clear our expected scroll offset. The viewport will now move in
+            //      response to our user input.
+            _lastScrollOffset = std::nullopt;
+            // The scroll bar's ValueChanged handler will actually move the
+            //      viewport for us.
+            _scrollBar.Value(newValue);
+        }
     }
 
     void TermControl::_ScrollbarChangeHandler(Windows::Foundation::IInspectable const& sender,
@@ -1003,9 +1084,9 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         }
         _focused = true;
 
-        if (_cursorTimer.has_value())
+        if (_cursorBlinkInterval.count() > 0)
         {
-            _cursorTimer.value().Start();
+            _StartCursorBlink();
         }
     }
 
@@ -1021,18 +1102,323 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         }
         _focused = false;
 
-        if (_cursorTimer.has_value())
+        if (_cursorBlinkInterval.count() > 0)
         {
-            _cursorTimer.value().Stop();
+            _StopCursorBlink();
+            auto lock = _terminal->LockForWriting();
             _terminal->SetCursorVisible(false);
         }
     }
 
+    // Method Description:
+    // - Stages a chunk of connection output and feeds everything staged to the
+    //   terminal parser in a single pass. If another thread is already
+    //   draining, the chunk is simply left for it; that drain's loop will
+    //   pick the chunk up. This bounds terminal lock traffic to one
+    //   acquisition per drained batch no matter how finely the connection
+    //   chunks its output.
+    // Arguments:
+    // - str: the utf-16 string from the connection to feed to the terminal.
+    void TermControl::_ConnectionOutputHandler(const hstring& str)
+    {
+        {
+            std::unique_lock<std::mutex> queueLock{ _pendingOutputMutex };
+            _pendingOutput.append(str);
+
+            // Flow control: if a drain is already running and the backlog has
+            // grown past the cap, hold this thread here until the drain works
+            // the backlog back down. See PendingOutputCapInBytes above.
+            while (_drainingOutput && _pendingOutput.size() * sizeof(wchar_t) >= PendingOutputCapInBytes)
+            {
+                _pendingOutputDrained.wait(queueLock);
+            }
+
+            if (_drainingOutput)
+            {
+                return;
+            }
+            _drainingOutput = true;
+        }
+
+        // Write everything queued. More output may land while we're parsing,
+        // so loop until the queue is observed empty; each iteration hands the
+        // terminal one batch covering every chunk staged so far, which is
+        // where the lock amortization comes from (Terminal::Write acquires
+        // the write lock internally, once per batch).
+        std::wstring toWrite;
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> queueLock{ _pendingOutputMutex };
+                if (_pendingOutput.empty())
+                {
+                    _drainingOutput = false;
+                    break;
+                }
+                toWrite.swap(_pendingOutput);
+            }
+
+            // The backlog just emptied; release any reader thread parked in
+            // the flow-control wait so it can resume pulling from its pipe.
+            _pendingOutputDrained.notify_all();
+
+            if (TraceLoggingProviderEnabled(g_hTerminalControlProvider, WINEVENT_LEVEL_INFO, 0))
+            {
+                TraceLoggingWrite(
+                    g_hTerminalControlProvider,
+                    "TerminalWriteText",
+                    TraceLoggingUInt64(gsl::narrow_cast<UINT64>(toWrite.size()), "chars"),
+                    TraceLoggingLevel(WINEVENT_LEVEL_INFO));
+            }
+
+            if (_debugHudVisible.load(std::memory_order_relaxed))
+            {
+                // Time the parse batch for the HUD's lock-wait/parse column.
+                static const double nsPerTick = []() {
+                    LARGE_INTEGER frequency;
+                    QueryPerformanceFrequency(&frequency);
+                    return 1.0e9 / static_cast<double>(frequency.QuadPart);
+                }();
+
+                LARGE_INTEGER start;
+                LARGE_INTEGER stop;
+                QueryPerformanceCounter(&start);
+                _terminal->Write(toWrite);
+                QueryPerformanceCounter(&stop);
+
+                _hudWriteNs.fetch_add(static_cast<uint64_t>((stop.QuadPart - start.QuadPart) * nsPerTick), std::memory_order_relaxed);
+                _hudWriteBatches.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                _terminal->Write(toWrite);
+            }
+            _hudWcharsParsed.fetch_add(toWrite.size(), std::memory_order_relaxed);
+            toWrite.clear();
+        }
+    }
+
+    // Method Description:
+    // - Shows or hides the performance HUD overlaid on the top-right of the
+    //   terminal. While visible, a timer samples the renderer's frame count,
+    //   the connection output queue, the parse counters, and process memory
+    //   twice a second and paints the numbers into a TextBlock floating over
+    //   the swap chain. Hidden, the only residual cost is one relaxed
+    //   atomic add per drained output batch.
+    void TermControl::ToggleDebugHud()
+    {
+        if (_closing)
+        {
+            return;
+        }
+
+        if (!_debugHudText)
+        {
+            Controls::TextBlock hud;
+            hud.FontFamily(Media::FontFamily{ L"Consolas" });
+            hud.FontSize(12);
+            hud.Foreground(Media::SolidColorBrush{ winrt::Windows::UI::Color{ 255, 0, 255, 0 } });
+            hud.HorizontalAlignment(HorizontalAlignment::Right);
+            hud.VerticalAlignment(VerticalAlignment::Top);
+            hud.Margin(Thickness{ 0, 0, 8, 0 });
+            hud.IsHitTestVisible(false);
+            Controls::Grid::SetColumn(hud, 0);
+            _root.Children().Append(hud);
+            _debugHudText = hud;
+
+            _debugHudTimer = DispatcherTimer{};
+            _debugHudTimer.Interval(std::chrono::milliseconds(500));
+            _debugHudTimer.Tick([weakThis = get_weak()](auto&& /*s*/, auto&& /*e*/) {
+                if (auto control{ weakThis.get() })
+                {
+                    control->_UpdateDebugHud();
+                }
+            });
+        }
+
+        const bool visible = !_debugHudVisible.load(std::memory_order_relaxed);
+        _debugHudVisible.store(visible, std::memory_order_relaxed);
+
+        if (visible)
+        {
+            // Re-baseline the deltas so the first tick doesn't report the
+            // accumulation from before the HUD was turned on.
+            _hudLastFrameCount = _renderer ? _renderer->GetFramesPainted() : 0;
+            _hudLastWcharsParsed = _hudWcharsParsed.load(std::memory_order_relaxed);
+            _hudLastWriteNs = _hudWriteNs.load(std::memory_order_relaxed);
+            _hudLastWriteBatches = _hudWriteBatches.load(std::memory_order_relaxed);
+            _hudLastSampleTime = std::chrono::steady_clock::now();
+
+            _debugHudText.Visibility(Visibility::Visible);
+            _debugHudTimer.Start();
+        }
+        else
+        {
+            _debugHudTimer.Stop();
+            _debugHudText.Visibility(Visibility::Collapsed);
+        }
+    }
+
+    // Method Description:
+    // - One HUD timer tick: samples every counter, converts the deltas since
+    //   the previous tick into rates, and rewrites the overlay text. Runs on
+    //   the UI thread.
+    void TermControl::_UpdateDebugHud()
+    {
+        if (_closing || !_debugHudVisible.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const double elapsedSec = std::chrono::duration<double>(now - _hudLastSampleTime).count();
+        if (elapsedSec <= 0.0)
+        {
+            return;
+        }
+
+        const uint32_t frames = _renderer ? _renderer->GetFramesPainted() : 0;
+        const uint64_t wchars = _hudWcharsParsed.load(std::memory_order_relaxed);
+        const uint64_t writeNs = _hudWriteNs.load(std::memory_order_relaxed);
+        const uint64_t writeBatches = _hudWriteBatches.load(std::memory_order_relaxed);
+
+        const double fps = (frames - _hudLastFrameCount) / elapsedSec;
+        const double parseMBPerSec = ((wchars - _hudLastWcharsParsed) * sizeof(wchar_t)) / (1024.0 * 1024.0) / elapsedSec;
+        const double msPerBatch = (writeBatches > _hudLastWriteBatches) ?
+                                      (writeNs - _hudLastWriteNs) / 1.0e6 / (writeBatches - _hudLastWriteBatches) :
+                                      0.0;
+
+        size_t queuedBytes = 0;
+        {
+            std::lock_guard<std::mutex> queueLock{ _pendingOutputMutex };
+            queuedBytes = _pendingOutput.size() * sizeof(wchar_t);
+        }
+
+        // Working set is per-process, not per-tab - every tab shares the
+        // process - but the trend while switching tabs is still diagnostic.
+        double workingSetMiB = 0.0;
+        PROCESS_MEMORY_COUNTERS pmc = { 0 };
+        pmc.cb = sizeof(pmc);
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        {
+            workingSetMiB = pmc.WorkingSetSize / (1024.0 * 1024.0);
+        }
+
+        wchar_t text[256];
+        swprintf_s(text,
+                   L"%6.1f fps
+%6.2f MB/s parse
+%6zu KiB queued
+%6.2f ms/batch
+%6.1f MiB working set",
+                   fps,
+                   parseMBPerSec,
+                   queuedBytes / 1024,
+                   msPerBatch,
+                   workingSetMiB);
+        _debugHudText.Text(text);
+
+        _hudLastFrameCount = frames;
+        _hudLastWcharsParsed = wchars;
+        _hudLastWriteNs = writeNs;
+        _hudLastWriteBatches = writeBatches;
+        _hudLastSampleTime = now;
+    }
+
     void TermControl::_SendInputToConnection(const std::wstring& wstr)
     {
         _connection.WriteInput(wstr);
     }
 
+    // Method Description:
+    // - Sends pasted text to the connection. Small pastes go straight
+    //   through; anything larger is handed to a background thread that
+    //   streams it in chunks, so a multi-megabyte paste can't stall the UI
+    //   thread while the input pipe backs up. Keystrokes typed mid-paste are
+    //   written between chunks and therefore land ahead of the remaining
+    //   paste data; Esc drops whatever hasn't been sent yet.
+    // Arguments:
+    // - wstr: the pasted text.
+    void TermControl::_SendPastedTextToConnection(const std::wstring& wstr)
+    {
+        // Write small pastes directly - the streaming machinery would be
+        // pure overhead for them.
+        if (wstr.size() <= PasteChunkLength)
+        {
+            _SendInputToConnection(wstr);
+            return;
+        }
+
+        bool startStreamer = false;
+        {
+            std::lock_guard<std::mutex> pasteGuard(_pasteMutex);
+            // Queue behind any paste already in flight.
+            _pasteBuffer.append(wstr);
+            if (!_pasteInProgress)
+            {
+                _pasteInProgress = true;
+                startStreamer = true;
+            }
+        }
+
+        if (startStreamer)
+        {
+            // The strong reference keeps us alive until the streamer drains.
+            std::thread([strongThis = get_strong()]() {
+                strongThis->_StreamPasteProc();
+            }).detach();
+        }
+    }
+
+    // Method Description:
+    // - Background thread body for streamed pastes. Writes the staged data to
+    //   the connection one chunk at a time until it's exhausted or cancelled.
+    //   WriteInput blocks when the pipe is full, which is exactly what
+    //   throttles us to the rate the client is actually reading.
+    // Arguments:
+    // - <none>
+    void TermControl::_StreamPasteProc()
+    {
+        while (true)
+        {
+            std::wstring chunk;
+            {
+                std::lock_guard<std::mutex> pasteGuard(_pasteMutex);
+                if (_pasteCancelRequested || _closing || _pasteOffset >= _pasteBuffer.size())
+                {
+                    _pasteBuffer.clear();
+                    _pasteOffset = 0;
+                    _pasteCancelRequested = false;
+                    _pasteInProgress = false;
+                    return;
+                }
+
+                chunk = _pasteBuffer.substr(_pasteOffset, PasteChunkLength);
+                _pasteOffset += chunk.size();
+            }
+
+            _SendInputToConnection(chunk);
+        }
+    }
+
+    // Method Description:
+    // - Requests cancellation of a streamed paste, dropping whatever hasn't
+    //   been written to the connection yet.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - true if a paste was in flight and has been told to stop.
+    bool TermControl::_CancelStreamedPaste()
+    {
+        std::lock_guard<std::mutex> pasteGuard(_pasteMutex);
+        if (_pasteInProgress)
+        {
+            _pasteCancelRequested = true;
+            return true;
+        }
+        return false;
+    }
+
     // Method Description:
     // - Update the font with the renderer. This will be called either when the
     //      font changes or the DPI changes, as DPI changes will necessitate a
@@ -1063,11 +1449,41 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
             return;
         }
 
-        auto lock = _terminal->LockForWriting();
-
+        // Stage the dimensions and defer the reflow. A window drag or pane
+        // split delivers a burst of SizeChanged events; only the last size
+        // in the burst matters, and resizing the buffer and conpty for the
+        // intermediate ones is pure waste.
         const auto foundationSize = e.NewSize();
+        _pendingResizeWidth = foundationSize.Width;
+        _pendingResizeHeight = foundationSize.Height;
 
-        _DoResize(foundationSize.Width, foundationSize.Height);
+        if (!_resizeApplyPending)
+        {
+            _resizeApplyPending = true;
+            _root.Dispatcher().RunAsync(CoreDispatcherPriority::Low, [this]() {
+                _ApplyPendingResize();
+            });
+        }
+    }
+
+    // Method Description:
+    // - Performs the resize staged by _SwapChainSizeChanged, once, with the
+    //   newest dimensions seen. Runs at low dispatcher priority so every
+    //   SizeChanged event already queued lands in the staging members first.
+    // Arguments:
+    // - <none>
+    void TermControl::_ApplyPendingResize()
+    {
+        _resizeApplyPending = false;
+
+        if (_closing || !_initializedTerminal)
+        {
+            return;
+        }
+
+        auto lock = _terminal->LockForWriting();
+
+        _DoResize(_pendingResizeWidth, _pendingResizeHeight);
     }
 
     void TermControl::_SwapChainScaleChanged(Windows::UI::Xaml::Controls::SwapChainPanel const& sender,
@@ -1081,15 +1497,53 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         _renderer->TriggerRedrawAll();
     }
 
+    // Method Description:
+    // - (Re)arms the cursor blink timer on the threadpool. The tick holds
+    //   only a weak reference, so a fire racing teardown resolves to nothing
+    //   instead of touching a dead control.
+    void TermControl::_StartCursorBlink()
+    {
+        if (_cursorBlinkInterval.count() == 0)
+        {
+            return;
+        }
+
+        _StopCursorBlink();
+
+        auto weakThis{ get_weak() };
+        _cursorTimer = Windows::System::Threading::ThreadPoolTimer::CreatePeriodicTimer(
+            [weakThis](auto&& /*timer*/) {
+                if (auto control{ weakThis.get() })
+                {
+                    control->_CursorBlinkTick();
+                }
+            },
+            _cursorBlinkInterval);
+    }
+
+    // Method Description:
+    // - Cancels the cursor blink timer, if one is running.
+    void TermControl::_StopCursorBlink()
+    {
+        if (_cursorTimer)
+        {
+            _cursorTimer.Cancel();
+            _cursorTimer = nullptr;
+        }
+    }
+
     // Method Description:
     // - Toggle the cursor on and off when called by the cursor blink timer.
-    // Arguments:
-    // - sender: not used
-    // - e: not used
-    void TermControl::_BlinkCursor(Windows::Foundation::IInspectable const& /* sender */,
-                                   Windows::Foundation::IInspectable const& /* e */)
+    //   Runs on a threadpool thread - the UI thread never wakes for a blink.
+    void TermControl::_CursorBlinkTick()
     {
-        if ((_closing) || (!_terminal->IsCursorBlinkingAllowed() && _terminal->IsCursorVisible()))
+        if (_closing)
+        {
+            return;
+        }
+
+        auto lock = _terminal->LockForWriting();
+        if (!_terminal->IsCursorBlinkingAllowed() && _terminal->IsCursorVisible())
         {
             return;
         }
@@ -1131,9 +1585,20 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         }
     }
 
+    // Method Description:
+    // - Latch the given title as the pending one and make sure a flush is
+    //      scheduled. A fast output stream can retitle the window hundreds of
+    //      times a second; the latch collapses all of them into at most one
+    //      UI-thread work item, which publishes only the newest value.
+    // Arguments:
+    // - wstr: the new title.
     void TermControl::_TerminalTitleChanged(const std::wstring_view& wstr)
     {
-        _titleChangedHandlers(winrt::hstring{ wstr });
+        {
+            std::lock_guard<std::mutex> lock{ _pendingUiUpdateMutex };
+            _pendingTitle = winrt::hstring{ wstr };
+        }
+        _ScheduleUiUpdate();
     }
 
     // Method Description:
@@ -1174,14 +1639,75 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
                                                      const int viewHeight,
                                                      const int bufferSize)
     {
-        // Update our scrollbar
-        _scrollBar.Dispatcher().RunAsync(CoreDispatcherPriority::Low, [=]() {
-            _ScrollbarUpdater(_scrollBar, viewTop, viewHeight, bufferSize);
+        // Set this value as our next expected scroll position. This has to
+        //      happen here, on the calling thread, so an internally-triggered
+        //      scrollbar change that lands before the flush still matches.
+        _lastScrollOffset = { viewTop };
+
+        // Latch the newest position; the flush will move the scrollbar and
+        //      raise ScrollPositionChanged once with it. When output is
+        //      scrolling quickly only the final position matters, so the
+        //      intermediate ones never reach the UI thread at all.
+        {
+            std::lock_guard<std::mutex> lock{ _pendingUiUpdateMutex };
+            _pendingScrollBarUpdate = { { viewTop, viewHeight, bufferSize } };
+        }
+        _ScheduleUiUpdate();
+    }
+
+    // Method Description:
+    // - Schedule a single dispatcher work item to flush the pending title and
+    //      scrollbar state, if one isn't already queued. Runs at Low priority,
+    //      so a burst of updates between two UI ticks lands as one flush.
+    void TermControl::_ScheduleUiUpdate()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ _pendingUiUpdateMutex };
+            if (_uiUpdatePending)
+            {
+                return;
+            }
+            _uiUpdatePending = true;
+        }
+
+        Dispatcher().RunAsync(CoreDispatcherPriority::Low, [weakThis = get_weak()]() {
+            if (auto control{ weakThis.get() })
+            {
+                control->_FlushPendingUiUpdates();
+            }
         });
+    }
 
-        // Set this value as our next expected scroll position.
-        _lastScrollOffset = { viewTop };
-        _scrollPositionChangedHandlers(viewTop, viewHeight, bufferSize);
+    // Method Description:
+    // - UI thread: take whatever the output thread latched since the last
+    //      flush and publish it - update the scrollbar and raise the public
+    //      events once, with the newest values.
+    void TermControl::_FlushPendingUiUpdates()
+    {
+        std::optional<winrt::hstring> title;
+        std::optional<ScrollBarUpdate> scroll;
+        {
+            std::lock_guard<std::mutex> lock{ _pendingUiUpdateMutex };
+            title.swap(_pendingTitle);
+            scroll.swap(_pendingScrollBarUpdate);
+            _uiUpdatePending = false;
+        }
+
+        if (_closing)
+        {
+            return;
+        }
+
+        if (title)
+        {
+            _titleChangedHandlers(*title);
+        }
+
+        if (scroll)
+        {
+            _ScrollbarUpdater(_scrollBar, scroll->viewTop, scroll->viewHeight, scroll->bufferSize);
+            _scrollPositionChangedHandlers(scroll->viewTop, scroll->viewHeight, scroll->bufferSize);
+        }
     }
 
     hstring TermControl::Title()
@@ -1217,10 +1743,16 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
             _connection.TerminalOutput(_connectionOutputEventToken);
 
             // Clear out the cursor timer, so it doesn't trigger again on us once we're destructed.
-            if (auto localCursorTimer{ std::exchange(_cursorTimer, std::nullopt) })
+            // A tick already in flight holds a weak reference and bails on _closing.
+            if (auto localCursorTimer{ std::exchange(_cursorTimer, nullptr) })
+            {
+                localCursorTimer.Cancel();
+            }
+
+            _debugHudVisible.store(false, std::memory_order_relaxed);
+            if (auto localHudTimer{ std::exchange(_debugHudTimer, nullptr) })
             {
-                localCursorTimer->Stop();
-                // cursorTimer timer, now stopped, is destroyed.
+                localHudTimer.Stop();
             }
 
             if (auto localConnection{ std::exchange(_connection, nullptr) })
@@ -1247,6 +1779,213 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         }
     }
 
+
+    // The recycle pool. Closed controls that still have a healthy D3D
+    // device, swap chain and XAML tree park here - detached from their
+    // connection and reset - until the next tab or pane needs one, so
+    // scripted pane layouts don't pay GPU initialization per split.
+    // Guarded by s_recyclePoolLock.
+    static std::mutex s_recyclePoolLock;
+    static std::vector<winrt::Microsoft::Terminal::TerminalControl::TermControl> s_recyclePool;
+    static constexpr size_t RecyclePoolCap = 4;
+
+    // Method Description:
+    // - Hands out a recycled control rebound to the given settings if the
+    //   pool has one, or constructs a fresh control otherwise. Callers treat
+    //   the result exactly like a newly constructed control - all the
+    //   per-tab/per-pane event handlers need registering either way.
+    // Arguments:
+    // - settings: the settings to create or rebind the control with.
+    // Return Value:
+    // - a control ready to be placed in the UI tree.
+    TerminalControl::TermControl TermControl::GetRecycledOrCreate(Microsoft::Terminal::Settings::IControlSettings const& settings)
+    {
+        TerminalControl::TermControl control{ nullptr };
+        {
+            std::lock_guard<std::mutex> lock{ s_recyclePoolLock };
+            if (!s_recyclePool.empty())
+            {
+                control = s_recyclePool.back();
+                s_recyclePool.pop_back();
+            }
+        }
+
+        if (control)
+        {
+            winrt::get_self<TermControl>(control)->_RebindForRecycle(settings);
+            return control;
+        }
+
+        return winrt::make<TermControl>(settings);
+    }
+
+    // Method Description:
+    // - Offers a control that's being discarded to the recycle pool instead
+    //   of tearing it down. If the control can't be detached (it never
+    //   initialized, or it's already closing) or the pool is full, it closes
+    //   for real - callers never need a fallback path.
+    // Arguments:
+    // - control: the control being discarded.
+    // Return Value:
+    // - <none>
+    void TermControl::ReturnForRecycle(TerminalControl::TermControl const& control)
+    {
+        if (!control)
+        {
+            return;
+        }
+
+        if (!winrt::get_self<TermControl>(control)->_TryDetachForRecycle())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ s_recyclePoolLock };
+        if (s_recyclePool.size() < RecyclePoolCap)
+        {
+            s_recyclePool.push_back(control);
+        }
+        else
+        {
+            // Pool's full - this one tears down for real.
+            control.Close();
+        }
+    }
+
+    // Method Description:
+    // - Unhooks this control from its connection and resets the terminal so
+    //   the control can be parked in the recycle pool. The renderer, DX
+    //   engine (and its D3D device), swap chain and XAML tree all stay
+    //   alive - they're the expensive parts recycling exists to keep.
+    // Return Value:
+    // - true if the control is detached and safe to pool; false if it should
+    //   just be closed instead.
+    bool TermControl::_TryDetachForRecycle()
+    {
+        if (_closing || !_initializedTerminal)
+        {
+            return false;
+        }
+
+        // Stop accepting output, then drop the old connection entirely.
+        _connection.TerminalOutput(_connectionOutputEventToken);
+        if (auto localConnection{ std::exchange(_connection, nullptr) })
+        {
+            localConnection.Close();
+        }
+
+        _CancelStreamedPaste();
+        {
+            std::lock_guard<std::mutex> lock{ _pendingOutputMutex };
+            _pendingOutput.clear();
+        }
+
+        _StopCursorBlink();
+        SuspendRendering();
+
+        // Handlers the previous tab/pane registered must not fire for the
+        // next session - everything is re-registered on reuse.
+        _ClearEventHandlers();
+
+        _terminal->ResetForConnectionReuse();
+        return true;
+    }
+
+    // Method Description:
+    // - The counterpart to _TryDetachForRecycle: applies the new settings,
+    //   spins up a fresh connection and starts painting again. Mirrors the
+    //   tail of _InitializeTerminal, minus everything that survived in the
+    //   recycled control.
+    // Arguments:
+    // - settings: the settings for the control's next life.
+    void TermControl::_RebindForRecycle(Settings::IControlSettings settings)
+    {
+        _settings = settings;
+        _ApplyUISettings();
+        _terminal->UpdateSettings(_settings);
+        _UpdateFont();
+
+        _ApplyConnectionSettings();
+        _connection.TerminalDisconnected([=]() {
+            _connectionClosedHandlers();
+        });
+        auto onRecieveOutputFn = [this](const hstring str) {
+            _ConnectionOutputHandler(str);
+        };
+        _connectionOutputEventToken = _connection.TerminalOutput(onRecieveOutputFn);
+
+        // The terminal kept its dimensions through the reset; size the new
+        // connection to match. The usual SizeChanged path takes over once
+        // the control lands in its new layout.
+        const auto vp = _terminal->GetViewport();
+        _connection.Resize(vp.Height(), vp.Width());
+
+        ResumeRendering();
+        _connection.Start();
+    }
+
+    // Method Description:
+    // - Drops every handler registered on our projected events. winrt::event
+    //   offers no clear(), so each one is destroyed and reconstructed in
+    //   place; tokens the old subscribers still hold become harmless no-ops
+    //   to remove.
+    void TermControl::_ClearEventHandlers()
+    {
+        auto clearEvent = [](auto& ev) {
+            using TEvent = std::remove_reference_t<decltype(ev)>;
+            ev.~TEvent();
+            new (&ev) TEvent{};
+        };
+
+        clearEvent(_titleChangedHandlers);
+        clearEvent(_connectionClosedHandlers);
+        clearEvent(_scrollPositionChangedHandlers);
+        clearEvent(_clipboardCopyHandlers);
+        clearEvent(_clipboardPasteHandlers);
+    }
+
+    // Method Description:
+    // - Pauses this control's render thread and asks the graphics driver to
+    //   reclaim its idle GPU memory. The terminal keeps parsing connection
+    //   output the whole time, so the buffer stays current; we just stop
+    //   painting frames nobody can see. Intended for controls in background
+    //   tabs - call ResumeRendering before the control is shown again.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - <none>
+    void TermControl::SuspendRendering()
+    {
+        if (_closing || !_initializedTerminal || _renderSuspended)
+        {
+            return;
+        }
+
+        _renderSuspended = true;
+        _renderer->WaitForPaintCompletionAndDisable(INFINITE);
+        _renderEngine->Trim();
+    }
+
+    // Method Description:
+    // - Restarts the render thread after a SuspendRendering and invalidates
+    //   everything, so the first frame after a tab switch repaints the full
+    //   viewport with whatever the terminal parsed while we were hidden.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - <none>
+    void TermControl::ResumeRendering()
+    {
+        if (_closing || !_initializedTerminal || !_renderSuspended)
+        {
+            return;
+        }
+
+        _renderSuspended = false;
+        _renderer->EnablePainting();
+        _renderer->TriggerRedrawAll();
+    }
+
     void TermControl::ScrollViewport(int viewTop)
     {
         _terminal->UserScrollViewport(viewTop);
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <condition_variable>
+
 #include "TermControl.g.h"
 #include "PasteFromClipboardEventArgs.g.h"
 #include <winrt/Microsoft.Terminal.TerminalConnection.h>
@@ -49,10 +51,16 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         int GetScrollOffset();
         int GetViewHeight() const;
 
+        void SuspendRendering();
+        void ResumeRendering();
+        void ToggleDebugHud();
+
         void SwapChainChanged();
         ~TermControl();
 
         static Windows::Foundation::Point GetProposedDimensions(Microsoft::Terminal::Settings::IControlSettings const& settings, const uint32_t dpi);
+        static TerminalControl::TermControl GetRecycledOrCreate(Microsoft::Terminal::Settings::IControlSettings const& settings);
+        static void ReturnForRecycle(TerminalControl::TermControl const& control);
 
         // clang-format off
         // -------------------------------- WinRT Events ---------------------------------
@@ -76,11 +84,48 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
 
         std::unique_ptr<::Microsoft::Terminal::Core::Terminal> _terminal;
 
+        // Connection output is staged here and drained in one pass, so the
+        // terminal write lock is taken once per drain rather than once per
+        // connection chunk. Guarded by _pendingOutputMutex; _drainingOutput
+        // marks that some thread is already draining and appenders can just
+        // leave their data for it.
+        std::mutex _pendingOutputMutex;
+        std::wstring _pendingOutput;
+        bool _drainingOutput{ false };
+        std::condition_variable _pendingOutputDrained;
+
+        // Streamed paste state. Large pastes are chunked to the connection
+        // from a background thread so the UI thread never stalls on a
+        // backed-up input pipe; keystrokes written between chunks land in the
+        // pipe ahead of the remaining paste data. Guarded by _pasteMutex.
+        std::mutex _pasteMutex;
+        std::wstring _pasteBuffer;
+        size_t _pasteOffset{ 0 };
+        bool _pasteInProgress{ false };
+        bool _pasteCancelRequested{ false };
+
         std::unique_ptr<::Microsoft::Console::Render::Renderer> _renderer;
         std::unique_ptr<::Microsoft::Console::Render::DxEngine> _renderEngine;
 
+        // Performance HUD overlay. The TextBlock and its timer live on the
+        // UI thread; the counters below are written from the connection's
+        // output thread, hence the atomics. The _hudLast* shadows are the
+        // previous timer sample, UI thread only.
+        Windows::UI::Xaml::Controls::TextBlock _debugHudText{ nullptr };
+        Windows::UI::Xaml::DispatcherTimer _debugHudTimer{ nullptr };
+        std::atomic<bool> _debugHudVisible{ false };
+        std::atomic<uint64_t> _hudWcharsParsed{ 0 };
+        std::atomic<uint64_t> _hudWriteNs{ 0 };
+        std::atomic<uint64_t> _hudWriteBatches{ 0 };
+        uint32_t _hudLastFrameCount{ 0 };
+        uint64_t _hudLastWcharsParsed{ 0 };
+        uint64_t _hudLastWriteNs{ 0 };
+        uint64_t _hudLastWriteBatches{ 0 };
+        std::chrono::steady_clock::time_point _hudLastSampleTime;
+
         Settings::IControlSettings _settings;
         bool _focused;
+        bool _renderSuspended{ false };
         std::atomic<bool> _closing;
 
         FontInfoDesired _desiredFont;
@@ -88,10 +133,48 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
 
         std::optional<int> _lastScrollOffset;
 
+        // Title and scrollbar update coalescing. The connection's output
+        // thread latches the newest values here and schedules at most one
+        // low-priority dispatcher work item to publish them, so an output
+        // flood costs the UI thread one flush per tick instead of one work
+        // item per title or viewport change. Guarded by _pendingUiUpdateMutex.
+        struct ScrollBarUpdate
+        {
+            int viewTop;
+            int viewHeight;
+            int bufferSize;
+        };
+        std::mutex _pendingUiUpdateMutex;
+        std::optional<winrt::hstring> _pendingTitle;
+        std::optional<ScrollBarUpdate> _pendingScrollBarUpdate;
+        bool _uiUpdatePending{ false };
+
+        // Scroll input coalescing. Wheel and touch events stage fractional
+        // row deltas here and a single low-priority dispatcher callback
+        // applies the whole rows once per UI tick, carrying the remainder
+        // forward. Only ever touched from the UI thread.
+        double _pendingScrollRows{ 0.0 };
+        bool _scrollApplyPending{ false };
+
+        // Resize coalescing. SizeChanged events stage the newest dimensions
+        // here and a single low-priority callback performs the actual
+        // buffer/renderer/conpty resize, so a gesture that produces many
+        // layout passes (window drags, pane splits) reflows the terminal
+        // once with the final size instead of once per event. UI thread only.
+        double _pendingResizeWidth{ 0.0 };
+        double _pendingResizeHeight{ 0.0 };
+        bool _resizeApplyPending{ false };
+
         // storage location for the leading surrogate of a utf-16 surrogate pair
         std::optional<wchar_t> _leadingSurrogate;
 
-        std::optional<Windows::UI::Xaml::DispatcherTimer> _cursorTimer;
+        // Cursor blink runs on a threadpool timer so an idle tab never wakes
+        // the UI thread just to toggle the cursor; the toggle invalidates only
+        // the cursor cell and the DX engine repaints it from its saved
+        // under-image without reprocessing any text. An interval of zero
+        // means the user has disabled blinking.
+        Windows::System::Threading::ThreadPoolTimer _cursorTimer{ nullptr };
+        std::chrono::milliseconds _cursorBlinkInterval{ 0 };
 
         // If this is set, then we assume we are in the middle of panning the
         //      viewport via touch input.
@@ -106,6 +189,9 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         winrt::Windows::UI::Xaml::UIElement::GotFocus_revoker _gotFocusRevoker;
 
         void _Create();
+        bool _TryDetachForRecycle();
+        void _RebindForRecycle(Settings::IControlSettings settings);
+        void _ClearEventHandlers();
         void _ApplyUISettings();
         void _InitializeBackgroundBrush();
         void _BackgroundColorChanged(const uint32_t color);
@@ -122,15 +208,27 @@ namespace winrt::Microsoft::Terminal::TerminalControl::implementation
         void _GotFocusHandler(Windows::Foundation::IInspectable const& sender, Windows::UI::Xaml::RoutedEventArgs const& e);
         void _LostFocusHandler(Windows::Foundation::IInspectable const& sender, Windows::UI::Xaml::RoutedEventArgs const& e);
 
-        void _BlinkCursor(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
+        void _StartCursorBlink();
+        void _StopCursorBlink();
+        void _CursorBlinkTick();
         void _SendInputToConnection(const std::wstring& wstr);
+        void _SendPastedTextToConnection(const std::wstring& wstr);
+        void _StreamPasteProc();
+        bool _CancelStreamedPaste();
+        void _ConnectionOutputHandler(const hstring& str);
         void _SwapChainSizeChanged(Windows::Foundation::IInspectable const& sender, Windows::UI::Xaml::SizeChangedEventArgs const& e);
         void _SwapChainScaleChanged(Windows::UI::Xaml::Controls::SwapChainPanel const& sender, Windows::Foundation::IInspectable const& args);
         void _DoResize(const double newWidth, const double newHeight);
         void _TerminalTitleChanged(const std::wstring_view& wstr);
         void _TerminalScrollPositionChanged(const int viewTop, const int viewHeight, const int bufferSize);
+        void _ScheduleUiUpdate();
+        void _FlushPendingUiUpdates();
+        void _UpdateDebugHud();
 
         void _MouseScrollHandler(const double delta);
+        void _StageScrollDelta(const double rowDelta);
+        void _ApplyPendingScroll();
+        void _ApplyPendingResize();
         void _MouseZoomHandler(const double delta);
         void _MouseTransparencyHandler(const double delta);
 
@@ -28,5 +28,6 @@
 #include <winrt/Windows.ui.xaml.media.h>
 #include <winrt/Windows.ui.xaml.media.imaging.h>
 #include <winrt/Windows.ui.xaml.input.h>
+#include <winrt/Windows.System.Threading.h>
 
 #include <windows.ui.xaml.media.dxinterop.h>
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../../terminal/adapter/DispatchTypes.hpp"
+#include "../../buffer/out/TextAttribute.hpp"
 
 namespace Microsoft::Terminal::Core
 {
@@ -13,13 +14,8 @@ namespace Microsoft::Terminal::Core
         virtual bool PrintString(std::wstring_view stringView) = 0;
         virtual bool ExecuteChar(wchar_t wch) = 0;
 
-        virtual bool SetTextToDefaults(bool foreground, bool background) = 0;
-        virtual bool SetTextForegroundIndex(BYTE colorIndex) = 0;
-        virtual bool SetTextBackgroundIndex(BYTE colorIndex) = 0;
-        virtual bool SetTextRgbColor(COLORREF color, bool foreground) = 0;
-        virtual bool BoldText(bool boldOn) = 0;
-        virtual bool UnderlineText(bool underlineOn) = 0;
-        virtual bool ReverseText(bool reversed) = 0;
+        virtual TextAttribute GetTextAttributes() const = 0;
+        virtual bool SetTextAttributes(const TextAttribute& attrs) = 0;
 
         virtual bool SetCursorPosition(short x, short y) = 0;
         virtual COORD GetCursorPosition() = 0;
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "ScrollbackPager.hpp"
+
+using namespace Microsoft::Terminal::Core;
+
+ScrollbackPager::ScrollbackPager(const size_t maxBytes) noexcept :
+    _pages{},
+    _maxBytes{ maxBytes },
+    _totalBytes{ 0 }
+{
+}
+
+// Method Description:
+// - Serializes a row that the circular buffer is about to recycle and appends
+//   it to the newest page, dropping the oldest pages if the store has grown
+//   past its byte budget.
+// Arguments:
+// - row - the row being evicted from the text buffer.
+void ScrollbackPager::AddEvictedRow(const ROW& row)
+{
+    const auto& charRow = row.GetCharRow();
+
+    Line line;
+    line.text = charRow.GetText();
+    line.wasWrapForced = charRow.WasWrapForced();
+
+    // Trailing blanks carry no text; the attribute runs below keep whatever
+    // coloring they had.
+    const auto lastGlyph = line.text.find_last_not_of(L' ');
+    line.text.erase(lastGlyph == std::wstring::npos ? 0 : lastGlyph + 1);
+
+    const auto& attrRow = row.GetAttrRow();
+    line.attrs.assign(attrRow.begin(), attrRow.end());
+
+    if (_pages.empty() || _pages.back().lines.size() >= LinesPerPage)
+    {
+        Page page;
+        page.lines.reserve(LinesPerPage);
+        _pages.push_back(std::move(page));
+    }
+
+    const size_t cbLine = _LineSizeInBytes(line);
+    _pages.back().lines.push_back(std::move(line));
+    _pages.back().sizeInBytes += cbLine;
+    _totalBytes += cbLine;
+
+    // Never drop the page still being filled, no matter how large a single
+    // line claims to be.
+    while (_totalBytes > _maxBytes && _pages.size() > 1)
+    {
+        _totalBytes -= _pages.front().sizeInBytes;
+        _pages.pop_front();
+    }
+}
+
+// Method Description:
+// - Discards all retained history, returning the store to its freshly
+//   constructed state. Used when the owning terminal is reset for reuse.
+void ScrollbackPager::Clear() noexcept
+{
+    _pages.clear();
+    _totalBytes = 0;
+}
+
+// Method Description:
+// - Returns the number of history lines currently retained.
+size_t ScrollbackPager::Size() const noexcept
+{
+    if (_pages.empty())
+    {
+        return 0;
+    }
+    return (_pages.size() - 1) * LinesPerPage + _pages.back().lines.size();
+}
+
+// Method Description:
+// - Retrieves a retained history line.
+// Arguments:
+// - index - 0 is the oldest retained line, Size() - 1 the newest.
+// Return Value:
+// - the line. Throws std::out_of_range for an index beyond Size().
+const ScrollbackPager::Line& ScrollbackPager::GetLine(const size_t index) const
+{
+    // Every page except the newest is full, so plain division finds the page.
+    const auto& page = _pages.at(index / LinesPerPage);
+    return page.lines.at(index % LinesPerPage);
+}
+
+// Method Description:
+// - Returns the approximate resident size of the retained history.
+size_t ScrollbackPager::SizeInBytes() const noexcept
+{
+    return _totalBytes;
+}
+
+// Method Description:
+// - Approximates the resident cost of one serialized line for budgeting.
+size_t ScrollbackPager::_LineSizeInBytes(const Line& line) noexcept
+{
+    return sizeof(Line) +
+           line.text.capacity() * sizeof(wchar_t) +
+           line.attrs.capacity() * sizeof(TextAttributeRun);
+}
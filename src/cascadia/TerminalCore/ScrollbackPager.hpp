@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "../../buffer/out/Row.hpp"
+
+namespace Microsoft::Terminal::Core
+{
+    class ScrollbackPager;
+}
+
+// A compact, paged store for rows that have been evicted from the circular
+// text buffer. The active screen and renderable scrollback stay in the hot
+// TextBuffer; this class retains what falls off the top of it in serialized
+// form (measured text plus attribute runs) at a small fraction of a live
+// ROW's footprint. Lines are appended to the newest page, and once the store
+// exceeds its byte budget whole pages are dropped from the front, so trimming
+// is O(1) and never repacks surviving history.
+class Microsoft::Terminal::Core::ScrollbackPager final
+{
+public:
+    // One line of history in serialized form.
+    struct Line
+    {
+        std::wstring text; // the row's text, trailing whitespace trimmed
+        std::vector<TextAttributeRun> attrs; // attribute runs covering the original row width
+        bool wasWrapForced; // whether the row wrapped into the next one
+    };
+
+    // Roughly 32MB of compact history per terminal before the oldest pages
+    // start falling away.
+    static const size_t DefaultMaxBytes = 32 * 1024 * 1024;
+
+    ScrollbackPager(const size_t maxBytes = DefaultMaxBytes) noexcept;
+
+    void AddEvictedRow(const ROW& row);
+    void Clear() noexcept;
+
+    size_t Size() const noexcept;
+    const Line& GetLine(const size_t index) const;
+    size_t SizeInBytes() const noexcept;
+
+private:
+    struct Page
+    {
+        std::vector<Line> lines;
+        size_t sizeInBytes = 0;
+    };
+
+    static const size_t LinesPerPage = 128;
+
+    static size_t _LineSizeInBytes(const Line& line) noexcept;
+
+    std::deque<Page> _pages;
+    size_t _maxBytes;
+    size_t _totalBytes;
+};
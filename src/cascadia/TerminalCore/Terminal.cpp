@@ -73,6 +73,18 @@ void Terminal::Create(COORD viewportSize, SHORT scrollbackLines, IRenderTarget&
     const TextAttribute attr{};
     const UINT cursorSize = 12;
     _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, renderTarget);
+
+    // Rows falling off the top of the circular buffer land in the compact
+    // paged history rather than vanishing.
+    _buffer->SetRowEvictionCallback([this](const ROW& row) noexcept {
+        try
+        {
+            _pagedHistory.AddEvictedRow(row);
+        }
+        CATCH_LOG();
+    });
+
+    _PublishRenderSnapshot();
 }
 
 // Method Description:
@@ -140,6 +152,54 @@ void Terminal::UpdateSettings(winrt::Microsoft::Terminal::Settings::ICoreSetting
     // remains at the bottom of the buffer.
 }
 
+// Method Description:
+// - Returns the terminal to a blank slate so the control hosting it can be
+//   recycled for a new connection: the buffer, paged history, title, selection
+//   and scroll position are cleared, the parser and input translator are
+//   reset, and conpty binary-mode detection restarts, since the next
+//   connection negotiates its transport anew. The viewport dimensions, color
+//   table and callbacks are deliberately kept - the new connection starts at
+//   the size and styling the control already has.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Terminal::ResetForConnectionReuse()
+{
+    auto lock = LockForWriting();
+
+    _buffer->Reset();
+    _buffer->GetCursor().SetPosition({ 0, 0 });
+    _pagedHistory.Clear();
+
+    _mutableViewport = Viewport::FromDimensions({ 0, 0 }, _mutableViewport.Dimensions());
+    _scrollOffset = 0;
+
+    _title.clear();
+    ClearSelection();
+
+    // A half-parsed sequence or a mode the previous client set (DECCKM and
+    // friends) must not leak into the next session.
+    _stateMachine->ResetState();
+    auto passAlongInput = [&](std::deque<std::unique_ptr<IInputEvent>>& inEventsToWrite) {
+        if (!_pfnWriteInput)
+        {
+            return;
+        }
+        std::wstring wstr = _KeyEventsToText(inEventsToWrite);
+        _pfnWriteInput(wstr);
+    };
+    _terminalInput = std::make_unique<TerminalInput>(passAlongInput);
+
+    _binaryFrameMode = BinaryFrameMode::Detecting;
+    _binaryFrameBytes.clear();
+    _binaryFrameBytes.shrink_to_fit();
+
+    _PublishRenderSnapshot();
+    _buffer->GetRenderTarget().TriggerRedrawAll();
+    _NotifyScrollEvent();
+}
+
 // Method Description:
 // - Resize the terminal as the result of some user interaction.
 // Arguments:
@@ -160,6 +220,12 @@ void Terminal::UpdateSettings(winrt::Microsoft::Terminal::Settings::ICoreSetting
 
     const short newBufferHeight = viewportSize.Y + _scrollbackLines;
     COORD bufferSize{ viewportSize.X, newBufferHeight };
+
+    // ResizeTraditional is incremental: it publishes the new width and each
+    // row reflows to it lazily the next time it's visited, so the viewport
+    // rows pay on the next paint and scrollback pays only if scrolled to.
+    // A height-only resize (the common case when dragging the bottom edge)
+    // therefore touches no row content at all - just the row count.
     RETURN_IF_FAILED(_buffer->ResizeTraditional(bufferSize));
 
     auto proposedTop = oldTop;
@@ -176,15 +242,67 @@ void Terminal::UpdateSettings(winrt::Microsoft::Terminal::Settings::ICoreSetting
     _scrollOffset = 0;
     _NotifyScrollEvent();
 
+    _PublishRenderSnapshot();
+
     return S_OK;
 }
 
 void Terminal::Write(std::wstring_view stringView)
 {
-    auto lock = LockForWriting();
+    // A conhost in the binary frame mode ships buffer deltas instead of VT
+    // text; those are applied directly, with no parsing. The stream's first
+    // output tells us which kind of conhost this is.
+    if (_binaryFrameMode != BinaryFrameMode::Text)
+    {
+        if (_HandleBinaryFrames(stringView))
+        {
+            return;
+        }
+    }
+
+    // Parse in bounded slices, dropping the write lock between them, so a
+    // render pass waiting in LockForReading is scheduled between slices
+    // instead of stalling for the whole parse of an arbitrarily large chunk.
+    // Slice boundaries are safe points: the state machine carries partial
+    // sequence state across calls (connection chunking already splits
+    // sequences arbitrarily), and the render snapshot is republished so a
+    // paint landing between slices sees a consistent frame.
+    static constexpr size_t WriteSliceLength = 4096;
+
+    size_t offset = 0;
+    while (offset < stringView.size())
+    {
+        const auto slice = stringView.substr(offset, WriteSliceLength);
+        offset += slice.size();
 
-    _stateMachine->ProcessString(stringView.data(), stringView.size());
+        auto lock = LockForWriting();
+        _stateMachine->ProcessString(slice.data(), slice.size());
+        _PublishRenderSnapshot();
+    }
+}
+
+// Method Description:
+// - Rebuilds and atomically publishes the immutable metadata snapshot served
+//   to the renderer; see RenderSnapshot in Terminal.hpp. Must be called with
+//   the write lock held (or before the terminal is shared with a renderer).
+void Terminal::_PublishRenderSnapshot() noexcept
+try
+{
+    auto snapshot = std::make_shared<RenderSnapshot>();
+
+    const auto& cursor = _buffer->GetCursor();
+    snapshot->cursorPosition = cursor.GetPosition();
+    snapshot->cursorVisible = cursor.IsVisible() && !cursor.IsPopupShown();
+    snapshot->cursorOn = cursor.IsOn();
+    snapshot->cursorHeight = cursor.GetSize();
+    snapshot->cursorStyle = cursor.GetType();
+    snapshot->cursorColor = cursor.GetColor();
+    snapshot->selectionRects = _GetSelectionRects();
+    snapshot->title = _title;
+
+    std::atomic_store(&_renderSnapshot, std::shared_ptr<const RenderSnapshot>{ std::move(snapshot) });
 }
+CATCH_LOG()
 
 // Method Description:
 // - Send this particular key event to the terminal. The terminal will translate
@@ -320,6 +438,11 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
     auto& cursor = _buffer->GetCursor();
     const Viewport bufferSize = _buffer->GetSize();
 
+    // The pending attribute is one packed value that only the dispatch can
+    // change, and never in the middle of a print - fetch it once per write
+    // instead of per character.
+    const TextAttribute attributes = _buffer->GetCurrentAttributes();
+
     for (size_t i = 0; i < stringView.size(); i++)
     {
         wchar_t wch = stringView[i];
@@ -353,7 +476,7 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
             // This is not great but I need it demoable. Fix by making a buffer stream writer.
             if (wch >= 0xD800 && wch <= 0xDFFF)
             {
-                OutputCellIterator it{ stringView.substr(i, 2), _buffer->GetCurrentAttributes() };
+                OutputCellIterator it{ stringView.substr(i, 2), attributes };
                 const auto end = _buffer->Write(it);
                 const auto cellDistance = end.GetCellDistance(it);
                 i += cellDistance - 1;
@@ -361,7 +484,7 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
             }
             else
             {
-                OutputCellIterator it{ stringView.substr(i, 1), _buffer->GetCurrentAttributes() };
+                OutputCellIterator it{ stringView.substr(i, 1), attributes };
                 const auto end = _buffer->Write(it);
                 const auto cellDistance = end.GetCellDistance(it);
                 proposedCursorPosition.X += gsl::narrow<SHORT>(cellDistance);
@@ -378,6 +501,13 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
                 proposedCursorPosition.Y--;
             }
             notifyScroll = true;
+
+            // Once the buffer is full the viewport top pins at its maximum
+            // and the block below never fires again, yet every cycle above
+            // slid the cold/hot boundary up one row. Re-sweep here so rows
+            // leaving the viewport keep moving into the cold tier for the
+            // whole life of the session, not just until the buffer fills.
+            _buffer->CompressScrollback(_mutableViewport.Top());
         }
 
         // This section is essentially equivalent to `AdjustCursorPosition`
@@ -394,6 +524,11 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
             {
                 _mutableViewport = Viewport::FromDimensions({ 0, gsl::narrow<short>(newViewTop) }, _mutableViewport.Dimensions());
                 notifyScroll = true;
+
+                // Everything above the mutable viewport is scrollback now;
+                // let the buffer pack those rows into its cold tier. They're
+                // rehydrated on demand if the user scrolls back up.
+                _buffer->CompressScrollback(_mutableViewport.Top());
             }
         }
 
@@ -413,6 +548,9 @@ void Terminal::UserScrollViewport(const int viewTop)
     // if viewTop > realTop, we want the offset to be 0.
 
     _scrollOffset = std::max(0, newDelta);
+
+    _PublishRenderSnapshot();
+
     _buffer->GetRenderTarget().TriggerRedrawAll();
 }
 
@@ -476,6 +614,8 @@ void Terminal::SetCursorVisible(const bool isVisible) noexcept
 {
     auto& cursor = _buffer->GetCursor();
     cursor.SetIsVisible(isVisible);
+
+    _PublishRenderSnapshot();
 }
 
 bool Terminal::IsCursorBlinkingAllowed() const noexcept
@@ -483,3 +623,19 @@ bool Terminal::IsCursorBlinkingAllowed() const noexcept
     const auto& cursor = _buffer->GetCursor();
     return cursor.IsBlinkingAllowed();
 }
+
+// Method Description:
+// - Returns the number of lines retained in the compact paged history.
+size_t Terminal::GetHistoryLineCount() const noexcept
+{
+    return _pagedHistory.Size();
+}
+
+// Method Description:
+// - Retrieves the text of a paged history line.
+// Arguments:
+// - index: 0 is the oldest retained line.
+std::wstring Terminal::GetHistoryLineText(const size_t index) const
+{
+    return _pagedHistory.GetLine(index).text;
+}
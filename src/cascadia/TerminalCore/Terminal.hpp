@@ -13,6 +13,7 @@
 #include "../../types/inc/Viewport.hpp"
 #include "../../cascadia/terminalcore/ITerminalApi.hpp"
 #include "../../cascadia/terminalcore/ITerminalInput.hpp"
+#include "ScrollbackPager.hpp"
 
 // You have to forward decl the ICoreSettings here, instead of including the header.
 // If you include the header, there will be compilation errors with other
@@ -45,6 +46,8 @@ public:
 
     void UpdateSettings(winrt::Microsoft::Terminal::Settings::ICoreSettings settings);
 
+    void ResetForConnectionReuse();
+
     // Write goes through the parser
     void Write(std::wstring_view stringView);
 
@@ -57,13 +60,8 @@ public:
     // These methods are defined in TerminalApi.cpp
     bool PrintString(std::wstring_view stringView) override;
     bool ExecuteChar(wchar_t wch) override;
-    bool SetTextToDefaults(bool foreground, bool background) override;
-    bool SetTextForegroundIndex(BYTE colorIndex) override;
-    bool SetTextBackgroundIndex(BYTE colorIndex) override;
-    bool SetTextRgbColor(COLORREF color, bool foreground) override;
-    bool BoldText(bool boldOn) override;
-    bool UnderlineText(bool underlineOn) override;
-    bool ReverseText(bool reversed) override;
+    TextAttribute GetTextAttributes() const override;
+    bool SetTextAttributes(const TextAttribute& attrs) override;
     bool SetCursorPosition(short x, short y) override;
     COORD GetCursorPosition() override;
     bool EraseCharacters(const unsigned int numChars) override;
@@ -117,6 +115,13 @@ public:
     void SetCursorVisible(const bool isVisible) noexcept;
     bool IsCursorBlinkingAllowed() const noexcept;
 
+#pragma region PagedScrollback
+    // Compact history retained beyond what the text buffer can scroll to;
+    // see ScrollbackPager. Callers should hold the read lock.
+    size_t GetHistoryLineCount() const noexcept;
+    std::wstring GetHistoryLineText(const size_t index) const;
+#pragma endregion
+
 #pragma region TextSelection
     // These methods are defined in TerminalSelection.cpp
     const bool IsSelectionActive() const noexcept;
@@ -153,11 +158,63 @@ private:
     SHORT _selectionAnchor_YOffset;
     SHORT _endSelectionPosition_YOffset;
 
+    // Cached selection rectangles, rebuilt only when the offset-adjusted
+    // endpoints or selection mode actually change. Render frames and mouse
+    // moves that don't move an endpoint reuse the buffer without touching
+    // it. Mutable because _GetSelectionRects is logically const.
+    mutable std::vector<SMALL_RECT> _selectionRectsCache;
+    mutable COORD _selectionRectsCacheAnchor{ 0, 0 };
+    mutable COORD _selectionRectsCacheEnd{ 0, 0 };
+    mutable bool _selectionRectsCacheBox{ false };
+    mutable bool _selectionRectsCacheValid{ false };
+
     std::shared_mutex _readWriteLock;
 
+    // An immutable snapshot of the metadata the renderer consumes (cursor,
+    // selection, title), republished by the writing thread at safe points:
+    // between parse slices in Write and after direct mutations. Because it is
+    // only ever swapped while the write lock is held, a reader holding the
+    // shared lock always sees the state from the most recent safe point and
+    // never a half-parsed intermediate frame.
+    struct RenderSnapshot
+    {
+        COORD cursorPosition;
+        bool cursorVisible;
+        bool cursorOn;
+        ULONG cursorHeight;
+        CursorType cursorStyle;
+        COLORREF cursorColor;
+        std::vector<SMALL_RECT> selectionRects;
+        std::wstring title;
+    };
+    std::shared_ptr<const RenderSnapshot> _renderSnapshot;
+
+    void _PublishRenderSnapshot() noexcept;
+
+    // Conpty binary frame mode (see conpty-binary.h). A conhost negotiated
+    // into the "binary" VtIoMode announces itself with a preamble no VT text
+    // stream can begin with; until the first output decides it, we buffer
+    // and probe. In Binary mode the connection's output bypasses the state
+    // machine entirely - the records are applied straight to the buffer by
+    // TerminalBinaryFrames.cpp, and only VtPassthrough payloads are parsed.
+    enum class BinaryFrameMode
+    {
+        Detecting,
+        Binary,
+        Text
+    };
+    BinaryFrameMode _binaryFrameMode{ BinaryFrameMode::Detecting };
+    std::string _binaryFrameBytes; // narrowed stream bytes not yet applied
+
+    // These methods are defined in TerminalBinaryFrames.cpp
+    bool _HandleBinaryFrames(const std::wstring_view stringView);
+    size_t _ApplyBinaryRecord(const char* const pRecord, const size_t cbAvailable);
+    void _ApplyBinaryScroll(const short delta);
+
     // TODO: These members are not shared by an alt-buffer. They should be
     //      encapsulated, such that a Terminal can have both a main and alt buffer.
     std::unique_ptr<TextBuffer> _buffer;
+    ScrollbackPager _pagedHistory;
     Microsoft::Console::Types::Viewport _mutableViewport;
     SHORT _scrollbackLines;
 
@@ -191,7 +248,7 @@ private:
 
 #pragma region TextSelection
     // These methods are defined in TerminalSelection.cpp
-    std::vector<SMALL_RECT> _GetSelectionRects() const;
+    const std::vector<SMALL_RECT>& _GetSelectionRects() const;
     const SHORT _ExpandWideGlyphSelectionLeft(const SHORT xPos, const SHORT yPos) const noexcept;
     const SHORT _ExpandWideGlyphSelectionRight(const SHORT xPos, const SHORT yPos) const noexcept;
 #pragma endregion
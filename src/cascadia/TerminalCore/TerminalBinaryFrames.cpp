@@ -0,0 +1,290 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "Terminal.hpp"
+#include "../../inc/conpty-binary.h"
+
+using namespace Microsoft::Terminal::Core;
+using namespace Microsoft::Console::ConptyBinary;
+using namespace Microsoft::Console::Types;
+
+// This file is the receiving half of the conpty binary frame mode (see
+//      conpty-binary.h). When the backing conhost negotiated the "binary"
+//      VtIoMode, its render engine ships packed cell runs, scrolls and cursor
+//      records instead of VT text, and the methods here apply them straight
+//      to our TextBuffer - the state machine only ever sees the contents of
+//      VtPassthrough records.
+
+// Method Description:
+// - Routes connection output while the transport may be (or already is) the
+//   binary frame stream. A binary conhost opens with a preamble whose first
+//   byte is NUL, which no VT text stream can produce, so the very first
+//   output tells us which kind of conhost we're attached to. The connection
+//   widens each stream byte into one wchar_t to cross the winrt event
+//   boundary; we narrow them back here.
+// Arguments:
+// - stringView: the new chunk of connection output.
+// Return Value:
+// - true if the chunk was consumed here; false if the stream turned out to be
+//   VT text and the caller should parse the chunk as usual.
+bool Terminal::_HandleBinaryFrames(const std::wstring_view stringView)
+{
+    if (_binaryFrameMode == BinaryFrameMode::Detecting &&
+        _binaryFrameBytes.empty() &&
+        !stringView.empty() &&
+        stringView.front() != L'\0')
+    {
+        // Definitely not the preamble - this is a VT text stream.
+        _binaryFrameMode = BinaryFrameMode::Text;
+        return false;
+    }
+
+    _binaryFrameBytes.reserve(_binaryFrameBytes.size() + stringView.size());
+    for (const auto wch : stringView)
+    {
+        _binaryFrameBytes.push_back(static_cast<char>(wch));
+    }
+
+    if (_binaryFrameMode == BinaryFrameMode::Detecting)
+    {
+        // The preamble could straddle chunks, so only compare what we have.
+        const size_t cbCompare = std::min(_binaryFrameBytes.size(), PreambleLength);
+        if (memcmp(_binaryFrameBytes.data(), Preamble, cbCompare) != 0)
+        {
+            // Started with NUL but isn't our preamble. Hand the bytes to the
+            //      parser the way they would have arrived.
+            _binaryFrameMode = BinaryFrameMode::Text;
+
+            std::wstring rewidened;
+            rewidened.reserve(_binaryFrameBytes.size());
+            for (const auto ch : _binaryFrameBytes)
+            {
+                rewidened.push_back(static_cast<wchar_t>(static_cast<unsigned char>(ch)));
+            }
+            _binaryFrameBytes.clear();
+            _binaryFrameBytes.shrink_to_fit();
+
+            auto lock = LockForWriting();
+            _stateMachine->ProcessString(rewidened.data(), rewidened.size());
+            _PublishRenderSnapshot();
+            return true;
+        }
+
+        if (_binaryFrameBytes.size() < PreambleLength)
+        {
+            // A matching prefix; wait for the rest of the preamble.
+            return true;
+        }
+
+        _binaryFrameMode = BinaryFrameMode::Binary;
+        _binaryFrameBytes.erase(0, PreambleLength);
+    }
+
+    // Apply every complete record, then keep the remainder of a record that
+    //      straddles this chunk for the next one.
+    size_t offset = 0;
+    {
+        auto lock = LockForWriting();
+        while (offset < _binaryFrameBytes.size())
+        {
+            const size_t cbConsumed = _ApplyBinaryRecord(_binaryFrameBytes.data() + offset,
+                                                         _binaryFrameBytes.size() - offset);
+            if (cbConsumed == 0)
+            {
+                break;
+            }
+            offset += cbConsumed;
+        }
+        _PublishRenderSnapshot();
+    }
+    _binaryFrameBytes.erase(0, offset);
+
+    return true;
+}
+
+// Method Description:
+// - Applies the first record in the given bytes to the buffer, if it's
+//   complete. Unknown record types are skipped by their declared size, so a
+//   newer conhost can add records without breaking us. Must be called with
+//   the write lock held.
+// Arguments:
+// - pRecord: the start of a record (header first).
+// - cbAvailable: how many bytes are available from pRecord.
+// Return Value:
+// - the total size of the record consumed, or 0 if the record is still
+//   incomplete and the caller should wait for more of the stream.
+size_t Terminal::_ApplyBinaryRecord(const char* const pRecord, const size_t cbAvailable)
+{
+    if (cbAvailable < sizeof(RecordHeader))
+    {
+        return 0;
+    }
+
+    RecordHeader header;
+    memcpy(&header, pRecord, sizeof(header));
+
+    const size_t cbRecord = sizeof(header) + header.cbPayload;
+    if (cbAvailable < cbRecord)
+    {
+        return 0;
+    }
+
+    const char* const pPayload = pRecord + sizeof(header);
+
+    switch (static_cast<RecordType>(header.Type))
+    {
+    case RecordType::BeginFrame:
+        // The frame's dimensions are advisory - resizes are negotiated over
+        //      the signal pipe before frames at the new size arrive.
+        break;
+
+    case RecordType::CellRun:
+    {
+        if (header.cbPayload < sizeof(CellRunPayload))
+        {
+            break;
+        }
+        CellRunPayload run;
+        memcpy(&run, pPayload, sizeof(run));
+
+        const size_t cbText = header.cbPayload - sizeof(run);
+        const size_t cchText = std::min<size_t>(run.cchText, cbText / sizeof(wchar_t));
+        if (cchText == 0)
+        {
+            break;
+        }
+        std::wstring text(cchText, L'\0');
+        memcpy(text.data(), pPayload + sizeof(run), cchText * sizeof(wchar_t));
+
+        TextAttribute attr;
+        attr.SetForeground(run.Foreground);
+        attr.SetBackground(run.Background);
+        if (WI_IsFlagSet(run.Flags, CellRunFlagBold))
+        {
+            attr.Embolden();
+        }
+
+        // The run's coordinates are viewport-relative, like everything the
+        //      engine paints.
+        const auto viewOrigin = _mutableViewport.Origin();
+        const COORD target{ run.X, gsl::narrow_cast<short>(viewOrigin.Y + run.Y) };
+        if (_buffer->GetSize().IsInBounds(target))
+        {
+            const OutputCellIterator it{ text, attr };
+            // TextBuffer::Write invalidates the painted region itself.
+            _buffer->Write(it, target);
+        }
+        break;
+    }
+
+    case RecordType::Scroll:
+    {
+        if (header.cbPayload < sizeof(ScrollPayload))
+        {
+            break;
+        }
+        ScrollPayload scroll;
+        memcpy(&scroll, pPayload, sizeof(scroll));
+        _ApplyBinaryScroll(scroll.Delta);
+        break;
+    }
+
+    case RecordType::CursorPosition:
+    {
+        if (header.cbPayload < sizeof(CursorPositionPayload))
+        {
+            break;
+        }
+        CursorPositionPayload pos;
+        memcpy(&pos, pPayload, sizeof(pos));
+        SetCursorPosition(pos.X, pos.Y);
+        break;
+    }
+
+    case RecordType::VtPassthrough:
+    {
+        if (header.cbPayload == 0)
+        {
+            break;
+        }
+        // Passthrough text is UTF-8, and record framing guarantees it's
+        //      never split mid-codepoint.
+        const int cchNeeded = MultiByteToWideChar(CP_UTF8,
+                                                  0,
+                                                  pPayload,
+                                                  gsl::narrow_cast<int>(header.cbPayload),
+                                                  nullptr,
+                                                  0);
+        if (cchNeeded > 0)
+        {
+            std::wstring wstr(cchNeeded, L'\0');
+            MultiByteToWideChar(CP_UTF8,
+                                0,
+                                pPayload,
+                                gsl::narrow_cast<int>(header.cbPayload),
+                                wstr.data(),
+                                cchNeeded);
+            _stateMachine->ProcessString(wstr.data(), wstr.size());
+        }
+        break;
+    }
+
+    case RecordType::EndFrame:
+        // Nothing to do - the caller publishes the render snapshot once the
+        //      whole batch of records has been applied.
+        break;
+
+    default:
+        break;
+    }
+
+    return cbRecord;
+}
+
+// Method Description:
+// - Applies a Scroll record: the emitter's viewport content moved up by
+//   -delta rows, with fresh rows entering at the bottom. We mirror what
+//   _WriteBuffer does when the cursor newlines past the viewport: slide our
+//   viewport down through the buffer (packing what falls behind into the
+//   scrollback pager), and once the viewport hits the bottom, cycle the
+//   buffer itself. The cursor keeps its viewport-relative position - the
+//   engine only sends a CursorPosition record when that changes.
+// Arguments:
+// - delta: rows the content moved; only negative (upward) deltas are sent.
+void Terminal::_ApplyBinaryScroll(const short delta)
+{
+    if (delta >= 0)
+    {
+        return;
+    }
+
+    auto& cursor = _buffer->GetCursor();
+    const short bufferHeight = _buffer->GetSize().Height();
+    for (short i = 0; i < -delta; i++)
+    {
+        if (_mutableViewport.BottomExclusive() >= bufferHeight)
+        {
+            // The viewport is pinned to the bottom; recycle the topmost row.
+            //      Content slides up underneath the cursor, which stays put.
+            _buffer->IncrementCircularBuffer();
+        }
+        else
+        {
+            _mutableViewport = Viewport::FromDimensions({ 0, gsl::narrow_cast<short>(_mutableViewport.Top() + 1) },
+                                                        _mutableViewport.Dimensions());
+
+            // The cursor rides along with the viewport.
+            COORD cursorPos = cursor.GetPosition();
+            cursorPos.Y = std::min(gsl::narrow_cast<short>(cursorPos.Y + 1), gsl::narrow_cast<short>(bufferHeight - 1));
+            cursor.SetPosition(cursorPos);
+
+            // Everything above the mutable viewport is scrollback now; let
+            //      the buffer pack those rows into its cold tier.
+            _buffer->CompressScrollback(_mutableViewport.Top());
+        }
+    }
+
+    _buffer->GetRenderTarget().TriggerRedrawAll();
+    _NotifyScrollEvent();
+}
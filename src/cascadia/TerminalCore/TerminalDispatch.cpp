@@ -25,9 +25,9 @@ void TerminalDispatch::Print(const wchar_t wchPrintable)
     _terminalApi.PrintString({ &wchPrintable, 1 });
 }
 
-void TerminalDispatch::PrintString(const wchar_t* const rgwch, const size_t cch)
+void TerminalDispatch::PrintString(const std::wstring_view string)
 {
-    _terminalApi.PrintString({ rgwch, cch });
+    _terminalApi.PrintString(string);
 }
 
 bool TerminalDispatch::CursorPosition(const unsigned int uiLine,
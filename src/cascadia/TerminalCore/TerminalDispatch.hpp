@@ -11,7 +11,7 @@ public:
     virtual ~TerminalDispatch(){};
     virtual void Execute(const wchar_t wchControl) override;
     virtual void Print(const wchar_t wchPrintable) override;
-    virtual void PrintString(const wchar_t* const rgwch, const size_t cch) override;
+    virtual void PrintString(const std::wstring_view string) override;
 
     bool SetGraphicsRendition(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions* const rgOptions,
                               const size_t cOptions) override;
@@ -39,8 +39,12 @@ private:
 
     bool _SetRgbColorsHelper(_In_reads_(cOptions) const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions* const rgOptions,
                              const size_t cOptions,
+                             TextAttribute& attr,
                              _Out_ size_t* const pcOptionsConsumed);
-    bool _SetBoldColorHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions option);
-    bool _SetDefaultColorHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions option);
-    void _SetGraphicsOptionHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions opt);
+    bool _SetBoldColorHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions option,
+                             TextAttribute& attr);
+    bool _SetDefaultColorHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions option,
+                                TextAttribute& attr);
+    void _SetGraphicsOptionHelper(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::GraphicsOptions opt,
+                                  TextAttribute& attr);
 };
@@ -71,6 +71,7 @@ bool TerminalDispatch::s_IsDefaultColorOption(const DispatchTypes::GraphicsOptio
 // Arguments:
 // - rgOptions - An array of options that will be used to generate the RGB color
 // - cOptions - The count of options
+// - attr - The attribute the parsed color is written into.
 // - pcOptionsConsumed - a pointer to place the number of options we consumed parsing this option.
 // Return Value:
 // Returns true if we successfully parsed an extended color option from the options array.
@@ -81,6 +82,7 @@ bool TerminalDispatch::s_IsDefaultColorOption(const DispatchTypes::GraphicsOptio
 //     5 - true, parsed an RGB color.
 bool TerminalDispatch::_SetRgbColorsHelper(_In_reads_(cOptions) const DispatchTypes::GraphicsOptions* const rgOptions,
                                            const size_t cOptions,
+                                           TextAttribute& attr,
                                            _Out_ size_t* const pcOptionsConsumed)
 {
     COLORREF color = 0;
@@ -113,7 +115,8 @@ bool TerminalDispatch::_SetRgbColorsHelper(_In_reads_(cOptions) const DispatchTy
 
             color = RGB(red, green, blue);
 
-            fSuccess = _terminalApi.SetTextRgbColor(color, isForeground);
+            attr.SetColor(color, isForeground);
+            fSuccess = true;
         }
         else if (typeOpt == DispatchTypes::GraphicsOptions::Xterm256Index && cOptions >= 3)
         {
@@ -121,36 +124,60 @@ bool TerminalDispatch::_SetRgbColorsHelper(_In_reads_(cOptions) const DispatchTy
             if (rgOptions[2] <= 255) // ensure that the provided index is on the table
             {
                 unsigned int tableIndex = rgOptions[2];
-                fSuccess = isForeground ?
-                               _terminalApi.SetTextForegroundIndex((BYTE)tableIndex) :
-                               _terminalApi.SetTextBackgroundIndex((BYTE)tableIndex);
+                if (isForeground)
+                {
+                    attr.SetIndexedAttributes({ (BYTE)tableIndex }, {});
+                }
+                else
+                {
+                    attr.SetIndexedAttributes({}, { (BYTE)tableIndex });
+                }
+                fSuccess = true;
             }
         }
     }
     return fSuccess;
 }
 
-bool TerminalDispatch::_SetBoldColorHelper(const DispatchTypes::GraphicsOptions option)
+bool TerminalDispatch::_SetBoldColorHelper(const DispatchTypes::GraphicsOptions option,
+                                           TextAttribute& attr)
 {
-    const bool bold = (option == DispatchTypes::GraphicsOptions::BoldBright);
-    return _terminalApi.BoldText(bold);
+    if (option == DispatchTypes::GraphicsOptions::BoldBright)
+    {
+        attr.Embolden();
+    }
+    else
+    {
+        attr.Debolden();
+    }
+    return true;
 }
 
-bool TerminalDispatch::_SetDefaultColorHelper(const DispatchTypes::GraphicsOptions option)
+bool TerminalDispatch::_SetDefaultColorHelper(const DispatchTypes::GraphicsOptions option,
+                                              TextAttribute& attr)
 {
     const bool fg = option == DispatchTypes::GraphicsOptions::Off || option == DispatchTypes::GraphicsOptions::ForegroundDefault;
     const bool bg = option == DispatchTypes::GraphicsOptions::Off || option == DispatchTypes::GraphicsOptions::BackgroundDefault;
-    bool success = _terminalApi.SetTextToDefaults(fg, bg);
 
-    if (success && fg && bg)
+    if (fg)
+    {
+        attr.SetDefaultForeground();
+    }
+    if (bg)
+    {
+        attr.SetDefaultBackground();
+    }
+
+    if (fg && bg)
     {
         // If we're resetting both the FG & BG, also reset the meta attributes (underline)
         //      as well as the boldness
-        success = _terminalApi.UnderlineText(false) &&
-                  _terminalApi.ReverseText(false) &&
-                  _terminalApi.BoldText(false);
+        WORD metaAttrs = attr.GetMetaAttributes();
+        WI_ClearAllFlags(metaAttrs, COMMON_LVB_UNDERSCORE | COMMON_LVB_REVERSE_VIDEO);
+        attr.SetMetaAttributes(metaAttrs);
+        attr.Debolden();
     }
-    return success;
+    return true;
 }
 
 // Routine Description:
@@ -158,11 +185,13 @@ bool TerminalDispatch::_SetDefaultColorHelper(const DispatchTypes::GraphicsOptio
 // - Placed as a helper so it can be recursive/re-entrant for some of the convenience flag methods that perform similar/multiple operations in one command.
 // Arguments:
 // - opt - Graphics option sent to us by the parser/requestor.
-// - pAttr - Pointer to the font attribute field to adjust
+// - attr - The attribute to adjust
 // Return Value:
 // - <none>
-void TerminalDispatch::_SetGraphicsOptionHelper(const DispatchTypes::GraphicsOptions opt)
+void TerminalDispatch::_SetGraphicsOptionHelper(const DispatchTypes::GraphicsOptions opt,
+                                                TextAttribute& attr)
 {
+    WORD metaAttrs = attr.GetMetaAttributes();
     switch (opt)
     {
     case DispatchTypes::GraphicsOptions::Off:
@@ -172,157 +201,172 @@ void TerminalDispatch::_SetGraphicsOptionHelper(const DispatchTypes::GraphicsOpt
     // case DispatchTypes::GraphicsOptions::BoldBright:
     // case DispatchTypes::GraphicsOptions::UnBold:
     case DispatchTypes::GraphicsOptions::Negative:
-        _terminalApi.ReverseText(true);
+        WI_SetFlag(metaAttrs, COMMON_LVB_REVERSE_VIDEO);
+        attr.SetMetaAttributes(metaAttrs);
         break;
     case DispatchTypes::GraphicsOptions::Underline:
-        _terminalApi.UnderlineText(true);
+        WI_SetFlag(metaAttrs, COMMON_LVB_UNDERSCORE);
+        attr.SetMetaAttributes(metaAttrs);
         break;
     case DispatchTypes::GraphicsOptions::Positive:
-        _terminalApi.ReverseText(false);
+        WI_ClearFlag(metaAttrs, COMMON_LVB_REVERSE_VIDEO);
+        attr.SetMetaAttributes(metaAttrs);
         break;
     case DispatchTypes::GraphicsOptions::NoUnderline:
-        _terminalApi.UnderlineText(false);
+        WI_ClearFlag(metaAttrs, COMMON_LVB_UNDERSCORE);
+        attr.SetMetaAttributes(metaAttrs);
         break;
     case DispatchTypes::GraphicsOptions::ForegroundBlack:
-        _terminalApi.SetTextForegroundIndex(DARK_BLACK);
+        attr.SetIndexedAttributes({ DARK_BLACK }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundBlue:
-        _terminalApi.SetTextForegroundIndex(DARK_BLUE);
+        attr.SetIndexedAttributes({ DARK_BLUE }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundGreen:
-        _terminalApi.SetTextForegroundIndex(DARK_GREEN);
+        attr.SetIndexedAttributes({ DARK_GREEN }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundCyan:
-        _terminalApi.SetTextForegroundIndex(DARK_CYAN);
+        attr.SetIndexedAttributes({ DARK_CYAN }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundRed:
-        _terminalApi.SetTextForegroundIndex(DARK_RED);
+        attr.SetIndexedAttributes({ DARK_RED }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundMagenta:
-        _terminalApi.SetTextForegroundIndex(DARK_MAGENTA);
+        attr.SetIndexedAttributes({ DARK_MAGENTA }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundYellow:
-        _terminalApi.SetTextForegroundIndex(DARK_YELLOW);
+        attr.SetIndexedAttributes({ DARK_YELLOW }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundWhite:
-        _terminalApi.SetTextForegroundIndex(DARK_WHITE);
+        attr.SetIndexedAttributes({ DARK_WHITE }, {});
         break;
     case DispatchTypes::GraphicsOptions::ForegroundDefault:
         FAIL_FAST_MSG("GraphicsOptions::ForegroundDefault should be handled by _SetDefaultColorHelper");
         break;
     case DispatchTypes::GraphicsOptions::BackgroundBlack:
-        _terminalApi.SetTextBackgroundIndex(DARK_BLACK);
+        attr.SetIndexedAttributes({}, { DARK_BLACK });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundBlue:
-        _terminalApi.SetTextBackgroundIndex(DARK_BLUE);
+        attr.SetIndexedAttributes({}, { DARK_BLUE });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundGreen:
-        _terminalApi.SetTextBackgroundIndex(DARK_GREEN);
+        attr.SetIndexedAttributes({}, { DARK_GREEN });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundCyan:
-        _terminalApi.SetTextBackgroundIndex(DARK_CYAN);
+        attr.SetIndexedAttributes({}, { DARK_CYAN });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundRed:
-        _terminalApi.SetTextBackgroundIndex(DARK_RED);
+        attr.SetIndexedAttributes({}, { DARK_RED });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundMagenta:
-        _terminalApi.SetTextBackgroundIndex(DARK_MAGENTA);
+        attr.SetIndexedAttributes({}, { DARK_MAGENTA });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundYellow:
-        _terminalApi.SetTextBackgroundIndex(DARK_YELLOW);
+        attr.SetIndexedAttributes({}, { DARK_YELLOW });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundWhite:
-        _terminalApi.SetTextBackgroundIndex(DARK_WHITE);
+        attr.SetIndexedAttributes({}, { DARK_WHITE });
         break;
     case DispatchTypes::GraphicsOptions::BackgroundDefault:
         FAIL_FAST_MSG("GraphicsOptions::BackgroundDefault should be handled by _SetDefaultColorHelper");
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundBlack:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_BLACK);
+        attr.SetIndexedAttributes({ BRIGHT_BLACK }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundBlue:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_BLUE);
+        attr.SetIndexedAttributes({ BRIGHT_BLUE }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundGreen:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_GREEN);
+        attr.SetIndexedAttributes({ BRIGHT_GREEN }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundCyan:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_CYAN);
+        attr.SetIndexedAttributes({ BRIGHT_CYAN }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundRed:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_RED);
+        attr.SetIndexedAttributes({ BRIGHT_RED }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundMagenta:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_MAGENTA);
+        attr.SetIndexedAttributes({ BRIGHT_MAGENTA }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundYellow:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_YELLOW);
+        attr.SetIndexedAttributes({ BRIGHT_YELLOW }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightForegroundWhite:
-        _terminalApi.SetTextForegroundIndex(BRIGHT_WHITE);
+        attr.SetIndexedAttributes({ BRIGHT_WHITE }, {});
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundBlack:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_BLACK);
+        attr.SetIndexedAttributes({}, { BRIGHT_BLACK });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundBlue:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_BLUE);
+        attr.SetIndexedAttributes({}, { BRIGHT_BLUE });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundGreen:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_GREEN);
+        attr.SetIndexedAttributes({}, { BRIGHT_GREEN });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundCyan:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_CYAN);
+        attr.SetIndexedAttributes({}, { BRIGHT_CYAN });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundRed:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_RED);
+        attr.SetIndexedAttributes({}, { BRIGHT_RED });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundMagenta:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_MAGENTA);
+        attr.SetIndexedAttributes({}, { BRIGHT_MAGENTA });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundYellow:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_YELLOW);
+        attr.SetIndexedAttributes({}, { BRIGHT_YELLOW });
         break;
     case DispatchTypes::GraphicsOptions::BrightBackgroundWhite:
-        _terminalApi.SetTextBackgroundIndex(BRIGHT_WHITE);
+        attr.SetIndexedAttributes({}, { BRIGHT_WHITE });
         break;
     }
 }
 
+// Routine Description:
+// - SGR - Modifies the graphical rendering options applied to the next characters written into the buffer.
+// - The whole option list is folded into a single TextAttribute here and
+//   handed to the terminal once at the end, rather than round-tripping the
+//   current attributes through the buffer for every individual option. SGR
+//   is per-sequence hot in any colored stream, so something like
+//   "ESC[0;1;31;44m" now costs one read and one write instead of eight.
+// Arguments:
+// - rgOptions - An array of options that will be applied from 0 to N, in order, one at a time by setting or removing flags in the font style properties.
+// - cOptions - The count of options (a.k.a. the N in the above line of comments)
+// Return Value:
+// - True if handled successfully. False otherwise.
 bool TerminalDispatch::SetGraphicsRendition(const DispatchTypes::GraphicsOptions* const rgOptions,
                                             const size_t cOptions)
 {
+    TextAttribute attr = _terminalApi.GetTextAttributes();
+
     bool fSuccess = false;
-    // Run through the graphics options and apply them
+    // Run through the graphics options and accumulate them into attr
     for (size_t i = 0; i < cOptions; i++)
     {
         DispatchTypes::GraphicsOptions opt = rgOptions[i];
         if (s_IsDefaultColorOption(opt))
         {
-            fSuccess = _SetDefaultColorHelper(opt);
+            fSuccess = _SetDefaultColorHelper(opt, attr);
         }
         else if (s_IsBoldColorOption(opt))
         {
-            fSuccess = _SetBoldColorHelper(rgOptions[i]);
+            fSuccess = _SetBoldColorHelper(rgOptions[i], attr);
         }
         else if (s_IsRgbColorOption(opt))
         {
             size_t cOptionsConsumed = 0;
 
-            // _SetRgbColorsHelper will call the appropriate ConApi function
-            fSuccess = _SetRgbColorsHelper(&(rgOptions[i]), cOptions - i, &cOptionsConsumed);
+            // _SetRgbColorsHelper will write the parsed color into attr
+            fSuccess = _SetRgbColorsHelper(&(rgOptions[i]), cOptions - i, attr, &cOptionsConsumed);
 
             i += (cOptionsConsumed - 1); // cOptionsConsumed includes the opt we're currently on.
         }
         else
         {
-            _SetGraphicsOptionHelper(opt);
-
-            // Make sure we un-bold
-            if (fSuccess && opt == DispatchTypes::GraphicsOptions::Off)
-            {
-                fSuccess = _SetBoldColorHelper(opt);
-            }
+            _SetGraphicsOptionHelper(opt, attr);
+            fSuccess = true;
         }
     }
-    return fSuccess;
+
+    // Apply the accumulated attribute in a single call.
+    return _terminalApi.SetTextAttributes(attr) && fSuccess;
 }
@@ -8,20 +8,25 @@ using namespace Microsoft::Terminal::Core;
 
 // Method Description:
 // - Helper to determine the selected region of the buffer. Used for rendering.
+// - The returned reference points at a cached vector that is only rebuilt
+//   when the offset-adjusted endpoints or the selection mode change, so the
+//   per-frame and per-mouse-event calls that don't move an endpoint cost a
+//   key comparison and no allocation.
 // Return Value:
 // - A vector of rectangles representing the regions to select, line by line. They are absolute coordinates relative to the buffer origin.
-std::vector<SMALL_RECT> Terminal::_GetSelectionRects() const
+const std::vector<SMALL_RECT>& Terminal::_GetSelectionRects() const
 {
-    std::vector<SMALL_RECT> selectionArea;
-
     if (!_selectionActive)
     {
-        return selectionArea;
+        _selectionRectsCache.clear();
+        _selectionRectsCacheValid = false;
+        return _selectionRectsCache;
     }
 
     // create these new anchors for comparison and rendering
     COORD selectionAnchorWithOffset;
     COORD endSelectionPositionWithOffset;
+    auto& selectionArea = _selectionRectsCache;
 
     // Add anchor offset here to update properly on new buffer output
     THROW_IF_FAILED(ShortAdd(_selectionAnchor.Y, _selectionAnchor_YOffset, &selectionAnchorWithOffset.Y));
@@ -32,6 +37,19 @@ std::vector<SMALL_RECT> Terminal::_GetSelectionRects() const
     selectionAnchorWithOffset.X = std::clamp(_selectionAnchor.X, static_cast<SHORT>(0), bufferWidth);
     endSelectionPositionWithOffset.X = std::clamp(_endSelectionPosition.X, static_cast<SHORT>(0), bufferWidth);
 
+    // If nothing moved since the cache was built, it's still good.
+    if (_selectionRectsCacheValid &&
+        _selectionRectsCacheBox == _boxSelection &&
+        _selectionRectsCacheAnchor.X == selectionAnchorWithOffset.X &&
+        _selectionRectsCacheAnchor.Y == selectionAnchorWithOffset.Y &&
+        _selectionRectsCacheEnd.X == endSelectionPositionWithOffset.X &&
+        _selectionRectsCacheEnd.Y == endSelectionPositionWithOffset.Y)
+    {
+        return selectionArea;
+    }
+
+    selectionArea.clear();
+
     // NOTE: (0,0) is top-left so vertical comparison is inverted
     const COORD& higherCoord = (selectionAnchorWithOffset.Y <= endSelectionPositionWithOffset.Y) ?
                                    selectionAnchorWithOffset :
@@ -64,6 +82,12 @@ std::vector<SMALL_RECT> Terminal::_GetSelectionRects() const
 
         selectionArea.emplace_back(selectionRow);
     }
+
+    _selectionRectsCacheAnchor = selectionAnchorWithOffset;
+    _selectionRectsCacheEnd = endSelectionPositionWithOffset;
+    _selectionRectsCacheBox = _boxSelection;
+    _selectionRectsCacheValid = true;
+
     return selectionArea;
 }
 
@@ -159,6 +183,8 @@ void Terminal::SetEndSelectionPosition(const COORD position)
     // copy value of ViewStartIndex to support scrolling
     // and update on new buffer output (used in _GetSelectionRects())
     _endSelectionPosition_YOffset = gsl::narrow<SHORT>(_ViewStartIndex());
+
+    _PublishRenderSnapshot();
 }
 
 // Method Description:
@@ -168,6 +194,8 @@ void Terminal::SetEndSelectionPosition(const COORD position)
 void Terminal::SetBoxSelection(const bool isEnabled) noexcept
 {
     _boxSelection = isEnabled;
+
+    _PublishRenderSnapshot();
 }
 
 // Method Description:
@@ -180,6 +208,8 @@ void Terminal::ClearSelection() noexcept
     _selectionAnchor_YOffset = 0;
     _endSelectionPosition_YOffset = 0;
 
+    _PublishRenderSnapshot();
+
     _buffer->GetRenderTarget().TriggerSelection();
 }
 
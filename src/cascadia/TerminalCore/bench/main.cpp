@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Benchmark driver for the TerminalCore write pipeline - the cascadia
+// analogue of the conhost-side harnesses (conptybench, TerminalParser.Bench).
+//
+// Drives Terminal::Write with deterministic VT streams shaped like real
+// client output, with no UI and a null render target, so parser + buffer
+// changes in TerminalCore can be measured per-commit. Output is one
+// tab-separated line per stream:
+//
+//   <stream>  <wchars>  <MB/s>  <allocs>  <allocs-per-MB>  <lock-p50-ns>  <lock-p95-ns>  <lock-max-ns>
+//
+// The streams are fed in chunks matching Terminal::Write's internal slice
+// length, so each Write call is one write-lock hold; the lock columns are
+// therefore the distribution of how long a paint or a keystroke would have
+// been blocked behind output processing.
+//
+// The streams are synthesized by generators instead of checked-in captures,
+// keeping the repo lean and the sequence mix documented next to the numbers.
+
+#include "precomp.h"
+
+#include "../../cascadia/TerminalCore/Terminal.hpp"
+#include "../../renderer/inc/DummyRenderTarget.hpp"
+
+using namespace Microsoft::Terminal::Core;
+
+namespace
+{
+    // Allocation counting: the timed region flips g_fCountAllocs on, so the
+    // report covers exactly the allocations Write performs and none of the
+    // harness's own.
+    std::atomic<size_t> g_cAllocs{ 0 };
+    bool g_fCountAllocs = false;
+}
+
+void* __cdecl operator new(size_t size)
+{
+    if (g_fCountAllocs)
+    {
+        g_cAllocs.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* const ptr = malloc(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* __cdecl operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void __cdecl operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void __cdecl operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void __cdecl operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void __cdecl operator delete[](void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace
+{
+    // Matches Terminal::Write's internal WriteSliceLength, so one chunk is
+    // one lock hold.
+    constexpr size_t ChunkLength = 4096;
+
+    // Target stream size. Big enough to circle the scrollback and settle the
+    // allocator; small enough that four streams finish in a few seconds.
+    constexpr size_t StreamLength = 4 * 1024 * 1024;
+
+    constexpr COORD ViewportSize{ 120, 30 };
+    constexpr SHORT ScrollbackLines = 9001;
+
+    double s_NsPerQpcTick()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return 1.0e9 / static_cast<double>(frequency.QuadPart);
+    }
+
+    // The shape of a build spewing one status line per file: plain ASCII,
+    // short lines, every line scrolls the viewport once it fills.
+    std::wstring s_GenerateBuildOutput()
+    {
+        std::wstring stream;
+        stream.reserve(StreamLength + 128);
+        size_t i = 0;
+        while (stream.size() < StreamLength)
+        {
+            wchar_t line[128];
+            swprintf_s(line, L"[%zu/9999] Compiling src\\module_%zu\\impl_%zu.cpp\r\n", i % 9999, i % 57, i);
+            stream.append(line);
+            ++i;
+        }
+        return stream;
+    }
+
+    // The shape of `ls --color` style output: several SGR changes per line,
+    // so the attribute path runs constantly while the text stays short.
+    std::wstring s_GenerateSgrHeavyOutput()
+    {
+        std::wstring stream;
+        stream.reserve(StreamLength + 192);
+        size_t i = 0;
+        while (stream.size() < StreamLength)
+        {
+            wchar_t line[192];
+            swprintf_s(line,
+                       L"\x1b[01;34mdrwxr-xr-x\x1b[0m \x1b[33m%6zu\x1b[0m \x1b[01;32mtool_%zu.exe\x1b[0m \x1b[36mnotes_%zu.txt\x1b[0m \x1b[35mtrace_%zu.etl\x1b[0m\r\n",
+                       (i * 4096) % 999983,
+                       i % 100,
+                       i % 77,
+                       i % 31);
+            stream.append(line);
+            ++i;
+        }
+        return stream;
+    }
+
+    // The shape of a full-screen editor redrawing every frame: cursor
+    // addressing and erase-line for each row, no scrolling at all.
+    std::wstring s_GenerateFullRedrawOutput()
+    {
+        std::wstring stream;
+        stream.reserve(StreamLength + 256);
+        size_t frame = 0;
+        while (stream.size() < StreamLength)
+        {
+            for (SHORT row = 1; row <= ViewportSize.Y; ++row)
+            {
+                wchar_t line[192];
+                swprintf_s(line,
+                           L"\x1b[%d;1H\x1b[K%3d | const auto value_%zu = lines[%zu] + offset_%d;",
+                           row,
+                           row,
+                           frame % 997,
+                           (frame + row) % 8192,
+                           row);
+                stream.append(line);
+            }
+            stream.append(L"\x1b[1;1H");
+            ++frame;
+        }
+        return stream;
+    }
+
+    // CJK-heavy text, so every glyph goes through the two-column width
+    // handling instead of the ASCII fast path.
+    std::wstring s_GenerateWideGlyphOutput()
+    {
+        std::wstring stream;
+        stream.reserve(StreamLength + 64);
+        while (stream.size() < StreamLength)
+        {
+            stream.append(L"\x7d42\x7aef\x6a5f\x80fd\x6e2c\x8a66\x8cc7\x6599\x4e2d\x6587\x5bec\x5b57\x5143\x8f38\x51fa\x6e2c\x91cf\x57fa\x6e96\r\n");
+        }
+        return stream;
+    }
+
+    // Routine Description:
+    // - Feeds one stream through a fresh Terminal and prints a report line.
+    // - A full untimed pass through a throwaway Terminal warms the caches and
+    //   the allocator first; the timed pass then measures every chunk so the
+    //   throughput and the lock-hold percentiles come from the same run.
+    // Arguments:
+    // - name - Stable stream identifier printed in the report
+    // - stream - The VT stream to feed
+    void s_RunStream(const wchar_t* const name, const std::wstring& stream)
+    {
+        static const double nsPerTick = s_NsPerQpcTick();
+
+        DummyRenderTarget renderTarget;
+
+        {
+            Terminal warmupTerminal;
+            warmupTerminal.Create(ViewportSize, ScrollbackLines, renderTarget);
+            warmupTerminal.Write(stream);
+        }
+
+        Terminal terminal;
+        terminal.Create(ViewportSize, ScrollbackLines, renderTarget);
+
+        std::vector<double> holds;
+        holds.reserve((stream.size() / ChunkLength) + 1);
+
+        g_cAllocs.store(0, std::memory_order_relaxed);
+        g_fCountAllocs = true;
+
+        const std::wstring_view view{ stream };
+        size_t offset = 0;
+        while (offset < view.size())
+        {
+            const auto chunk = view.substr(offset, ChunkLength);
+            offset += chunk.size();
+
+            LARGE_INTEGER start;
+            LARGE_INTEGER stop;
+            QueryPerformanceCounter(&start);
+            terminal.Write(chunk);
+            QueryPerformanceCounter(&stop);
+            holds.push_back(static_cast<double>(stop.QuadPart - start.QuadPart) * nsPerTick);
+        }
+
+        g_fCountAllocs = false;
+        const size_t cAllocs = g_cAllocs.load(std::memory_order_relaxed);
+
+        double totalNs = 0.0;
+        for (const auto sample : holds)
+        {
+            totalNs += sample;
+        }
+        std::sort(holds.begin(), holds.end());
+
+        const double megabytes = static_cast<double>(stream.size() * sizeof(wchar_t)) / (1024.0 * 1024.0);
+        const double mbPerSec = megabytes / (totalNs / 1.0e9);
+
+        wprintf(L"%-28s\t%zu\t%.1f\t%zu\t%.1f\t%.0f\t%.0f\t%.0f\n",
+                name,
+                stream.size(),
+                mbPerSec,
+                cAllocs,
+                static_cast<double>(cAllocs) / megabytes,
+                holds[holds.size() / 2],
+                holds[(holds.size() * 95) / 100],
+                holds.back());
+    }
+}
+
+int __cdecl wmain(int /*argc*/, WCHAR* /*argv*/[])
+{
+    wprintf(L"%-28s\twchars\tMB/s\tallocs\tallocs-per-MB\tlock-p50-ns\tlock-p95-ns\tlock-max-ns\n", L"stream");
+
+    s_RunStream(L"build-output", s_GenerateBuildOutput());
+    s_RunStream(L"sgr-heavy", s_GenerateSgrHeavyOutput());
+    s_RunStream(L"full-redraw", s_GenerateFullRedrawOutput());
+    s_RunStream(L"wide-glyphs", s_GenerateWideGlyphOutput());
+
+    return 0;
+}
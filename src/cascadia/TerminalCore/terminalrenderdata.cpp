@@ -52,20 +52,39 @@ const COLORREF Terminal::GetBackgroundColor(const TextAttribute& attr) const noe
     return bgColor;
 }
 
+// The cursor, selection, and title getters below serve from the immutable
+// snapshot the writing thread publishes at safe points, so a paint that lands
+// between parse slices observes the state of the last completed slice rather
+// than whatever half-parsed position the cursor happens to be passing through.
 COORD Terminal::GetCursorPosition() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorPosition;
+    }
     const auto& cursor = _buffer->GetCursor();
     return cursor.GetPosition();
 }
 
 bool Terminal::IsCursorVisible() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorVisible;
+    }
     const auto& cursor = _buffer->GetCursor();
     return cursor.IsVisible() && !cursor.IsPopupShown();
 }
 
 bool Terminal::IsCursorOn() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorOn;
+    }
     const auto& cursor = _buffer->GetCursor();
     return cursor.IsOn();
 }
@@ -77,16 +96,31 @@ ULONG Terminal::GetCursorPixelWidth() const noexcept
 
 ULONG Terminal::GetCursorHeight() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorHeight;
+    }
     return _buffer->GetCursor().GetSize();
 }
 
 CursorType Terminal::GetCursorStyle() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorStyle;
+    }
     return _buffer->GetCursor().GetType();
 }
 
 COLORREF Terminal::GetCursorColor() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->cursorColor;
+    }
     return _buffer->GetCursor().GetColor();
 }
 
@@ -109,6 +143,16 @@ std::vector<Microsoft::Console::Types::Viewport> Terminal::GetSelectionRects() n
 {
     std::vector<Viewport> result;
 
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        for (const auto& lineRect : snapshot->selectionRects)
+        {
+            result.emplace_back(Viewport::FromInclusive(lineRect));
+        }
+        return result;
+    }
+
     for (const auto& lineRect : _GetSelectionRects())
     {
         result.emplace_back(Viewport::FromInclusive(lineRect));
@@ -119,6 +163,11 @@ std::vector<Microsoft::Console::Types::Viewport> Terminal::GetSelectionRects() n
 
 const std::wstring Terminal::GetConsoleTitle() const noexcept
 {
+    const auto snapshot = std::atomic_load(&_renderSnapshot);
+    if (snapshot)
+    {
+        return snapshot->title;
+    }
     return _title;
 }
 
@@ -326,39 +326,29 @@ void CommandListPopup::_DrawContent()
 }
 
 // Routine Description:
-// - Draws a list of commands for the user to choose from
+// - Stages a list of commands for the user to choose from and commits it to
+//   the screen in a single rectangular write.
 void CommandListPopup::_drawList()
 {
-    // draw empty popup
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left + 1i16;
-    WriteCoord.Y = _region.Top + 1i16;
-    size_t lStringLength = Width();
+    // stage empty popup interior
     for (SHORT i = 0; i < Height(); ++i)
     {
-        const OutputCellIterator spaces(UNICODE_SPACE, _attributes, lStringLength);
-        const auto result = _screenInfo.Write(spaces, WriteCoord);
-        lStringLength = result.GetCellDistance(spaces);
-        WriteCoord.Y += 1i16;
+        _StageFill({ 1i16, gsl::narrow<SHORT>(i + 1i16) }, UNICODE_SPACE, _attributes, Width());
     }
 
-    auto& api = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().api;
-
-    WriteCoord.Y = _region.Top + 1i16;
+    SHORT rowIndex = 1i16;
     SHORT i = std::max(gsl::narrow<SHORT>(_bottomIndex - Height() + 1), 0i16);
     for (; i <= _bottomIndex; i++)
     {
-        CHAR CommandNumber[COMMAND_NUMBER_SIZE];
-        // Write command number to screen.
-        if (0 != _itoa_s(i, CommandNumber, ARRAYSIZE(CommandNumber), 10))
+        WCHAR CommandNumber[COMMAND_NUMBER_SIZE];
+        // Stage command number.
+        if (0 != _itow_s(i, CommandNumber, ARRAYSIZE(CommandNumber), 10))
         {
             return;
         }
 
-        PCHAR CommandNumberPtr = CommandNumber;
-
         size_t CommandNumberLength;
-        if (FAILED(StringCchLengthA(CommandNumberPtr, ARRAYSIZE(CommandNumber), &CommandNumberLength)))
+        if (FAILED(StringCchLengthW(CommandNumber, ARRAYSIZE(CommandNumber), &CommandNumberLength)))
         {
             return;
         }
@@ -369,24 +359,19 @@ void CommandListPopup::_drawList()
             return;
         }
 
-        CommandNumber[CommandNumberLength] = ':';
-        CommandNumber[CommandNumberLength + 1] = ' ';
+        CommandNumber[CommandNumberLength] = L':';
+        CommandNumber[CommandNumberLength + 1] = L' ';
         CommandNumberLength += 2;
         if (CommandNumberLength > static_cast<ULONG>(Width()))
         {
             CommandNumberLength = static_cast<ULONG>(Width());
         }
 
-        WriteCoord.X = _region.Left + 1i16;
+        _StageText({ 1i16, rowIndex }, { CommandNumber, CommandNumberLength }, _attributes);
 
-        LOG_IF_FAILED(api.WriteConsoleOutputCharacterAImpl(_screenInfo,
-                                                           { CommandNumberPtr, CommandNumberLength },
-                                                           WriteCoord,
-                                                           CommandNumberLength));
-
-        // write command to screen
+        // stage command
         auto command = _history.GetNth(i);
-        lStringLength = command.size();
+        size_t lStringLength = command.size();
         {
             size_t lTmpStringLength = lStringLength;
             LONG lPopupLength = static_cast<LONG>(Width() - CommandNumberLength);
@@ -415,30 +400,24 @@ void CommandListPopup::_drawList()
             }
         }
 
-        WriteCoord.X = gsl::narrow<SHORT>(WriteCoord.X + CommandNumberLength);
-        size_t used;
-        LOG_IF_FAILED(api.WriteConsoleOutputCharacterWImpl(_screenInfo,
-                                                           { command.data(), lStringLength },
-                                                           WriteCoord,
-                                                           used));
+        _StageText({ gsl::narrow<SHORT>(1i16 + CommandNumberLength), rowIndex },
+                   { command.data(), lStringLength },
+                   _attributes);
 
-        // write attributes to screen
+        // stage attributes
         if (i == _currentCommand)
         {
-            WriteCoord.X = _region.Left + 1i16;
             // inverted attributes
-            lStringLength = Width();
             TextAttribute inverted = _attributes;
             inverted.Invert();
 
-            const OutputCellIterator it(inverted, lStringLength);
-            const auto done = _screenInfo.Write(it, WriteCoord);
-
-            lStringLength = done.GetCellDistance(it);
+            _StageAttributes({ 1i16, rowIndex }, inverted, Width());
         }
 
-        WriteCoord.Y += 1;
+        rowIndex += 1i16;
     }
+
+    _CommitStagedDraw();
 }
 
 // Routine Description:
@@ -527,23 +506,14 @@ void CommandListPopup::_updateHighlight(const SHORT OldCurrentCommand, const SHO
     {
         TopIndex = _bottomIndex - Height() + 1i16;
     }
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left + 1i16;
-    size_t lStringLength = Width();
-
-    WriteCoord.Y = _region.Top + 1i16 + OldCurrentCommand - TopIndex;
 
-    const OutputCellIterator it(_attributes, lStringLength);
-    const auto done = _screenInfo.Write(it, WriteCoord);
-    lStringLength = done.GetCellDistance(it);
+    // restore the old command's colors
+    _StageAttributes({ 1i16, gsl::narrow<SHORT>(1i16 + OldCurrentCommand - TopIndex) }, _attributes, Width());
 
-    // highlight new command
-    WriteCoord.Y = _region.Top + 1i16 + NewCurrentCommand - TopIndex;
-
-    // inverted attributes
+    // highlight new command with inverted attributes
     TextAttribute inverted = _attributes;
     inverted.Invert();
-    const OutputCellIterator itAttr(inverted, lStringLength);
-    const auto doneAttr = _screenInfo.Write(itAttr, WriteCoord);
-    lStringLength = done.GetCellDistance(itAttr);
+    _StageAttributes({ 1i16, gsl::narrow<SHORT>(1i16 + NewCurrentCommand - TopIndex) }, inverted, Width());
+
+    _CommitStagedDraw();
 }
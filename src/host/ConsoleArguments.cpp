@@ -11,6 +11,9 @@ const std::wstring_view ConsoleArguments::VT_MODE_ARG = L"--vtmode";
 const std::wstring_view ConsoleArguments::HEADLESS_ARG = L"--headless";
 const std::wstring_view ConsoleArguments::SERVER_HANDLE_ARG = L"--server";
 const std::wstring_view ConsoleArguments::SIGNAL_HANDLE_ARG = L"--signal";
+const std::wstring_view ConsoleArguments::OUTPUT_RING_ARG = L"--outputring";
+const std::wstring_view ConsoleArguments::OUTPUT_RING_DATA_ARG = L"--outputringdata";
+const std::wstring_view ConsoleArguments::OUTPUT_RING_SPACE_ARG = L"--outputringspace";
 const std::wstring_view ConsoleArguments::HANDLE_PREFIX = L"0x";
 const std::wstring_view ConsoleArguments::CLIENT_COMMANDLINE_ARG = L"--";
 const std::wstring_view ConsoleArguments::FORCE_V1_ARG = L"-ForceV1";
@@ -37,6 +40,9 @@ ConsoleArguments::ConsoleArguments(const std::wstring& commandline,
     _createServerHandle = true;
     _serverHandle = 0;
     _signalHandle = 0;
+    _outputRingHandle = 0;
+    _outputRingDataHandle = 0;
+    _outputRingSpaceHandle = 0;
     _forceV1 = false;
     _width = 0;
     _height = 0;
@@ -61,6 +67,9 @@ ConsoleArguments& ConsoleArguments::operator=(const ConsoleArguments& other)
         _createServerHandle = other._createServerHandle;
         _serverHandle = other._serverHandle;
         _signalHandle = other._signalHandle;
+        _outputRingHandle = other._outputRingHandle;
+        _outputRingDataHandle = other._outputRingDataHandle;
+        _outputRingSpaceHandle = other._outputRingSpaceHandle;
         _forceV1 = other._forceV1;
         _width = other._width;
         _height = other._height;
@@ -364,6 +373,36 @@ void ConsoleArguments::s_ConsumeArg(_Inout_ std::vector<std::wstring>& args, _In
                 hr = s_ParseHandleArg(signalHandleVal, _signalHandle);
             }
         }
+        else if (arg == OUTPUT_RING_ARG)
+        {
+            std::wstring outputRingHandleVal;
+            hr = s_GetArgumentValue(args, i, &outputRingHandleVal);
+
+            if (SUCCEEDED(hr))
+            {
+                hr = s_ParseHandleArg(outputRingHandleVal, _outputRingHandle);
+            }
+        }
+        else if (arg == OUTPUT_RING_DATA_ARG)
+        {
+            std::wstring outputRingDataHandleVal;
+            hr = s_GetArgumentValue(args, i, &outputRingDataHandleVal);
+
+            if (SUCCEEDED(hr))
+            {
+                hr = s_ParseHandleArg(outputRingDataHandleVal, _outputRingDataHandle);
+            }
+        }
+        else if (arg == OUTPUT_RING_SPACE_ARG)
+        {
+            std::wstring outputRingSpaceHandleVal;
+            hr = s_GetArgumentValue(args, i, &outputRingSpaceHandleVal);
+
+            if (SUCCEEDED(hr))
+            {
+                hr = s_ParseHandleArg(outputRingSpaceHandleVal, _outputRingSpaceHandle);
+            }
+        }
         else if (arg == FORCE_V1_ARG)
         {
             // -ForceV1 command line switch for NTVDM support
@@ -499,6 +538,36 @@ HANDLE ConsoleArguments::GetSignalHandle() const
     return ULongToHandle(_signalHandle);
 }
 
+// Routine Description:
+// - Returns true if the terminal offered us a complete shared-memory output
+//   ring on startup - the section and both signaling events. A partial set is
+//   treated as no ring at all, and output stays on the pipe.
+// Arguments:
+// - <none> - uses internal state
+// Return Value:
+// - True or false (see description)
+bool ConsoleArguments::HasOutputRing() const
+{
+    return IsValidHandle(GetOutputRingHandle()) &&
+           IsValidHandle(GetOutputRingDataHandle()) &&
+           IsValidHandle(GetOutputRingSpaceHandle());
+}
+
+HANDLE ConsoleArguments::GetOutputRingHandle() const
+{
+    return ULongToHandle(_outputRingHandle);
+}
+
+HANDLE ConsoleArguments::GetOutputRingDataHandle() const
+{
+    return ULongToHandle(_outputRingDataHandle);
+}
+
+HANDLE ConsoleArguments::GetOutputRingSpaceHandle() const
+{
+    return ULongToHandle(_outputRingSpaceHandle);
+}
+
 HANDLE ConsoleArguments::GetVtInHandle() const
 {
     return _vtInHandle;
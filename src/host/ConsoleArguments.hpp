@@ -43,6 +43,11 @@ public:
     bool HasSignalHandle() const;
     HANDLE GetSignalHandle() const;
 
+    bool HasOutputRing() const;
+    HANDLE GetOutputRingHandle() const;
+    HANDLE GetOutputRingDataHandle() const;
+    HANDLE GetOutputRingSpaceHandle() const;
+
     std::wstring GetClientCommandline() const;
     std::wstring GetVtMode() const;
     bool GetForceV1() const;
@@ -57,6 +62,9 @@ public:
     static const std::wstring_view HEADLESS_ARG;
     static const std::wstring_view SERVER_HANDLE_ARG;
     static const std::wstring_view SIGNAL_HANDLE_ARG;
+    static const std::wstring_view OUTPUT_RING_ARG;
+    static const std::wstring_view OUTPUT_RING_DATA_ARG;
+    static const std::wstring_view OUTPUT_RING_SPACE_ARG;
     static const std::wstring_view HANDLE_PREFIX;
     static const std::wstring_view CLIENT_COMMANDLINE_ARG;
     static const std::wstring_view FORCE_V1_ARG;
@@ -82,7 +90,10 @@ private:
                      const bool createServerHandle,
                      const DWORD serverHandle,
                      const DWORD signalHandle,
-                     const bool inheritCursor) :
+                     const bool inheritCursor,
+                     const DWORD outputRingHandle = 0,
+                     const DWORD outputRingDataHandle = 0,
+                     const DWORD outputRingSpaceHandle = 0) :
         _commandline(commandline),
         _clientCommandline(clientCommandline),
         _vtInHandle(vtInHandle),
@@ -95,6 +106,9 @@ private:
         _createServerHandle(createServerHandle),
         _serverHandle(serverHandle),
         _signalHandle(signalHandle),
+        _outputRingHandle(outputRingHandle),
+        _outputRingDataHandle(outputRingDataHandle),
+        _outputRingSpaceHandle(outputRingSpaceHandle),
         _inheritCursor(inheritCursor),
         _recievedEarlySizeChange{ false },
         _originalWidth{ -1 },
@@ -122,6 +136,9 @@ private:
     bool _createServerHandle;
     DWORD _serverHandle;
     DWORD _signalHandle;
+    DWORD _outputRingHandle;
+    DWORD _outputRingDataHandle;
+    DWORD _outputRingSpaceHandle;
     bool _inheritCursor;
 
     bool _recievedEarlySizeChange;
@@ -175,6 +192,7 @@ namespace WEX
                                                            L"Use Signal Handle: '%ws'\r\n"
                                                            L"Signal Handle: '0x%x'\r\n",
                                                            L"Inherit Cursor: '%ws'\r\n",
+                                                           L"Use Output Ring: '%ws'\r\n",
                                                            ci.GetClientCommandline().c_str(),
                                                            s_ToBoolString(ci.HasVtHandles()),
                                                            ci.GetVtInHandle(),
@@ -188,7 +206,8 @@ namespace WEX
                                                            ci.GetServerHandle(),
                                                            s_ToBoolString(ci.HasSignalHandle()),
                                                            ci.GetSignalHandle(),
-                                                           s_ToBoolString(ci.GetInheritCursor()));
+                                                           s_ToBoolString(ci.GetInheritCursor()),
+                                                           s_ToBoolString(ci.HasOutputRing()));
             }
 
         private:
@@ -217,7 +236,10 @@ namespace WEX
                        expected.GetServerHandle() == actual.GetServerHandle() &&
                        expected.HasSignalHandle() == actual.HasSignalHandle() &&
                        expected.GetSignalHandle() == actual.GetSignalHandle() &&
-                       expected.GetInheritCursor() == actual.GetInheritCursor();
+                       expected.GetInheritCursor() == actual.GetInheritCursor() &&
+                       expected.GetOutputRingHandle() == actual.GetOutputRingHandle() &&
+                       expected.GetOutputRingDataHandle() == actual.GetOutputRingDataHandle() &&
+                       expected.GetOutputRingSpaceHandle() == actual.GetOutputRingSpaceHandle();
             }
 
             static bool AreSame(const ConsoleArguments& expected, const ConsoleArguments& actual)
@@ -242,7 +264,8 @@ namespace WEX
                        !object.ShouldCreateServerHandle() &&
                        object.GetServerHandle() == 0 &&
                        (object.GetSignalHandle() == 0 || object.GetSignalHandle() == INVALID_HANDLE_VALUE) &&
-                       !object.GetInheritCursor();
+                       !object.GetInheritCursor() &&
+                       !object.HasOutputRing();
             }
         };
     }
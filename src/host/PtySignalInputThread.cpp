@@ -12,12 +12,6 @@
 
 #define PTY_SIGNAL_RESIZE_WINDOW 8u
 
-struct PTY_SIGNAL_RESIZE
-{
-    unsigned short sx;
-    unsigned short sy;
-};
-
 using namespace Microsoft::Console;
 using namespace Microsoft::Console::Interactivity;
 using namespace Microsoft::Console::VirtualTerminal;
@@ -89,6 +83,11 @@ void PtySignalInputThread::ConnectConsole() noexcept
             PTY_SIGNAL_RESIZE resizeMsg = { 0 };
             _GetData(&resizeMsg, sizeof(resizeMsg));
 
+            // A live window drag queues resizes faster than we can reflow the
+            // buffer for them. Only the newest size matters, so fold any
+            // resizes already waiting in the pipe into this one.
+            _CoalesceResizeMessages(resizeMsg);
+
             LockConsole();
             auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
             // If the client app hasn't yet connected, stash the new size in the launchArgs.
@@ -124,6 +123,34 @@ void PtySignalInputThread::ConnectConsole() noexcept
     return S_OK;
 }
 
+// Method Description:
+// - Drains any resize signals that are already queued on the pipe, keeping
+//   only the most recent size in resizeMsg. The caller then applies a single
+//   resize at the final dimensions instead of one per intermediate step.
+// - Only consumes a queued message when the complete signal (id plus payload)
+//   has landed in the pipe and it really is another resize; anything else
+//   stays queued for the main loop to dispatch.
+// Arguments:
+// - resizeMsg - on input the message just read; on output the newest queued size.
+// Return Value:
+// - <none>
+void PtySignalInputThread::_CoalesceResizeMessages(PTY_SIGNAL_RESIZE& resizeMsg)
+{
+    unsigned short signalId = 0;
+    DWORD dwAvailable = 0;
+
+    while (PeekNamedPipe(_hFile.get(), &signalId, sizeof(signalId), nullptr, &dwAvailable, nullptr) &&
+           dwAvailable >= sizeof(signalId) + sizeof(resizeMsg) &&
+           signalId == PTY_SIGNAL_RESIZE_WINDOW)
+    {
+        if (!_GetData(&signalId, sizeof(signalId)) ||
+            !_GetData(&resizeMsg, sizeof(resizeMsg)))
+        {
+            break;
+        }
+    }
+}
+
 // Method Description:
 // - Retrieves bytes from the file stream and exits or throws errors should the pipe state
 //   be compromised.
@@ -33,8 +33,15 @@ namespace Microsoft::Console
         void ConnectConsole() noexcept;
 
     private:
+        struct PTY_SIGNAL_RESIZE
+        {
+            unsigned short sx;
+            unsigned short sy;
+        };
+
         [[nodiscard]] HRESULT _InputThread();
         bool _GetData(_Out_writes_bytes_(cbBuffer) void* const pBuffer, const DWORD cbBuffer);
+        void _CoalesceResizeMessages(PTY_SIGNAL_RESIZE& resizeMsg);
         void _Shutdown();
 
         wil::unique_hfile _hFile;
@@ -11,26 +11,62 @@ ScreenBufferRenderTarget::ScreenBufferRenderTarget(SCREEN_INFORMATION& owner) :
 {
 }
 
-void ScreenBufferRenderTarget::TriggerRedraw(const Microsoft::Console::Types::Viewport& region)
+// Routine Description:
+// - Folds a region invalidation into the pending rectangle when the console
+//   lock is held, so a burst of writes costs the renderer one call at unlock
+//   instead of one call per write. Without the lock (no batch to ride along
+//   with), the region is forwarded immediately.
+// Arguments:
+// - region - The region of the buffer that changed.
+void ScreenBufferRenderTarget::_AccumulateRedraw(const Microsoft::Console::Types::Viewport& region)
 {
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
-    const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    const auto* pActive = &gci.GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
     {
-        pRenderer->TriggerRedraw(region);
+        if (gci.IsConsoleLocked())
+        {
+            _pendingRedraw = _pendingRedraw.has_value() ?
+                                 Microsoft::Console::Types::Viewport::Union(_pendingRedraw.value(), region) :
+                                 region;
+        }
+        else
+        {
+            pRenderer->TriggerRedraw(region);
+        }
     }
 }
 
-void ScreenBufferRenderTarget::TriggerRedraw(const COORD* const pcoord)
+// Routine Description:
+// - Hands any pooled region invalidation to the renderer. Called by
+//   UnlockConsole just before the last release of the console lock.
+// - If the owning buffer is no longer the active one, the pending region is
+//   discarded, matching how invalidations on inactive buffers are dropped.
+void ScreenBufferRenderTarget::FlushPendingRedraw()
 {
-    auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
-    const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
-    if (pRenderer != nullptr && pActive == &_owner)
+    if (_pendingRedraw.has_value())
     {
-        pRenderer->TriggerRedraw(pcoord);
+        auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
+        const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
+        if (pRenderer != nullptr && pActive == &_owner)
+        {
+            pRenderer->TriggerRedraw(_pendingRedraw.value());
+        }
+        _pendingRedraw.reset();
     }
 }
 
+void ScreenBufferRenderTarget::TriggerRedraw(const Microsoft::Console::Types::Viewport& region)
+{
+    _AccumulateRedraw(region);
+}
+
+void ScreenBufferRenderTarget::TriggerRedraw(const COORD* const pcoord)
+{
+    _AccumulateRedraw(Microsoft::Console::Types::Viewport::FromCoord(*pcoord));
+}
+
 void ScreenBufferRenderTarget::TriggerRedrawCursor(const COORD* const pcoord)
 {
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
@@ -47,12 +83,16 @@ void ScreenBufferRenderTarget::TriggerRedrawAll()
     const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
     {
+        // A full invalidation covers anything still pooled up.
+        _pendingRedraw.reset();
         pRenderer->TriggerRedrawAll();
     }
 }
 
 void ScreenBufferRenderTarget::TriggerTeardown()
 {
+    FlushPendingRedraw();
+
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
     const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
@@ -71,8 +111,26 @@ void ScreenBufferRenderTarget::TriggerSelection()
     }
 }
 
+void ScreenBufferRenderTarget::TriggerScrollRegion(const Microsoft::Console::Types::Viewport& source,
+                                                   const Microsoft::Console::Types::Viewport& target,
+                                                   const Microsoft::Console::Types::Viewport& fill)
+{
+    // Scrolls move content underneath any pooled invalidation; hand the
+    // pending region over first so the renderer can shift it correctly.
+    FlushPendingRedraw();
+
+    auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
+    const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
+    if (pRenderer != nullptr && pActive == &_owner)
+    {
+        pRenderer->TriggerScrollRegion(source, target, fill);
+    }
+}
+
 void ScreenBufferRenderTarget::TriggerScroll()
 {
+    FlushPendingRedraw();
+
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
     const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
@@ -83,6 +141,8 @@ void ScreenBufferRenderTarget::TriggerScroll()
 
 void ScreenBufferRenderTarget::TriggerScroll(const COORD* const pcoordDelta)
 {
+    FlushPendingRedraw();
+
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
     const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
@@ -93,6 +153,8 @@ void ScreenBufferRenderTarget::TriggerScroll(const COORD* const pcoordDelta)
 
 void ScreenBufferRenderTarget::TriggerCircling()
 {
+    FlushPendingRedraw();
+
     auto* pRenderer = ServiceLocator::LocateGlobals().pRender;
     const auto* pActive = &ServiceLocator::LocateGlobals().getConsoleInformation().GetActiveOutputBuffer().GetActiveBuffer();
     if (pRenderer != nullptr && pActive == &_owner)
@@ -37,9 +37,21 @@ public:
     void TriggerSelection() override;
     void TriggerScroll() override;
     void TriggerScroll(const COORD* const pcoordDelta) override;
+    void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& source,
+                             const Microsoft::Console::Types::Viewport& target,
+                             const Microsoft::Console::Types::Viewport& fill) override;
     void TriggerCircling() override;
     void TriggerTitleChange() override;
 
+    void FlushPendingRedraw();
+
 private:
+    void _AccumulateRedraw(const Microsoft::Console::Types::Viewport& region);
+
     SCREEN_INFORMATION& _owner;
+
+    // Region invalidations raised while the console lock is held are pooled
+    // here as one bounding rectangle and handed to the renderer in a single
+    // call when the lock is released, instead of once per write.
+    std::optional<Microsoft::Console::Types::Viewport> _pendingRedraw;
 };
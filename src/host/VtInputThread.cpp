@@ -31,7 +31,8 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
     _utf8Parser{ CP_UTF8 },
     _dwThreadId{ 0 },
     _exitRequested{ false },
-    _exitResult{ S_OK }
+    _exitResult{ S_OK },
+    _buffer{ std::make_unique<byte[]>(_ReadBufferSize) }
 {
     THROW_HR_IF(E_HANDLE, _hFile.get() == INVALID_HANDLE_VALUE);
 
@@ -58,16 +59,11 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
 // - S_OK on success, otherwise an appropriate failure.
 [[nodiscard]] HRESULT VtInputThread::_HandleRunInput(_In_reads_(cch) const byte* const charBuffer, const int cch)
 {
-    // Make sure to call the GLOBAL Lock/Unlock, not the gci's lock/unlock.
-    // Only the global unlock attempts to dispatch ctrl events. If you use the
-    //      gci's unlock, when you press C-c, it won't be dispatched until the
-    //      next console API call. For something like `powershell sleep 60`,
-    //      that won't happen for 60s
-    LockConsole();
-    auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
-
     try
     {
+        // Decode the UTF-8 before taking the console lock - the conversion
+        //      only touches our own scratch buffers, so there's no reason to
+        //      serialize it with the rest of the console.
         std::unique_ptr<wchar_t[]> pwsSequence;
         unsigned int cchConsumed;
         unsigned int cchSequence;
@@ -77,6 +73,15 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
         {
             return S_FALSE;
         }
+
+        // Make sure to call the GLOBAL Lock/Unlock, not the gci's lock/unlock.
+        // Only the global unlock attempts to dispatch ctrl events. If you use the
+        //      gci's unlock, when you press C-c, it won't be dispatched until the
+        //      next console API call. For something like `powershell sleep 60`,
+        //      that won't happen for 60s
+        LockConsole();
+        auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
+
         _pInputStateMachine->ProcessString(pwsSequence.get(), cchSequence);
     }
     CATCH_RETURN();
@@ -106,9 +111,8 @@ DWORD WINAPI VtInputThread::StaticVtInputThreadProc(_In_ LPVOID lpParameter)
 // - <none>
 void VtInputThread::DoReadInput(const bool throwOnFail)
 {
-    byte buffer[256];
     DWORD dwRead = 0;
-    bool fSuccess = !!ReadFile(_hFile.get(), buffer, ARRAYSIZE(buffer), &dwRead, nullptr);
+    bool fSuccess = !!ReadFile(_hFile.get(), _buffer.get(), gsl::narrow_cast<DWORD>(_ReadBufferSize), &dwRead, nullptr);
 
     // If we failed to read because the terminal broke our pipe (usually due
     //      to dying itself), close gracefully with ERROR_BROKEN_PIPE.
@@ -121,7 +125,26 @@ void VtInputThread::DoReadInput(const bool throwOnFail)
         return;
     }
 
-    HRESULT hr = _HandleRunInput(buffer, dwRead);
+    // Drain anything else the terminal already has queued into the rest of
+    //      the buffer before parsing. A fast writer (a large paste, say)
+    //      lands in the pipe a pipe-buffer at a time; folding the queued
+    //      chunks into one parse pass costs one console lock acquisition
+    //      instead of one per chunk.
+    DWORD dwAvailable = 0;
+    while (dwRead < _ReadBufferSize &&
+           PeekNamedPipe(_hFile.get(), nullptr, 0, nullptr, &dwAvailable, nullptr) &&
+           dwAvailable > 0)
+    {
+        const DWORD dwToRead = std::min(dwAvailable, gsl::narrow_cast<DWORD>(_ReadBufferSize - dwRead));
+        DWORD dwReadMore = 0;
+        if (!ReadFile(_hFile.get(), _buffer.get() + dwRead, dwToRead, &dwReadMore, nullptr))
+        {
+            break;
+        }
+        dwRead += dwReadMore;
+    }
+
+    HRESULT hr = _HandleRunInput(_buffer.get(), dwRead);
     if (FAILED(hr))
     {
         if (throwOnFail)
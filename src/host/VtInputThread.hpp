@@ -41,5 +41,10 @@ namespace Microsoft::Console
 
         std::unique_ptr<Microsoft::Console::VirtualTerminal::StateMachine> _pInputStateMachine;
         Utf8ToWideCharParser _utf8Parser;
+
+        // The read buffer lives on the heap because it's sized to swallow
+        //      everything a fast terminal can queue between our wakeups.
+        static constexpr size_t _ReadBufferSize = 64 * 1024;
+        std::unique_ptr<byte[]> _buffer;
     };
 }
@@ -8,6 +8,7 @@
 #include "../renderer/vt/XtermEngine.hpp"
 #include "../renderer/vt/Xterm256Engine.hpp"
 #include "../renderer/vt/WinTelnetEngine.hpp"
+#include "../renderer/vt/BinaryEngine.hpp"
 
 #include "../renderer/base/renderer.hpp"
 #include "../types/inc/utils.hpp"
@@ -59,6 +60,10 @@ VtIo::VtIo() :
     {
         ioMode = VtIoMode::XTERM_ASCII;
     }
+    else if (VtMode == BINARY_STRING)
+    {
+        ioMode = VtIoMode::BINARY;
+    }
     else if (VtMode == DEFAULT_STRING)
     {
         ioMode = VtIoMode::XTERM_256;
@@ -77,7 +82,19 @@ VtIo::VtIo() :
     // If we were already given VT handles, set up the VT IO engine to use those.
     if (pArgs->InConptyMode())
     {
-        return _Initialize(pArgs->GetVtInHandle(), pArgs->GetVtOutHandle(), pArgs->GetVtMode(), pArgs->GetSignalHandle());
+        RETURN_IF_FAILED(_Initialize(pArgs->GetVtInHandle(), pArgs->GetVtOutHandle(), pArgs->GetVtMode(), pArgs->GetSignalHandle()));
+
+        // If the terminal also offered a shared-memory output ring, hold on
+        //      to its handles until CreateIoHandlers gives them to the render
+        //      engine.
+        if (pArgs->HasOutputRing())
+        {
+            _hOutputRingSection.reset(pArgs->GetOutputRingHandle());
+            _hOutputRingDataReady.reset(pArgs->GetOutputRingDataHandle());
+            _hOutputRingSpaceAvailable.reset(pArgs->GetOutputRingSpaceHandle());
+        }
+
+        return S_OK;
     }
     // Didn't need to initialize if we didn't have VT stuff. It's still OK, but report we did nothing.
     else
@@ -179,6 +196,11 @@ VtIo::VtIo() :
                                                                  static_cast<WORD>(gci.GetColorTableSize()),
                                                                  true);
                 break;
+            case VtIoMode::BINARY:
+                _pVtRenderEngine = std::make_unique<BinaryEngine>(std::move(_hOutput),
+                                                                  gci,
+                                                                  initialViewport);
+                break;
             case VtIoMode::WIN_TELNET:
                 _pVtRenderEngine = std::make_unique<WinTelnetEngine>(std::move(_hOutput),
                                                                      gci,
@@ -192,6 +214,15 @@ VtIo::VtIo() :
             if (_pVtRenderEngine)
             {
                 _pVtRenderEngine->SetTerminalOwner(this);
+
+                // The ring is purely a fast path - if adopting it fails for
+                //      any reason, the engine just stays on the pipe.
+                if (IsValidHandle(_hOutputRingSection.get()))
+                {
+                    LOG_IF_FAILED(_pVtRenderEngine->SetOutputRing(std::move(_hOutputRingSection),
+                                                                  std::move(_hOutputRingDataReady),
+                                                                  std::move(_hOutputRingSpaceAvailable)));
+                }
             }
         }
     }
@@ -229,31 +260,32 @@ bool VtIo::IsUsingVt() const
     {
         try
         {
+            // MSFT: 15813316
+            // If the terminal application wants us to inherit the cursor
+            //  position, emit the cursor position request before hooking the
+            //  engine up to the renderer. We don't stall here waiting for the
+            //  response - the engine holds back every frame until the reply
+            //  arrives (see VtEngine::RequestCursor), so nothing can paint
+            //  over the content we're inheriting, and the rest of startup
+            //  overlaps the terminal's roundtrip. The input thread started
+            //  below will hand the response to the InteractDispatch, which
+            //  calls SetCursorPosition, which calls our
+            //  VtIo::SetCursorPosition method, which releases the first frame.
+            // We need both handles for this to work. If we don't have both,
+            //      we'll skip it. They either aren't going to be reading
+            //      output (so they can't get the DSR) or they can't write the
+            //      response to us.
+            if (_lookingForCursorPosition && _pVtInputThread)
+            {
+                LOG_IF_FAILED(_pVtRenderEngine->RequestCursor());
+            }
+
             g.pRender->AddRenderEngine(_pVtRenderEngine.get());
             g.getConsoleInformation().GetActiveOutputBuffer().SetTerminalConnection(_pVtRenderEngine.get());
         }
         CATCH_RETURN();
     }
 
-    // MSFT: 15813316
-    // If the terminal application wants us to inherit the cursor position,
-    //  we're going to emit a VT sequence to ask for the cursor position, then
-    //  read input until we get a response. Terminals who request this behavior
-    //  but don't respond will hang.
-    // If we get a response, the InteractDispatch will call SetCursorPosition,
-    //      which will call to our VtIo::SetCursorPosition method.
-    // We need both handles for this initialization to work. If we don't have
-    //      both, we'll skip it. They either aren't going to be reading output
-    //      (so they can't get the DSR) or they can't write the response to us.
-    if (_lookingForCursorPosition && _pVtRenderEngine && _pVtInputThread)
-    {
-        LOG_IF_FAILED(_pVtRenderEngine->RequestCursor());
-        while (_lookingForCursorPosition)
-        {
-            _pVtInputThread->DoReadInput(false);
-        }
-    }
-
     if (_pVtInputThread)
     {
         LOG_IF_FAILED(_pVtInputThread->Start());
@@ -341,6 +373,16 @@ bool VtIo::IsUsingVt() const
         }
 
         _lookingForCursorPosition = false;
+
+        // The engine has been holding back every frame since the request went
+        //      out (see StartIfNeeded). Kick the renderer so the accumulated
+        //      first frame goes out now, rather than waiting for the client's
+        //      next write to trigger it.
+        Globals& g = ServiceLocator::LocateGlobals();
+        if (g.pRender)
+        {
+            g.pRender->TriggerRedrawAll();
+        }
     }
     return hr;
 }
@@ -42,6 +42,12 @@ namespace Microsoft::Console::VirtualTerminal
         wil::unique_hfile _hOutput;
         // After CreateAndStartSignalThread is called, this will be invalid.
         wil::unique_hfile _hSignal;
+        // Handles for the shared-memory output ring the terminal offered, if
+        //      any. Held here between Initialize and CreateIoHandlers, where
+        //      they're handed to the render engine.
+        wil::unique_handle _hOutputRingSection;
+        wil::unique_handle _hOutputRingDataReady;
+        wil::unique_handle _hOutputRingSpaceAvailable;
         VtIoMode _IoMode;
 
         bool _initialized;
@@ -313,6 +313,123 @@ void WriteToScreen(SCREEN_INFORMATION& screenInfo, const Viewport& region)
 // - cellsModified - the number of elements written
 // Return Value:
 // - S_OK or suitable HRESULT code from failure to write (memory issues, invalid arg, etc.)
+// Routine Description:
+// - Fills the buffer with a character for the in-process VT adapter. The
+//   public Impl above exists to service driver messages from out-of-process
+//   clients, so it takes the console lock per call; the adapter runs during
+//   write servicing with the lock already held, so this path asserts that and
+//   writes straight through. Accessibility notification is preserved.
+// Arguments:
+// - screenInfo - reference to screen buffer information.
+// - character - wchar to fill with
+// - lengthToWrite - the number of elements to write
+// - startingCoordinate - Screen buffer coordinate to begin writing to.
+// - cellsModified - the number of elements written
+// Return Value:
+// - S_OK or suitable HRESULT code from failure to write
+[[nodiscard]] HRESULT DoSrvPrivateFillOutputCharacter(SCREEN_INFORMATION& screenInfo,
+                                                      const wchar_t character,
+                                                      const size_t lengthToWrite,
+                                                      const COORD startingCoordinate,
+                                                      size_t& cellsModified) noexcept
+{
+    cellsModified = 0;
+
+    if (lengthToWrite == 0)
+    {
+        return S_OK;
+    }
+
+    FAIL_FAST_IF(!ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked());
+
+    const auto bufferSize = screenInfo.GetBufferSize();
+    if (!bufferSize.IsInBounds(startingCoordinate))
+    {
+        return S_OK;
+    }
+
+    try
+    {
+        const OutputCellIterator it(character, lengthToWrite);
+        const auto done = screenInfo.Write(it, startingCoordinate);
+        cellsModified = done.GetInputDistance(it);
+
+        // Notify accessibility
+        auto endingCoordinate = startingCoordinate;
+        bufferSize.MoveInBounds(cellsModified, endingCoordinate);
+        screenInfo.NotifyAccessibilityEventing(startingCoordinate.X, startingCoordinate.Y, endingCoordinate.X, endingCoordinate.Y);
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Fills the buffer with an attribute for the in-process VT adapter, without
+//   the per-call lock ceremony (see DoSrvPrivateFillOutputCharacter). The
+//   VT-mode legacy-to-full attribute recovery from the public Impl is kept,
+//   because the adapter's fills come from a legacy csbiex attribute and rely
+//   on it to round-trip RGB and default colors.
+// Arguments:
+// - screenInfo - reference to screen buffer information.
+// - attribute - the text attribute to use to fill
+// - lengthToWrite - the number of elements to write
+// - startingCoordinate - Screen buffer coordinate to begin writing to.
+// - cellsModified - the number of elements written
+// Return Value:
+// - S_OK or suitable HRESULT code from failure to write
+[[nodiscard]] HRESULT DoSrvPrivateFillOutputAttribute(SCREEN_INFORMATION& screenInfo,
+                                                      const WORD attribute,
+                                                      const size_t lengthToWrite,
+                                                      const COORD startingCoordinate,
+                                                      size_t& cellsModified) noexcept
+{
+    cellsModified = 0;
+
+    if (lengthToWrite == 0)
+    {
+        return S_OK;
+    }
+
+    FAIL_FAST_IF(!ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked());
+
+    const auto bufferSize = screenInfo.GetBufferSize();
+    if (!bufferSize.IsInBounds(startingCoordinate))
+    {
+        return S_OK;
+    }
+
+    try
+    {
+        TextAttribute useThisAttr(attribute);
+
+        // See the identical block in FillConsoleOutputAttributeImpl for why
+        // default attributes are recovered into their full form here.
+        if (screenInfo.InVTMode())
+        {
+            const auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+            auto bufferLegacy = gci.GenerateLegacyAttributes(screenInfo.GetAttributes());
+            if (bufferLegacy == attribute)
+            {
+                useThisAttr = TextAttribute(screenInfo.GetAttributes());
+            }
+        }
+
+        const OutputCellIterator it(useThisAttr, lengthToWrite);
+        const auto done = screenInfo.Write(it, startingCoordinate);
+
+        cellsModified = done.GetCellDistance(it);
+
+        // Notify accessibility
+        auto endingCoordinate = startingCoordinate;
+        bufferSize.MoveInBounds(cellsModified, endingCoordinate);
+        screenInfo.NotifyAccessibilityEventing(startingCoordinate.X, startingCoordinate.Y, endingCoordinate.X, endingCoordinate.Y);
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
 [[nodiscard]] HRESULT ApiRoutines::FillConsoleOutputCharacterAImpl(IConsoleOutputObject& OutContext,
                                                                    const char character,
                                                                    const size_t lengthToWrite,
@@ -23,3 +23,14 @@ Revision History:
 #include "../types/inc/viewport.hpp"
 
 void WriteToScreen(SCREEN_INFORMATION& screenInfo, const Microsoft::Console::Types::Viewport& region);
+
+[[nodiscard]] HRESULT DoSrvPrivateFillOutputCharacter(SCREEN_INFORMATION& screenInfo,
+                                                      const wchar_t character,
+                                                      const size_t lengthToWrite,
+                                                      const COORD startingCoordinate,
+                                                      size_t& cellsModified) noexcept;
+[[nodiscard]] HRESULT DoSrvPrivateFillOutputAttribute(SCREEN_INFORMATION& screenInfo,
+                                                      const WORD attribute,
+                                                      const size_t lengthToWrite,
+                                                      const COORD startingCoordinate,
+                                                      size_t& cellsModified) noexcept;
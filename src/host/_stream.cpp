@@ -14,6 +14,7 @@
 #include "dbcs.h"
 #include "handle.h"
 #include "misc.h"
+#include "tracing.hpp"
 #include "utf8ToWidecharParser.hpp"
 
 #include "../types/inc/convert.hpp"
@@ -326,6 +327,13 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
     const size_t BufferSize = *pcb;
     *pcb = 0;
 
+    // Conpty latency instrumentation: stamp the moment client text enters
+    // the host, the first stage of the conpty output pipeline.
+    if (gci.IsInVtIoMode())
+    {
+        Tracing::s_TraceConptyClientWrite(BufferSize / sizeof(wchar_t));
+    }
+
     const wchar_t* lpString = pwchRealUnicode;
 
     const COORD coordScreenBufferSize = screenInfo.GetBufferSize().Dimensions();
@@ -402,6 +410,37 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
         wchar_t* LocalBufPtr = LocalBuffer;
         while (*pcb < BufferSize && i < LOCAL_BUFFER_SIZE && XPosition < coordScreenBufferSize.X)
         {
+            // Fast path - bulk-copy any run of plain printable ASCII before dropping
+            // into the per-character loop below. Anything at or above space and below
+            // DEL is never a control character and never full width, so none of the
+            // per-character checks can change the outcome for it. This covers the
+            // overwhelming majority of real output, so it's worth scanning for.
+            {
+                const size_t cchRun = std::min({ (BufferSize - *pcb) / sizeof(WCHAR),
+                                                 LOCAL_BUFFER_SIZE - i,
+                                                 gsl::narrow_cast<size_t>(coordScreenBufferSize.X - XPosition) });
+                const wchar_t* pwchRun = lpString;
+                const wchar_t* const pwchRunEnd = lpString + cchRun;
+                while (pwchRun < pwchRunEnd && *pwchRun >= UNICODE_SPACE && *pwchRun < UNICODE_DEL)
+                {
+                    pwchRun++;
+                }
+
+                const size_t cchFound = pwchRun - lpString;
+                if (cchFound > 0)
+                {
+                    wmemcpy_s(LocalBufPtr, LOCAL_BUFFER_SIZE - i, lpString, cchFound);
+                    LocalBufPtr += cchFound;
+                    XPosition += gsl::narrow_cast<SHORT>(cchFound);
+                    i += cchFound;
+                    pwchBuffer += cchFound;
+                    lpString += cchFound;
+                    pwchRealUnicode += cchFound;
+                    *pcb += cchFound * sizeof(WCHAR);
+                    continue;
+                }
+            }
+
 #pragma prefast(suppress : 26019, "Buffer is taken in multiples of 2. Validation is ok.")
             const wchar_t Char = *lpString;
             const wchar_t RealUnicodeChar = *pwchRealUnicode;
@@ -859,7 +898,8 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
                 try
                 {
                     // If we're on top of a trailing cell, clear it and the previous cell.
-                    if (charRow.DbcsAttrAt(TargetPoint.X).IsTrailing())
+                    // (const access - a plain read shouldn't materialize the row's DBCS attributes)
+                    if (static_cast<const CharRow&>(charRow).DbcsAttrAt(TargetPoint.X).IsTrailing())
                     {
                         // Space to clear for 2 cells.
                         OutputCellIterator it(UNICODE_SPACE, 2);
@@ -1029,15 +1069,21 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
     }
 
     const auto& textBuffer = screenInfo.GetTextBuffer();
-    return WriteChars(screenInfo,
-                      pwchBuffer,
-                      pwchBuffer,
-                      pwchBuffer,
-                      pcbBuffer,
-                      nullptr,
-                      textBuffer.GetCursor().GetPosition().X,
-                      WC_LIMIT_BACKSPACE,
-                      nullptr);
+    const NTSTATUS Status = WriteChars(screenInfo,
+                                       pwchBuffer,
+                                       pwchBuffer,
+                                       pwchBuffer,
+                                       pcbBuffer,
+                                       nullptr,
+                                       textBuffer.GetCursor().GetPosition().X,
+                                       WC_LIMIT_BACKSPACE,
+                                       nullptr);
+    if (NT_SUCCESS(Status))
+    {
+        PerfCounters::s_Increment(PerfCounters::Counter::WriteCalls);
+        PerfCounters::s_Add(PerfCounters::Counter::CellsWritten, *pcbBuffer / sizeof(WCHAR));
+    }
+    return Status;
 }
 
 // Routine Description:
@@ -1126,6 +1172,14 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
 
         // Convert our input parameters to Unicode
         std::unique_ptr<wchar_t[]> wideCharBuffer{ nullptr };
+
+        // Legacy tools that fwrite unbuffered hit this path one byte at a
+        // time; small conversions are staged on the stack so they don't pay
+        // for a heap allocation per call. Declared at this scope because the
+        // W call below reads from it. Only used for non-UTF-8 codepages.
+        WCHAR TransBufferStack[128];
+        bool fUseHeapTransBuffer = false;
+
         static Utf8ToWideCharParser parser{ gci.OutputCP };
 
         // update current codepage in case it was changed from last time
@@ -1165,9 +1219,18 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
 
             // (cchTextBufferLength + 2) I think because we might be shoving another unicode char
             // from ScreenInfo->WriteConsoleDbcsLeadByte in front
-            TransBuffer = new WCHAR[buffer.size() + 2];
-            RETURN_IF_NULL_ALLOC(TransBuffer);
-            ZeroMemory(TransBuffer, sizeof(WCHAR) * (buffer.size() + 2));
+            const size_t cchTransBuffer = buffer.size() + 2;
+            if (cchTransBuffer <= ARRAYSIZE(TransBufferStack))
+            {
+                TransBuffer = TransBufferStack;
+            }
+            else
+            {
+                TransBuffer = new (std::nothrow) WCHAR[cchTransBuffer];
+                RETURN_IF_NULL_ALLOC(TransBuffer);
+                fUseHeapTransBuffer = true;
+            }
+            ZeroMemory(TransBuffer, sizeof(WCHAR) * cchTransBuffer);
 
             TransBufferOriginalLocation = TransBuffer;
 
@@ -1318,8 +1381,8 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
             }
         }
 
-        // Free remaining data
-        if (codepage != CP_UTF8)
+        // Free remaining data (small conversions came from the stack buffer above)
+        if (codepage != CP_UTF8 && fUseHeapTransBuffer)
         {
             delete[] pwchBuffer;
         }
@@ -24,32 +24,18 @@
 
 using Microsoft::Console::Interactivity::ServiceLocator;
 
-struct case_insensitive_hash
+// Every key in g_aliasData (exe names and alias sources) is folded to
+// lowercase before it is stored, so the maps can use the default hash and
+// equality. Lookups fold their key once up front instead of paying for a
+// lowercased heap copy of the key inside the hash functor on every probe.
+static void ToLowerInPlace(std::wstring& str)
 {
-    std::size_t operator()(const std::wstring& key) const
-    {
-        std::wstring lower(key);
-        std::transform(lower.begin(), lower.end(), lower.begin(), ::towlower);
-        std::hash<std::wstring> hash;
-        return hash(lower);
-    }
-};
-
-struct case_insensitive_equality
-{
-    bool operator()(const std::wstring& lhs, const std::wstring& rhs) const
-    {
-        return 0 == _wcsicmp(lhs.data(), rhs.data());
-    }
-};
+    std::transform(str.begin(), str.end(), str.begin(), towlower);
+}
 
 std::unordered_map<std::wstring,
                    std::unordered_map<std::wstring,
-                                      std::wstring,
-                                      case_insensitive_hash,
-                                      case_insensitive_equality>,
-                   case_insensitive_hash,
-                   case_insensitive_equality>
+                                      std::wstring>>
     g_aliasData;
 
 // Routine Description:
@@ -102,8 +88,8 @@ std::unordered_map<std::wstring,
         std::wstring sourceString(source);
         std::wstring targetString(target);
 
-        std::transform(exeNameString.begin(), exeNameString.end(), exeNameString.begin(), towlower);
-        std::transform(sourceString.begin(), sourceString.end(), sourceString.begin(), towlower);
+        ToLowerInPlace(exeNameString);
+        ToLowerInPlace(sourceString);
 
         if (targetString.size() == 0)
         {
@@ -154,15 +140,17 @@ std::unordered_map<std::wstring,
 
     std::wstring exeNameString(exeName);
     std::wstring sourceString(source);
+    ToLowerInPlace(exeNameString);
+    ToLowerInPlace(sourceString);
 
     // For compatibility, return ERROR_GEN_FAILURE for any result where the alias can't be found.
     // We use .find for the iterators then dereference to search without creating entries.
     const auto exeIter = g_aliasData.find(exeNameString);
     RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_GEN_FAILURE), exeIter == g_aliasData.end());
-    const auto exeData = exeIter->second;
+    const auto& exeData = exeIter->second;
     const auto sourceIter = exeData.find(sourceString);
     RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_GEN_FAILURE), sourceIter == exeData.end());
-    const auto targetString = sourceIter->second;
+    const auto& targetString = sourceIter->second;
     RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_GEN_FAILURE), targetString.size() == 0);
 
     // TargetLength is a byte count, convert to characters.
@@ -318,7 +306,8 @@ static std::wstring aliasesSeparator(L"=");
 
     try
     {
-        const std::wstring exeNameString(exeName);
+        std::wstring exeNameString(exeName);
+        ToLowerInPlace(exeNameString);
 
         size_t cchNeeded = 0;
 
@@ -336,8 +325,8 @@ static std::wstring aliasesSeparator(L"=");
         auto exeIter = g_aliasData.find(exeNameString);
         if (exeIter != g_aliasData.end())
         {
-            auto list = exeIter->second;
-            for (auto& pair : list)
+            const auto& list = exeIter->second;
+            for (const auto& pair : list)
             {
                 // Alias stores lengths in bytes.
                 size_t cchSource = pair.first.size();
@@ -455,6 +444,7 @@ void Alias::s_ClearCmdExeAliases()
     }
 
     std::wstring exeNameString(exeName);
+    ToLowerInPlace(exeNameString);
 
     LPWSTR AliasesBufferPtrW = aliasBuffer.has_value() ? aliasBuffer.value().data() : nullptr;
     size_t cchTotalLength = 0; // accumulate the characters we need/have copied as we walk the list
@@ -467,8 +457,8 @@ void Alias::s_ClearCmdExeAliases()
     auto exeIter = g_aliasData.find(exeNameString);
     if (exeIter != g_aliasData.end())
     {
-        auto list = exeIter->second;
-        for (auto& pair : list)
+        const auto& list = exeIter->second;
+        for (const auto& pair : list)
         {
             // Alias stores lengths in bytes.
             size_t const cchSource = pair.first.size();
@@ -1155,14 +1145,17 @@ std::wstring Alias::s_MatchAndCopyAlias(const std::wstring& sourceText,
     s_TrimLeadingSpaces(sourceCopy);
 
     // Check if we have an EXE in the list that matches the request first.
-    auto exeIter = g_aliasData.find(exeName);
+    // The stored keys are prefolded to lowercase, so fold ours once.
+    std::wstring exeNameLower(exeName);
+    ToLowerInPlace(exeNameLower);
+    auto exeIter = g_aliasData.find(exeNameLower);
     if (exeIter == g_aliasData.end())
     {
         // We found no data for this exe. Give back an empty string.
         return std::wstring();
     }
 
-    auto exeList = exeIter->second;
+    const auto& exeList = exeIter->second;
     if (exeList.size() == 0)
     {
         // If there's no match, give back an empty string.
@@ -1179,7 +1172,8 @@ std::wstring Alias::s_MatchAndCopyAlias(const std::wstring& sourceText,
     }
 
     // Find alias. If there isn't one, return an empty string
-    const auto alias = tokens.front();
+    std::wstring alias(tokens.front());
+    ToLowerInPlace(alias);
     const auto aliasIter = exeList.find(alias);
     if (aliasIter == exeList.end())
     {
@@ -1187,7 +1181,7 @@ std::wstring Alias::s_MatchAndCopyAlias(const std::wstring& sourceText,
         return std::wstring();
     }
 
-    const auto target = aliasIter->second;
+    const auto& target = aliasIter->second;
     if (target.size() == 0)
     {
         return std::wstring();
@@ -1261,7 +1255,12 @@ void Alias::s_TestAddAlias(std::wstring& exe,
                            std::wstring& alias,
                            std::wstring& target)
 {
-    g_aliasData[exe][alias] = target;
+    // Match the insertion routines: keys are stored prefolded to lowercase.
+    std::wstring exeLower(exe);
+    std::wstring aliasLower(alias);
+    ToLowerInPlace(exeLower);
+    ToLowerInPlace(aliasLower);
+    g_aliasData[exeLower][aliasLower] = target;
 }
 
 void Alias::s_TestClearAliases()
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "..\inc\AllocAccounting.hpp"
+
+#pragma hdrstop
+
+#if defined(ALLOC_ACCOUNTING)
+
+// Replacement global allocator for the accounting builds. Each block is
+// prefixed with a small header recording its size and the subsystem it was
+// charged to, so the free side can credit the right bucket no matter which
+// thread or scope it runs under. This file is part of the exe (not the host
+// lib) so the replacement operators are always selected by the link.
+//
+// Only the plain and nothrow forms are replaced; the over-aligned C++17
+// overloads fall through to the CRT in matched pairs and simply go
+// unaccounted, which no current subsystem exercises on a hot path.
+
+namespace
+{
+    struct _AllocHeader
+    {
+        size_t cb;
+        AllocAccounting::Tag tag;
+    };
+
+    // Keep the caller's storage suitably aligned after the header.
+    const size_t sc_cbHeader = 2 * sizeof(void*) >= sizeof(_AllocHeader) ? 2 * sizeof(void*) : sizeof(_AllocHeader);
+
+    void* _AccountedAllocate(const size_t cb) noexcept
+    {
+        void* const pv = malloc(cb + sc_cbHeader);
+        if (pv == nullptr)
+        {
+            return nullptr;
+        }
+
+        _AllocHeader* const pHeader = static_cast<_AllocHeader*>(pv);
+        pHeader->cb = cb;
+        pHeader->tag = AllocAccounting::s_CurrentTag();
+        AllocAccounting::s_OnAllocate(pHeader->tag, cb);
+        return static_cast<BYTE*>(pv) + sc_cbHeader;
+    }
+
+    void _AccountedFree(void* const pv) noexcept
+    {
+        if (pv == nullptr)
+        {
+            return;
+        }
+
+        _AllocHeader* const pHeader = reinterpret_cast<_AllocHeader*>(static_cast<BYTE*>(pv) - sc_cbHeader);
+        AllocAccounting::s_OnFree(pHeader->tag, pHeader->cb);
+        free(pHeader);
+    }
+}
+
+void* operator new(const size_t cb)
+{
+    void* const pv = _AccountedAllocate(cb);
+    if (pv == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pv;
+}
+
+void* operator new[](const size_t cb)
+{
+    return operator new(cb);
+}
+
+void* operator new(const size_t cb, const std::nothrow_t&) noexcept
+{
+    return _AccountedAllocate(cb);
+}
+
+void* operator new[](const size_t cb, const std::nothrow_t&) noexcept
+{
+    return _AccountedAllocate(cb);
+}
+
+void operator delete(void* const pv) noexcept
+{
+    _AccountedFree(pv);
+}
+
+void operator delete[](void* const pv) noexcept
+{
+    _AccountedFree(pv);
+}
+
+void operator delete(void* const pv, const size_t /*cb*/) noexcept
+{
+    _AccountedFree(pv);
+}
+
+void operator delete[](void* const pv, const size_t /*cb*/) noexcept
+{
+    _AccountedFree(pv);
+}
+
+void operator delete(void* const pv, const std::nothrow_t&) noexcept
+{
+    _AccountedFree(pv);
+}
+
+void operator delete[](void* const pv, const std::nothrow_t&) noexcept
+{
+    _AccountedFree(pv);
+}
+
+#endif // ALLOC_ACCOUNTING
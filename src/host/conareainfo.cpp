@@ -29,7 +29,9 @@ ConversionAreaInfo::ConversionAreaInfo(const COORD bufferSize,
                                        const FontInfo fontInfo) :
     _caInfo{ bufferSize },
     _isHidden{ true },
-    _screenBuffer{ nullptr }
+    _screenBuffer{ nullptr },
+    _writtenText{},
+    _writtenColumn{ 0 }
 {
     SCREEN_INFORMATION* pNewScreen = nullptr;
 
@@ -52,7 +54,9 @@ ConversionAreaInfo::ConversionAreaInfo(const COORD bufferSize,
 ConversionAreaInfo::ConversionAreaInfo(ConversionAreaInfo&& other) :
     _caInfo(other._caInfo),
     _isHidden(other._isHidden),
-    _screenBuffer(nullptr)
+    _screenBuffer(nullptr),
+    _writtenText(std::move(other._writtenText)),
+    _writtenColumn(other._writtenColumn)
 {
     std::swap(_screenBuffer, other._screenBuffer);
 }
@@ -114,6 +118,54 @@ void ConversionAreaInfo::WriteText(const std::vector<OutputCell>& text,
 {
     std::basic_string_view<OutputCell> view(text.data(), text.size());
     _screenBuffer->Write(view, { column, 0 });
+
+    // Remember what landed in the buffer so the next composition update can
+    // detect lines it doesn't need to rewrite.
+    _writtenText = text;
+    _writtenColumn = column;
+}
+
+// Routine Description:
+// - Compares a prospective line of composition text against what was last
+//   written into this conversion area, so unchanged lines can skip the
+//   write and repaint entirely. Composition updates typically change only
+//   the tail of the string, leaving earlier lines byte-identical.
+// Arguments:
+// - text - Candidate cells for this line
+// - column - Column the candidate cells would start at
+// Return Value:
+// - True if the area already holds exactly this content at this column.
+bool ConversionAreaInfo::HasEqualContents(const std::vector<OutputCell>& text,
+                                          const SHORT column) const noexcept
+{
+    try
+    {
+        if (column != _writtenColumn || text.size() != _writtenText.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            const auto& lhs = text[i];
+            const auto& rhs = _writtenText[i];
+
+            // Compare behaviors before attributes; TextAttr() asserts on
+            // cells that defer to the current attributes.
+            if (lhs.TextAttrBehavior() != rhs.TextAttrBehavior() ||
+                lhs.Chars() != rhs.Chars() ||
+                lhs.DbcsAttr() != rhs.DbcsAttr() ||
+                lhs.TextAttr() != rhs.TextAttr())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    CATCH_LOG();
+
+    return false;
 }
 
 // Routine Description:
@@ -125,6 +177,8 @@ void ConversionAreaInfo::ClearArea() noexcept
     try
     {
         _screenBuffer->ClearTextData();
+        _writtenText.clear();
+        _writtenColumn = 0;
     }
     CATCH_LOG();
 
@@ -136,6 +190,11 @@ void ConversionAreaInfo::ClearArea() noexcept
     // attempt to resize underlying buffers
     RETURN_IF_NTSTATUS_FAILED(_screenBuffer->ResizeScreenBuffer(newSize, FALSE));
 
+    // The resized buffer no longer matches the remembered line; force the
+    // next composition write to redraw it.
+    _writtenText.clear();
+    _writtenColumn = 0;
+
     // store new size
     _caInfo.coordCaBuffer = newSize;
 
@@ -174,6 +233,13 @@ void ConversionAreaInfo::SetWindowInfo(const SMALL_RECT view) noexcept
 
 void ConversionAreaInfo::SetViewPos(const COORD pos) noexcept
 {
+    if (pos.X == _caInfo.coordConView.X && pos.Y == _caInfo.coordConView.Y)
+    {
+        // Not moving; repainting both the old and new regions would redraw
+        // the entire area for nothing on every composition keystroke.
+        return;
+    }
+
     if (IsHidden())
     {
         _caInfo.coordConView = pos;
@@ -62,6 +62,7 @@ public:
     void Paint() const noexcept;
 
     void WriteText(const std::vector<OutputCell>& text, const SHORT column);
+    bool HasEqualContents(const std::vector<OutputCell>& text, const SHORT column) const noexcept;
     void SetAttributes(const TextAttribute& attr);
 
     const TextBuffer& GetTextBuffer() const noexcept;
@@ -71,4 +72,9 @@ private:
     ConversionAreaBufferInfo _caInfo;
     std::unique_ptr<SCREEN_INFORMATION> _screenBuffer;
     bool _isHidden;
+
+    // Copy of the last line written into the backing buffer so a composition
+    // update that leaves this line untouched can skip the write and repaint.
+    std::vector<OutputCell> _writtenText;
+    SHORT _writtenColumn;
 };
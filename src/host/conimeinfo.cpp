@@ -43,7 +43,9 @@ void ConsoleImeInfo::RedrawCompMessage()
 {
     if (!_text.empty())
     {
-        ClearAllAreas();
+        // Note that we cannot use ClearAllAreas here: it clears the saved
+        // composition out from under us before we can redraw it. The write
+        // below will refresh the retained areas and hide any leftovers.
         _WriteUndeterminedChars(_text, _attributes, _colorArray);
     }
 }
@@ -63,8 +65,6 @@ void ConsoleImeInfo::WriteCompMessage(const std::wstring_view text,
     // Backup the cursor visibility state and turn it off for drawing.
     _SaveCursorVisibility();
 
-    ClearAllAreas();
-
     // Save copies of the composition message in case we need to redraw it as things scroll/resize
     _text = text;
     _attributes = attributes;
@@ -174,6 +174,25 @@ void ConsoleImeInfo::ClearAllAreas()
     return S_OK;
 }
 
+// Routine Description:
+// - Retrieves the conversion area (line) at the given index, growing the list
+//   as necessary. Conversion areas are retained between composition updates
+//   so their backing screen buffers can be reused instead of reallocated on
+//   every keystroke.
+// Arguments:
+// - index - Which conversion area (line) is wanted
+// Return Value:
+// - Reference to the conversion area. Throws if one had to be made and couldn't be.
+ConversionAreaInfo& ConsoleImeInfo::_GetConversionArea(const size_t index)
+{
+    while (ConvAreaCompStr.size() <= index)
+    {
+        THROW_IF_FAILED(_AddConversionArea());
+    }
+
+    return ConvAreaCompStr[index];
+}
+
 // Routine Description:
 // - Helper method to decode the cursor and color position out of the encoded attributes
 //   and color array and return it in the TextAttribute structure format
@@ -226,14 +245,14 @@ std::vector<OutputCell> ConsoleImeInfo::s_ConvertToCells(const std::wstring_view
 {
     std::vector<OutputCell> cells;
 
-    // - Convert incoming wchar_t stream into UTF-16 units.
-    const auto glyphs = Utf16Parser::Parse(text);
+    // - Convert incoming wchar_t stream into UTF-16 units. The spans point
+    //   into `text`, which outlives them, so nothing is copied per glyph.
+    const auto glyphs = Utf16Parser::ParseSpans(text);
 
     // - Walk through all of the grouped up text, match up the correct attribute to it, and make a new cell.
     size_t attributesUsed = 0;
-    for (const auto& parsedGlyph : glyphs)
+    for (const auto& glyph : glyphs)
     {
-        const std::wstring_view glyph{ parsedGlyph.data(), parsedGlyph.size() };
         // Collect up attributes that apply to this glyph range.
         auto drawingAttr = s_RetrieveAttributeAt(attributesUsed, attributes, colorArray);
         attributesUsed++;
@@ -297,6 +316,7 @@ std::vector<OutputCell> ConsoleImeInfo::s_ConvertToCells(const std::wstring_view
 // Arguments:
 // - begin - Beginning position in OutputCells for iteration
 // - end - Ending position in OutputCells for iteration
+// - areaIndex - Which retained conversion area (line) this call should fill
 // - pos - Reference to the coordinate position in the viewport that this conversion area will occupy.
 //       - Updated to set up the next conversion area down a line (and to the left viewport edge)
 // - view - The rectangle representing the viewable area of the screen right now to let us know how many cells can fit.
@@ -308,6 +328,7 @@ std::vector<OutputCell> ConsoleImeInfo::s_ConvertToCells(const std::wstring_view
 //   If the viewport is deemed too small, we'll skip past it and advance begin past the entire full-width character.
 std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(const std::vector<OutputCell>::const_iterator begin,
                                                                              const std::vector<OutputCell>::const_iterator end,
+                                                                             const size_t areaIndex,
                                                                              COORD& pos,
                                                                              const Microsoft::Console::Types::Viewport view,
                                                                              SCREEN_INFORMATION& screenInfo)
@@ -354,27 +375,36 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
     // Copy out the substring into a vector.
     const std::vector<OutputCell> lineVec(lineBegin, lineEnd);
 
-    // Add a conversion area to the internal state to hold this line.
-    THROW_IF_FAILED(_AddConversionArea());
+    // Retrieve the retained conversion area for this line (making it if this
+    // composition has more lines than any before it).
+    auto& area = _GetConversionArea(areaIndex);
 
-    // Get the added conversion area.
-    auto& area = ConvAreaCompStr.back();
+    // Composition updates usually only touch the tail of the string, so lines
+    // before the edit are frequently identical to what this area already holds.
+    const bool fSameContents = area.HasEqualContents(lineVec, insertionPos.X);
 
-    // Write our text into the conversion area.
-    area.WriteText(lineVec, insertionPos.X);
+    // Write our text into the conversion area (unless it already holds it).
+    if (!fSameContents)
+    {
+        area.WriteText(lineVec, insertionPos.X);
+    }
 
     // Set the viewport and positioning parameters for the conversion area to describe to the renderer
     // the appropriate location to overlay this conversion area on top of the main screen buffer inside the viewport.
+    // Both of these only repaint when the value actually changes.
     const SMALL_RECT region{ insertionPos.X, 0, gsl::narrow<SHORT>(insertionPos.X + lineVec.size() - 1), 0 };
     area.SetWindowInfo(region);
     area.SetViewPos({ 0 - view.Left(), insertionPos.Y - view.Top() });
 
-    // Make it visible and paint it.
-    area.SetHidden(false);
-    area.Paint();
+    if (!fSameContents || area.IsHidden())
+    {
+        // Make it visible and paint it.
+        area.SetHidden(false);
+        area.Paint();
 
-    // Notify accessibility that we have updated the text in this display region within the viewport.
-    screenInfo.NotifyAccessibilityEventing(insertionPos.X, insertionPos.Y, gsl::narrow<SHORT>(insertionPos.X + lineVec.size() - 1), insertionPos.Y);
+        // Notify accessibility that we have updated the text in this display region within the viewport.
+        screenInfo.NotifyAccessibilityEventing(insertionPos.X, insertionPos.Y, gsl::narrow<SHORT>(insertionPos.X + lineVec.size() - 1), insertionPos.Y);
+    }
 
     // Hand back the iterator representing the end of what we used to be fed into the beginning of the next call.
     return lineEnd;
@@ -400,16 +430,20 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     // Ensure cursor is visible for prompt line
     screenInfo.MakeCurrentCursorVisible();
 
-    // Clear out existing conversion areas.
-    ConvAreaCompStr.clear();
-
     // If the text length and attribute length don't match,
     // it's a programming error on our part. We control the sizes here.
     FAIL_FAST_IF(text.size() != attributes.size());
 
-    // If we have no text, return. We've already cleared above.
+    // The number of retained conversion areas this composition will fill.
+    // Any areas beyond this count are leftovers from a longer composition
+    // and get hidden below rather than destroyed, so their backing buffers
+    // can be reused by the next composition.
+    size_t areasUsed = 0;
+
+    // If we have no text, just hide any leftover areas and return.
     if (text.empty())
     {
+        _HideLeftoverAreas(areasUsed);
         return;
     }
 
@@ -432,8 +466,29 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     // Write over and over updating the beginning iterator until we reach the end.
     do
     {
-        begin = _WriteConversionArea(begin, end, pos, view, screenInfo);
+        begin = _WriteConversionArea(begin, end, areasUsed, pos, view, screenInfo);
+        areasUsed++;
     } while (begin < end);
+
+    // Hide any areas left over from a previous, longer composition.
+    _HideLeftoverAreas(areasUsed);
+}
+
+// Routine Description:
+// - Hides any retained conversion areas past the ones the current composition
+//   is using. The areas themselves (and their backing buffers) stay allocated
+//   for the next composition.
+// Arguments:
+// - areasUsed - The number of areas in use; everything at this index and beyond is cleared.
+void ConsoleImeInfo::_HideLeftoverAreas(const size_t areasUsed)
+{
+    for (size_t i = areasUsed; i < ConvAreaCompStr.size(); i++)
+    {
+        if (!ConvAreaCompStr[i].IsHidden())
+        {
+            ConvAreaCompStr[i].ClearArea();
+        }
+    }
 }
 
 // Routine Description:
@@ -58,6 +58,10 @@ public:
 private:
     [[nodiscard]] HRESULT _AddConversionArea();
 
+    ConversionAreaInfo& _GetConversionArea(const size_t index);
+
+    void _HideLeftoverAreas(const size_t areasUsed);
+
     void _ClearComposition();
 
     void _WriteUndeterminedChars(const std::wstring_view text,
@@ -76,6 +80,7 @@ private:
 
     std::vector<OutputCell>::const_iterator _WriteConversionArea(const std::vector<OutputCell>::const_iterator begin,
                                                                  const std::vector<OutputCell>::const_iterator end,
+                                                                 const size_t areaIndex,
                                                                  COORD& pos,
                                                                  const Microsoft::Console::Types::Viewport view,
                                                                  SCREEN_INFORMATION& screenInfo);
@@ -7,6 +7,7 @@
 #include "misc.h"
 #include "output.h"
 #include "srvinit.h"
+#include "tracing.hpp"
 
 #include "..\interactivity\inc\ServiceLocator.hpp"
 #include "..\types\inc\convert.hpp"
@@ -42,7 +43,11 @@ CONSOLE_INFORMATION::CONSOLE_INFORMATION() :
 {
     ZeroMemory((void*)&CPInfo, sizeof(CPInfo));
     ZeroMemory((void*)&OutputCPInfo, sizeof(OutputCPInfo));
-    InitializeCriticalSection(&_csConsoleLock);
+    // Spin before sleeping: the lock is taken for very short stretches from
+    // many threads (driver dispatch, input thread, render thread), and on
+    // multi-core machines a brief spin avoids a kernel wait round trip for
+    // the common case where the current holder is about to release.
+    InitializeCriticalSectionAndSpinCount(&_csConsoleLock, 4000);
 }
 
 CONSOLE_INFORMATION::~CONSOLE_INFORMATION()
@@ -60,7 +65,20 @@ bool CONSOLE_INFORMATION::IsConsoleLocked() const
 #pragma prefast(suppress : 26135, "Adding lock annotation spills into entire project. Future work.")
 void CONSOLE_INFORMATION::LockConsole()
 {
-    EnterCriticalSection(&_csConsoleLock);
+    // The uncontended acquire must stay a single interlocked operation, so
+    // only the contended path pays the two QPC reads that feed the lock wait
+    // counter.
+    if (!TryEnterCriticalSection(&_csConsoleLock))
+    {
+        LARGE_INTEGER liStart;
+        QueryPerformanceCounter(&liStart);
+
+        EnterCriticalSection(&_csConsoleLock);
+
+        LARGE_INTEGER liEnd;
+        QueryPerformanceCounter(&liEnd);
+        PerfCounters::s_Add(PerfCounters::Counter::LockWaitTicks, liEnd.QuadPart - liStart.QuadPart);
+    }
 }
 
 #pragma prefast(suppress : 26135, "Adding lock annotation spills into entire project. Future work.")
@@ -72,6 +90,15 @@ bool CONSOLE_INFORMATION::TryLockConsole()
 #pragma prefast(suppress : 26135, "Adding lock annotation spills into entire project. Future work.")
 void CONSOLE_INFORMATION::UnlockConsole()
 {
+    // On the last release, refresh the lock-free screen buffer info snapshot
+    // so pollers observe whatever this lock batch changed. This must live
+    // here rather than in the handle.cpp wrapper: UIA, the IME, and the input
+    // thread all release through this method directly.
+    if (_csConsoleLock.RecursionCount == 1)
+    {
+        PublishScreenBufferInfoSnapshot();
+    }
+
     LeaveCriticalSection(&_csConsoleLock);
 }
 
@@ -80,6 +107,139 @@ ULONG CONSOLE_INFORMATION::GetCSRecursionCount()
     return _csConsoleLock.RecursionCount;
 }
 
+// Routine Description:
+// - Refreshes the seqlock-published CONSOLE_SCREEN_BUFFER_INFOEX snapshot from
+//   the active output buffer. Called with the console lock held, on its final
+//   release, so the published data is exactly what a locked reader would have
+//   observed at that moment.
+// - dwMaximumWindowSize is the one expensive field (it asks the window metrics
+//   provider about the monitor); it is only recomputed when its inputs - the
+//   buffer size, the viewport size, or the font - changed since the last
+//   publish.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void CONSOLE_INFORMATION::PublishScreenBufferInfoSnapshot() noexcept
+{
+    try
+    {
+        if (!HasActiveOutputBuffer())
+        {
+            return;
+        }
+
+        const SCREEN_INFORMATION& active = GetActiveOutputBuffer().GetActiveBuffer();
+
+        CONSOLE_SCREEN_BUFFER_INFOEX data = { 0 };
+        data.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
+        data.bFullscreenSupported = FALSE; // traditional full screen with the driver support is no longer supported.
+        data.dwSize = active.GetBufferSize().Dimensions();
+        data.dwCursorPosition = active.GetTextBuffer().GetCursor().GetPosition();
+        data.srWindow = active.GetViewport().ToInclusive();
+        data.wAttributes = GenerateLegacyAttributes(active.GetAttributes());
+        data.wPopupAttributes = GenerateLegacyAttributes(*active.GetPopupAttributes());
+        memmove(data.ColorTable, GetColorTable(), COLOR_TABLE_SIZE * sizeof(COLORREF));
+
+        // Consumers of the snapshot expect to receive an exclusive rect, not an inclusive one.
+        data.srWindow.Right += 1;
+        data.srWindow.Bottom += 1;
+
+        // We are the only writer (the console lock is held), so a relaxed read
+        // of our own sequence is fine.
+        const ULONG sequence = _sbiexSnapshotSequence.load(std::memory_order_relaxed);
+
+        const COORD coordFontSize = active.GetScreenFontSize();
+        if (sequence != 0 &&
+            coordFontSize.X == _sbiexSnapshotFontSize.X &&
+            coordFontSize.Y == _sbiexSnapshotFontSize.Y &&
+            data.dwSize.X == _sbiexSnapshot.dwSize.X &&
+            data.dwSize.Y == _sbiexSnapshot.dwSize.Y &&
+            (data.srWindow.Right - data.srWindow.Left) == (_sbiexSnapshot.srWindow.Right - _sbiexSnapshot.srWindow.Left) &&
+            (data.srWindow.Bottom - data.srWindow.Top) == (_sbiexSnapshot.srWindow.Bottom - _sbiexSnapshot.srWindow.Top))
+        {
+            data.dwMaximumWindowSize = _sbiexSnapshot.dwMaximumWindowSize;
+        }
+        else
+        {
+            data.dwMaximumWindowSize = active.GetMaxWindowSizeInCharacters();
+        }
+
+        const SCREEN_INFORMATION* const pSource = &active;
+        const SCREEN_INFORMATION* const pMain = &active.GetMainBuffer();
+
+        // Most final releases didn't touch anything a poller can see; skip the
+        // sequence bump (and the reader-side cache line invalidation) when the
+        // published data would come out identical.
+        if (sequence != 0 &&
+            pSource == _sbiexSnapshotSource &&
+            pMain == _sbiexSnapshotMain &&
+            memcmp(&data, &_sbiexSnapshot, sizeof(data)) == 0)
+        {
+            return;
+        }
+
+        // Seqlock write: the odd sequence marks the data as unstable, so
+        // readers retry or fall back to the locked path until the closing
+        // increment lands.
+        _sbiexSnapshotSequence.fetch_add(1, std::memory_order_acq_rel);
+        _sbiexSnapshot = data;
+        _sbiexSnapshotSource = pSource;
+        _sbiexSnapshotMain = pMain;
+        _sbiexSnapshotFontSize = coordFontSize;
+        _sbiexSnapshotSequence.fetch_add(1, std::memory_order_release);
+    }
+    CATCH_LOG();
+}
+
+// Routine Description:
+// - Serves a GetConsoleScreenBufferInfoEx query from the published snapshot
+//   without taking the console lock. Fails whenever the snapshot can't be
+//   proven to describe the queried buffer - never published, mid-update,
+//   republished while we copied, or belonging to a different screen buffer -
+//   in which case the caller takes the locked path instead.
+// Arguments:
+// - context - the screen buffer the query's handle resolved to
+// - data - receives the snapshot on success; the caller's cbSize is preserved
+// Return Value:
+// - true if data was filled from the snapshot.
+bool CONSOLE_INFORMATION::TryReadScreenBufferInfoSnapshot(const SCREEN_INFORMATION* const context,
+                                                          CONSOLE_SCREEN_BUFFER_INFOEX& data) const noexcept
+{
+    const ULONG sequence = _sbiexSnapshotSequence.load(std::memory_order_acquire);
+    if (sequence == 0 || (sequence & 1) != 0)
+    {
+        return false;
+    }
+
+    CONSOLE_SCREEN_BUFFER_INFOEX copy = _sbiexSnapshot;
+    const SCREEN_INFORMATION* const pSource = _sbiexSnapshotSource;
+    const SCREEN_INFORMATION* const pMain = _sbiexSnapshotMain;
+
+    // The fence orders the copy above against the sequence re-check below: if
+    // the sequence moved, a publish raced the copy and it may be torn.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_sbiexSnapshotSequence.load(std::memory_order_relaxed) != sequence)
+    {
+        return false;
+    }
+
+    // The snapshot answers for the buffer it was read from and, because the
+    // API resolves queries to the active buffer, for the main buffer it hangs
+    // off of. Handles to any other (inactive, user-created) screen buffer
+    // take the locked path. The pointers are only ever compared, never
+    // dereferenced, so a buffer torn down since the publish is harmless.
+    if (context != pSource && context != pMain)
+    {
+        return false;
+    }
+
+    const ULONG cbSize = data.cbSize;
+    data = copy;
+    data.cbSize = cbSize;
+    return true;
+}
+
 // Routine Description:
 // - This routine allocates and initialized a console and its associated
 //   data - input buffer and screen buffer.
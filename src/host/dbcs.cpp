@@ -160,24 +160,24 @@ _Ret_range_(0, cbAnsi)
                                 _Out_ std::unique_ptr<IInputEvent>& partialEvent)
 {
     const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
-    PWCHAR const TmpUni = new (std::nothrow) WCHAR[cchUnicode];
-    if (TmpUni == nullptr)
-    {
-        return 0;
-    }
-
-    memcpy(TmpUni, pwchUnicode, cchUnicode * sizeof(WCHAR));
 
     BYTE AsciiDbcs[2];
     AsciiDbcs[1] = 0;
 
-    ULONG i, j;
-    for (i = 0, j = 0; i < cchUnicode && j < cbAnsi; i++, j++)
+    // The source is consumed a run at a time: maximal stretches of narrow
+    // characters go through the converter in one call, and only full width
+    // characters - where the lead/trail byte accounting lives - are handled
+    // individually. Narrow characters translate to one byte apiece in the
+    // OEM codepages (the per-character code this replaces leaned on the same
+    // guarantee), so a narrow run fits its target byte-for-byte.
+    ULONG i = 0, j = 0;
+    while (i < cchUnicode && j < cbAnsi)
     {
-        if (IsGlyphFullWidth(TmpUni[i]))
+        if (IsGlyphFullWidth(pwchUnicode[i]))
         {
             ULONG const NumBytes = sizeof(AsciiDbcs);
-            ConvertToOem(gci.CP, &TmpUni[i], 1, (LPSTR)&AsciiDbcs[0], NumBytes);
+            ConvertToOem(gci.CP, &pwchUnicode[i], 1, (LPSTR)&AsciiDbcs[0], NumBytes);
+            i++;
             if (IsDBCSLeadByteConsole(AsciiDbcs[0], &gci.CPInfo))
             {
                 if (j < cbAnsi - 1)
@@ -186,6 +186,7 @@ _Ret_range_(0, cbAnsi)
                     j++;
                     pchAnsi[j] = AsciiDbcs[1];
                     AsciiDbcs[1] = 0;
+                    j++;
                 }
                 else
                 {
@@ -197,11 +198,21 @@ _Ret_range_(0, cbAnsi)
             {
                 pchAnsi[j] = AsciiDbcs[0];
                 AsciiDbcs[1] = 0;
+                j++;
             }
         }
         else
         {
-            ConvertToOem(gci.CP, &TmpUni[i], 1, &pchAnsi[j], 1);
+            ULONG cchRun = 1;
+            while (i + cchRun < cchUnicode &&
+                   j + cchRun < cbAnsi &&
+                   !IsGlyphFullWidth(pwchUnicode[i + cchRun]))
+            {
+                cchRun++;
+            }
+            ConvertToOem(gci.CP, &pwchUnicode[i], cchRun, &pchAnsi[j], cchRun);
+            i += cchRun;
+            j += cchRun;
         }
     }
 
@@ -222,6 +233,5 @@ _Ret_range_(0, cbAnsi)
         }
     }
 
-    delete[] TmpUni;
     return j;
 }
@@ -152,7 +152,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 // block, this will be returned along with context in *ppWaiter.
 // - Or an out of memory/math/string error message in NTSTATUS format.
 [[nodiscard]] static NTSTATUS _DoGetConsoleInput(InputBuffer& inputBuffer,
-                                                 std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                 std::deque<INPUT_RECORD>& outEvents,
                                                  const size_t eventReadCount,
                                                  INPUT_READ_HANDLE_DATA& readHandleState,
                                                  const bool IsUnicode,
@@ -171,13 +171,44 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
         LockConsole();
         auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
 
-        std::deque<std::unique_ptr<IInputEvent>> partialEvents;
-        if (!IsUnicode)
+        // Unicode reads need no codepage splitting and never involve partial
+        // byte sequences, so the records travel straight from the buffer's
+        // flat storage to the caller without materializing event objects.
+        if (IsUnicode)
         {
-            if (inputBuffer.IsReadPartialByteSequenceAvailable())
+            std::deque<INPUT_RECORD> readRecords;
+            NTSTATUS Status = inputBuffer.Read(readRecords,
+                                               eventReadCount,
+                                               IsPeek,
+                                               true,
+                                               IsUnicode,
+                                               false);
+
+            if (CONSOLE_STATUS_WAIT == Status)
             {
-                partialEvents.push_back(inputBuffer.FetchReadPartialByteSequence(IsPeek));
+                FAIL_FAST_IF(!(readRecords.empty()));
+                // If we're told to wait until later, move all of our context
+                // to the read data object and send it back up to the server.
+                waiter = std::make_unique<DirectReadData>(&inputBuffer,
+                                                          &readHandleState,
+                                                          eventReadCount,
+                                                          std::deque<std::unique_ptr<IInputEvent>>{});
             }
+            else if (NT_SUCCESS(Status))
+            {
+                while (!readRecords.empty())
+                {
+                    outEvents.push_back(readRecords.front());
+                    readRecords.pop_front();
+                }
+            }
+            return Status;
+        }
+
+        std::deque<std::unique_ptr<IInputEvent>> partialEvents;
+        if (inputBuffer.IsReadPartialByteSequenceAvailable())
+        {
+            partialEvents.push_back(inputBuffer.FetchReadPartialByteSequence(IsPeek));
         }
 
         size_t amountToRead;
@@ -206,14 +237,11 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
         else if (NT_SUCCESS(Status))
         {
             // split key events to oem chars if necessary
-            if (!IsUnicode)
+            try
             {
-                try
-                {
-                    SplitToOem(readEvents);
-                }
-                CATCH_LOG();
+                SplitToOem(readEvents);
             }
+            CATCH_LOG();
 
             // combine partial and readEvents
             while (!partialEvents.empty())
@@ -222,14 +250,14 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
                 partialEvents.pop_back();
             }
 
-            // move events over
+            // move events over, flattening back to records at the boundary
             for (size_t i = 0; i < eventReadCount; ++i)
             {
                 if (readEvents.empty())
                 {
                     break;
                 }
-                outEvents.push_back(std::move(readEvents.front()));
+                outEvents.push_back(readEvents.front()->ToInputRecord());
                 readEvents.pop_front();
             }
 
@@ -266,7 +294,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 // buffer), this contains context that will allow the server to
 // restore this call later.
 [[nodiscard]] HRESULT ApiRoutines::PeekConsoleInputAImpl(IConsoleInputObject& context,
-                                                         std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                         std::deque<INPUT_RECORD>& outEvents,
                                                          const size_t eventsToRead,
                                                          INPUT_READ_HANDLE_DATA& readHandleState,
                                                          std::unique_ptr<IWaitRoutine>& waiter) noexcept
@@ -301,7 +329,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 // buffer), this contains context that will allow the server to
 // restore this call later.
 [[nodiscard]] HRESULT ApiRoutines::PeekConsoleInputWImpl(IConsoleInputObject& context,
-                                                         std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                         std::deque<INPUT_RECORD>& outEvents,
                                                          const size_t eventsToRead,
                                                          INPUT_READ_HANDLE_DATA& readHandleState,
                                                          std::unique_ptr<IWaitRoutine>& waiter) noexcept
@@ -336,7 +364,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 // buffer), this contains context that will allow the server to
 // restore this call later.
 [[nodiscard]] HRESULT ApiRoutines::ReadConsoleInputAImpl(IConsoleInputObject& context,
-                                                         std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                         std::deque<INPUT_RECORD>& outEvents,
                                                          const size_t eventsToRead,
                                                          INPUT_READ_HANDLE_DATA& readHandleState,
                                                          std::unique_ptr<IWaitRoutine>& waiter) noexcept
@@ -371,7 +399,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 // buffer), this contains context that will allow the server to
 // restore this call later.
 [[nodiscard]] HRESULT ApiRoutines::ReadConsoleInputWImpl(IConsoleInputObject& context,
-                                                         std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                         std::deque<INPUT_RECORD>& outEvents,
                                                          const size_t eventsToRead,
                                                          INPUT_READ_HANDLE_DATA& readHandleState,
                                                          std::unique_ptr<IWaitRoutine>& waiter) noexcept
@@ -507,6 +535,15 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 
     try
     {
+        // Appends go straight from the client's record array into the flat
+        // storage; no event objects are built for them. Prepends are rare
+        // (VT response injection) and keep the event-based replay path.
+        if (append)
+        {
+            written = context.Write(gsl::span<const INPUT_RECORD>(buffer.data(), buffer.size()));
+            return S_OK;
+        }
+
         auto events = IInputEvent::Create(buffer);
 
         return _WriteConsoleInputWImplHelper(context, events, written, append);
@@ -590,20 +627,23 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 {
     try
     {
-        std::vector<CHAR_INFO> tempBuffer(buffer.cbegin(), buffer.cend());
-
         const auto size = rectangle.Dimensions();
-        auto tempIter = tempBuffer.cbegin();
         auto outIter = buffer.begin();
 
         for (int i = 0; i < size.Y; i++)
         {
             for (int j = 0; j < size.X; j++)
             {
+                // The converted ascii char overlays the unicode char it came
+                // from, so stash the source cell before writing. The read and
+                // write positions walk in lockstep, which is why one local
+                // cell suffices instead of a temporary copy of the buffer.
+                const auto cell = *outIter;
+
                 // Any time we see the lead flag, we presume there will be a trailing one following it.
                 // Giving us two bytes of space (one per cell in the ascii part of the character union)
                 // to fill with whatever this Unicode character converts into.
-                if (WI_IsFlagSet(tempIter->Attributes, COMMON_LVB_LEADING_BYTE))
+                if (WI_IsFlagSet(cell.Attributes, COMMON_LVB_LEADING_BYTE))
                 {
                     // As long as we're not looking at the exact last column of the buffer...
                     if (j < size.X - 1)
@@ -614,37 +654,30 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
                         // Try to convert the unicode character (2 bytes) in the leading cell to the codepage.
                         CHAR AsciiDbcs[2] = { 0 };
                         UINT NumBytes = gsl::narrow<UINT>(sizeof(AsciiDbcs));
-                        NumBytes = ConvertToOem(codepage, &tempIter->Char.UnicodeChar, 1, &AsciiDbcs[0], NumBytes);
+                        NumBytes = ConvertToOem(codepage, &cell.Char.UnicodeChar, 1, &AsciiDbcs[0], NumBytes);
 
                         // Fill the 1 byte (AsciiChar) portion of the leading and trailing cells with each of the bytes returned.
+                        // The attributes of both cells stay as they were.
                         outIter->Char.AsciiChar = AsciiDbcs[0];
-                        outIter->Attributes = tempIter->Attributes;
                         outIter++;
-                        tempIter++;
                         outIter->Char.AsciiChar = AsciiDbcs[1];
-                        outIter->Attributes = tempIter->Attributes;
                         outIter++;
-                        tempIter++;
                     }
                     else
                     {
                         // When we're in the last column with only a leading byte, we can't return that without a trailing.
                         // Instead, replace the output data with just a space and clear all flags.
                         outIter->Char.AsciiChar = UNICODE_SPACE;
-                        outIter->Attributes = tempIter->Attributes;
                         WI_ClearAllFlags(outIter->Attributes, COMMON_LVB_SBCSDBCS);
                         outIter++;
-                        tempIter++;
                     }
                 }
-                else if (WI_AreAllFlagsClear(tempIter->Attributes, COMMON_LVB_SBCSDBCS))
+                else if (WI_AreAllFlagsClear(cell.Attributes, COMMON_LVB_SBCSDBCS))
                 {
                     // If there are no leading/trailing pair flags, then we only have 1 ascii byte to try to fit the
                     // 2 byte UTF-16 character into. Give it a go.
-                    ConvertToOem(codepage, &tempIter->Char.UnicodeChar, 1, &outIter->Char.AsciiChar, 1);
-                    outIter->Attributes = tempIter->Attributes;
+                    ConvertToOem(codepage, &cell.Char.UnicodeChar, 1, &outIter->Char.AsciiChar, 1);
                     outIter++;
-                    tempIter++;
                 }
             }
         }
@@ -860,6 +893,34 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
             // If the point we're trying to write is inside the limited buffer write zone...
             if (targetLimit.IsInBounds(targetPos))
             {
+                // Try to translate a whole run of plain single-width cells
+                // sharing one attribute in one go. The run is clamped to the
+                // clipped source rectangle, so it cannot leave the in-bounds
+                // part of the current target row; the legacy attributes only
+                // have to be generated once for the entire run.
+                const auto span = sourceIter.TryGetSpan();
+                if (span.has_value() && span->text.size() > 1)
+                {
+                    const auto cells = std::min(span->text.size(),
+                                                gsl::narrow_cast<size_t>(targetBuffer.end() - targetIter));
+                    const WORD legacyAttributes = gci.GenerateLegacyAttributes(span->attr);
+                    for (size_t i = 0; i < cells; i++)
+                    {
+                        targetIter->Char.UnicodeChar = span->text[i];
+                        targetIter->Attributes = legacyAttributes;
+                        targetIter++;
+                    }
+                    sourceIter += gsl::narrow_cast<ptrdiff_t>(cells);
+
+                    targetPos.X += gsl::narrow<SHORT>(cells);
+                    if (targetPos.X >= targetSize.X)
+                    {
+                        targetPos.X = 0;
+                        targetPos.Y++;
+                    }
+                    continue;
+                }
+
                 // Copy the data into position...
                 *targetIter = gci.AsCharInfo(*sourceIter);
                 // ... and advance the read iterator.
@@ -1025,11 +1086,15 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
             // Convert to a CHAR_INFO view to fit into the iterator
             const auto charInfos = std::basic_string_view<CHAR_INFO>(subspan.data(), subspan.size());
 
-            // Make the iterator and write to the target position.
+            // Make the iterator and write the row, deferring the paint
+            // notification; the whole rectangle is invalidated once below
+            // instead of once per row.
             OutputCellIterator it(charInfos);
-            storageBuffer.Write(it, target);
+            storageBuffer.GetTextBuffer().WriteLine(it, target, true, std::nullopt, false);
         }
 
+        storageBuffer.GetTextBuffer().GetRenderTarget().TriggerRedraw(writeRectangle);
+
         // Since we've managed to write part of the request, return the clamped part that we actually used.
         writtenRectangle = writeRectangle;
 
@@ -1180,7 +1245,7 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
                                                  _In_ PCD_CREATE_OBJECT_INFORMATION Information,
                                                  _In_ PCONSOLE_CREATESCREENBUFFER_MSG a)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::CreateConsoleScreenBuffer);
+    Telemetry::LogApiCall(Telemetry::ApiCall::CreateConsoleScreenBuffer);
     const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
 
     // If any buffer type except the one we support is set, it's invalid.
@@ -0,0 +1,265 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include <algorithm>
+#include <vector>
+
+using WEX::Logging::Log;
+using namespace WEX::Common;
+
+// This class is intended to measure, not verify:
+// WriteConsole
+// WriteConsoleOutput
+// ReadConsoleInput
+// SetConsoleCursorPosition
+// It drives the real conhost over the real driver interface - the same path
+// the functional tests above use - and logs throughput plus latency
+// percentiles for each scenario. There are deliberately no pass/fail
+// thresholds; the numbers are emitted in a stable tab-separated form so runs
+// can be diffed against prior commits from the logged results.
+class PerfTests
+{
+    BEGIN_TEST_CLASS(PerfTests)
+        TEST_CLASS_PROPERTY(L"BinaryUnderTest", L"conhost.exe")
+        TEST_CLASS_PROPERTY(L"ArtifactUnderTest", L"wincon.h")
+        TEST_CLASS_PROPERTY(L"ArtifactUnderTest", L"conmsgl1.h")
+        TEST_CLASS_PROPERTY(L"ArtifactUnderTest", L"conmsgl2.h")
+    END_TEST_CLASS()
+
+    TEST_METHOD_SETUP(TestSetup);
+    TEST_METHOD_CLEANUP(TestCleanup);
+
+    BEGIN_TEST_METHOD(PerfWriteConsoleChunked)
+        // Spans the shapes clients actually produce: character-at-a-time
+        // emitters, line-oriented tools, and block writers.
+        TEST_METHOD_PROPERTY(L"Data:cchChunk", L"{16, 256, 4096, 65536}")
+    END_TEST_METHOD()
+
+    TEST_METHOD(PerfWriteConsoleOutputRects);
+    TEST_METHOD(PerfReadConsoleInputFlood);
+    TEST_METHOD(PerfSetConsoleCursorPosition);
+
+private:
+    static double s_NsPerQpcTick();
+    static void s_ReportScenario(PCWSTR pwszScenario,
+                                 const size_t cOperations,
+                                 const double dblTotalBytes,
+                                 std::vector<double>& latenciesNs);
+};
+
+bool PerfTests::TestSetup()
+{
+    return Common::TestBufferSetup();
+}
+
+bool PerfTests::TestCleanup()
+{
+    return Common::TestBufferCleanup();
+}
+
+double PerfTests::s_NsPerQpcTick()
+{
+    LARGE_INTEGER liFrequency;
+    QueryPerformanceFrequency(&liFrequency);
+    return 1.0e9 / static_cast<double>(liFrequency.QuadPart);
+}
+
+// Routine Description:
+// - Sorts the collected per-operation latencies and logs one tab-separated
+//   report line. The column layout is part of the contract - tooling diffs
+//   these lines across commits - so add columns at the end if you need more.
+// Arguments:
+// - pwszScenario - Stable scenario identifier for the report line
+// - cOperations - Number of timed operations in the run
+// - dblTotalBytes - Total payload bytes moved, for the throughput column (0 to skip)
+// - latenciesNs - Per-operation latencies in nanoseconds; sorted in place
+void PerfTests::s_ReportScenario(PCWSTR pwszScenario,
+                                 const size_t cOperations,
+                                 const double dblTotalBytes,
+                                 std::vector<double>& latenciesNs)
+{
+    std::sort(latenciesNs.begin(), latenciesNs.end());
+
+    double dblTotalNs = 0.0;
+    for (const auto sample : latenciesNs)
+    {
+        dblTotalNs += sample;
+    }
+
+    const double dblMBPerSec = (dblTotalBytes > 0.0) ?
+                                   (dblTotalBytes / (1024.0 * 1024.0)) / (dblTotalNs / 1.0e9) :
+                                   0.0;
+
+    Log::Comment(String().Format(L"PERF\t%s\t%zu\t%.1f\t%.0f\t%.0f\t%.0f",
+                                 pwszScenario,
+                                 cOperations,
+                                 dblMBPerSec,
+                                 latenciesNs[latenciesNs.size() / 2],
+                                 latenciesNs[(latenciesNs.size() * 95) / 100],
+                                 latenciesNs.back()));
+}
+
+// Writes a fixed total payload to the screen buffer in chunks of the
+// data-driven size, so the per-message overhead of the driver interface is
+// visible as the difference between the small- and large-chunk rows.
+void PerfTests::PerfWriteConsoleChunked()
+{
+    using namespace WEX::TestExecution;
+
+    DWORD cchChunk;
+    VERIFY_SUCCEEDED_RETURN(TestData::TryGetValue(L"cchChunk", cchChunk), L"Get chunk size parameter");
+
+    // 4 MiB of characters total, regardless of chunk size, so every row of
+    // the report moved the same payload.
+    const size_t cchTotal = 4 * 1024 * 1024;
+    const double nsPerTick = s_NsPerQpcTick();
+
+    const std::wstring wstrChunk(cchChunk, L'x');
+
+    std::vector<double> latencies;
+    latencies.reserve(cchTotal / cchChunk);
+
+    size_t cchWrittenTotal = 0;
+    while (cchWrittenTotal < cchTotal)
+    {
+        DWORD cchWritten = 0;
+        LARGE_INTEGER liStart;
+        LARGE_INTEGER liStop;
+        QueryPerformanceCounter(&liStart);
+        const BOOL fSuccess = WriteConsoleW(Common::_hConsole, wstrChunk.data(), cchChunk, &cchWritten, nullptr);
+        QueryPerformanceCounter(&liStop);
+
+        VERIFY_WIN32_BOOL_SUCCEEDED(fSuccess, L"Write one chunk to the buffer.");
+        cchWrittenTotal += cchWritten;
+        latencies.push_back(static_cast<double>(liStop.QuadPart - liStart.QuadPart) * nsPerTick);
+    }
+
+    const String scenario = String().Format(L"WriteConsole-chunk-%u", cchChunk);
+    s_ReportScenario(scenario, latencies.size(), static_cast<double>(cchWrittenTotal * sizeof(wchar_t)), latencies);
+}
+
+// Repeatedly blits an 80x25 CHAR_INFO rectangle, the classic full-screen-app
+// redraw shape, so rectangle-write servicing shows up end to end.
+void PerfTests::PerfWriteConsoleOutputRects()
+{
+    const COORD coordRectSize{ 80, 25 };
+    const size_t cIterations = 2000;
+    const double nsPerTick = s_NsPerQpcTick();
+
+    std::vector<CHAR_INFO> rgRect(static_cast<size_t>(coordRectSize.X) * coordRectSize.Y);
+    for (size_t i = 0; i < rgRect.size(); i++)
+    {
+        rgRect[i].Char.UnicodeChar = static_cast<WCHAR>(L'A' + (i % 26));
+        rgRect[i].Attributes = FOREGROUND_GREEN;
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(cIterations);
+
+    for (size_t i = 0; i < cIterations; i++)
+    {
+        SMALL_RECT srWrite{ 0, 0, coordRectSize.X - 1, coordRectSize.Y - 1 };
+        LARGE_INTEGER liStart;
+        LARGE_INTEGER liStop;
+        QueryPerformanceCounter(&liStart);
+        const BOOL fSuccess = WriteConsoleOutputW(Common::_hConsole, rgRect.data(), coordRectSize, { 0, 0 }, &srWrite);
+        QueryPerformanceCounter(&liStop);
+
+        VERIFY_WIN32_BOOL_SUCCEEDED(fSuccess, L"Write one rectangle to the buffer.");
+        latencies.push_back(static_cast<double>(liStop.QuadPart - liStart.QuadPart) * nsPerTick);
+    }
+
+    s_ReportScenario(L"WriteConsoleOutput-80x25", latencies.size(), static_cast<double>(cIterations * rgRect.size() * sizeof(CHAR_INFO)), latencies);
+}
+
+// Stuffs the input buffer with key events in bulk, then drains it with
+// ReadConsoleInput in typical-sized reads, timing the drain side.
+void PerfTests::PerfReadConsoleInputFlood()
+{
+    const HANDLE hConsoleInput = GetStdHandle(STD_INPUT_HANDLE);
+    VERIFY_WIN32_BOOL_SUCCEEDED(FlushConsoleInputBuffer(hConsoleInput), L"Flush any pending input first.");
+
+    const size_t cTotalRecords = 16384;
+    const DWORD cRecordsPerWrite = 512;
+    const DWORD cRecordsPerRead = 128;
+    const double nsPerTick = s_NsPerQpcTick();
+
+    std::vector<INPUT_RECORD> rgWriteRecords(cRecordsPerWrite);
+    for (size_t i = 0; i < rgWriteRecords.size(); i++)
+    {
+        rgWriteRecords[i].EventType = KEY_EVENT;
+        rgWriteRecords[i].Event.KeyEvent.bKeyDown = TRUE;
+        rgWriteRecords[i].Event.KeyEvent.wRepeatCount = 1;
+        rgWriteRecords[i].Event.KeyEvent.wVirtualKeyCode = 'A';
+        rgWriteRecords[i].Event.KeyEvent.wVirtualScanCode = 0;
+        rgWriteRecords[i].Event.KeyEvent.uChar.UnicodeChar = L'a';
+        rgWriteRecords[i].Event.KeyEvent.dwControlKeyState = 0;
+    }
+
+    for (size_t cQueued = 0; cQueued < cTotalRecords; cQueued += cRecordsPerWrite)
+    {
+        DWORD cWritten = 0;
+        VERIFY_WIN32_BOOL_SUCCEEDED(WriteConsoleInputW(hConsoleInput, rgWriteRecords.data(), cRecordsPerWrite, &cWritten),
+                                    L"Queue a batch of key events.");
+        VERIFY_ARE_EQUAL(cRecordsPerWrite, cWritten, L"Every queued record should fit.");
+    }
+
+    std::vector<INPUT_RECORD> rgReadRecords(cRecordsPerRead);
+    std::vector<double> latencies;
+    latencies.reserve(cTotalRecords / cRecordsPerRead);
+
+    size_t cDrained = 0;
+    while (cDrained < cTotalRecords)
+    {
+        DWORD cRead = 0;
+        LARGE_INTEGER liStart;
+        LARGE_INTEGER liStop;
+        QueryPerformanceCounter(&liStart);
+        const BOOL fSuccess = ReadConsoleInputW(hConsoleInput, rgReadRecords.data(), cRecordsPerRead, &cRead);
+        QueryPerformanceCounter(&liStop);
+
+        VERIFY_WIN32_BOOL_SUCCEEDED(fSuccess, L"Drain one batch of key events.");
+        cDrained += cRead;
+        latencies.push_back(static_cast<double>(liStop.QuadPart - liStart.QuadPart) * nsPerTick);
+    }
+
+    VERIFY_WIN32_BOOL_SUCCEEDED(FlushConsoleInputBuffer(hConsoleInput), L"Leave the input buffer clean for the next test.");
+
+    s_ReportScenario(L"ReadConsoleInput-flood", latencies.size(), static_cast<double>(cTotalRecords * sizeof(INPUT_RECORD)), latencies);
+}
+
+// Hammers SetConsoleCursorPosition across the buffer - the shape of a
+// full-screen app addressing cells one by one - so per-message control-call
+// latency is measured without any payload.
+void PerfTests::PerfSetConsoleCursorPosition()
+{
+    CONSOLE_SCREEN_BUFFER_INFOEX sbiex = { 0 };
+    sbiex.cbSize = sizeof(sbiex);
+    VERIFY_WIN32_BOOL_SUCCEEDED(GetConsoleScreenBufferInfoEx(Common::_hConsole, &sbiex),
+                                L"Get the buffer dimensions to bound the cursor walk.");
+
+    const size_t cIterations = 10000;
+    const double nsPerTick = s_NsPerQpcTick();
+
+    std::vector<double> latencies;
+    latencies.reserve(cIterations);
+
+    for (size_t i = 0; i < cIterations; i++)
+    {
+        const COORD coordTarget{ static_cast<SHORT>(i % sbiex.dwSize.X),
+                                 static_cast<SHORT>((i * 7) % sbiex.dwSize.Y) };
+
+        LARGE_INTEGER liStart;
+        LARGE_INTEGER liStop;
+        QueryPerformanceCounter(&liStart);
+        const BOOL fSuccess = SetConsoleCursorPosition(Common::_hConsole, coordTarget);
+        QueryPerformanceCounter(&liStop);
+
+        VERIFY_WIN32_BOOL_SUCCEEDED(fSuccess, L"Move the cursor.");
+        latencies.push_back(static_cast<double>(liStop.QuadPart - liStart.QuadPart) * nsPerTick);
+    }
+
+    s_ReportScenario(L"SetConsoleCursorPosition", latencies.size(), 0.0, latencies);
+}
@@ -41,7 +41,7 @@ void ApiRoutines::GetConsoleInputModeImpl(InputBuffer& context, ULONG& mode) noe
 {
     try
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleMode);
+        Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleMode);
         const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
         LockConsole();
         auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
@@ -108,6 +108,16 @@ void ApiRoutines::GetConsoleScreenBufferInfoExImpl(const SCREEN_INFORMATION& con
 {
     try
     {
+        // Fast path: shells poll this API relentlessly between edits of the
+        // prompt. The console publishes a seqlock snapshot of exactly this
+        // data on every final release of the console lock, so a poll that
+        // races no state change is answered without taking the lock at all.
+        const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        if (gci.TryReadScreenBufferInfoSnapshot(&context, data))
+        {
+            return;
+        }
+
         LockConsole();
         auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
 
@@ -1422,6 +1432,76 @@ void DoSrvPrivateAllowCursorBlinking(SCREEN_INFORMATION& screenInfo, const bool
     return S_OK;
 }
 
+// Routine Description:
+// - A private API call for setting the cursor position from the VT adapter.
+//      The public SetConsoleCursorPositionImpl exists to service driver
+//      messages from out-of-process clients, so it takes the console lock and
+//      treats its parameters as untrusted; the adapter runs in-process during
+//      write servicing with the lock already held and positions computed from
+//      host state, so this path skips that ceremony and goes straight to the
+//      screen buffer. The conpty cursor inheritance, IME composition
+//      adjustment, and viewport-follow behaviors of the public path are kept.
+// Parameters:
+// - screenInfo - a reference to the screen buffer to move the cursor in
+// - position - The X/Y (row/column) position in the buffer to place the cursor
+// Return value:
+// - S_OK if handled successfully. Otherwise an appropriate HRESULT.
+[[nodiscard]] HRESULT DoSrvPrivateSetCursorPosition(SCREEN_INFORMATION& screenInfo, const COORD position)
+{
+    try
+    {
+        CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        FAIL_FAST_IF(!gci.IsConsoleLocked());
+
+        const COORD coordScreenBufferSize = screenInfo.GetBufferSize().Dimensions();
+        // The adapter clamps against host state before calling, so a miss here
+        // is a host bug rather than client input - but the check is four
+        // compares, so keep it rather than corrupt the buffer on that bug.
+        // clang-format off
+        RETURN_HR_IF(E_INVALIDARG, (position.X >= coordScreenBufferSize.X ||
+                                    position.Y >= coordScreenBufferSize.Y ||
+                                    position.X < 0 ||
+                                    position.Y < 0));
+        // clang-format on
+
+        // MSFT: 15813316 - Try to use this SetCursorPosition call to inherit the cursor position.
+        RETURN_IF_FAILED(gci.GetVtIo()->SetCursorPosition(position));
+
+        RETURN_IF_NTSTATUS_FAILED(screenInfo.SetCursorPosition(position, true));
+
+        LOG_IF_FAILED(ConsoleImeResizeCompStrView());
+
+        COORD WindowOrigin;
+        WindowOrigin.X = 0;
+        WindowOrigin.Y = 0;
+        {
+            const SMALL_RECT currentViewport = screenInfo.GetViewport().ToInclusive();
+            if (currentViewport.Left > position.X)
+            {
+                WindowOrigin.X = position.X - currentViewport.Left;
+            }
+            else if (currentViewport.Right < position.X)
+            {
+                WindowOrigin.X = position.X - currentViewport.Right;
+            }
+
+            if (currentViewport.Top > position.Y)
+            {
+                WindowOrigin.Y = position.Y - currentViewport.Top;
+            }
+            else if (currentViewport.Bottom < position.Y)
+            {
+                WindowOrigin.Y = position.Y - currentViewport.Bottom;
+            }
+        }
+
+        RETURN_IF_NTSTATUS_FAILED(screenInfo.SetViewportOrigin(false, WindowOrigin, true));
+
+        return S_OK;
+    }
+    CATCH_RETURN();
+}
+
 // Routine Description:
 // - A private API call for swapping to the alternate screen buffer. In virtual terminals, there exists both a "main"
 //     screen buffer and an alternate. ASBSET creates a new alternate, and switches to it. If there is an already
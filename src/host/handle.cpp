@@ -21,6 +21,13 @@ void UnlockConsole()
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     if (gci.GetCSRecursionCount() == 1)
     {
+        // Hand invalidations pooled during this API batch to the renderer in
+        // one call while we still hold the lock.
+        if (gci.HasActiveOutputBuffer())
+        {
+            gci.GetActiveOutputBuffer().GetActiveBuffer().FlushPendingRedraw();
+        }
+
         ProcessCtrlEvents();
     }
     else
@@ -82,6 +82,57 @@ bool CommandHistory::IsAppNameMatch(const std::wstring_view other) const
     return std::equal(_appName.cbegin(), _appName.cend(), other.cbegin(), other.cend(), CaseInsensitiveEquality);
 }
 
+// Routine Description:
+// - Lowercases a command with the same folding as CaseInsensitiveEquality so
+//   two folded strings can be compared with a plain memory compare.
+std::wstring CommandHistory::s_FoldCase(const std::wstring_view command)
+{
+    std::wstring folded{ command };
+    std::transform(folded.begin(), folded.end(), folded.begin(), [](const wchar_t ch) {
+        return gsl::narrow_cast<wchar_t>(::towlower(ch));
+    });
+    return folded;
+}
+
+// Routine Description:
+// - Rebuilds the folded mirror and hash index from _commands. Used by the
+//   operations that restructure the whole vector; the per-command paths
+//   (Add/Remove/Swap) maintain them incrementally instead.
+void CommandHistory::_RebuildDedupIndex()
+{
+    _foldedCommands.clear();
+    _dedupIndex.clear();
+    for (SHORT i = 0; i < gsl::narrow<SHORT>(_commands.size()); i++)
+    {
+        _foldedCommands.emplace_back(s_FoldCase(_commands.at(i)));
+        _dedupIndex.insert_or_assign(_foldedCommands.back(), i);
+    }
+}
+
+// Routine Description:
+// - Mirrors an erase on _commands: drops the folded copy at the given slot,
+//   removes its hash entry (unless a duplicate elsewhere owns it) and shifts
+//   the indexed slot numbers behind it down by one.
+// Arguments:
+// - index - slot that was just erased from _commands.
+void CommandHistory::_RemoveFromDedupIndex(const SHORT index)
+{
+    const auto hit = _dedupIndex.find(_foldedCommands.at(index));
+    if (hit != _dedupIndex.end() && hit->second == index)
+    {
+        _dedupIndex.erase(hit);
+    }
+    _foldedCommands.erase(_foldedCommands.cbegin() + index);
+
+    for (auto& entry : _dedupIndex)
+    {
+        if (entry.second > index)
+        {
+            entry.second--;
+        }
+    }
+}
+
 // Routine Description:
 // - This routine is called when escape is entered or a command is added.
 void CommandHistory::_Reset()
@@ -111,13 +162,16 @@ void CommandHistory::_Reset()
                         newCommand.cend()))
         {
             std::wstring reuse{};
+            const auto foldedCommand = s_FoldCase(newCommand);
 
             if (suppressDuplicates)
             {
-                SHORT index;
-                if (FindMatchingCommand(newCommand, LastDisplayed, index, CommandHistory::MatchOptions::ExactMatch))
+                // One hash probe takes the place of walking the whole history
+                // looking for a case-insensitive exact match.
+                const auto hit = _dedupIndex.find(foldedCommand);
+                if (hit != _dedupIndex.end())
                 {
-                    reuse = Remove(index);
+                    reuse = Remove(hit->second);
                 }
             }
 
@@ -125,6 +179,7 @@ void CommandHistory::_Reset()
             if ((SHORT)_commands.size() == _maxCommands)
             {
                 _commands.erase(_commands.cbegin());
+                _RemoveFromDedupIndex(0);
                 // move LastDisplayed back one in order to stay synced with the
                 // command it referred to before erasing the lru one
                 --LastDisplayed;
@@ -139,6 +194,8 @@ void CommandHistory::_Reset()
             {
                 _commands.emplace_back(newCommand);
             }
+            _foldedCommands.emplace_back(foldedCommand);
+            _dedupIndex.insert_or_assign(foldedCommand, gsl::narrow<SHORT>(_commands.size() - 1));
 
             if (LastDisplayed == -1 ||
                 _commands.at(LastDisplayed).size() != newCommand.size() ||
@@ -249,6 +306,8 @@ std::wstring_view CommandHistory::GetLastCommand() const
 void CommandHistory::Empty()
 {
     _commands.clear();
+    _foldedCommands.clear();
+    _dedupIndex.clear();
     LastDisplayed = -1;
     Flags = CLE_RESET;
 }
@@ -290,6 +349,7 @@ void CommandHistory::Realloc(const size_t commands)
     {
         _commands.emplace_back(oldCommands[i]);
     }
+    _RebuildDedupIndex();
 
     WI_SetFlag(Flags, CLE_RESET);
     LastDisplayed = gsl::narrow<SHORT>(_commands.size()) - 1;
@@ -392,6 +452,8 @@ CommandHistory* CommandHistory::s_Allocate(const std::wstring_view appName, cons
         if (!SameApp)
         {
             BestCandidate->_commands.clear();
+            BestCandidate->_foldedCommands.clear();
+            BestCandidate->_dedupIndex.clear();
             BestCandidate->LastDisplayed = -1;
             BestCandidate->_appName = appName;
         }
@@ -475,6 +537,7 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
         if (iDel < iLast)
         {
             _commands.erase(_commands.cbegin() + iDel);
+            _RemoveFromDedupIndex(iDel);
             if ((iDisp > iDel) && (iDisp <= iLast))
             {
                 _Dec(iDisp);
@@ -484,6 +547,7 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
         else if (iFirst <= iDel)
         {
             _commands.erase(_commands.cbegin() + iDel);
+            _RemoveFromDedupIndex(iDel);
             if ((iDisp >= iFirst) && (iDisp < iDel))
             {
                 _Inc(iDisp);
@@ -529,16 +593,15 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
 
     try
     {
+        // Fold the needle once up front so each candidate is a straight
+        // memory compare against the prefolded copy of the stored command.
+        const auto foldedGiven = s_FoldCase(givenCommand);
         for (size_t i = 0; i < _commands.size(); i++)
         {
-            const auto& storedCommand = _commands.at(indexFound);
-            if ((WI_IsFlagClear(options, MatchOptions::ExactMatch) && (givenCommand.size() <= storedCommand.size())) || (givenCommand.size() == storedCommand.size()))
+            const auto& storedCommand = _foldedCommands.at(indexFound);
+            if ((WI_IsFlagClear(options, MatchOptions::ExactMatch) && (foldedGiven.size() <= storedCommand.size())) || (foldedGiven.size() == storedCommand.size()))
             {
-                if (std::equal(storedCommand.begin(),
-                               storedCommand.begin() + givenCommand.size(),
-                               givenCommand.begin(),
-                               givenCommand.end(),
-                               CaseInsensitiveEquality))
+                if (storedCommand.compare(0, foldedGiven.size(), foldedGiven) == 0)
                 {
                     return true;
                 }
@@ -567,6 +630,20 @@ void CommandHistory::s_ClearHistoryListStorage()
 void CommandHistory::Swap(const short indexA, const short indexB)
 {
     std::swap(_commands.at(indexA), _commands.at(indexB));
+    std::swap(_foldedCommands.at(indexA), _foldedCommands.at(indexB));
+
+    // Point the hash index at the slots the two commands moved to.
+    const auto hitA = _dedupIndex.find(_foldedCommands.at(indexA));
+    if (hitA != _dedupIndex.end() && hitA->second == indexB)
+    {
+        hitA->second = indexA;
+    }
+
+    const auto hitB = _dedupIndex.find(_foldedCommands.at(indexB));
+    if (hitB != _dedupIndex.end() && hitB->second == indexA)
+    {
+        hitB->second = indexB;
+    }
 }
 
 // Routine Description:
@@ -83,7 +83,21 @@ private:
     void _Dec(SHORT& ind) const;
     void _Inc(SHORT& ind) const;
 
+    static std::wstring s_FoldCase(const std::wstring_view command);
+    void _RebuildDedupIndex();
+    void _RemoveFromDedupIndex(const SHORT index);
+
     std::vector<std::wstring> _commands;
+
+    // Case-folded mirror of _commands plus a hash index over it.
+    // _foldedCommands turns the per-entry comparisons in FindMatchingCommand
+    // into plain memory compares (no towlower per character per entry), and
+    // _dedupIndex maps a folded command to a slot that holds it so the
+    // exact-match dedup on every Add is one hash probe instead of a scan.
+    // Every mutation of _commands must keep both in sync.
+    std::vector<std::wstring> _foldedCommands;
+    std::unordered_map<std::wstring, SHORT> _dedupIndex;
+
     SHORT _maxCommands;
 
     std::wstring _appName;
@@ -52,35 +52,38 @@ ULONG GetControlKeyState(const LPARAM lParam)
 {
     ULONG ControlKeyState = 0;
 
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_LMENU) & KEY_PRESSED)
+    // Resolve the input services once for all eight key queries.
+    IInputServices* const pInputServices = ServiceLocator::LocateInputServices();
+
+    if (pInputServices->GetKeyState(VK_LMENU) & KEY_PRESSED)
     {
         ControlKeyState |= LEFT_ALT_PRESSED;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_RMENU) & KEY_PRESSED)
+    if (pInputServices->GetKeyState(VK_RMENU) & KEY_PRESSED)
     {
         ControlKeyState |= RIGHT_ALT_PRESSED;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_LCONTROL) & KEY_PRESSED)
+    if (pInputServices->GetKeyState(VK_LCONTROL) & KEY_PRESSED)
     {
         ControlKeyState |= LEFT_CTRL_PRESSED;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_RCONTROL) & KEY_PRESSED)
+    if (pInputServices->GetKeyState(VK_RCONTROL) & KEY_PRESSED)
     {
         ControlKeyState |= RIGHT_CTRL_PRESSED;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_SHIFT) & KEY_PRESSED)
+    if (pInputServices->GetKeyState(VK_SHIFT) & KEY_PRESSED)
     {
         ControlKeyState |= SHIFT_PRESSED;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_NUMLOCK) & KEY_TOGGLED)
+    if (pInputServices->GetKeyState(VK_NUMLOCK) & KEY_TOGGLED)
     {
         ControlKeyState |= NUMLOCK_ON;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_SCROLL) & KEY_TOGGLED)
+    if (pInputServices->GetKeyState(VK_SCROLL) & KEY_TOGGLED)
     {
         ControlKeyState |= SCROLLLOCK_ON;
     }
-    if (ServiceLocator::LocateInputServices()->GetKeyState(VK_CAPITAL) & KEY_TOGGLED)
+    if (pInputServices->GetKeyState(VK_CAPITAL) & KEY_TOGGLED)
     {
         ControlKeyState |= CAPSLOCK_ON;
     }
@@ -5,6 +5,7 @@
 #include "inputBuffer.hpp"
 #include "dbcs.h"
 #include "stream.h"
+#include "tracing.hpp"
 #include "../types/inc/GlyphWidth.hpp"
 
 #include <functional>
@@ -212,30 +213,31 @@ void InputBuffer::Flush()
 // - The console lock must be held when calling this routine.
 void InputBuffer::FlushAllButKeys()
 {
-    auto newEnd = std::remove_if(_storage.begin(), _storage.end(), [](const std::unique_ptr<IInputEvent>& event) {
-        return event->EventType() != InputEventType::KeyEvent;
+    auto newEnd = std::remove_if(_storage.begin(), _storage.end(), [](const INPUT_RECORD& record) {
+        return record.EventType != KEY_EVENT;
     });
     _storage.erase(newEnd, _storage.end());
 }
 
 // Routine Description:
-// - This routine reads from the input buffer.
+// - This routine reads from the input buffer as flat records, with no event
+//   objects materialized for them.
 // - It can convert returned data to through the currently set Input CP, it can optionally return a wait condition
 //   if there isn't enough data in the buffer, and it can be set to not remove records as it reads them out.
 // Note:
 // - The console lock must be held when calling this routine.
 // Arguments:
-// - OutEvents - deque to store the read events
+// - OutRecords - deque to store the read records
 // - AmountToRead - the amount of events to try to read
 // - Peek - If true, copy events to pInputRecord but don't remove them from the input buffer.
 // - WaitForData - if true, wait until an event is input (if there aren't enough to fill client buffer). if false, return immediately
 // - Unicode - true if the data in key events should be treated as unicode. false if they should be converted by the current input CP.
-// - Stream - true if read should unpack KeyEvents that have a >1 repeat count. AmountToRead must be 1 if Stream is true.
+// - Stream - true if read should unpack KeyEvents that have a >1 repeat count. AmountToRead must be 1 if Stream and Peek are both true.
 // Return Value:
 // - STATUS_SUCCESS if records were read into the client buffer and everything is OK.
 // - CONSOLE_STATUS_WAIT if there weren't enough records to satisfy the request (and waits are allowed)
 // - otherwise a suitable memory/math/string error in NTSTATUS form.
-[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<std::unique_ptr<IInputEvent>>& OutEvents,
+[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<INPUT_RECORD>& OutRecords,
                                          const size_t AmountToRead,
                                          const bool Peek,
                                          const bool WaitForData,
@@ -254,10 +256,9 @@ void InputBuffer::FlushAllButKeys()
         }
 
         // read from buffer
-        std::deque<std::unique_ptr<IInputEvent>> events;
         size_t eventsRead;
         bool resetWaitEvent;
-        _ReadBuffer(events,
+        _ReadBuffer(OutRecords,
                     AmountToRead,
                     eventsRead,
                     Peek,
@@ -265,13 +266,6 @@ void InputBuffer::FlushAllButKeys()
                     Unicode,
                     Stream);
 
-        // copy events to outEvents
-        while (!events.empty())
-        {
-            OutEvents.push_back(std::move(events.front()));
-            events.pop_front();
-        }
-
         if (resetWaitEvent)
         {
             ServiceLocator::LocateGlobals().hInputEvent.ResetEvent();
@@ -284,6 +278,54 @@ void InputBuffer::FlushAllButKeys()
     }
 }
 
+// Routine Description:
+// - This routine reads from the input buffer.
+// - It can convert returned data to through the currently set Input CP, it can optionally return a wait condition
+//   if there isn't enough data in the buffer, and it can be set to not remove records as it reads them out.
+// Note:
+// - The console lock must be held when calling this routine.
+// Arguments:
+// - OutEvents - deque to store the read events
+// - AmountToRead - the amount of events to try to read
+// - Peek - If true, copy events to pInputRecord but don't remove them from the input buffer.
+// - WaitForData - if true, wait until an event is input (if there aren't enough to fill client buffer). if false, return immediately
+// - Unicode - true if the data in key events should be treated as unicode. false if they should be converted by the current input CP.
+// - Stream - true if read should unpack KeyEvents that have a >1 repeat count. AmountToRead must be 1 if Stream and Peek are both true.
+// Return Value:
+// - STATUS_SUCCESS if records were read into the client buffer and everything is OK.
+// - CONSOLE_STATUS_WAIT if there weren't enough records to satisfy the request (and waits are allowed)
+// - otherwise a suitable memory/math/string error in NTSTATUS form.
+[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<std::unique_ptr<IInputEvent>>& OutEvents,
+                                         const size_t AmountToRead,
+                                         const bool Peek,
+                                         const bool WaitForData,
+                                         const bool Unicode,
+                                         const bool Stream)
+{
+    try
+    {
+        std::deque<INPUT_RECORD> records;
+        const NTSTATUS Status = Read(records,
+                                     AmountToRead,
+                                     Peek,
+                                     WaitForData,
+                                     Unicode,
+                                     Stream);
+
+        // records are turned into full event objects only here, at the API boundary
+        for (const auto& record : records)
+        {
+            OutEvents.push_back(IInputEvent::Create(record));
+        }
+
+        return Status;
+    }
+    catch (...)
+    {
+        return NTSTATUS_FROM_HRESULT(wil::ResultFromCaughtException());
+    }
+}
+
 // Routine Description:
 // - This routine reads a single event from the input buffer.
 // - It can convert returned data to through the currently set Input CP, it can optionally return a wait condition
@@ -332,7 +374,7 @@ void InputBuffer::FlushAllButKeys()
 // Routine Description:
 // - This routine reads from a buffer. It does the buffer manipulation.
 // Arguments:
-// - outEvents - where read events are placed
+// - outRecords - where read records are placed
 // - readCount - amount of events to read
 // - eventsRead - where to store number of events read
 // - peek - if true , don't remove data from buffer, just copy it.
@@ -343,7 +385,7 @@ void InputBuffer::FlushAllButKeys()
 // - <none>
 // Note:
 // - The console lock must be held when calling this routine.
-void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+void InputBuffer::_ReadBuffer(_Out_ std::deque<INPUT_RECORD>& outRecords,
                               const size_t readCount,
                               _Out_ size_t& eventsRead,
                               const bool peek,
@@ -351,13 +393,15 @@ void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& ou
                               const bool unicode,
                               const bool streamRead)
 {
-    // when stream reading, the previous behavior was to only allow reading of a single
-    // event at a time.
-    FAIL_FAST_IF(streamRead && readCount != 1);
+    // Stream reads that peek still only support a single event at a time; the
+    // restore path below puts exactly one record back. Consuming stream reads
+    // may batch - the split loop takes one repeat per iteration regardless of
+    // how many events were asked for.
+    FAIL_FAST_IF(streamRead && peek && readCount != 1);
 
     resetWaitEvent = false;
 
-    std::deque<std::unique_ptr<IInputEvent>> readEvents;
+    std::deque<INPUT_RECORD> readRecords;
     // we need another var to keep track of how many we've read
     // because dbcs records count for two when we aren't doing a
     // unicode read but the eventsRead count should return the number
@@ -370,81 +414,68 @@ void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& ou
         // for stream reads we need to split any key events that have been coalesced
         if (streamRead)
         {
-            if (_storage.front()->EventType() == InputEventType::KeyEvent)
+            if (_storage.front().EventType == KEY_EVENT &&
+                _storage.front().Event.KeyEvent.wRepeatCount > 1)
             {
-                KeyEvent* const pKeyEvent = static_cast<KeyEvent* const>(_storage.front().get());
-                if (pKeyEvent->GetRepeatCount() > 1)
-                {
-                    // split the key event
-                    std::unique_ptr<KeyEvent> streamKeyEvent = std::make_unique<KeyEvent>(*pKeyEvent);
-                    streamKeyEvent->SetRepeatCount(1);
-                    readEvents.push_back(std::move(streamKeyEvent));
-                    pKeyEvent->SetRepeatCount(pKeyEvent->GetRepeatCount() - 1);
-                    performNormalRead = false;
-                }
+                // split the key event
+                INPUT_RECORD streamRecord = _storage.front();
+                streamRecord.Event.KeyEvent.wRepeatCount = 1;
+                readRecords.push_back(streamRecord);
+                _storage.front().Event.KeyEvent.wRepeatCount--;
+                performNormalRead = false;
             }
         }
 
         if (performNormalRead)
         {
-            readEvents.push_back(std::move(_storage.front()));
+            readRecords.push_back(_storage.front());
             _storage.pop_front();
         }
 
         ++virtualReadCount;
         if (!unicode)
         {
-            if (readEvents.back()->EventType() == InputEventType::KeyEvent)
+            if (readRecords.back().EventType == KEY_EVENT &&
+                IsGlyphFullWidth(readRecords.back().Event.KeyEvent.uChar.UnicodeChar))
             {
-                const KeyEvent* const pKeyEvent = static_cast<const KeyEvent* const>(readEvents.back().get());
-                if (IsGlyphFullWidth(pKeyEvent->GetCharData()))
-                {
-                    ++virtualReadCount;
-                }
+                ++virtualReadCount;
             }
         }
     }
 
     // the amount of events that were actually read
-    eventsRead = readEvents.size();
+    eventsRead = readRecords.size();
 
     // copy the events back if we were supposed to peek
     if (peek)
     {
         if (streamRead)
         {
-            // we need to check and see if the event was split from a coalesced key event
-            // or if it was unrelated to the current front event in storage
-            if (!readEvents.empty() &&
+            // we need to check and see if the record was split from a coalesced key event
+            // or if it was unrelated to the current front record in storage
+            if (!readRecords.empty() &&
                 !_storage.empty() &&
-                readEvents.back()->EventType() == InputEventType::KeyEvent &&
-                _storage.front()->EventType() == InputEventType::KeyEvent &&
-                _CanCoalesce(static_cast<const KeyEvent&>(*readEvents.back()),
-                             static_cast<const KeyEvent&>(*_storage.front())))
+                readRecords.back().EventType == KEY_EVENT &&
+                _storage.front().EventType == KEY_EVENT &&
+                _CanCoalesce(readRecords.back().Event.KeyEvent, _storage.front().Event.KeyEvent))
             {
-                KeyEvent& keyEvent = static_cast<KeyEvent&>(*_storage.front());
-                keyEvent.SetRepeatCount(keyEvent.GetRepeatCount() + 1);
+                _storage.front().Event.KeyEvent.wRepeatCount++;
             }
             else
             {
-                _storage.push_front(IInputEvent::Create(readEvents.back()->ToInputRecord()));
+                _storage.push_front(readRecords.back());
             }
         }
         else
         {
-            for (auto it = readEvents.crbegin(); it != readEvents.crend(); ++it)
+            for (auto it = readRecords.crbegin(); it != readRecords.crend(); ++it)
             {
-                _storage.push_front(IInputEvent::Create((*it)->ToInputRecord()));
+                _storage.push_front(*it);
             }
         }
     }
 
-    // move events read to proper deque
-    while (!readEvents.empty())
-    {
-        outEvents.push_back(std::move(readEvents.front()));
-        readEvents.pop_front();
-    }
+    outRecords.swap(readRecords);
 
     // signal if we emptied the buffer
     if (_storage.empty())
@@ -476,7 +507,7 @@ size_t InputBuffer::Prepend(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& in
         // this way to handle any coalescing that might occur.
 
         // get all of the existing records, "emptying" the buffer
-        std::deque<std::unique_ptr<IInputEvent>> existingStorage;
+        std::deque<INPUT_RECORD> existingStorage;
         existingStorage.swap(_storage);
 
         // We will need this variable to pass to _WriteBuffer so it can attempt to determine wait status.
@@ -490,9 +521,17 @@ size_t InputBuffer::Prepend(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& in
         _WriteBuffer(inEvents, prependEventsWritten, unusedWaitStatus);
         FAIL_FAST_IF(!(unusedWaitStatus));
 
-        // write all previously existing records
+        // write all previously existing records. they get rehydrated into
+        // event objects so they take exactly the path they took the first
+        // time through.
+        std::deque<std::unique_ptr<IInputEvent>> existingEvents;
+        for (const auto& record : existingStorage)
+        {
+            existingEvents.push_back(IInputEvent::Create(record));
+        }
+
         size_t existingEventsWritten;
-        _WriteBuffer(existingStorage, existingEventsWritten, unusedWaitStatus);
+        _WriteBuffer(existingEvents, existingEventsWritten, unusedWaitStatus);
         FAIL_FAST_IF(!(!unusedWaitStatus));
 
         // We need to set the wait event if there were 0 events in the
@@ -567,6 +606,8 @@ size_t InputBuffer::Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEv
         bool SetWaitEvent;
         _WriteBuffer(inEvents, EventsWritten, SetWaitEvent);
 
+        PerfCounters::s_Add(PerfCounters::Counter::InputEvents, gsl::narrow_cast<LONGLONG>(EventsWritten));
+
         if (SetWaitEvent)
         {
             ServiceLocator::LocateGlobals().hInputEvent.SetEvent();
@@ -583,6 +624,84 @@ size_t InputBuffer::Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEv
     }
 }
 
+// Routine Description:
+// - Writes records straight into the input buffer without building event
+// objects for them. Wakes up any readers that are waiting for additional
+// input events. This is the bulk path - a paste of thousands of keystrokes
+// lands in storage as a single append.
+// Arguments:
+// - inRecords - input records to store in the buffer.
+// Return Value:
+// - The number of records that were written to input buffer.
+// Note:
+// - The console lock must be held when calling this routine.
+size_t InputBuffer::Write(const gsl::span<const INPUT_RECORD> inRecords)
+{
+    try
+    {
+        if (inRecords.empty())
+        {
+            return 0;
+        }
+
+        // The VT translation layer wants full event objects, and writes of a
+        // single record keep the historical coalescing behavior - both take
+        // the existing path.
+        if (IsInVirtualTerminalInputMode() || inRecords.size() == 1)
+        {
+            std::deque<std::unique_ptr<IInputEvent>> inEvents;
+            for (const auto& record : inRecords)
+            {
+                inEvents.push_back(IInputEvent::Create(record));
+            }
+            return Write(inEvents);
+        }
+
+        CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        const bool initiallyEmptyQueue = _storage.empty();
+
+        size_t eventsWritten = 0;
+        for (const auto& record : inRecords)
+        {
+            // the same screening _HandleConsoleSuspensionEvents performs,
+            // applied to the raw record
+            if (record.EventType == KEY_EVENT && record.Event.KeyEvent.bKeyDown)
+            {
+                if (WI_IsFlagSet(gci.Flags, CONSOLE_SUSPENDED) &&
+                    !IsSystemKey(record.Event.KeyEvent.wVirtualKeyCode))
+                {
+                    UnblockWriteConsole(CONSOLE_OUTPUT_SUSPENDED);
+                    continue;
+                }
+                else if (WI_IsFlagSet(InputMode, ENABLE_LINE_INPUT) &&
+                         record.Event.KeyEvent.wVirtualKeyCode == VK_PAUSE)
+                {
+                    WI_SetFlag(gci.Flags, CONSOLE_SUSPENDED);
+                    continue;
+                }
+            }
+            _storage.push_back(record);
+            ++eventsWritten;
+        }
+
+        PerfCounters::s_Add(PerfCounters::Counter::InputEvents, gsl::narrow_cast<LONGLONG>(eventsWritten));
+
+        if (initiallyEmptyQueue && !_storage.empty())
+        {
+            ServiceLocator::LocateGlobals().hInputEvent.SetEvent();
+        }
+
+        // Alert any writers waiting for space.
+        WakeUpReadersWaitingForData();
+        return eventsWritten;
+    }
+    catch (...)
+    {
+        LOG_HR(wil::ResultFromCaughtException());
+        return 0;
+    }
+}
+
 // Routine Description:
 // - Coalesces input events and transfers them to storage queue.
 // Arguments:
@@ -624,46 +743,28 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
             }
         }
 
+        // Flatten once; the coalescing checks and storage both want the
+        // record form, and the record at the back of storage carries the
+        // coalescing state (event tag, position, repeat count) inline.
+        const INPUT_RECORD record = inEvent->ToInputRecord();
+
         // we only check for possible coalescing when storing one
         // record at a time because this is the original behavior of
         // the input buffer. Changing this behavior may break stuff
         // that was depending on it.
         if (initialInEventsSize == 1 && !_storage.empty())
         {
-            // coalescing requires a deque of events, so push it back onto the front.
-            inEvents.push_front(std::move(inEvent));
-
-            bool coalesced = false;
             // this looks kinda weird but we don't want to coalesce a
             // mouse event and then try to coalesce a key event right after.
-            //
-            // we also pass the whole deque to the coalescing methods
-            // even though they only want one event because it should
-            // be their responsibility to maintain the correct state
-            // of the deque if they process any records in it.
-            if (_CoalesceMouseMovedEvents(inEvents))
-            {
-                coalesced = true;
-            }
-            else if (_CoalesceRepeatedKeyPressEvents(inEvents))
-            {
-                coalesced = true;
-            }
-            if (coalesced)
+            if (_CoalesceMouseMovedEvents(record) ||
+                _CoalesceRepeatedKeyPressEvents(record))
             {
                 eventsWritten = 1;
                 return;
             }
-            else
-            {
-                // We didn't coalesce the event. pull it from the queue again,
-                //  to keep the state consistent with the start of this block.
-                inEvent = std::move(inEvents.front());
-                inEvents.pop_front();
-            }
         }
         // At this point, the event was neither coalesced, nor processed by VT.
-        _storage.push_back(std::move(inEvent));
+        _storage.push_back(record);
         ++eventsWritten;
     }
     if (initiallyEmptyQueue && !_storage.empty())
@@ -673,67 +774,54 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
 }
 
 // Routine Description:
-// - Checks if the last saved event and the first event of inRecords are
-// both MOUSE_MOVED events. If they are, the last saved event is
-// updated with the new mouse position and the first event of inRecords is
-// dropped.
+// - Checks if the last saved record and the incoming record are both
+// MOUSE_MOVED events. If they are, the last saved record is updated
+// with the new mouse position and the incoming record can be dropped.
 // Arguments:
-// - inRecords - The incoming records to process.
+// - inRecord - The incoming record to check.
 // Return Value:
-// true if events were coalesced, false if they were not.
+// true if the record was coalesced, false if it was not.
 // Note:
-// - The size of inRecords must be 1.
+// - The storage buffer must not be empty.
 // - Coalescing here means updating a record that already exists in
 // the buffer with updated values from an incoming event, instead of
 // storing the incoming event (which would make the original one
 // redundant/out of date with the most current state).
-bool InputBuffer::_CoalesceMouseMovedEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
+bool InputBuffer::_CoalesceMouseMovedEvents(const INPUT_RECORD& inRecord) noexcept
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
     FAIL_FAST_IF(_storage.empty());
-    const IInputEvent* const pFirstInEvent = inEvents.front().get();
-    const IInputEvent* const pLastStoredEvent = _storage.back().get();
-    if (pFirstInEvent->EventType() == InputEventType::MouseEvent &&
-        pLastStoredEvent->EventType() == InputEventType::MouseEvent)
+    INPUT_RECORD& lastStored = _storage.back();
+    if (inRecord.EventType == MOUSE_EVENT &&
+        inRecord.Event.MouseEvent.dwEventFlags == MOUSE_MOVED &&
+        lastStored.EventType == MOUSE_EVENT &&
+        lastStored.Event.MouseEvent.dwEventFlags == MOUSE_MOVED)
     {
-        const MouseEvent* const pInMouseEvent = static_cast<const MouseEvent* const>(pFirstInEvent);
-        const MouseEvent* const pLastMouseEvent = static_cast<const MouseEvent* const>(pLastStoredEvent);
-
-        if (pInMouseEvent->IsMouseMoveEvent() &&
-            pLastMouseEvent->IsMouseMoveEvent())
-        {
-            // update mouse moved position
-            MouseEvent* const pMouseEvent = static_cast<MouseEvent* const>(_storage.back().release());
-            pMouseEvent->SetPosition(pInMouseEvent->GetPosition());
-            std::unique_ptr<IInputEvent> tempPtr(pMouseEvent);
-            tempPtr.swap(_storage.back());
-
-            inEvents.pop_front();
-            return true;
-        }
+        // update mouse moved position
+        lastStored.Event.MouseEvent.dwMousePosition = inRecord.Event.MouseEvent.dwMousePosition;
+        return true;
     }
     return false;
 }
 
 // Routine Description:
-// - checks two KeyEvents to see if they're similiar enough to be coalesced
+// - checks two key event records to see if they're similiar enough to be coalesced
 // Arguments:
-// - a - the first KeyEvent
-// - b - the other KeyEvent
+// - a - the first key record
+// - b - the other key record
 // Return Value:
-// - true if the events could be coalesced, false otherwise
-bool InputBuffer::_CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexcept
+// - true if the records could be coalesced, false otherwise
+bool InputBuffer::_CanCoalesce(const KEY_EVENT_RECORD& a, const KEY_EVENT_RECORD& b) const noexcept
 {
-    if (WI_IsFlagSet(a.GetActiveModifierKeys(), NLS_IME_CONVERSION) &&
-        a.GetCharData() == b.GetCharData() &&
-        a.GetActiveModifierKeys() == b.GetActiveModifierKeys())
+    if (WI_IsFlagSet(a.dwControlKeyState, NLS_IME_CONVERSION) &&
+        a.uChar.UnicodeChar == b.uChar.UnicodeChar &&
+        a.dwControlKeyState == b.dwControlKeyState)
     {
         return true;
     }
     // other key events check
-    else if (a.GetVirtualScanCode() == b.GetVirtualScanCode() &&
-             a.GetCharData() == b.GetCharData() &&
-             a.GetActiveModifierKeys() == b.GetActiveModifierKeys())
+    else if (a.wVirtualScanCode == b.wVirtualScanCode &&
+             a.uChar.UnicodeChar == b.uChar.UnicodeChar &&
+             a.dwControlKeyState == b.dwControlKeyState)
     {
         return true;
     }
@@ -741,44 +829,37 @@ bool InputBuffer::_CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexc
 }
 
 // Routine Description::
-// - If the last input event saved and the first input event in inRecords
-// are both a keypress down event for the same key, update the repeat
-// count of the saved event and drop the first from inRecords.
+// - If the last saved record and the incoming record are both a keypress
+// down event for the same key, update the repeat count of the saved
+// record. Autorepeat compression is then a branch and an increment on
+// the record already in storage.
 // Arguments:
-// - inRecords - The incoming records to process.
+// - inRecord - The incoming record to check.
 // Return Value:
-// true if events were coalesced, false if they were not.
+// true if the record was coalesced, false if it was not.
 // Note:
-// - The size of inRecords must be 1.
+// - The storage buffer must not be empty.
 // - Coalescing here means updating a record that already exists in
 // the buffer with updated values from an incoming event, instead of
 // storing the incoming event (which would make the original one
 // redundant/out of date with the most current state).
-bool InputBuffer::_CoalesceRepeatedKeyPressEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
+bool InputBuffer::_CoalesceRepeatedKeyPressEvents(const INPUT_RECORD& inRecord) noexcept
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
     FAIL_FAST_IF(_storage.empty());
-    const IInputEvent* const pFirstInEvent = inEvents.front().get();
-    const IInputEvent* const pLastStoredEvent = _storage.back().get();
-    if (pFirstInEvent->EventType() == InputEventType::KeyEvent &&
-        pLastStoredEvent->EventType() == InputEventType::KeyEvent)
-    {
-        const KeyEvent* const pInKeyEvent = static_cast<const KeyEvent* const>(pFirstInEvent);
-        const KeyEvent* const pLastKeyEvent = static_cast<const KeyEvent* const>(pLastStoredEvent);
-
-        if (pInKeyEvent->IsKeyDown() &&
-            pLastKeyEvent->IsKeyDown() &&
-            !IsGlyphFullWidth(pInKeyEvent->GetCharData()) &&
-            _CanCoalesce(*pInKeyEvent, *pLastKeyEvent))
+    INPUT_RECORD& lastStored = _storage.back();
+    if (inRecord.EventType == KEY_EVENT &&
+        lastStored.EventType == KEY_EVENT)
+    {
+        const KEY_EVENT_RECORD& inKey = inRecord.Event.KeyEvent;
+        KEY_EVENT_RECORD& lastStoredKey = lastStored.Event.KeyEvent;
+
+        if (inKey.bKeyDown &&
+            lastStoredKey.bKeyDown &&
+            !IsGlyphFullWidth(inKey.uChar.UnicodeChar) &&
+            _CanCoalesce(inKey, lastStoredKey))
         {
             // increment repeat count
-            KeyEvent* const pKeyEvent = static_cast<KeyEvent* const>(_storage.back().release());
-            WORD repeatCount = pKeyEvent->GetRepeatCount() + pInKeyEvent->GetRepeatCount();
-            pKeyEvent->SetRepeatCount(repeatCount);
-            std::unique_ptr<IInputEvent> tempPtr(pKeyEvent);
-            tempPtr.swap(_storage.back());
-
-            inEvents.pop_front();
+            lastStoredKey.wRepeatCount = lastStoredKey.wRepeatCount + inKey.wRepeatCount;
             return true;
         }
     }
@@ -852,9 +933,8 @@ void InputBuffer::_HandleTerminalInputCallback(std::deque<std::unique_ptr<IInput
         // add all input events to the storage queue
         while (!inEvents.empty())
         {
-            std::unique_ptr<IInputEvent> inEvent = std::move(inEvents.front());
+            _storage.push_back(inEvents.front()->ToInputRecord());
             inEvents.pop_front();
-            _storage.push_back(std::move(inEvent));
         }
     }
     catch (...)
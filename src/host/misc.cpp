@@ -82,26 +82,33 @@ BOOL CheckBisectStringW(_In_reads_bytes_(cBytes) const WCHAR* pwchBuffer,
                         _In_ size_t cWords,
                         _In_ size_t cBytes) noexcept
 {
+    // Consume whole same-width runs rather than classifying every character;
+    // CJK text forms long full-width runs, so the byte budget is spent a run
+    // at a time with one classification call each.
     while (cWords && cBytes)
     {
-        if (IsGlyphFullWidth(*pwchBuffer))
+        bool fFullWidth = false;
+        const size_t cRun = GetSameWidthGlyphRunLength({ pwchBuffer, cWords }, fFullWidth);
+
+        if (fFullWidth)
         {
             if (cBytes < 2)
             {
+                // the budget ends inside a full width character
                 return TRUE;
             }
-            else
-            {
-                cWords--;
-                cBytes -= 2;
-                pwchBuffer++;
-            }
+
+            const size_t cFit = std::min(cRun, cBytes / 2);
+            cWords -= cFit;
+            cBytes -= cFit * 2;
+            pwchBuffer += cFit;
         }
         else
         {
-            cWords--;
-            cBytes--;
-            pwchBuffer++;
+            const size_t cFit = std::min(cRun, cBytes);
+            cWords -= cFit;
+            cBytes -= cFit;
+            pwchBuffer += cFit;
         }
     }
 
@@ -133,27 +140,45 @@ BOOL CheckBisectProcessW(const SCREEN_INFORMATION& ScreenInfo,
             WCHAR const Char = *pwchBuffer;
             if (Char >= UNICODE_SPACE)
             {
-                if (IsGlyphFullWidth(Char))
+                // Measure the printable stretch ahead, then spend the byte
+                // budget on it one same-width run at a time instead of
+                // re-classifying every character.
+                size_t cPrintable = 1;
+                while (cPrintable < cWords && pwchBuffer[cPrintable] >= UNICODE_SPACE)
+                {
+                    cPrintable++;
+                }
+
+                while (cPrintable && cBytes)
                 {
-                    if (cBytes < 2)
+                    bool fFullWidth = false;
+                    const size_t cRun = GetSameWidthGlyphRunLength({ pwchBuffer, cPrintable }, fFullWidth);
+
+                    if (fFullWidth)
                     {
-                        return TRUE;
+                        if (cBytes < 2)
+                        {
+                            // the budget ends inside a full width character
+                            return TRUE;
+                        }
+
+                        const size_t cFit = std::min(cRun, cBytes / 2);
+                        cWords -= cFit;
+                        cPrintable -= cFit;
+                        cBytes -= cFit * 2;
+                        pwchBuffer += cFit;
+                        sOriginalXPosition += gsl::narrow_cast<SHORT>(cFit * 2);
                     }
                     else
                     {
-                        cWords--;
-                        cBytes -= 2;
-                        pwchBuffer++;
-                        sOriginalXPosition += 2;
+                        const size_t cFit = std::min(cRun, cBytes);
+                        cWords -= cFit;
+                        cPrintable -= cFit;
+                        cBytes -= cFit;
+                        pwchBuffer += cFit;
+                        sOriginalXPosition += gsl::narrow_cast<SHORT>(cFit);
                     }
                 }
-                else
-                {
-                    cWords--;
-                    cBytes--;
-                    pwchBuffer++;
-                    sOriginalXPosition++;
-                }
             }
             else
             {
@@ -302,9 +327,14 @@ int ConvertOutputToUnicode(_In_ UINT uiCodePage,
     {
         try
         {
-            // buffers overlap so we need to copy one
-            std::string copyData(pchSource, cchSource);
-            return MultiByteToWideChar(uiCodePage, MB_USEGLYPHCHARS, copyData.data(), cchSource, pwchTarget, cchTarget);
+            // The buffers overlap, so the source has to be snapped off first.
+            // Use the same reused per-thread scratch pattern as the
+            // converters in types\convert.cpp; assign keeps the capacity
+            // across calls, so steady-state legacy output stops allocating
+            // here.
+            thread_local static std::string scratch;
+            scratch.assign(pchSource, cchSource);
+            return MultiByteToWideChar(uiCodePage, MB_USEGLYPHCHARS, scratch.data(), cchSource, pwchTarget, cchTarget);
         }
         catch (...)
         {
@@ -281,10 +281,10 @@ static void _ScrollScreen(SCREEN_INFORMATION& screenInfo, const Viewport& source
     // Get the render target and send it commands.
     // It will figure out whether or not we're active and where the messages need to go.
     auto& render = screenInfo.GetRenderTarget();
-    // Redraw anything in the target area
-    render.TriggerRedraw(target);
-    // Also redraw anything that was filled.
-    render.TriggerRedraw(fill);
+    // Describe the move as a move. Engines that can replay it (the VT
+    // renderer, with margin scrolls) avoid repainting the target area;
+    // everyone else redraws the target and fill like before.
+    render.TriggerScrollRegion(source, target, fill);
 }
 
 // Routine Description:
@@ -6,8 +6,10 @@
 #include "outputStream.hpp"
 
 #include "_stream.h"
+#include "_output.h"
 #include "getset.h"
 #include "directio.h"
+#include "handle.h"
 
 #include "../interactivity/inc/ServiceLocator.hpp"
 
@@ -36,12 +38,12 @@ void WriteBuffer::Print(const wchar_t wch)
 // Routine Description:
 // - Handles the print action from the state machine
 // Arguments:
-// - wch - The character to be printed.
+// - string - The string to be printed.
 // Return Value:
 // - <none>
-void WriteBuffer::PrintString(const wchar_t* const rgwch, const size_t cch)
+void WriteBuffer::PrintString(const std::wstring_view string)
 {
-    _DefaultStringCase(rgwch, cch);
+    _DefaultStringCase(string);
 }
 
 // Routine Description:
@@ -63,25 +65,25 @@ void WriteBuffer::Execute(const wchar_t wch)
 // - <none>
 void WriteBuffer::_DefaultCase(const wchar_t wch)
 {
-    _DefaultStringCase(const_cast<wchar_t*>(&wch), 1); // WriteCharsLegacy wants mutable chars, so we'll givve it mutable chars.
+    _DefaultStringCase({ &wch, 1 });
 }
 
 // Routine Description:
 // - Default text editing/printing handler for all characters that were not routed elsewhere by other state machine intercepts.
 // Arguments:
-// - wch - The character to be processed by our default text editing/printing mechanisms.
+// - string - The string to be processed by our default text editing/printing mechanisms.
 // Return Value:
 // - <none>
-void WriteBuffer::_DefaultStringCase(_In_reads_(cch) const wchar_t* const rgwch, const size_t cch)
+void WriteBuffer::_DefaultStringCase(const std::wstring_view string)
 {
-    size_t dwNumBytes = cch * sizeof(wchar_t);
+    size_t dwNumBytes = string.size() * sizeof(wchar_t);
 
     _io.GetActiveOutputBuffer().GetTextBuffer().GetCursor().SetIsOn(true);
 
     _ntstatus = WriteCharsLegacy(_io.GetActiveOutputBuffer(),
-                                 rgwch,
-                                 rgwch,
-                                 rgwch,
+                                 string.data(),
+                                 string.data(),
+                                 string.data(),
                                  &dwNumBytes,
                                  nullptr,
                                  _io.GetActiveOutputBuffer().GetTextBuffer().GetCursor().GetPosition().X,
@@ -118,14 +120,16 @@ BOOL ConhostInternalGetSet::SetConsoleScreenBufferInfoEx(const CONSOLE_SCREEN_BU
 }
 
 // Routine Description:
-// - Connects the SetConsoleCursorPosition API call directly into our Driver Message servicing call inside Conhost.exe
+// - Connects the SetConsoleCursorPosition call directly onto the host's screen buffer, bypassing API-message servicing
 // Arguments:
 // - coordCursorPosition - new cursor position to set like the public API call.
 // Return Value:
-// - TRUE if successful (see DoSrvSetConsoleCursorPosition). FALSE otherwise.
+// - TRUE if successful (see DoSrvPrivateSetCursorPosition). FALSE otherwise.
 BOOL ConhostInternalGetSet::SetConsoleCursorPosition(const COORD coordCursorPosition)
 {
-    return SUCCEEDED(ServiceLocator::LocateGlobals().api.SetConsoleCursorPositionImpl(_io.GetActiveOutputBuffer(), coordCursorPosition));
+    // In-process fast path: the adapter already holds the console lock, so
+    // skip the out-of-process API servicing ceremony the Impl carries.
+    return SUCCEEDED(DoSrvPrivateSetCursorPosition(_io.GetActiveOutputBuffer(), coordCursorPosition));
 }
 
 // Routine Description:
@@ -158,39 +162,43 @@ BOOL ConhostInternalGetSet::SetConsoleCursorInfo(const CONSOLE_CURSOR_INFO* cons
 }
 
 // Routine Description:
-// - Connects the FillConsoleOutputCharacter API call directly into our Driver Message servicing call inside Conhost.exe
+// - Connects the FillConsoleOutputCharacter call directly onto the host's screen buffer, bypassing API-message servicing
 // Arguments:
 // - wch - Character to use for filling the buffer
 // - nLength - The length of the fill run in characters (depending on mode, will wrap at the window edge so multiple lines are the sum of the total length)
 // - dwWriteCoord - The first fill character's coordinate position in the buffer (writes continue rightward and possibly down from there)
 // - numberOfCharsWritten - Pointer to memory location to hold the total number of characters written into the buffer
 // Return Value:
-// - TRUE if successful (see FillConsoleOutputCharacterWImpl). FALSE otherwise.
+// - TRUE if successful (see DoSrvPrivateFillOutputCharacter). FALSE otherwise.
 BOOL ConhostInternalGetSet::FillConsoleOutputCharacterW(const WCHAR wch, const DWORD nLength, const COORD dwWriteCoord, size_t& numberOfCharsWritten) noexcept
 {
-    return SUCCEEDED(ServiceLocator::LocateGlobals().api.FillConsoleOutputCharacterWImpl(_io.GetActiveOutputBuffer(),
-                                                                                         wch,
-                                                                                         nLength,
-                                                                                         dwWriteCoord,
-                                                                                         numberOfCharsWritten));
+    // In-process fast path: the adapter already holds the console lock, so
+    // skip the out-of-process API servicing ceremony the Impl carries.
+    return SUCCEEDED(DoSrvPrivateFillOutputCharacter(_io.GetActiveOutputBuffer(),
+                                                     wch,
+                                                     nLength,
+                                                     dwWriteCoord,
+                                                     numberOfCharsWritten));
 }
 
 // Routine Description:
-// - Connects the FillConsoleOutputAttribute API call directly into our Driver Message servicing call inside Conhost.exe
+// - Connects the FillConsoleOutputAttribute call directly onto the host's screen buffer, bypassing API-message servicing
 // Arguments:
 // - wAttribute - Text attribute (colors/font style) for filling the buffer
 // - nLength - The length of the fill run in characters (depending on mode, will wrap at the window edge so multiple lines are the sum of the total length)
 // - dwWriteCoord - The first fill character's coordinate position in the buffer (writes continue rightward and possibly down from there)
 // - numberOfCharsWritten - Pointer to memory location to hold the total number of text attributes written into the buffer
 // Return Value:
-// - TRUE if successful (see FillConsoleOutputAttributeImpl). FALSE otherwise.
+// - TRUE if successful (see DoSrvPrivateFillOutputAttribute). FALSE otherwise.
 BOOL ConhostInternalGetSet::FillConsoleOutputAttribute(const WORD wAttribute, const DWORD nLength, const COORD dwWriteCoord, size_t& numberOfAttrsWritten) noexcept
 {
-    return SUCCEEDED(ServiceLocator::LocateGlobals().api.FillConsoleOutputAttributeImpl(_io.GetActiveOutputBuffer(),
-                                                                                        wAttribute,
-                                                                                        nLength,
-                                                                                        dwWriteCoord,
-                                                                                        numberOfAttrsWritten));
+    // In-process fast path: the adapter already holds the console lock, so
+    // skip the out-of-process API servicing ceremony the Impl carries.
+    return SUCCEEDED(DoSrvPrivateFillOutputAttribute(_io.GetActiveOutputBuffer(),
+                                                     wAttribute,
+                                                     nLength,
+                                                     dwWriteCoord,
+                                                     numberOfAttrsWritten));
 }
 
 // Routine Description:
@@ -775,6 +783,39 @@ BOOL ConhostInternalGetSet::PrivateSetDefaultForeground(const COLORREF value) co
     return SUCCEEDED(DoSrvPrivateSetDefaultForegroundColor(value));
 }
 
+// Routine Description:
+// - Opens a batched edit scope on the output buffer. The adapter brackets a
+//      group of region operations (fills, scrolls) with Begin/End so the host
+//      applies the whole group under a single console lock acquisition and the
+//      renderer picks it all up as one frame, instead of re-locking and
+//      re-invalidating per operation.
+// - The console lock is recursive, so batches may nest (and the individual
+//      API servicing calls inside the batch still take it without deadlock);
+//      the scope actually closes when the outermost End releases the lock.
+// Arguments:
+// - <none>
+// Return Value:
+// - TRUE always.
+BOOL ConhostInternalGetSet::PrivateBeginOutputBatch()
+{
+    LockConsole();
+    return TRUE;
+}
+
+// Routine Description:
+// - Closes the batched edit scope opened by PrivateBeginOutputBatch. Once the
+//      lock is released, the render thread can take it and paint everything
+//      the batch queued in one pass.
+// Arguments:
+// - <none>
+// Return Value:
+// - TRUE always.
+BOOL ConhostInternalGetSet::PrivateEndOutputBatch()
+{
+    UnlockConsole();
+    return TRUE;
+}
+
 // Method Description:
 // - Connects the PrivateSetDefaultBackground call directly into our Driver Message servicing
 //      call inside Conhost.exe
@@ -29,14 +29,14 @@ public:
 
     // Implement Adapter callbacks for default cases (non-escape sequences)
     void Print(const wchar_t wch) override;
-    void PrintString(const wchar_t* const rgwch, const size_t cch) override;
+    void PrintString(const std::wstring_view string) override;
     void Execute(const wchar_t wch) override;
 
     [[nodiscard]] NTSTATUS GetResult() { return _ntstatus; };
 
 private:
     void _DefaultCase(const wchar_t wch);
-    void _DefaultStringCase(_In_reads_(cch) const wchar_t* const rgwch, const size_t cch);
+    void _DefaultStringCase(const std::wstring_view string);
 
     Microsoft::Console::IIoProvider& _io;
     NTSTATUS _ntstatus;
@@ -142,6 +142,9 @@ public:
 
     BOOL PrivateRefreshWindow() override;
 
+    BOOL PrivateBeginOutputBatch() override;
+    BOOL PrivateEndOutputBatch() override;
+
     BOOL PrivateSuppressResizeRepaint() override;
 
     BOOL PrivateWriteConsoleControlInput(_In_ KeyEvent key) override;
@@ -53,6 +53,17 @@ Popup::Popup(SCREEN_INFORMATION& screenInfo, const COORD proposedSize) :
     // copy the data into the backup buffer
     _oldContents = std::move(screenInfo.ReadRect(Viewport::FromInclusive(TargetRect)));
 
+    // Allocate the staging area where the border and contents are composed
+    // before being committed to the screen buffer in one write, and prefill
+    // it with blanks in the popup colors.
+    _staging = OutputCellRect(gsl::narrow<size_t>(size.Y), gsl::narrow<size_t>(size.X));
+    const OutputCell fillCell{ std::wstring_view{ &UNICODE_SPACE, 1 }, {}, _attributes };
+    for (size_t row = 0; row < _staging.Height(); row++)
+    {
+        const auto span = _staging.GetRow(row);
+        std::fill(span.begin(), span.end(), fillCell);
+    }
+
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     const auto countWas = gci.PopupCount.fetch_add(1ui16);
     if (0 == countWas)
@@ -80,60 +91,102 @@ void Popup::Draw()
 {
     _DrawBorder();
     _DrawContent();
+    _CommitStagedDraw();
 }
 
 // Routine Description:
-// - Draws the outlines of the popup area in the screen buffer
-void Popup::_DrawBorder()
+// - Fills a run of cells in the staging area with the given character and attribute.
+// Arguments:
+// - popupPos - Position relative to the top left corner of the popup region
+// - wch - Character to fill with
+// - attr - Attribute to fill with
+// - count - Number of cells to fill (clipped to the popup width)
+void Popup::_StageFill(const COORD popupPos, const wchar_t wch, const TextAttribute attr, const size_t count)
 {
-    // fill attributes of top line
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left;
-    WriteCoord.Y = _region.Top;
-    _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
-
-    // draw upper left corner
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[UPPER_LEFT_CORNER], 1), WriteCoord);
-
-    // draw upper bar
-    WriteCoord.X += 1;
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[HORIZONTAL_LINE], Width()), WriteCoord);
-
-    // draw upper right corner
-    WriteCoord.X = _region.Right;
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[UPPER_RIGHT_CORNER], 1), WriteCoord);
-
-    for (SHORT i = 0; i < Height(); i++)
+    const auto row = _staging.GetRow(gsl::narrow<size_t>(popupPos.Y));
+    const OutputCell cell{ std::wstring_view{ &wch, 1 }, {}, attr };
+    const size_t end = std::min(row.size(), gsl::narrow<size_t>(popupPos.X) + count);
+    for (size_t x = gsl::narrow<size_t>(popupPos.X); x < end; x++)
     {
-        WriteCoord.Y += 1;
-        WriteCoord.X = _region.Left;
+        row[x] = cell;
+    }
+}
 
-        // fill attributes
-        _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
+// Routine Description:
+// - Writes text into the staging area, splitting full-width glyphs into
+//   leading/trailing cell pairs just like a buffer write would.
+// Arguments:
+// - popupPos - Position relative to the top left corner of the popup region
+// - text - Text to lay into the staging cells
+// - attr - Attribute to apply to the text
+void Popup::_StageText(const COORD popupPos, const std::wstring_view text, const TextAttribute attr)
+{
+    const auto row = _staging.GetRow(gsl::narrow<size_t>(popupPos.Y));
+    OutputCellIterator it(text, attr);
+    size_t x = gsl::narrow<size_t>(popupPos.X);
+    while (it && x < row.size())
+    {
+        row[x] = OutputCell(*it);
+        ++it;
+        x++;
+    }
 
-        _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[VERTICAL_LINE], 1), WriteCoord);
+    // Don't leave half of a full-width glyph hanging at the right edge.
+    if (x == row.size() && row[x - 1].DbcsAttr().IsLeading())
+    {
+        row[x - 1] = OutputCell{ std::wstring_view{ &UNICODE_SPACE, 1 }, {}, attr };
+    }
+}
 
-        WriteCoord.X = _region.Right;
-        _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[VERTICAL_LINE], 1), WriteCoord);
+// Routine Description:
+// - Applies an attribute to a run of already staged cells, preserving their text.
+// Arguments:
+// - popupPos - Position relative to the top left corner of the popup region
+// - attr - Attribute to apply
+// - count - Number of cells to recolor (clipped to the popup width)
+void Popup::_StageAttributes(const COORD popupPos, const TextAttribute attr, const size_t count)
+{
+    const auto row = _staging.GetRow(gsl::narrow<size_t>(popupPos.Y));
+    const size_t end = std::min(row.size(), gsl::narrow<size_t>(popupPos.X) + count);
+    for (size_t x = gsl::narrow<size_t>(popupPos.X); x < end; x++)
+    {
+        row[x].TextAttr() = attr;
     }
+}
+
+// Routine Description:
+// - Commits the staged popup image to the screen buffer in a single
+//   rectangular write so a full repaint costs one write and one
+//   invalidation instead of one per border piece and row.
+void Popup::_CommitStagedDraw()
+{
+    _screenInfo.WriteRect(_staging, { _region.Left, _region.Top });
+}
 
-    // Draw bottom line.
-    // Fill attributes of top line.
-    WriteCoord.X = _region.Left;
-    WriteCoord.Y = _region.Bottom;
-    _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
+// Routine Description:
+// - Stages the outlines of the popup area. The interior cells were prefilled
+//   with blanks in the popup colors and are composed by the content draw.
+void Popup::_DrawBorder()
+{
+    const SHORT rightCol = gsl::narrow<SHORT>(Width() + 1i16);
+    const SHORT bottomRow = gsl::narrow<SHORT>(Height() + 1i16);
 
-    // Draw bottom left corner.
-    WriteCoord.X = _region.Left;
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[BOTTOM_LEFT_CORNER], 1), WriteCoord);
+    // draw upper border
+    _StageFill({ 0, 0 }, _screenInfo.LineChar[UPPER_LEFT_CORNER], _attributes, 1);
+    _StageFill({ 1, 0 }, _screenInfo.LineChar[HORIZONTAL_LINE], _attributes, Width());
+    _StageFill({ rightCol, 0 }, _screenInfo.LineChar[UPPER_RIGHT_CORNER], _attributes, 1);
 
-    // Draw lower bar.
-    WriteCoord.X += 1;
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[HORIZONTAL_LINE], Width()), WriteCoord);
+    // draw side borders
+    for (SHORT i = 1; i < bottomRow; i++)
+    {
+        _StageFill({ 0, i }, _screenInfo.LineChar[VERTICAL_LINE], _attributes, 1);
+        _StageFill({ rightCol, i }, _screenInfo.LineChar[VERTICAL_LINE], _attributes, 1);
+    }
 
-    // draw lower right corner
-    WriteCoord.X = _region.Right;
-    _screenInfo.Write(OutputCellIterator(_screenInfo.LineChar[BOTTOM_RIGHT_CORNER], 1), WriteCoord);
+    // draw bottom border
+    _StageFill({ 0, bottomRow }, _screenInfo.LineChar[BOTTOM_LEFT_CORNER], _attributes, 1);
+    _StageFill({ 1, bottomRow }, _screenInfo.LineChar[HORIZONTAL_LINE], _attributes, Width());
+    _StageFill({ rightCol, bottomRow }, _screenInfo.LineChar[BOTTOM_RIGHT_CORNER], _attributes, 1);
 }
 
 // Routine Description:
@@ -144,35 +197,19 @@ void Popup::_DrawPrompt(const UINT id)
 {
     std::wstring text = _LoadString(id);
 
-    // Draw empty popup.
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left + 1i16;
-    WriteCoord.Y = _region.Top + 1i16;
-    size_t lStringLength = Width();
+    // Stage an empty popup interior.
     for (SHORT i = 0; i < Height(); i++)
     {
-        const OutputCellIterator it(UNICODE_SPACE, _attributes, lStringLength);
-        const auto done = _screenInfo.Write(it, WriteCoord);
-        lStringLength = done.GetCellDistance(it);
-
-        WriteCoord.Y += 1;
+        _StageFill({ 1i16, gsl::narrow<SHORT>(i + 1i16) }, UNICODE_SPACE, _attributes, Width());
     }
 
-    WriteCoord.X = _region.Left + 1i16;
-    WriteCoord.Y = _region.Top + 1i16;
-
-    // write prompt to screen
-    lStringLength = text.size();
-    if (lStringLength > (ULONG)Width())
+    // stage the prompt text
+    if (text.size() > gsl::narrow<size_t>(Width()))
     {
         text = text.substr(0, Width());
     }
 
-    size_t used;
-    LOG_IF_FAILED(ServiceLocator::LocateGlobals().api.WriteConsoleOutputCharacterWImpl(_screenInfo,
-                                                                                       text,
-                                                                                       WriteCoord,
-                                                                                       used));
+    _StageText({ 1i16, 1i16 }, text, _attributes);
 }
 
 // Routine Description:
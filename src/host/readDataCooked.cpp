@@ -577,6 +577,7 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
     else
     {
         bool CallWrite = true;
+        size_t DamageStart = 0;
         const SHORT sScreenBufferSizeX = _screenInfo.GetBufferSize().Width();
 
         // processing in the middle of the line is more complex:
@@ -642,6 +643,9 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                         loop = true;
                     }
                 }
+
+                // everything from the deletion point on shifted left
+                DamageStart = _currentPosition;
             }
             else
             {
@@ -687,6 +691,9 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                 _bufPtr += 1;
                 _currentPosition += 1;
 
+                // only the new character and whatever it displaced changed
+                DamageStart = _currentPosition - 1;
+
                 // calculate new cursor position
                 if (_echoInput)
                 {
@@ -707,29 +714,17 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
             CursorPosition = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
             CursorPosition.X = (SHORT)(CursorPosition.X + NumSpaces);
 
-            // clear the current command line from the screen
-            // clang-format off
-#pragma prefast(suppress: __WARNING_BUFFER_OVERFLOW, "Not sure why prefast doesn't like this call.")
-            // clang-format on
-            DeleteCommandLine(*this, FALSE);
-
-            // write the new command line to the screen
-            NumToWrite = _bytesRead;
-
             DWORD dwFlags = WC_DESTRUCTIVE_BACKSPACE | WC_ECHO;
             if (wch == UNICODE_CARRIAGERETURN)
             {
                 dwFlags |= WC_KEEP_CURSOR_VISIBLE;
             }
-            status = WriteCharsLegacy(_screenInfo,
-                                      _backupLimit,
-                                      _backupLimit,
-                                      _backupLimit,
-                                      &NumToWrite,
-                                      &_visibleCharCount,
-                                      _originalCursorPosition.X,
-                                      dwFlags,
-                                      &ScrollY);
+
+            // rewrite only the cells from the edit point forward. the
+            // characters ahead of it still occupy the same cells, so erasing
+            // and repainting the whole prompt (the old DeleteCommandLine
+            // dance) would make every keystroke cost the full line length.
+            status = _redrawFromChar(DamageStart, dwFlags, ScrollY);
             if (!NT_SUCCESS(status))
             {
                 RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed 0x%x", status);
@@ -815,6 +810,96 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
     return false;
 }
 
+// Routine Description:
+// - Repaints the edit line from the given character index to the end, leaving
+//   the cells ahead of the index untouched. Any cells that a longer, previous
+//   rendition of the line occupied past the new end of text are blanked.
+// - Falls back to a full erase-and-repaint when the start of the prompt has
+//   scrolled off the top of the buffer, since the cell math below needs a
+//   valid origin.
+// Arguments:
+// - startChar - index into the prompt storage of the first changed character
+// - dwFlags - flags to pass through to WriteCharsLegacy
+// - scrollY - on output, the number of lines the screen scrolled during the write
+// Return Value:
+// - Status code from writing the characters to the screen.
+[[nodiscard]] NTSTATUS COOKED_READ_DATA::_redrawFromChar(const size_t startChar, const DWORD dwFlags, _Out_ SHORT& scrollY) noexcept
+{
+    scrollY = 0;
+
+    if (_originalCursorPosition.Y < 0 || startChar * sizeof(wchar_t) > _bytesRead)
+    {
+        // clang-format off
+#pragma prefast(suppress: __WARNING_BUFFER_OVERFLOW, "Not sure why prefast doesn't like this call.")
+        // clang-format on
+        DeleteCommandLine(*this, FALSE);
+        size_t NumToWrite = _bytesRead;
+        return WriteCharsLegacy(_screenInfo,
+                                _backupLimit,
+                                _backupLimit,
+                                _backupLimit,
+                                &NumToWrite,
+                                &_visibleCharCount,
+                                _originalCursorPosition.X,
+                                dwFlags,
+                                &scrollY);
+    }
+
+    const size_t oldVisibleCharCount = _visibleCharCount;
+
+    // park the cursor on the first changed cell
+    const size_t prefixSpaces = RetrieveTotalNumberOfSpaces(_originalCursorPosition.X,
+                                                            _backupLimit,
+                                                            startChar);
+    COORD coordDamage = _originalCursorPosition;
+    coordDamage.X = (SHORT)(coordDamage.X + prefixSpaces);
+    if (CheckBisectStringW(_backupLimit,
+                           startChar,
+                           _screenInfo.GetBufferSize().Width() - _originalCursorPosition.X))
+    {
+        coordDamage.X++;
+    }
+    NTSTATUS Status = AdjustCursorPosition(_screenInfo, coordDamage, FALSE, nullptr);
+    if (!NT_SUCCESS(Status))
+    {
+        return Status;
+    }
+
+    // write the changed portion of the command line to the screen
+    size_t NumToWrite = _bytesRead - startChar * sizeof(wchar_t);
+    size_t suffixSpaces = 0;
+    Status = WriteCharsLegacy(_screenInfo,
+                              _backupLimit,
+                              _backupLimit + startChar,
+                              _backupLimit + startChar,
+                              &NumToWrite,
+                              &suffixSpaces,
+                              _originalCursorPosition.X,
+                              dwFlags,
+                              &scrollY);
+    if (!NT_SUCCESS(Status))
+    {
+        return Status;
+    }
+
+    _visibleCharCount = prefixSpaces + suffixSpaces;
+
+    // a deletion leaves cells of the previous, longer rendition behind the new
+    // end of text. blank them, plus one cell for possible bisect padding,
+    // mirroring DeleteCommandLine's accounting.
+    if (_visibleCharCount < oldVisibleCharCount)
+    {
+        const COORD coordEnd = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
+        try
+        {
+            _screenInfo.Write(OutputCellIterator(UNICODE_SPACE, oldVisibleCharCount - _visibleCharCount + 1), coordEnd);
+        }
+        CATCH_LOG();
+    }
+
+    return Status;
+}
+
 // Routine Description:
 // - Writes string to current position in prompt line. can overwrite text to the right of the cursor.
 // Arguments:
@@ -154,6 +154,8 @@ private:
     bool _insertMode;
     bool _unicode;
 
+    [[nodiscard]] NTSTATUS _redrawFromChar(const size_t startChar, const DWORD dwFlags, _Out_ SHORT& scrollY) noexcept;
+
     [[nodiscard]] NTSTATUS _readCharInputLoop(const bool isUnicode, size_t& numBytes) noexcept;
 
     [[nodiscard]] NTSTATUS _handlePostCharInputLoop(const bool isUnicode, size_t& numBytes, ULONG& controlKeyState) noexcept;
@@ -59,8 +59,8 @@ DirectReadData::~DirectReadData()
 // - pControlKeyState - For certain types of reads, this specifies
 // which modifier keys were held.
 // - pOutputData - a pointer to a
-// std::deque<std::unique_ptr<IInputEvent>> that is used to the read
-// input events back to the server
+// std::deque<INPUT_RECORD> that is used to return the read
+// input records back to the server
 // Return Value:
 // - true if the wait is done and result buffer/status code can be sent back to the client.
 // - false if we need to continue to wait until more data is available.
@@ -183,10 +183,14 @@ bool DirectReadData::Notify(const WaitTerminationReason TerminationReason,
             FAIL_FAST_IF(!(readEvents.empty()));
         }
 
-        // move events to pOutputData
-        std::deque<std::unique_ptr<IInputEvent>>* const pOutputDeque = reinterpret_cast<std::deque<std::unique_ptr<IInputEvent>>* const>(pOutputData);
+        // move events to pOutputData, flattening back to records at the boundary
+        std::deque<INPUT_RECORD>* const pOutputDeque = reinterpret_cast<std::deque<INPUT_RECORD>* const>(pOutputData);
         *pNumBytes = _outEvents.size() * sizeof(INPUT_RECORD);
-        pOutputDeque->swap(_outEvents);
+        while (!_outEvents.empty())
+        {
+            pOutputDeque->push_back(_outEvents.front()->ToInputRecord());
+            _outEvents.pop_front();
+        }
     }
     return retVal;
 }
@@ -160,24 +160,22 @@ bool RAW_READ_DATA::Notify(const WaitTerminationReason TerminationReason,
             NumBytes += IsGlyphFullWidth(*lpBuffer) ? 2 : 1;
             lpBuffer++;
             *pNumBytes += sizeof(WCHAR);
-            while (*pNumBytes < _BufferSize)
+
+            // The rest of the user buffer is serviced with one bulk drain of
+            // the ready events instead of a GetChar - and an
+            // InputBuffer::Read - per character.
+            size_t cchRead = 0;
+            LOG_IF_NTSTATUS_FAILED(GetCharsFromReadyEvents(_pInputBuffer,
+                                                           lpBuffer,
+                                                           (_BufferSize - *pNumBytes) / sizeof(WCHAR),
+                                                           &cchRead));
+            for (size_t i = 0; i < cchRead; i++)
             {
-                // This call to GetChar won't block.
-                *pReplyStatus = GetChar(_pInputBuffer,
-                                        lpBuffer,
-                                        false,
-                                        nullptr,
-                                        nullptr,
-                                        nullptr);
-                if (!NT_SUCCESS(*pReplyStatus))
-                {
-                    *pReplyStatus = STATUS_SUCCESS;
-                    break;
-                }
-                NumBytes += IsGlyphFullWidth(*lpBuffer) ? 2 : 1;
-                lpBuffer++;
-                *pNumBytes += sizeof(WCHAR);
+                NumBytes += IsGlyphFullWidth(lpBuffer[i]) ? 2 : 1;
             }
+            lpBuffer += cchRead;
+            *pNumBytes += cchRead * sizeof(WCHAR);
+            *pReplyStatus = STATUS_SUCCESS;
         }
     }
 
@@ -7,6 +7,7 @@
 
 #include "dbcs.h"
 #include "handle.h"
+#include "tracing.hpp"
 
 #include "..\interactivity\inc\ServiceLocator.hpp"
 
@@ -288,6 +289,39 @@ const std::wstring RenderData::GetConsoleTitle() const noexcept
     return gci.GetTitleAndPrefix();
 }
 
+// Routine Description:
+// - Finds (or fills) the cache slot holding the resolved colors for the given
+//   attribute. Both components are resolved on a miss since the renderer
+//   invariably asks for both for every run it paints.
+// Arguments:
+// - attr - the attribute to resolve against the color table and defaults
+// Return Value:
+// - Reference to the (now valid) cache entry for this attribute.
+RenderData::_ResolvedColors& RenderData::_LookupColorCache(const TextAttribute& attr) const noexcept
+{
+    // FNV-1a over the attribute bytes; TextAttribute is packed and every bit
+    // is deterministically written, so hashing its representation is sound
+    // (the same property its memcmp-based operator== relies on).
+    const auto pbAttr = reinterpret_cast<const BYTE*>(&attr);
+    size_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(attr); i++)
+    {
+        hash = (hash ^ pbAttr[i]) * 16777619u;
+    }
+
+    _ResolvedColors& entry = _rgColorCache[hash % s_cColorCacheSlots];
+    if (!entry.fValid || !(entry.attr == attr))
+    {
+        const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        entry.attr = attr;
+        entry.rgbForeground = gci.LookupForegroundColor(attr);
+        entry.rgbBackground = gci.LookupBackgroundColor(attr);
+        entry.fValid = true;
+    }
+
+    return entry;
+}
+
 // Routine Description:
 // - Converts a text attribute into the foreground RGB value that should be presented, applying
 //   relevant table translation information and preferences.
@@ -295,8 +329,7 @@ const std::wstring RenderData::GetConsoleTitle() const noexcept
 // - ARGB color value
 const COLORREF RenderData::GetForegroundColor(const TextAttribute& attr) const noexcept
 {
-    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
-    return gci.LookupForegroundColor(attr);
+    return _LookupColorCache(attr).rgbForeground;
 }
 
 // Routine Description:
@@ -306,8 +339,7 @@ const COLORREF RenderData::GetForegroundColor(const TextAttribute& attr) const n
 // - ARGB color value
 const COLORREF RenderData::GetBackgroundColor(const TextAttribute& attr) const noexcept
 {
-    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
-    return gci.LookupBackgroundColor(attr);
+    return _LookupColorCache(attr).rgbBackground;
 }
 
 // Method Description:
@@ -319,11 +351,35 @@ const COLORREF RenderData::GetBackgroundColor(const TextAttribute& attr) const n
 void RenderData::LockConsole() noexcept
 {
     ::LockConsole();
+
+    // The color table or default attributes may have changed since the last
+    // frame; drop any resolutions cached from it. While we hold the lock the
+    // settings are stable, so entries cached during this frame stay valid.
+    for (auto& entry : _rgColorCache)
+    {
+        entry.fValid = false;
+    }
 }
 
 // Method Description:
 // - Unlocks the console after a call to RenderData::LockConsole.
+// - A frame has just been composed, so this is also where the accessibility
+//   notifications that accumulated during the frame get dispatched - once per
+//   frame instead of once per write, while we still hold the lock.
 void RenderData::UnlockConsole() noexcept
 {
+    try
+    {
+        CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        if (gci.HasActiveOutputBuffer())
+        {
+            gci.GetActiveOutputBuffer().FlushAccessibilityEventing();
+        }
+    }
+    CATCH_LOG();
+
     ::UnlockConsole();
+
+    PerfCounters::s_Increment(PerfCounters::Counter::FramesRendered);
+    PerfCounters::s_EmitIfDue();
 }
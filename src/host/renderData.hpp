@@ -46,4 +46,26 @@ public:
 
     void LockConsole() noexcept override;
     void UnlockConsole() noexcept override;
+
+private:
+    // Resolving a TextAttribute against the color table re-runs the
+    // default/legacy/reverse-video rules on every call, and a full-screen
+    // repaint asks for the same handful of attributes thousands of times
+    // (once per run occurrence). Remember resolutions for the duration of a
+    // frame instead: the cache is flushed each time the console is locked
+    // for painting, and the settings it depends on can't change while the
+    // lock is held. Direct-mapped with overwrite-on-collision - distinct
+    // attributes on screen at once are few, so a tiny table suffices.
+    struct _ResolvedColors
+    {
+        TextAttribute attr;
+        COLORREF rgbForeground;
+        COLORREF rgbBackground;
+        bool fValid;
+    };
+
+    static constexpr size_t s_cColorCacheSlots = 32;
+    mutable _ResolvedColors _rgColorCache[s_cColorCacheSlots] = {};
+
+    _ResolvedColors& _LookupColorCache(const TextAttribute& attr) const noexcept;
 };
@@ -7,20 +7,41 @@
 
 #pragma hdrstop
 
-RenderFontDefaults::RenderFontDefaults()
+RenderFontDefaults::RenderFontDefaults() :
+    _fListLoaded{ false }
 {
-    LOG_IF_NTSTATUS_FAILED(TrueTypeFontList::s_Initialize());
+    // The TrueType font list is read from the registry on first use instead
+    // of here; constructing this object is on the startup path of every
+    // conhost launch and many sessions (conpty in particular) never ask for
+    // a default font at all.
 }
 
 RenderFontDefaults::~RenderFontDefaults()
 {
-    LOG_IF_FAILED(TrueTypeFontList::s_Destroy());
+    if (_fListLoaded)
+    {
+        LOG_IF_FAILED(TrueTypeFontList::s_Destroy());
+    }
+}
+
+// Routine Description:
+// - Reads the TrueType font list out of the registry if it hasn't been
+//   loaded yet. Callers are serialized by the console lock.
+void RenderFontDefaults::_EnsureListLoaded()
+{
+    if (!_fListLoaded)
+    {
+        LOG_IF_NTSTATUS_FAILED(TrueTypeFontList::s_Initialize());
+        _fListLoaded = true;
+    }
 }
 
 [[nodiscard]] HRESULT RenderFontDefaults::RetrieveDefaultFontNameForCodepage(const UINT uiCodePage,
                                                                              _Out_writes_(cchFaceName) PWSTR pwszFaceName,
                                                                              const size_t cchFaceName)
 {
+    _EnsureListLoaded();
+
     NTSTATUS status = TrueTypeFontList::s_SearchByCodePage(uiCodePage, pwszFaceName, cchFaceName);
     return HRESULT_FROM_NT(status);
 }
@@ -25,4 +25,9 @@ public:
     [[nodiscard]] HRESULT RetrieveDefaultFontNameForCodepage(const UINT uiCodePage,
                                                              _Out_writes_(cchFaceName) PWSTR pwszFaceName,
                                                              const size_t cchFaceName);
+
+private:
+    void _EnsureListLoaded();
+
+    bool _fListLoaded;
 };
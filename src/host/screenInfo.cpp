@@ -51,10 +51,14 @@ SCREEN_INFORMATION::SCREEN_INFORMATION(
     _scrollMargins{ Viewport::FromCoord({ 0 }) },
     _viewport(Viewport::Empty()),
     _psiAlternateBuffer{ nullptr },
+    _psiPooledAltBuffer{ nullptr },
     _psiMainBuffer{ nullptr },
     _rcAltSavedClientNew{ 0 },
     _rcAltSavedClientOld{ 0 },
     _fAltWindowChanged{ false },
+    _fAccessibilityNotifyPending{ false },
+    _coordAccessibilityStart{ 0, 0 },
+    _coordAccessibilityEnd{ 0, 0 },
     _PopupAttributes{ popupAttributes },
     _tabStops{},
     _virtualBottom{ 0 },
@@ -214,13 +218,28 @@ void SCREEN_INFORMATION::s_InsertScreenBuffer(_In_ SCREEN_INFORMATION* const pSc
 }
 
 // Routine Description:
-// - This routine removes the screen buffer pointer from the console's list of screen buffers.
+// - This routine removes the screen buffer pointer from the console's list of screen buffers and frees it.
 // Arguments:
 // - ScreenInfo - Pointer to screen information structure.
 // Return Value:
 // Note:
 // - The console lock must be held when calling this routine.
 void SCREEN_INFORMATION::s_RemoveScreenBuffer(_In_ SCREEN_INFORMATION* const pScreenInfo)
+{
+    s_DetachScreenBuffer(pScreenInfo);
+
+    delete pScreenInfo;
+}
+
+// Routine Description:
+// - This routine removes the screen buffer pointer from the console's list of screen buffers without
+//   freeing it, so the buffer can be parked for later reuse (see UseMainScreenBuffer).
+// Arguments:
+// - ScreenInfo - Pointer to screen information structure.
+// Return Value:
+// Note:
+// - The console lock must be held when calling this routine.
+void SCREEN_INFORMATION::s_DetachScreenBuffer(_In_ SCREEN_INFORMATION* const pScreenInfo)
 {
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     if (pScreenInfo == gci.ScreenBuffers)
@@ -258,8 +277,6 @@ void SCREEN_INFORMATION::s_RemoveScreenBuffer(_In_ SCREEN_INFORMATION* const pSc
             gci.pCurrentScreenBuffer = nullptr;
         }
     }
-
-    delete pScreenInfo;
 }
 
 #pragma endregion
@@ -301,6 +318,14 @@ void SCREEN_INFORMATION::_FreeOutputStateMachine()
             s_RemoveScreenBuffer(_psiAlternateBuffer);
         }
 
+        if (_psiPooledAltBuffer != nullptr)
+        {
+            // The pooled buffer was already detached from the buffer list
+            // when it was parked, so it just needs freeing.
+            delete _psiPooledAltBuffer;
+            _psiPooledAltBuffer = nullptr;
+        }
+
         _stateMachine.reset();
     }
 }
@@ -582,48 +607,90 @@ void SCREEN_INFORMATION::UpdateFont(const FontInfo* const pfiNewFont)
 // to aggregate drawing metadata to determine whether or not to use PolyTextOut.
 // After the Nov 2015 graphics refactor, the metadata drawing flag calculation is no longer necessary.
 // This now only notifies accessibility apps of a change.
+// The notification is not dispatched immediately - with a screen reader
+// attached, the event dispatch can cost as much as the write that triggered
+// it. The changed region is merged into the pending run instead, and
+// FlushAccessibilityEventing (called by the renderer once per frame) raises a
+// single notification covering everything that changed since the last frame.
 void SCREEN_INFORMATION::NotifyAccessibilityEventing(const short sStartX,
                                                      const short sStartY,
                                                      const short sEndX,
                                                      const short sEndY)
 {
-    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
-
-    // Fire off a winevent to let accessibility apps know what changed.
     if (IsActiveScreenBuffer())
     {
         const COORD coordScreenBufferSize = GetBufferSize().Dimensions();
         FAIL_FAST_IF(!(sEndX < coordScreenBufferSize.X));
 
-        if (sStartX == sEndX && sStartY == sEndY)
+        if (!_fAccessibilityNotifyPending)
         {
-            try
+            _coordAccessibilityStart = { sStartX, sStartY };
+            _coordAccessibilityEnd = { sEndX, sEndY };
+            _fAccessibilityNotifyPending = true;
+        }
+        else
+        {
+            // Merge with the pending run: extend the endpoints in reading
+            // order so adjacent changes become one event.
+            if (sStartY < _coordAccessibilityStart.Y ||
+                (sStartY == _coordAccessibilityStart.Y && sStartX < _coordAccessibilityStart.X))
             {
-                const auto cellData = GetCellDataAt({ sStartX, sStartY });
-                const LONG charAndAttr = MAKELONG(Utf16ToUcs2(cellData->Chars()),
-                                                  gci.GenerateLegacyAttributes(cellData->TextAttr()));
-                _pAccessibilityNotifier->NotifyConsoleUpdateSimpleEvent(MAKELONG(sStartX, sStartY),
-                                                                        charAndAttr);
+                _coordAccessibilityStart = { sStartX, sStartY };
             }
-            catch (...)
+            if (sEndY > _coordAccessibilityEnd.Y ||
+                (sEndY == _coordAccessibilityEnd.Y && sEndX > _coordAccessibilityEnd.X))
             {
-                LOG_HR(wil::ResultFromCaughtException());
-                return;
+                _coordAccessibilityEnd = { sEndX, sEndY };
             }
         }
-        else
+    }
+}
+
+// Routine Description:
+// - Dispatches the accessibility notification accumulated by
+//   NotifyAccessibilityEventing since the last flush, if there is one.
+// - Called by the render thread once per frame, under the console lock.
+void SCREEN_INFORMATION::FlushAccessibilityEventing()
+{
+    if (!_fAccessibilityNotifyPending)
+    {
+        return;
+    }
+    _fAccessibilityNotifyPending = false;
+
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    const COORD coordStart = _coordAccessibilityStart;
+    const COORD coordEnd = _coordAccessibilityEnd;
+
+    // Fire off a winevent to let accessibility apps know what changed.
+    if (coordStart.X == coordEnd.X && coordStart.Y == coordEnd.Y)
+    {
+        try
         {
-            _pAccessibilityNotifier->NotifyConsoleUpdateRegionEvent(MAKELONG(sStartX, sStartY),
-                                                                    MAKELONG(sEndX, sEndY));
+            const auto cellData = GetCellDataAt(coordStart);
+            const LONG charAndAttr = MAKELONG(Utf16ToUcs2(cellData->Chars()),
+                                              gci.GenerateLegacyAttributes(cellData->TextAttr()));
+            _pAccessibilityNotifier->NotifyConsoleUpdateSimpleEvent(MAKELONG(coordStart.X, coordStart.Y),
+                                                                    charAndAttr);
         }
-        IConsoleWindow* pConsoleWindow = ServiceLocator::LocateConsoleWindow();
-        if (pConsoleWindow)
+        catch (...)
         {
-            LOG_IF_FAILED(pConsoleWindow->SignalUia(UIA_Text_TextChangedEventId));
-            // TODO MSFT 7960168 do we really need this event to not signal?
-            //pConsoleWindow->SignalUia(UIA_LayoutInvalidatedEventId);
+            LOG_HR(wil::ResultFromCaughtException());
+            return;
         }
     }
+    else
+    {
+        _pAccessibilityNotifier->NotifyConsoleUpdateRegionEvent(MAKELONG(coordStart.X, coordStart.Y),
+                                                                MAKELONG(coordEnd.X, coordEnd.Y));
+    }
+    IConsoleWindow* pConsoleWindow = ServiceLocator::LocateConsoleWindow();
+    if (pConsoleWindow)
+    {
+        LOG_IF_FAILED(pConsoleWindow->SignalUia(UIA_Text_TextChangedEventId));
+        // TODO MSFT 7960168 do we really need this event to not signal?
+        //pConsoleWindow->SignalUia(UIA_LayoutInvalidatedEventId);
+    }
 }
 
 #pragma endregion
@@ -852,7 +919,8 @@ bool SCREEN_INFORMATION::PostUpdateWindowSize() const
 // Return Value:
 // - <none>
 void SCREEN_INFORMATION::ProcessResizeWindow(const RECT* const prcClientNew,
-                                             const RECT* const prcClientOld)
+                                             const RECT* const prcClientOld,
+                                             const bool fViewportOnly)
 {
     if (_IsAltBuffer())
     {
@@ -869,8 +937,17 @@ void SCREEN_INFORMATION::ProcessResizeWindow(const RECT* const prcClientNew,
     //      return S_OK instead of S_FALSE. In that case, we'll need to re-show
     //      the commandline ourselves once the viewport size is updated.
     //      (See 1.b below)
-    const HRESULT adjustBufferSizeResult = _AdjustScreenBuffer(prcClientNew);
-    LOG_IF_FAILED(adjustBufferSizeResult);
+    //      During an interactive size/move the caller can ask us to skip this
+    //      step entirely (fViewportOnly) - a buffer resize can reflow the
+    //      whole scrollback, which is far too expensive to run per drag
+    //      message. The caller is responsible for running a full pass with the
+    //      final rectangle once the drag completes.
+    HRESULT adjustBufferSizeResult = S_FALSE;
+    if (!fViewportOnly)
+    {
+        adjustBufferSizeResult = _AdjustScreenBuffer(prcClientNew);
+        LOG_IF_FAILED(adjustBufferSizeResult);
+    }
 
     // 2. Now calculate how large the new viewport should be
     COORD coordViewportSize;
@@ -2035,6 +2112,53 @@ const SCREEN_INFORMATION& SCREEN_INFORMATION::GetMainBuffer() const
     return Status;
 }
 
+// Routine Description:
+// - Returns a previously-parked alt buffer to the state a freshly created one
+//     would have: text cleared, cursor homed and styled like the main buffer's,
+//     state reset to defaults. Clearing is cheap because rows rematerialize
+//     lazily; the megabytes of row storage are what we kept it around for.
+// Parameters:
+// - siMain - the main buffer this alt buffer is being (re)attached to.
+// Return value:
+// - <none>
+void SCREEN_INFORMATION::_RecycleAltBuffer(SCREEN_INFORMATION& siMain)
+{
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    // Take the main buffer's current state, the same way CreateInstance
+    // would have been handed it.
+    SetAttributes(siMain.GetAttributes());
+    SetPopupAttributes(*siMain.GetPopupAttributes());
+    GetCurrentFont() = siMain.GetCurrentFont();
+    GetDesiredFont() = siMain.GetDesiredFont();
+
+    // Wipe whatever the last alt-screen session left behind.
+    _textBuffer->Reset();
+
+    auto& cursor = _textBuffer->GetCursor();
+    const auto& myCursor = siMain.GetTextBuffer().GetCursor();
+    cursor.SetStyle(myCursor.GetSize(), myCursor.GetColor(), myCursor.GetType());
+    cursor.SetPosition({ 0, 0 });
+    cursor.SetIsVisible(true);
+    cursor.SetIsOn(true);
+    cursor.SetBlinkingAllowed(true);
+
+    OutputMode = ENABLE_PROCESSED_OUTPUT | ENABLE_WRAP_AT_EOL_OUTPUT;
+    if (gci.GetVirtTermLevel() != 0)
+    {
+        OutputMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    }
+
+    SetViewport(Viewport::FromDimensions({ 0, 0 }, GetBufferSize().Dimensions()), true);
+    SetScrollMargins(Viewport::FromCoord({ 0 }));
+
+    // The state machine is shared with the main buffer; refresh the reference
+    // in case it was replaced while we were parked.
+    _stateMachine = siMain._stateMachine;
+
+    SetDefaultVtTabStops();
+}
+
 // Routine Description:
 // - Creates an "alternate" screen buffer for this buffer. In virtual terminals, there exists both a "main"
 //     screen buffer and an alternate. ASBSET creates a new alternate, and switches to it. If there is an already
@@ -2054,8 +2178,40 @@ const SCREEN_INFORMATION& SCREEN_INFORMATION::GetMainBuffer() const
         siMain._fAltWindowChanged = false;
     }
 
-    SCREEN_INFORMATION* psiNewAltBuffer;
-    NTSTATUS Status = _CreateAltBuffer(&psiNewAltBuffer);
+    SCREEN_INFORMATION* psiNewAltBuffer = nullptr;
+    NTSTATUS Status = STATUS_SUCCESS;
+
+    // Try the pool before allocating: if we parked the previous alt buffer
+    // and the window hasn't changed size since, reuse its storage rather
+    // than paying for a whole new TextBuffer. Full-screen apps flip between
+    // the buffers constantly.
+    SCREEN_INFORMATION* const psiPooledBuffer = siMain._psiPooledAltBuffer;
+    if (psiPooledBuffer != nullptr)
+    {
+        siMain._psiPooledAltBuffer = nullptr;
+
+        const COORD coordPooled = psiPooledBuffer->GetBufferSize().Dimensions();
+        const COORD coordWindow = _viewport.Dimensions(); // matches what _CreateAltBuffer would size a fresh one to
+        if (coordPooled.X == coordWindow.X && coordPooled.Y == coordWindow.Y)
+        {
+            psiPooledBuffer->_RecycleAltBuffer(siMain);
+            s_InsertScreenBuffer(psiPooledBuffer);
+            psiNewAltBuffer = psiPooledBuffer;
+        }
+        else
+        {
+            // Wrong size - the window was resized while the buffer was
+            // parked. It was already detached from the buffer list, so just
+            // free it and fall through to making a fresh one.
+            delete psiPooledBuffer;
+        }
+    }
+
+    if (psiNewAltBuffer == nullptr)
+    {
+        Status = _CreateAltBuffer(&psiNewAltBuffer);
+    }
+
     if (NT_SUCCESS(Status))
     {
         // if this is already an alternate buffer, we want to make the new
@@ -2068,7 +2224,12 @@ const SCREEN_INFORMATION& SCREEN_INFORMATION::GetMainBuffer() const
 
         if (psiOldAltBuffer != nullptr)
         {
-            s_RemoveScreenBuffer(psiOldAltBuffer); // this will also delete the old alt buffer
+            // Park the displaced alt buffer rather than deleting it (which,
+            // when ASBSET is issued from the alt buffer itself, would free
+            // the very buffer we were called on). The pool slot is always
+            // empty here - we either consumed or discarded it above.
+            s_DetachScreenBuffer(psiOldAltBuffer);
+            siMain._psiPooledAltBuffer = psiOldAltBuffer;
         }
 
         ::SetActiveScreenBuffer(*psiNewAltBuffer);
@@ -2109,8 +2270,18 @@ void SCREEN_INFORMATION::UseMainScreenBuffer()
 
         SCREEN_INFORMATION* psiAlt = psiMain->_psiAlternateBuffer;
         psiMain->_psiAlternateBuffer = nullptr;
-        s_RemoveScreenBuffer(psiAlt); // this will also delete the alt buffer
-        // deleting the alt buffer will give the GetSet back to its main
+
+        // Park the alt buffer for the next ASBSET instead of deleting it -
+        // its TextBuffer is the expensive part and the next entry will just
+        // clear-and-reuse it. Anything already parked (an alt made at a
+        // different window size) is displaced.
+        SCREEN_INFORMATION* const psiPreviouslyPooled = psiMain->_psiPooledAltBuffer;
+        s_DetachScreenBuffer(psiAlt);
+        psiMain->_psiPooledAltBuffer = psiAlt;
+        if (psiPreviouslyPooled != nullptr)
+        {
+            delete psiPreviouslyPooled;
+        }
 
         // Tell the VT MouseInput handler that we're in the main buffer now
         gci.terminalMouseInput.UseMainScreenBuffer();
@@ -2595,12 +2766,17 @@ OutputCellIterator SCREEN_INFORMATION::WriteRect(const OutputCellIterator it,
     THROW_HR_IF(E_INVALIDARG, viewport.Height() <= 0);
     THROW_HR_IF(E_INVALIDARG, viewport.Width() <= 0);
 
+    // Write the rows without the per-row paint notification, then invalidate
+    // the whole rectangle once. Full-screen blitters redraw with one
+    // message to the renderer instead of one per row.
     OutputCellIterator iter = it;
     for (auto i = viewport.Top(); i < viewport.BottomExclusive(); i++)
     {
-        iter = _textBuffer->WriteLine(iter, { viewport.Left(), i }, false, viewport.RightInclusive());
+        iter = _textBuffer->WriteLine(iter, { viewport.Left(), i }, false, viewport.RightInclusive(), false);
     }
 
+    _textBuffer->GetRenderTarget().TriggerRedraw(viewport);
+
     return iter;
 }
 
@@ -2624,8 +2800,13 @@ void SCREEN_INFORMATION::WriteRect(const OutputCellRect& data,
         point.X = location.X;
         point.Y = location.Y + static_cast<short>(i);
 
-        _textBuffer->WriteLine(iter, point);
+        _textBuffer->WriteLine(iter, point, false, std::nullopt, false);
     }
+
+    // One invalidation for the whole rectangle rather than one per row.
+    _textBuffer->GetRenderTarget().TriggerRedraw(
+        Microsoft::Console::Types::Viewport::FromDimensions(location,
+                                                            { gsl::narrow<SHORT>(data.Width()), gsl::narrow<SHORT>(data.Height()) }));
 }
 
 // Routine Description:
@@ -2651,28 +2832,25 @@ std::pair<COORD, COORD> SCREEN_INFORMATION::GetWordBoundary(const COORD position
     COORD start{ clampedPosition };
     COORD end{ clampedPosition };
 
-    // find the start of the word
-    auto startIt = GetTextLineDataAt(clampedPosition);
-    while (startIt)
+    // The row caches the columns where its delimiter/word runs start
+    // (invalidated when the row is written), so finding the enclosing word is
+    // a binary search instead of a cell-by-cell scan of the delimiter list.
+    const ROW& row = _textBuffer->GetRowByOffset(clampedPosition.Y);
+    const auto& runStarts = row.GetWordRunStarts([](const std::wstring_view glyph) { return IsWordDelim(glyph); });
+    if (!runStarts.empty())
     {
-        --startIt;
-        if (!startIt || IsWordDelim(*startIt))
-        {
-            break;
-        }
-        --start.X;
-    }
+        const auto runIt = std::upper_bound(runStarts.cbegin(), runStarts.cend(), clampedPosition.X);
+        const size_t runIndex = runIt - runStarts.cbegin() - 1;
 
-    // find the end of the word
-    auto endIt = GetTextLineDataAt(clampedPosition);
-    while (endIt)
-    {
-        if (IsWordDelim(*endIt))
+        if (!row.IsWordRunDelim(runIndex))
         {
-            break;
+            // the word spans its whole run; the end lands on the delimiter
+            // (or row edge) just past it, as the old scan did.
+            start.X = runStarts.at(runIndex);
+            end.X = (runIt != runStarts.cend()) ? *runIt : gsl::narrow<SHORT>(row.size());
         }
-        ++endIt;
-        ++end.X;
+        // when the click lands on a delimiter both endpoints stay put,
+        // matching the previous cell-by-cell behavior.
     }
 
     // trim leading zeros if we need to
@@ -2848,6 +3026,18 @@ IRenderTarget& SCREEN_INFORMATION::GetRenderTarget() noexcept
     return _renderTarget;
 }
 
+// Method Description:
+// - Hands any region invalidations pooled up during the current API batch to
+//   the renderer. Called when the console lock is about to be released.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void SCREEN_INFORMATION::FlushPendingRedraw()
+{
+    _renderTarget.FlushPendingRedraw();
+}
+
 // Method Description:
 // - Gets the current font of the screen buffer.
 // Arguments:
@@ -92,6 +92,7 @@ public:
     [[nodiscard]] NTSTATUS ResizeScreenBuffer(const COORD coordNewScreenSize, const bool fDoScrollBarUpdate);
 
     void NotifyAccessibilityEventing(const short sStartX, const short sStartY, const short sEndX, const short sEndY);
+    void FlushAccessibilityEventing();
 
     void UpdateScrollBars();
     void InternalUpdateScrollBars();
@@ -104,7 +105,9 @@ public:
     void SetViewport(const Microsoft::Console::Types::Viewport& newViewport, const bool updateBottom);
     Microsoft::Console::Types::Viewport GetVirtualViewport() const noexcept;
 
-    void ProcessResizeWindow(const RECT* const prcClientNew, const RECT* const prcClientOld);
+    void ProcessResizeWindow(const RECT* const prcClientNew,
+                             const RECT* const prcClientOld,
+                             const bool fViewportOnly = false);
     void SetViewportSize(const COORD* const pcoordSize);
 
     // Forwarders to Window if we're the active buffer.
@@ -118,6 +121,7 @@ public:
     // TODO: MSFT 9355062 these methods should probably be a part of construction/destruction. http://osgvsowi/9355062
     static void s_InsertScreenBuffer(_In_ SCREEN_INFORMATION* const pScreenInfo);
     static void s_RemoveScreenBuffer(_In_ SCREEN_INFORMATION* const pScreenInfo);
+    static void s_DetachScreenBuffer(_In_ SCREEN_INFORMATION* const pScreenInfo);
 
     OutputCellRect ReadRect(const Microsoft::Console::Types::Viewport location) const;
 
@@ -236,6 +240,7 @@ public:
     void MoveToBottom();
 
     Microsoft::Console::Render::IRenderTarget& GetRenderTarget() noexcept;
+    void FlushPendingRedraw();
 
     FontInfo& GetCurrentFont() noexcept;
     const FontInfo& GetCurrentFont() const noexcept;
@@ -275,6 +280,7 @@ private:
     void _FreeOutputStateMachine();
 
     [[nodiscard]] NTSTATUS _CreateAltBuffer(_Out_ SCREEN_INFORMATION** const ppsiNewScreenBuffer);
+    void _RecycleAltBuffer(SCREEN_INFORMATION& siMain);
 
     bool _IsAltBuffer() const;
     bool _IsInPtyMode() const;
@@ -288,12 +294,21 @@ private:
     Microsoft::Console::Types::Viewport _viewport;
 
     SCREEN_INFORMATION* _psiAlternateBuffer; // The VT "Alternate" screen buffer.
+    SCREEN_INFORMATION* _psiPooledAltBuffer; // A retired alt buffer kept for reuse; full-screen apps toggle
+                                             // ASBSET/ASBRST constantly and each fresh alt is a whole TextBuffer.
     SCREEN_INFORMATION* _psiMainBuffer; // A pointer to the main buffer, if this is the alternate buffer.
 
     RECT _rcAltSavedClientNew;
     RECT _rcAltSavedClientOld;
     bool _fAltWindowChanged;
 
+    // Accessibility notifications are not dispatched per write; the changed
+    // region is merged (in reading order) into this pending run and
+    // FlushAccessibilityEventing raises one notification per rendered frame.
+    bool _fAccessibilityNotifyPending;
+    COORD _coordAccessibilityStart;
+    COORD _coordAccessibilityEnd;
+
     std::list<short> _tabStops;
 
     TextAttribute _PopupAttributes;
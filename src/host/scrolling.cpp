@@ -58,44 +58,66 @@ void Scrolling::s_ClearScroll()
 
 void Scrolling::s_ScrollIfNecessary(const SCREEN_INFORMATION& ScreenInfo)
 {
+    // Remembers where the last auto-scroll tick extended the selection to, so
+    // that ticks which can't make progress (viewport pinned against the buffer
+    // edge, mouse holding still) don't re-extend to the same spot and churn
+    // the selection, accessibility and UIA machinery for nothing. An invalid
+    // coordinate means the previous tick didn't auto-scroll.
+    static COORD coordPreviousAutoScrollPos = { -1, -1 };
+
     IConsoleWindow* pWindow = ServiceLocator::LocateConsoleWindow();
     FAIL_FAST_IF_NULL(pWindow);
 
     Selection* const pSelection = &Selection::Instance();
 
-    if (pSelection->IsInSelectingState() && pSelection->IsMouseButtonDown())
+    if (!(pSelection->IsInSelectingState() && pSelection->IsMouseButtonDown()))
     {
-        POINT CursorPos;
-        if (!pWindow->GetCursorPosition(&CursorPos))
-        {
-            return;
-        }
+        coordPreviousAutoScrollPos = { -1, -1 };
+        return;
+    }
 
-        RECT ClientRect;
-        if (!pWindow->GetClientRectangle(&ClientRect))
-        {
-            return;
-        }
+    POINT CursorPos;
+    if (!pWindow->GetCursorPosition(&CursorPos))
+    {
+        return;
+    }
 
-        pWindow->MapPoints((LPPOINT)&ClientRect, 2);
-        if (!(s_IsPointInRectangle(&ClientRect, CursorPos)))
-        {
-            pWindow->ConvertScreenToClient(&CursorPos);
+    RECT ClientRect;
+    if (!pWindow->GetClientRectangle(&ClientRect))
+    {
+        return;
+    }
+
+    pWindow->MapPoints((LPPOINT)&ClientRect, 2);
+    if (s_IsPointInRectangle(&ClientRect, CursorPos))
+    {
+        coordPreviousAutoScrollPos = { -1, -1 };
+        return;
+    }
 
-            COORD MousePosition;
-            MousePosition.X = (SHORT)CursorPos.x;
-            MousePosition.Y = (SHORT)CursorPos.y;
+    pWindow->ConvertScreenToClient(&CursorPos);
 
-            COORD coordFontSize = ScreenInfo.GetScreenFontSize();
+    COORD MousePosition;
+    MousePosition.X = (SHORT)CursorPos.x;
+    MousePosition.Y = (SHORT)CursorPos.y;
 
-            MousePosition.X /= coordFontSize.X;
-            MousePosition.Y /= coordFontSize.Y;
+    COORD coordFontSize = ScreenInfo.GetScreenFontSize();
 
-            MousePosition.X += ScreenInfo.GetViewport().Left();
-            MousePosition.Y += ScreenInfo.GetViewport().Top();
+    MousePosition.X /= coordFontSize.X;
+    MousePosition.Y /= coordFontSize.Y;
 
-            pSelection->ExtendSelection(MousePosition);
-        }
+    MousePosition.X += ScreenInfo.GetViewport().Left();
+    MousePosition.Y += ScreenInfo.GetViewport().Top();
+
+    // Each tick applies one combined viewport move (ExtendSelection scrolls
+    // the position into view before extending); if that move can't go
+    // anywhere the target is the same as last tick and the whole tick is a
+    // no-op.
+    if (MousePosition.X != coordPreviousAutoScrollPos.X ||
+        MousePosition.Y != coordPreviousAutoScrollPos.Y)
+    {
+        coordPreviousAutoScrollPos = MousePosition;
+        pSelection->ExtendSelection(MousePosition);
     }
 }
 
@@ -30,6 +30,12 @@ Search::Search(const SCREEN_INFORMATION& screenInfo,
     _coordAnchor(s_GetInitialAnchor(screenInfo, direction))
 {
     _coordNext = _coordAnchor;
+
+    if (!_needle.empty() && _needle.front().size() == 1)
+    {
+        _canSkipScan = true;
+        _needleFirstChar = _ApplySensitivity(_needle.front().front());
+    }
 }
 
 // Routine Description:
@@ -54,6 +60,12 @@ Search::Search(const SCREEN_INFORMATION& screenInfo,
     _coordAnchor(anchor)
 {
     _coordNext = _coordAnchor;
+
+    if (!_needle.empty() && _needle.front().size() == 1)
+    {
+        _canSkipScan = true;
+        _needleFirstChar = _ApplySensitivity(_needle.front().front());
+    }
 }
 
 // Routine Description
@@ -81,7 +93,7 @@ bool Search::FindNext()
         }
         else
         {
-            _UpdateNextPosition();
+            _SkipToNextCandidate();
         }
 
     } while (_coordNext != _coordAnchor);
@@ -289,6 +301,79 @@ void Search::_UpdateNextPosition()
     }
 }
 
+// Routine Description:
+// - Advances the search position to the next cell that could start a match,
+//   skipping over everything in between.
+// - Scans the contiguous row text for the (case-adjusted) first code unit of
+//   the needle so the expensive per-cell comparison only runs at candidates.
+//   On long scrollbacks this is the difference between touching every cell
+//   through an iterator and a tight sweep over each row's character array.
+// - Needles whose first cell is more than one code unit (surrogate pairs) fall
+//   back to single stepping since their text lives outside the inline row
+//   storage. Never skips past the anchor, so FindNext's wrap detection holds.
+void Search::_SkipToNextCandidate()
+{
+    _UpdateNextPosition();
+
+    if (!_canSkipScan)
+    {
+        return;
+    }
+
+    const auto& textBuffer = _screenInfo.GetTextBuffer();
+
+    while (_coordNext != _coordAnchor)
+    {
+        const auto chars = textBuffer.GetRowByOffset(_coordNext.Y).GetCharRow().Chars();
+        const auto rowEnd = gsl::narrow<SHORT>(chars.size() - 1);
+        const bool anchorInRow = _coordNext.Y == _coordAnchor.Y;
+
+        if (_direction == Direction::Forward)
+        {
+            // Stop the sweep at the anchor if it lies ahead of us in this row.
+            const SHORT last = (anchorInRow && _coordAnchor.X >= _coordNext.X) ? _coordAnchor.X : rowEnd;
+            for (SHORT x = _coordNext.X; x <= last; ++x)
+            {
+                if (_ApplySensitivity(chars.at(x)) == _needleFirstChar)
+                {
+                    _coordNext.X = x;
+                    return;
+                }
+            }
+
+            if (anchorInRow && _coordAnchor.X >= _coordNext.X)
+            {
+                _coordNext = _coordAnchor;
+                return;
+            }
+
+            _coordNext.X = rowEnd;
+            _IncrementCoord(_coordNext);
+        }
+        else
+        {
+            const SHORT first = (anchorInRow && _coordAnchor.X <= _coordNext.X) ? _coordAnchor.X : 0;
+            for (SHORT x = _coordNext.X; x >= first; --x)
+            {
+                if (_ApplySensitivity(chars.at(x)) == _needleFirstChar)
+                {
+                    _coordNext.X = x;
+                    return;
+                }
+            }
+
+            if (anchorInRow && _coordAnchor.X <= _coordNext.X)
+            {
+                _coordNext = _coordAnchor;
+                return;
+            }
+
+            _coordNext.X = 0;
+            _DecrementCoord(_coordNext);
+        }
+    }
+}
+
 // Routine Description:
 // - Creates a "needle" of the correct format for comparison to the screen buffer text data
 //   that we can use for our search
@@ -298,15 +383,15 @@ void Search::_UpdateNextPosition()
 // - Structured text data for comparison to screen buffer text data.
 std::vector<std::vector<wchar_t>> Search::s_CreateNeedleFromString(const std::wstring& wstr)
 {
-    const auto charData = Utf16Parser::Parse(wstr);
+    const auto charData = Utf16Parser::ParseSpans(wstr);
     std::vector<std::vector<wchar_t>> cells;
     for (const auto chars : charData)
     {
-        if (IsGlyphFullWidth(std::wstring_view{ chars.data(), chars.size() }))
+        if (IsGlyphFullWidth(chars))
         {
-            cells.emplace_back(chars);
+            cells.emplace_back(chars.cbegin(), chars.cend());
         }
-        cells.emplace_back(chars);
+        cells.emplace_back(chars.cbegin(), chars.cend());
     }
     return cells;
 }
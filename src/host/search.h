@@ -57,6 +57,7 @@ private:
     bool Search::_FindNeedleInHaystackAt(const COORD pos, COORD& start, COORD& end) const;
     bool _CompareChars(const std::wstring_view one, const std::wstring_view two) const;
     void _UpdateNextPosition();
+    void _SkipToNextCandidate();
 
     void _IncrementCoord(COORD& coord) const;
     void _DecrementCoord(COORD& coord) const;
@@ -65,6 +66,13 @@ private:
     static std::vector<std::vector<wchar_t>> s_CreateNeedleFromString(const std::wstring& wstr);
 
     bool _reachedEnd = false;
+
+    // When the first cell of the needle is a plain single code unit, we can
+    // sweep the contiguous row text for that character and only run the full
+    // per-cell comparison at the candidates, instead of probing every cell.
+    bool _canSkipScan = false;
+    wchar_t _needleFirstChar = UNICODE_NULL;
+
     COORD _coordNext = { 0 };
     COORD _coordSelStart = { 0 };
     COORD _coordSelEnd = { 0 };
@@ -145,20 +145,47 @@ std::vector<SMALL_RECT> Selection::s_GetSelectionRects(const SMALL_RECT& selecti
 
 // Routine Description:
 // - Detemines the line-by-line selection rectangles based on global selection state.
+// - The returned reference points at a cached vector that is only rebuilt
+//   when the selection rectangle, anchor, or line/block mode has changed, so
+//   the renderer's per-frame calls while a selection sits still cost a key
+//   comparison and no allocation.
 // Arguments:
 // - <none> - Uses internal state to know what area is selected already.
 // Return Value:
 // - Returns a vector where each SMALL_RECT is one Row worth of the area to be selected.
 // - Returns empty vector if no rows are selected.
 // - Throws exceptions for out of memory issues
-std::vector<SMALL_RECT> Selection::GetSelectionRects() const
+const std::vector<SMALL_RECT>& Selection::GetSelectionRects() const
 {
     if (!_fSelectionVisible)
     {
-        return std::vector<SMALL_RECT>();
+        _cachedSelectionRects.clear();
+        _cachedRectsValid = false;
+        return _cachedSelectionRects;
     }
 
-    return s_GetSelectionRects(_srSelectionRect, _coordSelectionAnchor, IsLineSelection());
+    const bool lineSelection = IsLineSelection();
+
+    // If nothing moved since the cache was built, it's still good.
+    if (_cachedRectsValid &&
+        _cachedLineSelection == lineSelection &&
+        _cachedSelectionAnchor.X == _coordSelectionAnchor.X &&
+        _cachedSelectionAnchor.Y == _coordSelectionAnchor.Y &&
+        _cachedSelectionRect.Left == _srSelectionRect.Left &&
+        _cachedSelectionRect.Top == _srSelectionRect.Top &&
+        _cachedSelectionRect.Right == _srSelectionRect.Right &&
+        _cachedSelectionRect.Bottom == _srSelectionRect.Bottom)
+    {
+        return _cachedSelectionRects;
+    }
+
+    _cachedSelectionRects = s_GetSelectionRects(_srSelectionRect, _coordSelectionAnchor, lineSelection);
+    _cachedSelectionRect = _srSelectionRect;
+    _cachedSelectionAnchor = _coordSelectionAnchor;
+    _cachedLineSelection = lineSelection;
+    _cachedRectsValid = true;
+
+    return _cachedSelectionRects;
 }
 
 // Routine Description:
@@ -28,7 +28,7 @@ class Selection
 public:
     ~Selection() = default;
 
-    std::vector<SMALL_RECT> GetSelectionRects() const;
+    const std::vector<SMALL_RECT>& GetSelectionRects() const;
 
     void ShowSelection();
     void HideSelection();
@@ -180,6 +180,16 @@ private:
     // Rectangle is the area inscribing the selection. It is extended to screen edges in a particular way for line selection.
     SMALL_RECT _srSelectionRect;
 
+    // Row-by-row selection rects, rebuilt by GetSelectionRects only when the
+    // rectangle, anchor, or line/block mode has changed since the last call.
+    // Output is suspended while a selection is visible, so the text under a
+    // valid cache (and thus the double-width bisection) can't shift.
+    mutable std::vector<SMALL_RECT> _cachedSelectionRects;
+    mutable SMALL_RECT _cachedSelectionRect{ 0, 0, 0, 0 };
+    mutable COORD _cachedSelectionAnchor{ 0, 0 };
+    mutable bool _cachedLineSelection{ false };
+    mutable bool _cachedRectsValid{ false };
+
     // -- Saved Cursor Data --
     // Saved when a selection is started for restoration later. Position is in character coordinates, not pixels.
     COORD _coordSavedCursorPosition;
@@ -160,11 +160,25 @@ COORD Selection::WordByWordSelection(const bool fReverse,
         bufferSize.DecrementInBounds(outCoord);
     }
 
-    // get the character at the new position
-    auto charData = *screenInfo.GetTextDataAt(outCoord);
+    // Each row caches the columns where its delimiter/word runs start
+    // (invalidated when the row is written), so classifying a cell is a
+    // binary search over that cache instead of materializing a buffer
+    // iterator and rescanning the delimiter list for every cell we step over.
+    const auto& textBuffer = screenInfo.GetTextBuffer();
+    const std::function<bool(const std::wstring_view)> fnIsWordDelim = [](const std::wstring_view glyph) { return IsWordDelim(glyph); };
+    const auto IsDelimAt = [&](const COORD coord) {
+        const ROW& Row = textBuffer.GetRowByOffset(coord.Y);
+        const auto& runStarts = Row.GetWordRunStarts(fnIsWordDelim);
+        if (runStarts.empty())
+        {
+            return false;
+        }
+        const auto runIt = std::upper_bound(runStarts.cbegin(), runStarts.cend(), coord.X);
+        return Row.IsWordRunDelim(runIt - runStarts.cbegin() - 1);
+    };
 
     // we want to go until the state change from delim to non-delim
-    bool fCurrIsDelim = IsWordDelim(charData);
+    bool fCurrIsDelim = IsDelimAt(outCoord);
     bool fPrevIsDelim;
 
     // find the edit-line boundaries that we can highlight
@@ -238,9 +252,8 @@ COORD Selection::WordByWordSelection(const bool fReverse,
             break;
         }
 
-        // get the character associated with the new position
-        charData = *screenInfo.GetTextDataAt(outCoord);
-        fCurrIsDelim = IsWordDelim(charData);
+        // classify the new position from the row's cached word runs
+        fCurrIsDelim = IsDelimAt(outCoord);
 
         // This is a bit confusing.
         // If we're going Left to Right (!fReverse)...
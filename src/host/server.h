@@ -115,6 +115,10 @@ public:
     bool IsConsoleLocked() const;
     ULONG GetCSRecursionCount();
 
+    void PublishScreenBufferInfoSnapshot() noexcept;
+    bool TryReadScreenBufferInfoSnapshot(const SCREEN_INFORMATION* const context,
+                                         CONSOLE_SCREEN_BUFFER_INFOEX& data) const noexcept;
+
     Microsoft::Console::VirtualTerminal::VtIo* GetVtIo();
 
     static void HandleTerminalKeyEventCallback(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& events);
@@ -155,7 +159,32 @@ public:
     RenderData renderData;
 
 private:
+    // The console lock. This single recursive lock serializes API dispatch,
+    // input delivery, output/state mutation and accessibility against each
+    // other. The locking model is:
+    // - Anything that reads or writes console state (buffers, viewport,
+    //   modes, handles) takes this lock, via LockConsole/UnlockConsole.
+    // - It is recursive; the global UnlockConsole in handle.cpp dispatches
+    //   pending ctrl events when the recursion count drops to its last
+    //   release, so code MUST use that wrapper (or gci.UnlockConsole for
+    //   nested releases) and MUST NOT swap this for a non-recursive lock.
+    // - Long-running readers (the renderer, UIA text extraction) should hold
+    //   the lock only long enough to deep-copy what they need - see
+    //   TextBuffer::MakeSnapshot - and do their real work after releasing.
+    // - Waits never happen under the lock; blocked reads park on the
+    //   ConsoleWaitQueue and are re-notified with the lock held.
     CRITICAL_SECTION _csConsoleLock; // serialize input and output using this
+
+    // Seqlock-published copy of the data GetConsoleScreenBufferInfoEx returns,
+    // refreshed on the final release of the console lock (see UnlockConsole).
+    // Shells poll that API dozens of times per prompt render; serving the
+    // polls from this snapshot keeps them off the console lock entirely.
+    std::atomic<ULONG> _sbiexSnapshotSequence{ 0 }; // 0 = never published; odd = mid-update
+    CONSOLE_SCREEN_BUFFER_INFOEX _sbiexSnapshot = { 0 };
+    const SCREEN_INFORMATION* _sbiexSnapshotSource = nullptr; // buffer the snapshot was read from
+    const SCREEN_INFORMATION* _sbiexSnapshotMain = nullptr; // its main buffer, for alt-buffer handles
+    COORD _sbiexSnapshotFontSize = { 0, 0 }; // publish-time font size; an input of dwMaximumWindowSize
+
     std::wstring _Title;
     std::wstring _TitlePrefix; // Eg Select, Mark - things that we manually prepend to the title.
     std::wstring _OriginalTitle;
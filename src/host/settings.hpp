@@ -8,6 +8,18 @@ Module Name:
 Abstract:
 - This module is used for all configurable settings in the console
 
+Ownership model:
+- The authoritative Settings instance is the base of CONSOLE_INFORMATION;
+  every consumer in the host reads it in place through the global console
+  information, so there is exactly one live copy and its address is stable
+  for the life of the process. Changes (the properties sheet, VT sequences,
+  API calls) are applied through the per-field setters under the console
+  lock rather than by replacing or copying the whole structure.
+- The only whole-structure transfers are deliberate boundary marshals: the
+  connect path accumulates a scratch Settings from STARTUPINFO and shortcut
+  data before merging it field-wise, and CONSOLE_STATE_INFO round-trips a
+  flat snapshot across the properties dialog DLL ABI.
+
 Author(s):
 - Michael Niksa (MiNiksa) 23-Jul-2014
 - Paul Campbell (PaulCam) 23-Jul-2014
@@ -8,7 +8,9 @@
 #include "dbcs.h"
 #include "handle.h"
 #include "registry.hpp"
+#include "..\propslib\SettingsCache.hpp"
 #include "renderFontDefaults.hpp"
+#include "tracing.hpp"
 
 #include "ApiRoutines.h"
 
@@ -35,6 +37,8 @@ const UINT CONSOLE_LPC_PORT_FAILURE_ID = 21791;
 {
     Globals& Globals = ServiceLocator::LocateGlobals();
 
+    Tracing::s_TraceStartupPhase(L"ServerInitialization");
+
     try
     {
         Globals.pDeviceComm = new DeviceComm(Server);
@@ -44,6 +48,8 @@ const UINT CONSOLE_LPC_PORT_FAILURE_ID = 21791;
         Globals.uiOEMCP = GetOEMCP();
         Globals.uiWindowsCP = GetACP();
 
+        // Note that the default font list defers reading the registry until
+        // the first lookup, so this does no I/O here.
         Globals.pFontDefaultList = new RenderFontDefaults();
 
         FontInfo::s_SetFontDefaultList(Globals.pFontDefaultList);
@@ -118,26 +124,59 @@ static bool s_IsOnDesktop()
     // Use the launch args because the VtIo hasn't been initialized yet.
     if (!launchArgs.InConptyMode())
     {
-        // 3. Read the default registry values.
+        Tracing::s_TraceStartupPhase(L"SettingsLoad");
+
         Registry reg(&settings);
-        reg.LoadGlobalsFromRegistry();
-        reg.LoadDefaultFromRegistry();
+
+        // The full registry contribution for this title may already sit in the
+        // shared settings cache from an earlier console start. Link-spawned
+        // consoles are not cached: resolving the shortcut rewrites the title
+        // buffer in addition to the settings, which the cache doesn't capture.
+        bool fSettingsFromCache = false;
+        PWSTR translatedTitle = nullptr;
+        if (WI_IsFlagClear(pStartupSettings->GetStartupFlags(), STARTF_TITLEISLINKNAME))
+        {
+            translatedTitle = TranslateConsoleTitle(Title, TRUE, TRUE);
+        }
+
+        if (translatedTitle != nullptr)
+        {
+            fSettingsFromCache = SettingsCache::s_TryLoadCachedSettings(translatedTitle, &settings);
+        }
+
+        if (!fSettingsFromCache)
+        {
+            // 3. Read the default registry values.
+            reg.LoadGlobalsFromRegistry();
+            reg.LoadDefaultFromRegistry();
+        }
 
         // 2. Read specific settings
 
         // Link is expecting the flags from the process to be in already, so apply that first
         settings.SetStartupFlags(pStartupSettings->GetStartupFlags());
 
-        // We need to see if we were spawned from a link. If we were, we need to
-        // call back into the shell to try to get all the console information from the link.
-        ServiceLocator::LocateSystemConfigurationProvider()->GetSettingsFromLink(&settings, Title, &TitleLength, CurDir, AppName);
-
-        // If we weren't started from a link, this will already be set.
-        // If LoadLinkInfo couldn't find anything, it will remove the flag so we can dig in the registry.
-        if (!(settings.IsStartupTitleIsLinkNameSet()))
+        if (!fSettingsFromCache)
         {
-            reg.LoadFromRegistry(Title);
+            // We need to see if we were spawned from a link. If we were, we need to
+            // call back into the shell to try to get all the console information from the link.
+            ServiceLocator::LocateSystemConfigurationProvider()->GetSettingsFromLink(&settings, Title, &TitleLength, CurDir, AppName);
+
+            // If we weren't started from a link, this will already be set.
+            // If LoadLinkInfo couldn't find anything, it will remove the flag so we can dig in the registry.
+            if (!(settings.IsStartupTitleIsLinkNameSet()))
+            {
+                reg.LoadFromRegistry(Title);
+
+                // Publish the result for the next console start with this title.
+                if (translatedTitle != nullptr)
+                {
+                    SettingsCache::s_CacheSettings(translatedTitle, &settings);
+                }
+            }
         }
+
+        delete[] translatedTitle;
     }
 
     // 1. The settings we were passed contains STARTUPINFO structure settings to be applied last.
@@ -179,6 +218,8 @@ static bool s_IsOnDesktop()
         settings.SetLaunchFaceName(settings.GetFaceName(), LF_FACESIZE);
     }
 
+    Tracing::s_TraceStartupPhase(L"ConsoleAllocation");
+
     // Allocate console will read the global ServiceLocator::LocateGlobals().getConsoleInformation
     // for the settings we just set.
     NTSTATUS Status = CONSOLE_INFORMATION::AllocateConsole({ Title, TitleLength / sizeof(wchar_t) });
@@ -187,6 +228,8 @@ static bool s_IsOnDesktop()
         return Status;
     }
 
+    Tracing::s_TraceStartupPhase(L"ConsoleAllocated");
+
     return STATUS_SUCCESS;
 }
 
@@ -258,9 +301,21 @@ void ConsoleCheckDebug()
     ServerInformation.InputAvailableEvent = ServiceLocator::LocateGlobals().hInputEvent.get();
     RETURN_IF_FAILED(g.pDeviceComm->SetServerInformation(&ServerInformation));
 
-    HANDLE const hThread = CreateThread(nullptr, 0, ConsoleIoThread, 0, 0, nullptr);
-    RETURN_HR_IF(E_HANDLE, hThread == nullptr);
-    LOG_IF_WIN32_BOOL_FALSE(CloseHandle(hThread)); // The thread will run on its own and close itself. Free the associated handle.
+    // Run a small pool of service threads, each pending its own ReadIo
+    // against the driver (the IOCTL interface supports multiple outstanding
+    // reads). One client's long-running request no longer stalls every
+    // other attached client, and per-object serialization is still provided
+    // by the console lock that every API routine takes. All per-message
+    // state lives on each thread's own stack.
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    DWORD const cIoThreads = std::min<DWORD>(4, std::max<DWORD>(1, sysInfo.dwNumberOfProcessors));
+    for (DWORD i = 0; i < cIoThreads; i++)
+    {
+        HANDLE const hThread = CreateThread(nullptr, 0, ConsoleIoThread, 0, 0, nullptr);
+        RETURN_HR_IF(E_HANDLE, hThread == nullptr);
+        LOG_IF_WIN32_BOOL_FALSE(CloseHandle(hThread)); // The thread will run on its own and close itself. Free the associated handle.
+    }
 
     // See MSFT:19918626
     // Make sure to always set up the signal thread if we need to.
@@ -272,6 +327,8 @@ void ConsoleCheckDebug()
     RETURN_IF_FAILED(gci.GetVtIo()->Initialize(args));
     RETURN_IF_FAILED(gci.GetVtIo()->CreateAndStartSignalThread());
 
+    Tracing::s_TraceStartupPhase(L"IoThreadLaunched");
+
     return S_OK;
 }
 
@@ -493,7 +550,7 @@ PWSTR TranslateConsoleTitle(_In_ PCWSTR pwszConsoleTitle, const BOOL fUnexpand,
 [[nodiscard]] NTSTATUS ConsoleAllocateConsole(PCONSOLE_API_CONNECTINFO p)
 {
     // AllocConsole is outside our codebase, but we should be able to mostly track the call here.
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::AllocConsole);
+    Telemetry::LogApiCall(Telemetry::ApiCall::AllocConsole);
 
     Globals& g = ServiceLocator::LocateGlobals();
 
@@ -625,8 +682,11 @@ PWSTR TranslateConsoleTitle(_In_ PCWSTR pwszConsoleTitle, const BOOL fUnexpand,
 }
 
 // Routine Description:
-// - This routine is the main one in the console server IO thread.
+// - This routine is the main one for the console server IO service threads.
 // - It reads IO requests submitted by clients through the driver, services and completes them in a loop.
+// - Several instances run concurrently (see ConsoleCreateIoThreadLegacy); all
+//   message state is local to each thread and API dispatch serializes on the
+//   console lock.
 // Arguments:
 // - <none>
 // Return Value:
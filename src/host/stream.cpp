@@ -180,8 +180,145 @@ using Microsoft::Console::Interactivity::ServiceLocator;
     }
 }
 
+
+// Routine Description:
+// - Bulk, non-blocking variant of GetChar for the raw read path. Drains the
+//   ready events in batches - one InputBuffer::Read per batch instead of one
+//   per character, so the wait state is updated once per batch too - and
+//   extracts the same characters a raw GetChar loop would have produced (no
+//   editing key, popup key, or modifier state callers).
+// - Each consumed event yields at most one character, so batches are capped
+//   at the space remaining; nothing can be read out and then fail to fit.
+// Arguments:
+// - pInputBuffer - buffer to drain
+// - pwchOut - destination for the extracted characters
+// - cchOut - how many characters fit at pwchOut
+// - pcchRead - receives the number of characters extracted
+// Return Value:
+// - STATUS_SUCCESS even if the buffer ran dry first; check *pcchRead.
+[[nodiscard]] NTSTATUS GetCharsFromReadyEvents(_Inout_ InputBuffer* const pInputBuffer,
+                                               _Out_writes_to_(cchOut, *pcchRead) wchar_t* const pwchOut,
+                                               const size_t cchOut,
+                                               _Out_ size_t* const pcchRead) noexcept
+{
+    *pcchRead = 0;
+
+    try
+    {
+        while (*pcchRead < cchOut)
+        {
+            const size_t cReady = pInputBuffer->GetNumberOfReadyEvents();
+            if (cReady == 0)
+            {
+                break;
+            }
+
+            std::deque<std::unique_ptr<IInputEvent>> events;
+            const NTSTATUS Status = pInputBuffer->Read(events,
+                                                       std::min(cReady, cchOut - *pcchRead),
+                                                       false, // peek
+                                                       false, // wait
+                                                       true, // unicode
+                                                       true); // stream
+            if (!NT_SUCCESS(Status))
+            {
+                return Status;
+            }
+            else if (events.empty())
+            {
+                break;
+            }
+
+            for (const auto& event : events)
+            {
+                if (event->EventType() != InputEventType::KeyEvent)
+                {
+                    continue;
+                }
+
+                const KeyEvent* const pKeyEvent = static_cast<const KeyEvent* const>(event.get());
+                wchar_t wch = pKeyEvent->GetCharData();
+                bool fProduced = false;
+
+                if (wch != 0)
+                {
+                    // chars that are generated using alt + numpad
+                    if (!pKeyEvent->IsKeyDown() && pKeyEvent->GetVirtualKeyCode() == VK_MENU)
+                    {
+                        if (pKeyEvent->IsAltNumpadSet())
+                        {
+                            if (HIBYTE(pKeyEvent->GetCharData()))
+                            {
+                                char chT[2] = {
+                                    static_cast<char>(HIBYTE(pKeyEvent->GetCharData())),
+                                    static_cast<char>(LOBYTE(pKeyEvent->GetCharData())),
+                                };
+                                wch = CharToWchar(chT, 2);
+                            }
+                            else
+                            {
+                                // Because USER doesn't know our codepage,
+                                // it gives us the raw OEM char and we
+                                // convert it to a Unicode character.
+                                char chT = LOBYTE(pKeyEvent->GetCharData());
+                                wch = CharToWchar(&chT, 1);
+                            }
+                        }
+                        fProduced = true;
+                    }
+                    // Ignore Escape and Newline chars
+                    else if (pKeyEvent->IsKeyDown() &&
+                             (WI_IsFlagSet(pInputBuffer->InputMode, ENABLE_VIRTUAL_TERMINAL_INPUT) ||
+                              (pKeyEvent->GetVirtualKeyCode() != VK_ESCAPE &&
+                               pKeyEvent->GetCharData() != UNICODE_LINEFEED)))
+                    {
+                        fProduced = true;
+                    }
+                }
+                else if (pKeyEvent->IsKeyDown())
+                {
+                    const short zeroVkeyData = ServiceLocator::LocateInputServices()->VkKeyScanW(0);
+                    const byte zeroVKey = LOBYTE(zeroVkeyData);
+                    const byte zeroControlKeyState = HIBYTE(zeroVkeyData);
+
+                    try
+                    {
+                        // Convert real Windows NT modifier bit into bizarre Console bits
+                        std::unordered_set<ModifierKeyState> consoleModKeyState = FromVkKeyScan(zeroControlKeyState);
+
+                        if (zeroVKey == pKeyEvent->GetVirtualKeyCode() &&
+                            pKeyEvent->DoActiveModifierKeysMatch(consoleModKeyState))
+                        {
+                            // This really is the character 0x0000
+                            fProduced = true;
+                        }
+                    }
+                    catch (...)
+                    {
+                        LOG_HR(wil::ResultFromCaughtException());
+                    }
+                }
+
+                if (fProduced)
+                {
+                    pwchOut[*pcchRead] = wch;
+                    (*pcchRead)++;
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        return NTSTATUS_FROM_HRESULT(wil::ResultFromCaughtException());
+    }
+
+    return STATUS_SUCCESS;
+}
+
 // Routine Description:
 // - This routine returns the total number of screen spaces the characters up to the specified character take up.
+// - Printable stretches are measured a same-width run at a time so long command
+//   lines don't pay a width-cache probe per character.
 size_t RetrieveTotalNumberOfSpaces(const SHORT sOriginalCursorPositionX,
                                    _In_reads_(ulCurrentPosition) const WCHAR* const pwchBuffer,
                                    _In_ size_t ulCurrentPosition)
@@ -189,29 +326,46 @@ size_t RetrieveTotalNumberOfSpaces(const SHORT sOriginalCursorPositionX,
     SHORT XPosition = sOriginalCursorPositionX;
     size_t NumSpaces = 0;
 
-    for (size_t i = 0; i < ulCurrentPosition; i++)
+    size_t i = 0;
+    while (i < ulCurrentPosition)
     {
         WCHAR const Char = pwchBuffer[i];
 
-        size_t NumSpacesForChar;
         if (Char == UNICODE_TAB)
         {
-            NumSpacesForChar = NUMBER_OF_SPACES_IN_TAB(XPosition);
+            const size_t NumSpacesForChar = NUMBER_OF_SPACES_IN_TAB(XPosition);
+            XPosition = (SHORT)(XPosition + NumSpacesForChar);
+            NumSpaces += NumSpacesForChar;
+            i++;
         }
         else if (IS_CONTROL_CHAR(Char))
         {
-            NumSpacesForChar = 2;
-        }
-        else if (IsGlyphFullWidth(Char))
-        {
-            NumSpacesForChar = 2;
+            XPosition = (SHORT)(XPosition + 2);
+            NumSpaces += 2;
+            i++;
         }
         else
         {
-            NumSpacesForChar = 1;
+            // Find how far this printable stretch extends, then consume it in
+            // runs of glyphs that share the same width.
+            size_t end = i + 1;
+            while (end < ulCurrentPosition &&
+                   pwchBuffer[end] != UNICODE_TAB &&
+                   !IS_CONTROL_CHAR(pwchBuffer[end]))
+            {
+                end++;
+            }
+
+            while (i < end)
+            {
+                bool fFullWidth = false;
+                const size_t cRun = GetSameWidthGlyphRunLength({ &pwchBuffer[i], end - i }, fFullWidth);
+                const size_t NumSpacesForRun = fFullWidth ? cRun * 2 : cRun;
+                XPosition = (SHORT)(XPosition + NumSpacesForRun);
+                NumSpaces += NumSpacesForRun;
+                i += cRun;
+            }
         }
-        XPosition = (SHORT)(XPosition + NumSpacesForChar);
-        NumSpaces += NumSpacesForChar;
     }
 
     return NumSpaces;
@@ -223,35 +377,14 @@ size_t RetrieveNumberOfSpaces(_In_ SHORT sOriginalCursorPositionX,
                               _In_reads_(ulCurrentPosition + 1) const WCHAR* const pwchBuffer,
                               _In_ size_t ulCurrentPosition)
 {
-    WCHAR Char = pwchBuffer[ulCurrentPosition];
+    const WCHAR Char = pwchBuffer[ulCurrentPosition];
     if (Char == UNICODE_TAB)
     {
-        size_t NumSpaces = 0;
-        SHORT XPosition = sOriginalCursorPositionX;
-
-        for (size_t i = 0; i <= ulCurrentPosition; i++)
-        {
-            Char = pwchBuffer[i];
-            if (Char == UNICODE_TAB)
-            {
-                NumSpaces = NUMBER_OF_SPACES_IN_TAB(XPosition);
-            }
-            else if (IS_CONTROL_CHAR(Char))
-            {
-                NumSpaces = 2;
-            }
-            else if (IsGlyphFullWidth(Char))
-            {
-                NumSpaces = 2;
-            }
-            else
-            {
-                NumSpaces = 1;
-            }
-            XPosition = (SHORT)(XPosition + NumSpaces);
-        }
-
-        return NumSpaces;
+        // A tab is as wide as the distance to the next tab stop, so the column
+        // it starts on must be recovered by measuring everything before it.
+        const size_t NumSpaces = RetrieveTotalNumberOfSpaces(sOriginalCursorPositionX, pwchBuffer, ulCurrentPosition);
+        const SHORT XPosition = (SHORT)(sOriginalCursorPositionX + NumSpaces);
+        return NUMBER_OF_SPACES_IN_TAB(XPosition);
     }
     else if (IS_CONTROL_CHAR(Char))
     {
@@ -29,6 +29,11 @@ Revision History:
                                _Out_opt_ bool* const pPopupKeys,
                                _Out_opt_ DWORD* const pdwKeyState) noexcept;
 
+[[nodiscard]] NTSTATUS GetCharsFromReadyEvents(_Inout_ InputBuffer* const pInputBuffer,
+                                               _Out_writes_to_(cchOut, *pcchRead) wchar_t* const pwchOut,
+                                               const size_t cchOut,
+                                               _Out_ size_t* const pcchRead) noexcept;
+
 // Routine Description:
 // - This routine returns the total number of screen spaces the characters up to the specified character take up.
 size_t RetrieveTotalNumberOfSpaces(const SHORT sOriginalCursorPositionX,
@@ -37,8 +37,6 @@ Telemetry::Telemetry() :
     _rguiProcessFileNamesCodesCount(),
     _rguiProcessFileNamesFailedCodesCount(),
     _rguiProcessFileNamesFailedOutsideCodesCount(),
-    _rguiTimesApiUsed(),
-    _rguiTimesApiUsedAnsi(),
     _uiNumberProcessFileNames(0),
     _fBashUsed(false),
     _fKeyboardTextEditingUsed(false),
@@ -62,6 +60,9 @@ Telemetry::Telemetry() :
 }
 #pragma warning(pop)
 
+unsigned int Telemetry::s_rguiTimesApiUsed[NUMBER_OF_APIS] = {};
+unsigned int Telemetry::s_rguiTimesApiUsedAnsi[NUMBER_OF_APIS] = {};
+
 Telemetry::~Telemetry()
 {
     TraceLoggingWriteStop(_activity, "ActivityStop");
@@ -156,30 +157,6 @@ void Telemetry::SetKeyboardTextEditingUsed()
     SetUserInteractive();
 }
 
-// Log an API call was used.
-void Telemetry::LogApiCall(const ApiCall api, const BOOLEAN fUnicode)
-{
-    // Initially we thought about passing over a string (ex. "XYZ") and use a dictionary data type to hold the counts.
-    // However we would have to search through the dictionary every time we called this method, so we decided
-    // to use an array which has very quick access times.
-    // The downside is we have to create an enum type, and then convert them to strings when we finally
-    // send out the telemetry, but the upside is we should have very good performance.
-    if (fUnicode)
-    {
-        _rguiTimesApiUsed[api]++;
-    }
-    else
-    {
-        _rguiTimesApiUsedAnsi[api]++;
-    }
-}
-
-// Log an API call was used.
-void Telemetry::LogApiCall(const ApiCall api)
-{
-    _rguiTimesApiUsed[api]++;
-}
-
 // Log usage of the Find Dialog.
 void Telemetry::LogFindDialogNextClicked(const unsigned int uiStringLength, const bool fDirectionDown, const bool fMatchCase)
 {
@@ -462,70 +439,70 @@ void Telemetry::WriteFinalTraceLog()
             // clang-format on
             TraceLoggingWriteTagged(_activity,
                                     "ApiUsed",
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[AddConsoleAlias], "AddConsoleAlias"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[AllocConsole], "AllocConsole"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[AttachConsole], "AttachConsole"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[CreateConsoleScreenBuffer], "CreateConsoleScreenBuffer"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GenerateConsoleCtrlEvent], "GenerateConsoleCtrlEvent"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[FillConsoleOutputAttribute], "FillConsoleOutputAttribute"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[FillConsoleOutputCharacter], "FillConsoleOutputCharacter"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[FlushConsoleInputBuffer], "FlushConsoleInputBuffer"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[FreeConsole], "FreeConsole"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleAlias], "GetConsoleAlias"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleAliases], "GetConsoleAliases"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleAliasExesLength], "GetConsoleAliasExesLength"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleAliasesLength], "GetConsoleAliasesLength"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleAliasExes], "GetConsoleAliasExes"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleCP], "GetConsoleCP"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleCursorInfo], "GetConsoleCursorInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleDisplayMode], "GetConsoleDisplayMode"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleFontSize], "GetConsoleFontSize"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleHistoryInfo], "GetConsoleHistoryInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleLangId], "GetConsoleLangId"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleMode], "GetConsoleMode"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleOriginalTitle], "GetConsoleOriginalTitle"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleOutputCP], "GetConsoleOutputCP"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleProcessList], "GetConsoleProcessList"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleScreenBufferInfoEx], "GetConsoleScreenBufferInfoEx"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleSelectionInfo], "GetConsoleSelectionInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleTitle], "GetConsoleTitle"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetConsoleWindow], "GetConsoleWindow"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetCurrentConsoleFontEx], "GetCurrentConsoleFontEx"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetLargestConsoleWindowSize], "GetLargestConsoleWindowSize"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetNumberOfConsoleInputEvents], "GetNumberOfConsoleInputEvents"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[GetNumberOfConsoleMouseButtons], "GetNumberOfConsoleMouseButtons"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[PeekConsoleInput], "PeekConsoleInput"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ReadConsole], "ReadConsole"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ReadConsoleInput], "ReadConsoleInput"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ReadConsoleOutput], "ReadConsoleOutput"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ReadConsoleOutputAttribute], "ReadConsoleOutputAttribute"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ReadConsoleOutputCharacter], "ReadConsoleOutputCharacter"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[ScrollConsoleScreenBuffer], "ScrollConsoleScreenBuffer"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleActiveScreenBuffer], "SetConsoleActiveScreenBuffer"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleCP], "SetConsoleCP"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleCursorInfo], "SetConsoleCursorInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleCursorPosition], "SetConsoleCursorPosition"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleDisplayMode], "SetConsoleDisplayMode"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleHistoryInfo], "SetConsoleHistoryInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleMode], "SetConsoleMode"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleOutputCP], "SetConsoleOutputCP"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleScreenBufferInfoEx], "SetConsoleScreenBufferInfoEx"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleScreenBufferSize], "SetConsoleScreenBufferSize"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleTextAttribute], "SetConsoleTextAttribute"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleTitle], "SetConsoleTitle"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetConsoleWindowInfo], "SetConsoleWindowInfo"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[SetCurrentConsoleFontEx], "SetCurrentConsoleFontEx"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[WriteConsole], "WriteConsole"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[WriteConsoleInput], "WriteConsoleInput"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[WriteConsoleOutput], "WriteConsoleOutput"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[WriteConsoleOutputAttribute], "WriteConsoleOutputAttribute"),
-                                    TraceLoggingUInt32(_rguiTimesApiUsed[WriteConsoleOutputCharacter], "WriteConsoleOutputCharacter"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[AddConsoleAlias], "AddConsoleAlias"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[AllocConsole], "AllocConsole"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[AttachConsole], "AttachConsole"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[CreateConsoleScreenBuffer], "CreateConsoleScreenBuffer"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GenerateConsoleCtrlEvent], "GenerateConsoleCtrlEvent"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[FillConsoleOutputAttribute], "FillConsoleOutputAttribute"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[FillConsoleOutputCharacter], "FillConsoleOutputCharacter"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[FlushConsoleInputBuffer], "FlushConsoleInputBuffer"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[FreeConsole], "FreeConsole"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleAlias], "GetConsoleAlias"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleAliases], "GetConsoleAliases"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleAliasExesLength], "GetConsoleAliasExesLength"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleAliasesLength], "GetConsoleAliasesLength"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleAliasExes], "GetConsoleAliasExes"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleCP], "GetConsoleCP"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleCursorInfo], "GetConsoleCursorInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleDisplayMode], "GetConsoleDisplayMode"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleFontSize], "GetConsoleFontSize"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleHistoryInfo], "GetConsoleHistoryInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleLangId], "GetConsoleLangId"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleMode], "GetConsoleMode"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleOriginalTitle], "GetConsoleOriginalTitle"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleOutputCP], "GetConsoleOutputCP"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleProcessList], "GetConsoleProcessList"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleScreenBufferInfoEx], "GetConsoleScreenBufferInfoEx"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleSelectionInfo], "GetConsoleSelectionInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleTitle], "GetConsoleTitle"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetConsoleWindow], "GetConsoleWindow"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetCurrentConsoleFontEx], "GetCurrentConsoleFontEx"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetLargestConsoleWindowSize], "GetLargestConsoleWindowSize"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetNumberOfConsoleInputEvents], "GetNumberOfConsoleInputEvents"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[GetNumberOfConsoleMouseButtons], "GetNumberOfConsoleMouseButtons"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[PeekConsoleInput], "PeekConsoleInput"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ReadConsole], "ReadConsole"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ReadConsoleInput], "ReadConsoleInput"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ReadConsoleOutput], "ReadConsoleOutput"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ReadConsoleOutputAttribute], "ReadConsoleOutputAttribute"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ReadConsoleOutputCharacter], "ReadConsoleOutputCharacter"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[ScrollConsoleScreenBuffer], "ScrollConsoleScreenBuffer"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleActiveScreenBuffer], "SetConsoleActiveScreenBuffer"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleCP], "SetConsoleCP"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleCursorInfo], "SetConsoleCursorInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleCursorPosition], "SetConsoleCursorPosition"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleDisplayMode], "SetConsoleDisplayMode"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleHistoryInfo], "SetConsoleHistoryInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleMode], "SetConsoleMode"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleOutputCP], "SetConsoleOutputCP"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleScreenBufferInfoEx], "SetConsoleScreenBufferInfoEx"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleScreenBufferSize], "SetConsoleScreenBufferSize"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleTextAttribute], "SetConsoleTextAttribute"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleTitle], "SetConsoleTitle"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetConsoleWindowInfo], "SetConsoleWindowInfo"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[SetCurrentConsoleFontEx], "SetCurrentConsoleFontEx"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[WriteConsole], "WriteConsole"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[WriteConsoleInput], "WriteConsoleInput"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[WriteConsoleOutput], "WriteConsoleOutput"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[WriteConsoleOutputAttribute], "WriteConsoleOutputAttribute"),
+                                    TraceLoggingUInt32(s_rguiTimesApiUsed[WriteConsoleOutputCharacter], "WriteConsoleOutputCharacter"),
                                     TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
                                     TelemetryPrivacyDataTag(PDT_ProductAndServiceUsage));
 
-            for (int n = 0; n < ARRAYSIZE(_rguiTimesApiUsedAnsi); n++)
+            for (int n = 0; n < ARRAYSIZE(s_rguiTimesApiUsedAnsi); n++)
             {
-                if (_rguiTimesApiUsedAnsi[n])
+                if (s_rguiTimesApiUsedAnsi[n])
                 {
                     // Ansi specific API's are used less, so check if we have anything to send back.
                     // Also breaking it up into a separate TraceLoggingWriteTagged fixes a compilation warning that
@@ -535,25 +512,25 @@ void Telemetry::WriteFinalTraceLog()
                     // clang-format on
                     TraceLoggingWriteTagged(_activity,
                                             "ApiAnsiUsed",
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[AddConsoleAlias], "AddConsoleAlias"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[FillConsoleOutputCharacter], "FillConsoleOutputCharacter"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleAlias], "GetConsoleAlias"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleAliases], "GetConsoleAliases"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleAliasesLength], "GetConsoleAliasesLength"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleAliasExes], "GetConsoleAliasExes"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleAliasExesLength], "GetConsoleAliasExesLength"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleOriginalTitle], "GetConsoleOriginalTitle"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[GetConsoleTitle], "GetConsoleTitle"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[PeekConsoleInput], "PeekConsoleInput"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[ReadConsole], "ReadConsole"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[ReadConsoleInput], "ReadConsoleInput"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[ReadConsoleOutput], "ReadConsoleOutput"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[ReadConsoleOutputCharacter], "ReadConsoleOutputCharacter"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[SetConsoleTitle], "SetConsoleTitle"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[WriteConsole], "WriteConsole"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[WriteConsoleInput], "WriteConsoleInput"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[WriteConsoleOutput], "WriteConsoleOutput"),
-                                            TraceLoggingUInt32(_rguiTimesApiUsedAnsi[WriteConsoleOutputCharacter], "WriteConsoleOutputCharacter"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[AddConsoleAlias], "AddConsoleAlias"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[FillConsoleOutputCharacter], "FillConsoleOutputCharacter"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleAlias], "GetConsoleAlias"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleAliases], "GetConsoleAliases"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleAliasesLength], "GetConsoleAliasesLength"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleAliasExes], "GetConsoleAliasExes"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleAliasExesLength], "GetConsoleAliasExesLength"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleOriginalTitle], "GetConsoleOriginalTitle"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[GetConsoleTitle], "GetConsoleTitle"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[PeekConsoleInput], "PeekConsoleInput"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[ReadConsole], "ReadConsole"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[ReadConsoleInput], "ReadConsoleInput"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[ReadConsoleOutput], "ReadConsoleOutput"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[ReadConsoleOutputCharacter], "ReadConsoleOutputCharacter"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[SetConsoleTitle], "SetConsoleTitle"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[WriteConsole], "WriteConsole"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[WriteConsoleInput], "WriteConsoleInput"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[WriteConsoleOutput], "WriteConsoleOutput"),
+                                            TraceLoggingUInt32(s_rguiTimesApiUsedAnsi[WriteConsoleOutputCharacter], "WriteConsoleOutputCharacter"),
                                             TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
                                             TelemetryPrivacyDataTag(PDT_ProductAndServiceUsage));
                     break;
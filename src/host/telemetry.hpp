@@ -120,8 +120,35 @@ public:
         // Only use this last enum as a count of the number of api enums.
         NUMBER_OF_APIS
     };
-    void LogApiCall(const ApiCall api);
-    void LogApiCall(const ApiCall api, const BOOLEAN fUnicode);
+
+    // The dispatchers call these on every request the driver hands us, so the
+    // hot-path cost must stay a couple of plain stores. The counters are
+    // static and the increments inline: no singleton access (the
+    // thread-safety guard check Instance() performs on every call is
+    // measurable at API dispatch rates), no event write. The totals are
+    // folded into the final session log with the rest of the accumulated
+    // state.
+    // Initially we thought about passing over a string (ex. "XYZ") and use a dictionary data type to hold the counts.
+    // However we would have to search through the dictionary every time we called this method, so we decided
+    // to use an array which has very quick access times.
+    // The downside is we have to create an enum type, and then convert them to strings when we finally
+    // send out the telemetry, but the upside is we should have very good performance.
+    static void LogApiCall(const ApiCall api) noexcept
+    {
+        s_rguiTimesApiUsed[api]++;
+    }
+
+    static void LogApiCall(const ApiCall api, const BOOLEAN fUnicode) noexcept
+    {
+        if (fUnicode)
+        {
+            s_rguiTimesApiUsed[api]++;
+        }
+        else
+        {
+            s_rguiTimesApiUsedAnsi[api]++;
+        }
+    }
 
 private:
     // Used to prevent multiple instances
@@ -163,9 +190,9 @@ private:
     unsigned int _rguiProcessFileNamesFailedCodesCount[c_iMaxProcessesConnected];
     // Total of how many failed codes each process used outside the valid range.
     unsigned int _rguiProcessFileNamesFailedOutsideCodesCount[c_iMaxProcessesConnected];
-    unsigned int _rguiTimesApiUsed[NUMBER_OF_APIS];
+    static unsigned int s_rguiTimesApiUsed[NUMBER_OF_APIS];
     // Most of this array will be empty, and is only used if an API has an ansi specific variant.
-    unsigned int _rguiTimesApiUsedAnsi[NUMBER_OF_APIS];
+    static unsigned int s_rguiTimesApiUsedAnsi[NUMBER_OF_APIS];
     // Total number of file names we've added.
     UINT16 _uiNumberProcessFileNames;
 
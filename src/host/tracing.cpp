@@ -3,6 +3,7 @@
 
 #include "precomp.h"
 #include "tracing.hpp"
+#include "../inc/AllocAccounting.hpp"
 #include "../interactivity/win32/UiaTextRange.hpp"
 #include "../interactivity/win32/screenInfoUiaProvider.hpp"
 #include "../interactivity/win32/windowUiaProvider.hpp"
@@ -19,10 +20,157 @@ enum TraceKeywords
     Input = 0x200,
     API = 0x400,
     UIA = 0x800,
-    All = 0xFFF
+    Counters = 0x1000,
+    All = 0x1FFF
 };
 DEFINE_ENUM_FLAG_OPERATORS(TraceKeywords);
 
+// Each counter owns a full cache line so the hot paths bumping unrelated
+// counters (input thread, API dispatch, render thread) never contend on the
+// same line.
+struct alignas(64) _PaddedCounter
+{
+    LONGLONG Value;
+};
+
+static _PaddedCounter s_rgPerfCounters[static_cast<size_t>(PerfCounters::Counter::Count)];
+
+// QPC timestamp of the last emitted snapshot event. Doubles as the election
+// token that picks a single emitter when several hot paths notice the
+// interval has elapsed at the same time.
+static LONGLONG s_liLastCounterEmitQpc = 0;
+
+static const LONGLONG sc_CounterEmitIntervalSeconds = 10;
+
+static LONGLONG s_QueryQpcFrequency() noexcept
+{
+    static const LONGLONG frequency = [] {
+        LARGE_INTEGER li;
+        QueryPerformanceFrequency(&li);
+        return li.QuadPart;
+    }();
+    return frequency;
+}
+
+// Routine Description:
+// - Adds one to a performance counter. Safe to call from any thread with no
+//   lock held; this is the entire cost of the always-on tier on a hot path.
+// Arguments:
+// - counter - Which counter to bump.
+// Return Value:
+// - <none>
+void PerfCounters::s_Increment(const Counter counter) noexcept
+{
+    InterlockedIncrement64(&s_rgPerfCounters[static_cast<size_t>(counter)].Value);
+}
+
+// Routine Description:
+// - Adds an arbitrary amount to a performance counter, for the counters that
+//   accumulate quantities (characters, QPC ticks) rather than occurrences.
+// Arguments:
+// - counter - Which counter to bump.
+// - delta - Amount to add.
+// Return Value:
+// - <none>
+void PerfCounters::s_Add(const Counter counter, const LONGLONG delta) noexcept
+{
+    InterlockedAdd64(&s_rgPerfCounters[static_cast<size_t>(counter)].Value, delta);
+}
+
+// Routine Description:
+// - Reads the current cumulative totals for in-process consumers. The reads
+//   are individually atomic but not taken under a common lock, so the fields
+//   are each exact while the set as a whole is only as consistent as any
+//   sampling profiler's view - fine for the rate math monitoring does.
+// Return Value:
+// - A copy of the counter totals since process start.
+PerfCounters::Snapshot PerfCounters::s_GetSnapshot() noexcept
+{
+    Snapshot snapshot;
+    snapshot.ApiCalls = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::ApiCalls)].Value);
+    snapshot.WriteCalls = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::WriteCalls)].Value);
+    snapshot.CellsWritten = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::CellsWritten)].Value);
+    snapshot.FramesRendered = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::FramesRendered)].Value);
+    snapshot.InputEvents = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::InputEvents)].Value);
+
+    // Split the conversion so tick totals in the billions don't overflow the
+    // microsecond multiply.
+    const LONGLONG ticks = ReadNoFence64(&s_rgPerfCounters[static_cast<size_t>(Counter::LockWaitTicks)].Value);
+    const LONGLONG frequency = s_QueryQpcFrequency();
+    snapshot.LockWaitMicroseconds = (ticks / frequency) * 1000000LL + ((ticks % frequency) * 1000000LL) / frequency;
+
+    return snapshot;
+}
+
+// Routine Description:
+// - Emits the periodic counter snapshot event if a session is listening and
+//   the emit interval has elapsed. Called from sites that are already hot
+//   (API dispatch, frame completion) instead of from a dedicated timer
+//   thread - a console idle enough to stop triggering these has nothing new
+//   to report, and the final totals of an interesting interval went out with
+//   the activity that made it interesting.
+// Return Value:
+// - <none>
+void PerfCounters::s_EmitIfDue() noexcept
+{
+    if (!TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider, WINEVENT_LEVEL_INFO, TraceKeywords::Counters))
+    {
+        return;
+    }
+
+    LARGE_INTEGER liNow;
+    QueryPerformanceCounter(&liNow);
+    const LONGLONG lastEmit = ReadNoFence64(&s_liLastCounterEmitQpc);
+    if (liNow.QuadPart - lastEmit < sc_CounterEmitIntervalSeconds * s_QueryQpcFrequency())
+    {
+        return;
+    }
+
+    // Whoever swaps the timestamp first owns this interval's event; the
+    // losers see a moved timestamp and bail.
+    if (InterlockedCompareExchange64(&s_liLastCounterEmitQpc, liNow.QuadPart, lastEmit) != lastEmit)
+    {
+        return;
+    }
+
+    const Snapshot snapshot = s_GetSnapshot();
+
+    // clang-format off
+    TraceLoggingWrite(
+        g_hConhostV2EventTraceProvider,
+        "PerfCounterSnapshot",
+        TraceLoggingInt64(snapshot.ApiCalls, "ApiCalls"),
+        TraceLoggingInt64(snapshot.WriteCalls, "WriteCalls"),
+        TraceLoggingInt64(snapshot.CellsWritten, "CellsWritten"),
+        TraceLoggingInt64(snapshot.FramesRendered, "FramesRendered"),
+        TraceLoggingInt64(snapshot.InputEvents, "InputEvents"),
+        TraceLoggingInt64(snapshot.LockWaitMicroseconds, "LockWaitMicroseconds"),
+        TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+        TraceLoggingKeyword(TraceKeywords::Counters));
+    // clang-format on
+
+#if defined(ALLOC_ACCOUNTING)
+    // Accounting builds ride the same cadence with a per-subsystem heap
+    // event; allocation rate falls out of the total deltas between snapshots.
+    for (size_t tag = 0; tag < static_cast<size_t>(AllocAccounting::Tag::Count); tag++)
+    {
+        const auto alloc = AllocAccounting::s_GetSnapshot(static_cast<AllocAccounting::Tag>(tag));
+        // clang-format off
+        TraceLoggingWrite(
+            g_hConhostV2EventTraceProvider,
+            "AllocCounterSnapshot",
+            TraceLoggingWideString(AllocAccounting::s_TagName(static_cast<AllocAccounting::Tag>(tag)), "Subsystem"),
+            TraceLoggingInt64(alloc.LiveCount, "LiveCount"),
+            TraceLoggingInt64(alloc.LiveBytes, "LiveBytes"),
+            TraceLoggingInt64(alloc.TotalCount, "TotalCount"),
+            TraceLoggingInt64(alloc.TotalBytes, "TotalBytes"),
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(TraceKeywords::Counters));
+        // clang-format on
+    }
+#endif
+}
+
 // Routine Description:
 // - Creates a tracing object to assist with automatically firing a stop event
 //   when this object goes out of scope.
@@ -79,8 +227,43 @@ Tracing Tracing::s_TraceApiCall(const NTSTATUS& result, PCSTR traceName)
     // clang-format on
 }
 
+// Routine Description:
+// - Determines whether anybody is listening for the per-API start/stop events
+//   so dispatch can skip building the tracing scope on the hot path entirely.
+// Return Value:
+// - True if an ETW session has enabled the provider at verbose level for API events.
+bool Tracing::s_IsApiCallTracingEnabled() noexcept
+{
+    return TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider,
+                                       WINEVENT_LEVEL_VERBOSE,
+                                       TraceKeywords::API);
+}
+
 ULONG Tracing::s_ulDebugFlag = 0x0;
 
+// Routine Description:
+// - Emits the conpty latency marker for text arriving from a client
+//   application, before it's laid into the buffer and re-encoded by the VT
+//   renderer. Correlated with the VtEngine_Frame event and the terminal-side
+//   read/write markers, a consumer can attribute end-to-end conpty latency
+//   to the stage that actually spent it (see tools\conptylatency).
+// Arguments:
+// - cch - The number of characters the client wrote.
+// Return Value:
+// - <none>
+void Tracing::s_TraceConptyClientWrite(const size_t cch)
+{
+    if (TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider, WINEVENT_LEVEL_INFO, TraceKeywords::Output))
+    {
+        TraceLoggingWrite(
+            g_hConhostV2EventTraceProvider,
+            "ConptyClientWrite",
+            TraceLoggingUInt64(gsl::narrow_cast<UINT64>(cch), "cch"),
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(TraceKeywords::Output));
+    }
+}
+
 void Tracing::s_TraceApi(const NTSTATUS status, const CONSOLE_GETLARGESTWINDOWSIZE_MSG* const a)
 {
     TraceLoggingWrite(
@@ -245,6 +428,40 @@ void Tracing::s_TraceApi(const CONSOLE_WRITECONSOLEOUTPUTSTRING_MSG* const a)
         TraceLoggingKeyword(TraceKeywords::API));
 }
 
+// Routine Description:
+// - Emits one event per named startup phase with the time elapsed since the
+//   first phase was recorded, producing a timeline of where a cold conhost
+//   launch spends its time before the first prompt.
+// Arguments:
+// - pszPhase - Name of the initialization phase that was just reached.
+void Tracing::s_TraceStartupPhase(_In_z_ PCWSTR pszPhase)
+{
+    // Capture the baseline on the first phase so every later event reports
+    // its offset from the beginning of initialization.
+    static bool fBaselineCaptured = false;
+    static LARGE_INTEGER liFrequency;
+    static LARGE_INTEGER liBaseline;
+
+    if (!fBaselineCaptured)
+    {
+        QueryPerformanceFrequency(&liFrequency);
+        QueryPerformanceCounter(&liBaseline);
+        fBaselineCaptured = true;
+    }
+
+    LARGE_INTEGER liNow;
+    QueryPerformanceCounter(&liNow);
+    const ULONGLONG ullMicroseconds = (liNow.QuadPart - liBaseline.QuadPart) * 1000000ULL / liFrequency.QuadPart;
+
+    TraceLoggingWrite(
+        g_hConhostV2EventTraceProvider,
+        "StartupPhase",
+        TraceLoggingWideString(pszPhase, "Phase"),
+        TraceLoggingUInt64(ullMicroseconds, "MicrosecondsSinceStart"),
+        TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+        TraceLoggingKeyword(TraceKeywords::General));
+}
+
 void Tracing::s_TraceWindowViewport(const Microsoft::Console::Types::Viewport& viewport)
 {
     TraceLoggingWrite(
@@ -66,6 +66,7 @@ public:
     ~Tracing();
 
     static Tracing s_TraceApiCall(const NTSTATUS& result, PCSTR traceName);
+    static bool s_IsApiCallTracingEnabled() noexcept;
 
     static void s_TraceApi(const NTSTATUS status, const CONSOLE_GETLARGESTWINDOWSIZE_MSG* const a);
     static void s_TraceApi(const NTSTATUS status, const CONSOLE_SCREENBUFFERINFO_MSG* const a, const bool fSet);
@@ -81,6 +82,10 @@ public:
 
     static void s_TraceWindowViewport(const Microsoft::Console::Types::Viewport& viewport);
 
+    static void s_TraceStartupPhase(_In_z_ PCWSTR pszPhase);
+
+    static void s_TraceConptyClientWrite(const size_t cch);
+
     static void s_TraceChars(_In_z_ const char* pszMessage, ...);
     static void s_TraceOutput(_In_z_ const char* pszMessage, ...);
 
@@ -113,3 +118,45 @@ private:
     static const wchar_t* const _eventIdToString(long eventId);
     static const wchar_t* const _directionToString(int direction);
 };
+
+// The always-on counter tier. The per-call events above cost a std::function
+// and two event writes apiece, so they only run while a verbose session is
+// attached; these are single interlocked increments on cache-line-isolated
+// slots, cheap enough to leave enabled in production builds permanently. The
+// hot paths bump cumulative totals, a low-frequency snapshot event goes out
+// over the provider whenever a session has the Counters keyword enabled, and
+// in-process consumers can read the same totals through s_GetSnapshot.
+class PerfCounters
+{
+public:
+    enum class Counter : size_t
+    {
+        ApiCalls = 0, // API requests dispatched from the driver
+        WriteCalls, // WriteConsole text insertions serviced
+        CellsWritten, // characters laid into the output buffer
+        FramesRendered, // render passes composed against the buffer
+        InputEvents, // input records written to the input buffer
+        LockWaitTicks, // QPC ticks spent blocked on a contended console lock
+        Count
+    };
+
+    static void s_Increment(const Counter counter) noexcept;
+    static void s_Add(const Counter counter, const LONGLONG delta) noexcept;
+
+    // Cumulative totals since process start. Consumers diff consecutive
+    // snapshots to derive rates; lock wait is already converted from QPC
+    // ticks to microseconds.
+    struct Snapshot
+    {
+        LONGLONG ApiCalls;
+        LONGLONG WriteCalls;
+        LONGLONG CellsWritten;
+        LONGLONG FramesRendered;
+        LONGLONG InputEvents;
+        LONGLONG LockWaitMicroseconds;
+    };
+
+    static Snapshot s_GetSnapshot() noexcept;
+
+    static void s_EmitIfDue() noexcept;
+};
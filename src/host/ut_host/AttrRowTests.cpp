@@ -235,8 +235,11 @@ class AttrRowTests
         return NoThrowString().Format(L"%wc%d", run.GetAttributes().GetLegacyAttributes(), run.GetLength());
     }
 
+    // Templated so it accepts both std::vector and the small_vector the row
+    // stores its runs in.
+    template<typename TRunContainer>
     void LogChain(_In_ PCWSTR pwszPrefix,
-                  std::vector<TextAttributeRun>& chain)
+                  TRunContainer& chain)
     {
         NoThrowString str(pwszPrefix);
 
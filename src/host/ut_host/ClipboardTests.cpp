@@ -161,30 +161,30 @@ class ClipboardTests
     TEST_METHOD(CanConvertTextToInputEvents)
     {
         std::wstring wstr = L"hello world";
-        std::deque<std::unique_ptr<IInputEvent>> events = Clipboard::Instance().TextToKeyEvents(wstr.c_str(),
-                                                                                                wstr.size());
+        std::vector<INPUT_RECORD> events = Clipboard::Instance().TextToKeyEventRecords(wstr.c_str(),
+                                                                                       wstr.size());
         VERIFY_ARE_EQUAL(wstr.size() * 2, events.size());
         IInputServices* pInputServices = ServiceLocator::LocateInputServices();
+        size_t index = 0;
         for (wchar_t wch : wstr)
         {
             std::deque<bool> keydownPattern{ true, false };
             for (bool isKeyDown : keydownPattern)
             {
-                VERIFY_ARE_EQUAL(InputEventType::KeyEvent, events.front()->EventType());
-                std::unique_ptr<KeyEvent> keyEvent;
-                keyEvent.reset(static_cast<KeyEvent* const>(events.front().release()));
-                events.pop_front();
+                VERIFY_ARE_EQUAL(static_cast<WORD>(KEY_EVENT), events[index].EventType);
+                const KeyEvent keyEvent{ events[index].Event.KeyEvent };
+                ++index;
 
                 const short keyState = pInputServices->VkKeyScanW(wch);
                 VERIFY_ARE_NOT_EQUAL(-1, keyState);
                 const WORD virtualScanCode = static_cast<WORD>(pInputServices->MapVirtualKeyW(wch, MAPVK_VK_TO_VSC));
 
-                VERIFY_ARE_EQUAL(wch, keyEvent->GetCharData());
-                VERIFY_ARE_EQUAL(isKeyDown, keyEvent->IsKeyDown());
-                VERIFY_ARE_EQUAL(1, keyEvent->GetRepeatCount());
-                VERIFY_ARE_EQUAL(static_cast<DWORD>(0), keyEvent->GetActiveModifierKeys());
-                VERIFY_ARE_EQUAL(virtualScanCode, keyEvent->GetVirtualScanCode());
-                VERIFY_ARE_EQUAL(LOBYTE(keyState), keyEvent->GetVirtualKeyCode());
+                VERIFY_ARE_EQUAL(wch, keyEvent.GetCharData());
+                VERIFY_ARE_EQUAL(isKeyDown, keyEvent.IsKeyDown());
+                VERIFY_ARE_EQUAL(1, keyEvent.GetRepeatCount());
+                VERIFY_ARE_EQUAL(static_cast<DWORD>(0), keyEvent.GetActiveModifierKeys());
+                VERIFY_ARE_EQUAL(virtualScanCode, keyEvent.GetVirtualScanCode());
+                VERIFY_ARE_EQUAL(LOBYTE(keyState), keyEvent.GetVirtualKeyCode());
             }
         }
     }
@@ -197,12 +197,13 @@ class ClipboardTests
         {
             std::isupper(wch) ? ++uppercaseCount : 0;
         }
-        std::deque<std::unique_ptr<IInputEvent>> events = Clipboard::Instance().TextToKeyEvents(wstr.c_str(),
-                                                                                                wstr.size());
+        std::vector<INPUT_RECORD> events = Clipboard::Instance().TextToKeyEventRecords(wstr.c_str(),
+                                                                                       wstr.size());
 
         VERIFY_ARE_EQUAL((wstr.size() + uppercaseCount) * 2, events.size());
         IInputServices* pInputServices = ServiceLocator::LocateInputServices();
         VERIFY_IS_NOT_NULL(pInputServices);
+        size_t index = 0;
         for (wchar_t wch : wstr)
         {
             std::deque<bool> keydownPattern{ true, false };
@@ -210,10 +211,9 @@ class ClipboardTests
             {
                 Log::Comment(NoThrowString().Format(L"testing char: %C; keydown: %d", wch, isKeyDown));
 
-                VERIFY_ARE_EQUAL(InputEventType::KeyEvent, events.front()->EventType());
-                std::unique_ptr<KeyEvent> keyEvent;
-                keyEvent.reset(static_cast<KeyEvent* const>(events.front().release()));
-                events.pop_front();
+                VERIFY_ARE_EQUAL(static_cast<WORD>(KEY_EVENT), events[index].EventType);
+                const KeyEvent keyEvent{ events[index].Event.KeyEvent };
+                ++index;
 
                 const short keyScanError = -1;
                 const short keyState = pInputServices->VkKeyScanW(wch);
@@ -225,12 +225,11 @@ class ClipboardTests
                     // uppercase letters have shift key events
                     // surrounding them, making two events per letter
                     // (and another two for the keyup)
-                    VERIFY_IS_FALSE(events.empty());
+                    VERIFY_IS_LESS_THAN(index, events.size());
 
-                    VERIFY_ARE_EQUAL(InputEventType::KeyEvent, events.front()->EventType());
-                    std::unique_ptr<KeyEvent> keyEvent2;
-                    keyEvent2.reset(static_cast<KeyEvent* const>(events.front().release()));
-                    events.pop_front();
+                    VERIFY_ARE_EQUAL(static_cast<WORD>(KEY_EVENT), events[index].EventType);
+                    const KeyEvent keyEvent2{ events[index].Event.KeyEvent };
+                    ++index;
 
                     const short keyState2 = pInputServices->VkKeyScanW(wch);
                     VERIFY_ARE_NOT_EQUAL(keyScanError, keyState);
@@ -240,25 +239,25 @@ class ClipboardTests
                     {
                         // shift then letter
                         const KeyEvent shiftDownEvent({ TRUE, 1, VK_SHIFT, leftShiftScanCode, L'\0', SHIFT_PRESSED });
-                        VERIFY_ARE_EQUAL(shiftDownEvent, *keyEvent);
+                        VERIFY_ARE_EQUAL(shiftDownEvent, keyEvent);
 
                         const KeyEvent expectedKeyEvent({ TRUE, 1, LOBYTE(keyState2), virtualScanCode2, wch, SHIFT_PRESSED });
-                        VERIFY_ARE_EQUAL(expectedKeyEvent, *keyEvent2);
+                        VERIFY_ARE_EQUAL(expectedKeyEvent, keyEvent2);
                     }
                     else
                     {
                         // letter then shift
                         const KeyEvent expectedKeyEvent({ FALSE, 1, LOBYTE(keyState), virtualScanCode, wch, SHIFT_PRESSED });
-                        VERIFY_ARE_EQUAL(expectedKeyEvent, *keyEvent);
+                        VERIFY_ARE_EQUAL(expectedKeyEvent, keyEvent);
 
                         const KeyEvent shiftUpEvent({ FALSE, 1, VK_SHIFT, leftShiftScanCode, L'\0', 0 });
-                        VERIFY_ARE_EQUAL(shiftUpEvent, *keyEvent2);
+                        VERIFY_ARE_EQUAL(shiftUpEvent, keyEvent2);
                     }
                 }
                 else
                 {
                     const KeyEvent expectedKeyEvent({ !!isKeyDown, 1, LOBYTE(keyState), virtualScanCode, wch, 0 });
-                    VERIFY_ARE_EQUAL(expectedKeyEvent, *keyEvent);
+                    VERIFY_ARE_EQUAL(expectedKeyEvent, keyEvent);
                 }
             }
         }
@@ -268,8 +267,8 @@ class ClipboardTests
     TEST_METHOD(CanConvertCharsRequiringAltGr)
     {
         const std::wstring wstr = L"\x20ac"; // € char U+20AC
-        std::deque<std::unique_ptr<IInputEvent>> events = Clipboard::Instance().TextToKeyEvents(wstr.c_str(),
-                                                                                                wstr.size());
+        std::vector<INPUT_RECORD> events = Clipboard::Instance().TextToKeyEventRecords(wstr.c_str(),
+                                                                                       wstr.size());
 
         // should be converted to:
         // 1. AltGr keydown
@@ -290,7 +289,7 @@ class ClipboardTests
 
         for (size_t i = 0; i < events.size(); ++i)
         {
-            const KeyEvent currentKeyEvent = *reinterpret_cast<const KeyEvent* const>(events[i].get());
+            const KeyEvent currentKeyEvent{ events[i].Event.KeyEvent };
             VERIFY_ARE_EQUAL(expectedEvents[i], currentKeyEvent, NoThrowString().Format(L"i == %d", i));
         }
     }
@@ -301,8 +300,8 @@ class ClipboardTests
         const std::wstring wstr = L"\xbc"; // ¼ char U+00BC
         const UINT outputCodepage = CP_JAPANESE;
         ServiceLocator::LocateGlobals().getConsoleInformation().OutputCP = outputCodepage;
-        std::deque<std::unique_ptr<IInputEvent>> events = Clipboard::Instance().TextToKeyEvents(wstr.c_str(),
-                                                                                                wstr.size());
+        std::vector<INPUT_RECORD> events = Clipboard::Instance().TextToKeyEventRecords(wstr.c_str(),
+                                                                                       wstr.size());
 
         // should be converted to:
         // 1. left alt keydown
@@ -324,7 +323,7 @@ class ClipboardTests
 
         for (size_t i = 0; i < events.size(); ++i)
         {
-            const KeyEvent currentKeyEvent = *reinterpret_cast<const KeyEvent* const>(events[i].get());
+            const KeyEvent currentKeyEvent{ events[i].Event.KeyEvent };
             VERIFY_ARE_EQUAL(expectedEvents[i], currentKeyEvent, NoThrowString().Format(L"i == %d", i));
         }
     }
@@ -32,30 +32,29 @@ class CodepointWidthDetectorTests
 {
     TEST_CLASS(CodepointWidthDetectorTests);
 
-    TEST_METHOD(CodepointWidthDetectDefersMapPopulation)
-    {
-        CodepointWidthDetector widthDetector;
-        VERIFY_IS_TRUE(widthDetector._map.empty());
-        widthDetector.IsWide(UNICODE_SPACE);
-        VERIFY_IS_TRUE(widthDetector._map.empty());
-        // now force checking
-        widthDetector.GetWidth(emoji);
-        VERIFY_IS_FALSE(widthDetector._map.empty());
-    }
-
     TEST_METHOD(CanLookUpEmoji)
     {
         CodepointWidthDetector widthDetector;
         VERIFY_IS_TRUE(widthDetector.IsWide(emoji));
     }
 
-    TEST_METHOD(TestUnicodeRangeCompare)
+    TEST_METHOD(CanGetWidthsAtPageBoundaries)
     {
-        CodepointWidthDetector::UnicodeRangeCompare compare;
-        // test comparing 2 search terms
-        CodepointWidthDetector::UnicodeRange a{ 0x10 };
-        CodepointWidthDetector::UnicodeRange b{ 0x15 };
-        VERIFY_IS_TRUE(static_cast<bool>(compare(a, b)));
+        // Exercise both levels of the lookup: codepoints in uniform pages
+        // resolve in the page index, codepoints in mixed pages and outside
+        // the BMP go through the range search.
+        CodepointWidthDetector widthDetector;
+        // U+4E00 sits in a uniform wide page (CJK unified ideographs)
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x4E00"));
+        // U+00A1 sits in a mixed page (latin-1 ambiguous punctuation)
+        VERIFY_ARE_EQUAL(CodepointWidth::Ambiguous, widthDetector.GetWidth(L"\xA1"));
+        // first and last codepoints of a page
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x3000"));
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x33FF"));
+        // near the top of the BMP and just beyond it
+        VERIFY_ARE_EQUAL(CodepointWidth::Ambiguous, widthDetector.GetWidth(L"\xFFFD"));
+        VERIFY_ARE_EQUAL(CodepointWidth::Invalid, widthDetector.GetWidth(L"\xFFFF"));
+        VERIFY_ARE_EQUAL(CodepointWidth::Narrow, widthDetector.GetWidth(L"\xD800\xDC00")); // U+10000
     }
 
     TEST_METHOD(CanExtractCodepoint)
@@ -114,8 +113,15 @@ class CodepointWidthDetectorTests
         VERIFY_ARE_EQUAL(ambiguous, it->first);
         VERIFY_ARE_EQUAL(FallbackMethod(ambiguous), it->second);
 
-        // Cache should empty when font changes.
+        // The direct-mapped recent cache should hold it too.
+        const auto& entry = widthDetector._recentFallback[ambiguous.front() % widthDetector._recentFallback.size()];
+        VERIFY_IS_TRUE(entry.valid);
+        VERIFY_ARE_EQUAL(ambiguous.front(), entry.ch);
+        VERIFY_ARE_EQUAL(FallbackMethod(ambiguous), entry.isWide);
+
+        // Both caches should empty when font changes.
         widthDetector.NotifyFontChanged();
         VERIFY_ARE_EQUAL(0u, widthDetector._fallbackCache.size());
+        VERIFY_IS_FALSE(entry.valid);
     }
 };
@@ -242,6 +242,31 @@ class HistoryTests
         VERIFY_ARE_EQUAL(2ul, history->GetNumberOfCommands());
     }
 
+    TEST_METHOD(AddNoDuplicatesAfterEvictionAndCaseChange)
+    {
+        auto history = CommandHistory::s_Allocate(_manyApps[0], _MakeHandle(0));
+        VERIFY_IS_NOT_NULL(history);
+
+        Log::Comment(L"Overfill the buffer so the oldest entries get evicted.");
+        for (size_t j = 0; j < _manyHistoryItems.size(); j++)
+        {
+            VERIFY_SUCCEEDED(history->Add(_manyHistoryItems[j], true));
+        }
+        VERIFY_ARE_EQUAL(s_BufferSize, history->GetNumberOfCommands());
+
+        // The buffer now holds items 2-11; "ipconfig" (item 4) sits in slot 2.
+        VERIFY_ARE_EQUAL(String(L"ipconfig"), String(history->GetNth(2).data()));
+
+        Log::Comment(L"Re-adding an older command in different casing should merge with the stored one.");
+        VERIFY_SUCCEEDED(history->Add(L"IPCONFIG", true));
+
+        VERIFY_ARE_EQUAL(s_BufferSize, history->GetNumberOfCommands());
+        // The merge keeps the stored casing and moves the command to the most recent slot.
+        VERIFY_ARE_EQUAL(String(L"ipconfig"), String(history->GetNth((SHORT)(s_BufferSize - 1)).data()));
+        // Everything behind the removed slot shifted down by one.
+        VERIFY_ARE_EQUAL(String(L"ipconfig /all"), String(history->GetNth(2).data()));
+    }
+
 private:
     const std::array<std::wstring, 5> _manyApps = {
         L"foo.exe",
@@ -139,10 +139,20 @@ class TextBufferTests
     TEST_METHOD(ResizeTraditionalRotationPreservesHighUnicode);
     TEST_METHOD(ScrollBufferRotationPreservesHighUnicode);
 
+    TEST_METHOD(ScrollRowsInRotatedBuffer);
+
     TEST_METHOD(ResizeTraditionalHighUnicodeRowRemoval);
     TEST_METHOD(ResizeTraditionalHighUnicodeColumnRemoval);
 
     TEST_METHOD(TestBurrito);
+
+    TEST_METHOD(CompressScrollbackRoundTrip);
+
+    TEST_METHOD(EvictionRehydratesCompressedRow);
+
+    TEST_METHOD(LazyRowMaterialization);
+
+    TEST_METHOD(LazyDbcsAttributeMaterialization);
 };
 
 void TextBufferTests::TestBufferCreate()
@@ -1780,7 +1790,7 @@ void TextBufferTests::ResizeTraditionalRotationPreservesHighUnicode()
 
     // Get a position inside the buffer
     const COORD pos{ 2, 1 };
-    auto position = _buffer->_storage[pos.Y].GetCharRow().GlyphAt(pos.X);
+    auto position = _buffer->GetRowByOffset(pos.Y).GetCharRow().GlyphAt(pos.X);
 
     // Fill it up with a sequence that will have to hit the high unicode storage.
     // This is the negative squared latin capital letter B emoji: 🅱
@@ -1822,7 +1832,7 @@ void TextBufferTests::ScrollBufferRotationPreservesHighUnicode()
 
     // Get a position inside the buffer
     const COORD pos{ 2, 1 };
-    auto position = _buffer->_storage[pos.Y].GetCharRow().GlyphAt(pos.X);
+    auto position = _buffer->GetRowByOffset(pos.Y).GetCharRow().GlyphAt(pos.X);
 
     // Fill it up with a sequence that will have to hit the high unicode storage.
     // This is the fire emoji: 🔥
@@ -1850,6 +1860,51 @@ void TextBufferTests::ScrollBufferRotationPreservesHighUnicode()
     VERIFY_ARE_EQUAL(String(fire), String(shouldBeFireText.data(), gsl::narrow<int>(shouldBeFireText.size())));
 }
 
+// This tests that scrolling a band of rows while the circular buffer is rotated
+// (the first row isn't storage slot 0) moves the right rows, leaves the rest of
+// the buffer alone, and keeps every row's ID matching the slot it occupies.
+void TextBufferTests::ScrollRowsInRotatedBuffer()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Rotate the buffer so the seam sits above the band we're going to move.
+    const SHORT firstRow = 2;
+    _buffer->_SetFirstRowIndex(firstRow);
+
+    // Drop a marker in a row inside the band.
+    const COORD pos{ 2, 4 };
+    auto position = _buffer->GetRowByOffset(pos.Y).GetCharRow().GlyphAt(pos.X);
+    const auto marker = L"Q";
+    position = marker;
+
+    // Scroll the marker row down by delta. The span of rows this touches stays
+    // clear of the seam, so this exercises the in-place band rotation.
+    const SHORT delta = 3;
+    const COORD newPos{ pos.X, pos.Y + delta };
+    _buffer->ScrollRows(pos.Y, 1, delta);
+
+    // The circular buffer shouldn't have been straightened out for this.
+    VERIFY_ARE_EQUAL(firstRow, _buffer->GetFirstRowIndex());
+
+    // Retrieve the text at the old and new positions.
+    const auto shouldBeEmptyText = *_buffer->GetTextDataAt(pos);
+    const auto shouldBeMarkerText = *_buffer->GetTextDataAt(newPos);
+
+    VERIFY_ARE_EQUAL(String(L" "), String(shouldBeEmptyText.data(), gsl::narrow<int>(shouldBeEmptyText.size())));
+    VERIFY_ARE_EQUAL(String(marker), String(shouldBeMarkerText.data(), gsl::narrow<int>(shouldBeMarkerText.size())));
+
+    // Every row's ID should still match the storage slot it occupies.
+    for (SHORT y = 0; y < bufferSize.Y; y++)
+    {
+        const SHORT expectedId = gsl::narrow_cast<SHORT>((firstRow + y) % bufferSize.Y);
+        VERIFY_ARE_EQUAL(expectedId, _buffer->GetRowByOffset(y).GetId());
+    }
+}
+
 // This tests that rows removed from the buffer while resizing traditionally will also drop the high unicode
 // characters from the Unicode Storage buffer
 void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
@@ -1862,7 +1917,7 @@ void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
 
     // Get a position inside the buffer in the bottom row
     const COORD pos{ 0, bufferSize.Y - 1 };
-    auto position = _buffer->_storage[pos.Y].GetCharRow().GlyphAt(pos.X);
+    auto position = _buffer->GetRowByOffset(pos.Y).GetCharRow().GlyphAt(pos.X);
 
     // Fill it up with a sequence that will have to hit the high unicode storage.
     // This is the eggplant emoji: 🍆
@@ -1875,14 +1930,24 @@ void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    // Count the overflow glyphs stored across every row in the buffer.
+    const auto countOverflow = [&]() {
+        size_t count = 0;
+        for (const auto& row : _buffer->_storage)
+        {
+            count += row.GetCharRow()._overflow.size();
+        }
+        return count;
+    };
+
+    VERIFY_ARE_EQUAL(1u, countOverflow(), L"There should be one overflow glyph stored.");
 
     // Perform resize to trim off the row of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X, bufferSize.Y - 1 };
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    VERIFY_ARE_EQUAL(0u, countOverflow(), L"No overflow glyphs should remain stored.");
 }
 
 // This tests that columns removed from the buffer while resizing traditionally will also drop the high unicode
@@ -1897,7 +1962,7 @@ void TextBufferTests::ResizeTraditionalHighUnicodeColumnRemoval()
 
     // Get a position inside the buffer in the last column
     const COORD pos{ bufferSize.X - 1, 0 };
-    auto position = _buffer->_storage[pos.Y].GetCharRow().GlyphAt(pos.X);
+    auto position = _buffer->GetRowByOffset(pos.Y).GetCharRow().GlyphAt(pos.X);
 
     // Fill it up with a sequence that will have to hit the high unicode storage.
     // This is the peach emoji: 🍑
@@ -1910,14 +1975,30 @@ void TextBufferTests::ResizeTraditionalHighUnicodeColumnRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    // Count the overflow glyphs stored across every row in the buffer.
+    const auto countOverflow = [&]() {
+        size_t count = 0;
+        for (const auto& row : _buffer->_storage)
+        {
+            count += row.GetCharRow()._overflow.size();
+        }
+        return count;
+    };
+
+    VERIFY_ARE_EQUAL(1u, countOverflow(), L"There should be one overflow glyph stored.");
 
     // Perform resize to trim off the column of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X - 1, bufferSize.Y };
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    // Rows reflow to the new width lazily; visit each one so the trims take effect.
+    for (SHORT i = 0; i < trimmedBufferSize.Y; ++i)
+    {
+        _buffer->GetRowByOffset(i);
+    }
+
+    VERIFY_ARE_EQUAL(0u, countOverflow(), L"No overflow glyphs should remain stored.");
 }
 
 void TextBufferTests::TestBurrito()
@@ -1940,3 +2021,130 @@ void TextBufferTests::TestBurrito()
     _buffer->IncrementCursor();
     VERIFY_IS_FALSE(afterBurritoIter);
 }
+
+void TextBufferTests::CompressScrollbackRoundTrip()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Fill the top row with some text, including an emoji that needs overflow storage.
+    // This is the taco emoji: 🌮
+    const auto taco = L"\xD83C\xDF2E";
+    const COORD textPos{ 0, 0 };
+    _buffer->WriteLine(OutputCellIterator{ std::wstring_view{ L"Hello" }, attr }, textPos);
+    auto position = _buffer->GetRowByOffset(0).GetCharRow().GlyphAt(6);
+    position = taco;
+
+    const auto expected = _buffer->GetRowByOffset(0).GetText();
+
+    // Rows materialize lazily; visit row 3 so we can tell that the sweep
+    // below stops ahead of it.
+    _buffer->GetRowByOffset(3);
+
+    // Pack everything above row 3 into the cold tier.
+    _buffer->CompressScrollback(3);
+    VERIFY_IS_TRUE(_buffer->_storage[0].IsCompressed());
+    VERIFY_IS_TRUE(_buffer->_storage[2].IsCompressed());
+    VERIFY_IS_FALSE(_buffer->_storage[3].IsCompressed());
+
+    // The row must still report its full width while compressed.
+    VERIFY_ARE_EQUAL(static_cast<size_t>(bufferSize.X), _buffer->_storage[0].size());
+
+    // Visiting the row through the usual seam rehydrates it with identical contents.
+    const auto& rehydrated = _buffer->GetRowByOffset(0);
+    VERIFY_IS_FALSE(rehydrated.IsCompressed());
+    VERIFY_ARE_EQUAL(expected, rehydrated.GetText());
+
+    // A second sweep of the boundary doesn't disturb rows that stayed cold.
+    _buffer->CompressScrollback(3);
+    VERIFY_IS_TRUE(_buffer->_storage[1].IsCompressed());
+    VERIFY_ARE_EQUAL(expected, _buffer->GetRowByOffset(0).GetText());
+}
+
+void TextBufferTests::EvictionRehydratesCompressedRow()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Put recognizable text in the top row, then pack it into the cold tier
+    // the way a long-running session would have by the time it's recycled.
+    _buffer->WriteLine(OutputCellIterator{ std::wstring_view{ L"history line" }, attr }, { 0, 0 });
+    const auto expected = _buffer->GetRowByOffset(0).GetText();
+    _buffer->CompressScrollback(1);
+    VERIFY_IS_TRUE(_buffer->_storage[0].IsCompressed());
+
+    // The eviction callback must see the row's real contents, not the
+    // empty read a compressed CharRow produces.
+    std::wstring evictedText;
+    _buffer->SetRowEvictionCallback([&evictedText](const ROW& row) {
+        evictedText = row.GetCharRow().GetText();
+    });
+    VERIFY_IS_TRUE(_buffer->IncrementCircularBuffer());
+    VERIFY_ARE_EQUAL(expected, evictedText);
+}
+
+void TextBufferTests::LazyRowMaterialization()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Freshly constructed rows are packed blank and still report full width.
+    VERIFY_IS_TRUE(_buffer->_storage[5].IsCompressed());
+    VERIFY_ARE_EQUAL(static_cast<size_t>(bufferSize.X), _buffer->_storage[5].size());
+
+    // Visiting a row materializes it; untouched neighbors stay packed.
+    const auto& row = _buffer->GetRowByOffset(5);
+    VERIFY_IS_FALSE(row.IsCompressed());
+    VERIFY_ARE_EQUAL(std::wstring(bufferSize.X, UNICODE_SPACE), row.GetText());
+    VERIFY_IS_TRUE(_buffer->_storage[6].IsCompressed());
+}
+
+void TextBufferTests::LazyDbcsAttributeMaterialization()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, _renderTarget);
+
+    // Writing plain narrow text must not materialize per-cell DBCS metadata.
+    auto& row = _buffer->GetRowByOffset(0);
+    auto& charRow = row.GetCharRow();
+    _buffer->WriteLine(OutputCellIterator{ std::wstring_view{ L"Hello World" }, attr }, { 0, 0 });
+    VERIFY_IS_TRUE(charRow._attrs.empty());
+
+    // Reads report the default single-byte attribute for every cell.
+    const auto& constRow = charRow;
+    VERIFY_IS_TRUE(constRow.DbcsAttrAt(3).IsSingle());
+    VERIFY_IS_FALSE(constRow.DbcsAttrAt(3).IsGlyphStored());
+    VERIFY_ARE_EQUAL(std::wstring(constRow.Chars()), constRow.GetText());
+
+    // Storing a DBCS lead byte materializes the attributes for the row.
+    DbcsAttribute leading;
+    leading.SetLeading();
+    charRow.SetDbcsAttr(12, leading);
+    VERIFY_ARE_EQUAL(static_cast<size_t>(bufferSize.X), charRow._attrs.size());
+    VERIFY_IS_TRUE(constRow.DbcsAttrAt(12).IsLeading());
+
+    // Resetting the row hands the metadata back.
+    charRow.Reset();
+    VERIFY_IS_TRUE(charRow._attrs.empty());
+
+    // A compress/rehydrate cycle of an all-single-byte row sheds attribute
+    // storage the row picked up along the way.
+    _buffer->WriteLine(OutputCellIterator{ std::wstring_view{ L"plain text" }, attr }, { 0, 0 });
+    charRow.DbcsAttrAt(0); // mutable access materializes all-default attributes
+    VERIFY_IS_FALSE(charRow._attrs.empty());
+    charRow.Compress();
+    charRow.Decompress();
+    VERIFY_IS_TRUE(charRow._attrs.empty());
+}
@@ -86,6 +86,41 @@ class Utf16ParserTests
         }
     }
 
+    TEST_METHOD(ParseSpansViewsOriginalText)
+    {
+        std::wstring wstr{ LatinChar.at(0) };
+        wstr += SunglassesEmoji.at(0);
+        wstr += SunglassesEmoji.at(1);
+        wstr += HiraganaChar.at(0);
+
+        const std::vector<std::wstring_view> result = Utf16Parser::ParseSpans(wstr);
+
+        VERIFY_ARE_EQUAL(result.size(), 3u);
+        VERIFY_ARE_EQUAL(result.at(0), std::wstring_view{ wstr }.substr(0, 1));
+        VERIFY_ARE_EQUAL(result.at(1), std::wstring_view{ wstr }.substr(1, 2));
+        VERIFY_ARE_EQUAL(result.at(2), std::wstring_view{ wstr }.substr(3, 1));
+
+        // the views must alias the parsed string, not a copy
+        VERIFY_IS_TRUE(result.at(0).data() == wstr.data());
+    }
+
+    TEST_METHOD(ParseSpansDropsUnpairedSurrogates)
+    {
+        // lead with no trail, a bare trail, then a valid pair
+        std::wstring wstr{ SunglassesEmoji.at(0) };
+        wstr += SunglassesEmoji.at(1);
+        wstr += SunglassesEmoji.at(1);
+        wstr += SunglassesEmoji.at(0);
+        wstr += SunglassesEmoji.at(1);
+        wstr.at(1) = SunglassesEmoji.at(0); // wstr is now lead, lead, trail, lead, trail
+
+        const std::vector<std::wstring_view> result = Utf16Parser::ParseSpans(wstr);
+
+        VERIFY_ARE_EQUAL(result.size(), 2u);
+        VERIFY_ARE_EQUAL(result.at(0), std::wstring_view{ wstr }.substr(1, 2));
+        VERIFY_ARE_EQUAL(result.at(1), std::wstring_view{ wstr }.substr(3, 2));
+    }
+
     const std::wstring_view Replacement{ &UNICODE_REPLACEMENT, 1 };
 
     TEST_METHOD(ParseNextLeadOnly)
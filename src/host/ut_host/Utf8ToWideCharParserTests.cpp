@@ -45,6 +45,46 @@ class Utf8ToWideCharParserTests
         }
     }
 
+    TEST_METHOD(ConvertsLongAsciiRunTest)
+    {
+        Log::Comment(L"Testing that an ASCII run longer than a vector lane converts intact");
+        auto parser = Utf8ToWideCharParser{ utf8CodePage };
+        // 40 bytes of ASCII, then a multi-byte sequence to force the slow
+        // path on the same parser afterwards.
+        unsigned char ascii[40];
+        for (unsigned int i = 0; i < ARRAYSIZE(ascii); ++i)
+        {
+            ascii[i] = static_cast<unsigned char>(0x20 + i);
+        }
+        unsigned int consumed = 0;
+        unsigned int generated = 0;
+        unique_ptr<wchar_t[]> output{ nullptr };
+
+        VERIFY_SUCCEEDED(parser.Parse(ascii, ARRAYSIZE(ascii), consumed, output, generated));
+        VERIFY_ARE_EQUAL(consumed, (unsigned int)ARRAYSIZE(ascii));
+        VERIFY_ARE_EQUAL(generated, (unsigned int)ARRAYSIZE(ascii));
+        VERIFY_ARE_NOT_EQUAL(output.get(), nullptr);
+        for (unsigned int i = 0; i < ARRAYSIZE(ascii); ++i)
+        {
+            VERIFY_ARE_EQUAL(static_cast<wchar_t>(ascii[i]), output[i]);
+        }
+
+        Log::Comment(L"Testing that ASCII mixed with a multi-byte sequence still converts");
+        // 17 ASCII bytes then U+3059 (hiragana su)
+        const unsigned char mixed[20] = { 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0xe3, 0x81, 0x99 };
+        const wchar_t wideMixed[18] = { 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x3059 };
+        output.reset(nullptr);
+
+        VERIFY_SUCCEEDED(parser.Parse(mixed, ARRAYSIZE(mixed), consumed, output, generated));
+        VERIFY_ARE_EQUAL(consumed, (unsigned int)ARRAYSIZE(mixed));
+        VERIFY_ARE_EQUAL(generated, (unsigned int)ARRAYSIZE(wideMixed));
+        VERIFY_ARE_NOT_EQUAL(output.get(), nullptr);
+        for (unsigned int i = 0; i < ARRAYSIZE(wideMixed); ++i)
+        {
+            VERIFY_ARE_EQUAL(wideMixed[i], output[i]);
+        }
+    }
+
     TEST_METHOD(ConvertSimpleUtf8Test)
     {
         Log::Comment(L"Testing that a simple UTF8 sequence can be converted");
@@ -81,6 +81,9 @@ void VtIoTests::ModeParsingTest()
     VERIFY_SUCCEEDED(VtIo::ParseIoMode(L"xterm-ascii", mode));
     VERIFY_ARE_EQUAL(mode, VtIoMode::XTERM_ASCII);
 
+    VERIFY_SUCCEEDED(VtIo::ParseIoMode(L"binary", mode));
+    VERIFY_ARE_EQUAL(mode, VtIoMode::BINARY);
+
     VERIFY_SUCCEEDED(VtIo::ParseIoMode(L"", mode));
     VERIFY_ARE_EQUAL(mode, VtIoMode::XTERM_256);
 
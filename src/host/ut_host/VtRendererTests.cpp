@@ -97,6 +97,7 @@ class Microsoft::Console::Render::VtRendererTest
     TEST_METHOD(Xterm256TestInvalidate);
     TEST_METHOD(Xterm256TestColors);
     TEST_METHOD(Xterm256TestCursor);
+    TEST_METHOD(Xterm256TestRegionScroll);
 
     TEST_METHOD(XtermTestInvalidate);
     TEST_METHOD(XtermTestColors);
@@ -110,7 +111,10 @@ class Microsoft::Console::Render::VtRendererTest
 
     TEST_METHOD(TestResize);
 
+    TEST_METHOD(TestByteBudgets);
+
     void Test16Colors(VtEngine* engine);
+    void TestByteBudgetScenarios(XtermEngine& engine);
 
     std::deque<std::string> qExpectedInput;
     bool WriteCallback(const char* const pch, size_t const cch);
@@ -249,6 +253,24 @@ void VtRendererTest::VtSequenceHelperTests()
 
     qExpectedInput.push_back("\x1b[10C");
     VERIFY_SUCCEEDED(engine->_CursorForward(10));
+
+    qExpectedInput.push_back("\x1b[6;16r");
+    VERIFY_SUCCEEDED(engine->_SetScrollingRegion(5, 15));
+
+    qExpectedInput.push_back("\x1b[r");
+    VERIFY_SUCCEEDED(engine->_ResetScrollingRegion());
+
+    qExpectedInput.push_back("\x1b[S");
+    VERIFY_SUCCEEDED(engine->_ScrollUp(1));
+
+    qExpectedInput.push_back("\x1b[2S");
+    VERIFY_SUCCEEDED(engine->_ScrollUp(2));
+
+    qExpectedInput.push_back("\x1b[T");
+    VERIFY_SUCCEEDED(engine->_ScrollDown(1));
+
+    qExpectedInput.push_back("\x1b[2T");
+    VERIFY_SUCCEEDED(engine->_ScrollDown(2));
 }
 
 void VtRendererTest::Xterm256TestInvalidate()
@@ -325,7 +347,7 @@ void VtRendererTest::Xterm256TestInvalidate()
 
         VERIFY_ARE_EQUAL(invalid, engine->_invalidRect.ToExclusive());
 
-        qExpectedInput.push_back("\x1b[32;1H"); // Bottom of buffer
+        qExpectedInput.push_back("\x1b[31B"); // Bottom of buffer (same column - CUD beats CUP)
         qExpectedInput.push_back("\n"); // Scroll down once
         VERIFY_SUCCEEDED(engine->ScrollFrame());
     });
@@ -386,6 +408,70 @@ void VtRendererTest::Xterm256TestInvalidate()
     });
 }
 
+void VtRendererTest::Xterm256TestRegionScroll()
+{
+    wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+    std::unique_ptr<Xterm256Engine> engine = std::make_unique<Xterm256Engine>(std::move(hFile), p, SetUpViewport(), g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE));
+    auto pfn = std::bind(&VtRendererTest::WriteCallback, this, std::placeholders::_1, std::placeholders::_2);
+    engine->SetTestCallback(pfn);
+
+    // Verify the first paint emits a clear and go home
+    qExpectedInput.push_back("\x1b[2J");
+    VERIFY_IS_TRUE(engine->_firstPaint);
+    TestPaint(*engine, [&]() {
+        VERIFY_IS_FALSE(engine->_firstPaint);
+    });
+
+    Viewport view = SetUpViewport();
+
+    Log::Comment(NoThrowString().Format(
+        L"Scroll a full-width band up one line, like a pane scrolling would."));
+    // Rows 6-15 moved up onto rows 5-14, uncovering row 15.
+    SMALL_RECT source = { 0, 6, 80, 16 };
+    SMALL_RECT target = { 0, 5, 80, 15 };
+    SMALL_RECT fill = { 0, 15, 80, 16 };
+    VERIFY_SUCCEEDED(engine->InvalidateScrollRegion(source, target, fill));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"---- Only the uncovered row is invalid, the move is replayed with margins. ----"));
+        VERIFY_ARE_EQUAL(fill, engine->_invalidRect.ToExclusive());
+        qExpectedInput.push_back("\x1b[6;16r"); // Set margins around the band
+        qExpectedInput.push_back("\x1b[S"); // Scroll up within them
+        qExpectedInput.push_back("\x1b[r"); // Reset margins
+        VERIFY_SUCCEEDED(engine->ScrollFrame());
+    });
+
+    Log::Comment(NoThrowString().Format(
+        L"Repeated scrolls of the same band coalesce into one margin scroll."));
+    VERIFY_SUCCEEDED(engine->InvalidateScrollRegion(source, target, fill));
+    VERIFY_SUCCEEDED(engine->InvalidateScrollRegion(source, target, fill));
+    TestPaintXterm(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"---- The whole band went invalid (the first fill row moved), plus the new fill. ----"));
+        SMALL_RECT expectedInvalid = { 0, 5, 80, 16 };
+        VERIFY_ARE_EQUAL(expectedInvalid, engine->_invalidRect.ToExclusive());
+        qExpectedInput.push_back("\x1b[6;16r");
+        qExpectedInput.push_back("\x1b[2S");
+        qExpectedInput.push_back("\x1b[r");
+        VERIFY_SUCCEEDED(engine->ScrollFrame());
+    });
+
+    Log::Comment(NoThrowString().Format(
+        L"A partial-width move can't be expressed with margins - it falls back to repaint."));
+    SMALL_RECT paneSource = { 0, 6, 40, 16 };
+    SMALL_RECT paneTarget = { 0, 5, 40, 15 };
+    SMALL_RECT paneFill = { 0, 15, 40, 16 };
+    VERIFY_SUCCEEDED(engine->InvalidateScrollRegion(paneSource, paneTarget, paneFill));
+    TestPaint(*engine, [&]() {
+        Log::Comment(NoThrowString().Format(
+            L"---- Target and fill are invalid, no margin scroll is queued. ----"));
+        SMALL_RECT expectedInvalid = { 0, 5, 40, 16 };
+        VERIFY_ARE_EQUAL(expectedInvalid, engine->_invalidRect.ToExclusive());
+        VERIFY_ARE_EQUAL(static_cast<size_t>(0), engine->_regionScrolls.size());
+        VERIFY_SUCCEEDED(engine->ScrollFrame());
+    });
+}
+
 void VtRendererTest::Xterm256TestColors()
 {
     wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
@@ -503,7 +589,7 @@ void VtRendererTest::Xterm256TestCursor()
 
         Log::Comment(NoThrowString().Format(
             L"----Only move Y coord----"));
-        qExpectedInput.push_back("\x1b[31;2H");
+        qExpectedInput.push_back("\x1b[29B"); // Same column - CUD beats CUP
         VERIFY_SUCCEEDED(engine->_MoveCursor({ 1, 30 }));
 
         Log::Comment(NoThrowString().Format(
@@ -663,7 +749,7 @@ void VtRendererTest::XtermTestInvalidate()
 
         VERIFY_ARE_EQUAL(invalid, engine->_invalidRect.ToExclusive());
 
-        qExpectedInput.push_back("\x1b[32;1H"); // Bottom of buffer
+        qExpectedInput.push_back("\x1b[31B"); // Bottom of buffer (same column - CUD beats CUP)
         qExpectedInput.push_back("\n"); // Scroll down once
         VERIFY_SUCCEEDED(engine->ScrollFrame());
     });
@@ -810,7 +896,7 @@ void VtRendererTest::XtermTestCursor()
 
         Log::Comment(NoThrowString().Format(
             L"----Only move Y coord----"));
-        qExpectedInput.push_back("\x1b[31;2H");
+        qExpectedInput.push_back("\x1b[29B"); // Same column - CUD beats CUP
         VERIFY_SUCCEEDED(engine->_MoveCursor({ 1, 30 }));
 
         Log::Comment(NoThrowString().Format(
@@ -1191,3 +1277,127 @@ void VtRendererTest::TestResize()
         VERIFY_IS_FALSE(engine->_suppressResizeRepaint);
     });
 }
+
+// Method Description:
+// - Runs the canonical frame scenarios against one engine with a byte counter
+//   installed instead of the sequence-matching callback, and asserts each
+//   frame fits its budget. The budgets are deliberately loose - they're not
+//   asserting the exact optimal encoding, they're a tripwire for changes that
+//   regress the SGR-delta, cursor-planner or scroll-region optimizations back
+//   to per-cell attributes or full repaints. If a legitimate change trips
+//   one, re-derive the budget from the new actual size plus headroom; don't
+//   just bump it until it passes.
+// Arguments:
+// - engine: the engine to drive. Both xterm engines share the paint
+//   machinery, so the budgets cover the larger (RGB) encoding.
+// Return Value:
+// - <none>
+void VtRendererTest::TestByteBudgetScenarios(XtermEngine& engine)
+{
+    size_t cbFrame = 0;
+    engine.SetTestCallback([&](const char* const /*pch*/, size_t const cch) {
+        cbFrame += cch;
+        return true;
+    });
+
+    const std::wstring fullRow(80, L'X');
+    auto paintRow = [&](const short row, const std::wstring& line) {
+        std::vector<Cluster> clusters;
+        for (size_t i = 0; i < line.size(); i++)
+        {
+            clusters.emplace_back(std::wstring_view{ &line[i], 1 }, static_cast<size_t>(1));
+        }
+        VERIFY_SUCCEEDED(engine.PaintBufferLine({ clusters.data(), clusters.size() }, { 0, row }, false));
+    };
+
+    Log::Comment(NoThrowString().Format(
+        L"The first frame is a full 2J repaint by design - fill the viewport, no budget."));
+    VERIFY_SUCCEEDED(engine.InvalidateAll());
+    TestPaint(engine, [&]() {
+        for (short y = 0; y < 32; y++)
+        {
+            paintRow(y, fullRow);
+        }
+    });
+
+    Log::Comment(NoThrowString().Format(
+        L"---- Scroll one line: delete/newline plus one repainted row. ----"));
+    COORD scrollDelta = { 0, -1 };
+    VERIFY_SUCCEEDED(engine.InvalidateScroll(&scrollDelta));
+    cbFrame = 0;
+    TestPaint(engine, [&]() {
+        VERIFY_SUCCEEDED(engine.ScrollFrame());
+        paintRow(31, fullRow);
+    });
+    Log::Comment(NoThrowString().Format(L"scroll-one-line frame: %d bytes", static_cast<int>(cbFrame)));
+    // 80 bytes of glyphs plus a handful of cursor/scroll sequences. A frame
+    // that repaints the viewport instead would be ~2600 bytes.
+    VERIFY_IS_LESS_THAN_OR_EQUAL(cbFrame, static_cast<size_t>(200));
+
+    Log::Comment(NoThrowString().Format(
+        L"---- Retype a prompt: a small single-row invalid region. ----"));
+    SMALL_RECT prompt = { 0, 31, 15, 32 };
+    VERIFY_SUCCEEDED(engine.Invalidate(&prompt));
+    cbFrame = 0;
+    TestPaint(engine, [&]() {
+        paintRow(31, L"PS C:\\repo> dir");
+    });
+    Log::Comment(NoThrowString().Format(L"retype-prompt frame: %d bytes", static_cast<int>(cbFrame)));
+    // 15 bytes of glyphs plus one cursor move each way.
+    VERIFY_IS_LESS_THAN_OR_EQUAL(cbFrame, static_cast<size_t>(80));
+
+    Log::Comment(NoThrowString().Format(
+        L"---- tmux pane update: a full-width band scrolls with margins. ----"));
+    SMALL_RECT source = { 0, 6, 80, 16 };
+    SMALL_RECT target = { 0, 5, 80, 15 };
+    SMALL_RECT fill = { 0, 15, 80, 16 };
+    VERIFY_SUCCEEDED(engine.InvalidateScrollRegion(source, target, fill));
+    cbFrame = 0;
+    TestPaint(engine, [&]() {
+        VERIFY_SUCCEEDED(engine.ScrollFrame());
+        paintRow(15, fullRow);
+    });
+    Log::Comment(NoThrowString().Format(L"pane-update frame: %d bytes", static_cast<int>(cbFrame)));
+    // The margin scroll is ~13 bytes; the rest is the one uncovered row.
+    // Without the region-scroll path the whole band repaints at ~900 bytes.
+    VERIFY_IS_LESS_THAN_OR_EQUAL(cbFrame, static_cast<size_t>(250));
+
+    Log::Comment(NoThrowString().Format(
+        L"---- Full repaint with alternating row colors. ----"));
+    VERIFY_SUCCEEDED(engine.InvalidateAll());
+    cbFrame = 0;
+    TestPaint(engine, [&]() {
+        for (short y = 0; y < 32; y++)
+        {
+            // Colors off the 16-color table, so the 256 engine emits its
+            // longest (38;2/48;2) form - the worst case the budget covers.
+            const COLORREF fg = (y % 2) ? 0x00030201 : 0x000c0b0a;
+            const COLORREF bg = (y % 2) ? 0x00070605 : 0x00090807;
+            VERIFY_SUCCEEDED(engine.UpdateDrawingBrushes(fg, bg, 0, false, false));
+            paintRow(y, fullRow);
+        }
+    });
+    Log::Comment(NoThrowString().Format(L"full-color repaint frame: %d bytes", static_cast<int>(cbFrame)));
+    // 2560 bytes of glyphs, one SGR pair and one cursor move per row. If the
+    // SGR delta regressed to per-cell attributes this balloons past 40KB.
+    VERIFY_IS_LESS_THAN_OR_EQUAL(cbFrame, static_cast<size_t>(5000));
+}
+
+void VtRendererTest::TestByteBudgets()
+{
+    // The WinTelnet engine repaints on scroll by design, so only the xterm
+    // engines get budgets.
+    Log::Comment(NoThrowString().Format(L"=== Xterm256Engine ==="));
+    {
+        wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+        std::unique_ptr<Xterm256Engine> engine = std::make_unique<Xterm256Engine>(std::move(hFile), p, SetUpViewport(), g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE));
+        TestByteBudgetScenarios(*engine);
+    }
+
+    Log::Comment(NoThrowString().Format(L"=== XtermEngine ==="));
+    {
+        wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+        std::unique_ptr<XtermEngine> engine = std::make_unique<XtermEngine>(std::move(hFile), p, SetUpViewport(), g_ColorTable, static_cast<WORD>(COLOR_TABLE_SIZE), false);
+        TestByteBudgetScenarios(*engine);
+    }
+}
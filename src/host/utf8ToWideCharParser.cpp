@@ -10,6 +10,14 @@
 #error WIL exception helpers must be enabled
 #endif
 
+// The ASCII scan below uses SSE2 on x86/x64 (part of the baseline for those
+// architectures). Other architectures take the scalar path.
+#if defined(_M_X64) || defined(_M_IX86)
+#define UTF8PARSER_VECTORIZED_SCAN 1
+#include <emmintrin.h>
+#include <intrin.h>
+#endif
+
 #define IsBitSet WI_IsFlagSet
 
 const byte NonAsciiBytePrefix = 0x80;
@@ -19,6 +27,43 @@ const byte ContinuationBytePrefix = 0x80;
 
 const byte MostSignificantBitMask = 0x80;
 
+// Routine Description:
+// - Measures the run of ASCII-compatible bytes (most significant bit clear)
+// at the front of the buffer. Vectorized because conpty input chunks are
+// overwhelmingly pure ASCII and shouldn't pay a byte-at-a-time scan.
+// Arguments:
+// - pBytes - The byte sequence to scan.
+// - cb - The amount of bytes in pBytes.
+// Return Value:
+// - The number of leading ASCII bytes. cb if every byte is ASCII.
+static unsigned int _AsciiRunLength(_In_reads_(cb) const byte* const pBytes, const unsigned int cb)
+{
+    unsigned int i = 0;
+#ifdef UTF8PARSER_VECTORIZED_SCAN
+    // movemask collects the most significant bit of every byte in the lane,
+    // which is exactly the ASCII test.
+    for (; i + 16 <= cb; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBytes + i));
+        const unsigned int mask = _mm_movemask_epi8(v);
+        if (mask != 0)
+        {
+            unsigned long bit = 0;
+            _BitScanForward(&bit, mask);
+            return i + bit;
+        }
+    }
+#endif
+    for (; i < cb; ++i)
+    {
+        if (IsBitSet(pBytes[i], MostSignificantBitMask))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
 // Routine Description:
 // - Constructs an instance of the parser.
 // Arguments:
@@ -292,12 +337,29 @@ unsigned int Utf8ToWideCharParser::_Utf8SequenceSize(_In_ byte ch)
 // or 0 if pInputChars cannot be successfully converted.
 unsigned int Utf8ToWideCharParser::_ParseFullRange(_In_reads_(cb) const byte* const pInputChars, const unsigned int cb)
 {
+    // Fast path - a chunk of pure ASCII converts by widening each byte, with
+    // no MultiByteToWideChar round trips. Anything containing a multi-byte
+    // sequence falls through to the conversion below.
+    if (_AsciiRunLength(pInputChars, cb) == cb)
+    {
+        _convertedWideChars = std::make_unique<wchar_t[]>(cb);
+        std::copy(pInputChars, pInputChars + cb, _convertedWideChars.get());
+        _currentState = _State::Finished;
+        return cb;
+    }
+
+    // A UTF-8 sequence never produces more UTF-16 code units than it has
+    // source bytes, so size the output by that bound and convert in a single
+    // pass instead of scanning the whole input once just to measure it.
+    // MB_ERR_INVALID_CHARS stays on the converting call so a buffer ending in
+    // a partial sequence still routes through the involved parse.
+    std::unique_ptr<wchar_t[]> convertedWideChars = std::make_unique<wchar_t[]>(cb);
     int bufferSize = MultiByteToWideChar(_currentCodePage,
                                          MB_ERR_INVALID_CHARS,
                                          reinterpret_cast<LPCCH>(pInputChars),
                                          cb,
-                                         nullptr,
-                                         0);
+                                         convertedWideChars.get(),
+                                         cb);
     if (bufferSize == 0)
     {
         DWORD err = GetLastError();
@@ -313,22 +375,8 @@ unsigned int Utf8ToWideCharParser::_ParseFullRange(_In_reads_(cb) const byte* co
     }
     else
     {
-        _convertedWideChars = std::make_unique<wchar_t[]>(bufferSize);
-        bufferSize = MultiByteToWideChar(_currentCodePage,
-                                         0,
-                                         reinterpret_cast<LPCCH>(pInputChars),
-                                         cb,
-                                         _convertedWideChars.get(),
-                                         bufferSize);
-        if (bufferSize == 0)
-        {
-            LOG_LAST_ERROR();
-            _currentState = _State::Error;
-        }
-        else
-        {
-            _currentState = _State::Finished;
-        }
+        _convertedWideChars = std::move(convertedWideChars);
+        _currentState = _State::Finished;
     }
     return bufferSize;
 }
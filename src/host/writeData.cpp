@@ -117,7 +117,18 @@ bool WriteData::Notify(const WaitTerminationReason TerminationReason,
     // This routine should be called by a thread owning the same lock on the
     // same console as we're reading from.
 
-    FAIL_FAST_IF(!(Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked()));
+    const CONSOLE_INFORMATION& gci = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().getConsoleInformation();
+    FAIL_FAST_IF(!gci.IsConsoleLocked());
+
+    // If the output gate is still closed, stay waiting without touching the
+    // payload. Going through DoWriteConsole here would only have it snapshot
+    // the entire pending text into a brand new waiter for us to throw away -
+    // we already are that waiter, holding the text in its post-conversion W
+    // form. The flags can't change underneath us while we hold the lock.
+    if (WI_IsAnyFlagSet(gci.Flags, (CONSOLE_SUSPENDED | CONSOLE_SELECTING | CONSOLE_SCROLLBAR_TRACKING)))
+    {
+        return false;
+    }
 
     std::unique_ptr<WriteData> waiter;
     size_t cbContext = _cbContext;
@@ -128,7 +139,9 @@ bool WriteData::Notify(const WaitTerminationReason TerminationReason,
 
     if (Status == CONSOLE_STATUS_WAIT)
     {
-        // an extra waiter will be created by DoWriteConsole, but we're already a waiter so discard it.
+        // Raced with the gate closing again between our check and the write;
+        // DoWriteConsole made an extra waiter, but we're already a waiter so
+        // discard it.
         waiter.reset();
         return false;
     }
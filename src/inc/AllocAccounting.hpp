@@ -0,0 +1,138 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- AllocAccounting.hpp
+
+Abstract:
+- Opt-in per-subsystem heap accounting. When the build sets ALLOC_ACCOUNTING
+  (msbuild /p:AllocAccounting=true), conhost replaces the global allocator
+  (see host\allocAccounting.cpp) and every allocation is charged to the
+  subsystem currently on the thread: the parser, the text buffer, and the
+  renderers mark their entry points with an AllocScope, and everything else
+  lands in the Host bucket. Live count, live bytes, and running totals per
+  bucket flow out on the PerfCounterSnapshot cadence (see host\tracing.cpp)
+  and can be dumped from the window's system menu.
+- In normal builds every type here collapses to nothing, so the scope
+  markers can stay in the hot paths unconditionally.
+
+Author(s):
+- Adapted from the always-on counter tier in host\tracing.
+--*/
+
+#pragma once
+
+class AllocAccounting
+{
+public:
+    enum class Tag : size_t
+    {
+        Host = 0,
+        Parser,
+        Buffer,
+        Renderer,
+        Count
+    };
+
+#if defined(ALLOC_ACCOUNTING)
+    struct Snapshot
+    {
+        LONGLONG LiveCount;
+        LONGLONG LiveBytes;
+        LONGLONG TotalCount;
+        LONGLONG TotalBytes;
+    };
+
+    // Called from the replacement allocator; charge to the thread's scope.
+    static Tag s_CurrentTag() noexcept
+    {
+        return t_tag;
+    }
+
+    static void s_OnAllocate(const Tag tag, const size_t cb) noexcept
+    {
+        auto& counters = s_rgCounters[static_cast<size_t>(tag)];
+        InterlockedIncrement64(&counters.LiveCount);
+        InterlockedAdd64(&counters.LiveBytes, static_cast<LONGLONG>(cb));
+        InterlockedIncrement64(&counters.TotalCount);
+        InterlockedAdd64(&counters.TotalBytes, static_cast<LONGLONG>(cb));
+    }
+
+    static void s_OnFree(const Tag tag, const size_t cb) noexcept
+    {
+        auto& counters = s_rgCounters[static_cast<size_t>(tag)];
+        InterlockedDecrement64(&counters.LiveCount);
+        InterlockedAdd64(&counters.LiveBytes, -static_cast<LONGLONG>(cb));
+    }
+
+    static Snapshot s_GetSnapshot(const Tag tag) noexcept
+    {
+        const auto& counters = s_rgCounters[static_cast<size_t>(tag)];
+        Snapshot snapshot;
+        snapshot.LiveCount = ReadNoFence64(&counters.LiveCount);
+        snapshot.LiveBytes = ReadNoFence64(&counters.LiveBytes);
+        snapshot.TotalCount = ReadNoFence64(&counters.TotalCount);
+        snapshot.TotalBytes = ReadNoFence64(&counters.TotalBytes);
+        return snapshot;
+    }
+
+    static PCWSTR s_TagName(const Tag tag) noexcept
+    {
+        switch (tag)
+        {
+        case Tag::Parser:
+            return L"Parser";
+        case Tag::Buffer:
+            return L"Buffer";
+        case Tag::Renderer:
+            return L"Renderer";
+        default:
+            return L"Host";
+        }
+    }
+
+private:
+    friend class AllocScope;
+
+    // Padded to a cache line apiece so the subsystems don't false-share.
+    struct alignas(64) _TagCounters
+    {
+        LONGLONG LiveCount;
+        LONGLONG LiveBytes;
+        LONGLONG TotalCount;
+        LONGLONG TotalBytes;
+    };
+
+    static inline _TagCounters s_rgCounters[static_cast<size_t>(Tag::Count)];
+    static inline thread_local Tag t_tag = Tag::Host;
+#endif
+};
+
+// RAII subsystem marker. Placed at the entry point of a subsystem's work
+// (frame paint, VT parse, buffer write); allocations on this thread are
+// charged to the tag until the scope unwinds.
+class AllocScope
+{
+public:
+#if defined(ALLOC_ACCOUNTING)
+    AllocScope(const AllocAccounting::Tag tag) noexcept :
+        _previous(AllocAccounting::t_tag)
+    {
+        AllocAccounting::t_tag = tag;
+    }
+
+    ~AllocScope()
+    {
+        AllocAccounting::t_tag = _previous;
+    }
+
+private:
+    const AllocAccounting::Tag _previous;
+#else
+    AllocScope(const AllocAccounting::Tag /*tag*/) noexcept {}
+#endif
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
@@ -9,11 +9,13 @@ enum class VtIoMode
     XTERM,
     XTERM_256,
     WIN_TELNET,
-    XTERM_ASCII
+    XTERM_ASCII,
+    BINARY
 };
 
 const wchar_t* const XTERM_STRING = L"xterm";
 const wchar_t* const XTERM_256_STRING = L"xterm-256color";
 const wchar_t* const WIN_TELNET_STRING = L"win-telnet";
 const wchar_t* const XTERM_ASCII_STRING = L"xterm-ascii";
+const wchar_t* const BINARY_STRING = L"binary";
 const wchar_t* const DEFAULT_STRING = L"";
@@ -0,0 +1,83 @@
+//
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+//
+// The binary frame protocol used between a headless conhost and the terminal
+//      that owns it when the "binary" VtIoMode is negotiated. In the text
+//      modes, conhost serializes its buffer into VT sequences that the
+//      terminal's state machine immediately re-parses back into an identical
+//      buffer - an encode+reparse we pay on every frame. In binary mode the
+//      BinaryEngine emits these packed records instead, and the terminal
+//      applies them directly to its TextBuffer, skipping both the VT
+//      serializer and the parser.
+// The stream opens with a fixed preamble whose first byte is NUL - a byte
+//      that can never start VT text output - so the receiving terminal can
+//      tell a binary conhost from a text one without any side channel.
+//      Anything without a natural record shape (OSC title changes, client
+//      passthrough) rides in a VtPassthrough record and goes through the
+//      terminal's state machine as usual, so no fidelity is lost.
+// Records are framed by a RecordHeader giving the payload size, so a reader
+//      can skip record types it doesn't know.
+
+#include <windows.h>
+#pragma once
+
+namespace Microsoft::Console::ConptyBinary
+{
+    // "\0cpb1\r\n\0" - NUL first so no VT text stream can collide with it,
+    //      and \r\n to catch transports that mangle line endings. Bump the
+    //      digit if the record layout ever changes.
+    constexpr char Preamble[] = { '\0', 'c', 'p', 'b', '1', '\r', '\n', '\0' };
+    constexpr size_t PreambleLength = sizeof(Preamble);
+
+    enum class RecordType : BYTE
+    {
+        BeginFrame = 1, // payload: BeginFramePayload
+        CellRun, // payload: CellRunPayload + cchText UTF-16LE code units
+        Scroll, // payload: ScrollPayload
+        CursorPosition, // payload: CursorPositionPayload
+        VtPassthrough, // payload: UTF-8 text for the receiver's VT parser
+        EndFrame // no payload
+    };
+
+    // The records travel between processes as raw bytes, so their layout has
+    //      to be exact - no padding.
+#pragma pack(push, 1)
+
+    struct RecordHeader
+    {
+        BYTE Type; // one of RecordType
+        DWORD cbPayload; // bytes of payload following this header
+    };
+
+    struct BeginFramePayload
+    {
+        SHORT Width; // the emitter's viewport dimensions, in characters
+        SHORT Height;
+    };
+
+    constexpr BYTE CellRunFlagBold = 0x01;
+
+    struct CellRunPayload
+    {
+        SHORT X; // viewport-relative target of the run's first cell
+        SHORT Y;
+        COLORREF Foreground; // RGB colors the run should be painted with
+        COLORREF Background;
+        BYTE Flags; // CellRunFlag* bits
+        USHORT cchText; // UTF-16LE code units following this struct
+    };
+
+    struct ScrollPayload
+    {
+        SHORT Delta; // rows the viewport content moved; negative is up
+    };
+
+    struct CursorPositionPayload
+    {
+        SHORT X; // viewport-relative
+        SHORT Y;
+    };
+
+#pragma pack(pop)
+}
@@ -0,0 +1,338 @@
+//
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+//
+// A single-producer/single-consumer shared-memory ring used as the fast path
+//      for conpty output. The terminal creates the ring alongside the pipes in
+//      CreateConPty and passes the (inheritable) section and event handles to
+//      conhost on its commandline. conhost's VT renderer then copies each
+//      frame into the ring instead of writing it to the output pipe - one
+//      cross-process copy and no syscall per chunk. The output pipe stays open
+//      for liveness probing and as the fallback transport whenever the ring
+//      can't be negotiated.
+// The protocol is deliberately minimal: two monotonic 64-bit byte counters in
+//      the control block, an auto-reset event each way for "data arrived" and
+//      "space freed". There is no EOF in the ring itself - the consumer
+//      detects the producer's death by also waiting on the conhost process
+//      handle.
+
+#include <windows.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#pragma once
+
+namespace Microsoft::Console::ConptyRing
+{
+    // "cpr0" - bump this if the control block layout ever changes.
+    constexpr DWORD RingSignature = 0x30727063;
+
+    // Large enough to absorb several frames of VT output from a fast client
+    //      before the producer ever has to wait on the consumer.
+    constexpr DWORD DefaultCapacity = 1024 * 1024;
+
+    // The control block at the front of the shared section; the payload bytes
+    //      follow immediately after it. WritePos and ReadPos only ever grow
+    //      (offset into the payload = pos % Capacity), so full and empty are
+    //      unambiguous without a wasted slot, and at 64 bits they never wrap.
+    //      Each position gets its own cache line - they're written by
+    //      different processes.
+    struct RingHeader
+    {
+        DWORD Signature;
+        DWORD Capacity;
+        alignas(64) std::atomic<ULONG64> WritePos;
+        alignas(64) std::atomic<ULONG64> ReadPos;
+    };
+
+    static_assert(std::atomic<ULONG64>::is_always_lock_free,
+                  "the ring positions must be plain interlocked accesses to be shared across processes");
+
+    // The raw handles describing one ring, as created by CreateRing. The
+    //      caller owns them.
+    struct RingHandles
+    {
+        HANDLE Section = nullptr; // the section holding a RingHeader + payload
+        HANDLE DataReady = nullptr; // auto-reset; set by the producer after publishing bytes
+        HANDLE SpaceAvailable = nullptr; // auto-reset; set by the consumer after freeing bytes
+    };
+
+    // Function Description:
+    // - Creates the shared section and signaling events for one output ring
+    //      and initializes the ring's control block.
+    // Arguments:
+    // - capacity: the number of payload bytes the ring should hold.
+    // - inheritable: whether to mark the handles inheritable, so their values
+    //      can be passed to a child conhost on its commandline.
+    // - handles: receives the raw section and event handles on success.
+    // Return Value:
+    // - S_OK if the ring was created, otherwise an appropriate HRESULT.
+    [[nodiscard]] inline HRESULT CreateRing(const DWORD capacity, const bool inheritable, RingHandles& handles) noexcept
+    {
+        SECURITY_ATTRIBUTES sa;
+        sa = { 0 };
+        sa.nLength = sizeof(sa);
+        sa.bInheritHandle = inheritable;
+        sa.lpSecurityDescriptor = nullptr;
+
+        const DWORD cbSection = sizeof(RingHeader) + capacity;
+        HANDLE section = CreateFileMappingW(INVALID_HANDLE_VALUE, &sa, PAGE_READWRITE, 0, cbSection, nullptr);
+        if (section == nullptr)
+        {
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        // The section comes back zero-filled, so the positions already read
+        //      as empty; we only need to stamp the signature and capacity.
+        void* const view = MapViewOfFile(section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (view == nullptr)
+        {
+            const HRESULT hr = HRESULT_FROM_WIN32(GetLastError());
+            CloseHandle(section);
+            return hr;
+        }
+
+        RingHeader* const header = static_cast<RingHeader*>(view);
+        header->Capacity = capacity;
+        header->Signature = RingSignature;
+        UnmapViewOfFile(view);
+
+        HANDLE dataReady = CreateEventW(&sa, FALSE, FALSE, nullptr);
+        HANDLE spaceAvailable = CreateEventW(&sa, FALSE, FALSE, nullptr);
+        if (dataReady == nullptr || spaceAvailable == nullptr)
+        {
+            const HRESULT hr = HRESULT_FROM_WIN32(GetLastError());
+            if (dataReady != nullptr)
+            {
+                CloseHandle(dataReady);
+            }
+            if (spaceAvailable != nullptr)
+            {
+                CloseHandle(spaceAvailable);
+            }
+            CloseHandle(section);
+            return hr;
+        }
+
+        handles.Section = section;
+        handles.DataReady = dataReady;
+        handles.SpaceAvailable = spaceAvailable;
+        return S_OK;
+    }
+
+    // Function Description:
+    // - Maps the given ring section and validates its control block before
+    //      either side starts trusting it.
+    // Arguments:
+    // - section: a section handle as produced by CreateRing.
+    // - ppHeader: receives the mapped control block on success.
+    // Return Value:
+    // - S_OK if the ring was mapped and looked sane, otherwise an appropriate
+    //      HRESULT.
+    [[nodiscard]] inline HRESULT MapRing(const HANDLE section, RingHeader** const ppHeader) noexcept
+    {
+        *ppHeader = nullptr;
+
+        void* const view = MapViewOfFile(section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (view == nullptr)
+        {
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        RingHeader* const header = static_cast<RingHeader*>(view);
+
+        // Make sure the creator's idea of the ring matches ours, and that the
+        //      advertised capacity actually fits inside the mapped region.
+        MEMORY_BASIC_INFORMATION mbi;
+        mbi = { 0 };
+        if (VirtualQuery(view, &mbi, sizeof(mbi)) == 0 ||
+            header->Signature != RingSignature ||
+            header->Capacity == 0 ||
+            mbi.RegionSize < sizeof(RingHeader) + header->Capacity)
+        {
+            UnmapViewOfFile(view);
+            return E_INVALIDARG;
+        }
+
+        *ppHeader = header;
+        return S_OK;
+    }
+
+    // The writing (conhost) side of the ring. Does not own the handles it's
+    //      initialized with - the caller must keep them alive for the
+    //      Producer's lifetime.
+    class Producer
+    {
+    public:
+        Producer() = default;
+        ~Producer()
+        {
+            if (_header != nullptr)
+            {
+                UnmapViewOfFile(_header);
+            }
+        }
+        Producer(const Producer&) = delete;
+        Producer& operator=(const Producer&) = delete;
+
+        [[nodiscard]] HRESULT Initialize(const HANDLE section, const HANDLE dataReady, const HANDLE spaceAvailable) noexcept
+        {
+            if (_header != nullptr)
+            {
+                return E_UNEXPECTED;
+            }
+
+            const HRESULT hr = MapRing(section, &_header);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+
+            _dataReady = dataReady;
+            _spaceAvailable = spaceAvailable;
+            return S_OK;
+        }
+
+        bool IsInitialized() const noexcept
+        {
+            return _header != nullptr;
+        }
+
+        // Method Description:
+        // - Copies bytes into the ring, waiting on the consumer whenever it's
+        //      full. If the consumer frees no space for dwStallTimeout
+        //      milliseconds, returns HRESULT_FROM_WIN32(ERROR_TIMEOUT) with
+        //      *pcbWritten holding the progress made so far - the caller can
+        //      check whether the consumer is still alive and resume the write
+        //      from that offset.
+        // Arguments:
+        // - pData: the bytes to publish.
+        // - cb: how many of them there are.
+        // - dwStallTimeout: how long to wait on a full ring before giving the
+        //      caller a chance to intervene.
+        // - pcbWritten: receives the number of bytes published by this call.
+        // Return Value:
+        // - S_OK once everything is published, ERROR_TIMEOUT as an HRESULT on
+        //      a stall, otherwise an appropriate HRESULT.
+        [[nodiscard]] HRESULT Write(_In_reads_(cb) const char* const pData, const size_t cb, const DWORD dwStallTimeout, _Out_ size_t* const pcbWritten) noexcept
+        {
+            *pcbWritten = 0;
+            while (*pcbWritten < cb)
+            {
+                const ULONG64 readPos = _header->ReadPos.load(std::memory_order_acquire);
+                const ULONG64 writePos = _header->WritePos.load(std::memory_order_relaxed);
+                const size_t cbFree = _header->Capacity - static_cast<size_t>(writePos - readPos);
+                if (cbFree == 0)
+                {
+                    if (WaitForSingleObject(_spaceAvailable, dwStallTimeout) != WAIT_OBJECT_0)
+                    {
+                        return HRESULT_FROM_WIN32(ERROR_TIMEOUT);
+                    }
+                    continue;
+                }
+
+                const size_t cbChunk = std::min(cb - *pcbWritten, cbFree);
+                const size_t offset = static_cast<size_t>(writePos % _header->Capacity);
+                const size_t cbToEnd = std::min(cbChunk, _header->Capacity - offset);
+                memcpy(_Payload() + offset, pData + *pcbWritten, cbToEnd);
+                memcpy(_Payload(), pData + *pcbWritten + cbToEnd, cbChunk - cbToEnd);
+
+                _header->WritePos.store(writePos + cbChunk, std::memory_order_release);
+                SetEvent(_dataReady);
+                *pcbWritten += cbChunk;
+            }
+            return S_OK;
+        }
+
+    private:
+        char* _Payload() const noexcept
+        {
+            return reinterpret_cast<char*>(_header) + sizeof(RingHeader);
+        }
+
+        RingHeader* _header = nullptr;
+        HANDLE _dataReady = nullptr;
+        HANDLE _spaceAvailable = nullptr;
+    };
+
+    // The reading (terminal) side of the ring. Does not own the handles it's
+    //      initialized with. Read never blocks - the caller decides what to
+    //      wait on (typically the DataReady event together with the conhost
+    //      process handle) when the ring comes up empty.
+    class Consumer
+    {
+    public:
+        Consumer() = default;
+        ~Consumer()
+        {
+            if (_header != nullptr)
+            {
+                UnmapViewOfFile(_header);
+            }
+        }
+        Consumer(const Consumer&) = delete;
+        Consumer& operator=(const Consumer&) = delete;
+
+        [[nodiscard]] HRESULT Initialize(const HANDLE section, const HANDLE dataReady, const HANDLE spaceAvailable) noexcept
+        {
+            if (_header != nullptr)
+            {
+                return E_UNEXPECTED;
+            }
+
+            const HRESULT hr = MapRing(section, &_header);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+
+            _dataReady = dataReady;
+            _spaceAvailable = spaceAvailable;
+            return S_OK;
+        }
+
+        bool IsInitialized() const noexcept
+        {
+            return _header != nullptr;
+        }
+
+        // Method Description:
+        // - Copies up to cb ring bytes into pBuffer without blocking and
+        //      frees the space they occupied.
+        // Arguments:
+        // - pBuffer: where to copy the bytes.
+        // - cb: the most bytes the buffer can take.
+        // Return Value:
+        // - the number of bytes copied; 0 if the ring was empty.
+        size_t Read(_Out_writes_to_(cb, return) char* const pBuffer, const size_t cb) noexcept
+        {
+            const ULONG64 writePos = _header->WritePos.load(std::memory_order_acquire);
+            const ULONG64 readPos = _header->ReadPos.load(std::memory_order_relaxed);
+            const size_t cbAvailable = static_cast<size_t>(writePos - readPos);
+            if (cbAvailable == 0 || cb == 0)
+            {
+                return 0;
+            }
+
+            const size_t cbChunk = std::min(cbAvailable, cb);
+            const size_t offset = static_cast<size_t>(readPos % _header->Capacity);
+            const size_t cbToEnd = std::min(cbChunk, _header->Capacity - offset);
+            memcpy(pBuffer, _Payload() + offset, cbToEnd);
+            memcpy(pBuffer + cbToEnd, _Payload(), cbChunk - cbToEnd);
+
+            _header->ReadPos.store(readPos + cbChunk, std::memory_order_release);
+            SetEvent(_spaceAvailable);
+            return cbChunk;
+        }
+
+    private:
+        char* _Payload() const noexcept
+        {
+            return reinterpret_cast<char*>(_header) + sizeof(RingHeader);
+        }
+
+        RingHeader* _header = nullptr;
+        HANDLE _dataReady = nullptr;
+        HANDLE _spaceAvailable = nullptr;
+    };
+}
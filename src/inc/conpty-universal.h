@@ -26,6 +26,7 @@
 #include <sstream>
 #include <strsafe.h>
 #include <memory>
+#include "conpty-ring.h"
 #pragma once
 
 const unsigned int PTY_SIGNAL_RESIZE_WINDOW = 8u;
@@ -209,6 +210,14 @@ bool SignalResizeWindow(const HANDLE hSignal,
 // - extraEnvVars : A map of pairs of (Name, Value) representing additional
 //      environment variable strings and values to be set in the client process
 //      environment.  May override any already present in parent process.
+// - pOutputRing: if non-null, we'll also try to create a shared-memory output
+//      ring (see conpty-ring.h) and offer it to the conhost; on success the
+//      caller receives the handles here and should read output from the ring,
+//      falling back to hOutput when no ring was negotiated. The ring is purely
+//      an optimization - failing to create one is not an error.
+// - pwszVtMode: if non-null, the VtIoMode to request from the conhost via
+//      --vtmode - e.g. L"binary" for the record stream in conpty-binary.h.
+//      When null, the conhost uses its default (xterm-256color).
 // Return Value:
 // - S_OK if we succeeded, or an appropriate HRESULT for failing format the
 //      commandline or failing to launch the conhost
@@ -221,7 +230,9 @@ bool SignalResizeWindow(const HANDLE hSignal,
                                                                HANDLE* const hSignal,
                                                                PROCESS_INFORMATION* const piPty,
                                                                DWORD dwCreationFlags = 0,
-                                                               const EnvironmentVariableMapW& extraEnvVars = {}) noexcept
+                                                               const EnvironmentVariableMapW& extraEnvVars = {},
+                                                               Microsoft::Console::ConptyRing::RingHandles* const pOutputRing = nullptr,
+                                                               const wchar_t* const pwszVtMode = nullptr) noexcept
 {
     // Create some anon pipes so we can pass handles down and into the console.
     // IMPORTANT NOTE:
@@ -254,6 +265,27 @@ bool SignalResizeWindow(const HANDLE hSignal,
     SetHandleInformation(outPipeConhostSide, HANDLE_FLAG_INHERIT, 1);
     SetHandleInformation(signalPipeConhostSide, HANDLE_FLAG_INHERIT, 1);
 
+    // Optionally create the shared-memory output ring. The handles are
+    //      created inheritable, like the conhost ends of the pipes, so their
+    //      values can be passed to the conhost on its commandline. Unlike the
+    //      pipes there's only one set of objects - both sides share them.
+    Microsoft::Console::ConptyRing::RingHandles outputRing;
+    bool fRingCreated = false;
+    if (pOutputRing != nullptr)
+    {
+        fRingCreated = SUCCEEDED(Microsoft::Console::ConptyRing::CreateRing(Microsoft::Console::ConptyRing::DefaultCapacity,
+                                                                            true /*inheritable*/,
+                                                                            outputRing));
+    }
+    auto cleanupRing = wil::scope_exit([&] {
+        if (fRingCreated)
+        {
+            CloseHandle(outputRing.Section);
+            CloseHandle(outputRing.DataReady);
+            CloseHandle(outputRing.SpaceAvailable);
+        }
+    });
+
     std::wstring conhostCmdline = L"conhost.exe";
     conhostCmdline += L" --headless";
     std::wstringstream ss;
@@ -264,6 +296,16 @@ bool SignalResizeWindow(const HANDLE hSignal,
     }
 
     ss << L" --signal 0x" << std::hex << HandleToUlong(signalPipeConhostSide);
+    if (pwszVtMode != nullptr)
+    {
+        ss << L" --vtmode " << pwszVtMode;
+    }
+    if (fRingCreated)
+    {
+        ss << L" --outputring 0x" << std::hex << HandleToUlong(outputRing.Section);
+        ss << L" --outputringdata 0x" << std::hex << HandleToUlong(outputRing.DataReady);
+        ss << L" --outputringspace 0x" << std::hex << HandleToUlong(outputRing.SpaceAvailable);
+    }
     conhostCmdline += ss.str();
     conhostCmdline += L" -- ";
     conhostCmdline += cmdline;
@@ -332,6 +374,12 @@ bool SignalResizeWindow(const HANDLE hSignal,
     CloseHandle(outPipeConhostSide);
     CloseHandle(signalPipeConhostSide);
 
+    if (fSuccess && fRingCreated)
+    {
+        cleanupRing.release();
+        *pOutputRing = outputRing;
+    }
+
     return fSuccess ? S_OK : HRESULT_FROM_WIN32(GetLastError());
 }
 
@@ -0,0 +1,458 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- containers.hpp
+
+Abstract:
+- Shared containers for the hot paths of the console host and renderers.
+- These exist so the allocation-sensitive code in the input buffer, the
+  attribute rows, and the renderers leans on one audited implementation
+  instead of hand-rolling the same patterns per module. They deliberately
+  support only trivially copyable element types: every consumer stores raw
+  records (INPUT_RECORD, SMALL_RECT, TextAttributeRun), and the restriction
+  keeps growth and erasure down to memcpy/memmove with no exception-safety
+  corner cases to audit.
+
+Author(s):
+- Extracted from the storage patterns in InputBuffer and ATTR_ROW.
+--*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Microsoft::Console::Containers
+{
+    // A contiguous vector with inline storage for the first N elements.
+    // The common case (an attribute row with a handful of runs, a few dirty
+    // rectangles) never touches the heap; only growth past N allocates.
+    // Iterators are plain pointers, so the standard algorithms and
+    // pointer-difference index math work unchanged.
+    template<typename T, size_t N>
+    class small_vector
+    {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "small_vector moves elements with memcpy; the element type must be trivially copyable");
+        static_assert(N > 0, "small_vector requires at least one inline element");
+
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        small_vector() noexcept :
+            _data(_InlineData()),
+            _size(0),
+            _capacity(N)
+        {
+        }
+
+        small_vector(const small_vector& other) :
+            small_vector()
+        {
+            assign(other.cbegin(), other.cend());
+        }
+
+        small_vector(small_vector&& other) noexcept :
+            small_vector()
+        {
+            _TakeFrom(other);
+        }
+
+        small_vector& operator=(const small_vector& other)
+        {
+            if (this != &other)
+            {
+                assign(other.cbegin(), other.cend());
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                _ReleaseHeap();
+                _data = _InlineData();
+                _size = 0;
+                _capacity = N;
+                _TakeFrom(other);
+            }
+            return *this;
+        }
+
+        ~small_vector()
+        {
+            _ReleaseHeap();
+        }
+
+        iterator begin() noexcept { return _data; }
+        const_iterator begin() const noexcept { return _data; }
+        const_iterator cbegin() const noexcept { return _data; }
+        iterator end() noexcept { return _data + _size; }
+        const_iterator end() const noexcept { return _data + _size; }
+        const_iterator cend() const noexcept { return _data + _size; }
+
+        T* data() noexcept { return _data; }
+        const T* data() const noexcept { return _data; }
+
+        bool empty() const noexcept { return _size == 0; }
+        size_type size() const noexcept { return _size; }
+        size_type capacity() const noexcept { return _capacity; }
+
+        reference operator[](const size_type index) noexcept { return _data[index]; }
+        const_reference operator[](const size_type index) const noexcept { return _data[index]; }
+
+        reference at(const size_type index)
+        {
+            if (index >= _size)
+            {
+                throw std::out_of_range("small_vector::at");
+            }
+            return _data[index];
+        }
+
+        const_reference at(const size_type index) const
+        {
+            if (index >= _size)
+            {
+                throw std::out_of_range("small_vector::at");
+            }
+            return _data[index];
+        }
+
+        reference front() noexcept { return _data[0]; }
+        const_reference front() const noexcept { return _data[0]; }
+        reference back() noexcept { return _data[_size - 1]; }
+        const_reference back() const noexcept { return _data[_size - 1]; }
+
+        void clear() noexcept { _size = 0; }
+
+        void reserve(const size_type newCapacity)
+        {
+            if (newCapacity > _capacity)
+            {
+                _Grow(newCapacity);
+            }
+        }
+
+        void resize(const size_type newSize)
+        {
+            resize(newSize, T{});
+        }
+
+        void resize(const size_type newSize, const T& value)
+        {
+            reserve(newSize);
+            for (size_type i = _size; i < newSize; i++)
+            {
+                _data[i] = value;
+            }
+            _size = newSize;
+        }
+
+        void push_back(const T& value)
+        {
+            if (_size == _capacity)
+            {
+                _Grow(_size + 1);
+            }
+            _data[_size++] = value;
+        }
+
+        template<typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            push_back(T(std::forward<Args>(args)...));
+            return back();
+        }
+
+        void pop_back() noexcept
+        {
+            --_size;
+        }
+
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            insert(cend(), first, last);
+        }
+
+        template<typename InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            const size_type index = pos - cbegin();
+            const size_type count = static_cast<size_type>(std::distance(first, last));
+            if (_size + count > _capacity)
+            {
+                _Grow(_size + count);
+            }
+            memmove(_data + index + count, _data + index, (_size - index) * sizeof(T));
+            for (size_type i = index; first != last; ++first, i++)
+            {
+                _data[i] = *first;
+            }
+            _size += count;
+            return _data + index;
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            const size_type index = first - cbegin();
+            const size_type count = last - first;
+            memmove(_data + index, _data + index + count, (_size - index - count) * sizeof(T));
+            _size -= count;
+            return _data + index;
+        }
+
+    private:
+        T* _InlineData() noexcept
+        {
+            return reinterpret_cast<T*>(&_inlineStorage);
+        }
+
+        void _ReleaseHeap() noexcept
+        {
+            if (_data != _InlineData())
+            {
+                ::operator delete(_data);
+            }
+        }
+
+        void _TakeFrom(small_vector& other) noexcept
+        {
+            if (other._data != other._InlineData())
+            {
+                // Steal the heap allocation outright.
+                _data = other._data;
+                _size = other._size;
+                _capacity = other._capacity;
+                other._data = other._InlineData();
+                other._size = 0;
+                other._capacity = N;
+            }
+            else
+            {
+                memcpy(_InlineData(), other._data, other._size * sizeof(T));
+                _size = other._size;
+                other._size = 0;
+            }
+        }
+
+        void _Grow(const size_type neededCapacity)
+        {
+            size_type newCapacity = _capacity * 2;
+            if (newCapacity < neededCapacity)
+            {
+                newCapacity = neededCapacity;
+            }
+
+            T* const newData = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+            memcpy(newData, _data, _size * sizeof(T));
+            _ReleaseHeap();
+            _data = newData;
+            _capacity = newCapacity;
+        }
+
+        typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type _inlineStorage;
+        T* _data;
+        size_type _size;
+        size_type _capacity;
+    };
+
+    // A growable ring buffer: a FIFO queue over one contiguous power-of-two
+    // allocation. Unlike std::deque there is no block map, no per-block
+    // allocation churn as elements cycle through, and steady-state
+    // push/pop touches exactly one slot. Random access iterators are
+    // provided so the standard erase-remove idiom works for mid-queue
+    // removal (flushing a class of events).
+    template<typename T>
+    class ring_buffer
+    {
+    public:
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "ring_buffer moves elements with assignment and memcpy; the element type must be trivially copyable");
+
+        using value_type = T;
+        using size_type = size_t;
+
+        template<typename Ring, typename Value>
+        class ring_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = Value;
+            using difference_type = ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            ring_iterator() noexcept :
+                _ring(nullptr),
+                _index(0) {}
+
+            ring_iterator(Ring* const ring, const size_type index) noexcept :
+                _ring(ring),
+                _index(index) {}
+
+            reference operator*() const noexcept { return (*_ring)[_index]; }
+            pointer operator->() const noexcept { return &(*_ring)[_index]; }
+            reference operator[](const difference_type offset) const noexcept { return (*_ring)[_index + offset]; }
+
+            ring_iterator& operator++() noexcept { ++_index; return *this; }
+            ring_iterator operator++(int) noexcept { ring_iterator tmp = *this; ++_index; return tmp; }
+            ring_iterator& operator--() noexcept { --_index; return *this; }
+            ring_iterator operator--(int) noexcept { ring_iterator tmp = *this; --_index; return tmp; }
+            ring_iterator& operator+=(const difference_type offset) noexcept { _index += offset; return *this; }
+            ring_iterator& operator-=(const difference_type offset) noexcept { _index -= offset; return *this; }
+            ring_iterator operator+(const difference_type offset) const noexcept { return ring_iterator(_ring, _index + offset); }
+            ring_iterator operator-(const difference_type offset) const noexcept { return ring_iterator(_ring, _index - offset); }
+            difference_type operator-(const ring_iterator& other) const noexcept { return _index - other._index; }
+
+            bool operator==(const ring_iterator& other) const noexcept { return _index == other._index; }
+            bool operator!=(const ring_iterator& other) const noexcept { return _index != other._index; }
+            bool operator<(const ring_iterator& other) const noexcept { return _index < other._index; }
+            bool operator>(const ring_iterator& other) const noexcept { return _index > other._index; }
+            bool operator<=(const ring_iterator& other) const noexcept { return _index <= other._index; }
+            bool operator>=(const ring_iterator& other) const noexcept { return _index >= other._index; }
+
+            size_type index() const noexcept { return _index; }
+
+        private:
+            Ring* _ring;
+            size_type _index;
+        };
+
+        using iterator = ring_iterator<ring_buffer, T>;
+        using const_iterator = ring_iterator<const ring_buffer, const T>;
+
+        ring_buffer() noexcept :
+            _data(nullptr),
+            _capacity(0),
+            _head(0),
+            _size(0)
+        {
+        }
+
+        ring_buffer(const ring_buffer&) = delete;
+        ring_buffer& operator=(const ring_buffer&) = delete;
+
+        ~ring_buffer()
+        {
+            ::operator delete(_data);
+        }
+
+        bool empty() const noexcept { return _size == 0; }
+        size_type size() const noexcept { return _size; }
+
+        T& operator[](const size_type index) noexcept { return _data[(_head + index) & (_capacity - 1)]; }
+        const T& operator[](const size_type index) const noexcept { return _data[(_head + index) & (_capacity - 1)]; }
+
+        T& front() noexcept { return (*this)[0]; }
+        const T& front() const noexcept { return (*this)[0]; }
+        T& back() noexcept { return (*this)[_size - 1]; }
+        const T& back() const noexcept { return (*this)[_size - 1]; }
+
+        iterator begin() noexcept { return iterator(this, 0); }
+        iterator end() noexcept { return iterator(this, _size); }
+        const_iterator begin() const noexcept { return const_iterator(this, 0); }
+        const_iterator end() const noexcept { return const_iterator(this, _size); }
+        const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+        const_iterator cend() const noexcept { return const_iterator(this, _size); }
+
+        void clear() noexcept
+        {
+            _head = 0;
+            _size = 0;
+        }
+
+        void push_back(const T& value)
+        {
+            if (_size == _capacity)
+            {
+                _Grow();
+            }
+            _data[(_head + _size) & (_capacity - 1)] = value;
+            ++_size;
+        }
+
+        void push_front(const T& value)
+        {
+            if (_size == _capacity)
+            {
+                _Grow();
+            }
+            _head = (_head - 1) & (_capacity - 1);
+            _data[_head] = value;
+            ++_size;
+        }
+
+        void pop_front() noexcept
+        {
+            _head = (_head + 1) & (_capacity - 1);
+            --_size;
+        }
+
+        void pop_back() noexcept
+        {
+            --_size;
+        }
+
+        // Removes [first, last), closing the gap by shifting the tail
+        // forward. Used by the erase-remove idiom; removal is rare next to
+        // push/pop so the shift cost is acceptable.
+        iterator erase(const iterator first, const iterator last)
+        {
+            const size_type start = first.index();
+            const size_type count = last.index() - start;
+            for (size_type i = start; i + count < _size; i++)
+            {
+                (*this)[i] = (*this)[i + count];
+            }
+            _size -= count;
+            return iterator(this, start);
+        }
+
+    private:
+        static const size_type sc_initialCapacity = 32;
+
+        void _Grow()
+        {
+            const size_type newCapacity = _capacity == 0 ? sc_initialCapacity : _capacity * 2;
+            T* const newData = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+
+            // Unroll the ring into the front of the new allocation.
+            for (size_type i = 0; i < _size; i++)
+            {
+                newData[i] = (*this)[i];
+            }
+
+            ::operator delete(_data);
+            _data = newData;
+            _capacity = newCapacity;
+            _head = 0;
+        }
+
+        T* _data;
+        size_type _capacity;
+        size_type _head;
+        size_type _size;
+    };
+}
@@ -127,12 +127,7 @@ void ServiceLocator::RundownAndExit(const HRESULT hr)
 
 #pragma region Location Methods
 
-IConsoleWindow* ServiceLocator::LocateConsoleWindow()
-{
-    return s_consoleWindow;
-}
-
-IConsoleControl* ServiceLocator::LocateConsoleControl()
+IConsoleControl* ServiceLocator::LoadConsoleControl()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -154,12 +149,7 @@ IConsoleControl* ServiceLocator::LocateConsoleControl()
     return s_consoleControl.get();
 }
 
-IConsoleInputThread* ServiceLocator::LocateConsoleInputThread()
-{
-    return s_consoleInputThread.get();
-}
-
-IHighDpiApi* ServiceLocator::LocateHighDpiApi()
+IHighDpiApi* ServiceLocator::LoadHighDpiApi()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -181,7 +171,7 @@ IHighDpiApi* ServiceLocator::LocateHighDpiApi()
     return s_highDpiApi.get();
 }
 
-IWindowMetrics* ServiceLocator::LocateWindowMetrics()
+IWindowMetrics* ServiceLocator::LoadWindowMetrics()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -203,7 +193,7 @@ IWindowMetrics* ServiceLocator::LocateWindowMetrics()
     return s_windowMetrics.get();
 }
 
-IAccessibilityNotifier* ServiceLocator::LocateAccessibilityNotifier()
+IAccessibilityNotifier* ServiceLocator::LoadAccessibilityNotifier()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -225,7 +215,7 @@ IAccessibilityNotifier* ServiceLocator::LocateAccessibilityNotifier()
     return s_accessibilityNotifier.get();
 }
 
-ISystemConfigurationProvider* ServiceLocator::LocateSystemConfigurationProvider()
+ISystemConfigurationProvider* ServiceLocator::LoadSystemConfigurationProvider()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -247,7 +237,7 @@ ISystemConfigurationProvider* ServiceLocator::LocateSystemConfigurationProvider(
     return s_systemConfigurationProvider.get();
 }
 
-IInputServices* ServiceLocator::LocateInputServices()
+IInputServices* ServiceLocator::LoadInputServices()
 {
     NTSTATUS status = STATUS_SUCCESS;
 
@@ -269,11 +259,6 @@ IInputServices* ServiceLocator::LocateInputServices()
     return s_inputServices.get();
 }
 
-Globals& ServiceLocator::LocateGlobals()
-{
-    return s_globals;
-}
-
 // Method Description:
 // - Retrieves the pseudo console window, or attempts to instantiate one.
 // Arguments:
@@ -34,10 +34,26 @@ namespace Microsoft::Console::Interactivity
         //       automatically create the singleton object on demand.
         //       In case the on-demand creation fails, the return value
         //       is nullptr and a message is logged.
+        //
+        // The locators are queried from hot paths (every key stroke, every
+        // API call, every frame), so the steady-state case - the service
+        // already exists - is inline here and costs a load and a test at the
+        // call site. Only the first call per service takes the out-of-line
+        // creation path. The interfaces themselves stay virtual because one
+        // conhost binary serves both the Win32 and OneCore platforms and the
+        // backend is chosen at runtime by the interactivity factory.
+
+        static IAccessibilityNotifier* LocateAccessibilityNotifier()
+        {
+            IAccessibilityNotifier* const pNotifier = s_accessibilityNotifier.get();
+            return pNotifier != nullptr ? pNotifier : LoadAccessibilityNotifier();
+        }
 
-        static IAccessibilityNotifier* LocateAccessibilityNotifier();
-
-        static IConsoleControl* LocateConsoleControl();
+        static IConsoleControl* LocateConsoleControl()
+        {
+            IConsoleControl* const pControl = s_consoleControl.get();
+            return pControl != nullptr ? pControl : LoadConsoleControl();
+        }
         template<typename T>
         static T* LocateConsoleControl()
         {
@@ -45,7 +61,10 @@ namespace Microsoft::Console::Interactivity
         }
 
         [[nodiscard]] static NTSTATUS CreateConsoleInputThread(_Outptr_result_nullonfailure_ IConsoleInputThread** thread);
-        static IConsoleInputThread* LocateConsoleInputThread();
+        static IConsoleInputThread* LocateConsoleInputThread() noexcept
+        {
+            return s_consoleInputThread.get();
+        }
         template<typename T>
         static T* LocateConsoleInputThread()
         {
@@ -53,37 +72,59 @@ namespace Microsoft::Console::Interactivity
         }
 
         [[nodiscard]] static NTSTATUS SetConsoleWindowInstance(_In_ IConsoleWindow* window);
-        static IConsoleWindow* LocateConsoleWindow();
+        static IConsoleWindow* LocateConsoleWindow() noexcept
+        {
+            return s_consoleWindow;
+        }
         template<typename T>
         static T* LocateConsoleWindow()
         {
             return static_cast<T*>(s_consoleWindow);
         }
 
-        static IWindowMetrics* LocateWindowMetrics();
+        static IWindowMetrics* LocateWindowMetrics()
+        {
+            IWindowMetrics* const pMetrics = s_windowMetrics.get();
+            return pMetrics != nullptr ? pMetrics : LoadWindowMetrics();
+        }
         template<typename T>
         static T* LocateWindowMetrics()
         {
             return static_cast<T*>(LocateWindowMetrics());
         }
 
-        static IHighDpiApi* LocateHighDpiApi();
+        static IHighDpiApi* LocateHighDpiApi()
+        {
+            IHighDpiApi* const pHighDpiApi = s_highDpiApi.get();
+            return pHighDpiApi != nullptr ? pHighDpiApi : LoadHighDpiApi();
+        }
         template<typename T>
         static T* LocateHighDpiApi()
         {
             return static_cast<T*>(LocateHighDpiApi());
         }
 
-        static IInputServices* LocateInputServices();
+        static IInputServices* LocateInputServices()
+        {
+            IInputServices* const pServices = s_inputServices.get();
+            return pServices != nullptr ? pServices : LoadInputServices();
+        }
         template<typename T>
         static T* LocateInputServices()
         {
             return static_cast<T*>(LocateInputServices());
         }
 
-        static ISystemConfigurationProvider* LocateSystemConfigurationProvider();
+        static ISystemConfigurationProvider* LocateSystemConfigurationProvider()
+        {
+            ISystemConfigurationProvider* const pProvider = s_systemConfigurationProvider.get();
+            return pProvider != nullptr ? pProvider : LoadSystemConfigurationProvider();
+        }
 
-        static Globals& LocateGlobals();
+        static Globals& LocateGlobals() noexcept
+        {
+            return s_globals;
+        }
 
         static HWND LocatePseudoWindow();
 
@@ -94,6 +135,15 @@ namespace Microsoft::Console::Interactivity
     private:
         [[nodiscard]] static NTSTATUS LoadInteractivityFactory();
 
+        // Cold paths for the inline locators above: create the service
+        // through the interactivity factory on first use.
+        static IAccessibilityNotifier* LoadAccessibilityNotifier();
+        static IConsoleControl* LoadConsoleControl();
+        static IWindowMetrics* LoadWindowMetrics();
+        static IHighDpiApi* LoadHighDpiApi();
+        static IInputServices* LoadInputServices();
+        static ISystemConfigurationProvider* LoadSystemConfigurationProvider();
+
         static std::unique_ptr<IInteractivityFactory> s_interactivityFactory;
 
         static std::unique_ptr<IAccessibilityNotifier> s_accessibilityNotifier;
@@ -7,6 +7,7 @@
 #include "resource.h"
 
 #include "..\..\host\dbcs.h"
+#include "..\..\host\handle.h"
 #include "..\..\host\scrolling.hpp"
 #include "..\..\host\output.h"
 
@@ -107,8 +108,12 @@ void Clipboard::StringPaste(_In_reads_(cchData) const wchar_t* const pData,
 
     try
     {
-        std::deque<std::unique_ptr<IInputEvent>> inEvents = TextToKeyEvents(pData, cchData);
-        gci.pInputBuffer->Write(inEvents);
+        // The whole paste is filtered and synthesized as one contiguous batch
+        // of raw input records, then committed with a single Write - so even a
+        // multi-megabyte paste lands in the input buffer as one append and one
+        // waiter wake instead of per-character event traffic.
+        const std::vector<INPUT_RECORD> inRecords = TextToKeyEventRecords(pData, cchData);
+        gci.pInputBuffer->Write(gsl::span<const INPUT_RECORD>(inRecords.data(), inRecords.size()));
     }
     catch (...)
     {
@@ -121,27 +126,37 @@ void Clipboard::StringPaste(_In_reads_(cchData) const wchar_t* const pData,
 #pragma region Private Methods
 
 // Routine Description:
-// - converts a wchar_t* into a series of KeyEvents as if it was typed
-// from the keyboard
+// - converts a wchar_t* into the series of KEY_EVENT input records that typing
+// it would produce. The string is filtered and converted in a single pass,
+// with everything loop-invariant (the filter-on-paste gate, the VT input mode,
+// the codepage) hoisted out of it.
 // Arguments:
 // - pData - the text to convert
 // - cchData - the size of pData, in wchars
 // Return Value:
-// - deque of KeyEvents that represent the string passed in
+// - vector of input records that represent the string passed in
 // Note:
 // - will throw exception on error
-std::deque<std::unique_ptr<IInputEvent>> Clipboard::TextToKeyEvents(_In_reads_(cchData) const wchar_t* const pData,
-                                                                    const size_t cchData)
+std::vector<INPUT_RECORD> Clipboard::TextToKeyEventRecords(_In_reads_(cchData) const wchar_t* const pData,
+                                                           const size_t cchData)
 {
     THROW_IF_NULL_ALLOC(pData);
 
-    std::deque<std::unique_ptr<IInputEvent>> keyEvents;
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    const UINT codepage = gci.OutputCP;
+    const bool filterOnPaste = gci.GetFilterOnPaste() &&
+                               WI_IsFlagSet(gci.pInputBuffer->InputMode, ENABLE_PROCESSED_INPUT);
+    const bool vtInputMode = IsInVirtualTerminalInputMode();
+
+    std::vector<INPUT_RECORD> keyEvents;
+    // nearly every character synthesizes exactly a key down and a key up
+    keyEvents.reserve(cchData * 2);
 
     for (size_t i = 0; i < cchData; ++i)
     {
         wchar_t currentChar = pData[i];
 
-        const bool charAllowed = FilterCharacterOnPaste(&currentChar);
+        const bool charAllowed = !filterOnPaste || s_FilterCharacterOnPaste(&currentChar);
         // filter out linefeed if it's not the first char and preceded
         // by a carriage return
         const bool skipLinefeed = (i != 0 &&
@@ -168,18 +183,12 @@ std::deque<std::unique_ptr<IInputEvent>> Clipboard::TextToKeyEvents(_In_reads_(c
         // This change doesn't break pasting text into any of those applications
         //      with CR/LF (Windows) line endings either. That apparently always
         //      worked right.
-        if (IsInVirtualTerminalInputMode() && currentChar == UNICODE_LINEFEED)
+        if (vtInputMode && currentChar == UNICODE_LINEFEED)
         {
             currentChar = UNICODE_CARRIAGERETURN;
         }
 
-        const UINT codepage = ServiceLocator::LocateGlobals().getConsoleInformation().OutputCP;
-        std::deque<std::unique_ptr<KeyEvent>> convertedEvents = CharToKeyEvents(currentChar, codepage);
-        while (!convertedEvents.empty())
-        {
-            keyEvents.push_back(std::move(convertedEvents.front()));
-            convertedEvents.pop_front();
-        }
+        CharToKeyEventRecords(currentChar, codepage, keyEvents);
     }
     return keyEvents;
 }
@@ -212,11 +221,24 @@ void Clipboard::StoreSelectionToClipboard(bool const fAlsoCopyHtml)
                                              lineSelection,
                                              selectionRects);
 
+    // Everything from here on is string munging and clipboard traffic over
+    // data we've already copied out of the buffer, so let the console lock go
+    // while we do it. We're on the window thread, so the font and DPI the
+    // HTML generator reads can't change underneath us. The caller unlocks on
+    // our behalf when the message is done, so re-take the lock on every exit.
+    UnlockConsole();
+    auto relock = wil::scope_exit([] { LockConsole(); });
+
     CopyTextToSystemClipboard(text, fAlsoCopyHtml);
 }
 
 // Routine Description:
 // - Retrieves the text data from the selected region of the text buffer
+// - The selection is gathered a batch of rows at a time, and the console lock
+//   is dropped and re-taken between batches so that copying an enormous
+//   scrollback selection doesn't hold the host frozen for the whole walk.
+//   The active selection keeps client output suspended (CONSOLE_SELECTING),
+//   so the buffer contents can't shift between batches.
 // Arguments:
 // - screenInfo - what is rendered on the screen
 // - lineSelection - true if entire line is being selected. False otherwise (box selection)
@@ -232,11 +254,65 @@ TextBuffer::TextAndColor Clipboard::RetrieveTextFromBuffer(const SCREEN_INFORMAT
     std::function<COLORREF(TextAttribute&)> GetForegroundColor = std::bind(&CONSOLE_INFORMATION::LookupForegroundColor, &gci, std::placeholders::_1);
     std::function<COLORREF(TextAttribute&)> GetBackgroundColor = std::bind(&CONSOLE_INFORMATION::LookupBackgroundColor, &gci, std::placeholders::_1);
 
-    return buffer.GetTextForClipboard(lineSelection,
-                                      trimTrailingWhitespace,
-                                      selectionRects,
-                                      GetForegroundColor,
-                                      GetBackgroundColor);
+    constexpr size_t cRowsPerBatch = 128;
+    const size_t cRects = selectionRects.size();
+
+    TextBuffer::TextAndColor data;
+    data.text.reserve(cRects);
+    data.FgAttr.reserve(cRects);
+    data.BkAttr.reserve(cRects);
+
+    std::vector<SMALL_RECT> batchRects;
+    for (size_t iFirst = 0; iFirst < cRects; iFirst += cRowsPerBatch)
+    {
+        const size_t cBatch = std::min(cRowsPerBatch, cRects - iFirst);
+        const bool fLastBatch = (iFirst + cBatch) >= cRects;
+
+        batchRects.assign(selectionRects.cbegin() + iFirst,
+                          selectionRects.cbegin() + iFirst + cBatch);
+
+        auto batch = buffer.GetTextForClipboard(lineSelection,
+                                                trimTrailingWhitespace,
+                                                batchRects,
+                                                GetForegroundColor,
+                                                GetBackgroundColor);
+
+        // GetTextForClipboard treats the last row it's handed as the last row
+        // of the selection and leaves it unterminated. For every batch but the
+        // final one, terminate that row here under the same rules it uses.
+        if (!fLastBatch && trimTrailingWhitespace)
+        {
+            const UINT iRow = batchRects.back().Top;
+            if (!lineSelection || !buffer.GetRowByOffset(iRow).GetCharRow().WasWrapForced())
+            {
+                COLORREF const Blackness = RGB(0x00, 0x00, 0x00); // cant see CR/LF so just use black FG & BK
+
+                batch.text.back().push_back(UNICODE_CARRIAGERETURN);
+                batch.text.back().push_back(UNICODE_LINEFEED);
+                batch.FgAttr.back().push_back(Blackness);
+                batch.FgAttr.back().push_back(Blackness);
+                batch.BkAttr.back().push_back(Blackness);
+                batch.BkAttr.back().push_back(Blackness);
+            }
+        }
+
+        for (size_t i = 0; i < batch.text.size(); i++)
+        {
+            data.text.emplace_back(std::move(batch.text[i]));
+            data.FgAttr.emplace_back(std::move(batch.FgAttr[i]));
+            data.BkAttr.emplace_back(std::move(batch.BkAttr[i]));
+        }
+
+        if (!fLastBatch)
+        {
+            // Give any queued window work a chance at the lock before we walk
+            // the next batch of rows.
+            UnlockConsole();
+            LockConsole();
+        }
+    }
+
+    return data;
 }
 
 // Routine Description:
@@ -485,7 +561,16 @@ std::string Clipboard::GenHTML(const TextBuffer::TextAndColor& rows)
 // - rows - Rows of text data to copy
 void Clipboard::CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows, bool const fAlsoCopyHtml)
 {
+    // Measure the rows ahead of time so the concatenation below happens into
+    // one right-sized allocation instead of growing through a giant string.
+    size_t cchTotal = 0;
+    for (const auto& str : rows.text)
+    {
+        cchTotal += str.size();
+    }
+
     std::wstring finalString;
+    finalString.reserve(cchTotal);
 
     // Concatenate strings into one giant string to put onto the clipboard.
     for (const auto& str : rows.text)
@@ -554,46 +639,44 @@ void Clipboard::CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows,
 // Returns true if the character should be emitted to the paste stream
 // -- in some cases, we will change what character should be emitted, as in the case of "smart quotes"
 // Returns false if the character should not be emitted (e.g. <TAB>)
-bool Clipboard::FilterCharacterOnPaste(_Inout_ WCHAR* const pwch)
+// Note: the caller is responsible for checking whether filtering is enabled
+// (FilterOnPaste with ENABLE_PROCESSED_INPUT) - that gate is loop-invariant
+// over a paste, so it is hoisted out of the per-character path.
+bool Clipboard::s_FilterCharacterOnPaste(_Inout_ WCHAR* const pwch)
 {
-    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     bool fAllowChar = true;
-    if (gci.GetFilterOnPaste() &&
-        (WI_IsFlagSet(gci.pInputBuffer->InputMode, ENABLE_PROCESSED_INPUT)))
+    switch (*pwch)
     {
-        switch (*pwch)
-        {
-            // swallow tabs to prevent inadvertant tab expansion
-        case UNICODE_TAB:
-        {
-            fAllowChar = false;
-            break;
-        }
+        // swallow tabs to prevent inadvertant tab expansion
+    case UNICODE_TAB:
+    {
+        fAllowChar = false;
+        break;
+    }
 
-        // Replace Unicode space with standard space
-        case UNICODE_NBSP:
-        case UNICODE_NARROW_NBSP:
-        {
-            *pwch = UNICODE_SPACE;
-            break;
-        }
+    // Replace Unicode space with standard space
+    case UNICODE_NBSP:
+    case UNICODE_NARROW_NBSP:
+    {
+        *pwch = UNICODE_SPACE;
+        break;
+    }
 
-        // Replace "smart quotes" with "dumb ones"
-        case UNICODE_LEFT_SMARTQUOTE:
-        case UNICODE_RIGHT_SMARTQUOTE:
-        {
-            *pwch = UNICODE_QUOTE;
-            break;
-        }
+    // Replace "smart quotes" with "dumb ones"
+    case UNICODE_LEFT_SMARTQUOTE:
+    case UNICODE_RIGHT_SMARTQUOTE:
+    {
+        *pwch = UNICODE_QUOTE;
+        break;
+    }
 
-        // Replace Unicode dashes with a standard hypen
-        case UNICODE_EM_DASH:
-        case UNICODE_EN_DASH:
-        {
-            *pwch = UNICODE_HYPHEN;
-            break;
-        }
-        }
+    // Replace Unicode dashes with a standard hypen
+    case UNICODE_EM_DASH:
+    case UNICODE_EN_DASH:
+    {
+        *pwch = UNICODE_HYPHEN;
+        break;
+    }
     }
 
     return fAllowChar;
@@ -20,6 +20,38 @@ using namespace Microsoft::Console::Interactivity;
 //#define UIATEXTRANGE_DEBUG_MSGS 1
 #undef UIATEXTRANGE_DEBUG_MSGS
 
+namespace
+{
+    // The text of one buffer row up to its last non-whitespace character,
+    // the ROW it was copied from, and the row content version it was copied
+    // at (see ROW::BumpVersion). Versions are per-ROW counters, so a stamp
+    // is only comparable against the same ROW object; after the circular
+    // buffer rotates, a row offset resolves to a different ROW whose counter
+    // may coincidentally match, so the identity check is what keeps a hit
+    // honest across scrolling.
+    struct CachedRowText
+    {
+        const ROW* row = nullptr;
+        size_t version = SIZE_MAX;
+        std::wstring text;
+    };
+
+    // Screen readers issue bursts of range queries that mostly re-read the
+    // same rows, and every query used to copy its rows back out of the
+    // buffer under the console lock. This cache keeps one entry per buffer
+    // row position; an entry is refreshed only when the live row's version
+    // says its content actually changed, so a steady screen costs a version
+    // comparison per row instead of a copy. It's bounded by the buffer's
+    // row count, only touched from UIA calls, and guarded by its own lock.
+    // Row versions are per-ROW counters, so entries are only meaningful for
+    // the text buffer they were copied from; the cache tracks its owner and
+    // is flushed when the active buffer changes (e.g. the client switches
+    // to the VT alternate screen buffer or another screen buffer entirely).
+    std::mutex g_rowTextCacheLock;
+    const TextBuffer* g_rowTextCacheOwner = nullptr;
+    std::unordered_map<size_t, CachedRowText> g_rowTextCache;
+}
+
 IdType UiaTextRange::id = 1;
 
 UiaTextRange::MoveState::MoveState(const UiaTextRange& range,
@@ -735,7 +767,42 @@ IFACEMETHODIMP UiaTextRange::GetText(_In_ int maxLength, _Out_ BSTR* pRetVal)
             const ScreenInfoRow endScreenInfoRow = _endpointToScreenInfoRow(_end);
             const Column endColumn = _endpointToColumn(_end);
             const unsigned int totalRowsInRange = _rowCountInRange();
-            const TextBuffer& textBuffer = _getTextBuffer();
+
+            // Refresh the row text cache for the rows this range covers,
+            // then drop the console lock and assemble the text from the
+            // cache. Only rows whose content version moved since the last
+            // UIA call get copied out of the buffer, so repeated queries
+            // over a steady screen hold the lock for a handful of integer
+            // comparisons rather than a full text extraction.
+            std::lock_guard<std::mutex> cacheGuard(g_rowTextCacheLock);
+            const auto& textBuffer = _getTextBuffer();
+            if (g_rowTextCacheOwner != &textBuffer)
+            {
+                // A different buffer is active; its rows carry their own
+                // version counters, which can collide with the stamps left
+                // by the previous buffer, so every cached entry is suspect.
+                g_rowTextCache.clear();
+                g_rowTextCacheOwner = &textBuffer;
+            }
+            for (unsigned int i = 0; i < totalRowsInRange; ++i)
+            {
+                const ROW& row = textBuffer.GetRowByOffset(startScreenInfoRow + i);
+                CachedRowText& entry = g_rowTextCache[startScreenInfoRow + i];
+                if (entry.row != &row || entry.version != row.GetVersion())
+                {
+                    entry.row = &row;
+                    entry.version = row.GetVersion();
+                    if (row.GetCharRow().ContainsText())
+                    {
+                        entry.text = row.GetText().substr(0, row.GetCharRow().MeasureRight());
+                    }
+                    else
+                    {
+                        entry.text.clear();
+                    }
+                }
+            }
+            Unlock.reset();
 
 #if defined(_DEBUG) && defined(UIATEXTRANGE_DEBUG_MSGS)
             std::wstringstream ss;
@@ -748,10 +815,10 @@ IFACEMETHODIMP UiaTextRange::GetText(_In_ int maxLength, _Out_ BSTR* pRetVal)
             for (unsigned int i = 0; i < totalRowsInRange; ++i)
             {
                 currentScreenInfoRow = startScreenInfoRow + i;
-                const ROW& row = textBuffer.GetRowByOffset(currentScreenInfoRow);
-                if (row.GetCharRow().ContainsText())
+                const std::wstring& rowText = g_rowTextCache[currentScreenInfoRow].text;
+                if (!rowText.empty())
                 {
-                    const size_t rowRight = row.GetCharRow().MeasureRight();
+                    const size_t rowRight = rowText.size();
                     size_t startIndex = 0;
                     size_t endIndex = rowRight;
                     if (currentScreenInfoRow == startScreenInfoRow)
@@ -770,7 +837,7 @@ IFACEMETHODIMP UiaTextRange::GetText(_In_ int maxLength, _Out_ BSTR* pRetVal)
                     // wouldn't be any text to grab.
                     if (startIndex < endIndex)
                     {
-                        wstr += row.GetText().substr(startIndex, endIndex - startIndex);
+                        wstr.append(rowText, startIndex, endIndex - startIndex);
                     }
                 }
 
@@ -35,8 +35,8 @@ namespace Microsoft::Console::Interactivity::Win32
         void Paste();
 
     private:
-        std::deque<std::unique_ptr<IInputEvent>> TextToKeyEvents(_In_reads_(cchData) const wchar_t* const pData,
-                                                                 const size_t cchData);
+        std::vector<INPUT_RECORD> TextToKeyEventRecords(_In_reads_(cchData) const wchar_t* const pData,
+                                                        const size_t cchData);
 
         void StoreSelectionToClipboard(_In_ bool const fAlsoCopyHtml);
 
@@ -48,7 +48,7 @@ namespace Microsoft::Console::Interactivity::Win32
         std::string GenHTML(const TextBuffer::TextAndColor& rows);
         void CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows, _In_ bool const fAlsoCopyHtml);
 
-        bool FilterCharacterOnPaste(_Inout_ WCHAR* const pwch);
+        static bool s_FilterCharacterOnPaste(_Inout_ WCHAR* const pwch);
 
 #ifdef UNIT_TESTING
         friend class ClipboardTests;
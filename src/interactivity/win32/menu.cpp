@@ -122,6 +122,15 @@ Menu::Menu(HMENU hMenu, HMENU hHeirMenu) :
                         ItemString);
         }
 
+#if defined(ALLOC_ACCOUNTING)
+        // Accounting builds get a dump entry point on the system menu. The
+        // label is deliberately unlocalized; this menu item never ships.
+        AppendMenuW(hMenu,
+                    MF_STRING,
+                    ID_CONSOLE_ALLOCSTATS,
+                    L"Allocation Stats");
+#endif
+
         // Set the singleton instance.
         Menu::s_Instance = pNewMenu;
     }
@@ -37,6 +37,7 @@ Author(s):
 #define ID_CONSOLE_EDIT         0xFFF6
 #define ID_CONSOLE_CONTROL      0xFFF7
 #define ID_CONSOLE_DEFAULTS     0xFFF8
+#define ID_CONSOLE_ALLOCSTATS   0xFFF9
 
 // MENU IDs
 #define ID_CONSOLE_SYSTEMMENU   500
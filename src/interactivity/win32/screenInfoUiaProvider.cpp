@@ -51,6 +51,14 @@ ScreenInfoUiaProvider::~ScreenInfoUiaProvider()
 [[nodiscard]] HRESULT ScreenInfoUiaProvider::Signal(_In_ EVENTID id)
 {
     HRESULT hr = S_OK;
+
+    // UIA event dispatch isn't cheap; skip it outright when no UIA client
+    // has subscribed to us.
+    if (!UiaClientsAreListening())
+    {
+        return hr;
+    }
+
     // check to see if we're already firing this particular event
     if (_signalFiringMapping.find(id) != _signalFiringMapping.end() &&
         _signalFiringMapping[id] == true)
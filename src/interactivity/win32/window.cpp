@@ -434,9 +434,6 @@ void Window::ChangeViewport(const SMALL_RECT NewWindow)
 
     if (WI_IsFlagClear(gci.Flags, CONSOLE_IS_ICONIC))
     {
-        Selection* pSelection = &Selection::Instance();
-        pSelection->HideSelection();
-
         // Fire off an event to let accessibility apps know we've scrolled.
         IAccessibilityNotifier* pNotifier = ServiceLocator::LocateAccessibilityNotifier();
         if (pNotifier != nullptr)
@@ -449,12 +446,17 @@ void Window::ChangeViewport(const SMALL_RECT NewWindow)
         ScreenInfo.SetViewport(Viewport::FromInclusive(NewWindow), false);
         Tracing::s_TraceWindowViewport(ScreenInfo.GetViewport());
 
+        // The scroll is the only invalidation we need. Selection rectangles
+        // are expressed in buffer coordinates, so a pure viewport move leaves
+        // them untouched - the renderer diffs them against its previous frame
+        // and TriggerScroll shifts whatever was already painted. Hiding and
+        // re-showing the selection here would invalidate the entire selected
+        // area twice for every scroll notch, which made selection-drag
+        // auto-scroll repaint the whole window once per timer tick.
         if (ServiceLocator::LocateGlobals().pRender != nullptr)
         {
             ServiceLocator::LocateGlobals().pRender->TriggerScroll();
         }
-
-        pSelection->ShowSelection();
     }
     else
     {
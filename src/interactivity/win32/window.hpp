@@ -168,6 +168,16 @@ namespace Microsoft::Console::Interactivity::Win32
 
         bool _fInDPIChange = false;
 
+        // Set between WM_ENTERSIZEMOVE and WM_EXITSIZEMOVE. While the user is
+        // dragging, intermediate sizes only adjust the viewport; the buffer
+        // resize/reflow is deferred until the drag completes.
+        bool _fInSizeMove = false;
+        bool _fDeferredResizePending = false;
+
+        // True while the render thread is parked because the window is
+        // minimized. See _HandleWindowPosChanged.
+        bool _fRenderSuspended = false;
+
         static void s_ConvertWindowPosToWindowRect(const LPWINDOWPOS lpWindowPos,
                                                    _Out_ RECT* const prc);
     };
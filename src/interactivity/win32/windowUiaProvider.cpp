@@ -64,6 +64,13 @@ WindowUiaProvider* WindowUiaProvider::Create()
 {
     HRESULT hr = S_OK;
 
+    // UIA event dispatch isn't cheap; skip it outright when no UIA client
+    // has subscribed to us.
+    if (!UiaClientsAreListening())
+    {
+        return hr;
+    }
+
     // ScreenInfoUiaProvider is responsible for signaling selection
     // changed events and text changed events
     if (id == UIA_Text_TextSelectionChangedEventId ||
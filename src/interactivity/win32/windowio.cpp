@@ -906,12 +906,94 @@ BOOL HandleMouseEvent(const SCREEN_INFORMATION& ScreenInfo,
     ULONG EventsWritten = 0;
     try
     {
-        std::unique_ptr<MouseEvent> mouseEvent = std::make_unique<MouseEvent>(
-            MousePosition,
-            ConvertMouseButtonState(ButtonFlags, static_cast<UINT>(wParam)),
-            GetControlKeyState(0),
-            EventFlags);
-        EventsWritten = static_cast<ULONG>(gci.pInputBuffer->Write(std::move(mouseEvent)));
+        if (Message == WM_MOUSEMOVE)
+        {
+            // High-rate mouse movement (and SendInput-driven automation) posts
+            // WM_MOUSEMOVE far faster than the one-message-at-a-time dispatch
+            // loop retires it, and every message was paying for its own input
+            // buffer lock acquisition and waiter wake. Once a movement message
+            // has made it through all the checks above, drain whatever further
+            // movement is already queued behind it, translate the run into a
+            // stack array of records, and commit the batch with a single write.
+            constexpr size_t cMaxMouseEventBatch = 16;
+            INPUT_RECORD rgRecords[cMaxMouseEventBatch];
+            size_t cRecords = 0;
+
+            rgRecords[cRecords++] = MouseEvent(MousePosition,
+                                               ConvertMouseButtonState(ButtonFlags, static_cast<UINT>(wParam)),
+                                               GetControlKeyState(0),
+                                               EventFlags)
+                                        .ToInputRecord();
+
+            MSG msgQueued;
+            while (cRecords < cMaxMouseEventBatch &&
+                   PeekMessageW(&msgQueued,
+                                ServiceLocator::LocateConsoleWindow()->GetWindowHandle(),
+                                WM_MOUSEMOVE,
+                                WM_MOUSEMOVE,
+                                PM_REMOVE))
+            {
+                COORD QueuedPosition;
+                QueuedPosition.X = GET_X_LPARAM(msgQueued.lParam) / ScreenFontSize.X;
+                QueuedPosition.Y = GET_Y_LPARAM(msgQueued.lParam) / ScreenFontSize.Y;
+
+                // The selection checks above can't be invalidated by pulling
+                // more movement out of the queue, but the VT mouse gate reads
+                // the live SHIFT state, so re-apply it per queued message.
+                if (!WI_IsFlagSet(GetKeyState(VK_SHIFT), KEY_PRESSED) &&
+                    !pSelection->IsInSelectingState() &&
+                    HandleTerminalMouseEvent(QueuedPosition, WM_MOUSEMOVE, GET_KEYSTATE_WPARAM(msgQueued.wParam), 0))
+                {
+                    continue;
+                }
+
+                QueuedPosition.X += ScreenInfo.GetViewport().Left();
+                QueuedPosition.Y += ScreenInfo.GetViewport().Top();
+                QueuedPosition.X = std::clamp(QueuedPosition.X, static_cast<SHORT>(0), static_cast<SHORT>(coordScreenBufferSize.X - 1));
+                QueuedPosition.Y = std::clamp(QueuedPosition.Y, static_cast<SHORT>(0), static_cast<SHORT>(coordScreenBufferSize.Y - 1));
+
+                const DWORD QueuedButtonState = ConvertMouseButtonState(0, static_cast<UINT>(msgQueued.wParam));
+                const DWORD QueuedKeyState = GetControlKeyState(0);
+
+                INPUT_RECORD& LastRecord = rgRecords[cRecords - 1];
+                if (LastRecord.Event.MouseEvent.dwEventFlags == MOUSE_MOVED &&
+                    LastRecord.Event.MouseEvent.dwButtonState == QueuedButtonState &&
+                    LastRecord.Event.MouseEvent.dwControlKeyState == QueuedKeyState)
+                {
+                    // Same movement run - just advance the reported position,
+                    // exactly as the input buffer coalesces back-to-back moves.
+                    LastRecord.Event.MouseEvent.dwMousePosition = QueuedPosition;
+                }
+                else
+                {
+                    rgRecords[cRecords++] = MouseEvent(QueuedPosition,
+                                                       QueuedButtonState,
+                                                       QueuedKeyState,
+                                                       MOUSE_MOVED)
+                                                .ToInputRecord();
+                }
+            }
+
+            EventsWritten = static_cast<ULONG>(gci.pInputBuffer->Write(gsl::span<const INPUT_RECORD>(rgRecords, cRecords)));
+            if (EventsWritten != cRecords)
+            {
+                RIPMSG2(RIP_WARNING, "PutInputInBuffer: EventsWritten (0x%x) != cRecords (0x%x)", EventsWritten, static_cast<ULONG>(cRecords));
+            }
+        }
+        else
+        {
+            std::unique_ptr<MouseEvent> mouseEvent = std::make_unique<MouseEvent>(
+                MousePosition,
+                ConvertMouseButtonState(ButtonFlags, static_cast<UINT>(wParam)),
+                GetControlKeyState(0),
+                EventFlags);
+            EventsWritten = static_cast<ULONG>(gci.pInputBuffer->Write(std::move(mouseEvent)));
+
+            if (EventsWritten != 1)
+            {
+                RIPMSG1(RIP_WARNING, "PutInputInBuffer: EventsWritten != 1 (0x%x), 1 expected", EventsWritten);
+            }
+        }
     }
     catch (...)
     {
@@ -919,11 +1001,6 @@ BOOL HandleMouseEvent(const SCREEN_INFORMATION& ScreenInfo,
         EventsWritten = 0;
     }
 
-    if (EventsWritten != 1)
-    {
-        RIPMSG1(RIP_WARNING, "PutInputInBuffer: EventsWritten != 1 (0x%x), 1 expected", EventsWritten);
-    }
-
     return FALSE;
 }
 
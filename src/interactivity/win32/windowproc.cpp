@@ -25,6 +25,8 @@
 
 #include "..\inc\ServiceLocator.hpp"
 
+#include "..\..\inc\AllocAccounting.hpp"
+
 #include "../interactivity/win32/windowtheme.hpp"
 #include "../interactivity/win32/windowUiaProvider.hpp"
 #include "../interactivity/win32/CustomWindowMessages.h"
@@ -35,6 +37,32 @@
 using namespace Microsoft::Console::Interactivity::Win32;
 using namespace Microsoft::Console::Types;
 
+#if defined(ALLOC_ACCOUNTING)
+// Routine Description:
+// - Dumps the per-subsystem heap counters to the debugger. Reached from the
+//   "Allocation Stats" system menu item that accounting builds add.
+// Return Value:
+// - <none>
+static void DumpAllocationStats()
+{
+    OutputDebugStringW(L"conhost allocation accounting:\n");
+    for (size_t tag = 0; tag < static_cast<size_t>(AllocAccounting::Tag::Count); tag++)
+    {
+        const auto snapshot = AllocAccounting::s_GetSnapshot(static_cast<AllocAccounting::Tag>(tag));
+        WCHAR wszLine[160];
+        StringCchPrintfW(wszLine,
+                         ARRAYSIZE(wszLine),
+                         L"  %-10s live %I64d allocations / %I64d bytes, lifetime %I64d allocations / %I64d bytes\n",
+                         AllocAccounting::s_TagName(static_cast<AllocAccounting::Tag>(tag)),
+                         snapshot.LiveCount,
+                         snapshot.LiveBytes,
+                         snapshot.TotalCount,
+                         snapshot.TotalBytes);
+        OutputDebugStringW(wszLine);
+    }
+}
+#endif
+
 // The static and specific window procedures for this class are contained here
 #pragma region Window Procedure
 
@@ -171,6 +199,30 @@ using namespace Microsoft::Console::Types;
         break;
     }
 
+    case WM_ENTERSIZEMOVE:
+    {
+        // While the user is dragging the window edge, apply intermediate sizes
+        // to the viewport only and save the expensive buffer resize/reflow for
+        // the end of the drag (see _HandleWindowPosChanged).
+        _fInSizeMove = true;
+        goto CallDefWin;
+    }
+
+    case WM_EXITSIZEMOVE:
+    {
+        _fInSizeMove = false;
+        if (_fDeferredResizePending)
+        {
+            _fDeferredResizePending = false;
+
+            // Run the full resize pass (buffer adjust + reflow) against the
+            // last client rectangle the drag produced. The viewport has been
+            // tracking it all along, so pass the same rect for old and new.
+            ScreenInfo.ProcessResizeWindow(&_rcClientLast, &_rcClientLast);
+        }
+        goto CallDefWin;
+    }
+
     case WM_GETDPISCALEDSIZE:
     {
         // This message will send us the DPI we're about to be changed to.
@@ -582,6 +634,12 @@ using namespace Microsoft::Console::Types;
         {
             Menu::s_ShowPropertiesDialog(hWnd, TRUE);
         }
+#if defined(ALLOC_ACCOUNTING)
+        else if (wParam == ID_CONSOLE_ALLOCSTATS)
+        {
+            DumpAllocationStats();
+        }
+#endif
         else
         {
             goto CallDefWin;
@@ -783,6 +841,27 @@ void Window::_HandleWindowPosChanged(const LPARAM lParam)
 
     LPWINDOWPOS const lpWindowPos = (LPWINDOWPOS)lParam;
 
+    // While minimized nobody can see the window, so park the render thread
+    // instead of letting it keep composing frames. Invalidations accumulate
+    // in the engines while parked; the redraw-all on restore turns whatever
+    // piled up into one full frame.
+    Globals& g = ServiceLocator::LocateGlobals();
+    if (g.pRender)
+    {
+        const bool fIconic = !!IsIconic(hWnd);
+        if (fIconic && !_fRenderSuspended)
+        {
+            _fRenderSuspended = true;
+            g.pRender->WaitForPaintCompletionAndDisable(INFINITE);
+        }
+        else if (!fIconic && _fRenderSuspended)
+        {
+            _fRenderSuspended = false;
+            g.pRender->EnablePainting();
+            g.pRender->TriggerRedrawAll();
+        }
+    }
+
     // If the frame changed, update the system metrics.
     if (WI_IsFlagSet(lpWindowPos->flags, SWP_FRAMECHANGED))
     {
@@ -804,7 +883,14 @@ void Window::_HandleWindowPosChanged(const LPARAM lParam)
         // don't do anything except update our windowrect
         if (!WI_IsFlagSet(lpWindowPos->flags, SWP_NOSIZE) || _fInDPIChange)
         {
-            ScreenInfo.ProcessResizeWindow(&rcNew, &_rcClientLast);
+            // During a live drag, only track the viewport (cheap); the buffer
+            // resize/reflow runs once at WM_EXITSIZEMOVE instead of on every
+            // intermediate size the drag produces.
+            ScreenInfo.ProcessResizeWindow(&rcNew, &_rcClientLast, _fInSizeMove);
+            if (_fInSizeMove)
+            {
+                _fDeferredResizePending = true;
+            }
         }
 
         // now that operations are complete, save the new rectangle size as the last seen value
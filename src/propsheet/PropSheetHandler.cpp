@@ -125,6 +125,7 @@ private:
         {
             InitializeFonts();
             hr = FindFontAndUpdateState();
+            StartBackgroundFontEnumeration();
         }
 
         return hr;
@@ -608,6 +608,10 @@ INT_PTR ConsolePropertySheet(__in HWND hWnd, __in PCONSOLE_STATE_INFO pStateInfo
     // since we just triggered font enumeration, recreate our font handles to adapt for DPI
     RecreateFontHandles(hWnd);
 
+    // Enumerate the rest of the installed fonts off the UI thread so the
+    // Font page comes up instantly even on huge font libraries.
+    StartBackgroundFontEnumeration();
+
     //
     // Get the current page number
     //
@@ -86,6 +86,12 @@ typedef struct tagFACENODE
 VOID
     InitializeFonts(VOID);
 
+VOID
+    StartBackgroundFontEnumeration(VOID);
+
+VOID
+    WaitForFontEnumeration(VOID);
+
 VOID
     DestroyFonts(VOID);
 
@@ -722,6 +722,12 @@ int FontListCreate(
 
     DBGFONTS(("FontListCreate %p, %s, %s new FaceList\n", hDlg, bLB ? "Raster" : "TrueType", bNewFaceList ? "Make" : "No"));
 
+    /*
+     * The full enumeration was started in the background when the sheet came
+     * up; join it before touching the font globals.
+     */
+    WaitForFontEnumeration();
+
     /*
      * This only enumerates face names and font sizes if necessary.
      */
@@ -1142,6 +1148,8 @@ int FindCreateFont(
 
     FAIL_FAST_IF(!(OEMCP != 0));
 
+    WaitForFontEnumeration();
+
     DBGFONTS(("FindCreateFont Family=%x %ls (%d,%d) %d %d %x\n",
               Family,
               pwszFace,
@@ -442,12 +442,67 @@ VOID
     LOG_IF_FAILED(EnumerateFonts(EF_DEFFACE)); // Just the Default font
 }
 
+/*
+ * Background worker for the full font enumeration. Enumerating every
+ * installed face takes seconds on machines with large font libraries, so
+ * the work happens here while the user is still looking at the first
+ * property sheet page; by the time the Font page initializes, every face is
+ * usually already enumerated and its EnumerateFonts call just walks the
+ * face list.
+ */
+static HANDLE g_hFontEnumThread = NULL;
+
+static DWORD WINAPI FontEnumThreadProc(LPVOID /*lpParameter*/)
+{
+    LOG_IF_FAILED(EnumerateFonts(EF_TTFONT | EF_OEMFONT));
+    return 0;
+}
+
+/*
+ * Kicks off the full enumeration in the background. Call only after the
+ * startup-path font lookups are done - the font globals are not guarded, so
+ * every later consumer must go through WaitForFontEnumeration first.
+ */
+VOID
+    StartBackgroundFontEnumeration(
+        VOID)
+{
+    if (g_hFontEnumThread == NULL)
+    {
+        g_hFontEnumThread = CreateThread(NULL, 0, FontEnumThreadProc, NULL, 0, NULL);
+        if (g_hFontEnumThread == NULL)
+        {
+            // No thread, no problem - the Font page will enumerate
+            // synchronously like it always has.
+            LOG_LAST_ERROR();
+        }
+    }
+}
+
+/*
+ * Joins the background enumeration before anything touches the font
+ * globals. Once the worker has been reaped this is a null check.
+ */
+VOID
+    WaitForFontEnumeration(
+        VOID)
+{
+    if (g_hFontEnumThread != NULL)
+    {
+        WaitForSingleObject(g_hFontEnumThread, INFINITE);
+        CloseHandle(g_hFontEnumThread);
+        g_hFontEnumThread = NULL;
+    }
+}
+
 VOID
     DestroyFonts(
         VOID)
 {
     ULONG FontIndex;
 
+    WaitForFontEnumeration();
+
     if (FontInfo != NULL)
     {
         for (FontIndex = 0; FontIndex < NumberOfFonts; FontIndex++)
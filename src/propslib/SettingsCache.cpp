@@ -0,0 +1,252 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "SettingsCache.hpp"
+#include "RegistrySerialization.hpp"
+
+#pragma hdrstop
+
+// The cached payload is copied in and out of the shared section as raw bytes,
+// which is only sound while Settings stays trivially copyable.
+static_assert(std::is_trivially_copyable<Settings>::value,
+              "Settings must be trivially copyable to live in the settings cache section");
+
+// Keeping the section and view handles open for the life of the process means
+// the cache survives as long as any console that has used it is still
+// running, which is exactly the fleet steady state the cache exists for. The
+// section is torn down by the kernel when the last console exits.
+static wil::unique_handle s_hSection;
+static wil::unique_mapview_ptr<void> s_pvView;
+
+// Routine Description:
+// - Computes a stable hash of the translated console title for use in the
+//   section name. Titles are hashed case-insensitively to match registry key
+//   name semantics.
+// Arguments:
+// - pwszTranslatedTitle - Translated title string (the registry subkey name)
+// Return Value:
+// - 64-bit FNV-1a hash of the title.
+ULONGLONG SettingsCache::s_HashTitle(_In_ PCWSTR const pwszTranslatedTitle)
+{
+    ULONGLONG hash = 14695981039346656037ULL;
+    for (PCWSTR pwch = pwszTranslatedTitle; *pwch != UNICODE_NULL; pwch++)
+    {
+        hash ^= towlower(*pwch);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Routine Description:
+// - Builds the per-title section name. The Local namespace scopes the cache
+//   to the current session, so consoles never observe another user's
+//   settings.
+// Arguments:
+// - pwszTranslatedTitle - Translated title string (the registry subkey name)
+// - pwszSectionName - Receives the null terminated section name
+// - cchSectionName - Size of the provided name buffer in characters
+// Return Value:
+// - STATUS_SUCCESSFUL or appropriate NTSTATUS reply.
+[[nodiscard]]
+NTSTATUS SettingsCache::s_BuildSectionName(_In_ PCWSTR const pwszTranslatedTitle,
+                                           _Out_writes_(cchSectionName) PWSTR const pwszSectionName,
+                                           const size_t cchSectionName)
+{
+    return NTSTATUS_FROM_HRESULT(StringCchPrintfW(pwszSectionName,
+                                                  cchSectionName,
+                                                  L"Local\\ConsoleSettingsCache-v%u-%016I64x",
+                                                  sc_dwCacheVersion,
+                                                  s_HashTitle(pwszTranslatedTitle)));
+}
+
+// Routine Description:
+// - Queries the last-write timestamp of the registry state feeding this
+//   title's settings: the HKCU Console key and, when present, the title
+//   subkey. Value edits update the owning key's timestamp and subkey
+//   creation/deletion updates the Console key's, so the later of the two
+//   times changes whenever anything this title reads has changed. This is
+//   two metadata queries against walking the full tree of values.
+// Arguments:
+// - pwszTranslatedTitle - Translated title string (the registry subkey name)
+// - pftLastWrite - Receives the newer of the two key write times
+// Return Value:
+// - STATUS_SUCCESSFUL or appropriate NTSTATUS reply for registry operations.
+[[nodiscard]]
+NTSTATUS SettingsCache::s_QueryRegistryLastWriteTime(_In_ PCWSTR const pwszTranslatedTitle,
+                                                     _Out_ FILETIME* const pftLastWrite)
+{
+    pftLastWrite->dwLowDateTime = 0;
+    pftLastWrite->dwHighDateTime = 0;
+
+    HKEY hCurrentUserKey;
+    HKEY hConsoleKey;
+    NTSTATUS Status = RegistrySerialization::s_OpenConsoleKey(&hCurrentUserKey, &hConsoleKey);
+    if (NT_SUCCESS(Status))
+    {
+        FILETIME ftConsole = { 0 };
+        Status = NTSTATUS_FROM_WIN32(RegQueryInfoKeyW(hConsoleKey,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      &ftConsole));
+        if (NT_SUCCESS(Status))
+        {
+            *pftLastWrite = ftConsole;
+
+            HKEY hTitleKey;
+            if (NT_SUCCESS(RegistrySerialization::s_OpenKey(hConsoleKey, pwszTranslatedTitle, &hTitleKey)))
+            {
+                FILETIME ftTitle = { 0 };
+                if (NT_SUCCESS(NTSTATUS_FROM_WIN32(RegQueryInfoKeyW(hTitleKey,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    &ftTitle))))
+                {
+                    if (CompareFileTime(&ftTitle, pftLastWrite) > 0)
+                    {
+                        *pftLastWrite = ftTitle;
+                    }
+                }
+                RegCloseKey(hTitleKey);
+            }
+        }
+
+        RegCloseKey(hConsoleKey);
+        RegCloseKey(hCurrentUserKey);
+    }
+
+    return Status;
+}
+
+// Routine Description:
+// - Attempts to satisfy a settings load from the shared cache section. The
+//   cached copy is used only if it was published by a matching binary
+//   (version and size) and the backing registry keys have not been written
+//   since it was stored.
+// Arguments:
+// - pwszTranslatedTitle - Translated title string (the registry subkey name)
+// - pSettings - Receives the cached settings on success. Untouched on a miss.
+// Return Value:
+// - True if the settings were filled from the cache. False on any miss;
+//   the caller performs the full registry read as before.
+bool SettingsCache::s_TryLoadCachedSettings(_In_ PCWSTR const pwszTranslatedTitle,
+                                            _Inout_ Settings* const pSettings)
+{
+    WCHAR wszSectionName[64];
+    if (!NT_SUCCESS(s_BuildSectionName(pwszTranslatedTitle, wszSectionName, ARRAYSIZE(wszSectionName))))
+    {
+        return false;
+    }
+
+    wil::unique_handle section(OpenFileMappingW(FILE_MAP_READ, FALSE, wszSectionName));
+    if (!section)
+    {
+        return false;
+    }
+
+    wil::unique_mapview_ptr<void> view(MapViewOfFile(section.get(), FILE_MAP_READ, 0, 0, 0));
+    if (!view)
+    {
+        return false;
+    }
+
+    const _CacheHeader* const pHeader = static_cast<const _CacheHeader*>(view.get());
+    if (pHeader->dwVersion != sc_dwCacheVersion ||
+        pHeader->cbSettings != sizeof(Settings) ||
+        !pHeader->fValid)
+    {
+        return false;
+    }
+
+    FILETIME ftCurrent;
+    if (!NT_SUCCESS(s_QueryRegistryLastWriteTime(pwszTranslatedTitle, &ftCurrent)) ||
+        CompareFileTime(&ftCurrent, &pHeader->ftRegistryLastWrite) != 0)
+    {
+        return false;
+    }
+
+    memcpy(pSettings, reinterpret_cast<const BYTE*>(pHeader) + sizeof(_CacheHeader), sizeof(Settings));
+
+    // Hold the section open so the cache outlives this console too.
+    s_hSection = std::move(section);
+    s_pvView = std::move(view);
+    return true;
+}
+
+// Routine Description:
+// - Publishes freshly loaded settings into the shared cache section for the
+//   benefit of the next console start with this title. Failure is not an
+//   error - the cache is purely an accelerator - so problems are logged and
+//   swallowed.
+// Arguments:
+// - pwszTranslatedTitle - Translated title string (the registry subkey name)
+// - pSettings - The settings to publish, as produced by the registry load
+// Return Value:
+// - <none>
+void SettingsCache::s_CacheSettings(_In_ PCWSTR const pwszTranslatedTitle,
+                                    _In_ const Settings* const pSettings)
+{
+    WCHAR wszSectionName[64];
+    if (!NT_SUCCESS(s_BuildSectionName(pwszTranslatedTitle, wszSectionName, ARRAYSIZE(wszSectionName))))
+    {
+        return;
+    }
+
+    FILETIME ftLastWrite;
+    if (!NT_SUCCESS(s_QueryRegistryLastWriteTime(pwszTranslatedTitle, &ftLastWrite)))
+    {
+        return;
+    }
+
+    const DWORD cbSection = sizeof(_CacheHeader) + sizeof(Settings);
+    wil::unique_handle section(CreateFileMappingW(INVALID_HANDLE_VALUE,
+                                                  nullptr,
+                                                  PAGE_READWRITE,
+                                                  0,
+                                                  cbSection,
+                                                  wszSectionName));
+    if (!section)
+    {
+        LOG_LAST_ERROR();
+        return;
+    }
+
+    wil::unique_mapview_ptr<void> view(MapViewOfFile(section.get(), FILE_MAP_WRITE, 0, 0, 0));
+    if (!view)
+    {
+        LOG_LAST_ERROR();
+        return;
+    }
+
+    _CacheHeader* const pHeader = static_cast<_CacheHeader*>(view.get());
+
+    // Take the entry invalid, fill it, then publish it. A concurrent reader
+    // either sees fValid clear and misses, or sees it set after the payload
+    // and header are complete.
+    InterlockedExchange(&pHeader->fValid, FALSE);
+    pHeader->dwVersion = sc_dwCacheVersion;
+    pHeader->cbSettings = sizeof(Settings);
+    pHeader->ftRegistryLastWrite = ftLastWrite;
+    memcpy(reinterpret_cast<BYTE*>(pHeader) + sizeof(_CacheHeader), pSettings, sizeof(Settings));
+    InterlockedExchange(&pHeader->fValid, TRUE);
+
+    s_hSection = std::move(section);
+    s_pvView = std::move(view);
+}
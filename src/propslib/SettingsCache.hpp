@@ -0,0 +1,56 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- SettingsCache.hpp
+
+Abstract:
+- This module caches the registry-derived portion of the console settings in a
+  named shared memory section so that warm console starts can skip walking the
+  registry tree entirely. The first conhost for a given title pays the full
+  registry read and publishes the result; subsequent starts validate the cache
+  against the last-write timestamps of the backing registry keys (two metadata
+  queries) and, when it is current, copy the settings straight out of the
+  section.
+
+Author(s):
+- Adapted from the registry loading paths in RegistrySerialization.
+--*/
+
+#pragma once
+
+class Settings;
+
+class SettingsCache
+{
+public:
+    static bool s_TryLoadCachedSettings(_In_ PCWSTR const pwszTranslatedTitle,
+                                        _Inout_ Settings* const pSettings);
+
+    static void s_CacheSettings(_In_ PCWSTR const pwszTranslatedTitle,
+                                _In_ const Settings* const pSettings);
+
+private:
+    // Bump when the Settings layout or the cached header changes; stale
+    // sections from older binaries then simply miss.
+    static const DWORD sc_dwCacheVersion = 1;
+
+    struct _CacheHeader
+    {
+        DWORD dwVersion;
+        DWORD cbSettings;
+        FILETIME ftRegistryLastWrite;
+        LONG fValid;
+        // Followed immediately by cbSettings bytes of Settings data.
+    };
+
+    [[nodiscard]] static NTSTATUS s_QueryRegistryLastWriteTime(_In_ PCWSTR const pwszTranslatedTitle,
+                                                               _Out_ FILETIME* const pftLastWrite);
+
+    static ULONGLONG s_HashTitle(_In_ PCWSTR const pwszTranslatedTitle);
+
+    [[nodiscard]] static NTSTATUS s_BuildSectionName(_In_ PCWSTR const pwszTranslatedTitle,
+                                                     _Out_writes_(cchSectionName) PWSTR const pwszSectionName,
+                                                     const size_t cchSectionName);
+};
@@ -20,9 +20,83 @@ HRESULT RenderEngineBase::InvalidateTitle(const std::wstring& proposedTitle) noe
         _titleChanged = true;
     }
 
+    // S_FALSE tells the renderer this engine already emitted that exact title
+    // and has nothing pending, so the call doesn't need to cost a frame -
+    // shells like posh-git re-assert an unchanged title on every prompt.
+    return _titleChanged ? S_OK : S_FALSE;
+}
+
+// Routine Description:
+// - Handles a block move within the viewport. Engines that can express the
+//      move to their presentation target override this - everything else
+//      just needs the destination and the uncovered area repainted.
+// Arguments:
+// - source - Where the block moved from. Exclusive, viewport coordinates.
+// - target - Where the block moved to.
+// - fill - The area the move uncovered, possibly empty.
+// Return Value:
+// - S_OK, else an appropriate HRESULT from the invalidation.
+HRESULT RenderEngineBase::InvalidateScrollRegion(const SMALL_RECT source,
+                                                 const SMALL_RECT target,
+                                                 const SMALL_RECT fill) noexcept
+{
+    UNREFERENCED_PARAMETER(source);
+
+    RETURN_IF_FAILED(Invalidate(&target));
+    if (fill.Bottom > fill.Top && fill.Right > fill.Left)
+    {
+        RETURN_IF_FAILED(Invalidate(&fill));
+    }
     return S_OK;
 }
 
+// Routine Description:
+// - Returns the dirty span of a single row. Engines that only track a single
+//      bounding rectangle get the full width of that rectangle for every row
+//      inside it - engines with finer-grained tracking override this.
+// Arguments:
+// - sRow - The row to query, in the same coordinate space as GetDirtyRectInChars.
+// Return Value:
+// - The inclusive character span of the given row that needs repainting. An
+//      empty rect (Right < Left) if the row is clean.
+SMALL_RECT RenderEngineBase::GetDirtyRowInChars(const SHORT sRow)
+{
+    const SMALL_RECT dirty = GetDirtyRectInChars();
+    if (sRow < dirty.Top || sRow > dirty.Bottom)
+    {
+        return { 0, sRow, -1, sRow };
+    }
+    return { dirty.Left, sRow, dirty.Right, sRow };
+}
+
+// Routine Description:
+// - Whether a row this engine does not repaint keeps showing the content it
+//      painted before. Surface-backed engines erase the invalid region at the
+//      start of every frame, so a skipped row would come out blank - engines
+//      that only emit deltas override this to let the renderer elide rows
+//      whose content hasn't changed.
+// Arguments:
+// - <none>
+// Return Value:
+// - false - repainting the full invalid region is required.
+bool RenderEngineBase::RetainsPaintedContent() const noexcept
+{
+    return false;
+}
+
+// Routine Description:
+// - Blocks until the engine can accept a new frame. Most engines have nothing
+//      to wait on, so sleep for the frame interval the render thread used to
+//      enforce - engines that can pace against their consumer override this.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void RenderEngineBase::WaitUntilCanRender() noexcept
+{
+    Sleep(s_FrameLimitMilliseconds);
+}
+
 HRESULT RenderEngineBase::UpdateTitle(const std::wstring& newTitle) noexcept
 {
     HRESULT hr = S_FALSE;
@@ -5,6 +5,8 @@
 
 #include "renderer.hpp"
 
+#include "../../inc/AllocAccounting.hpp"
+
 #pragma hdrstop
 
 using namespace Microsoft::Console::Render;
@@ -47,6 +49,15 @@ Renderer::~Renderer()
     _destructing = true;
 }
 
+// Routine Description:
+// - Returns the number of frames composed since this renderer was created.
+// Return Value:
+// - The frame count. Wraps; consumers should diff successive samples.
+uint32_t Renderer::GetFramesPainted() const noexcept
+{
+    return _cFramesPainted.load(std::memory_order_relaxed);
+}
+
 // Routine Description:
 // - Walks through the console data structures to compose a new frame based on the data that has changed since last call and outputs it to the connected rendering engine.
 // Arguments:
@@ -60,18 +71,105 @@ Renderer::~Renderer()
         return S_FALSE;
     }
 
-    for (IRenderEngine* const pEngine : _rgpEngines)
+    if (_rgpEngines.empty())
+    {
+        return S_OK;
+    }
+
+    _cFramesPainted.fetch_add(1, std::memory_order_relaxed);
+
+    // The common case is a single engine attached - just paint it right here.
+    if (_rgpEngines.size() == 1)
+    {
+        LOG_IF_FAILED(_PaintFrameForEngine(_rgpEngines.front()));
+        return S_OK;
+    }
+
+    try
     {
-        LOG_IF_FAILED(_PaintFrameForEngine(pEngine));
+        // With several engines attached (the window plus the conpty VT
+        // passthrough), hand all but the last to the system thread pool so
+        // they compose concurrently. Each paint takes the console lock for
+        // the phases that read live state, but the expensive glyph pass runs
+        // against its own snapshot without the lock - that's where the
+        // engines genuinely overlap.
+        const size_t cEngines = _rgpEngines.size();
+
+        std::vector<_PaintJob> jobs;
+        jobs.reserve(cEngines - 1);
+        std::vector<wil::unique_event> events;
+        events.reserve(cEngines - 1);
+        std::vector<HANDLE> completions;
+        completions.reserve(cEngines - 1);
+
+        for (size_t iEngine = 0; iEngine < cEngines - 1; iEngine++)
+        {
+            events.emplace_back(wil::EventOptions::None);
+            jobs.push_back({ this, _rgpEngines.at(iEngine), events.back().get() });
+
+            if (TrySubmitThreadpoolCallback(s_PaintJobCallback, &jobs.back(), nullptr))
+            {
+                completions.push_back(events.back().get());
+            }
+            else
+            {
+                // Couldn't queue the job - just paint it here and now.
+                LOG_IF_FAILED(_PaintFrameForEngine(jobs.back().pEngine));
+            }
+        }
+
+        // Paint the last engine on this thread while the others are in flight.
+        LOG_IF_FAILED(_PaintFrameForEngine(_rgpEngines.back()));
+
+        if (!completions.empty())
+        {
+            WaitForMultipleObjects(gsl::narrow<DWORD>(completions.size()), completions.data(), TRUE, INFINITE);
+        }
     }
+    CATCH_RETURN();
 
     return S_OK;
 }
 
+// Routine Description:
+// - Thread pool callback for one engine's paint when multiple engines render
+//      the same frame. See PaintFrame.
+// Arguments:
+// - pvContext - The _PaintJob naming the renderer, engine, and completion event.
+// Return Value:
+// - <none>
+void CALLBACK Renderer::s_PaintJobCallback(_Inout_ PTP_CALLBACK_INSTANCE /*pInstance*/, _Inout_opt_ PVOID pvContext)
+{
+    _PaintJob* const pJob = static_cast<_PaintJob*>(pvContext);
+    if (pJob != nullptr)
+    {
+        LOG_IF_FAILED(pJob->pRenderer->_PaintFrameForEngine(pJob->pEngine));
+        SetEvent(pJob->hCompleted);
+    }
+}
+
+// Routine Description:
+// - Blocks until the engines are ready for the render thread to compose the
+//      next frame, so we paint at the pace of the consumer instead of a timer.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Renderer::WaitUntilCanRender()
+{
+    for (IRenderEngine* const pEngine : _rgpEngines)
+    {
+        pEngine->WaitUntilCanRender();
+    }
+}
+
 [[nodiscard]] HRESULT Renderer::_PaintFrameForEngine(_In_ IRenderEngine* const pEngine)
 {
     FAIL_FAST_IF_NULL(pEngine); // This is a programming error. Fail fast.
 
+    // Charge heap traffic below here to the renderer in accounting builds.
+    const AllocScope allocScope(AllocAccounting::Tag::Renderer);
+
     _pData->LockConsole();
     auto unlock = wil::scope_exit([&]() {
         _pData->UnlockConsole();
@@ -106,7 +204,18 @@ Renderer::~Renderer()
     RETURN_IF_FAILED(_PaintBackground(pEngine));
 
     // 2. Paint Rows of Text
-    _PaintBufferOutput(pEngine);
+    // Snapshot the dirty rows while we still hold the lock, then let go of it
+    // so the output thread can keep writing while the engine draws glyphs.
+    // The later phases read live console state again, so the lock is retaken
+    // as soon as the text is on its way to the engine.
+    {
+        const auto snapshot = _SnapshotBufferOutput(pEngine);
+        _pData->UnlockConsole();
+        auto relock = wil::scope_exit([&]() {
+            _pData->LockConsole();
+        });
+        _PaintBufferOutput(pEngine, snapshot);
+    }
 
     // 3. Paint overlays that reside above the text buffer
     _PaintOverlays(pEngine);
@@ -139,6 +248,13 @@ void Renderer::_NotifyPaintFrame()
     _pThread->NotifyPaint();
 }
 
+void Renderer::_NotifyInteractivePaintFrame()
+{
+    // The thread will skip its usual pacing for this frame so the update lands
+    // with as little latency as possible.
+    _pThread->NotifyInteractivePaint();
+}
+
 // Routine Description:
 // - Called when the system has requested we redraw a portion of the console.
 // Arguments:
@@ -151,6 +267,10 @@ void Renderer::TriggerSystemRedraw(const RECT* const prcDirtyClient)
         LOG_IF_FAILED(pEngine->InvalidateSystem(prcDirtyClient));
     });
 
+    // The damage came from outside the buffer, so last-painted row content
+    // can't be trusted to still be on screen.
+    _forgetPaintedRows = true;
+
     _NotifyPaintFrame();
 }
 
@@ -216,7 +336,9 @@ void Renderer::TriggerRedrawCursor(const COORD* const pcoord)
             }
         }
 
-        _NotifyPaintFrame();
+        // Cursor updates track user interaction (typing echo, cursor keys), so
+        // ask the thread to deliver this one without its usual pacing.
+        _NotifyInteractivePaintFrame();
     }
 }
 
@@ -233,6 +355,10 @@ void Renderer::TriggerRedrawAll()
         LOG_IF_FAILED(pEngine->InvalidateAll());
     });
 
+    // Full redraws are requested for reasons row versions can't see (color
+    // scheme changes, for one), so honor them for every row.
+    _forgetPaintedRows = true;
+
     _NotifyPaintFrame();
 }
 
@@ -275,14 +401,61 @@ void Renderer::TriggerSelection()
         // Get selection rectangles
         const auto rects = _GetSelectionRects();
 
-        std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(rects));
-        });
+        // Diff against the previous selection at row-span granularity.
+        // Both vectors hold one rect per row ordered by Top, so a merge
+        // walk finds exactly the rows where a span appeared, disappeared,
+        // or changed width - during a drag that's typically one or two
+        // rows, not the whole selection.
+        std::vector<SMALL_RECT> changed;
+        size_t iPrev = 0;
+        size_t iNew = 0;
+        while (iPrev < _previousSelection.size() || iNew < rects.size())
+        {
+            if (iNew >= rects.size())
+            {
+                changed.push_back(_previousSelection[iPrev++]);
+            }
+            else if (iPrev >= _previousSelection.size())
+            {
+                changed.push_back(rects[iNew++]);
+            }
+            else if (_previousSelection[iPrev].Top < rects[iNew].Top)
+            {
+                changed.push_back(_previousSelection[iPrev++]);
+            }
+            else if (rects[iNew].Top < _previousSelection[iPrev].Top)
+            {
+                changed.push_back(rects[iNew++]);
+            }
+            else
+            {
+                const auto& prevRect = _previousSelection[iPrev];
+                const auto& newRect = rects[iNew];
+                if (prevRect.Left != newRect.Left ||
+                    prevRect.Right != newRect.Right ||
+                    prevRect.Bottom != newRect.Bottom)
+                {
+                    changed.push_back(prevRect);
+                    changed.push_back(newRect);
+                }
+                ++iPrev;
+                ++iNew;
+            }
+        }
 
-        _previousSelection = rects;
+        if (!changed.empty())
+        {
+            std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
+                LOG_IF_FAILED(pEngine->InvalidateSelection(changed));
+            });
 
-        _NotifyPaintFrame();
+            // Selection changes repaint rows whose content didn't change.
+            _forgetPaintedRows = true;
+
+            _NotifyPaintFrame();
+        }
+
+        _previousSelection = rects;
     }
     CATCH_LOG();
 }
@@ -344,6 +517,67 @@ void Renderer::TriggerScroll(const COORD* const pcoordDelta)
     _NotifyPaintFrame();
 }
 
+// Routine Description:
+// - Called when a block of the buffer was copied in a scroll-like fashion
+//      (ScrollConsoleScreenBuffer, DECSTBM margin scrolls). Engines that can
+//      replay the move to their presentation target skip repainting the moved
+//      block; for everyone else this decays into the redraws the caller
+//      would otherwise have triggered.
+// Arguments:
+// - source - Buffer region the block was copied from.
+// - target - Buffer region the block was copied to.
+// - fill - Buffer region the copy uncovered.
+// Return Value:
+// - <none>
+void Renderer::TriggerScrollRegion(const Viewport& source, const Viewport& target, const Viewport& fill)
+{
+    Viewport view = _pData->GetViewport();
+
+    SMALL_RECT srSource = source.ToExclusive();
+    SMALL_RECT srTarget = target.ToExclusive();
+
+    // The move is only expressible to an engine if both halves are entirely
+    //      visible - trimming a partially visible move would falsify its
+    //      delta. Compare the trimmed rects to the originals to find out.
+    const auto equalRect = [](const SMALL_RECT& a, const SMALL_RECT& b) {
+        return a.Left == b.Left && a.Top == b.Top && a.Right == b.Right && a.Bottom == b.Bottom;
+    };
+    SMALL_RECT trimmedSource = srSource;
+    SMALL_RECT trimmedTarget = srTarget;
+    const bool fullyVisible = view.TrimToViewport(&trimmedSource) &&
+                              view.TrimToViewport(&trimmedTarget) &&
+                              equalRect(trimmedSource, srSource) &&
+                              equalRect(trimmedTarget, srTarget);
+
+    if (!fullyVisible)
+    {
+        TriggerRedraw(target); // this will notify to paint if we need it.
+        TriggerRedraw(fill);
+        return;
+    }
+
+    view.ConvertToOrigin(&srSource);
+    view.ConvertToOrigin(&srTarget);
+
+    // The fill can poke outside the viewport on its own without affecting
+    //      the move - engines only invalidate it, so trim it like any redraw.
+    SMALL_RECT srFill = fill.ToExclusive();
+    if (view.TrimToViewport(&srFill))
+    {
+        view.ConvertToOrigin(&srFill);
+    }
+    else
+    {
+        srFill = { 0, 0, 0, 0 };
+    }
+
+    std::for_each(_rgpEngines.begin(), _rgpEngines.end(), [&](IRenderEngine* const pEngine) {
+        LOG_IF_FAILED(pEngine->InvalidateScrollRegion(srSource, srTarget, srFill));
+    });
+
+    _NotifyPaintFrame();
+}
+
 // Routine Description:
 // - Called when the text buffer is about to circle its backing buffer.
 //      A renderer might want to get painted before that happens.
@@ -376,11 +610,22 @@ void Renderer::TriggerCircling()
 void Renderer::TriggerTitleChange()
 {
     const std::wstring newTitle = _pData->GetConsoleTitle();
+    bool fTitlePending = false;
     for (IRenderEngine* const pEngine : _rgpEngines)
     {
-        LOG_IF_FAILED(pEngine->InvalidateTitle(newTitle));
+        const HRESULT hr = pEngine->InvalidateTitle(newTitle);
+        LOG_IF_FAILED(hr);
+
+        // S_FALSE means the engine already emitted this exact title.
+        fTitlePending = fTitlePending || (hr == S_OK);
+    }
+
+    // Only wake the render thread when some engine has a new title to emit;
+    // the emission itself stays coalesced into that engine's next frame.
+    if (fTitlePending)
+    {
+        _NotifyPaintFrame();
     }
-    _NotifyPaintFrame();
 }
 
 // Routine Description:
@@ -410,6 +655,9 @@ void Renderer::TriggerFontChange(const int iDpi, const FontInfoDesired& FontInfo
         LOG_IF_FAILED(pEngine->UpdateFont(FontInfoDesired, FontInfo));
     });
 
+    // Everything renders differently in a new font, whatever its version says.
+    _forgetPaintedRows = true;
+
     _NotifyPaintFrame();
 }
 
@@ -526,7 +774,7 @@ void Renderer::WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs)
 // - <none>
 // Return Value:
 // - <none>
-void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
+Renderer::BufferSnapshot Renderer::_SnapshotBufferOutput(_In_ IRenderEngine* const pEngine)
 {
     // This is the subsection of the entire screen buffer that is currently being presented.
     // It can move left/right or top/bottom depending on how the viewport is scrolled
@@ -543,50 +791,213 @@ void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
 
     // The intersection between what is dirty on the screen (in need of repaint)
     // and what is supposed to be visible on the screen (the viewport) is what
-    // we need to walk through line-by-line and repaint onto the screen.
+    // we need to copy out and repaint onto the screen.
     const auto redraw = Viewport::Intersect(dirty, view);
 
-    // Shortcut: don't bother redrawing if the width is 0.
-    if (redraw.Width() > 0)
+    BufferSnapshot snapshot{ nullptr, redraw, view, {} };
+
+    // Shortcut: don't bother copying anything if the region is empty.
+    if (redraw.Width() > 0 && redraw.Height() > 0)
+    {
+        snapshot.buffer = _pData->GetTextBuffer().MakeSnapshot(redraw.Top(), redraw.Height());
+
+        // Stamp each copied row's identity and text version while we still
+        // hold the lock, so the paint phase can check retained segmentations
+        // against them afterwards.
+        snapshot.rowTextVersions.reserve(gsl::narrow<size_t>(redraw.Height()));
+        {
+            const auto& liveBuffer = _pData->GetTextBuffer();
+            for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
+            {
+                const auto& liveRow = liveBuffer.GetRowByOffset(row);
+                snapshot.rowTextVersions.emplace_back(liveRow.GetId(), liveRow.GetTextVersion());
+            }
+        }
+
+        // For engines that retain what they painted, compare each row's
+        // identity and content version against what this engine painted last
+        // frame. Invalidation granularity is rectangles, so a redraw region
+        // routinely spans rows whose content never changed - those can be
+        // skipped outright. Rows that changed (or that we've never painted
+        // here) get stamped with their current version now, while we still
+        // hold the console lock.
+        if (pEngine->RetainsPaintedContent())
+        {
+            if (_forgetPaintedRows)
+            {
+                _paintedRowVersions.clear();
+                _forgetPaintedRows = false;
+            }
+
+            auto& record = _paintedRowVersions[pEngine];
+
+            // A moved or resized viewport invalidates every remembered row.
+            if (record.viewOrigin.X != view.Origin().X ||
+                record.viewOrigin.Y != view.Origin().Y ||
+                record.rows.size() != gsl::narrow<size_t>(view.Height()))
+            {
+                record.viewOrigin = view.Origin();
+                // Row IDs are never negative, so this stamp can't match.
+                record.rows.assign(gsl::narrow<size_t>(view.Height()), { -1, 0 });
+            }
+
+            const auto& buffer = _pData->GetTextBuffer();
+            snapshot.unchangedRows.resize(gsl::narrow<size_t>(redraw.Height()), false);
+
+            for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
+            {
+                const auto& liveRow = buffer.GetRowByOffset(row);
+                const std::pair<SHORT, size_t> stamp{ liveRow.GetId(), liveRow.GetVersion() };
+                auto& painted = record.rows.at(gsl::narrow<size_t>(row - view.Top()));
+
+                snapshot.unchangedRows.at(row - redraw.Top()) = (painted == stamp);
+                painted = stamp;
+            }
+        }
+    }
+
+    return snapshot;
+}
+
+void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine, const BufferSnapshot& snapshot)
+{
+    // An empty snapshot means there was nothing to redraw.
+    if (!snapshot.buffer)
+    {
+        return;
+    }
+
+    const auto& view = snapshot.view;
+    const auto& redraw = snapshot.redraw;
+
+    // Segmentations retained from earlier paints are only reusable while the
+    // viewport stays where it was; a move or resize re-keys every row.
+    auto& segRecord = _rowSegmentations[pEngine];
+    if (segRecord.viewOrigin.X != view.Origin().X ||
+        segRecord.viewOrigin.Y != view.Origin().Y ||
+        segRecord.rows.size() != gsl::narrow<size_t>(view.Height()))
+    {
+        segRecord.viewOrigin = view.Origin();
+        segRecord.rows.clear();
+        segRecord.rows.resize(gsl::narrow<size_t>(view.Height()));
+    }
+
+    // Now walk through each row of text that we need to redraw.
+    for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
     {
-        // Retrieve the text buffer so we can read information out of it.
-        const auto& buffer = _pData->GetTextBuffer();
+        // The snapshot recorded which rows still hold exactly what this
+        // engine painted before - nothing to do for those.
+        if (!snapshot.unchangedRows.empty() && snapshot.unchangedRows.at(row - redraw.Top()))
+        {
+            continue;
+        }
+
+        // Ask the engine how much of this row is actually dirty. Engines that
+        // track per-row spans can narrow the repaint well below the bounding
+        // rectangle, so two distant updates don't repaint everything between
+        // them. The query is in screen coordinates, like GetDirtyRectInChars.
+        const auto rowDirty = Viewport::Offset(
+            Viewport::FromInclusive(pEngine->GetDirtyRowInChars(gsl::narrow_cast<SHORT>(row - view.Top()))),
+            view.Origin());
+
+        // Calculate the boundaries of a single line. This is from the left to right edge of the dirty
+        // area in width and exactly 1 tall, narrowed to the row's own span.
+        const auto bufferLine = Viewport::Intersect(
+            rowDirty,
+            Viewport::FromDimensions({ redraw.Left(), row }, { redraw.Width(), 1 }));
+
+        // Nothing on this row changed - skip it entirely.
+        if (bufferLine.Width() <= 0)
+        {
+            continue;
+        }
+
+        // Find where on the screen we should place this line information. This requires us to re-map
+        // the buffer-based origin of the line back onto the screen-based origin of the line
+        // For example, the screen might say we need to paint 1,1 because it is dirty but the viewport is actually looking
+        // at 13,26 relative to the buffer.
+        // This means that we need 14,27 out of the backing buffer to fill in the 1,1 cell of the screen.
+        const auto screenLine = Viewport::Offset(bufferLine, -view.Origin());
+
+        // The snapshot's first row is the top of the redraw region, so shift
+        // the line up accordingly before asking the snapshot for cells.
+        const auto snapshotLine = Viewport::Offset(bufferLine, { 0, gsl::narrow<SHORT>(-redraw.Top()) });
+
+        // Attribute-only changes (selection drag, SGR recolor of existing
+        // text) leave the glyphs alone. If the segmentation retained from the
+        // last paint of this row still matches the text and covers the dirty
+        // span, reuse it and merely refresh the brushes per attribute run
+        // instead of re-clustering the cell data.
+        auto& segEntry = segRecord.rows.at(gsl::narrow<size_t>(row - view.Top()));
+        const auto& stamp = snapshot.rowTextVersions.at(gsl::narrow<size_t>(row - redraw.Top()));
+
+        if (segEntry.rowId == stamp.first &&
+            segEntry.textVersion == stamp.second &&
+            segEntry.startColumn <= bufferLine.Left() &&
+            segEntry.startColumn + segEntry.totalColumns >= bufferLine.RightExclusive())
+        {
+            const auto& attrRow = snapshot.buffer->GetRowByOffset(gsl::narrow<size_t>(row - redraw.Top())).GetAttrRow();
+            _PaintBufferLineFromCache(pEngine, attrRow, segEntry, bufferLine, view.Origin());
+            continue;
+        }
+
+        // The entry is stale (or has never been filled); rebuild it while
+        // painting. It only becomes valid again once the paint succeeds.
+        segEntry.rowId = -1;
+        segEntry.startColumn = bufferLine.Left();
+        segEntry.totalColumns = 0;
+        segEntry.text.clear();
+        segEntry.clusters.clear();
+
+        // Retrieve the cell information iterator limited to just this line we want to redraw.
+        auto it = snapshot.buffer->GetCellDataAt(snapshotLine.Origin(), snapshotLine);
+
+        // Ask the helper to paint through this specific line.
+        _PaintBufferOutputHelper(pEngine, it, screenLine.Origin(), &segEntry);
+
+        segEntry.rowId = stamp.first;
+        segEntry.textVersion = stamp.second;
+    }
+}
 
-        // Now walk through each row of text that we need to redraw.
-        for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
+// Routine Description:
+// - Drops the last-painted stamp for one viewport row of an engine, so the
+//      next frame repaints it even if its buffer content hasn't changed.
+//      Needed when something other than the buffer (an overlay, the selection)
+//      was painted over the row - its pixels no longer match the row content
+//      the stamp vouches for. Must be called while the console lock is held.
+// Arguments:
+// - pEngine - The engine whose record to adjust.
+// - viewportRow - The row, in viewport coordinates. Out-of-range rows are ignored.
+// Return Value:
+// - <none>
+void Renderer::_ForgetPaintedRow(_In_ IRenderEngine* const pEngine, const SHORT viewportRow)
+{
+    const auto it = _paintedRowVersions.find(pEngine);
+    if (it != _paintedRowVersions.end())
+    {
+        auto& rows = it->second.rows;
+        if (viewportRow >= 0 && gsl::narrow<size_t>(viewportRow) < rows.size())
         {
-            // Calculate the boundaries of a single line. This is from the left to right edge of the dirty
-            // area in width and exactly 1 tall.
-            const auto bufferLine = Viewport::FromDimensions({ redraw.Left(), row }, { redraw.Width(), 1 });
-
-            // Find where on the screen we should place this line information. This requires us to re-map
-            // the buffer-based origin of the line back onto the screen-based origin of the line
-            // For example, the screen might say we need to paint 1,1 because it is dirty but the viewport is actually looking
-            // at 13,26 relative to the buffer.
-            // This means that we need 14,27 out of the backing buffer to fill in the 1,1 cell of the screen.
-            const auto screenLine = Viewport::Offset(bufferLine, -view.Origin());
-
-            // Retrieve the cell information iterator limited to just this line we want to redraw.
-            auto it = buffer.GetCellDataAt(bufferLine.Origin(), bufferLine);
-
-            // Ask the helper to paint through this specific line.
-            _PaintBufferOutputHelper(pEngine, it, screenLine.Origin());
+            rows.at(gsl::narrow<size_t>(viewportRow)) = { -1, 0 };
         }
     }
 }
 
 void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                                         TextBufferCellIterator it,
-                                        const COORD target)
+                                        const COORD target,
+                                        _In_opt_ CachedRowSegmentation* pCacheEntry)
 {
     // If we have valid data, let's figure out how to draw it.
     if (it)
     {
-        // TODO: MSFT: 20961091 -  This is a perf issue. Instead of rebuilding this and allocing memory to hold the reinterpretation,
-        // we should have an iterator/view adapter for the rendering.
-        // That would probably also eliminate the RenderData needing to give us the entire TextBuffer as well...
-        // Retrieve the iterator for one line of information.
-        std::vector<Cluster> clusters;
+        // The clusters only carry views into the row storage, so the vector is
+        // the lone allocation here. Keep one per thread (engines may paint
+        // concurrently on pool threads) and reuse its capacity between lines
+        // and frames - a full repaint settles at zero heap allocations.
+        thread_local static std::vector<Cluster> clusters;
+        clusters.clear();
         size_t cols = 0;
 
         // Retrieve the first color.
@@ -595,6 +1006,10 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
         // And hold the point where we should start drawing.
         auto screenPoint = target;
 
+        // Decoration spans merged across adjacent runs of this row; flushed
+        // once the run of identical decorations ends or the row is done.
+        PendingGridLines pendingGridLines;
+
         // This outer loop will continue until we reach the end of the text we are trying to draw.
         while (it)
         {
@@ -624,9 +1039,58 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                     break;
                 }
 
+                // Batch path: pull the longest stretch of simple single-column cells
+                // sharing this attribute out of the iterator in one call and emit
+                // their clusters without paying the per-cell iterator refresh.
+                if (const auto span = it.TryGetSpan(); span && span->text.size() > 1)
+                {
+                    const auto& text = span->text;
+                    for (size_t i = 0; i < text.size(); ++i)
+                    {
+                        clusters.emplace_back(std::wstring_view{ text.data() + i, 1 }, 1);
+                    }
+
+                    if (pCacheEntry)
+                    {
+                        for (size_t i = 0; i < text.size(); ++i)
+                        {
+                            pCacheEntry->clusters.push_back({ pCacheEntry->text.size(), 1, 1 });
+                            pCacheEntry->text.push_back(text[i]);
+                        }
+                        pCacheEntry->totalColumns += gsl::narrow<SHORT>(text.size());
+                    }
+
+                    cols += text.size();
+                    it += gsl::narrow_cast<ptrdiff_t>(text.size());
+                    continue;
+                }
+
                 // Walk through the text data and turn it into rendering clusters.
                 clusters.emplace_back(it->Chars(), it->Columns());
 
+                if (pCacheEntry)
+                {
+                    const auto& added = clusters.back();
+                    if (added.GetColumns() > 0)
+                    {
+                        pCacheEntry->clusters.push_back({ pCacheEntry->text.size(), added.GetText().size(), added.GetColumns() });
+                        pCacheEntry->text.append(added.GetText());
+                        pCacheEntry->totalColumns += gsl::narrow<SHORT>(added.GetColumns());
+                    }
+                    else
+                    {
+                        // A zero-column cluster would break the column
+                        // arithmetic the cache relies on; drop what was
+                        // recorded and leave this row uncached. The empty
+                        // entry can never satisfy a span, so it reads as a
+                        // miss even after the caller stamps it.
+                        pCacheEntry->text.clear();
+                        pCacheEntry->clusters.clear();
+                        pCacheEntry->totalColumns = 0;
+                        pCacheEntry = nullptr;
+                    }
+                }
+
                 // Advance the cluster and column counts.
                 const auto columnCount = clusters.back().GetColumns();
                 it += columnCount > 0 ? columnCount : 1; // prevent infinite loop for no visible columns
@@ -642,12 +1106,88 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
             if (_pData->IsGridLineDrawingAllowed())
             {
                 // We're only allowed to draw the grid lines under certain circumstances.
-                _PaintBufferOutputGridLineHelper(pEngine, currentRunColor, cols, screenPoint);
+                _AccumulateGridLines(pEngine, currentRunColor, cols, screenPoint, pendingGridLines);
             }
         }
+
+        _FlushGridLines(pEngine, pendingGridLines);
     }
 }
 
+// Routine Description:
+// - Repaints one row span from the cluster segmentation retained the last
+//      time the row was painted, reading only the row's current attributes.
+//      Used when an invalidation covers text that hasn't changed (selection
+//      drag, SGR recolor), where rebuilding the clusters from cell data would
+//      dominate the repaint cost.
+// Arguments:
+// - pEngine - The engine to paint with.
+// - attrRow - The row's current attributes, from this frame's snapshot.
+// - entry - The retained segmentation. Must cover bufferLine.
+// - bufferLine - The span to repaint, in buffer coordinates, exactly 1 tall.
+// - viewOrigin - Origin of the viewport, to map buffer onto screen coordinates.
+// Return Value:
+// - <none>
+void Renderer::_PaintBufferLineFromCache(_In_ IRenderEngine* const pEngine,
+                                         const ATTR_ROW& attrRow,
+                                         const CachedRowSegmentation& entry,
+                                         const Microsoft::Console::Types::Viewport bufferLine,
+                                         const COORD viewOrigin)
+{
+    // See the matching comment in _PaintBufferOutputHelper.
+    thread_local static std::vector<Cluster> clusters;
+
+    // Skip clusters entirely left of the requested span. A wide glyph
+    // straddling the edge is included whole; painting a column early is
+    // harmless and keeps both halves consistent.
+    size_t next = 0;
+    SHORT column = entry.startColumn;
+    while (next < entry.clusters.size() &&
+           column + gsl::narrow<SHORT>(entry.clusters.at(next).columns) <= bufferLine.Left())
+    {
+        column += gsl::narrow<SHORT>(entry.clusters.at(next).columns);
+        next++;
+    }
+
+    COORD screenPoint{ gsl::narrow_cast<SHORT>(column - viewOrigin.X),
+                       gsl::narrow_cast<SHORT>(bufferLine.Top() - viewOrigin.Y) };
+
+    // See the matching comment in _PaintBufferOutputHelper.
+    PendingGridLines pendingGridLines;
+
+    while (next < entry.clusters.size() && column < bufferLine.RightExclusive())
+    {
+        // Everything from here to the end of the current attribute run forms
+        // one engine call.
+        size_t applies = 0;
+        const auto attr = attrRow.GetAttrByColumn(gsl::narrow<size_t>(column), &applies);
+
+        THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, attr, false));
+
+        clusters.clear();
+        size_t cols = 0;
+        while (next < entry.clusters.size() && column < bufferLine.RightExclusive() && cols < applies)
+        {
+            const auto& cluster = entry.clusters.at(next);
+            clusters.emplace_back(std::wstring_view{ entry.text.data() + cluster.charOffset, cluster.charLength }, cluster.columns);
+            cols += cluster.columns;
+            column += gsl::narrow<SHORT>(cluster.columns);
+            next++;
+        }
+
+        THROW_IF_FAILED(pEngine->PaintBufferLine({ clusters.data(), clusters.size() }, screenPoint, false));
+
+        if (_pData->IsGridLineDrawingAllowed())
+        {
+            _AccumulateGridLines(pEngine, attr, cols, screenPoint, pendingGridLines);
+        }
+
+        screenPoint.X += gsl::narrow<SHORT>(cols);
+    }
+
+    _FlushGridLines(pEngine, pendingGridLines);
+}
+
 // Method Description:
 // - Generates a IRenderEngine::GridLines structure from the values in the
 //      provided textAttribute
@@ -684,26 +1224,71 @@ IRenderEngine::GridLines Renderer::s_GetGridlines(const TextAttribute& textAttri
 
 // Routine Description:
 // - Paint helper for primary buffer output function.
-// - This particular helper sets up the various box drawing lines that can be inscribed around any character in the buffer (left, right, top, underline).
+// - Collects the box drawing lines that can be inscribed around any character in the buffer (left, right, top, underline)
+//      for one attribute run, merging the run into the pending span when it continues the same decoration in the same
+//      color. The lines are drawn per cell, so two adjacent runs with identical decorations produce identical pixels
+//      whether drawn separately or as one span - but the merged span costs a single engine call. A run that breaks the
+//      decoration (or a decoration-free run) flushes whatever was pending.
 // - See also: All related helpers and buffer output functions.
 // Arguments:
 // - textAttribute - The line/box drawing attributes to use for this particular run.
-// - cchLine - The length of both pwsLine and pbKAttrsLine.
-// - coordTarget - The X/Y coordinate position in the buffer which we're attempting to start rendering from.
+// - cchLine - The length of the run, in columns.
+// - coordTarget - The X/Y coordinate position in the buffer which the run starts at.
+// - pending - The accumulated decoration span. The caller owns one per row paint and must flush it when the row is done.
 // Return Value:
 // - <none>
-void Renderer::_PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine,
-                                                const TextAttribute textAttribute,
-                                                const size_t cchLine,
-                                                const COORD coordTarget)
+void Renderer::_AccumulateGridLines(_In_ IRenderEngine* const pEngine,
+                                    const TextAttribute textAttribute,
+                                    const size_t cchLine,
+                                    const COORD coordTarget,
+                                    PendingGridLines& pending)
 {
+    // Convert console grid line representations into rendering engine enum representations.
+    const IRenderEngine::GridLines lines = Renderer::s_GetGridlines(textAttribute);
+
+    if (lines == IRenderEngine::GridLines::None)
+    {
+        // An undecorated run ends any pending span.
+        _FlushGridLines(pEngine, pending);
+        return;
+    }
+
     const COLORREF rgb = _pData->GetForegroundColor(textAttribute);
 
-    // Convert console grid line representations into rendering engine enum representations.
-    IRenderEngine::GridLines lines = Renderer::s_GetGridlines(textAttribute);
+    if (pending.cch > 0 &&
+        pending.lines == lines &&
+        pending.color == rgb &&
+        pending.target.Y == coordTarget.Y &&
+        pending.target.X + gsl::narrow<SHORT>(pending.cch) == coordTarget.X)
+    {
+        // Same decorations, same color, horizontally adjacent - extend.
+        pending.cch += cchLine;
+        return;
+    }
+
+    _FlushGridLines(pEngine, pending);
 
-    // Draw the lines
-    LOG_IF_FAILED(pEngine->PaintBufferGridLines(lines, rgb, cchLine, coordTarget));
+    pending.lines = lines;
+    pending.color = rgb;
+    pending.cch = cchLine;
+    pending.target = coordTarget;
+}
+
+// Routine Description:
+// - Draws the accumulated decoration span, if any, and resets it.
+// Arguments:
+// - pending - The accumulated decoration span.
+// Return Value:
+// - <none>
+void Renderer::_FlushGridLines(_In_ IRenderEngine* const pEngine,
+                               PendingGridLines& pending)
+{
+    if (pending.cch > 0)
+    {
+        LOG_IF_FAILED(pEngine->PaintBufferGridLines(pending.lines, pending.color, pending.cch, pending.target));
+        pending.cch = 0;
+        pending.lines = IRenderEngine::GridLines::None;
+    }
 }
 
 // Routine Description:
@@ -738,6 +1323,9 @@ void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine)
 
         // Draw it within the viewport
         LOG_IF_FAILED(pEngine->PaintCursor(options));
+
+        // An engine may have drawn the cursor over this row's cells.
+        _ForgetPaintedRow(pEngine, coordCursor.Y);
     }
 }
 
@@ -786,6 +1374,10 @@ void Renderer::_PaintOverlay(IRenderEngine& engine,
                 auto it = overlay.buffer.GetCellLineDataAt(source);
 
                 _PaintBufferOutputHelper(&engine, it, target);
+
+                // The overlay just drew over this row, so its pixels no
+                // longer reflect the buffer row's content.
+                _ForgetPaintedRow(&engine, iRow);
             }
         }
     }
@@ -834,6 +1426,12 @@ void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
             if (dirtyView.TrimToViewport(&rect))
             {
                 LOG_IF_FAILED(pEngine->PaintSelection(rect));
+
+                // The highlight drew over these rows.
+                for (auto srow = rect.Top; srow <= rect.Bottom; srow++)
+                {
+                    _ForgetPaintedRow(pEngine, srow);
+                }
             }
         }
     }
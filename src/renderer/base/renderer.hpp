@@ -47,6 +47,13 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT PaintFrame();
 
+        // Running count of frames composed, for perf instrumentation (the
+        // terminal's debug HUD samples the delta per second). Atomic because
+        // readers poll from other threads.
+        uint32_t GetFramesPainted() const noexcept;
+
+        void WaitUntilCanRender() override;
+
         void TriggerSystemRedraw(const RECT* const prcDirtyClient) override;
         void TriggerRedraw(const Microsoft::Console::Types::Viewport& region) override;
         void TriggerRedraw(const COORD* const pcoord) override;
@@ -57,6 +64,9 @@ namespace Microsoft::Console::Render
         void TriggerSelection() override;
         void TriggerScroll() override;
         void TriggerScroll(const COORD* const pcoordDelta) override;
+        void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& source,
+                                 const Microsoft::Console::Types::Viewport& target,
+                                 const Microsoft::Console::Types::Viewport& fill) override;
 
         void TriggerCircling() override;
         void TriggerTitleChange() override;
@@ -85,25 +95,129 @@ namespace Microsoft::Console::Render
         bool _destructing = false;
 
         void _NotifyPaintFrame();
+        void _NotifyInteractivePaintFrame();
 
         [[nodiscard]] HRESULT _PaintFrameForEngine(_In_ IRenderEngine* const pEngine);
 
+        // One paint dispatched to the system thread pool when multiple engines
+        // are attached, so they compose their frames concurrently.
+        struct _PaintJob
+        {
+            Renderer* pRenderer;
+            IRenderEngine* pEngine;
+            HANDLE hCompleted;
+        };
+
+        static void CALLBACK s_PaintJobCallback(_Inout_ PTP_CALLBACK_INSTANCE pInstance, _Inout_opt_ PVOID pvContext);
+
         bool _CheckViewportAndScroll();
 
         [[nodiscard]] HRESULT _PaintBackground(_In_ IRenderEngine* const pEngine);
 
-        void _PaintBufferOutput(_In_ IRenderEngine* const pEngine);
+        // Deep copy of the dirty rows plus the geometry needed to paint them,
+        // taken under the console lock so painting can happen without it.
+        struct BufferSnapshot
+        {
+            std::unique_ptr<TextBuffer> buffer;
+            Microsoft::Console::Types::Viewport redraw;
+            Microsoft::Console::Types::Viewport view;
+            // One flag per redraw row - true when the row still holds exactly
+            // the content this engine painted last time, so it can be skipped.
+            // Only populated for engines that retain painted content.
+            std::vector<bool> unchangedRows;
+            // Identity and text version of every redraw row, so the paint
+            // phase can tell without the lock whether a retained segmentation
+            // still matches the glyphs it was built from.
+            std::vector<std::pair<SHORT, size_t>> rowTextVersions;
+        };
+
+        BufferSnapshot _SnapshotBufferOutput(_In_ IRenderEngine* const pEngine);
+
+        // The identity and content version of every viewport row as it was
+        // last painted, kept per engine so _PaintBufferOutput can recognize
+        // rows that haven't changed since. Only touched under the console
+        // lock (snapshot time and the locked paint phases).
+        struct PaintedRowRecord
+        {
+            COORD viewOrigin = { 0, 0 };
+            std::vector<std::pair<SHORT, size_t>> rows;
+        };
+
+        std::map<IRenderEngine*, PaintedRowRecord> _paintedRowVersions;
+
+        std::atomic<uint32_t> _cFramesPainted{ 0 };
+
+        // Raised by triggers whose repaint isn't driven by row content (color
+        // scheme changes, system redraws, selection). Plain flag writes from
+        // other threads are fine - the map itself is only read under lock.
+        bool _forgetPaintedRows = false;
+
+        void _ForgetPaintedRow(_In_ IRenderEngine* const pEngine, const SHORT viewportRow);
+
+        // The cluster segmentation of a row as it was last painted, retained
+        // so an attribute-only repaint (selection drag, SGR recolor) can
+        // reuse the clustering and merely update brushes per run. The text is
+        // owned here because the paint-time snapshot it came from is
+        // discarded after each frame.
+        struct CachedRowSegmentation
+        {
+            struct ClusterSpan
+            {
+                size_t charOffset;
+                size_t charLength;
+                size_t columns;
+            };
+
+            SHORT rowId = -1;
+            size_t textVersion = 0;
+            SHORT startColumn = 0;
+            SHORT totalColumns = 0;
+            std::wstring text;
+            std::vector<ClusterSpan> clusters;
+        };
+
+        struct RowSegmentationRecord
+        {
+            COORD viewOrigin = { 0, 0 };
+            std::vector<CachedRowSegmentation> rows;
+        };
+
+        std::map<IRenderEngine*, RowSegmentationRecord> _rowSegmentations;
+
+        void _PaintBufferOutput(_In_ IRenderEngine* const pEngine, const BufferSnapshot& snapshot);
 
         void _PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                                       TextBufferCellIterator it,
-                                      const COORD target);
+                                      const COORD target,
+                                      _In_opt_ CachedRowSegmentation* pCacheEntry = nullptr);
+
+        void _PaintBufferLineFromCache(_In_ IRenderEngine* const pEngine,
+                                       const ATTR_ROW& attrRow,
+                                       const CachedRowSegmentation& entry,
+                                       const Microsoft::Console::Types::Viewport bufferLine,
+                                       const COORD viewOrigin);
 
         static IRenderEngine::GridLines s_GetGridlines(const TextAttribute& textAttribute) noexcept;
 
-        void _PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine,
-                                              const TextAttribute textAttribute,
-                                              const size_t cchLine,
-                                              const COORD coordTarget);
+        // A run of grid/underline decoration accumulated across adjacent
+        // attribute runs of one row, so the engine draws one primitive per
+        // contiguous decorated segment instead of one call per run.
+        struct PendingGridLines
+        {
+            IRenderEngine::GridLines lines = IRenderEngine::GridLines::None;
+            COLORREF color = 0;
+            size_t cch = 0;
+            COORD target = { 0, 0 };
+        };
+
+        void _AccumulateGridLines(_In_ IRenderEngine* const pEngine,
+                                  const TextAttribute textAttribute,
+                                  const size_t cchLine,
+                                  const COORD coordTarget,
+                                  PendingGridLines& pending);
+
+        void _FlushGridLines(_In_ IRenderEngine* const pEngine,
+                             PendingGridLines& pending);
 
         void _PaintSelection(_In_ IRenderEngine* const pEngine);
         void _PaintCursor(_In_ IRenderEngine* const pEngine);
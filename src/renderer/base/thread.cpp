@@ -15,6 +15,7 @@ RenderThread::RenderThread() :
     _hEvent(nullptr),
     _hPaintCompletedEvent(nullptr),
     _fKeepRunning(true),
+    _fInteractivePending(false),
     _hPaintEnabledEvent(nullptr)
 {
 }
@@ -160,17 +161,23 @@ DWORD WINAPI RenderThread::_ThreadProc()
         WaitForSingleObject(_hPaintEnabledEvent, INFINITE);
         WaitForSingleObject(_hEvent, INFINITE);
 
+        // Pace ourselves before painting rather than after: triggers that
+        // arrive while we wait coalesce into the frame we're about to compose
+        // instead of each scheduling another partial frame. A presentation-
+        // backed engine blocks on its compositor here, everything else sleeps
+        // the frame limit. Interactive updates skip the wait entirely so
+        // typing echo doesn't pick up a frame of latency.
+        if (!_fInteractivePending)
+        {
+            _pRenderer->WaitUntilCanRender();
+        }
+        _fInteractivePending = false;
+
         ResetEvent(_hPaintCompletedEvent);
 
         LOG_IF_FAILED(_pRenderer->PaintFrame());
 
         SetEvent(_hPaintCompletedEvent);
-
-        // extra check before we sleep since it's a "long" activity, relatively speaking.
-        if (_fKeepRunning)
-        {
-            Sleep(s_FrameLimitMilliseconds);
-        }
     }
 
     return S_OK;
@@ -181,6 +188,14 @@ void RenderThread::NotifyPaint()
     SetEvent(_hEvent);
 }
 
+void RenderThread::NotifyInteractivePaint()
+{
+    // The flag must be raised before the event so the render thread can't wake
+    // and consume the event without seeing it.
+    _fInteractivePending = true;
+    SetEvent(_hEvent);
+}
+
 void RenderThread::EnablePainting()
 {
     SetEvent(_hPaintEnabledEvent);
@@ -28,6 +28,7 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT Initialize(_In_ IRenderer* const pRendererParent) noexcept;
 
         void NotifyPaint() override;
+        void NotifyInteractivePaint() override;
 
         void EnablePainting() override;
         void WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs) override;
@@ -36,8 +37,6 @@ namespace Microsoft::Console::Render
         static DWORD WINAPI s_ThreadProc(_In_ LPVOID lpParameter);
         DWORD WINAPI _ThreadProc();
 
-        static DWORD const s_FrameLimitMilliseconds = 8;
-
         HANDLE _hThread;
         HANDLE _hEvent;
 
@@ -47,5 +46,6 @@ namespace Microsoft::Console::Render
         IRenderer* _pRenderer; // Non-ownership pointer
 
         bool _fKeepRunning;
+        bool _fInteractivePending;
     };
 }
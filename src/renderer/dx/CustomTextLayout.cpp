@@ -35,7 +35,9 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
     _runs{},
     _breakpoints{},
     _runIndex{ 0 },
-    _width{ width }
+    _width{ width },
+    _analysisComplete{ false },
+    _simpleGlyphs{ nullptr }
 {
     // Fetch the locale name out once now from the format
     _localeName.resize(format->GetLocaleNameLength() + 1); // +1 for null
@@ -89,9 +91,17 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
                                                                FLOAT originX,
                                                                FLOAT originY)
 {
-    RETURN_IF_FAILED(_AnalyzeRuns());
-    RETURN_IF_FAILED(_ShapeGlyphRuns());
-    RETURN_IF_FAILED(_CorrectGlyphRuns());
+    // Analysis, shaping, and correction only depend on the text and font we
+    // were constructed with, so when a cached layout is drawn again (even at
+    // a different origin), skip straight to the drawing step.
+    if (!_analysisComplete)
+    {
+        RETURN_IF_FAILED(_AnalyzeRuns());
+        RETURN_IF_FAILED(_ShapeGlyphRuns());
+        RETURN_IF_FAILED(_CorrectGlyphRuns());
+        _analysisComplete = true;
+    }
+
     RETURN_IF_FAILED(_DrawGlyphRuns(clientDrawingContext, renderer, { originX, originY }));
 
     return S_OK;
@@ -127,6 +137,23 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
         // Allocate enough room to have one breakpoint per code unit.
         _breakpoints.resize(_text.size());
 
+        // Fast path: if every character is printable ASCII and the base font
+        // covers the whole range, the single initial run we just set up is
+        // already correct (one script, no bidi, no fallback). Skip the
+        // analyzers entirely; shaping will map characters straight through
+        // the per-font glyph table.
+        if (textLength > 0 &&
+            std::all_of(_text.cbegin(), _text.cend(), [](const wchar_t wch) { return wch >= L' ' && wch <= L'~'; }))
+        {
+            _simpleGlyphs = s_GetSimpleGlyphCache(_font.Get(), _format->GetFontSize());
+        }
+
+        if (_simpleGlyphs != nullptr)
+        {
+            initialRun.fontFace = _font;
+            return S_OK;
+        }
+
         // Call each of the analyzers in sequence, recording their results.
         RETURN_IF_FAILED(_analyzer->AnalyzeLineBreakpoints(this, 0, textLength, this));
         RETURN_IF_FAILED(_analyzer->AnalyzeBidi(this, 0, textLength, this));
@@ -174,6 +201,12 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
 {
     try
     {
+        // Simple ASCII text skips the shaping engine entirely.
+        if (_simpleGlyphs != nullptr)
+        {
+            return _ShapeSimpleRun();
+        }
+
         // Shapes all the glyph runs in the layout.
         const auto textLength = gsl::narrow<UINT32>(_text.size());
 
@@ -187,11 +220,16 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
 
         UINT32 glyphStart = 0;
 
+        // Scratch property arrays shared by every run in this layout so a
+        // multi-run line doesn't reallocate them per run.
+        std::vector<DWRITE_SHAPING_TEXT_PROPERTIES> textProps;
+        std::vector<DWRITE_SHAPING_GLYPH_PROPERTIES> glyphProps;
+
         // Shape each run separately. This is needed whenever script, locale,
         // or reading direction changes.
         for (UINT32 runIndex = 0; runIndex < _runs.size(); ++runIndex)
         {
-            LOG_IF_FAILED(_ShapeGlyphRun(runIndex, glyphStart));
+            LOG_IF_FAILED(_ShapeGlyphRun(runIndex, glyphStart, textProps, glyphProps));
         }
 
         _glyphIndices.resize(glyphStart);
@@ -215,9 +253,14 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
 // - glyphStart - On input, which portion of the internal indices/offsets/etc. arrays to use
 //                to write the shaping information.
 //              - On output, the position that should be used by the next call as its start position
+// - textProps - Scratch buffer for per-character shaping properties, resized as needed
+// - glyphProps - Scratch buffer for per-glyph shaping properties, resized as needed
 // Return Value:
 // - S_OK or suitable DirectWrite or STL error code
-[[nodiscard]] HRESULT CustomTextLayout::_ShapeGlyphRun(const UINT32 runIndex, UINT32& glyphStart) noexcept
+[[nodiscard]] HRESULT CustomTextLayout::_ShapeGlyphRun(const UINT32 runIndex,
+                                                       UINT32& glyphStart,
+                                                       std::vector<DWRITE_SHAPING_TEXT_PROPERTIES>& textProps,
+                                                       std::vector<DWRITE_SHAPING_GLYPH_PROPERTIES>& glyphProps) noexcept
 {
     try
     {
@@ -257,8 +300,8 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
             _glyphIndices.resize(totalGlyphsArrayCount);
         }
 
-        std::vector<DWRITE_SHAPING_TEXT_PROPERTIES> textProps(textLength);
-        std::vector<DWRITE_SHAPING_GLYPH_PROPERTIES> glyphProps(maxGlyphCount);
+        textProps.resize(textLength);
+        glyphProps.resize(maxGlyphCount);
 
         // Get the glyphs from the text, retrying if needed.
 
@@ -342,6 +385,116 @@ CustomTextLayout::CustomTextLayout(IDWriteFactory2* const factory,
     return S_OK;
 }
 
+// Routine Description:
+// - Maps a pure-ASCII layout straight to glyph data using the shared
+//   per-font table, bypassing the shaping engine. One character always
+//   becomes exactly one glyph here, so the cluster map is the identity.
+// Arguments:
+// - <none> - Uses internal state
+// Return Value:
+// - S_OK or suitable STL error code
+[[nodiscard]] HRESULT CustomTextLayout::_ShapeSimpleRun() noexcept
+{
+    try
+    {
+        const auto textLength = gsl::narrow<UINT32>(_text.size());
+
+        _glyphIndices.resize(textLength);
+        _glyphOffsets.assign(textLength, DWRITE_GLYPH_OFFSET{});
+        _glyphAdvances.resize(textLength);
+        _glyphClusters.resize(textLength);
+
+        for (UINT32 i = 0; i < textLength; ++i)
+        {
+            const size_t slot = _text[i] - L' ';
+            _glyphIndices[i] = _simpleGlyphs->indices[slot];
+            _glyphAdvances[i] = _simpleGlyphs->advances[slot];
+            _glyphClusters[i] = gsl::narrow_cast<UINT16>(i);
+        }
+
+        auto& run = _runs.front();
+        run.glyphStart = 0;
+        run.glyphCount = textLength;
+    }
+    CATCH_RETURN();
+    return S_OK;
+}
+
+// Routine Description:
+// - Retrieves (building on first use) the shared glyph index/advance table
+//   covering the printable ASCII range for the given font face and size.
+// - Terminal content is overwhelmingly ASCII rendered in the base font, so
+//   resolving these glyphs once per font lets the bulk of lines bypass
+//   script analysis and the shaper after warmup.
+// Arguments:
+// - fontFace - The font face the table should be resolved against
+// - fontSize - The em size (in DIPs) used to scale the design advances
+// Return Value:
+// - Pointer to the cache entry (valid for the process lifetime), or nullptr
+//   if the font is missing any printable ASCII glyph and the full shaping
+//   path must be used instead.
+[[nodiscard]] const CustomTextLayout::SimpleGlyphCache* CustomTextLayout::s_GetSimpleGlyphCache(IDWriteFontFace5* const fontFace, const float fontSize) noexcept
+{
+    try
+    {
+        // Each engine shapes on its own render thread, but the table is
+        // shared process-wide, so guard the lookup. Entries are never
+        // evicted, which keeps returned pointers stable after the lock
+        // is released.
+        static std::mutex cacheMutex;
+        static std::vector<std::unique_ptr<SimpleGlyphCache>> caches;
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+
+        for (const auto& cache : caches)
+        {
+            if (cache->fontFace.Get() == fontFace && cache->fontSize == fontSize)
+            {
+                return cache.get();
+            }
+        }
+
+        auto cache = std::make_unique<SimpleGlyphCache>();
+        cache->fontFace = fontFace;
+        cache->fontSize = fontSize;
+
+        UINT32 codepoints[s_cSimpleGlyphs];
+        for (size_t i = 0; i < s_cSimpleGlyphs; ++i)
+        {
+            codepoints[i] = gsl::narrow_cast<UINT32>(L' ' + i);
+        }
+
+        THROW_IF_FAILED(fontFace->GetGlyphIndices(codepoints, gsl::narrow_cast<UINT32>(s_cSimpleGlyphs), cache->indices));
+
+        // Index 0 is the font's "missing glyph" entry. If any printable
+        // ASCII character maps there, this font can't take the simple path.
+        for (const auto index : cache->indices)
+        {
+            if (index == 0)
+            {
+                return nullptr;
+            }
+        }
+
+        INT32 designAdvances[s_cSimpleGlyphs];
+        THROW_IF_FAILED(fontFace->GetDesignGlyphAdvances(gsl::narrow_cast<UINT32>(s_cSimpleGlyphs), cache->indices, designAdvances));
+
+        DWRITE_FONT_METRICS1 metrics;
+        fontFace->GetMetrics(&metrics);
+
+        const float scale = fontSize / metrics.designUnitsPerEm;
+        for (size_t i = 0; i < s_cSimpleGlyphs; ++i)
+        {
+            cache->advances[i] = designAdvances[i] * scale;
+        }
+
+        caches.emplace_back(std::move(cache));
+        return caches.back().get();
+    }
+    CATCH_LOG();
+    return nullptr;
+}
+
 // Routine Description:
 // - Adjusts the glyph information from shaping to fit the layout pattern required
 //   for our renderer.
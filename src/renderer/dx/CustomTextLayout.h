@@ -125,7 +125,10 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT _AnalyzeRuns() noexcept;
         [[nodiscard]] HRESULT _ShapeGlyphRuns() noexcept;
-        [[nodiscard]] HRESULT _ShapeGlyphRun(const UINT32 runIndex, UINT32& glyphStart) noexcept;
+        [[nodiscard]] HRESULT _ShapeGlyphRun(const UINT32 runIndex,
+                                             UINT32& glyphStart,
+                                             std::vector<DWRITE_SHAPING_TEXT_PROPERTIES>& textProps,
+                                             std::vector<DWRITE_SHAPING_GLYPH_PROPERTIES>& glyphProps) noexcept;
         [[nodiscard]] HRESULT _CorrectGlyphRuns() noexcept;
         [[nodiscard]] HRESULT _CorrectGlyphRun(const UINT32 runIndex) noexcept;
         [[nodiscard]] HRESULT _DrawGlyphRuns(_In_opt_ void* clientDrawingContext,
@@ -134,6 +137,24 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] static UINT32 _EstimateGlyphCount(const UINT32 textLength) noexcept;
 
+        // The simple shaping path covers exactly the printable ASCII range (0x20-0x7E).
+        static constexpr size_t s_cSimpleGlyphs = 95;
+
+        // Glyph indices and scaled advances for the printable ASCII range,
+        // resolved once per font face and size and shared by every layout
+        // that uses that font.
+        struct SimpleGlyphCache
+        {
+            ::Microsoft::WRL::ComPtr<IDWriteFontFace5> fontFace;
+            float fontSize;
+            UINT16 indices[s_cSimpleGlyphs];
+            float advances[s_cSimpleGlyphs];
+        };
+
+        [[nodiscard]] static const SimpleGlyphCache* s_GetSimpleGlyphCache(IDWriteFontFace5* const fontFace, const float fontSize) noexcept;
+
+        [[nodiscard]] HRESULT _ShapeSimpleRun() noexcept;
+
     private:
         const ::Microsoft::WRL::ComPtr<IDWriteFactory2> _factory;
 
@@ -163,6 +184,14 @@ namespace Microsoft::Console::Render
         // Text analysis interim status variable (to assist the Analyzer Sink in operations involving _runs)
         UINT32 _runIndex;
 
+        // Whether analysis/shaping/correction has already run, so a cached
+        // layout can be drawn repeatedly without repeating that work.
+        bool _analysisComplete;
+
+        // Points at the shared glyph table for our base font when the text
+        // qualifies for the simple ASCII shaping path; nullptr otherwise.
+        const SimpleGlyphCache* _simpleGlyphs;
+
         // Glyph shaping results
         std::vector<DWRITE_GLYPH_OFFSET> _glyphOffsets;
         std::vector<UINT16> _glyphClusters;
@@ -301,8 +301,6 @@ void CustomTextRenderer::_FillRectangle(void* clientDrawingContext,
         {
             RETURN_IF_FAILED(hr);
 
-            ::Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> tempBrush;
-
             // Complex case: the run has one or more color runs within it. Iterate
             // over the sub-runs and draw them, depending on their format.
             for (;;)
@@ -362,16 +360,19 @@ void CustomTextRenderer::_FillRectangle(void* clientDrawingContext,
                     }
                     else
                     {
-                        if (!tempBrush)
+                        // This run specifies its own color. Reuse the cached
+                        // layer brush, creating it only when the render
+                        // target has changed out from under us.
+                        if (!_layerBrush || _layerBrushTarget != drawingContext->renderTarget)
                         {
-                            RETURN_IF_FAILED(d2dContext4->CreateSolidColorBrush(colorRun->runColor, &tempBrush));
+                            RETURN_IF_FAILED(d2dContext4->CreateSolidColorBrush(colorRun->runColor, _layerBrush.ReleaseAndGetAddressOf()));
+                            _layerBrushTarget = drawingContext->renderTarget;
                         }
                         else
                         {
-                            // This run specifies its own color.
-                            tempBrush->SetColor(colorRun->runColor);
+                            _layerBrush->SetColor(colorRun->runColor);
                         }
-                        layerBrush = tempBrush.Get();
+                        layerBrush = _layerBrush.Get();
                     }
 
                     // Draw the run with the selected color.
@@ -81,6 +81,13 @@ namespace Microsoft::Console::Render
                                                                          IUnknown* clientDrawingEffect) override;
 
     private:
+        // Reused solid-color brush for color-glyph layers, recreated only
+        // when the render target changes (device loss); color changes are
+        // applied with SetColor instead of allocating a new COM object in
+        // the middle of a frame.
+        ::Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> _layerBrush;
+        ID2D1RenderTarget* _layerBrushTarget = nullptr;
+
         void _FillRectangle(void* clientDrawingContext,
                             IUnknown* clientDrawingEffect,
                             float x,
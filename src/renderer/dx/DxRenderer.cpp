@@ -18,6 +18,27 @@ static constexpr float POINTS_PER_INCH = 72.0f;
 using namespace Microsoft::Console::Render;
 using namespace Microsoft::Console::Types;
 
+namespace
+{
+    // Process-wide cache of resolved font faces. Walking the system font
+    // collection to locate a family is the expensive part of font
+    // resolution, and every engine in the process resolving "Consolas"
+    // lands on the same face - so resolve each (family, weight, stretch,
+    // style) once and share it. DWrite objects are thread-safe, so handing
+    // the same face to engines on different render threads is fine.
+    struct FontFaceCacheEntry
+    {
+        std::wstring familyName;
+        DWRITE_FONT_WEIGHT weight;
+        DWRITE_FONT_STRETCH stretch;
+        DWRITE_FONT_STYLE style;
+        ::Microsoft::WRL::ComPtr<IDWriteFontFace5> face;
+    };
+
+    std::mutex g_fontFaceCacheLock;
+    std::vector<FontFaceCacheEntry> g_fontFaceCache;
+}
+
 // Routine Description:
 // - Constructs a DirectX-based renderer for console text
 //   which primarily uses DirectWrite on a Direct2D surface
@@ -28,8 +49,16 @@ DxEngine::DxEngine() :
     _invalidScroll{ 0 },
     _presentParams{ 0 },
     _presentReady{ false },
+    _occluded{ false },
     _presentScroll{ 0 },
     _presentDirty{ 0 },
+    _cursorInvalidRect{ 0 },
+    _cursorInvalidUsed{ false },
+    _cursorOnlyFrame{ false },
+    _cursorUnderRect{ 0 },
+    _cursorUnderValid{ false },
+    _backBufferValid{ false },
+    _partialFrame{ false },
     _presentOffset{ 0 },
     _isEnabled{ false },
     _isPainting{ false },
@@ -41,6 +70,8 @@ DxEngine::DxEngine() :
     _hwndTarget{ static_cast<HWND>(INVALID_HANDLE_VALUE) },
     _sizeTarget{ 0 },
     _dpi{ USER_DEFAULT_SCREEN_DPI },
+    _resolvedFontHeight{ 0 },
+    _resolvedFontDpi{ -1 },
     _scale{ 1.0f },
     _chainMode{ SwapChainMode::ForComposition },
     _customRenderer{ ::Microsoft::WRL::Make<CustomTextRenderer>() }
@@ -85,6 +116,28 @@ DxEngine::~DxEngine()
     return _EnableDisplayAccess(false);
 }
 
+// Routine Description:
+// - Asks the graphics driver to reclaim this engine's idle GPU memory
+//   (intermediate buffers and cached allocations). Intended for when the
+//   target surface is hidden (e.g. an unfocused tab) and no paints will
+//   arrive for a while; the driver transparently reallocates on the next
+//   draw. The swap chain itself stays alive so resume needs no rebuild.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void DxEngine::Trim() noexcept
+{
+    if (_haveDeviceResources)
+    {
+        ::Microsoft::WRL::ComPtr<IDXGIDevice3> dxgiDevice3;
+        if (SUCCEEDED(_d3dDevice.As(&dxgiDevice3)))
+        {
+            dxgiDevice3->Trim();
+        }
+    }
+}
+
 // Routine Description:
 // - Helper to enable/disable painting/display access/presentation in a unified
 //   manner between enable/disable functions.
@@ -179,6 +232,9 @@ DxEngine::~DxEngine()
         SwapChainDesc.SampleDesc.Count = 1;
         SwapChainDesc.AlphaMode = DXGI_ALPHA_MODE_UNSPECIFIED;
         SwapChainDesc.Scaling = DXGI_SCALING_NONE;
+        // Ask for a waitable object so the render thread can pace itself
+        // against the compositor instead of sleeping a fixed interval.
+        SwapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
 
         switch (_chainMode)
         {
@@ -223,6 +279,15 @@ DxEngine::~DxEngine()
             THROW_HR(E_NOTIMPL);
         }
 
+        // Fetch the frame latency waitable object from the swap chain. If the
+        // OS doesn't hand one over, we fall back to the base engine's pacing.
+        ::Microsoft::WRL::ComPtr<IDXGISwapChain2> swapChain2;
+        if (SUCCEEDED(_dxgiSwapChain.As(&swapChain2)))
+        {
+            LOG_IF_FAILED(swapChain2->SetMaximumFrameLatency(1));
+            _frameLatencyWaitableObject.reset(swapChain2->GetFrameLatencyWaitableObject());
+        }
+
         // With a new swap chain, mark the entire thing as invalid.
         RETURN_IF_FAILED(InvalidateAll());
 
@@ -300,6 +365,12 @@ void DxEngine::_ReleaseDeviceResources() noexcept
     _d2dBrushForeground.Reset();
     _d2dBrushBackground.Reset();
 
+    _cursorUnderBitmap.Reset();
+    _cursorUnderValid = false;
+
+    _scrollStaging.Reset();
+    _backBufferValid = false;
+
     if (nullptr != _d2dRenderTarget.Get() && _isPainting)
     {
         _d2dRenderTarget->EndDraw();
@@ -308,6 +379,7 @@ void DxEngine::_ReleaseDeviceResources() noexcept
     _d2dRenderTarget.Reset();
 
     _dxgiSurface.Reset();
+    _frameLatencyWaitableObject.reset();
     _dxgiSwapChain.Reset();
     _dxgiOutput.Reset();
 
@@ -398,15 +470,34 @@ Microsoft::WRL::ComPtr<IDXGISwapChain1> DxEngine::GetSwapChain() noexcept
 }
 
 // Routine Description:
-// - Invalidates one specific character coordinate
+// - Invalidates one specific character coordinate because the cursor moved
+//   or blinked there.
+// - Cursor damage is deliberately kept apart from text damage: the cursor is
+//   composited over a saved copy of the cell it covers, so a blink with no
+//   other invalidation presents just this rectangle with zero text work.
 // Arguments:
 // - pcoordCursor - single point in the character cell grid
 // Return Value:
 // - S_OK
 [[nodiscard]] HRESULT DxEngine::InvalidateCursor(const COORD* const pcoordCursor) noexcept
 {
-    SMALL_RECT sr = Microsoft::Console::Types::Viewport::FromCoord(*pcoordCursor).ToInclusive();
-    return Invalidate(&sr);
+    RECT region;
+    region.left = pcoordCursor->X * _glyphCell.cx;
+    region.top = pcoordCursor->Y * _glyphCell.cy;
+    region.right = region.left + _glyphCell.cx;
+    region.bottom = region.top + _glyphCell.cy;
+
+    if (_cursorInvalidUsed)
+    {
+        UnionRect(&_cursorInvalidRect, &_cursorInvalidRect, &region);
+    }
+    else
+    {
+        _cursorInvalidRect = region;
+        _cursorInvalidUsed = true;
+    }
+
+    return S_OK;
 }
 
 // Routine Description:
@@ -666,7 +757,20 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
 // - Any DirectX error, a memory error, etc.
 [[nodiscard]] HRESULT DxEngine::StartPaint() noexcept
 {
-    FAIL_FAST_IF_FAILED(InvalidateAll());
+    // The back buffer mirrors the last presented frame (the present path
+    // copies front to back), so while that copy is intact a frame only has
+    // to repaint its accumulated invalid region: ScrollFrame slides the
+    // retained pixels by the scroll delta and PaintBackground clears no more
+    // than the damage. A cursor blink with no other damage goes one step
+    // further and skips straight to PaintCursor repairing its one cell from
+    // the saved under-image. Without a trustworthy back buffer - the first
+    // frame, device loss, a dropped present - everything repaints.
+    _cursorOnlyFrame = _cursorInvalidUsed && !_isInvalidUsed && _cursorUnderValid && _backBufferValid;
+    _partialFrame = !_cursorOnlyFrame && _backBufferValid;
+    if (!_cursorOnlyFrame && !_partialFrame)
+    {
+        FAIL_FAST_IF_FAILED(InvalidateAll());
+    }
     RETURN_HR_IF(E_NOT_VALID_STATE, _isPainting); // invalid to start a paint while painting.
 
     if (_isEnabled)
@@ -681,9 +785,18 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
         {
             _dxgiSurface.Reset();
             _d2dRenderTarget.Reset();
-            _dxgiSwapChain->ResizeBuffers(2, clientSize.cx, clientSize.cy, DXGI_FORMAT_B8G8R8A8_UNORM, 0);
+            _dxgiSwapChain->ResizeBuffers(2, clientSize.cx, clientSize.cy, DXGI_FORMAT_B8G8R8A8_UNORM, DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT);
             RETURN_IF_FAILED(_PrepareRenderTarget());
             _displaySizePixels = clientSize;
+
+            // ResizeBuffers discarded the buffer contents - the retained
+            // frame shortcuts are off the table until a full frame lands.
+            _scrollStaging.Reset();
+            _cursorUnderValid = false;
+            _backBufferValid = false;
+            _cursorOnlyFrame = false;
+            _partialFrame = false;
+            FAIL_FAST_IF_FAILED(InvalidateAll());
         }
 
         _d2dRenderTarget->BeginDraw();
@@ -713,18 +826,30 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
 
         if (SUCCEEDED(hr))
         {
-            if (_invalidScroll.cy != 0 || _invalidScroll.cx != 0)
+            RECT display = _GetDisplayRect();
+
+            // Always hand DXGI the region we actually repainted so the
+            // compositor only recomposes that much. An invalid region that
+            // doesn't intersect the display leaves the count at 0, which
+            // presents the entire frame (matching the old behavior).
+            RECT damage = _invalidRect;
+            if (_cursorInvalidUsed)
+            {
+                UnionRect(&damage, &damage, &_cursorInvalidRect);
+            }
+
+            if (IntersectRect(&_presentDirty, &damage, &display))
             {
-                _presentDirty = _invalidRect;
+                _presentParams.DirtyRectsCount = 1;
+                _presentParams.pDirtyRects = &_presentDirty;
+            }
 
-                RECT display = _GetDisplayRect();
+            if (_invalidScroll.cy != 0 || _invalidScroll.cx != 0)
+            {
                 SubtractRect(&_presentScroll, &display, &_presentDirty);
                 _presentOffset.x = _invalidScroll.cx;
                 _presentOffset.y = _invalidScroll.cy;
 
-                _presentParams.DirtyRectsCount = 1;
-                _presentParams.pDirtyRects = &_presentDirty;
-
                 _presentParams.pScrollOffset = &_presentOffset;
                 _presentParams.pScrollRect = &_presentScroll;
 
@@ -747,6 +872,11 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
     _invalidRect = { 0 };
     _isInvalidUsed = false;
 
+    _cursorInvalidRect = { 0 };
+    _cursorInvalidUsed = false;
+    _cursorOnlyFrame = false;
+    _partialFrame = false;
+
     _invalidScroll = { 0 };
 
     return hr;
@@ -784,10 +914,46 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
 {
     if (_presentReady)
     {
-        FAIL_FAST_IF_FAILED(_dxgiSwapChain->Present(1, 0));
-        /*FAIL_FAST_IF_FAILED(_dxgiSwapChain->Present1(1, 0, &_presentParams));*/
+        if (_occluded)
+        {
+            // Cheap visibility poll that doesn't queue a frame. While the
+            // window stays occluded, this frame is dropped on the floor -
+            // invalidation keeps accumulating upstream, so nothing is lost.
+            const HRESULT hrTest = _dxgiSwapChain->Present(0, DXGI_PRESENT_TEST);
+            if (hrTest == DXGI_STATUS_OCCLUDED)
+            {
+                _presentReady = false;
+                _backBufferValid = false;
+
+                _presentDirty = { 0 };
+                _presentOffset = { 0 };
+                _presentScroll = { 0 };
+                _presentParams = { 0 };
+                return S_OK;
+            }
+
+            // Visible again. The frames we skipped never reached the screen
+            // and the back buffer wasn't maintained while hidden, so repaint
+            // everything on the next pass.
+            _occluded = false;
+            LOG_IF_FAILED(InvalidateAll());
+        }
+
+        _backBufferValid = false;
+        const HRESULT hrPresent = _dxgiSwapChain->Present1(1, 0, &_presentParams);
+        if (hrPresent == DXGI_STATUS_OCCLUDED)
+        {
+            // The compositor took the frame but nobody can see it (window
+            // fully covered or minimized). Go quiet until it's visible.
+            _occluded = true;
+        }
+        else
+        {
+            FAIL_FAST_IF_FAILED(hrPresent);
+        }
 
         RETURN_IF_FAILED(_CopyFrontToBack());
+        _backBufferValid = true;
         _presentReady = false;
 
         _presentDirty = { 0 };
@@ -800,13 +966,130 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
 }
 
 // Routine Description:
-// - This is currently unused.
+// - Blocks until the swap chain can take another frame, so we compose at the
+//      compositor's pace instead of a timer. The timeout keeps us responsive
+//      to teardown if the compositor stops draining us.
 // Arguments:
 // - <none>
 // Return Value:
-// - S_OK
+// - <none>
+void DxEngine::WaitUntilCanRender() noexcept
+{
+    if (_frameLatencyWaitableObject)
+    {
+        WaitForSingleObjectEx(_frameLatencyWaitableObject.get(), 100, FALSE);
+    }
+    else
+    {
+        RenderEngineBase::WaitUntilCanRender();
+    }
+}
+
+// Routine Description:
+// - Moves the retained pixels of the back buffer by the accumulated scroll
+//   delta, so only the newly revealed rows (already added to the invalid
+//   region by InvalidateScroll) have to be repainted. The copy stages
+//   through a second texture because a resource can't be copied onto itself
+//   where the regions overlap.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK or relevant DirectX error.
 [[nodiscard]] HRESULT DxEngine::ScrollFrame() noexcept
 {
+    // If we don't have any scrolling to do, return early.
+    RETURN_HR_IF(S_OK, 0 == _invalidScroll.cx && 0 == _invalidScroll.cy);
+
+    // A frame that's repainting everything has nothing worth moving.
+    RETURN_HR_IF(S_OK, !_partialFrame);
+
+    RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), _glyphCell.cx == 0 || _glyphCell.cy == 0);
+
+    // If the cursor was composited into the retained pixels, put the saved
+    // cell back before they move, or a stale cursor image would scroll along
+    // with the text. The queued repair has to land before the copies below.
+    if (_cursorUnderValid)
+    {
+        const D2D1_RECT_F source = { 0.0f,
+                                     0.0f,
+                                     _cursorUnderRect.right - _cursorUnderRect.left,
+                                     _cursorUnderRect.bottom - _cursorUnderRect.top };
+        _d2dRenderTarget->DrawBitmap(_cursorUnderBitmap.Get(),
+                                     _cursorUnderRect,
+                                     1.0f,
+                                     D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+                                     source);
+        _cursorUnderValid = false;
+    }
+    RETURN_IF_FAILED(_d2dRenderTarget->Flush());
+
+    ::Microsoft::WRL::ComPtr<ID3D11Resource> backBuffer;
+    RETURN_IF_FAILED(_dxgiSwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)));
+
+    // Size the staging texture like the back buffer, reusing it while the
+    // dimensions hold.
+    ::Microsoft::WRL::ComPtr<ID3D11Texture2D> backTexture;
+    RETURN_IF_FAILED(backBuffer.As(&backTexture));
+
+    D3D11_TEXTURE2D_DESC desc = { 0 };
+    backTexture->GetDesc(&desc);
+
+    if (_scrollStaging)
+    {
+        D3D11_TEXTURE2D_DESC existing = { 0 };
+        _scrollStaging->GetDesc(&existing);
+        if (existing.Width != desc.Width ||
+            existing.Height != desc.Height ||
+            existing.Format != desc.Format)
+        {
+            _scrollStaging.Reset();
+        }
+    }
+
+    if (!_scrollStaging)
+    {
+        desc.BindFlags = 0;
+        desc.MiscFlags = 0;
+        desc.CPUAccessFlags = 0;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        RETURN_IF_FAILED(_d3dDevice->CreateTexture2D(&desc, nullptr, _scrollStaging.ReleaseAndGetAddressOf()));
+    }
+
+    _d3dDeviceContext->CopyResource(_scrollStaging.Get(), backBuffer.Get());
+
+    // Like the GDI engine, don't move the sub-cell gutter pixels at the
+    // right and bottom edges - rows only land on cell boundaries, and
+    // sliding text into the gutter would leave slivers behind.
+    RECT scrollLimit = _GetDisplayRect();
+    scrollLimit.right -= scrollLimit.right % _glyphCell.cx;
+    scrollLimit.bottom -= scrollLimit.bottom % _glyphCell.cy;
+
+    // The retained area is whatever part of the limit remains within it
+    // after moving by the delta.
+    RECT source = scrollLimit;
+    OffsetRect(&source, -_invalidScroll.cx, -_invalidScroll.cy);
+    IntersectRect(&source, &source, &scrollLimit);
+
+    if (!IsRectEmpty(&source))
+    {
+        D3D11_BOX box;
+        box.left = static_cast<UINT>(source.left);
+        box.top = static_cast<UINT>(source.top);
+        box.front = 0;
+        box.right = static_cast<UINT>(source.right);
+        box.bottom = static_cast<UINT>(source.bottom);
+        box.back = 1;
+
+        _d3dDeviceContext->CopySubresourceRegion(backBuffer.Get(),
+                                                 0,
+                                                 static_cast<UINT>(source.left + _invalidScroll.cx),
+                                                 static_cast<UINT>(source.top + _invalidScroll.cy),
+                                                 0,
+                                                 _scrollStaging.Get(),
+                                                 0,
+                                                 &box);
+    }
+
     return S_OK;
 }
 
@@ -825,8 +1108,38 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
                                                    _d2dBrushBackground.Get());
 */
 
+    // A cursor-only frame inherits every other pixel from the last frame;
+    // clearing would throw them away.
+    if (_cursorOnlyFrame)
+    {
+        return S_OK;
+    }
+
     D2D1_COLOR_F nothing = { 0 };
 
+    if (_partialFrame)
+    {
+        // Only the invalid cells repaint on a partial frame - everything
+        // else is retained from the last present (and already moved by
+        // ScrollFrame), so clear no more than the cells being redrawn.
+        if (_isInvalidUsed)
+        {
+            const SMALL_RECT dirty = GetDirtyRectInChars();
+
+            D2D1_RECT_F clear;
+            clear.left = static_cast<float>(dirty.Left * _glyphCell.cx);
+            clear.top = static_cast<float>(dirty.Top * _glyphCell.cy);
+            clear.right = static_cast<float>((dirty.Right + 1) * _glyphCell.cx);
+            clear.bottom = static_cast<float>((dirty.Bottom + 1) * _glyphCell.cy);
+
+            _d2dRenderTarget->PushAxisAlignedClip(clear, D2D1_ANTIALIAS_MODE_ALIASED);
+            _d2dRenderTarget->Clear(nothing);
+            _d2dRenderTarget->PopAxisAlignedClip();
+        }
+
+        return S_OK;
+    }
+
     _d2dRenderTarget->Clear(nothing);
 
     return S_OK;
@@ -851,13 +1164,50 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
         origin.x = static_cast<float>(coord.X * _glyphCell.cx);
         origin.y = static_cast<float>(coord.Y * _glyphCell.cy);
 
-        // Create the text layout
-        CustomTextLayout layout(_dwriteFactory.Get(),
-                                _dwriteTextAnalyzer.Get(),
-                                _dwriteTextFormat.Get(),
-                                _dwriteFontFace.Get(),
-                                clusters,
-                                _glyphCell.cx);
+        // Build the cache key from the text and the columns each cluster
+        // consumes. The brushes aren't part of a layout, so the same text in
+        // new colors still hits the cache. (Both halves of the key are the
+        // same length, so the separator is just belt-and-braces.)
+        std::wstring& key = _layoutKeyScratch;
+        key.clear();
+        key.reserve(clusters.size() * 2 + 1);
+        for (const auto& cluster : clusters)
+        {
+            key += cluster.GetText();
+        }
+        key.push_back(L'\x1f');
+        for (const auto& cluster : clusters)
+        {
+            key.push_back(gsl::narrow_cast<wchar_t>(cluster.GetColumns()));
+        }
+
+        // Fetch the shaped layout for this content, or create and cache one.
+        // Analysis and shaping happen once per distinct line content (on the
+        // first Draw) instead of once per dirty line per frame.
+        ::Microsoft::WRL::ComPtr<CustomTextLayout> layout;
+        const auto found = _layoutCache.find(key);
+        if (found != _layoutCache.end())
+        {
+            layout = found->second;
+        }
+        else
+        {
+            layout = ::Microsoft::WRL::Make<CustomTextLayout>(_dwriteFactory.Get(),
+                                                              _dwriteTextAnalyzer.Get(),
+                                                              _dwriteTextFormat.Get(),
+                                                              _dwriteFontFace.Get(),
+                                                              clusters,
+                                                              _glyphCell.cx);
+            RETURN_IF_NULL_ALLOC(layout);
+
+            // Don't let scrollback churn grow the cache without bound. Tossing
+            // the whole thing is cheap and the hot lines repopulate it quickly.
+            if (_layoutCache.size() >= s_cMaxCachedLayouts)
+            {
+                _layoutCache.clear();
+            }
+            _layoutCache.emplace(key, layout);
+        }
 
         // Get the baseline for this font as that's where we draw from
         DWRITE_LINE_SPACING spacing;
@@ -873,7 +1223,7 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
                                D2D1_DRAW_TEXT_OPTIONS_ENABLE_COLOR_FONT);
 
         // Layout then render the text
-        RETURN_IF_FAILED(layout.Draw(&context, _customRenderer.Get(), origin.x, origin.y));
+        RETURN_IF_FAILED(layout->Draw(&context, _customRenderer.Get(), origin.x, origin.y));
     }
     CATCH_RETURN();
 
@@ -908,57 +1258,64 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
     D2D_POINT_2F start = { 0 };
     D2D_POINT_2F end = { 0 };
 
-    for (size_t i = 0; i < cchLine; i++)
+    // The width of the entire run in pixels.
+    const float cxRun = static_cast<float>(font.X) * cchLine;
+
+    // The horizontal lines are contiguous across the run, so each is a single
+    // primitive spanning every cell instead of one per character.
+    if (lines & GridLines::Top)
     {
         start = target;
+        end = start;
+        end.x += cxRun;
 
-        if (lines & GridLines::Top)
-        {
-            end = start;
-            end.x += font.X;
-
-            _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
-        }
-
-        if (lines & GridLines::Left)
-        {
-            end = start;
-            end.y += font.Y;
-
-            _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
-        }
+        _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
+    }
 
-        // NOTE: Watch out for inclusive/exclusive rectangles here.
-        // We have to remove 1 from the font size for the bottom and right lines to ensure that the
-        // starting point remains within the clipping rectangle.
-        // For example, if we're drawing a letter at 0,0 and the font size is 8x16....
-        // The bottom left corner inclusive is at 0,15 which is Y (0) + Font Height (16) - 1 = 15.
-        // The top right corner inclusive is at 7,0 which is X (0) + Font Height (8) - 1 = 7.
+    // NOTE: Watch out for inclusive/exclusive rectangles here.
+    // We have to remove 1 from the font size for the bottom and right lines to ensure that the
+    // starting point remains within the clipping rectangle.
+    // For example, if we're drawing a letter at 0,0 and the font size is 8x16....
+    // The bottom left corner inclusive is at 0,15 which is Y (0) + Font Height (16) - 1 = 15.
+    // The top right corner inclusive is at 7,0 which is X (0) + Font Height (8) - 1 = 7.
 
+    if (lines & GridLines::Bottom)
+    {
         start = target;
         start.y += font.Y - 1;
+        end = start;
+        end.x += cxRun;
+
+        _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
+    }
 
-        if (lines & GridLines::Bottom)
+    // The vertical lines land on the edge of every cell, so they still walk the run.
+    if (lines & (GridLines::Left | GridLines::Right))
+    {
+        for (size_t i = 0; i < cchLine; i++)
         {
-            end = start;
-            end.x += font.X;
+            if (lines & GridLines::Left)
+            {
+                start = target;
+                end = start;
+                end.y += font.Y;
 
-            _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
-        }
+                _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
+            }
 
-        start = target;
-        start.x += font.X - 1;
+            if (lines & GridLines::Right)
+            {
+                start = target;
+                start.x += font.X - 1;
+                end = start;
+                end.y += font.Y;
 
-        if (lines & GridLines::Right)
-        {
-            end = start;
-            end.y += font.Y;
+                _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
+            }
 
-            _d2dRenderTarget->DrawLine(start, end, _d2dBrushForeground.Get());
+            // Move to the next character in this run.
+            target.x += font.X;
         }
-
-        // Move to the next character in this run.
-        target.x += font.X;
     }
 
     return S_OK;
@@ -998,6 +1355,50 @@ void DxEngine::_InvalidOr(RECT rc) noexcept
     return S_OK;
 }
 
+// Routine Description:
+// - Captures the pixels beneath the cursor cell into a small bitmap, so a
+//   later frame can put them back without repainting the text under them.
+// Arguments:
+// - cell - The full cell (or cells, for double-width) the cursor will cover
+// Return Value:
+// - S_OK or relevant DirectX error.
+[[nodiscard]] HRESULT DxEngine::_SaveCursorUnder(const D2D1_RECT_F cell) noexcept
+{
+    const D2D1_SIZE_U size{ static_cast<UINT32>(cell.right - cell.left),
+                            static_cast<UINT32>(cell.bottom - cell.top) };
+
+    bool needsNewBitmap = _cursorUnderBitmap.Get() == nullptr;
+    if (!needsNewBitmap)
+    {
+        const auto existing = _cursorUnderBitmap->GetPixelSize();
+        needsNewBitmap = existing.width != size.width || existing.height != size.height;
+    }
+
+    if (needsNewBitmap)
+    {
+        D2D1_BITMAP_PROPERTIES props = { 0 };
+        props.pixelFormat = _d2dRenderTarget->GetPixelFormat();
+        _d2dRenderTarget->GetDpi(&props.dpiX, &props.dpiY);
+        RETURN_IF_FAILED(_d2dRenderTarget->CreateBitmap(size, props, _cursorUnderBitmap.ReleaseAndGetAddressOf()));
+    }
+
+    // Drawing queued against the target has to land before its content can
+    // be copied out mid-frame.
+    RETURN_IF_FAILED(_d2dRenderTarget->Flush());
+
+    const D2D1_POINT_2U dest = { 0, 0 };
+    const D2D1_RECT_U source = { static_cast<UINT32>(cell.left),
+                                 static_cast<UINT32>(cell.top),
+                                 static_cast<UINT32>(cell.right),
+                                 static_cast<UINT32>(cell.bottom) };
+    RETURN_IF_FAILED(_cursorUnderBitmap->CopyFromRenderTarget(&dest, _d2dRenderTarget.Get(), &source));
+
+    _cursorUnderRect = cell;
+    _cursorUnderValid = true;
+
+    return S_OK;
+}
+
 // Helper to choose which Direct2D method to use when drawing the cursor rectangle
 enum class CursorPaintType
 {
@@ -1014,6 +1415,41 @@ enum class CursorPaintType
 // - S_OK or relevant DirectX error.
 [[nodiscard]] HRESULT DxEngine::PaintCursor(const IRenderEngine::CursorOptions& options) noexcept
 {
+    // Deal with the cell we composited the cursor over last frame. If this
+    // frame repainted it, the text beneath was just redrawn and the saved
+    // image is stale - a fresh one is captured below. If it wasn't
+    // repainted (a blink frame, or a partial frame whose damage lies
+    // elsewhere), the retained pixels still show the old cursor, so put the
+    // saved image back. The invalid region is cell-aligned, which makes the
+    // overlap test a reliable repainted-or-not answer; a full repaint
+    // invalidates the whole display and naturally takes the first branch.
+    if (_cursorUnderValid)
+    {
+        RECT rcUnder;
+        rcUnder.left = lround(_cursorUnderRect.left);
+        rcUnder.top = lround(_cursorUnderRect.top);
+        rcUnder.right = lround(_cursorUnderRect.right);
+        rcUnder.bottom = lround(_cursorUnderRect.bottom);
+
+        RECT rcOverlap;
+        if (_isInvalidUsed && IntersectRect(&rcOverlap, &rcUnder, &_invalidRect))
+        {
+            _cursorUnderValid = false;
+        }
+        else
+        {
+            const D2D1_RECT_F source = { 0.0f,
+                                         0.0f,
+                                         _cursorUnderRect.right - _cursorUnderRect.left,
+                                         _cursorUnderRect.bottom - _cursorUnderRect.top };
+            _d2dRenderTarget->DrawBitmap(_cursorUnderBitmap.Get(),
+                                         _cursorUnderRect,
+                                         1.0f,
+                                         D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+                                         source);
+        }
+    }
+
     // if the cursor is off, do nothing - it should not be visible.
     if (!options.isOn)
     {
@@ -1032,6 +1468,10 @@ enum class CursorPaintType
         rect.right += _glyphCell.cx;
     }
 
+    // Remember the cell (or cells) we're about to draw over, so later blink
+    // frames can repair them without repainting any text.
+    LOG_IF_FAILED(_SaveCursorUnder(rect));
+
     CursorPaintType paintType = CursorPaintType::Fill;
 
     switch (options.cursorType)
@@ -1146,19 +1586,46 @@ enum class CursorPaintType
 // - S_OK or relevant DirectX error
 [[nodiscard]] HRESULT DxEngine::UpdateFont(const FontInfoDesired& pfiFontInfoDesired, FontInfo& fiFontInfo) noexcept
 {
-    const auto hr = _GetProposedFont(pfiFontInfoDesired,
-                                     fiFontInfo,
-                                     _dpi,
-                                     _dwriteTextFormat,
-                                     _dwriteTextAnalyzer,
-                                     _dwriteFontFace);
+    try
+    {
+        // If this is a re-request of exactly the font we already measured at
+        // this DPI, answer from the cached result. The text format, analyzer,
+        // font face, glyph cell, and shaped layout cache are all still valid.
+        const std::wstring faceName(pfiFontInfoDesired.GetFaceName());
+        const auto requestedHeight = pfiFontInfoDesired.GetEngineSize().Y;
+        if (_resolvedFontInfo.has_value() &&
+            _resolvedFontDpi == _dpi &&
+            _resolvedFontHeight == requestedHeight &&
+            _resolvedFontFaceName == faceName)
+        {
+            fiFontInfo = _resolvedFontInfo.value();
+            return S_OK;
+        }
 
-    const auto size = fiFontInfo.GetSize();
+        const auto hr = _GetProposedFont(pfiFontInfoDesired,
+                                         fiFontInfo,
+                                         _dpi,
+                                         _dwriteTextFormat,
+                                         _dwriteTextAnalyzer,
+                                         _dwriteFontFace);
+        RETURN_IF_FAILED(hr);
 
-    _glyphCell.cx = size.X;
-    _glyphCell.cy = size.Y;
+        const auto size = fiFontInfo.GetSize();
 
-    return hr;
+        _glyphCell.cx = size.X;
+        _glyphCell.cy = size.Y;
+
+        // The cached layouts were shaped against the old font and cell size.
+        _layoutCache.clear();
+
+        _resolvedFontInfo = fiFontInfo;
+        _resolvedFontFaceName = faceName;
+        _resolvedFontHeight = requestedHeight;
+        _resolvedFontDpi = _dpi;
+
+        return hr;
+    }
+    CATCH_RETURN();
 }
 
 [[nodiscard]] Viewport DxEngine::GetViewportInCharacters(const Viewport& viewInPixels) noexcept
@@ -1334,6 +1801,20 @@ float DxEngine::GetScaling() const noexcept
 {
     Microsoft::WRL::ComPtr<IDWriteFontFace5> fontFace;
 
+    {
+        std::lock_guard<std::mutex> cacheGuard(g_fontFaceCacheLock);
+        for (const auto& entry : g_fontFaceCache)
+        {
+            if (entry.weight == weight &&
+                entry.stretch == stretch &&
+                entry.style == style &&
+                entry.familyName == familyName)
+            {
+                return entry.face;
+            }
+        }
+    }
+
     Microsoft::WRL::ComPtr<IDWriteFontCollection> fontCollection;
     THROW_IF_FAILED(_dwriteFactory->GetSystemFontCollection(&fontCollection, false));
 
@@ -1355,6 +1836,12 @@ float DxEngine::GetScaling() const noexcept
         THROW_IF_FAILED(fontFace0.As(&fontFace));
     }
 
+    if (fontFace)
+    {
+        std::lock_guard<std::mutex> cacheGuard(g_fontFaceCacheLock);
+        g_fontFaceCache.push_back({ familyName, weight, stretch, style, fontFace });
+    }
+
     return fontFace;
 }
 
@@ -7,6 +7,7 @@
 
 #include <dxgi.h>
 #include <dxgi1_2.h>
+#include <dxgi1_3.h>
 
 #include <d3d11.h>
 #include <d2d1.h>
@@ -19,6 +20,7 @@
 #include <wrl.h>
 #include <wrl/client.h>
 
+#include "CustomTextLayout.h"
 #include "CustomTextRenderer.h"
 
 #include "../../types/inc/Viewport.hpp"
@@ -37,6 +39,8 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT Enable() noexcept;
         [[nodiscard]] HRESULT Disable() noexcept;
 
+        void Trim() noexcept;
+
         [[nodiscard]] HRESULT SetHwnd(const HWND hwnd) noexcept;
 
         [[nodiscard]] HRESULT SetWindowSize(const SIZE pixels) noexcept;
@@ -59,6 +63,8 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT EndPaint() noexcept override;
         [[nodiscard]] HRESULT Present() noexcept override;
 
+        void WaitUntilCanRender() noexcept override;
+
         [[nodiscard]] HRESULT ScrollFrame() noexcept override;
 
         [[nodiscard]] HRESULT PaintBackground() noexcept override;
@@ -134,11 +140,44 @@ namespace Microsoft::Console::Render
         void _InvalidOffset(POINT pt) noexcept;
 
         bool _presentReady;
+        // Set when Present reports DXGI_STATUS_OCCLUDED - nothing we present
+        // reaches the screen, so frames are dropped (and the skipped
+        // back-buffer maintenance made up with a full invalidate) until a
+        // PRESENT_TEST poll says the window is visible again.
+        bool _occluded;
         RECT _presentDirty;
         RECT _presentScroll;
         POINT _presentOffset;
         DXGI_PRESENT_PARAMETERS _presentParams;
 
+        // Cursor damage tracked separately from text damage, so a blink frame
+        // can present just the cell without repainting any text.
+        RECT _cursorInvalidRect;
+        bool _cursorInvalidUsed;
+        bool _cursorOnlyFrame;
+
+        // Copy of the cell pixels beneath the cursor, captured right before
+        // the cursor is drawn over them. See PaintCursor.
+        ::Microsoft::WRL::ComPtr<ID2D1Bitmap> _cursorUnderBitmap;
+        D2D1_RECT_F _cursorUnderRect;
+        bool _cursorUnderValid;
+
+        [[nodiscard]] HRESULT _SaveCursorUnder(const D2D1_RECT_F cell) noexcept;
+
+        // True while the back buffer still mirrors the last presented frame
+        // (the present path copies front to back after every present). This
+        // is what permits partial frames: only the invalid region repaints,
+        // and ScrollFrame slides the retained pixels instead.
+        bool _backBufferValid;
+
+        // Set per frame in StartPaint when the retained pixels are being
+        // reused rather than fully repainted.
+        bool _partialFrame;
+
+        // Staging texture for ScrollFrame's within-surface copy; a resource
+        // can't be copied onto itself where the regions overlap.
+        ::Microsoft::WRL::ComPtr<ID3D11Texture2D> _scrollStaging;
+
         static const ULONG s_ulMinCursorHeightPercent = 25;
         static const ULONG s_ulMaxCursorHeightPercent = 100;
 
@@ -150,6 +189,27 @@ namespace Microsoft::Console::Render
         ::Microsoft::WRL::ComPtr<IDWriteTextAnalyzer1> _dwriteTextAnalyzer;
         ::Microsoft::WRL::ComPtr<CustomTextRenderer> _customRenderer;
 
+        // Cache of shaped text layouts, keyed by the line's text and the
+        // columns each cluster consumes. Repainting a line whose content
+        // hasn't changed (scrolling, attribute changes, cursor movement)
+        // skips DirectWrite analysis and shaping entirely.
+        std::unordered_map<std::wstring, ::Microsoft::WRL::ComPtr<CustomTextLayout>> _layoutCache;
+        static const size_t s_cMaxCachedLayouts = 1024;
+
+        // Scratch string reused by PaintBufferLine to assemble the cache
+        // key. The capacity persists across lines and frames, so steady
+        // state painting composes keys without touching the heap.
+        std::wstring _layoutKeyScratch;
+
+        // Key and result of the last successful font resolution. UpdateFont
+        // calls that ask for the same (face, size, dpi) are answered from
+        // here without touching DWrite again, which keeps DPI/settings
+        // notifications that didn't actually change the font cheap.
+        std::optional<FontInfo> _resolvedFontInfo;
+        std::wstring _resolvedFontFaceName;
+        short _resolvedFontHeight;
+        int _resolvedFontDpi;
+
         // Device-Dependent Resources
         bool _haveDeviceResources;
         ::Microsoft::WRL::ComPtr<ID3D11Device> _d3dDevice;
@@ -163,6 +223,10 @@ namespace Microsoft::Console::Render
         ::Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> _d2dBrushBackground;
         ::Microsoft::WRL::ComPtr<IDXGISwapChain1> _dxgiSwapChain;
 
+        // Signaled by DXGI when the swap chain can accept another frame; the
+        // render thread blocks on this instead of sleeping a fixed interval.
+        wil::unique_handle _frameLatencyWaitableObject;
+
         [[nodiscard]] HRESULT _CreateDeviceResources(const bool createSwapChain) noexcept;
 
         [[nodiscard]] HRESULT _PrepareRenderTarget() noexcept;
@@ -95,7 +95,22 @@ namespace Microsoft::Console::Render
         size_t _cPolyText;
         [[nodiscard]] HRESULT _FlushBufferLines() noexcept;
 
-        std::vector<RECT> cursorInvertRects;
+        // Cursor damage tracked separately from text damage, so a blink frame
+        // only needs the cell blitted to the window, not repainted.
+        RECT _rcCursorInvalid;
+        bool _fCursorInvalidUsed;
+        void _InvalidCursorCombine(const RECT* const prc) noexcept;
+
+        // The cell pixels beneath the cursor, captured right before the
+        // cursor is drawn over them so they can be put back later without
+        // repainting the text.
+        HDC _hdcCursorUnder;
+        HBITMAP _hbitmapCursorUnder;
+        SIZE _szCursorUnder;
+        RECT _rcCursorSaved;
+        bool _fCursorSavedValid;
+        [[nodiscard]] HRESULT _SaveCursorUnder(const RECT* const prcCell) noexcept;
+        [[nodiscard]] HRESULT _RestoreCursorUnder(const bool fIncludeWindow) noexcept;
 
         COORD _coordFontLast;
         int _iCurrentDpi;
@@ -80,6 +80,9 @@ HRESULT GdiEngine::Invalidate(const SMALL_RECT* const psrRegion) noexcept
 
 // Routine Description:
 // - Notifies us that the console has changed the position of the cursor.
+//      Cursor damage is deliberately kept out of the main invalid region:
+//      the cursor is composited over a saved copy of the cell it covers, so
+//      a blink only needs the cell blitted to the window, not repainted.
 // Arguments:
 // - pcoordCursor - the new position of the cursor
 // Return Value:
@@ -87,7 +90,13 @@ HRESULT GdiEngine::Invalidate(const SMALL_RECT* const psrRegion) noexcept
 HRESULT GdiEngine::InvalidateCursor(const COORD* const pcoordCursor) noexcept
 {
     SMALL_RECT sr = Viewport::FromCoord(*pcoordCursor).ToExclusive();
-    return this->Invalidate(&sr);
+
+    RECT rcInvalid = { 0 };
+    RETURN_IF_FAILED(_ScaleByFont(&sr, &rcInvalid));
+
+    _InvalidCursorCombine(&rcInvalid);
+
+    return S_OK;
 }
 
 // Routine Description:
@@ -164,6 +173,28 @@ HRESULT GdiEngine::_InvalidCombine(const RECT* const prc) noexcept
     return S_OK;
 }
 
+// Routine Description:
+// - Helper to combine the given rectangle into the cursor-only damage region.
+//      This region is presented (blitted to the window) but never erased or
+//      repainted through the text path - the cursor compositing in
+//      PaintCursor keeps the underlying pixels correct itself.
+// Arguments:
+// - prc - Pixel region (RECT) covering cursor damage for the next frame
+// Return Value:
+// - <none>
+void GdiEngine::_InvalidCursorCombine(const RECT* const prc) noexcept
+{
+    if (!_fCursorInvalidUsed)
+    {
+        _rcCursorInvalid = *prc;
+        _fCursorInvalidUsed = true;
+    }
+    else
+    {
+        _OrRect(&_rcCursorInvalid, prc);
+    }
+}
+
 // Routine Description:
 // - Helper to adjust the invalid region by the given offset such as when a scroll operation occurs.
 // Arguments:
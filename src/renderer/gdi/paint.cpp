@@ -44,6 +44,27 @@ using namespace Microsoft::Console::Render;
     // Signal that we're starting to paint.
     _fPaintStarted = true;
 
+    // If an earlier frame composited the cursor over the memory bitmap,
+    // settle the saved cell contents before anything paints. When the cell
+    // is inside the region being repainted anyway, the saved pixels are
+    // stale - fold the cell into the repaint and discard them. Otherwise put
+    // them back now, so a blink-off frame needs no text work at all: just a
+    // blit of the restored cell to the window.
+    if (_fCursorSavedValid)
+    {
+        RECT rcOverlap;
+        if (_fInvalidRectUsed && IntersectRect(&rcOverlap, &_rcCursorSaved, &_rcInvalid))
+        {
+            LOG_IF_FAILED(_InvalidCombine(&_rcCursorSaved));
+            _fCursorSavedValid = false;
+        }
+        else
+        {
+            LOG_IF_FAILED(_RestoreCursorUnder(false));
+            _InvalidCursorCombine(&_rcCursorSaved);
+        }
+    }
+
     _psInvalidData.fErase = TRUE;
     _psInvalidData.rcPaint = _rcInvalid;
 
@@ -67,18 +88,14 @@ using namespace Microsoft::Console::Render;
     // If we don't have any scrolling to do, return early.
     RETURN_HR_IF(S_OK, 0 == _szInvalidScroll.cx && 0 == _szInvalidScroll.cy);
 
-    // If we have an inverted cursor, we have to see if we have to clean it before we scroll to prevent
-    // left behind cursor copies in the scrolled region.
-    if (cursorInvertRects.size() > 0)
+    // If the cursor was composited over the frame, we have to clean it before
+    // we scroll to prevent left behind cursor copies in the scrolled region.
+    // Restoring the saved cell undoes the cursor no matter which style was
+    // drawn, and the window already shows the cursor too, so clean both.
+    if (_fCursorSavedValid)
     {
-        for (RECT r : cursorInvertRects)
-        {
-            // Clean both the in-memory and actual window context.
-            RETURN_HR_IF(E_FAIL, !(InvertRect(_hdcMemoryContext, &r)));
-            RETURN_HR_IF(E_FAIL, !(InvertRect(_psInvalidData.hdc, &r)));
-        }
-
-        cursorInvertRects.clear();
+        _InvalidCursorCombine(&_rcCursorSaved);
+        RETURN_IF_FAILED(_RestoreCursorUnder(true));
     }
 
     // We have to limit the region that can be scrolled to not include the gutters.
@@ -194,6 +211,16 @@ using namespace Microsoft::Console::Render;
 
     LOG_IF_FAILED(_FlushBufferLines());
 
+    // Fold any cursor-only damage into the blit region now. It was kept out
+    // of _rcInvalid on purpose so the paint pass didn't redo the text
+    // underneath the cursor.
+    if (_fCursorInvalidUsed)
+    {
+        LOG_IF_FAILED(_InvalidCombine(&_rcCursorInvalid));
+        _rcCursorInvalid = { 0 };
+        _fCursorInvalidUsed = false;
+    }
+
     POINT const pt = _GetInvalidRectPoint();
     SIZE const sz = _GetInvalidRectSize();
 
@@ -463,38 +490,46 @@ using namespace Microsoft::Console::Render;
     // Get the font size so we know the size of the rectangle lines we'll be inscribing.
     COORD const coordFontSize = _GetFontSize();
 
-    // For each length of the line, inscribe the various lines as specified by the enum
-    for (size_t i = 0; i < cchLine; i++)
+    // The width of the entire run in pixels.
+    LONG const cxRun = coordFontSize.X * gsl::narrow<LONG>(cchLine);
+
+    // The horizontal lines are contiguous across the run, so each is a single
+    // blt spanning every cell instead of one per character.
+    if (lines & GridLines::Top)
     {
-        if (lines & GridLines::Top)
-        {
-            RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y, coordFontSize.X, 1, PATCOPY)));
-        }
+        RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y, cxRun, 1, PATCOPY)));
+    }
 
-        if (lines & GridLines::Left)
-        {
-            RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y, 1, coordFontSize.Y, PATCOPY)));
-        }
+    // NOTE: Watch out for inclusive/exclusive rectangles here.
+    // We have to remove 1 from the font size for the bottom and right lines to ensure that the
+    // starting point remains within the clipping rectangle.
+    // For example, if we're drawing a letter at 0,0 and the font size is 8x16....
+    // The bottom left corner inclusive is at 0,15 which is Y (0) + Font Height (16) - 1 = 15.
+    // The top right corner inclusive is at 7,0 which is X (0) + Font Height (8) - 1 = 7.
 
-        // NOTE: Watch out for inclusive/exclusive rectangles here.
-        // We have to remove 1 from the font size for the bottom and right lines to ensure that the
-        // starting point remains within the clipping rectangle.
-        // For example, if we're drawing a letter at 0,0 and the font size is 8x16....
-        // The bottom left corner inclusive is at 0,15 which is Y (0) + Font Height (16) - 1 = 15.
-        // The top right corner inclusive is at 7,0 which is X (0) + Font Height (8) - 1 = 7.
+    if (lines & GridLines::Bottom)
+    {
+        RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y + coordFontSize.Y - 1, cxRun, 1, PATCOPY)));
+    }
 
-        if (lines & GridLines::Bottom)
+    // The vertical lines land on the edge of every cell, so they still walk the run.
+    if (lines & (GridLines::Left | GridLines::Right))
+    {
+        for (size_t i = 0; i < cchLine; i++)
         {
-            RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y + coordFontSize.Y - 1, coordFontSize.X, 1, PATCOPY)));
-        }
+            if (lines & GridLines::Left)
+            {
+                RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x, ptTarget.y, 1, coordFontSize.Y, PATCOPY)));
+            }
 
-        if (lines & GridLines::Right)
-        {
-            RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x + coordFontSize.X - 1, ptTarget.y, 1, coordFontSize.Y, PATCOPY)));
-        }
+            if (lines & GridLines::Right)
+            {
+                RETURN_HR_IF(E_FAIL, !(PatBlt(_hdcMemoryContext, ptTarget.x + coordFontSize.X - 1, ptTarget.y, 1, coordFontSize.Y, PATCOPY)));
+            }
 
-        // Move to the next character in this run.
-        ptTarget.x += coordFontSize.X;
+            // Move to the next character in this run.
+            ptTarget.x += coordFontSize.X;
+        }
     }
 
     return S_OK;
@@ -531,8 +566,12 @@ using namespace Microsoft::Console::Render;
         RETURN_IF_FAILED(LongAdd(rcBoundaries.right, coordFontSize.X, &rcBoundaries.right));
     }
 
+    // Save the pixels we're about to draw over, so a later frame can put
+    // them back without repainting the text beneath the cursor.
+    LOG_IF_FAILED(_SaveCursorUnder(&rcBoundaries));
+
     // Make a set of RECTs to paint.
-    cursorInvertRects.clear();
+    std::vector<RECT> cursorInvertRects;
 
     RECT rcInvert = rcBoundaries;
     // depending on the cursorType, add rects to that set
@@ -607,8 +646,6 @@ using namespace Microsoft::Console::Render;
             RETURN_HR_IF(E_FAIL, !(FillRect(_hdcMemoryContext, &r, hCursorBrush)));
         }
         DeleteObject(hCursorBrush);
-        // Clear out the inverted rects, so that we don't re-invert them next frame.
-        cursorInvertRects.clear();
     }
     else
     {
@@ -618,6 +655,78 @@ using namespace Microsoft::Console::Render;
         }
     }
 
+    // Make sure the drawn cursor reaches the window even when nothing else
+    // was invalidated this frame.
+    _InvalidCursorCombine(&rcBoundaries);
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Captures the pixels beneath the cursor cell from the memory bitmap into
+//   a small side bitmap, so a later frame can put them back without
+//   repainting the text under the cursor.
+// Arguments:
+// - prcCell - The full cell area (in pixels) the cursor is about to cover.
+// Return Value:
+// - S_OK, suitable GDI HRESULT error, or E_FAIL in a GDI error where a specific error isn't set.
+[[nodiscard]] HRESULT GdiEngine::_SaveCursorUnder(const RECT* const prcCell) noexcept
+{
+    SIZE const szCell = _GetRectSize(prcCell);
+
+    if (_hdcCursorUnder == nullptr)
+    {
+        _hdcCursorUnder = CreateCompatibleDC(_hdcMemoryContext);
+        RETURN_HR_IF_NULL(E_FAIL, _hdcCursorUnder);
+    }
+
+    // Grow the side bitmap when the cell is bigger than what we're holding
+    // (font changes, double-width cursors).
+    if (_hbitmapCursorUnder == nullptr || _szCursorUnder.cx < szCell.cx || _szCursorUnder.cy < szCell.cy)
+    {
+        wil::unique_hbitmap hbitmapNew(CreateCompatibleBitmap(_hdcMemoryContext, szCell.cx, szCell.cy));
+        RETURN_HR_IF_NULL(E_FAIL, hbitmapNew.get());
+
+        // Select the new bitmap in and delete whatever came out (the old
+        // saved bitmap, or the junk one pixel default on the first pass).
+        wil::unique_hbitmap hbitmapOld(SelectBitmap(_hdcCursorUnder, hbitmapNew.get()));
+        RETURN_HR_IF_NULL(E_FAIL, hbitmapOld.get());
+
+        _hbitmapCursorUnder = hbitmapNew.release(); // if SelectBitmap worked, GDI took ownership. Detach from smart object.
+        _szCursorUnder = szCell;
+    }
+
+    RETURN_HR_IF(E_FAIL, !(BitBlt(_hdcCursorUnder, 0, 0, szCell.cx, szCell.cy, _hdcMemoryContext, prcCell->left, prcCell->top, SRCCOPY)));
+
+    _rcCursorSaved = *prcCell;
+    _fCursorSavedValid = true;
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Puts the saved under-cursor pixels back into the memory bitmap (and
+//   optionally straight into the window, for use mid-scroll when the window
+//   already shows the cursor).
+// Arguments:
+// - fIncludeWindow - Also restore directly into the window DC.
+// Return Value:
+// - S_OK if restored, S_FALSE if there was nothing saved, or a GDI failure.
+[[nodiscard]] HRESULT GdiEngine::_RestoreCursorUnder(const bool fIncludeWindow) noexcept
+{
+    RETURN_HR_IF(S_FALSE, !_fCursorSavedValid);
+
+    SIZE const szCell = _GetRectSize(&_rcCursorSaved);
+
+    RETURN_HR_IF(E_FAIL, !(BitBlt(_hdcMemoryContext, _rcCursorSaved.left, _rcCursorSaved.top, szCell.cx, szCell.cy, _hdcCursorUnder, 0, 0, SRCCOPY)));
+
+    if (fIncludeWindow && _psInvalidData.hdc != nullptr)
+    {
+        LOG_HR_IF(E_FAIL, !(BitBlt(_psInvalidData.hdc, _rcCursorSaved.left, _rcCursorSaved.top, szCell.cx, szCell.cy, _hdcCursorUnder, 0, 0, SRCCOPY)));
+    }
+
+    _fCursorSavedValid = false;
+
     return S_OK;
 }
 
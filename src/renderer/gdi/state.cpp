@@ -30,12 +30,19 @@ GdiEngine::GdiEngine() :
     _lastFg(INVALID_COLOR),
     _lastBg(INVALID_COLOR),
     _fPaintStarted(false),
-    _hfont((HFONT)INVALID_HANDLE_VALUE)
+    _hfont((HFONT)INVALID_HANDLE_VALUE),
+    _fCursorInvalidUsed(false),
+    _hdcCursorUnder(nullptr),
+    _hbitmapCursorUnder(nullptr),
+    _fCursorSavedValid(false)
 {
     ZeroMemory(_pPolyText, sizeof(POLYTEXTW) * s_cPolyTextCache);
     _rcInvalid = { 0 };
     _szInvalidScroll = { 0 };
     _szMemorySurface = { 0 };
+    _rcCursorInvalid = { 0 };
+    _rcCursorSaved = { 0 };
+    _szCursorUnder = { 0 };
 
     _hdcMemoryContext = CreateCompatibleDC(nullptr);
     THROW_HR_IF_NULL(E_FAIL, _hdcMemoryContext);
@@ -82,6 +89,18 @@ GdiEngine::~GdiEngine()
         _hbitmapMemorySurface = nullptr;
     }
 
+    if (_hbitmapCursorUnder != nullptr)
+    {
+        LOG_HR_IF(E_FAIL, !(DeleteObject(_hbitmapCursorUnder)));
+        _hbitmapCursorUnder = nullptr;
+    }
+
+    if (_hdcCursorUnder != nullptr)
+    {
+        LOG_HR_IF(E_FAIL, !(DeleteObject(_hdcCursorUnder)));
+        _hdcCursorUnder = nullptr;
+    }
+
     if (_hfont != nullptr)
     {
         LOG_HR_IF(E_FAIL, !(DeleteObject(_hfont)));
@@ -122,6 +141,11 @@ GdiEngine::~GdiEngine()
     _hwndTargetWindow = hwnd;
     _hdcMemoryContext = hdcNewMemoryContext;
 
+    // The new DC carries default colors, so don't let the stale cache elide
+    // the first SetTextColor/SetBkColor calls against it.
+    _lastFg = INVALID_COLOR;
+    _lastBg = INVALID_COLOR;
+
     // If we have a font, apply it to the context.
     if (nullptr != _hfont)
     {
@@ -187,7 +211,14 @@ GdiEngine::~GdiEngine()
                                                       const bool /*isBold*/,
                                                       const bool isSettingDefaultBrushes) noexcept
 {
-    RETURN_IF_FAILED(_FlushBufferLines());
+    // The renderer announces the brushes ahead of every run it paints. The
+    // batched PolyTextOut lines pick up the DC colors when they're flushed, so
+    // only flush when we're actually about to change the DC state - runs that
+    // share their attributes keep accumulating into one PolyTextOutW call.
+    if (colorForeground != _lastFg || colorBackground != _lastBg || isSettingDefaultBrushes)
+    {
+        RETURN_IF_FAILED(_FlushBufferLines());
+    }
 
     RETURN_HR_IF_NULL(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), _hdcMemoryContext);
 
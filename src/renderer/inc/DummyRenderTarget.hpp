@@ -29,6 +29,9 @@ public:
     void TriggerSelection() override {}
     void TriggerScroll() override {}
     void TriggerScroll(const COORD* const /*pcoordDelta*/) override {}
+    void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& /*source*/,
+                             const Microsoft::Console::Types::Viewport& /*target*/,
+                             const Microsoft::Console::Types::Viewport& /*fill*/) override {}
     void TriggerCircling() override {}
     void TriggerTitleChange() override {}
 };
@@ -68,6 +68,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT EndPaint() noexcept = 0;
         [[nodiscard]] virtual HRESULT Present() noexcept = 0;
 
+        // Blocks until the engine is ready to accept another frame, so the
+        // render thread paces itself against whatever consumes the frames.
+        virtual void WaitUntilCanRender() noexcept = 0;
+
         [[nodiscard]] virtual HRESULT PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept = 0;
 
         [[nodiscard]] virtual HRESULT ScrollFrame() noexcept = 0;
@@ -77,6 +81,15 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT InvalidateSystem(const RECT* const prcDirtyClient) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateSelection(const std::vector<SMALL_RECT>& rectangles) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateScroll(const COORD* const pcoordDelta) noexcept = 0;
+
+        // A block of the viewport moved from source to target, uncovering
+        // fill. Engines that can replay the move themselves avoid repainting
+        // the moved block; the default just invalidates target and fill.
+        // All rects are exclusive, in viewport coordinates.
+        [[nodiscard]] virtual HRESULT InvalidateScrollRegion(const SMALL_RECT source,
+                                                             const SMALL_RECT target,
+                                                             const SMALL_RECT fill) noexcept = 0;
+
         [[nodiscard]] virtual HRESULT InvalidateAll() noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateCircling(_Out_ bool* const pForcePaint) noexcept = 0;
 
@@ -109,6 +122,13 @@ namespace Microsoft::Console::Render
                                                       const int iDpi) noexcept = 0;
 
         virtual SMALL_RECT GetDirtyRectInChars() = 0;
+        virtual SMALL_RECT GetDirtyRowInChars(const SHORT sRow) = 0;
+
+        // Whether a row this engine does not repaint keeps showing the content
+        // it painted before. True for engines that emit deltas to a remote
+        // surface (VT); false for engines that erase the invalid region at the
+        // start of every frame (GDI, DX).
+        virtual bool RetainsPaintedContent() const noexcept = 0;
         [[nodiscard]] virtual HRESULT GetFontSize(_Out_ COORD* const pFontSize) noexcept = 0;
         [[nodiscard]] virtual HRESULT IsGlyphWideByFont(const std::wstring_view glyph, _Out_ bool* const pResult) noexcept = 0;
         [[nodiscard]] virtual HRESULT UpdateTitle(const std::wstring& newTitle) noexcept = 0;
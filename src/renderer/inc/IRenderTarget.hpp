@@ -35,6 +35,14 @@ namespace Microsoft::Console::Render
         virtual void TriggerSelection() = 0;
         virtual void TriggerScroll() = 0;
         virtual void TriggerScroll(const COORD* const pcoordDelta) = 0;
+
+        // A block of the buffer was copied from source to target, uncovering
+        // fill. Render engines that can replay the move skip repainting the
+        // moved block.
+        virtual void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& source,
+                                         const Microsoft::Console::Types::Viewport& target,
+                                         const Microsoft::Console::Types::Viewport& fill) = 0;
+
         virtual void TriggerCircling() = 0;
         virtual void TriggerTitleChange() = 0;
     };
@@ -20,6 +20,7 @@ namespace Microsoft::Console::Render
     public:
         virtual ~IRenderThread() = 0;
         virtual void NotifyPaint() = 0;
+        virtual void NotifyInteractivePaint() = 0;
         virtual void EnablePainting() = 0;
         virtual void WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs) = 0;
     };
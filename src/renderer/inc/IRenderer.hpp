@@ -28,6 +28,8 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] virtual HRESULT PaintFrame() = 0;
 
+        virtual void WaitUntilCanRender() = 0;
+
         virtual void TriggerSystemRedraw(const RECT* const prcDirtyClient) = 0;
 
         virtual void TriggerRedraw(const Microsoft::Console::Types::Viewport& region) = 0;
@@ -40,6 +42,9 @@ namespace Microsoft::Console::Render
         virtual void TriggerSelection() = 0;
         virtual void TriggerScroll() = 0;
         virtual void TriggerScroll(const COORD* const pcoordDelta) = 0;
+        virtual void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& source,
+                                         const Microsoft::Console::Types::Viewport& target,
+                                         const Microsoft::Console::Types::Viewport& fill) = 0;
         virtual void TriggerCircling() = 0;
         virtual void TriggerTitleChange() = 0;
         virtual void TriggerFontChange(const int iDpi,
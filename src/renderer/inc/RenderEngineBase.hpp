@@ -31,9 +31,21 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT UpdateTitle(const std::wstring& newTitle) noexcept override;
 
+        [[nodiscard]] HRESULT InvalidateScrollRegion(const SMALL_RECT source,
+                                                     const SMALL_RECT target,
+                                                     const SMALL_RECT fill) noexcept override;
+
+        SMALL_RECT GetDirtyRowInChars(const SHORT sRow) override;
+
+        bool RetainsPaintedContent() const noexcept override;
+
+        void WaitUntilCanRender() noexcept override;
+
     protected:
         [[nodiscard]] virtual HRESULT _DoUpdateTitle(const std::wstring& newTitle) noexcept = 0;
 
+        static DWORD const s_FrameLimitMilliseconds = 8;
+
         bool _titleChanged;
         std::wstring _lastFrameTitle;
     };
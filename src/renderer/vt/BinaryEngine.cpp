@@ -0,0 +1,350 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "BinaryEngine.hpp"
+#include "../../types/inc/convert.hpp"
+#pragma hdrstop
+using namespace Microsoft::Console;
+using namespace Microsoft::Console::ConptyBinary;
+using namespace Microsoft::Console::Render;
+using namespace Microsoft::Console::Types;
+
+BinaryEngine::BinaryEngine(_In_ wil::unique_hfile hPipe,
+                           const IDefaultColorProvider& colorProvider,
+                           const Viewport initialViewport) :
+    VtEngine(std::move(hPipe), colorProvider, initialViewport),
+    _preambleEmitted(false)
+{
+    // Set our initial cursor position to -1, -1. This will force our initial
+    //      paint to emit a cursor record for 0, 0, not just ignore it.
+    _lastText = VtEngine::INVALID_COORDS;
+}
+
+// Method Description:
+// - Appends one framed record to the current frame's buffer, preceded by the
+//      stream preamble if this is the very first record we've ever written.
+//      The preamble is how the terminal recognizes a binary conhost - its
+//      leading NUL can't start VT text - so it must beat every record down
+//      the pipe.
+// Arguments:
+// - type: the kind of record to emit.
+// - pPayload: the payload bytes, or nullptr for payload-less records.
+// - cbPayload: how many payload bytes there are.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT BinaryEngine::_EmitRecord(const RecordType type,
+                                                _In_reads_bytes_opt_(cbPayload) const void* const pPayload,
+                                                const size_t cbPayload) noexcept
+{
+    if (!_preambleEmitted)
+    {
+        RETURN_IF_FAILED(_Write({ Preamble, PreambleLength }));
+        _preambleEmitted = true;
+    }
+
+    RecordHeader header;
+    header.Type = static_cast<BYTE>(type);
+    header.cbPayload = static_cast<DWORD>(cbPayload);
+    RETURN_IF_FAILED(_Write({ reinterpret_cast<const char*>(&header), sizeof(header) }));
+    if (cbPayload > 0)
+    {
+        RETURN_IF_FAILED(_Write({ static_cast<const char*>(pPayload), cbPayload }));
+    }
+    return S_OK;
+}
+
+// Method Description:
+// - Wraps a wstring in a VtPassthrough record, so it reaches the terminal's
+//      VT parser exactly as it would have in the text modes.
+// Arguments:
+// - wstr: the text to pass through, VT sequences and all.
+// Return Value:
+// - S_OK or suitable HRESULT error from the conversion or allocation.
+[[nodiscard]] HRESULT BinaryEngine::_EmitPassthrough(const std::wstring& wstr) noexcept
+{
+    try
+    {
+        const auto converted = ConvertToA(CP_UTF8, wstr);
+        return _EmitRecord(RecordType::VtPassthrough, converted.data(), converted.size());
+    }
+    CATCH_RETURN();
+}
+
+// Method Description:
+// - Prepares internal structures for a painting operation, and opens the
+//      frame with a BeginFrame record carrying our viewport dimensions.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we started to paint. S_FALSE if we didn't need to paint. HRESULT
+//      error code if painting didn't start successfully.
+[[nodiscard]] HRESULT BinaryEngine::StartPaint() noexcept
+{
+    const HRESULT hr = VtEngine::StartPaint();
+    RETURN_IF_FAILED(hr);
+    if (hr == S_FALSE)
+    {
+        return S_FALSE;
+    }
+
+    BeginFramePayload frame;
+    frame.Width = _lastViewport.Width();
+    frame.Height = _lastViewport.Height();
+    RETURN_IF_FAILED(_EmitRecord(RecordType::BeginFrame, &frame, sizeof(frame)));
+
+    return S_OK;
+}
+
+// Routine Description:
+// - EndPaint helper to perform the final rendering steps. Closes the frame
+//      with an EndFrame record - the terminal's cue to publish the applied
+//      state to its renderer in one piece.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT BinaryEngine::EndPaint() noexcept
+{
+    // The base EndPaint would replay a deferred cursor move itself, but by
+    //      then the EndFrame record below would already be in the buffer -
+    //      flush the cursor into this frame first.
+    if (_deferredCursorPos != INVALID_COORDS)
+    {
+        RETURN_IF_FAILED(_MoveCursor(_deferredCursorPos));
+    }
+
+    // Only close a frame if this frame actually emitted records - EndPaint
+    //      isn't guaranteed to pair with a painting StartPaint.
+    if (!_buffer.empty())
+    {
+        RETURN_IF_FAILED(_EmitRecord(RecordType::EndFrame, nullptr, 0));
+    }
+
+    return VtEngine::EndPaint();
+}
+
+// Routine Description:
+// - Remembers the colors the next cell runs should be painted with. Nothing
+//      is written here - the colors travel inside each CellRun record.
+// Arguments:
+// - colorForeground: The RGB Color to use to paint the foreground text.
+// - colorBackground: The RGB Color to use to paint the background of the text.
+// - legacyColorAttribute: A console attributes bit field. Unused.
+// - isBold: if true, the text should be drawn bold.
+// - isSettingDefaultBrushes: indicates if we should change the background color of
+//      the window. Unused.
+// Return Value:
+// - S_OK
+[[nodiscard]] HRESULT BinaryEngine::UpdateDrawingBrushes(const COLORREF colorForeground,
+                                                         const COLORREF colorBackground,
+                                                         const WORD /*legacyColorAttribute*/,
+                                                         const bool isBold,
+                                                         const bool /*isSettingDefaultBrushes*/) noexcept
+{
+    _LastFG = colorForeground;
+    _LastBG = colorBackground;
+    _lastWasBold = isBold;
+    return S_OK;
+}
+
+// Routine Description:
+// - Draws one line of the buffer as a single CellRun record - the run's
+//      target coordinate, colors and text travel together, so there's no
+//      cursor positioning or SGR state to maintain on the wire.
+// Arguments:
+// - clusters - text and column counts for each piece of text.
+// - coord - character coordinate target to render within viewport
+// - trimLeft - This specifies whether to trim one character width off the left
+//      side of the output. Unused - the receiver writes the full run.
+// Return Value:
+// - S_OK or suitable HRESULT error from allocation.
+[[nodiscard]] HRESULT BinaryEngine::PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                                                    const COORD coord,
+                                                    const bool /*trimLeft*/) noexcept
+{
+    if (coord.Y < _virtualTop)
+    {
+        return S_OK;
+    }
+
+    try
+    {
+        std::wstring unclusteredString;
+        unclusteredString.reserve(clusters.size());
+        for (const auto& cluster : clusters)
+        {
+            unclusteredString.append(cluster.GetText());
+        }
+
+        CellRunPayload run;
+        run.X = coord.X;
+        run.Y = coord.Y;
+        run.Foreground = _LastFG;
+        run.Background = _LastBG;
+        run.Flags = _lastWasBold ? CellRunFlagBold : 0;
+        run.cchText = gsl::narrow<USHORT>(unclusteredString.size());
+
+        std::string payload;
+        payload.reserve(sizeof(run) + unclusteredString.size() * sizeof(wchar_t));
+        payload.append(reinterpret_cast<const char*>(&run), sizeof(run));
+        payload.append(reinterpret_cast<const char*>(unclusteredString.data()),
+                       unclusteredString.size() * sizeof(wchar_t));
+
+        return _EmitRecord(RecordType::CellRun, payload.data(), payload.size());
+    }
+    CATCH_RETURN();
+}
+
+// Routine Description:
+// - Emits the scroll accumulated through InvalidateScroll this frame as one
+//      Scroll record. Only an upward move of the whole viewport has a
+//      straightforward meaning for the receiver's buffer (new rows enter at
+//      the bottom, old rows become scrollback); anything else is downgraded
+//      to a full repaint.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT BinaryEngine::ScrollFrame() noexcept
+{
+    if (_scrollDelta.X != 0)
+    {
+        // No easy way to shift left-right. Everything needs repainting.
+        return InvalidateAll();
+    }
+
+    const short dy = _scrollDelta.Y;
+    if (dy == 0)
+    {
+        // There's nothing to do here. Do nothing.
+        return S_OK;
+    }
+
+    if (dy > 0)
+    {
+        // Content moved down (a reverse line feed at the top). The receiver
+        //      can't scroll its history forward again, so repaint instead.
+        return InvalidateAll();
+    }
+
+    ScrollPayload scroll;
+    scroll.Delta = dy;
+    return _EmitRecord(RecordType::Scroll, &scroll, sizeof(scroll));
+}
+
+// Routine Description:
+// - Notifies us that the console is attempting to scroll the existing screen
+//      area. Add the top or bottom rows to the invalid region, and update the
+//      total scroll delta accumulated this frame.
+// Arguments:
+// - pcoordDelta - Pointer to character dimension (COORD) of the distance the
+//      console would like us to move while scrolling.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for safemath failure
+[[nodiscard]] HRESULT BinaryEngine::InvalidateScroll(const COORD* const pcoordDelta) noexcept
+{
+    const short dx = pcoordDelta->X;
+    const short dy = pcoordDelta->Y;
+
+    if (dx != 0 || dy != 0)
+    {
+        // Scroll the current offset
+        RETURN_IF_FAILED(_InvalidOffset(pcoordDelta));
+
+        // Add the top/bottom of the window to the invalid area
+        SMALL_RECT invalid = _lastViewport.ToOrigin().ToExclusive();
+
+        if (dy > 0)
+        {
+            invalid.Bottom = dy;
+        }
+        else if (dy < 0)
+        {
+            invalid.Top = invalid.Bottom + dy;
+        }
+        LOG_IF_FAILED(_InvalidCombine(Viewport::FromExclusive(invalid)));
+
+        COORD invalidScrollNew;
+        RETURN_IF_FAILED(ShortAdd(_scrollDelta.X, dx, &invalidScrollNew.X));
+        RETURN_IF_FAILED(ShortAdd(_scrollDelta.Y, dy, &invalidScrollNew.Y));
+
+        // Store if safemath succeeded
+        _scrollDelta = invalidScrollNew;
+    }
+
+    return S_OK;
+}
+
+// Method Description:
+// - Wrapper for ITerminalOutputConnection. The client's raw VT output rides
+//      in a VtPassthrough record to the terminal's parser.
+// Arguments:
+// - wstr - wstring of text to be written
+// Return Value:
+// - S_OK or suitable HRESULT error from the conversion or allocation.
+[[nodiscard]] HRESULT BinaryEngine::WriteTerminalW(const std::wstring& wstr) noexcept
+{
+    return _EmitPassthrough(wstr);
+}
+
+// Routine Description:
+// - Emits a CursorPosition record for the given coordinates. We also store
+//      the last place we left the cursor, so frames that don't move it emit
+//      nothing.
+// Arguments:
+// - coord: location to move the cursor to.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT BinaryEngine::_MoveCursor(COORD const coord) noexcept
+{
+    if (coord.X != _lastText.X || coord.Y != _lastText.Y)
+    {
+        CursorPositionPayload pos;
+        pos.X = coord.X;
+        pos.Y = coord.Y;
+        RETURN_IF_FAILED(_EmitRecord(RecordType::CursorPosition, &pos, sizeof(pos)));
+        _lastText = coord;
+    }
+
+    _deferredCursorPos = INVALID_COORDS;
+    return S_OK;
+}
+
+// Method Description:
+// - The base emits a window resize sequence as raw text, which would corrupt
+//      the record stream - wrap it in a passthrough record instead. The
+//      terminal sizes the pty itself through the signal pipe, so it's free
+//      to ignore the sequence; this just keeps the stream well-formed.
+// Arguments:
+// - sWidth: The new width of the window, in characters
+// - sHeight: The new height of the window, in characters
+// Return Value:
+// - S_OK or suitable HRESULT error from the conversion or allocation.
+[[nodiscard]] HRESULT BinaryEngine::_ResizeWindow(const short sWidth, const short sHeight) noexcept
+{
+    try
+    {
+        std::wstring sequence = L"\x1b[8;" + std::to_wstring(sHeight) + L";" + std::to_wstring(sWidth) + L"t";
+        return _EmitPassthrough(sequence);
+    }
+    CATCH_RETURN();
+}
+
+// Method Description:
+// - Updates the window's title string. The OSC sequence rides in a
+//      passthrough record and is handled by the terminal's parser as in the
+//      text modes.
+// Arguments:
+// - newTitle: the new string to use for the title of the window
+// Return Value:
+// - S_OK or suitable HRESULT error from the conversion or allocation.
+[[nodiscard]] HRESULT BinaryEngine::_DoUpdateTitle(const std::wstring& newTitle) noexcept
+{
+    try
+    {
+        std::wstring sequence = L"\x1b]0;" + newTitle + L"\x07";
+        return _EmitPassthrough(sequence);
+    }
+    CATCH_RETURN();
+}
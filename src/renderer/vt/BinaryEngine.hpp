@@ -0,0 +1,72 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- BinaryEngine.hpp
+
+Abstract:
+- This is the implementation of the renderer for the conpty "binary" VtIoMode.
+    Instead of serializing the buffer into VT sequences for the terminal's
+    parser to decode again, it emits the packed records from conpty-binary.h -
+    cell runs, scroll operations, cursor state - which the terminal applies
+    directly to its own text buffer. Anything that has no record shape (title
+    changes, client passthrough) is wrapped in a VtPassthrough record and
+    still goes through the terminal's VT parser.
+--*/
+
+#pragma once
+
+#include "vtrenderer.hpp"
+#include "../../inc/conpty-binary.h"
+
+namespace Microsoft::Console::Render
+{
+    class BinaryEngine : public VtEngine
+    {
+    public:
+        BinaryEngine(_In_ wil::unique_hfile hPipe,
+                     const Microsoft::Console::IDefaultColorProvider& colorProvider,
+                     const Microsoft::Console::Types::Viewport initialViewport);
+
+        virtual ~BinaryEngine() override = default;
+
+        [[nodiscard]] HRESULT StartPaint() noexcept override;
+        [[nodiscard]] HRESULT EndPaint() noexcept override;
+
+        [[nodiscard]] HRESULT UpdateDrawingBrushes(const COLORREF colorForeground,
+                                                   const COLORREF colorBackground,
+                                                   const WORD legacyColorAttribute,
+                                                   const bool isBold,
+                                                   const bool isSettingDefaultBrushes) noexcept override;
+        [[nodiscard]] HRESULT PaintBufferLine(std::basic_string_view<Cluster> const clusters,
+                                              const COORD coord,
+                                              const bool trimLeft) noexcept override;
+        [[nodiscard]] HRESULT ScrollFrame() noexcept override;
+
+        [[nodiscard]] HRESULT InvalidateScroll(const COORD* const pcoordDelta) noexcept override;
+
+        [[nodiscard]] HRESULT WriteTerminalW(_In_ const std::wstring& str) noexcept override;
+
+    protected:
+        // Set once the preamble announcing the binary stream has been
+        //      written; it has to precede the very first record, whichever
+        //      kind that turns out to be.
+        bool _preambleEmitted;
+
+        [[nodiscard]] HRESULT _EmitRecord(const ConptyBinary::RecordType type,
+                                          _In_reads_bytes_opt_(cbPayload) const void* const pPayload,
+                                          const size_t cbPayload) noexcept;
+        [[nodiscard]] HRESULT _EmitPassthrough(const std::wstring& wstr) noexcept;
+
+        [[nodiscard]] HRESULT _MoveCursor(const COORD coord) noexcept override;
+
+        [[nodiscard]] HRESULT _ResizeWindow(const short sWidth, const short sHeight) noexcept override;
+
+        [[nodiscard]] HRESULT _DoUpdateTitle(const std::wstring& newTitle) noexcept override;
+
+#ifdef UNIT_TESTING
+        friend class VtRendererTest;
+#endif
+    };
+}
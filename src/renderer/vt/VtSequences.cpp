@@ -99,6 +99,33 @@ using namespace Microsoft::Console::Render;
     return _WriteFormattedString(&format, chars);
 }
 
+// Method Description:
+// - Moves the cursor backward (left) a number of characters.
+// Arguments:
+// - chars: a number of characters to move cursor left by.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_CursorBackward(const short chars) noexcept
+{
+    static const std::string format = "\x1b[%dD";
+
+    return _WriteFormattedString(&format, chars);
+}
+
+// Method Description:
+// - Moves the cursor down a number of lines, without changing the column or
+//      scrolling when the cursor is on the bottom line.
+// Arguments:
+// - lines: a number of lines to move cursor down by.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_CursorDown(const short lines) noexcept
+{
+    static const std::string format = "\x1b[%dB";
+
+    return _WriteFormattedString(&format, lines);
+}
+
 // Method Description:
 // - Formats and writes a sequence to erase the remainer of the line starting
 //      from the cursor position.
@@ -158,6 +185,83 @@ using namespace Microsoft::Console::Render;
     return _InsertDeleteLine(sLines, true);
 }
 
+// Method Description:
+// - Formats and writes a sequence to set the scrolling region (DECSTBM) to
+//      the given rows. The input rows should be in console coordinates, where
+//      origin=0. Note the terminal will move its cursor to the home position
+//      as a side effect - the caller needs to account for that.
+// Arguments:
+// - top: the first row of the scrolling region, inclusive.
+// - bottom: the last row of the scrolling region, inclusive.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_SetScrollingRegion(const short top, const short bottom) noexcept
+{
+    static const std::string marginFormat = "\x1b[%d;%dr";
+
+    // VT coords start at 1,1
+    return _WriteFormattedString(&marginFormat, top + 1, bottom + 1);
+}
+
+// Method Description:
+// - Formats and writes a sequence to reset the scrolling region (DECSTBM) to
+//      the full screen. Like setting it, this homes the terminal's cursor.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ResetScrollingRegion() noexcept
+{
+    return _Write("\x1b[r");
+}
+
+// Method Description:
+// - Formats and writes a sequence to scroll the contents of the scrolling
+//      region up or down by a number of lines (SU/SD). Revealed lines are blank.
+// Arguments:
+// - sLines: a number of lines to scroll by
+// - fScrollUp: true iff the content should move up, false to move it down.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ScrollUpDown(const short sLines, const bool fScrollUp) noexcept
+{
+    if (sLines <= 0)
+    {
+        return S_OK;
+    }
+    if (sLines == 1)
+    {
+        return _Write(fScrollUp ? "\x1b[S" : "\x1b[T");
+    }
+    const std::string format = fScrollUp ? "\x1b[%dS" : "\x1b[%dT";
+
+    return _WriteFormattedString(&format, sLines);
+}
+
+// Method Description:
+// - Formats and writes a sequence to scroll the contents of the scrolling
+//      region up by a number of lines.
+// Arguments:
+// - sLines: a number of lines to scroll by
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ScrollUp(const short sLines) noexcept
+{
+    return _ScrollUpDown(sLines, true);
+}
+
+// Method Description:
+// - Formats and writes a sequence to scroll the contents of the scrolling
+//      region down by a number of lines.
+// Arguments:
+// - sLines: a number of lines to scroll by
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ScrollDown(const short sLines) noexcept
+{
+    return _ScrollUpDown(sLines, false);
+}
+
 // Method Description:
 // - Formats and writes a sequence to move the cursor to the specified
 //      coordinate position. The input coord should be in console coordinates,
@@ -219,11 +323,34 @@ using namespace Microsoft::Console::Render;
 // - fIsForeground: true if we should emit the foreground sequence, false for background
 // Return Value:
 // - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+// Routine Description:
+// - Appends the decimal digits of a value to a sequence buffer. SGR changes
+//      are frequent enough in colorful frames that we format them by hand
+//      instead of going through the CRT's varargs printf machinery.
+// Arguments:
+// - pch: where to write the digits. The caller guarantees enough room.
+// - value: the value to format.
+// Return Value:
+// - A pointer just past the last digit written.
+static char* s_WriteUint(_Out_writes_(10) char* pch, unsigned int value) noexcept
+{
+    char digits[10];
+    size_t cch = 0;
+    do
+    {
+        digits[cch++] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+    while (cch > 0)
+    {
+        *pch++ = digits[--cch];
+    }
+    return pch;
+}
+
 [[nodiscard]] HRESULT VtEngine::_SetGraphicsRendition16Color(const WORD wAttr,
                                                              const bool fIsForeground) noexcept
 {
-    static const std::string fmt = "\x1b[%dm";
-
     // Always check using the foreground flags, because the bg flags constants
     //  are a higher byte
     // Foreground sequences are in [30,37] U [90,97]
@@ -243,7 +370,15 @@ using namespace Microsoft::Console::Render;
                         (WI_IsFlagSet(wAttr, FOREGROUND_GREEN) ? 2 : 0) +
                         (WI_IsFlagSet(wAttr, FOREGROUND_BLUE) ? 4 : 0);
 
-    return _WriteFormattedString(&fmt, vtIndex);
+    // "\x1b[<idx>m"
+    char sequence[8];
+    char* pch = sequence;
+    *pch++ = '\x1b';
+    *pch++ = '[';
+    pch = s_WriteUint(pch, gsl::narrow_cast<unsigned int>(vtIndex));
+    *pch++ = 'm';
+
+    return _Write({ sequence, gsl::narrow_cast<size_t>(pch - sequence) });
 }
 
 // Method Description:
@@ -257,15 +392,24 @@ using namespace Microsoft::Console::Render;
 [[nodiscard]] HRESULT VtEngine::_SetGraphicsRenditionRGBColor(const COLORREF color,
                                                               const bool fIsForeground) noexcept
 {
-    const std::string fmt = fIsForeground ?
-                                "\x1b[38;2;%d;%d;%dm" :
-                                "\x1b[48;2;%d;%d;%dm";
-
-    DWORD const r = GetRValue(color);
-    DWORD const g = GetGValue(color);
-    DWORD const b = GetBValue(color);
-
-    return _WriteFormattedString(&fmt, r, g, b);
+    // "\x1b[38;2;<r>;<g>;<b>m" or "\x1b[48;2;<r>;<g>;<b>m"
+    char sequence[24];
+    char* pch = sequence;
+    *pch++ = '\x1b';
+    *pch++ = '[';
+    *pch++ = fIsForeground ? '3' : '4';
+    *pch++ = '8';
+    *pch++ = ';';
+    *pch++ = '2';
+    *pch++ = ';';
+    pch = s_WriteUint(pch, GetRValue(color));
+    *pch++ = ';';
+    pch = s_WriteUint(pch, GetGValue(color));
+    *pch++ = ';';
+    pch = s_WriteUint(pch, GetBValue(color));
+    *pch++ = 'm';
+
+    return _Write({ sequence, gsl::narrow_cast<size_t>(pch - sequence) });
 }
 
 // Method Description:
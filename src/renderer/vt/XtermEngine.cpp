@@ -42,6 +42,14 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
 {
     RETURN_IF_FAILED(VtEngine::StartPaint());
 
+    if (_lookingForCursorPosition)
+    {
+        // We're still waiting to hear where the terminal's cursor is. Don't
+        //      touch the pipe - especially not the first-paint clear below,
+        //      which would erase the very content we're about to inherit.
+        return S_FALSE;
+    }
+
     _trace.TraceLastText(_lastText);
 
     if (_firstPaint)
@@ -184,6 +192,8 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
 //  If the new cursor is only down one line from the current, only write a newline
 //  If the new cursor is only down one line and at the start of the line, write
 //      a carriage return.
+//  If the cursor stays on the same row or the same column, write the cheapest
+//      relative move (a run of backspaces/newlines, or CUF/CUB/CUD).
 //  Otherwise just write the whole sequence for moving it.
 // Arguments:
 // - coord: location to move the cursor to.
@@ -240,6 +250,55 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
             short distance = coord.X - _lastText.X;
             hr = _CursorForward(distance);
         }
+        else if (coord.Y == _lastText.Y && coord.X < _lastText.X)
+        {
+            // Same line, backward some distance. A backspace is a single
+            //      byte, so a short run of them is cheaper than CUB.
+            const short distance = _lastText.X - coord.X;
+            if (distance <= 4)
+            {
+                std::string seq = std::string(distance, '\b');
+                hr = _Write(seq);
+            }
+            else
+            {
+                hr = _CursorBackward(distance);
+            }
+        }
+        else if (coord.X == _lastText.X && coord.Y > _lastText.Y)
+        {
+            // Same column, down some distance. A newline is a single byte,
+            //      so a short run of them is cheaper than CUD.
+            const short distance = coord.Y - _lastText.Y;
+            if (distance <= 4)
+            {
+                std::string seq = std::string(distance, '\n');
+                hr = _Write(seq);
+            }
+            else
+            {
+                hr = _CursorDown(distance);
+            }
+        }
+        else if (coord.X == 0 && coord.Y > _lastText.Y)
+        {
+            // Start of a line further down - carriage return, then down.
+            //      Both pieces together are still shorter than CUP.
+            const short distance = coord.Y - _lastText.Y;
+            if (distance <= 4)
+            {
+                std::string seq = "\r" + std::string(distance, '\n');
+                hr = _Write(seq);
+            }
+            else
+            {
+                hr = _Write("\r");
+                if (SUCCEEDED(hr))
+                {
+                    hr = _CursorDown(distance);
+                }
+            }
+        }
         else
         {
             _needToDisableCursor = true;
@@ -272,6 +331,13 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
 // - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
 [[nodiscard]] HRESULT XtermEngine::ScrollFrame() noexcept
 {
+    // Replay any sub-viewport scrolls first - they can't have mixed with a
+    //      whole-screen scroll this frame (InvalidateScroll* enforce that).
+    if (!_regionScrolls.empty())
+    {
+        RETURN_IF_FAILED(_EmitRegionScrolls());
+    }
+
     if (_scrollDelta.X != 0)
     {
         // No easy way to shift left-right. Everything needs repainting.
@@ -336,6 +402,14 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
 
     if (dx != 0 || dy != 0)
     {
+        // A whole-screen scroll moves any band we promised to scroll with
+        //      margins, which would invalidate the band coordinates we
+        //      recorded. Downgrade those promises to plain repaints first.
+        if (!_regionScrolls.empty())
+        {
+            RETURN_IF_FAILED(_DropRegionScrolls());
+        }
+
         // Scroll the current offset
         RETURN_IF_FAILED(_InvalidOffset(pcoordDelta));
 
@@ -363,6 +437,134 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
     return S_OK;
 }
 
+// Routine Description:
+// - Notifies us that a block of the viewport moved (a tmux pane or vim split
+//      scrolling, DL/IL in a margin region, ScrollConsoleScreenBuffer). When
+//      the move is a vertical shift of a full-width band, we promise to
+//      replay it on the next frame with DECSTBM margins and SU/SD - a
+//      handful of bytes instead of repainting every moved row. Anything we
+//      can't express that way falls back to invalidating the moved area.
+// Arguments:
+// - source - Where the block moved from. Exclusive, viewport coordinates.
+// - target - Where the block moved to.
+// - fill - The area the move uncovered, possibly empty.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT XtermEngine::InvalidateScrollRegion(const SMALL_RECT source,
+                                                          const SMALL_RECT target,
+                                                          const SMALL_RECT fill) noexcept
+{
+    const short dx = target.Left - source.Left;
+    const short dy = target.Top - source.Top;
+
+    const SMALL_RECT view = _lastViewport.ToOrigin().ToExclusive();
+    const SHORT bandTop = std::min(source.Top, target.Top);
+    const SHORT bandBottom = std::max(source.Bottom, target.Bottom);
+
+    // DECSTBM margins can only express a vertical move of a full-width band
+    //      that's entirely on screen. Also refuse to mix with a pending
+    //      whole-screen scroll - the moves would reorder against each other.
+    if (dx != 0 || dy == 0 ||
+        source.Left > view.Left || source.Right < view.Right ||
+        bandTop < view.Top || bandBottom > view.Bottom ||
+        bandTop < _virtualTop ||
+        _scrollDelta.X != 0 || _scrollDelta.Y != 0)
+    {
+        return RenderEngineBase::InvalidateScrollRegion(source, target, fill);
+    }
+
+    // Any rows already invalid inside the band move along with its content.
+    RETURN_IF_FAILED(_InvalidOffsetRegion({ view.Left, bandTop, view.Right, bandBottom }, dy));
+
+    // The uncovered rows need painting once the band has been scrolled.
+    if (fill.Bottom > fill.Top && fill.Right > fill.Left)
+    {
+        RETURN_IF_FAILED(Invalidate(&fill));
+    }
+
+    try
+    {
+        // TUIs scroll a pane one line at a time - coalesce repeats on the
+        //      same band into a single margin scroll.
+        if (!_regionScrolls.empty() &&
+            _regionScrolls.back().top == bandTop &&
+            _regionScrolls.back().bottom == bandBottom)
+        {
+            _regionScrolls.back().delta += dy;
+        }
+        else
+        {
+            _regionScrolls.push_back({ bandTop, bandBottom, dy });
+        }
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Writes out the sub-viewport scrolls recorded by InvalidateScrollRegion:
+//      set the margins around the band, scroll within them, reset the
+//      margins. Both DECSTBM writes home the terminal's cursor, so our
+//      cursor tracking is updated to match.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to write.
+[[nodiscard]] HRESULT XtermEngine::_EmitRegionScrolls() noexcept
+{
+    // Take the list now so a failed write can't replay a scroll twice.
+    const std::vector<RegionScroll> scrolls = std::move(_regionScrolls);
+    _regionScrolls.clear();
+
+    for (const auto& scroll : scrolls)
+    {
+        if (scroll.delta == 0)
+        {
+            // Repeated scrolls in opposite directions cancelled out.
+            continue;
+        }
+
+        RETURN_IF_FAILED(_SetScrollingRegion(scroll.top, scroll.bottom - 1));
+        if (scroll.delta < 0)
+        {
+            RETURN_IF_FAILED(_ScrollUp(-scroll.delta));
+        }
+        else
+        {
+            RETURN_IF_FAILED(_ScrollDown(scroll.delta));
+        }
+        RETURN_IF_FAILED(_ResetScrollingRegion());
+
+        _lastText = { 0, 0 };
+    }
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Downgrades every pending sub-viewport scroll into a plain invalidation
+//      of its band. Used when something arrives this frame (a whole-screen
+//      scroll) that would move the recorded band coordinates out from under
+//      the promise.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT XtermEngine::_DropRegionScrolls() noexcept
+{
+    for (const auto& scroll : _regionScrolls)
+    {
+        SMALL_RECT band = _lastViewport.ToOrigin().ToExclusive();
+        band.Top = scroll.top;
+        band.Bottom = scroll.bottom;
+        RETURN_IF_FAILED(Invalidate(&band));
+    }
+    _regionScrolls.clear();
+
+    return S_OK;
+}
+
 // Routine Description:
 // - Draws one line of the buffer to the screen. Writes the characters to the
 //      pipe, encoded in UTF-8 or ASCII only, depending on the VtIoMode.
@@ -50,6 +50,9 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT ScrollFrame() noexcept override;
 
         [[nodiscard]] HRESULT InvalidateScroll(const COORD* const pcoordDelta) noexcept override;
+        [[nodiscard]] HRESULT InvalidateScrollRegion(const SMALL_RECT source,
+                                                     const SMALL_RECT target,
+                                                     const SMALL_RECT fill) noexcept override;
 
         [[nodiscard]] HRESULT WriteTerminalW(_In_ const std::wstring& str) noexcept override;
 
@@ -61,6 +64,22 @@ namespace Microsoft::Console::Render
         bool _usingUnderLine;
         bool _needToDisableCursor;
 
+        // A sub-viewport scroll we've promised to replay with DECSTBM margins
+        //      and SU/SD on the next frame, instead of repainting the moved
+        //      band. Rows are viewport coordinates; top inclusive, bottom
+        //      exclusive. A negative delta moved the content up.
+        struct RegionScroll
+        {
+            SHORT top;
+            SHORT bottom;
+            SHORT delta;
+        };
+
+        std::vector<RegionScroll> _regionScrolls;
+
+        [[nodiscard]] HRESULT _EmitRegionScrolls() noexcept;
+        [[nodiscard]] HRESULT _DropRegionScrolls() noexcept;
+
         [[nodiscard]] HRESULT _MoveCursor(const COORD coord) noexcept override;
 
         [[nodiscard]] HRESULT _UpdateUnderline(const WORD wLegacyAttrs) noexcept;
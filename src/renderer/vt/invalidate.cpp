@@ -146,6 +146,31 @@ using namespace Microsoft::Console::Render;
         _invalidRect = Viewport::Union(_invalidRect, invalid);
     }
 
+    // Widen the per-row spans too. Unlike the bounding rect, a row that this
+    //      region doesn't touch keeps its old (possibly empty) span.
+    try
+    {
+        const SMALL_RECT sr = invalid.ToExclusive();
+        if (sr.Bottom > gsl::narrow<SHORT>(_invalidRowRuns.size()))
+        {
+            _invalidRowRuns.resize(sr.Bottom, { 0, 0 });
+        }
+        for (SHORT row = std::max<SHORT>(sr.Top, 0); row < sr.Bottom; row++)
+        {
+            auto& run = _invalidRowRuns.at(row);
+            if (run.first == run.second)
+            {
+                run = { sr.Left, sr.Right };
+            }
+            else
+            {
+                run.first = std::min(run.first, sr.Left);
+                run.second = std::max(run.second, sr.Right);
+            }
+        }
+    }
+    CATCH_RETURN();
+
     // Ensure invalid areas remain within bounds of window.
     RETURN_IF_FAILED(_InvalidRestrict());
 
@@ -171,6 +196,40 @@ using namespace Microsoft::Console::Render;
             // This is the equivalent of adding in the "update rectangle" that we would get out of ScrollWindowEx/ScrollDC.
             _invalidRect = Viewport::Union(_invalidRect, newInvalid);
 
+            // Shift the row spans the same way: each dirty row stays dirty
+            //      where it was AND where it scrolled to.
+            std::vector<std::pair<SHORT, SHORT>> shifted = _invalidRowRuns;
+            for (SHORT row = 0; row < gsl::narrow<SHORT>(_invalidRowRuns.size()); row++)
+            {
+                const auto& run = _invalidRowRuns.at(row);
+                if (run.first == run.second)
+                {
+                    continue;
+                }
+                const SHORT target = row + pCoord->Y;
+                if (target < 0)
+                {
+                    continue;
+                }
+                if (target >= gsl::narrow<SHORT>(shifted.size()))
+                {
+                    shifted.resize(gsl::narrow_cast<size_t>(target) + 1, { 0, 0 });
+                }
+                auto& targetRun = shifted.at(target);
+                const SHORT left = run.first + pCoord->X;
+                const SHORT right = run.second + pCoord->X;
+                if (targetRun.first == targetRun.second)
+                {
+                    targetRun = { left, right };
+                }
+                else
+                {
+                    targetRun.first = std::min(targetRun.first, left);
+                    targetRun.second = std::max(targetRun.second, right);
+                }
+            }
+            _invalidRowRuns.swap(shifted);
+
             // Ensure invalid areas remain within bounds of window.
             RETURN_IF_FAILED(_InvalidRestrict());
         }
@@ -180,6 +239,78 @@ using namespace Microsoft::Console::Render;
     return S_OK;
 }
 
+// Routine Description:
+// - Helper to adjust the invalid region for a scroll that only moved a band
+//      of the viewport (a DECSTBM margin scroll). Only rows inside the band
+//      move; pending invalid content that scrolls out of the band is clipped
+//      away, and rows outside the band stay where they are.
+// Arguments:
+// - region - The band that moved, in viewport coordinates. Exclusive.
+// - dy - The number of rows the band's content moved by.
+// Return Value:
+// - S_OK, else an appropriate HRESULT for failing to allocate.
+[[nodiscard]] HRESULT VtEngine::_InvalidOffsetRegion(const SMALL_RECT region, const short dy) noexcept
+{
+    if (dy == 0)
+    {
+        return S_OK;
+    }
+
+    try
+    {
+        if (gsl::narrow<SHORT>(_invalidRowRuns.size()) < region.Bottom)
+        {
+            _invalidRowRuns.resize(region.Bottom, { 0, 0 });
+        }
+
+        std::vector<std::pair<SHORT, SHORT>> shifted = _invalidRowRuns;
+        for (SHORT row = region.Top; row < region.Bottom; row++)
+        {
+            shifted.at(row) = { 0, 0 };
+        }
+        for (SHORT row = region.Top; row < region.Bottom; row++)
+        {
+            const auto& run = _invalidRowRuns.at(row);
+            if (run.first == run.second)
+            {
+                continue;
+            }
+            const SHORT target = row + dy;
+            if (target < region.Top || target >= region.Bottom)
+            {
+                continue;
+            }
+            auto& targetRun = shifted.at(target);
+            if (targetRun.first == targetRun.second)
+            {
+                targetRun = run;
+            }
+            else
+            {
+                targetRun.first = std::min(targetRun.first, run.first);
+                targetRun.second = std::max(targetRun.second, run.second);
+            }
+        }
+        _invalidRowRuns.swap(shifted);
+
+        // For the bounding rectangle, be conservative: if it overlaps the
+        //      band at all, grow it over the whole band. The per-row spans
+        //      keep the actual repaint narrow.
+        if (_fInvalidRectUsed)
+        {
+            const auto band = Viewport::FromExclusive(region);
+            const auto overlap = Viewport::Intersect(_invalidRect, band);
+            if (overlap.Width() > 0 && overlap.Height() > 0)
+            {
+                _invalidRect = Viewport::Union(_invalidRect, band);
+            }
+        }
+    }
+    CATCH_RETURN();
+
+    return S_OK;
+}
+
 // Routine Description:
 // - Helper to ensure the invalid region remains within the bounds of the viewport.
 // Arguments:
@@ -194,5 +325,25 @@ using namespace Microsoft::Console::Render;
 
     _invalidRect = Viewport::FromExclusive(oldInvalid);
 
+    // Clamp the row spans to the viewport as well.
+    try
+    {
+        const SMALL_RECT view = _lastViewport.ToOrigin().ToExclusive();
+        if (gsl::narrow<SHORT>(_invalidRowRuns.size()) > view.Bottom)
+        {
+            _invalidRowRuns.resize(view.Bottom);
+        }
+        for (auto& run : _invalidRowRuns)
+        {
+            run.first = std::max(run.first, view.Left);
+            run.second = std::min(run.second, view.Right);
+            if (run.first >= run.second)
+            {
+                run = { 0, 0 };
+            }
+        }
+    }
+    CATCH_RETURN();
+
     return S_OK;
 }
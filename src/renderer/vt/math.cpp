@@ -27,6 +27,45 @@ SMALL_RECT VtEngine::GetDirtyRectInChars()
     return dirty;
 }
 
+// Routine Description:
+// - Gets the dirty span of a single row, so the renderer only repaints the
+//      columns this row actually changed instead of the bounding box of
+//      everything invalid this frame.
+// Arguments:
+// - sRow - The row to query, in viewport coordinates.
+// Return Value:
+// - The inclusive character span of the row needing repaint. An empty rect
+//      (Right < Left) if the row is clean.
+SMALL_RECT VtEngine::GetDirtyRowInChars(const SHORT sRow)
+{
+    if (sRow >= _virtualTop &&
+        sRow >= 0 &&
+        sRow < gsl::narrow<SHORT>(_invalidRowRuns.size()))
+    {
+        const auto& run = _invalidRowRuns.at(sRow);
+        if (run.first < run.second)
+        {
+            // The runs are exclusive on the right; the rect is inclusive.
+            return { run.first, sRow, run.second - 1, sRow };
+        }
+    }
+    return { 0, sRow, -1, sRow };
+}
+
+// Routine Description:
+// - Reports that this engine never erases what it previously painted. We only
+//      emit the sequences for changed regions, and the attached terminal keeps
+//      everything else - so the renderer may skip rows whose content it knows
+//      we already painted.
+// Arguments:
+// - <none>
+// Return Value:
+// - true
+bool VtEngine::RetainsPaintedContent() const noexcept
+{
+    return true;
+}
+
 // Routine Description:
 // - Uses the currently selected font to determine how wide the given character will be when renderered.
 // - NOTE: Only supports determining half-width/full-width status for CJK-type languages (e.g. is it 1 character wide or 2. a.k.a. is it a rectangle or square.)
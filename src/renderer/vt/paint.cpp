@@ -25,6 +25,14 @@ using namespace Microsoft::Console::Types;
         return S_FALSE;
     }
 
+    if (_lookingForCursorPosition)
+    {
+        // We've asked the terminal where its cursor is, and the answer hasn't
+        //      arrived yet. Hold the frame - the invalid regions accumulate
+        //      and ship together in the first frame after InheritCursor.
+        return S_FALSE;
+    }
+
     // If there's nothing to do, quick return
     bool somethingToDo = _fInvalidRectUsed ||
                          (_scrollDelta.X != 0 || _scrollDelta.Y != 0) ||
@@ -49,9 +57,11 @@ using namespace Microsoft::Console::Types;
 [[nodiscard]] HRESULT VtEngine::EndPaint() noexcept
 {
     _trace.TraceEndPaint();
+    _trace.TraceFrame(_buffer.size());
 
     _invalidRect = Viewport::Empty();
     _fInvalidRectUsed = false;
+    _invalidRowRuns.clear();
     _scrollDelta = { 0 };
     _clearedAllThisFrame = false;
     _cursorMoved = false;
@@ -253,6 +263,50 @@ using namespace Microsoft::Console::Types;
     return S_OK;
 }
 
+// Routine Description:
+// - Finds the color table index nearest to the given color, remembering the
+//      answer so the linear distance search only runs the first time a color
+//      is seen. Colorful TUI frames revisit the same handful of RGB values
+//      thousands of times per repaint, so this makes downconversion for
+//      16-color terminals effectively O(1) per attribute change.
+// - The memo is keyed on the exact palette contents: if the palette is
+//      swapped or edited in place (OSC 4 and friends), the comparison fails
+//      and the memo starts over.
+// Arguments:
+// - color: The RGB color to downconvert.
+// - ColorTable: An array of colors to find the closest match to.
+// - cColorTable: size of the color table.
+// Return Value:
+// - The table index whose color is nearest to the requested one.
+[[nodiscard]] WORD VtEngine::_FindNearestTableIndexCached(const COLORREF color,
+                                                          _In_reads_(cColorTable) const COLORREF* const ColorTable,
+                                                          const WORD cColorTable) noexcept
+{
+    try
+    {
+        if (_nearestIndexPalette.size() != cColorTable ||
+            memcmp(_nearestIndexPalette.data(), ColorTable, sizeof(COLORREF) * cColorTable) != 0)
+        {
+            _nearestIndexCache.clear();
+            _nearestIndexPalette.assign(ColorTable, ColorTable + cColorTable);
+        }
+
+        const auto found = _nearestIndexCache.find(color);
+        if (found != _nearestIndexCache.end())
+        {
+            return found->second;
+        }
+
+        const WORD nearest = ::FindNearestTableIndex(color, ColorTable, cColorTable);
+        _nearestIndexCache.emplace(color, nearest);
+        return nearest;
+    }
+    CATCH_LOG();
+
+    // Out of memory for the memo - just answer the question directly.
+    return ::FindNearestTableIndex(color, ColorTable, cColorTable);
+}
+
 // Routine Description:
 // - Write a VT sequence to change the current colors of text. It will try to
 //      find the colors in the color table that are nearest to the input colors,
@@ -301,7 +355,7 @@ using namespace Microsoft::Console::Types;
 
         if (fgChanged)
         {
-            const WORD wNearestFg = ::FindNearestTableIndex(colorForeground, ColorTable, cColorTable);
+            const WORD wNearestFg = _FindNearestTableIndexCached(colorForeground, ColorTable, cColorTable);
             RETURN_IF_FAILED(_SetGraphicsRendition16Color(wNearestFg, true));
 
             _LastFG = colorForeground;
@@ -309,7 +363,7 @@ using namespace Microsoft::Console::Types;
 
         if (bgChanged)
         {
-            const WORD wNearestBg = ::FindNearestTableIndex(colorBackground, ColorTable, cColorTable);
+            const WORD wNearestBg = _FindNearestTableIndexCached(colorBackground, ColorTable, cColorTable);
             RETURN_IF_FAILED(_SetGraphicsRendition16Color(wNearestBg, false));
 
             _LastBG = colorBackground;
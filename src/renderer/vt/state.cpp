@@ -49,7 +49,10 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
     _circled(false),
     _firstPaint(true),
     _skipCursor(false),
+    _flightResult(S_OK),
+    _writerExiting(false),
     _pipeBroken(false),
+    _lookingForCursorPosition(false),
     _exitResult{ S_OK },
     _terminalOwner{ nullptr },
     _newBottomLine{ false },
@@ -65,6 +68,19 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
 #endif
 }
 
+VtEngine::~VtEngine()
+{
+    if (_writerThread)
+    {
+        // Let the in-flight frame drain, then ask the writer to exit and wait
+        //      for it - it touches our members, so it can't outlive us.
+        WaitForSingleObject(_flushComplete.get(), INFINITE);
+        _writerExiting = true;
+        SetEvent(_flushRequested.get());
+        WaitForSingleObject(_writerThread.get(), INFINITE);
+    }
+}
+
 // Method Description:
 // - Writes the characters to our file handle. If we're building the unit tests,
 //      we can instead write to the test callback, in order to avoid needing to
@@ -103,13 +119,20 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
     }
 #endif
 
-    if (!_pipeBroken)
+    if (!_pipeBroken && !_buffer.empty())
     {
-        bool fSuccess = !!WriteFile(_hFile.get(), _buffer.data(), static_cast<DWORD>(_buffer.size()), nullptr, nullptr);
-        _buffer.clear();
-        if (!fSuccess)
+        RETURN_IF_FAILED(_StartWriterThread());
+
+        // Wait for the previous frame to finish draining. Usually the writer
+        //      is long done and this returns immediately; when the terminal is
+        //      slow, this is the backpressure that keeps us from buffering
+        //      unboundedly far ahead of it.
+        WaitForSingleObject(_flushComplete.get(), INFINITE);
+
+        if (FAILED(_flightResult))
         {
-            _exitResult = HRESULT_FROM_WIN32(GetLastError());
+            _buffer.clear();
+            _exitResult = _flightResult;
             _pipeBroken = true;
             if (_terminalOwner)
             {
@@ -117,8 +140,150 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
             }
             return _exitResult;
         }
+
+        // Hand the finished frame to the writer and start the next one in the
+        //      (now empty) buffer it gave back.
+        _flightBuffer.swap(_buffer);
+        ResetEvent(_flushComplete.get());
+        SetEvent(_flushRequested.get());
+    }
+
+    return S_OK;
+}
+
+// Method Description:
+// - Creates the events and the thread that performs the actual pipe writes,
+//      the first time we have something to write. Unit tests never get here -
+//      they use the test callback in _Write instead of a real pipe.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if the writer is running, else an HRESULT from event/thread creation.
+[[nodiscard]] HRESULT VtEngine::_StartWriterThread() noexcept
+{
+    if (_writerThread)
+    {
+        return S_OK;
+    }
+
+    _flushRequested.reset(CreateEventW(nullptr, FALSE, FALSE, nullptr));
+    RETURN_LAST_ERROR_IF_NULL(_flushRequested.get());
+
+    // Manual-reset and initially signaled - there's no write in flight yet.
+    _flushComplete.reset(CreateEventW(nullptr, TRUE, TRUE, nullptr));
+    RETURN_LAST_ERROR_IF_NULL(_flushComplete.get());
+
+    _writerThread.reset(CreateThread(nullptr, 0, VtEngine::s_WriterThreadProc, this, 0, nullptr));
+    RETURN_LAST_ERROR_IF_NULL(_writerThread.get());
+
+    return S_OK;
+}
+
+// Function Description:
+// - Static function used for initializing an instance's ThreadProc.
+// Arguments:
+// - lpParameter - A pointer to the VtEngine instance that should be called.
+// Return Value:
+// - The return value of the underlying instance's _WriterThreadProc
+DWORD WINAPI VtEngine::s_WriterThreadProc(_In_ LPVOID lpParameter)
+{
+    VtEngine* const pInstance = reinterpret_cast<VtEngine*>(lpParameter);
+    return pInstance->_WriterThreadProc();
+}
+
+// Method Description:
+// - The ThreadProc for the writer thread. Hands each frame queued by _Flush
+//      to the terminal - through the shared-memory ring when one was
+//      negotiated, through the pipe otherwise - blocking here (instead of on
+//      the render thread) until the terminal drains it.
+// Return Value:
+// - 0 when asked to exit.
+DWORD VtEngine::_WriterThreadProc()
+{
+    // How long a full ring can sit undrained before we probe whether the
+    //      terminal is still alive.
+    const DWORD dwRingStallTimeout = 1000;
+
+    while (true)
+    {
+        WaitForSingleObject(_flushRequested.get(), INFINITE);
+        if (_writerExiting)
+        {
+            break;
+        }
+
+        HRESULT hr = S_OK;
+        if (_ringProducer.IsInitialized())
+        {
+            // Fast path: copy the frame into the shared ring. If the ring
+            //      stays full past the stall timeout, a zero-byte write on
+            //      the pipe tells a slow terminal (keep waiting) apart from a
+            //      dead one (fail the frame so the engine shuts down like a
+            //      broken pipe).
+            size_t cbWritten = 0;
+            while (cbWritten < _flightBuffer.size())
+            {
+                size_t cbThis = 0;
+                hr = _ringProducer.Write(_flightBuffer.data() + cbWritten,
+                                         _flightBuffer.size() - cbWritten,
+                                         dwRingStallTimeout,
+                                         &cbThis);
+                cbWritten += cbThis;
+                if (hr == HRESULT_FROM_WIN32(ERROR_TIMEOUT))
+                {
+                    if (!WriteFile(_hFile.get(), "", 0, nullptr, nullptr))
+                    {
+                        hr = HRESULT_FROM_WIN32(GetLastError());
+                        break;
+                    }
+                    continue;
+                }
+                if (FAILED(hr))
+                {
+                    break;
+                }
+            }
+        }
+        else if (!WriteFile(_hFile.get(), _flightBuffer.data(), static_cast<DWORD>(_flightBuffer.size()), nullptr, nullptr))
+        {
+            hr = HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        if (FAILED(hr))
+        {
+            // Record the failure; the render thread deals with it (and the
+            //      terminal owner) on its next flush.
+            _flightResult = hr;
+        }
+        _flightBuffer.clear();
+        SetEvent(_flushComplete.get());
     }
+    return 0;
+}
 
+// Method Description:
+// - Adopts the shared-memory output ring the terminal offered on our
+//      commandline. On success the writer thread publishes every frame
+//      through the ring; any failure leaves the engine writing to the pipe
+//      as before.
+// Arguments:
+// - ringSection: the section containing the ring's control block and payload.
+// - ringDataReady: the event we set after publishing bytes.
+// - ringSpaceAvailable: the event the terminal sets after consuming bytes.
+// Return Value:
+// - S_OK if the ring was mapped and validated, otherwise an appropriate HRESULT.
+[[nodiscard]] HRESULT VtEngine::SetOutputRing(wil::unique_handle ringSection,
+                                              wil::unique_handle ringDataReady,
+                                              wil::unique_handle ringSpaceAvailable) noexcept
+{
+    RETURN_HR_IF(E_INVALIDARG, !ringSection || !ringDataReady || !ringSpaceAvailable);
+
+    RETURN_IF_FAILED(_ringProducer.Initialize(ringSection.get(), ringDataReady.get(), ringSpaceAvailable.get()));
+
+    // The producer doesn't own the handles; keep them alive alongside it.
+    _hRingSection = std::move(ringSection);
+    _hRingDataReady = std::move(ringDataReady);
+    _hRingSpaceAvailable = std::move(ringSpaceAvailable);
     return S_OK;
 }
 
@@ -132,16 +297,37 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
 // Method Description:
 // - Writes a wstring to the tty, encoded as full utf-8. This is one
 //      implementation of the WriteTerminalW method.
+// - Converts into _conversionBuffer rather than a fresh string, so the only
+//      allocations here are capacity growth the first few frames.
 // Arguments:
 // - wstr - wstring of text to be written
 // Return Value:
 // - S_OK or suitable HRESULT error from either conversion or writing pipe.
 [[nodiscard]] HRESULT VtEngine::_WriteTerminalUtf8(const std::wstring& wstr) noexcept
 {
+    if (wstr.empty())
+    {
+        return S_OK;
+    }
+
     try
     {
-        const auto converted = ConvertToA(CP_UTF8, wstr);
-        return _Write(converted);
+        // Worst case utf-8 expansion of utf-16 text is three bytes per code
+        //      unit (a surrogate pair is two units and four bytes). Sizing
+        //      for that up front skips the extra WideCharToMultiByte pass
+        //      that measuring exactly would cost.
+        _conversionBuffer.resize(wstr.size() * 3);
+        const int cchConverted = WideCharToMultiByte(CP_UTF8,
+                                                     0,
+                                                     wstr.data(),
+                                                     gsl::narrow<int>(wstr.size()),
+                                                     _conversionBuffer.data(),
+                                                     gsl::narrow<int>(_conversionBuffer.size()),
+                                                     nullptr,
+                                                     nullptr);
+        RETURN_LAST_ERROR_IF(0 == cchConverted);
+
+        return _Write({ _conversionBuffer.data(), gsl::narrow<size_t>(cchConverted) });
     }
     CATCH_RETURN();
 }
@@ -157,19 +343,23 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
 // - S_OK or suitable HRESULT error from writing pipe.
 [[nodiscard]] HRESULT VtEngine::_WriteTerminalAscii(const std::wstring& wstr) noexcept
 {
-    const size_t cchActual = wstr.length();
+    try
+    {
+        _conversionBuffer.resize(wstr.size());
 
-    std::string needed;
-    needed.reserve(wstr.size());
+        // An index loop over both buffers (instead of push_back) keeps this a
+        //      straight load/compare/store the compiler can vectorize.
+        for (size_t i = 0; i < wstr.size(); ++i)
+        {
+            // We're explicitly replacing characters outside ASCII with a ? because
+            //      that's what telnet wants.
+            const auto wch = wstr[i];
+            _conversionBuffer[i] = (wch > L'\x7f') ? '?' : static_cast<char>(wch);
+        }
 
-    for (const auto& wch : wstr)
-    {
-        // We're explicitly replacing characters outside ASCII with a ? because
-        //      that's what telnet wants.
-        needed.push_back((wch > L'\x7f') ? '?' : static_cast<char>(wch));
+        return _Write({ _conversionBuffer.data(), wstr.size() });
     }
-
-    return _Write(needed);
+    CATCH_RETURN();
 }
 
 // Method Description:
@@ -395,6 +585,8 @@ bool VtEngine::_AllIsInvalid() const
     _skipCursor = true;
     // Prevent us from clearing the entire viewport on the first paint
     _firstPaint = false;
+    // The answer we were waiting for has arrived - frames may flow again.
+    _lookingForCursorPosition = false;
     return S_OK;
 }
 
@@ -407,12 +599,16 @@ void VtEngine::SetTerminalOwner(Microsoft::Console::ITerminalOwner* const termin
 // - sends a sequence to request the end terminal to tell us the
 //      cursor position. The terminal will reply back on the vt input handle.
 //   Flushes the buffer as well, to make sure the request is sent to the terminal.
+//   Also holds back all frames until InheritCursor is called with the reply -
+//      a frame painted before we know where the terminal left its cursor would
+//      overwrite the very content we're trying to inherit.
 // Arguments:
 // - <none>
 // Return Value:
 // - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
 HRESULT VtEngine::RequestCursor() noexcept
 {
+    _lookingForCursorPosition = true;
     RETURN_IF_FAILED(_RequestCursor());
     RETURN_IF_FAILED(_Flush());
     return S_OK;
@@ -28,6 +28,7 @@ RenderTracing::~RenderTracing()
 #endif UNIT_TESTING
 }
 
+#ifdef ENABLE_VT_RENDER_TRACING
 // Function Description:
 // - Convert the string to only have printable characters in it. Control
 //      characters are converted to hat notation, spaces are converted to "SPC"
@@ -64,19 +65,6 @@ std::string toPrintableString(const std::string_view& inString)
     }
     return retval;
 }
-void RenderTracing::TraceString(const std::string_view& instr) const
-{
-#ifndef UNIT_TESTING
-    const std::string _seq = toPrintableString(instr);
-    const char* const seq = _seq.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceString",
-                      TraceLoggingString(seq),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
-#else
-    UNREFERENCED_PARAMETER(instr);
-#endif UNIT_TESTING
-}
 
 std::string _ViewportToString(const Viewport& view)
 {
@@ -113,45 +101,68 @@ std::string _CoordToString(const COORD& c)
     // just inline it to _CoordToString().c_str()
     return s;
 }
+#endif // ENABLE_VT_RENDER_TRACING
+
+void RenderTracing::TraceString(const std::string_view& instr) const
+{
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        const std::string _seq = toPrintableString(instr);
+        const char* const seq = _seq.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceString",
+                          TraceLoggingString(seq),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
+#else
+    UNREFERENCED_PARAMETER(instr);
+#endif
+}
 
 void RenderTracing::TraceInvalidate(const Viewport invalidRect) const
 {
-#ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(invalidRect);
-    const auto invalidated = invalidatedStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceInvalidate",
-                      TraceLoggingString(invalidated),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        const auto invalidatedStr = _ViewportToString(invalidRect);
+        const auto invalidated = invalidatedStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceInvalidate",
+                          TraceLoggingString(invalidated),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
 #else
     UNREFERENCED_PARAMETER(invalidRect);
-#endif UNIT_TESTING
+#endif
 }
 
 void RenderTracing::TraceInvalidateAll(const Viewport viewport) const
 {
-#ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(viewport);
-    const auto invalidatedAll = invalidatedStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceInvalidateAll",
-                      TraceLoggingString(invalidatedAll),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        const auto invalidatedStr = _ViewportToString(viewport);
+        const auto invalidatedAll = invalidatedStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceInvalidateAll",
+                          TraceLoggingString(invalidatedAll),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
 #else
     UNREFERENCED_PARAMETER(viewport);
-#endif UNIT_TESTING
+#endif
 }
 
 void RenderTracing::TraceTriggerCircling(const bool newFrame) const
 {
-#ifndef UNIT_TESTING
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceTriggerCircling",
-                      TraceLoggingBool(newFrame),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceTriggerCircling",
+                          TraceLoggingBool(newFrame),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
 #else
     UNREFERENCED_PARAMETER(newFrame);
-#endif UNIT_TESTING
+#endif
 }
 
 void RenderTracing::TraceStartPaint(const bool quickReturn,
@@ -161,22 +172,24 @@ void RenderTracing::TraceStartPaint(const bool quickReturn,
                                     const COORD scrollDelt,
                                     const bool cursorMoved) const
 {
-#ifndef UNIT_TESTING
-    const auto invalidatedStr = _ViewportToString(invalidRect);
-    const auto invalidated = invalidatedStr.c_str();
-    const auto lastViewStr = _ViewportToString(lastViewport);
-    const auto lastView = lastViewStr.c_str();
-    const auto scrollDeltaStr = _CoordToString(scrollDelt);
-    const auto scrollDelta = scrollDeltaStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceStartPaint",
-                      TraceLoggingBool(quickReturn),
-                      TraceLoggingBool(invalidRectUsed),
-                      TraceLoggingString(invalidated),
-                      TraceLoggingString(lastView),
-                      TraceLoggingString(scrollDelta),
-                      TraceLoggingBool(cursorMoved),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        const auto invalidatedStr = _ViewportToString(invalidRect);
+        const auto invalidated = invalidatedStr.c_str();
+        const auto lastViewStr = _ViewportToString(lastViewport);
+        const auto lastView = lastViewStr.c_str();
+        const auto scrollDeltaStr = _CoordToString(scrollDelt);
+        const auto scrollDelta = scrollDeltaStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceStartPaint",
+                          TraceLoggingBool(quickReturn),
+                          TraceLoggingBool(invalidRectUsed),
+                          TraceLoggingString(invalidated),
+                          TraceLoggingString(lastView),
+                          TraceLoggingString(scrollDelta),
+                          TraceLoggingBool(cursorMoved),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
 #else
     UNREFERENCED_PARAMETER(quickReturn);
     UNREFERENCED_PARAMETER(invalidRectUsed);
@@ -184,29 +197,57 @@ void RenderTracing::TraceStartPaint(const bool quickReturn,
     UNREFERENCED_PARAMETER(lastViewport);
     UNREFERENCED_PARAMETER(scrollDelt);
     UNREFERENCED_PARAMETER(cursorMoved);
-#endif UNIT_TESTING
+#endif
 }
 
 void RenderTracing::TraceEndPaint() const
 {
-#ifndef UNIT_TESTING
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceEndPaint",
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
-#else
-#endif UNIT_TESTING
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceEndPaint",
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
+#endif
 }
 
 void RenderTracing::TraceLastText(const COORD lastTextPos) const
 {
-#ifndef UNIT_TESTING
-    const auto lastTextStr = _CoordToString(lastTextPos);
-    const auto lastText = lastTextStr.c_str();
-    TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
-                      "VtEngine_TraceLastText",
-                      TraceLoggingString(lastText),
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+#ifdef ENABLE_VT_RENDER_TRACING
+    _TraceIfListening([&]() {
+        const auto lastTextStr = _CoordToString(lastTextPos);
+        const auto lastText = lastTextStr.c_str();
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceLastText",
+                          TraceLoggingString(lastText),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    });
 #else
     UNREFERENCED_PARAMETER(lastTextPos);
+#endif
+}
+
+// Routine Description:
+// - Emits the always-on per-frame counter event. One event of two integers
+//      per frame is cheap enough to leave enabled outside verbose sessions -
+//      consumers derive frames per second from the event rate and bytes per
+//      frame directly from the payload. Stays available even when the verbose
+//      surface is compiled out.
+// Arguments:
+// - bytesInFrame - The number of bytes this frame produced for the pipe.
+// Return Value:
+// - <none>
+void RenderTracing::TraceFrame(const size_t bytesInFrame) const
+{
+#ifndef UNIT_TESTING
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_INFO, 0))
+    {
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_Frame",
+                          TraceLoggingUInt64(gsl::narrow_cast<UINT64>(bytesInFrame), "bytes"),
+                          TraceLoggingLevel(WINEVENT_LEVEL_INFO));
+    }
+#else
+    UNREFERENCED_PARAMETER(bytesInFrame);
 #endif UNIT_TESTING
 }
@@ -17,6 +17,13 @@ Abstract:
 #include <telemetry\ProjectTelemetry.h>
 #include "../../types/inc/Viewport.hpp"
 
+// The verbose tracing surface (string formatting, sequence dumps) compiles
+// out entirely when VT_RENDER_TRACING_DISABLED is defined, for perf-sensitive
+// builds. The per-frame counter events stay - they're two integers a frame.
+#if !defined(UNIT_TESTING) && !defined(VT_RENDER_TRACING_DISABLED)
+#define ENABLE_VT_RENDER_TRACING 1
+#endif
+
 TRACELOGGING_DECLARE_PROVIDER(g_hConsoleVtRendererTraceProvider);
 
 namespace Microsoft::Console::VirtualTerminal
@@ -38,5 +45,22 @@ namespace Microsoft::Console::VirtualTerminal
                              const COORD scrollDelta,
                              const bool cursorMoved) const;
         void TraceEndPaint() const;
+        void TraceFrame(const size_t bytesInFrame) const;
+
+    private:
+#ifdef ENABLE_VT_RENDER_TRACING
+        // Runs the given event emitter only when a verbose session is
+        // actually listening. When no session is attached, the cost of a
+        // trace call is this one predictable branch - none of the string
+        // formatting in the emitter happens.
+        template<typename TEmitFunc>
+        void _TraceIfListening(TEmitFunc&& emit) const
+        {
+            if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+            {
+                emit();
+            }
+        }
+#endif
     };
 }
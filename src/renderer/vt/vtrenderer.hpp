@@ -19,6 +19,7 @@ Author(s):
 #include "../../inc/IDefaultColorProvider.hpp"
 #include "../../inc/ITerminalOutputConnection.hpp"
 #include "../../inc/ITerminalOwner.hpp"
+#include "../../inc/conpty-ring.h"
 #include "../../types/inc/Viewport.hpp"
 #include "tracing.hpp"
 #include <string>
@@ -37,7 +38,7 @@ namespace Microsoft::Console::Render
                  const Microsoft::Console::IDefaultColorProvider& colorProvider,
                  const Microsoft::Console::Types::Viewport initialViewport);
 
-        virtual ~VtEngine() override = default;
+        virtual ~VtEngine() override;
 
         [[nodiscard]] HRESULT InvalidateSelection(const std::vector<SMALL_RECT>& rectangles) noexcept override;
         [[nodiscard]] virtual HRESULT InvalidateScroll(const COORD* const pcoordDelta) noexcept = 0;
@@ -81,6 +82,8 @@ namespace Microsoft::Console::Render
                                               const int iDpi) noexcept override;
 
         SMALL_RECT GetDirtyRectInChars() override;
+        SMALL_RECT GetDirtyRowInChars(const SHORT sRow) override;
+        bool RetainsPaintedContent() const noexcept override;
         [[nodiscard]] HRESULT GetFontSize(_Out_ COORD* const pFontSize) noexcept override;
         [[nodiscard]] HRESULT IsGlyphWideByFont(const std::wstring_view glyph, _Out_ bool* const pResult) noexcept override;
 
@@ -95,10 +98,41 @@ namespace Microsoft::Console::Render
 
         void SetTerminalOwner(Microsoft::Console::ITerminalOwner* const terminalOwner);
 
+        [[nodiscard]] HRESULT SetOutputRing(wil::unique_handle ringSection,
+                                            wil::unique_handle ringDataReady,
+                                            wil::unique_handle ringSpaceAvailable) noexcept;
+
     protected:
         wil::unique_hfile _hFile;
         std::string _buffer;
 
+        // Scratch space for the UTF-16 -> UTF-8 conversion in
+        //      _WriteTerminalUtf8/_WriteTerminalAscii. A member so its
+        //      capacity carries over from run to run - once it's warmed up,
+        //      painting text performs no intermediate string allocations.
+        std::string _conversionBuffer;
+
+        // Double-buffered pipe writes: _Flush hands the finished frame to a
+        //      writer thread through _flightBuffer, so the render thread can
+        //      start building the next frame while the terminal drains the
+        //      previous one instead of blocking on WriteFile.
+        std::string _flightBuffer;
+        wil::unique_handle _writerThread;
+        wil::unique_handle _flushRequested; // auto-reset: _flightBuffer is ready to write
+        wil::unique_handle _flushComplete; // manual-reset: the writer is idle and _flightBuffer is free
+        HRESULT _flightResult;
+        bool _writerExiting;
+
+        // Negotiated shared-memory fast path. When the producer is
+        //      initialized, the writer thread copies each frame into the ring
+        //      (one cross-process copy, no syscall per chunk) instead of
+        //      writing it down the pipe; the pipe stays open for liveness
+        //      probing and as the fallback transport.
+        Microsoft::Console::ConptyRing::Producer _ringProducer;
+        wil::unique_handle _hRingSection;
+        wil::unique_handle _hRingDataReady;
+        wil::unique_handle _hRingSpaceAvailable;
+
         const Microsoft::Console::IDefaultColorProvider& _colorProvider;
 
         COLORREF _LastFG;
@@ -108,6 +142,12 @@ namespace Microsoft::Console::Render
         Microsoft::Console::Types::Viewport _lastViewport;
         Microsoft::Console::Types::Viewport _invalidRect;
 
+        // Per-row dirty column spans, indexed by viewport row. Each entry is
+        //      an exclusive [left, right) pair; left == right means the row is
+        //      clean. _invalidRect stays the bounding box of all of these, so
+        //      two distant updates don't balloon what each row repaints.
+        std::vector<std::pair<SHORT, SHORT>> _invalidRowRuns;
+
         bool _fInvalidRectUsed;
         COORD _lastRealCursor;
         COORD _lastText;
@@ -128,6 +168,11 @@ namespace Microsoft::Console::Render
         COORD _deferredCursorPos;
 
         bool _pipeBroken;
+
+        // True between RequestCursor and InheritCursor - we've asked the
+        //      terminal where its cursor is and can't safely paint until it
+        //      answers, so StartPaint holds every frame in the meantime.
+        bool _lookingForCursorPosition;
         HRESULT _exitResult;
         Microsoft::Console::ITerminalOwner* _terminalOwner;
 
@@ -136,10 +181,14 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _Write(std::string_view const str) noexcept;
         [[nodiscard]] HRESULT _WriteFormattedString(const std::string* const pFormat, ...) noexcept;
         [[nodiscard]] HRESULT _Flush() noexcept;
+        [[nodiscard]] HRESULT _StartWriterThread() noexcept;
+        static DWORD WINAPI s_WriterThreadProc(_In_ LPVOID lpParameter);
+        DWORD _WriterThreadProc();
 
         void _OrRect(_Inout_ SMALL_RECT* const pRectExisting, const SMALL_RECT* const pRectToOr) const;
         [[nodiscard]] HRESULT _InvalidCombine(const Microsoft::Console::Types::Viewport invalid) noexcept;
         [[nodiscard]] HRESULT _InvalidOffset(const COORD* const ppt) noexcept;
+        [[nodiscard]] HRESULT _InvalidOffsetRegion(const SMALL_RECT region, const short dy) noexcept;
         [[nodiscard]] HRESULT _InvalidRestrict() noexcept;
         bool _AllIsInvalid() const;
 
@@ -151,7 +200,14 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _InsertDeleteLine(const short sLines, const bool fInsertLine) noexcept;
         [[nodiscard]] HRESULT _DeleteLine(const short sLines) noexcept;
         [[nodiscard]] HRESULT _InsertLine(const short sLines) noexcept;
+        [[nodiscard]] HRESULT _SetScrollingRegion(const short top, const short bottom) noexcept;
+        [[nodiscard]] HRESULT _ResetScrollingRegion() noexcept;
+        [[nodiscard]] HRESULT _ScrollUpDown(const short sLines, const bool fScrollUp) noexcept;
+        [[nodiscard]] HRESULT _ScrollUp(const short sLines) noexcept;
+        [[nodiscard]] HRESULT _ScrollDown(const short sLines) noexcept;
         [[nodiscard]] HRESULT _CursorForward(const short chars) noexcept;
+        [[nodiscard]] HRESULT _CursorBackward(const short chars) noexcept;
+        [[nodiscard]] HRESULT _CursorDown(const short lines) noexcept;
         [[nodiscard]] HRESULT _EraseCharacter(const short chars) noexcept;
         [[nodiscard]] HRESULT _CursorPosition(const COORD coord) noexcept;
         [[nodiscard]] HRESULT _CursorHome() noexcept;
@@ -167,7 +223,7 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT _SetGraphicsDefault() noexcept;
 
-        [[nodiscard]] HRESULT _ResizeWindow(const short sWidth, const short sHeight) noexcept;
+        [[nodiscard]] virtual HRESULT _ResizeWindow(const short sWidth, const short sHeight) noexcept;
 
         [[nodiscard]] HRESULT _BeginUnderline() noexcept;
 
@@ -187,6 +243,17 @@ namespace Microsoft::Console::Render
                                                            _In_reads_(cColorTable) const COLORREF* const ColorTable,
                                                            const WORD cColorTable) noexcept;
 
+        [[nodiscard]] WORD _FindNearestTableIndexCached(const COLORREF color,
+                                                        _In_reads_(cColorTable) const COLORREF* const ColorTable,
+                                                        const WORD cColorTable) noexcept;
+
+        // Memo of FindNearestTableIndex results keyed by RGB color, so
+        // repainting a colorful frame doesn't rerun the linear distance
+        // search for every attribute change. The palette snapshot it was
+        // built against detects in-place palette edits and flushes the memo.
+        std::unordered_map<COLORREF, WORD> _nearestIndexCache;
+        std::vector<COLORREF> _nearestIndexPalette;
+
         bool _WillWriteSingleChar() const;
 
         [[nodiscard]] HRESULT _PaintUtf8BufferLine(std::basic_string_view<Cluster> const clusters,
@@ -26,6 +26,7 @@ WddmConEngine::WddmConEngine() :
     _displayHeight(0),
     _displayWidth(0),
     _displayState(nullptr),
+    _rowDirty(nullptr),
     _currentLegacyColorAttribute(DEFAULT_COLOR_ATTRIBUTE)
 {
 }
@@ -54,6 +55,12 @@ void WddmConEngine::FreeResources(ULONG displayHeight)
         free(_displayState);
     }
 
+    if (_rowDirty)
+    {
+        free(_rowDirty);
+        _rowDirty = nullptr;
+    }
+
     if (_hWddmConCtx != INVALID_HANDLE_VALUE)
     {
         WDDMConDestroy(_hWddmConCtx);
@@ -88,8 +95,9 @@ WddmConEngine::~WddmConEngine()
                 DisplaySize.right = (LONG)DisplaySizeIoctl.Width;
 
                 _displayState = (PCD_IO_ROW_INFORMATION*)calloc(DisplaySize.bottom, sizeof(PCD_IO_ROW_INFORMATION));
+                _rowDirty = (bool*)calloc(DisplaySize.bottom, sizeof(bool));
 
-                if (_displayState != nullptr)
+                if (_displayState != nullptr && _rowDirty != nullptr)
                 {
                     for (LONG i = 0; i < DisplaySize.bottom; i++)
                     {
@@ -212,7 +220,25 @@ bool WddmConEngine::IsInitialized()
 [[nodiscard]] HRESULT WddmConEngine::EndPaint() noexcept
 {
     RETURN_IF_HANDLE_INVALID(_hWddmConCtx);
-    return WDDMConEndUpdateDisplayBatch(_hWddmConCtx);
+
+    // Flush every row touched since StartPaint in one pass, then close the
+    // batch. The kernel then presents the whole frame at once instead of
+    // presenting once per painted line.
+    HRESULT hr = S_OK;
+
+    for (LONG rowIndex = 0; rowIndex < _displayHeight && SUCCEEDED(hr); rowIndex++)
+    {
+        if (_rowDirty[rowIndex])
+        {
+            hr = WDDMConUpdateDisplay(_hWddmConCtx, _displayState[rowIndex], FALSE);
+            _rowDirty[rowIndex] = false;
+        }
+    }
+
+    const HRESULT hrBatch = WDDMConEndUpdateDisplayBatch(_hWddmConCtx);
+
+    RETURN_IF_FAILED(hr);
+    return hrBatch;
 }
 
 // Routine Description:
@@ -253,6 +279,8 @@ bool WddmConEngine::IsInitialized()
             NewChar->Character = L' ';
             NewChar->Atribute = 0x0;
         }
+
+        _rowDirty[rowIndex] = true;
     }
 
     return S_OK;
@@ -281,7 +309,11 @@ bool WddmConEngine::IsInitialized()
             NewChar->Atribute = _currentLegacyColorAttribute;
         }
 
-        return WDDMConUpdateDisplay(_hWddmConCtx, _displayState[coord.Y], FALSE);
+        // Just mark the row; EndPaint sends every dirty row to the kernel in
+        // a single batched update.
+        _rowDirty[coord.Y] = true;
+
+        return S_OK;
     }
     CATCH_RETURN();
 }
@@ -79,6 +79,11 @@ namespace Microsoft::Console::Render
 
         PCD_IO_ROW_INFORMATION* _displayState;
 
+        // One flag per display row, raised by the paint calls that touch the
+        // row and lowered when EndPaint flushes it. Lets a frame go to the
+        // kernel as one batched present instead of one update per line.
+        bool* _rowDirty;
+
         WORD _currentLegacyColorAttribute;
     };
 }
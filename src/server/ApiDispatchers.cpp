@@ -19,12 +19,12 @@
 
     if (a->Output)
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleOutputCP);
+        Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleOutputCP);
         m->_pApiRoutines->GetConsoleOutputCodePageImpl(a->CodePage);
     }
     else
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleCP);
+        Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleCP);
         m->_pApiRoutines->GetConsoleInputCodePageImpl(a->CodePage);
     }
     return S_OK;
@@ -33,21 +33,31 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleMode(_Inout_ CONSOLE_API_MSG* const m,
                                                            _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleMode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleMode);
     CONSOLE_MODE_MSG* const a = &m->u.consoleMsgL1.GetConsoleMode;
     std::wstring handleType = L"unknown";
 
-    TraceLoggingWrite(g_hConhostV2EventTraceProvider,
-                      "API_GetConsoleMode",
-                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
-                      TraceLoggingOpcode(WINEVENT_OPCODE_START));
+    // This API is polled relentlessly by shells, so skip the tracing scope
+    // entirely when nobody is listening.
+    const bool fTracingEnabled = Tracing::s_IsApiCallTracingEnabled();
 
-    auto tracing = wil::scope_exit([&]() {
-        Tracing::s_TraceApi(a, handleType);
+    if (fTracingEnabled)
+    {
         TraceLoggingWrite(g_hConhostV2EventTraceProvider,
                           "API_GetConsoleMode",
                           TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
-                          TraceLoggingOpcode(WINEVENT_OPCODE_STOP));
+                          TraceLoggingOpcode(WINEVENT_OPCODE_START));
+    }
+
+    auto tracing = wil::scope_exit([&]() {
+        if (fTracingEnabled)
+        {
+            Tracing::s_TraceApi(a, handleType);
+            TraceLoggingWrite(g_hConhostV2EventTraceProvider,
+                              "API_GetConsoleMode",
+                              TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                              TraceLoggingOpcode(WINEVENT_OPCODE_STOP));
+        }
     });
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -72,7 +82,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleMode(_Inout_ CONSOLE_API_MSG* const m,
                                                            _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleMode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleMode);
     CONSOLE_MODE_MSG* const a = &m->u.consoleMsgL1.SetConsoleMode;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -94,7 +104,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetNumberOfInputEvents(_Inout_ CONSOLE_API_MSG* const m,
                                                                    _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetNumberOfConsoleInputEvents);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetNumberOfConsoleInputEvents);
     CONSOLE_GETNUMBEROFINPUTEVENTS_MSG* const a = &m->u.consoleMsgL1.GetNumberOfConsoleInputEvents;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -114,11 +124,11 @@
     CONSOLE_GETCONSOLEINPUT_MSG* const a = &m->u.consoleMsgL1.GetConsoleInput;
     if (WI_IsFlagSet(a->Flags, CONSOLE_READ_NOREMOVE))
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::PeekConsoleInput, a->Unicode);
+        Telemetry::LogApiCall(Telemetry::ApiCall::PeekConsoleInput, a->Unicode);
     }
     else
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsoleInput, a->Unicode);
+        Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsoleInput, a->Unicode);
     }
 
     a->NumRecords = 0;
@@ -150,7 +160,7 @@
 
     std::unique_ptr<IWaitRoutine> waiter;
     HRESULT hr;
-    std::deque<std::unique_ptr<IInputEvent>> outEvents;
+    std::deque<INPUT_RECORD> outEvents;
     size_t const eventsToRead = cRecords;
     if (a->Unicode)
     {
@@ -234,7 +244,7 @@
                 {
                     break;
                 }
-                rgRecords[i] = outEvents.front()->ToInputRecord();
+                rgRecords[i] = outEvents.front();
                 outEvents.pop_front();
             }
         }
@@ -255,7 +265,7 @@
     *pbReplyPending = FALSE;
 
     CONSOLE_READCONSOLE_MSG* const a = &m->u.consoleMsgL1.ReadConsole;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsole, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsole, a->Unicode);
 
     a->NumBytes = 0; // we return 0 until proven otherwise.
 
@@ -389,7 +399,7 @@
     *pbReplyPending = FALSE;
 
     CONSOLE_WRITECONSOLE_MSG* const a = &m->u.consoleMsgL1.WriteConsole;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsole, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsole, a->Unicode);
 
     // Make sure we have a valid screen buffer.
     ConsoleHandleData* HandleData = m->GetObjectHandle();
@@ -463,14 +473,14 @@
     switch (a->ElementType)
     {
     case CONSOLE_ATTRIBUTE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::FillConsoleOutputAttribute);
+        Telemetry::LogApiCall(Telemetry::ApiCall::FillConsoleOutputAttribute);
         break;
     case CONSOLE_ASCII:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::FillConsoleOutputCharacter, false);
+        Telemetry::LogApiCall(Telemetry::ApiCall::FillConsoleOutputCharacter, false);
         break;
     case CONSOLE_REAL_UNICODE:
     case CONSOLE_FALSE_UNICODE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::FillConsoleOutputCharacter, true);
+        Telemetry::LogApiCall(Telemetry::ApiCall::FillConsoleOutputCharacter, true);
         break;
     }
 
@@ -530,7 +540,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleActiveScreenBuffer(_Inout_ CONSOLE_API_MSG* const m,
                                                                          _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleActiveScreenBuffer);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleActiveScreenBuffer);
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
     RETURN_HR_IF_NULL(E_HANDLE, pObjectHandle);
 
@@ -544,7 +554,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerFlushConsoleInputBuffer(_Inout_ CONSOLE_API_MSG* const m,
                                                                     _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::FlushConsoleInputBuffer);
+    Telemetry::LogApiCall(Telemetry::ApiCall::FlushConsoleInputBuffer);
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
     RETURN_HR_IF_NULL(E_HANDLE, pObjectHandle);
 
@@ -562,12 +572,12 @@
 
     if (a->Output)
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleOutputCP);
+        Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleOutputCP);
         return m->_pApiRoutines->SetConsoleOutputCodePageImpl(a->CodePage);
     }
     else
     {
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleCP);
+        Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleCP);
         return m->_pApiRoutines->SetConsoleInputCodePageImpl(a->CodePage);
     }
 }
@@ -575,7 +585,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleCursorInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                  _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleCursorInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleCursorInfo);
     CONSOLE_GETCURSORINFO_MSG* const a = &m->u.consoleMsgL2.GetConsoleCursorInfo;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -593,7 +603,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleCursorInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                  _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleCursorInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleCursorInfo);
     CONSOLE_SETCURSORINFO_MSG* const a = &m->u.consoleMsgL2.SetConsoleCursorInfo;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -608,7 +618,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleScreenBufferInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                        _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleScreenBufferInfoEx);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleScreenBufferInfoEx);
     CONSOLE_SCREENBUFFERINFO_MSG* const a = &m->u.consoleMsgL2.GetConsoleScreenBufferInfo;
 
     auto tracing = wil::scope_exit([&]() {
@@ -645,7 +655,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleScreenBufferInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                        _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleScreenBufferInfoEx);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleScreenBufferInfoEx);
     CONSOLE_SCREENBUFFERINFO_MSG* const a = &m->u.consoleMsgL2.SetConsoleScreenBufferInfo;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -676,7 +686,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleScreenBufferSize(_Inout_ CONSOLE_API_MSG* const m,
                                                                        _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleScreenBufferSize);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleScreenBufferSize);
     CONSOLE_SETSCREENBUFFERSIZE_MSG* const a = &m->u.consoleMsgL2.SetConsoleScreenBufferSize;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -691,7 +701,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleCursorPosition(_Inout_ CONSOLE_API_MSG* const m,
                                                                      _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleCursorPosition);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleCursorPosition);
     CONSOLE_SETCURSORPOSITION_MSG* const a = &m->u.consoleMsgL2.SetConsoleCursorPosition;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -706,7 +716,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetLargestConsoleWindowSize(_Inout_ CONSOLE_API_MSG* const m,
                                                                         _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetLargestConsoleWindowSize);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetLargestConsoleWindowSize);
     CONSOLE_GETLARGESTWINDOWSIZE_MSG* const a = &m->u.consoleMsgL2.GetLargestConsoleWindowSize;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -723,7 +733,7 @@
                                                                       _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_SCROLLSCREENBUFFER_MSG* const a = &m->u.consoleMsgL2.ScrollConsoleScreenBuffer;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ScrollConsoleScreenBuffer, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::ScrollConsoleScreenBuffer, a->Unicode);
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
     RETURN_HR_IF_NULL(E_HANDLE, pObjectHandle);
@@ -754,7 +764,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleTextAttribute(_Inout_ CONSOLE_API_MSG* const m,
                                                                     _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleTextAttribute);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleTextAttribute);
     CONSOLE_SETTEXTATTRIBUTE_MSG* const a = &m->u.consoleMsgL2.SetConsoleTextAttribute;
 
     auto tracing = wil::scope_exit([&]() {
@@ -772,7 +782,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleWindowInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                  _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleWindowInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleWindowInfo);
     CONSOLE_SETWINDOWINFO_MSG* const a = &m->u.consoleMsgL2.SetConsoleWindowInfo;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -794,14 +804,14 @@
     switch (a->StringType)
     {
     case CONSOLE_ATTRIBUTE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsoleOutputAttribute);
+        Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsoleOutputAttribute);
         break;
     case CONSOLE_ASCII:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsoleOutputCharacter, false);
+        Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsoleOutputCharacter, false);
         break;
     case CONSOLE_REAL_UNICODE:
     case CONSOLE_FALSE_UNICODE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsoleOutputCharacter, true);
+        Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsoleOutputCharacter, true);
         break;
     }
 
@@ -856,7 +866,7 @@
 {
     PCONSOLE_WRITECONSOLEINPUT_MSG const a = &m->u.consoleMsgL2.WriteConsoleInput;
 
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsoleInput, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsoleInput, a->Unicode);
 
     a->NumRecords = 0;
 
@@ -893,7 +903,7 @@
 {
     PCONSOLE_WRITECONSOLEOUTPUT_MSG const a = &m->u.consoleMsgL2.WriteConsoleOutput;
 
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsoleOutput, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsoleOutput, a->Unicode);
 
     // Backup originalRegion and set the written area to a 0 size rectangle in case of failures.
     const auto originalRegion = Microsoft::Console::Types::Viewport::FromInclusive(a->CharRegion);
@@ -946,14 +956,14 @@
     switch (a->StringType)
     {
     case CONSOLE_ATTRIBUTE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsoleOutputAttribute);
+        Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsoleOutputAttribute);
         break;
     case CONSOLE_ASCII:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsoleOutputCharacter, false);
+        Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsoleOutputCharacter, false);
         break;
     case CONSOLE_REAL_UNICODE:
     case CONSOLE_FALSE_UNICODE:
-        Telemetry::Instance().LogApiCall(Telemetry::ApiCall::WriteConsoleOutputCharacter, true);
+        Telemetry::LogApiCall(Telemetry::ApiCall::WriteConsoleOutputCharacter, true);
         break;
     }
 
@@ -1026,7 +1036,7 @@
 
     CONSOLE_READCONSOLEOUTPUT_MSG* const a = &m->u.consoleMsgL2.ReadConsoleOutput;
 
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::ReadConsoleOutput, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::ReadConsoleOutput, a->Unicode);
 
     // Backup data region passed and set it to a zero size region in case we exit early for failures.
     const auto originalRegion = Microsoft::Console::Types::Viewport::FromInclusive(a->CharRegion);
@@ -1080,7 +1090,7 @@
                                                             _Inout_ BOOL* const /*pbReplyPending*/)
 {
     PCONSOLE_GETTITLE_MSG const a = &m->u.consoleMsgL2.GetConsoleTitle;
-    Telemetry::Instance().LogApiCall(a->Original ? Telemetry::ApiCall::GetConsoleOriginalTitle : Telemetry::ApiCall::GetConsoleTitle, a->Unicode);
+    Telemetry::LogApiCall(a->Original ? Telemetry::ApiCall::GetConsoleOriginalTitle : Telemetry::ApiCall::GetConsoleTitle, a->Unicode);
 
     PVOID pvBuffer;
     ULONG cbBuffer;
@@ -1137,7 +1147,7 @@
                                                             _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_SETTITLE_MSG* const a = &m->u.consoleMsgL2.SetConsoleTitle;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleTitle, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleTitle, a->Unicode);
 
     PVOID pvBuffer;
     ULONG cbOriginalLength;
@@ -1159,7 +1169,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleMouseInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                 _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetNumberOfConsoleMouseButtons);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetNumberOfConsoleMouseButtons);
     CONSOLE_GETMOUSEINFO_MSG* const a = &m->u.consoleMsgL3.GetConsoleMouseInfo;
 
     m->_pApiRoutines->GetNumberOfConsoleMouseButtonsImpl(a->NumButtons);
@@ -1169,7 +1179,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleFontSize(_Inout_ CONSOLE_API_MSG* const m,
                                                                _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleFontSize);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleFontSize);
     CONSOLE_GETFONTSIZE_MSG* const a = &m->u.consoleMsgL3.GetConsoleFontSize;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -1184,7 +1194,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleCurrentFont(_Inout_ CONSOLE_API_MSG* const m,
                                                                   _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetCurrentConsoleFontEx);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetCurrentConsoleFontEx);
     CONSOLE_CURRENTFONT_MSG* const a = &m->u.consoleMsgL3.GetCurrentConsoleFont;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -1210,7 +1220,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleDisplayMode(_Inout_ CONSOLE_API_MSG* const m,
                                                                   _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleDisplayMode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleDisplayMode);
     CONSOLE_SETDISPLAYMODE_MSG* const a = &m->u.consoleMsgL3.SetConsoleDisplayMode;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
@@ -1225,7 +1235,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleDisplayMode(_Inout_ CONSOLE_API_MSG* const m,
                                                                   _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleDisplayMode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleDisplayMode);
     CONSOLE_GETDISPLAYMODE_MSG* const a = &m->u.consoleMsgL3.GetConsoleDisplayMode;
 
     // Historically this has never checked the handles. It just returns global state.
@@ -1238,7 +1248,7 @@
                                                             _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_ADDALIAS_MSG* const a = &m->u.consoleMsgL3.AddConsoleAliasW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::AddConsoleAlias, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::AddConsoleAlias, a->Unicode);
 
     // Read the input buffer and validate the strings.
     PVOID pvBuffer;
@@ -1286,7 +1296,7 @@
                                                             _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_GETALIAS_MSG* const a = &m->u.consoleMsgL3.GetConsoleAliasW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleAlias, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleAlias, a->Unicode);
 
     PVOID pvInputBuffer;
     ULONG cbInputBufferSize;
@@ -1358,7 +1368,7 @@
                                                                     _Inout_ BOOL* const /*pbReplyPending*/)
 {
     PCONSOLE_GETALIASESLENGTH_MSG const a = &m->u.consoleMsgL3.GetConsoleAliasesLengthW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleAliasesLength, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleAliasesLength, a->Unicode);
 
     ULONG cbExeNameLength;
     PVOID pvExeName;
@@ -1391,7 +1401,7 @@
                                                                       _Inout_ BOOL* const /*pbReplyPending*/)
 {
     PCONSOLE_GETALIASEXESLENGTH_MSG const a = &m->u.consoleMsgL3.GetConsoleAliasExesLengthW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleAliasExesLength, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleAliasExesLength, a->Unicode);
 
     size_t cbAliasExesLength;
     if (a->Unicode)
@@ -1416,7 +1426,7 @@
                                                               _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_GETALIASES_MSG* const a = &m->u.consoleMsgL3.GetConsoleAliasesW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleAliases, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleAliases, a->Unicode);
 
     PVOID pvExeName;
     ULONG cbExeNameLength;
@@ -1460,7 +1470,7 @@
                                                                 _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_GETALIASEXES_MSG* const a = &m->u.consoleMsgL3.GetConsoleAliasExesW;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleAliasExes, a->Unicode);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleAliasExes, a->Unicode);
 
     PVOID pvBuffer;
     ULONG cbAliasExesBufferLength;
@@ -1619,7 +1629,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleWindow(_Inout_ CONSOLE_API_MSG* const m,
                                                              _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleWindow);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleWindow);
     CONSOLE_GETCONSOLEWINDOW_MSG* const a = &m->u.consoleMsgL3.GetConsoleWindow;
 
     m->_pApiRoutines->GetConsoleWindowImpl(a->hwnd);
@@ -1629,7 +1639,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleSelectionInfo(_Inout_ CONSOLE_API_MSG* const m,
                                                                     _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleSelectionInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleSelectionInfo);
     CONSOLE_GETSELECTIONINFO_MSG* const a = &m->u.consoleMsgL3.GetConsoleSelectionInfo;
 
     m->_pApiRoutines->GetConsoleSelectionInfoImpl(a->SelectionInfo);
@@ -1640,7 +1650,7 @@
                                                               _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_HISTORY_MSG* const a = &m->u.consoleMsgL3.GetConsoleHistory;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleHistoryInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleHistoryInfo);
 
     CONSOLE_HISTORY_INFO info;
     info.cbSize = sizeof(info);
@@ -1658,7 +1668,7 @@
                                                               _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_HISTORY_MSG* const a = &m->u.consoleMsgL3.SetConsoleHistory;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetConsoleHistoryInfo);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetConsoleHistoryInfo);
 
     CONSOLE_HISTORY_INFO info;
     info.cbSize = sizeof(info);
@@ -1672,7 +1682,7 @@
 [[nodiscard]] HRESULT ApiDispatchers::ServerSetConsoleCurrentFont(_Inout_ CONSOLE_API_MSG* const m,
                                                                   _Inout_ BOOL* const /*pbReplyPending*/)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::SetCurrentConsoleFontEx);
+    Telemetry::LogApiCall(Telemetry::ApiCall::SetCurrentConsoleFontEx);
     CONSOLE_CURRENTFONT_MSG* const a = &m->u.consoleMsgL3.SetCurrentConsoleFont;
 
     ConsoleHandleData* const pObjectHandle = m->GetObjectHandle();
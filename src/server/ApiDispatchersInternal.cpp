@@ -27,7 +27,7 @@ using Microsoft::Console::Interactivity::ServiceLocator;
 {
     const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     PCONSOLE_GETCONSOLEPROCESSLIST_MSG const a = &m->u.consoleMsgL3.GetConsoleProcessList;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleProcessList);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleProcessList);
 
     PVOID Buffer;
     ULONG BufferSize;
@@ -60,7 +60,7 @@ using Microsoft::Console::Interactivity::ServiceLocator;
                                                              _Inout_ BOOL* const /*pbReplyPending*/)
 {
     CONSOLE_LANGID_MSG* const a = &m->u.consoleMsgL1.GetConsoleLangId;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GetConsoleLangId);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GetConsoleLangId);
 
     // TODO: MSFT: 9115192 - This should probably just ask through GetOutputCP and convert it ourselves on this side.
     return m->_pApiRoutines->GetConsoleLangIdImpl(a->LangId);
@@ -71,7 +71,7 @@ using Microsoft::Console::Interactivity::ServiceLocator;
 {
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     CONSOLE_CTRLEVENT_MSG* const a = &m->u.consoleMsgL2.GenerateConsoleCtrlEvent;
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::GenerateConsoleCtrlEvent);
+    Telemetry::LogApiCall(Telemetry::ApiCall::GenerateConsoleCtrlEvent);
 
     LockConsole();
     auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
@@ -3,11 +3,113 @@
 
 #include "precomp.h"
 
+#include <array>
 #include <intsafe.h>
 
 #include "ApiMessage.h"
 #include "DeviceComm.h"
 
+namespace
+{
+    // Keeps a handful of recently released message staging buffers around so
+    // that high-rate API calls whose payloads don't fit the inline message
+    // (notably small WriteConsole bursts) don't allocate and free on every
+    // call. Each I/O servicing thread has its own cache, so no locking is
+    // required; a buffer released on a different thread (e.g. by a wait
+    // block's completion) simply lands in that thread's cache instead.
+    class MessageBufferCache
+    {
+    public:
+        ~MessageBufferCache()
+        {
+            for (auto& entry : _entries)
+            {
+                delete[] entry.pb;
+            }
+        }
+
+        // Returns a buffer of at least cbRequested bytes, reusing a cached
+        // one when possible. pcbCapacity receives the actual allocation size.
+        _Ret_maybenull_ BYTE* Acquire(const ULONG cbRequested, _Out_ ULONG* const pcbCapacity)
+        {
+            ULONG cbCapacity = s_RoundUpSizeClass(cbRequested);
+
+            // Take the smallest cached buffer that is big enough.
+            CacheEntry* pBest = nullptr;
+            for (auto& entry : _entries)
+            {
+                if (entry.pb != nullptr && entry.cb >= cbRequested &&
+                    (pBest == nullptr || entry.cb < pBest->cb))
+                {
+                    pBest = &entry;
+                }
+            }
+
+            if (pBest != nullptr)
+            {
+                BYTE* const pb = pBest->pb;
+                *pcbCapacity = pBest->cb;
+                pBest->pb = nullptr;
+                pBest->cb = 0;
+                return pb;
+            }
+
+            *pcbCapacity = cbCapacity;
+            return new (std::nothrow) BYTE[cbCapacity];
+        }
+
+        // Stores the buffer for reuse, or frees it if the cache is full or
+        // the buffer is too large to be worth keeping warm.
+        void Release(_In_ BYTE* const pb, const ULONG cbCapacity)
+        {
+            if (cbCapacity <= s_cbMaxCached)
+            {
+                for (auto& entry : _entries)
+                {
+                    if (entry.pb == nullptr)
+                    {
+                        entry.pb = pb;
+                        entry.cb = cbCapacity;
+                        return;
+                    }
+                }
+            }
+
+            delete[] pb;
+        }
+
+    private:
+        // Rounds the requested size up to the next power of two so buffers of
+        // slightly different sizes can serve each other on reuse.
+        static ULONG s_RoundUpSizeClass(const ULONG cbRequested)
+        {
+            ULONG cbClass = s_cbMinClass;
+            while (cbClass < cbRequested)
+            {
+                if (cbClass > MAXULONG / 2)
+                {
+                    return cbRequested;
+                }
+                cbClass *= 2;
+            }
+            return cbClass;
+        }
+
+        static const ULONG s_cbMinClass = 256;
+        static const ULONG s_cbMaxCached = 128 * 1024;
+
+        struct CacheEntry
+        {
+            BYTE* pb;
+            ULONG cb;
+        };
+
+        std::array<CacheEntry, 8> _entries{};
+    };
+
+    thread_local MessageBufferCache s_bufferCache;
+}
+
 _CONSOLE_API_MSG::_CONSOLE_API_MSG() :
     _pDeviceComm(nullptr),
     _pApiRoutines(nullptr)
@@ -65,13 +167,20 @@ ConsoleHandleData* _CONSOLE_API_MSG::GetObjectHandle() const
 
         ULONG const cbReadSize = Descriptor.InputSize - State.ReadOffset;
 
-        wistd::unique_ptr<BYTE[]> pPayload = wil::make_unique_nothrow<BYTE[]>(cbReadSize);
+        ULONG cbCapacity = 0;
+        BYTE* const pPayload = s_bufferCache.Acquire(cbReadSize, &cbCapacity);
         RETURN_IF_NULL_ALLOC(pPayload);
 
-        RETURN_IF_FAILED(ReadMessageInput(0, pPayload.get(), cbReadSize));
+        HRESULT const hr = ReadMessageInput(0, pPayload, cbReadSize);
+        if (FAILED(hr))
+        {
+            s_bufferCache.Release(pPayload, cbCapacity);
+            RETURN_HR(hr);
+        }
 
-        State.InputBuffer = pPayload.release(); // TODO: MSFT: 9565140 - don't release, maintain as smart pointer.
+        State.InputBuffer = pPayload;
         State.InputBufferSize = cbReadSize;
+        State.InputBufferCapacity = cbCapacity;
     }
 
     // Return the buffer.
@@ -103,12 +212,17 @@ ConsoleHandleData* _CONSOLE_API_MSG::GetObjectHandle() const
         ULONG cbWriteSize = Descriptor.OutputSize - State.WriteOffset;
         RETURN_IF_FAILED(ULongMult(cbWriteSize, cbFactor, &cbWriteSize));
 
-        BYTE* pPayload = new (std::nothrow) BYTE[cbWriteSize];
+        ULONG cbCapacity = 0;
+        BYTE* const pPayload = s_bufferCache.Acquire(cbWriteSize, &cbCapacity);
         RETURN_IF_NULL_ALLOC(pPayload);
+
+        // A reused buffer holds a previous message's data; present it zeroed
+        // just as a fresh allocation was.
         ZeroMemory(pPayload, sizeof(BYTE) * cbWriteSize);
 
-        State.OutputBuffer = pPayload; // TODO: MSFT: 9565140 - maintain as smart pointer.
+        State.OutputBuffer = pPayload;
         State.OutputBufferSize = cbWriteSize;
+        State.OutputBufferCapacity = cbCapacity;
     }
 
     // Return the buffer.
@@ -148,8 +262,9 @@ ConsoleHandleData* _CONSOLE_API_MSG::GetObjectHandle() const
 
     if (State.InputBuffer != nullptr)
     {
-        delete[] static_cast<BYTE*>(State.InputBuffer);
+        s_bufferCache.Release(static_cast<BYTE*>(State.InputBuffer), State.InputBufferCapacity);
         State.InputBuffer = nullptr;
+        State.InputBufferCapacity = 0;
     }
 
     if (State.OutputBuffer != nullptr)
@@ -165,8 +280,9 @@ ConsoleHandleData* _CONSOLE_API_MSG::GetObjectHandle() const
             LOG_IF_FAILED(_pDeviceComm->WriteOutput(&IoOperation));
         }
 
-        delete[] static_cast<BYTE*>(State.OutputBuffer);
+        s_bufferCache.Release(static_cast<BYTE*>(State.OutputBuffer), State.OutputBufferCapacity);
         State.OutputBuffer = nullptr;
+        State.OutputBufferCapacity = 0;
     }
 
     return hr;
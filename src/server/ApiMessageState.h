@@ -23,6 +23,11 @@ typedef struct _CONSOLE_API_STATE
     ULONG ReadOffset;
     ULONG InputBufferSize;
     ULONG OutputBufferSize;
+    // The capacities record how large the staging allocations actually are
+    // (they are rounded up to a size class for reuse); the sizes above are
+    // how much of them this message uses.
+    ULONG InputBufferCapacity;
+    ULONG OutputBufferCapacity;
     PVOID InputBuffer;
     PVOID OutputBuffer;
 } CONSOLE_API_STATE, *PCONSOLE_API_STATE, * const PCCONSOLE_API_STATE;
@@ -27,6 +27,10 @@
         ApiDispatchers::ServerDeprecatedApi, 0, "Deprecated" \
     }
 
+// The tables below are constexpr so the compiler both builds them into the
+// image with no dynamic initialization and lets us validate their layout
+// against the published API numbers at compile time (see the static_asserts
+// after the layer table).
 typedef struct _CONSOLE_API_DESCRIPTOR
 {
     PCONSOLE_API_ROUTINE Routine;
@@ -40,7 +44,7 @@ typedef struct _CONSOLE_API_LAYER_DESCRIPTOR
     ULONG Count;
 } CONSOLE_API_LAYER_DESCRIPTOR, *PCONSOLE_API_LAYER_DESCRIPTOR;
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleCP, CONSOLE_GETCP_MSG, "GetConsoleCP"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMode, CONSOLE_MODE_MSG, "GetConsoleMode"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleMode, CONSOLE_MODE_MSG, "SetConsoleMode"),
@@ -53,7 +57,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_MAPBITMAP_MSG),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerFillConsoleOutput, CONSOLE_FILLCONSOLEOUTPUT_MSG, "FillConsoleOutput"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGenerateConsoleCtrlEvent, CONSOLE_CTRLEVENT_MSG, "GenerateConsoleCtrlEvent"),
     CONSOLE_API_NO_PARAMETER(ApiDispatchers::ServerSetConsoleActiveScreenBuffer, "SetConsoleActiveScreenBuffer"),
@@ -78,7 +82,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleTitle, CONSOLE_SETTITLE_MSG, "SetConsoleTitle"),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_GETNUMBEROFFONTS_MSG),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMouseInfo, CONSOLE_GETMOUSEINFO_MSG, "GetNumberOfConsoleMouseButtons"),
     CONSOLE_API_DEPRECATED(CONSOLE_GETFONTINFO_MSG),
@@ -126,12 +130,27 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleCurrentFont, CONSOLE_CURRENTFONT_MSG, "SetConsoleCurrentFont")
 };
 
-const CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
+constexpr CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
     { ConsoleApiLayer1, RTL_NUMBER_OF(ConsoleApiLayer1) },
     { ConsoleApiLayer2, RTL_NUMBER_OF(ConsoleApiLayer2) },
     { ConsoleApiLayer3, RTL_NUMBER_OF(ConsoleApiLayer3) },
 };
 
+// Validate at compile time that the published API numbers stay aligned with
+// the layer tables; the wait routines depend on these indices to redispatch.
+static_assert(ConsoleApiLayer1[API_NUMBER_GETCONSOLEINPUT & 0xffffff].Routine == ApiDispatchers::ServerGetConsoleInput,
+              "API_NUMBER_GETCONSOLEINPUT must match the GetConsoleInput slot in layer 1");
+static_assert(ConsoleApiLayer1[API_NUMBER_READCONSOLE & 0xffffff].Routine == ApiDispatchers::ServerReadConsole,
+              "API_NUMBER_READCONSOLE must match the ReadConsole slot in layer 1");
+static_assert(ConsoleApiLayer1[API_NUMBER_WRITECONSOLE & 0xffffff].Routine == ApiDispatchers::ServerWriteConsole,
+              "API_NUMBER_WRITECONSOLE must match the WriteConsole slot in layer 1");
+static_assert((API_NUMBER_GETCONSOLEINPUT >> 24) == 1 &&
+                  (API_NUMBER_READCONSOLE >> 24) == 1 &&
+                  (API_NUMBER_WRITECONSOLE >> 24) == 1,
+              "the published API numbers all live in layer 1");
+static_assert(RTL_NUMBER_OF(ConsoleApiLayerTable) == 3,
+              "the driver protocol defines exactly three API layers");
+
 // Routine Description:
 // - This routine validates a user IO and dispatches it to the appropriate worker routine.
 // Arguments:
@@ -173,10 +192,22 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
     // hard dependencies on NTSTATUS codes that aren't readily expressible as an HRESULT. There's currently only one
     // such known code -- STATUS_BUFFER_TOO_SMALL. There's a conlibk dependency on this being returned from the console
     // alias API.
+    PerfCounters::s_Increment(PerfCounters::Counter::ApiCalls);
+    PerfCounters::s_EmitIfDue();
+
+    // Constructing the tracing scope costs a std::function and two event
+    // writes per call; for the tiny APIs that shells poll constantly
+    // (GetConsoleMode, GetConsoleScreenBufferInfo) that overhead is
+    // measurable, so only pay it when a session is actually listening.
+    if (Tracing::s_IsApiCallTracingEnabled())
     {
         const auto trace = Tracing::s_TraceApiCall(Status, Descriptor->TraceName);
         Status = (*Descriptor->Routine)(Message, &ReplyPending);
     }
+    else
+    {
+        Status = (*Descriptor->Routine)(Message, &ReplyPending);
+    }
     if (Status != STATUS_BUFFER_TOO_SMALL)
     {
         Status = NTSTATUS_FROM_HRESULT(Status);
@@ -141,7 +141,7 @@ PCONSOLE_API_MSG IoDispatchers::ConsoleCloseObject(_In_ PCONSOLE_API_MSG pMessag
 PCONSOLE_API_MSG IoDispatchers::ConsoleHandleConnectionRequest(_In_ PCONSOLE_API_MSG pReceiveMsg)
 {
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::AttachConsole);
+    Telemetry::LogApiCall(Telemetry::ApiCall::AttachConsole);
 
     ConsoleProcessHandle* ProcessData = nullptr;
 
@@ -266,7 +266,7 @@ Error:
 // - A pointer to the reply message.
 PCONSOLE_API_MSG IoDispatchers::ConsoleClientDisconnectRoutine(_In_ PCONSOLE_API_MSG pMessage)
 {
-    Telemetry::Instance().LogApiCall(Telemetry::ApiCall::FreeConsole);
+    Telemetry::LogApiCall(Telemetry::ApiCall::FreeConsole);
 
     ConsoleProcessHandle* const pProcessData = pMessage->GetProcessHandle();
 
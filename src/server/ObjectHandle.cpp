@@ -47,112 +47,6 @@ ConsoleHandleData::~ConsoleHandleData()
     }
 }
 
-// Routine Description:
-// - Checks if this handle represents an input type object.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if this handle is for an input object. False otherwise.
-bool ConsoleHandleData::_IsInput() const
-{
-    return WI_IsFlagSet(_ulHandleType, HandleType::Input);
-}
-
-// Routine Description:
-// - Checks if this handle represents an output type object.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if this handle is for an output object. False otherwise.
-bool ConsoleHandleData::_IsOutput() const
-{
-    return WI_IsFlagSet(_ulHandleType, HandleType::Output);
-}
-
-// Routine Description:
-// - Indicates whether this handle is allowed to be used for reading the underlying object data.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if read is permitted. False otherwise.
-bool ConsoleHandleData::IsReadAllowed() const
-{
-    return WI_IsFlagSet(_amAccess, GENERIC_READ);
-}
-
-// Routine Description:
-// - Indicates whether this handle allows multiple customers to share reading of the underlying object data.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if sharing read access is permitted. False otherwise.
-bool ConsoleHandleData::IsReadShared() const
-{
-    return WI_IsFlagSet(_ulShareAccess, FILE_SHARE_READ);
-}
-
-// Routine Description:
-// - Indicates whether this handle is allowed to be used for writing the underlying object data.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if write is permitted. False otherwise.
-bool ConsoleHandleData::IsWriteAllowed() const
-{
-    return WI_IsFlagSet(_amAccess, GENERIC_WRITE);
-}
-
-// Routine Description:
-// - Indicates whether this handle allows multiple customers to share writing of the underlying object data.
-// Arguments:
-// - <none>
-// Return Value:
-// - True if sharing write access is permitted. False otherwise.
-bool ConsoleHandleData::IsWriteShared() const
-{
-    return WI_IsFlagSet(_ulShareAccess, FILE_SHARE_WRITE);
-}
-
-// Routine Description:
-// - Retieves the properly typed Input Buffer from the Handle.
-// Arguments:
-// - amRequested - Access that the client would like for manipulating the buffer
-// - ppInputBuffer - On success, filled with the referenced Input Buffer object
-// Return Value:
-// - HRESULT S_OK or suitable error.
-[[nodiscard]] HRESULT ConsoleHandleData::GetInputBuffer(const ACCESS_MASK amRequested,
-                                                        _Outptr_ InputBuffer** const ppInputBuffer) const
-{
-    *ppInputBuffer = nullptr;
-
-    RETURN_HR_IF(E_ACCESSDENIED, WI_IsAnyFlagClear(_amAccess, amRequested));
-    RETURN_HR_IF(E_HANDLE, WI_IsAnyFlagClear(_ulHandleType, HandleType::Input));
-
-    *ppInputBuffer = static_cast<InputBuffer*>(_pvClientPointer);
-
-    return S_OK;
-}
-
-// Routine Description:
-// - Retieves the properly typed Screen Buffer from the Handle.
-// Arguments:
-// - amRequested - Access that the client would like for manipulating the buffer
-// - ppInputBuffer - On success, filled with the referenced Screen Buffer object
-// Return Value:
-// - HRESULT S_OK or suitable error.
-[[nodiscard]] HRESULT ConsoleHandleData::GetScreenBuffer(const ACCESS_MASK amRequested,
-                                                         _Outptr_ SCREEN_INFORMATION** const ppScreenInfo) const
-{
-    *ppScreenInfo = nullptr;
-
-    RETURN_HR_IF(E_ACCESSDENIED, WI_IsAnyFlagClear(_amAccess, amRequested));
-    RETURN_HR_IF(E_HANDLE, WI_IsAnyFlagClear(_ulHandleType, HandleType::Output));
-
-    *ppScreenInfo = static_cast<SCREEN_INFORMATION*>(_pvClientPointer);
-
-    return S_OK;
-}
-
 // Routine Description:
 // - Retrieves the wait queue associated with the given object held by this handle.
 // Arguments:
@@ -180,18 +74,6 @@ bool ConsoleHandleData::IsWriteShared() const
     }
 }
 
-// Routine Description:
-// - For input buffers only, retrieves an extra handle data structure used to save some information
-//   across multiple reads from the same handle.
-// Arguments:
-// - <none>
-// Return Value:
-// - Pointer to the input read handle data structure with the aforementioned extra info.
-INPUT_READ_HANDLE_DATA* ConsoleHandleData::GetClientInput() const
-{
-    return _pClientInput.get();
-}
-
 // Routine Description:
 // - This routine closes an input handle.  It decrements the input buffer's
 //   reference count.  If it goes to zero, the buffer is reinitialized.
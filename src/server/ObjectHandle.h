@@ -40,22 +40,66 @@ public:
     ConsoleHandleData& operator=(const ConsoleHandleData&) & = delete;
     ConsoleHandleData& operator=(ConsoleHandleData&&) & = delete;
 
+    // Handle resolution sits on the critical path of every console API call:
+    // the driver hands the object pointer back in the message descriptor and
+    // these accessors recover the typed object from it. They are defined
+    // inline so a call is two flag tests and a cast, with no function call
+    // and no locking.
     [[nodiscard]] HRESULT GetInputBuffer(const ACCESS_MASK amRequested,
-                                         _Outptr_ InputBuffer** const ppInputBuffer) const;
+                                         _Outptr_ InputBuffer** const ppInputBuffer) const noexcept
+    {
+        *ppInputBuffer = nullptr;
+
+        RETURN_HR_IF(E_ACCESSDENIED, WI_IsAnyFlagClear(_amAccess, amRequested));
+        RETURN_HR_IF(E_HANDLE, WI_IsAnyFlagClear(_ulHandleType, HandleType::Input));
+
+        *ppInputBuffer = static_cast<InputBuffer*>(_pvClientPointer);
+
+        return S_OK;
+    }
+
     [[nodiscard]] HRESULT GetScreenBuffer(const ACCESS_MASK amRequested,
-                                          _Outptr_ SCREEN_INFORMATION** const ppScreenInfo) const;
+                                          _Outptr_ SCREEN_INFORMATION** const ppScreenInfo) const noexcept
+    {
+        *ppScreenInfo = nullptr;
+
+        RETURN_HR_IF(E_ACCESSDENIED, WI_IsAnyFlagClear(_amAccess, amRequested));
+        RETURN_HR_IF(E_HANDLE, WI_IsAnyFlagClear(_ulHandleType, HandleType::Output));
+
+        *ppScreenInfo = static_cast<SCREEN_INFORMATION*>(_pvClientPointer);
+
+        return S_OK;
+    }
 
     [[nodiscard]] HRESULT GetWaitQueue(_Outptr_ ConsoleWaitQueue** const ppWaitQueue) const;
 
-    INPUT_READ_HANDLE_DATA* GetClientInput() const;
+    INPUT_READ_HANDLE_DATA* GetClientInput() const noexcept
+    {
+        return _pClientInput.get();
+    }
 
-    bool IsReadAllowed() const;
-    bool IsReadShared() const;
-    bool IsWriteAllowed() const;
-    bool IsWriteShared() const;
+    bool IsReadAllowed() const noexcept
+    {
+        return WI_IsFlagSet(_amAccess, GENERIC_READ);
+    }
+
+    bool IsReadShared() const noexcept
+    {
+        return WI_IsFlagSet(_ulShareAccess, FILE_SHARE_READ);
+    }
+
+    bool IsWriteAllowed() const noexcept
+    {
+        return WI_IsFlagSet(_amAccess, GENERIC_WRITE);
+    }
+
+    bool IsWriteShared() const noexcept
+    {
+        return WI_IsFlagSet(_ulShareAccess, FILE_SHARE_WRITE);
+    }
 
     // TODO: MSFT 9355178 Temporary public access to types... http://osgvsowi/9355178
-    bool IsInputHandle() const
+    bool IsInputHandle() const noexcept
     {
         return _IsInput();
     }
@@ -67,8 +111,15 @@ public:
     };
 
 private:
-    bool _IsInput() const;
-    bool _IsOutput() const;
+    bool _IsInput() const noexcept
+    {
+        return WI_IsFlagSet(_ulHandleType, HandleType::Input);
+    }
+
+    bool _IsOutput() const noexcept
+    {
+        return WI_IsFlagSet(_ulHandleType, HandleType::Output);
+    }
 
     [[nodiscard]] HRESULT _CloseInputHandle();
     [[nodiscard]] HRESULT _CloseOutputHandle();
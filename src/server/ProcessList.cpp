@@ -67,6 +67,18 @@ using namespace Microsoft::Console::Interactivity;
         // As such, we have to put the newest process into the head of the list.
         _processes.push_front(pProcessData);
 
+        try
+        {
+            _processIndex.emplace(dwProcessId, pProcessData);
+        }
+        catch (...)
+        {
+            // Keep the list and the index in sync if indexing failed.
+            _processes.pop_front();
+            delete pProcessData;
+            throw;
+        }
+
         if (nullptr != ppProcessData)
         {
             *ppProcessData = pProcessData;
@@ -91,6 +103,7 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
     FAIL_FAST_IF(!(_processes.cend() != std::find(_processes.cbegin(), _processes.cend(), pProcessData)));
 
     _processes.remove(pProcessData);
+    _processIndex.erase(pProcessData->dwProcessId);
 
     delete pProcessData;
 }
@@ -104,25 +117,25 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
 // - Pointer to the process handle information or nullptr if no match was found.
 ConsoleProcessHandle* ConsoleProcessList::FindProcessInList(const DWORD dwProcessId) const
 {
+    // Every API call resolves its caller through here, so the common lookup
+    // by process ID goes through the index instead of scanning the list.
+    if (ROOT_PROCESS_ID != dwProcessId)
+    {
+        const auto it = _processIndex.find(dwProcessId);
+        return it != _processIndex.cend() ? it->second : nullptr;
+    }
+
+    // The root lookup still walks the list; the root flag migrates when the
+    // root process is reassigned and this lookup is rare.
     auto it = _processes.cbegin();
 
     while (it != _processes.cend())
     {
         ConsoleProcessHandle* const pProcessHandleRecord = *it;
 
-        if (ROOT_PROCESS_ID != dwProcessId)
+        if (pProcessHandleRecord->fRootProcess)
         {
-            if (pProcessHandleRecord->dwProcessId == dwProcessId)
-            {
-                return pProcessHandleRecord;
-            }
-        }
-        else
-        {
-            if (pProcessHandleRecord->fRootProcess)
-            {
-                return pProcessHandleRecord;
-            }
+            return pProcessHandleRecord;
         }
 
         it = std::next(it);
@@ -59,7 +59,11 @@ public:
     bool IsEmpty() const;
 
 private:
+    // The list preserves newest-to-oldest order, which GetConsoleProcessList
+    // and shutdown rely on; the map indexes the same handles by process ID
+    // so the per-API-call caller lookup doesn't scan. The two must stay in sync.
     std::list<ConsoleProcessHandle*> _processes;
+    std::unordered_map<DWORD, ConsoleProcessHandle*> _processIndex;
 
     void _ModifyProcessForegroundRights(const HANDLE hProcess, const bool fForeground) const;
 };
@@ -13,6 +13,75 @@
 
 #include "..\interactivity\inc\ServiceLocator.hpp"
 
+namespace
+{
+    // Freed wait blocks are parked on an interlocked singly-linked list so
+    // the next blocking read can reuse one without allocating. The SList
+    // primitives are lock-free and safe from any servicing thread; the pool
+    // persists for the lifetime of the process.
+    PSLIST_HEADER GetFreeWaitBlockList()
+    {
+        static SLIST_HEADER s_freeBlocks = []() {
+            SLIST_HEADER header;
+            InitializeSListHead(&header);
+            return header;
+        }();
+        return &s_freeBlocks;
+    }
+
+    LONG s_cFreeWaitBlocks = 0;
+    const LONG c_cMaxFreeWaitBlocks = 32;
+}
+
+// Routine Description:
+// - Allocates storage for a wait block, preferring a block recycled from the
+//   free list over a fresh heap allocation.
+// Arguments:
+// - size - The size of the allocation being requested.
+// Return Value:
+// - A pointer to storage for a wait block. Throws std::bad_alloc on failure
+//   per the usual operator new contract.
+void* ConsoleWaitBlock::operator new(const size_t size)
+{
+    static_assert(sizeof(ConsoleWaitBlock) >= sizeof(SLIST_ENTRY),
+                  "freed wait blocks must be able to hold a free list entry");
+
+    if (size == sizeof(ConsoleWaitBlock))
+    {
+        PSLIST_ENTRY const pEntry = InterlockedPopEntrySList(GetFreeWaitBlockList());
+        if (pEntry != nullptr)
+        {
+            InterlockedDecrement(&s_cFreeWaitBlocks);
+            return pEntry;
+        }
+    }
+
+    return ::operator new(size);
+}
+
+// Routine Description:
+// - Returns a wait block's storage to the free list for reuse, unless the
+//   pool is already holding plenty.
+// Arguments:
+// - pv - The storage being released.
+void ConsoleWaitBlock::operator delete(void* const pv) noexcept
+{
+    if (pv != nullptr)
+    {
+        // The count is only approximately enforced, which is fine; it exists
+        // to bound the pool, not to be exact.
+        if (s_cFreeWaitBlocks < c_cMaxFreeWaitBlocks)
+        {
+            InterlockedIncrement(&s_cFreeWaitBlocks);
+            InterlockedPushEntrySList(GetFreeWaitBlockList(), static_cast<PSLIST_ENTRY>(pv));
+        }
+        else
+        {
+            ::operator delete(pv);
+        }
+    }
+}
+
 // Routine Description:
 // - Initializes a ConsoleWaitBlock
 // - ConsoleWaitBlocks will self-manage their position in their two queues.
@@ -113,7 +182,7 @@ bool ConsoleWaitBlock::Notify(const WaitTerminationReason TerminationReason)
     DWORD dwControlKeyState;
     bool fIsUnicode = true;
 
-    std::deque<std::unique_ptr<IInputEvent>> outEvents;
+    std::deque<INPUT_RECORD> outEvents;
     // TODO: MSFT 14104228 - get rid of this void* and get the data
     // out of the read wait object properly.
     void* pOutputData = nullptr;
@@ -177,7 +246,7 @@ bool ConsoleWaitBlock::Notify(const WaitTerminationReason TerminationReason)
                 {
                     break;
                 }
-                pRecordBuffer[i] = outEvents.front()->ToInputRecord();
+                pRecordBuffer[i] = outEvents.front();
                 outEvents.pop_front();
             }
         }
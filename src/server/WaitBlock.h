@@ -35,6 +35,13 @@ public:
     [[nodiscard]] static HRESULT s_CreateWait(_Inout_ CONSOLE_API_MSG* const pWaitReplymessage,
                                               _In_ IWaitRoutine* const pWaiter);
 
+    // Wait blocks are large (they embed the full API message) and one is
+    // allocated and freed for every read that has to block, so they draw
+    // from an interlocked pool of recently freed blocks instead of hitting
+    // the heap each time.
+    static void* operator new(const size_t size);
+    static void operator delete(void* const pv) noexcept;
+
 private:
     ConsoleWaitBlock(_In_ ConsoleWaitQueue* const pProcessQueue,
                      _In_ ConsoleWaitQueue* const pObjectQueue,
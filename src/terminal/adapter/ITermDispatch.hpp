@@ -25,7 +25,7 @@ public:
     virtual ~ITermDispatch() = 0;
     virtual void Execute(const wchar_t wchControl) = 0;
     virtual void Print(const wchar_t wchPrintable) = 0;
-    virtual void PrintString(const wchar_t* const rgwch, const size_t cch) = 0;
+    virtual void PrintString(const std::wstring_view string) = 0;
 
     virtual bool CursorUp(const unsigned int uiDistance) = 0; // CUU
     virtual bool CursorDown(const unsigned int uiDistance) = 0; // CUD
@@ -281,7 +281,10 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
                        (fIsHover && _TrackingMode == TrackingMode::AnyEvent && !fSameCoord);
             if (fSuccess)
             {
-                wchar_t* pwchSequence = nullptr;
+                // Sequences are tiny and bounded, so they're formatted into
+                // stack storage - mouse tracking delivers hundreds of events a
+                // second and shouldn't go to the heap for each one.
+                wchar_t rgwchSequence[s_cchMaxMouseSequence];
                 size_t cchSequenceLength = 0;
                 switch (_ExtendedMode)
                 {
@@ -291,7 +294,7 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
                                                         fIsHover,
                                                         sModifierKeystate,
                                                         sWheelDelta,
-                                                        &pwchSequence,
+                                                        rgwchSequence,
                                                         &cchSequenceLength);
                     break;
                 case ExtendedMode::Utf8:
@@ -300,7 +303,7 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
                                                      fIsHover,
                                                      sModifierKeystate,
                                                      sWheelDelta,
-                                                     &pwchSequence,
+                                                     rgwchSequence,
                                                      &cchSequenceLength);
                     break;
                 case ExtendedMode::Sgr:
@@ -314,7 +317,7 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
                                                     fIsHover,
                                                     sModifierKeystate,
                                                     sWheelDelta,
-                                                    &pwchSequence,
+                                                    rgwchSequence,
                                                     &cchSequenceLength);
                     break;
                 case ExtendedMode::Urxvt:
@@ -324,8 +327,7 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
                 }
                 if (fSuccess)
                 {
-                    _SendInputSequence(pwchSequence, cchSequenceLength);
-                    delete[] pwchSequence;
+                    _SendInputSequence(rgwchSequence, cchSequenceLength);
                     fSuccess = true;
                 }
                 if (_TrackingMode == TrackingMode::ButtonEvent || _TrackingMode == TrackingMode::AnyEvent)
@@ -349,20 +351,20 @@ bool MouseInput::HandleMouse(const COORD coordMousePosition,
 // - fIsHover - true if the sequence is generated in response to a mouse hover
 // - sModifierKeystate - the modifier keys pressed with this button
 // - sWheelDelta - the amount that the scroll wheel changed (should be 0 unless uiButton is a WM_MOUSE*WHEEL)
-// - ppwchSequence - On success, where to put the pointer to the generated sequence
+// - pwchSequence - Buffer of at least s_cchMaxMouseSequence characters to receive the sequence
 // - pcchLength - On success, where to put the length of the generated sequence
 // Return value:
 // - true if we were able to successfully generate a sequence.
-// On success, caller is responsible for delete[]ing *ppwchSequence.
 bool MouseInput::_GenerateDefaultSequence(const COORD coordMousePosition,
                                           const unsigned int uiButton,
                                           const bool fIsHover,
                                           const short sModifierKeystate,
                                           const short sWheelDelta,
-                                          _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                          _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                           _Out_ size_t* const pcchLength) const
 {
     bool fSuccess = false;
+    *pcchLength = 0;
 
     // In the default, non-extended encoding scheme, coordinates above 94 shouldn't be supported,
     //   because (95+32+1)=128, which is not an ASCII character.
@@ -373,17 +375,17 @@ bool MouseInput::_GenerateDefaultSequence(const COORD coordMousePosition,
         const COORD coordVTCoords = s_WinToVTCoord(coordMousePosition);
         const short sEncodedX = s_EncodeDefaultCoordinate(coordVTCoords.X);
         const short sEncodedY = s_EncodeDefaultCoordinate(coordVTCoords.Y);
-        wchar_t* pwchFormat = new (std::nothrow) wchar_t[7]{ L"\x1b[Mbxy" };
-        if (pwchFormat != nullptr)
-        {
-            pwchFormat[3] = ' ' + (short)s_WindowsButtonToXEncoding(uiButton, fIsHover, sModifierKeystate, sWheelDelta);
-            pwchFormat[4] = sEncodedX;
-            pwchFormat[5] = sEncodedY;
 
-            *ppwchSequence = pwchFormat;
-            *pcchLength = 7;
-            fSuccess = true;
-        }
+        pwchSequence[0] = L'\x1b';
+        pwchSequence[1] = L'[';
+        pwchSequence[2] = L'M';
+        pwchSequence[3] = ' ' + (short)s_WindowsButtonToXEncoding(uiButton, fIsHover, sModifierKeystate, sWheelDelta);
+        pwchSequence[4] = sEncodedX;
+        pwchSequence[5] = sEncodedY;
+        pwchSequence[6] = L'\0';
+
+        *pcchLength = 7;
+        fSuccess = true;
     }
 
     return fSuccess;
@@ -398,20 +400,20 @@ bool MouseInput::_GenerateDefaultSequence(const COORD coordMousePosition,
 // - fIsHover - true if the sequence is generated in response to a mouse hover
 // - sModifierKeystate - the modifier keys pressed with this button
 // - sWheelDelta - the amount that the scroll wheel changed (should be 0 unless uiButton is a WM_MOUSE*WHEEL)
-// - ppwchSequence - On success, where to put the pointer to the generated sequence
+// - pwchSequence - Buffer of at least s_cchMaxMouseSequence characters to receive the sequence
 // - pcchLength - On success, where to put the length of the generated sequence
 // Return value:
 // - true if we were able to successfully generate a sequence.
-// On success, caller is responsible for delete[]ing *ppwchSequence.
 bool MouseInput::_GenerateUtf8Sequence(const COORD coordMousePosition,
                                        const unsigned int uiButton,
                                        const bool fIsHover,
                                        const short sModifierKeystate,
                                        const short sWheelDelta,
-                                       _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                       _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                        _Out_ size_t* const pcchLength) const
 {
     bool fSuccess = false;
+    *pcchLength = 0;
 
     // So we have some complications here.
     // The windows input stream is typically encoded as UTF16.
@@ -432,18 +434,18 @@ bool MouseInput::_GenerateUtf8Sequence(const COORD coordMousePosition,
         const COORD coordVTCoords = s_WinToVTCoord(coordMousePosition);
         const short sEncodedX = s_EncodeDefaultCoordinate(coordVTCoords.X);
         const short sEncodedY = s_EncodeDefaultCoordinate(coordVTCoords.Y);
-        wchar_t* pwchFormat = new (std::nothrow) wchar_t[7]{ L"\x1b[Mbxy" };
-        if (pwchFormat != nullptr)
-        {
-            // The short cast is safe because we know s_WindowsButtonToXEncoding  never returns more than xff
-            pwchFormat[3] = ' ' + (short)s_WindowsButtonToXEncoding(uiButton, fIsHover, sModifierKeystate, sWheelDelta);
-            pwchFormat[4] = sEncodedX;
-            pwchFormat[5] = sEncodedY;
-
-            *ppwchSequence = pwchFormat;
-            *pcchLength = 7;
-            fSuccess = true;
-        }
+
+        pwchSequence[0] = L'\x1b';
+        pwchSequence[1] = L'[';
+        pwchSequence[2] = L'M';
+        // The short cast is safe because we know s_WindowsButtonToXEncoding  never returns more than xff
+        pwchSequence[3] = ' ' + (short)s_WindowsButtonToXEncoding(uiButton, fIsHover, sModifierKeystate, sWheelDelta);
+        pwchSequence[4] = sEncodedX;
+        pwchSequence[5] = sEncodedY;
+        pwchSequence[6] = L'\0';
+
+        *pcchLength = 7;
+        fSuccess = true;
     }
 
     return fSuccess;
@@ -459,58 +461,68 @@ bool MouseInput::_GenerateUtf8Sequence(const COORD coordMousePosition,
 // - fIsHover - true if the sequence is generated in response to a mouse hover
 // - sModifierKeystate - the modifier keys pressed with this button
 // - sWheelDelta - the amount that the scroll wheel changed (should be 0 unless uiButton is a WM_MOUSE*WHEEL)
-// - ppwchSequence - On success, where to put the pointer to the generated sequence
+// - pwchSequence - Buffer of at least s_cchMaxMouseSequence characters to receive the sequence
 // - pcchLength - On success, where to put the length of the generated sequence
 // Return value:
 // - true if we were able to successfully generate a sequence.
-// On success, caller is responsible for delete[]ing *ppwchSequence.
 bool MouseInput::_GenerateSGRSequence(const COORD coordMousePosition,
                                       const unsigned int uiButton,
                                       const bool isDown,
                                       const bool fIsHover,
                                       const short sModifierKeystate,
                                       const short sWheelDelta,
-                                      _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                      _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                       _Out_ size_t* const pcchLength) const
 {
     // Format for SGR events is:
     // "\x1b[<%d;%d;%d;%c", xButton, x+1, y+1, fButtonDown? 'M' : 'm'
-    bool fSuccess = false;
+    // The pieces are written by hand rather than _snwprintf so the hot mouse
+    // path neither measures into a null buffer nor parses a format string.
     const int iXButton = s_WindowsButtonToSGREncoding(uiButton, fIsHover, sModifierKeystate, sWheelDelta);
 
-#pragma warning(push)
-#pragma warning(disable : 4996)
-// Disable 4996 - The _s version of _snprintf doesn't return the cch if the buffer is null, and we need the cch
-#pragma prefast(suppress : 28719, "Using the output of _snwprintf to determine cch. _snwprintf_s used below.")
-    int iNeededChars = _snwprintf(nullptr, 0, L"\x1b[<%d;%d;%d%c", iXButton, coordMousePosition.X + 1, coordMousePosition.Y + 1, isDown ? L'M' : L'm');
-
-#pragma warning(pop)
+    size_t cch = 0;
+    pwchSequence[cch++] = L'\x1b';
+    pwchSequence[cch++] = L'[';
+    pwchSequence[cch++] = L'<';
+    cch += s_AppendUInt(iXButton, pwchSequence + cch);
+    pwchSequence[cch++] = L';';
+    cch += s_AppendUInt(std::max(0, coordMousePosition.X + 1), pwchSequence + cch);
+    pwchSequence[cch++] = L';';
+    cch += s_AppendUInt(std::max(0, coordMousePosition.Y + 1), pwchSequence + cch);
+    pwchSequence[cch++] = isDown ? L'M' : L'm';
+    pwchSequence[cch] = L'\0';
+
+    *pcchLength = cch;
+    return true;
+}
 
-    iNeededChars += 1; // for null
+// Routine Description:
+// - Writes the given value as decimal digits, without a null terminator.
+//     A tiny replacement for swprintf on the mouse path: the values here are
+//     small non-negative integers (buttons and 1-based cell coordinates).
+// Parameters:
+// - uiValue - the value to write.
+// - pwchBuffer - receives the digits; must hold at least 11 characters (the widest 32-bit value plus slack).
+// Return value:
+// - the number of characters written.
+size_t MouseInput::s_AppendUInt(const unsigned int uiValue, _Out_writes_(11) wchar_t* const pwchBuffer)
+{
+    // Generate the digits in reverse, then flip them into place.
+    wchar_t rgwchReversed[11];
+    size_t cchDigits = 0;
+    unsigned int uiRemaining = uiValue;
+    do
+    {
+        rgwchReversed[cchDigits++] = L'0' + (uiRemaining % 10);
+        uiRemaining /= 10;
+    } while (uiRemaining > 0);
 
-    wchar_t* pwchFormat = new (std::nothrow) wchar_t[iNeededChars];
-    if (pwchFormat != nullptr)
+    for (size_t i = 0; i < cchDigits; i++)
     {
-        int iTakenChars = _snwprintf_s(pwchFormat,
-                                       iNeededChars,
-                                       iNeededChars,
-                                       L"\x1b[<%d;%d;%d%c",
-                                       iXButton,
-                                       coordMousePosition.X + 1,
-                                       coordMousePosition.Y + 1,
-                                       isDown ? L'M' : L'm');
-        if (iTakenChars == iNeededChars - 1) // again, adjust for null
-        {
-            *ppwchSequence = pwchFormat;
-            *pcchLength = iTakenChars;
-            fSuccess = true;
-        }
-        else
-        {
-            delete[] pwchFormat;
-        }
+        pwchBuffer[i] = rgwchReversed[cchDigits - 1 - i];
     }
-    return fSuccess;
+
+    return cchDigits;
 }
 
 // Routine Description:
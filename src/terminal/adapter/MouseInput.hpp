@@ -64,6 +64,10 @@ namespace Microsoft::Console::VirtualTerminal
     private:
         static const int s_MaxDefaultCoordinate = 94;
 
+        // Enough for the longest sequence we emit - SGR with two full-range
+        // coordinates ("\x1b[<%d;%d;%dM") - plus the null terminator.
+        static const size_t s_cchMaxMouseSequence = 32;
+
         WriteInputEvents _pfnWriteEvents;
 
         ExtendedMode _ExtendedMode = ExtendedMode::None;
@@ -81,14 +85,14 @@ namespace Microsoft::Console::VirtualTerminal
                                       const bool fIsHover,
                                       const short sModifierKeystate,
                                       const short sWheelDelta,
-                                      _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                      _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                       _Out_ size_t* const pcchLength) const;
         bool _GenerateUtf8Sequence(const COORD coordMousePosition,
                                    const unsigned int uiButton,
                                    const bool fIsHover,
                                    const short sModifierKeystate,
                                    const short sWheelDelta,
-                                   _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                   _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                    _Out_ size_t* const pcchLength) const;
         bool _GenerateSGRSequence(const COORD coordMousePosition,
                                   const unsigned int uiButton,
@@ -96,7 +100,7 @@ namespace Microsoft::Console::VirtualTerminal
                                   const bool fIsHover,
                                   const short sModifierKeystate,
                                   const short sWheelDelta,
-                                  _Outptr_result_buffer_(*pcchLength) wchar_t** const ppwchSequence,
+                                  _Out_writes_(s_cchMaxMouseSequence) wchar_t* const pwchSequence,
                                   _Out_ size_t* const pcchLength) const;
 
         bool _ShouldSendAlternateScroll(_In_ unsigned int uiButton, _In_ short sScrollDelta) const;
@@ -113,6 +117,7 @@ namespace Microsoft::Console::VirtualTerminal
                                                 const short sWheelDelta);
 
         static bool s_IsButtonDown(const unsigned int uiButton);
+        static size_t s_AppendUInt(const unsigned int uiValue, _Out_writes_(11) wchar_t* const pwchBuffer);
         static bool s_IsButtonMsg(const unsigned int uiButton);
         static bool s_IsHoverMsg(const unsigned int uiButton);
         static COORD s_WinToVTCoord(const COORD coordWinCoordinate);
@@ -23,6 +23,34 @@
 using namespace Microsoft::Console::Types;
 using namespace Microsoft::Console::VirtualTerminal;
 
+namespace
+{
+    // Holds a batched edit scope open on the console for the lifetime of the
+    // instance. Operations that issue several fills/scrolls for one VT
+    // sequence declare one of these so the host applies the group under a
+    // single lock acquisition and a single frame, instead of per call.
+    class BatchScope final
+    {
+    public:
+        BatchScope(ConGetSet& conApi) :
+            _conApi(conApi)
+        {
+            _conApi.PrivateBeginOutputBatch();
+        }
+
+        ~BatchScope()
+        {
+            _conApi.PrivateEndOutputBatch();
+        }
+
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+
+    private:
+        ConGetSet& _conApi;
+    };
+}
+
 // Routine Description:
 // - No Operation helper. It's just here to make sure they're always all the same.
 // Arguments:
@@ -57,22 +85,21 @@ void AdaptDispatch::Print(const wchar_t wchPrintable)
     _pDefaults->Print(_TermOutput.TranslateKey(wchPrintable));
 }
 
-void AdaptDispatch::PrintString(const wchar_t* const rgwch, const size_t cch)
+void AdaptDispatch::PrintString(const std::wstring_view string)
 {
     try
     {
         if (_TermOutput.NeedToTranslate())
         {
-            std::unique_ptr<wchar_t[]> tempArray = std::make_unique<wchar_t[]>(cch);
-            for (size_t i = 0; i < cch; i++)
-            {
-                tempArray[i] = _TermOutput.TranslateKey(rgwch[i]);
-            }
-            _pDefaults->PrintString(tempArray.get(), cch);
+            std::wstring translated{ string };
+            _TermOutput.TranslateInPlace(translated.data(), translated.size());
+            _pDefaults->PrintString(translated);
         }
         else
         {
-            _pDefaults->PrintString(rgwch, cch);
+            // the common case carries the caller's view straight through
+            // without copying.
+            _pDefaults->PrintString(string);
         }
     }
     CATCH_LOG();
@@ -490,6 +517,9 @@ bool AdaptDispatch::_InsertDeleteHelper(_In_ unsigned int const uiCount, const b
     SHORT sDistance;
     RETURN_IF_FALSE(SUCCEEDED(UIntToShort(uiCount, &sDistance)));
 
+    // Depending on clipping, this issues up to a scroll and two fills - batch them into one edit.
+    BatchScope batch(*_conApi);
+
     // get current cursor, viewport
     CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
     csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
@@ -783,6 +813,9 @@ bool AdaptDispatch::EraseInDisplay(const DispatchTypes::EraseType eraseType)
         return _EraseAll();
     }
 
+    // A full-viewport erase fills every line separately - batch them into one edit.
+    BatchScope batch(*_conApi);
+
     CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
     csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
     // Make sure to reset the viewport (with MoveToBottom )to where it was
@@ -1590,6 +1623,10 @@ bool AdaptDispatch::HardReset()
 // True if handled successfully. False otherwise.
 bool AdaptDispatch::_EraseScrollback()
 {
+    // This is a scroll, several fills, a viewport move and a cursor move -
+    // batch them so the user never sees a half-completed clear.
+    BatchScope batch(*_conApi);
+
     CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
     csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
     // Make sure to reset the viewport (with MoveToBottom )to where it was
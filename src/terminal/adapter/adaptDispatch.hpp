@@ -36,7 +36,7 @@ namespace Microsoft::Console::VirtualTerminal
             _pDefaults->Execute(wchControl);
         }
 
-        void PrintString(const wchar_t* const rgwch, const size_t cch) override;
+        void PrintString(const std::wstring_view string) override;
         void Print(const wchar_t wchPrintable) override;
 
         bool CursorUp(_In_ unsigned int const uiDistance) override; // CUU
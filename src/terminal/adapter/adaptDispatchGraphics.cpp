@@ -388,6 +388,11 @@ bool AdaptDispatch::_SetDefaultColorHelper(const DispatchTypes::GraphicsOptions
 // Routine Description:
 // - SGR - Modifies the graphical rendering options applied to the next characters written into the buffer.
 //       - Options include colors, invert, underlines, and other "font style" type options.
+//       - Runs of plain legacy options (e.g. "ESC[4;33;44m") are accumulated into
+//         the local attribute word and flushed with a single
+//         PrivateSetLegacyAttributes call, instead of one call per option. The
+//         flush happens before any bold/default/extended color option so the
+//         options still take effect in the order they were written.
 // Arguments:
 // - rgOptions - An array of options that will be applied from 0 to N, in order, one at a time by setting or removing flags in the font style properties.
 // - cOptions - The count of options (a.k.a. the N in the above line of comments)
@@ -404,16 +409,33 @@ bool AdaptDispatch::SetGraphicsRendition(_In_reads_(cOptions) const DispatchType
 
     if (fSuccess)
     {
+        bool fPendingLegacyAttrs = false;
+
+        // Pushes any accumulated legacy attribute changes to the console.
+        auto FlushLegacyAttributes = [&]() {
+            if (fPendingLegacyAttrs)
+            {
+                fSuccess = !!_conApi->PrivateSetLegacyAttributes(attr, _fChangedForeground, _fChangedBackground, _fChangedMetaAttrs);
+
+                _fChangedForeground = false;
+                _fChangedBackground = false;
+                _fChangedMetaAttrs = false;
+                fPendingLegacyAttrs = false;
+            }
+        };
+
         // Run through the graphics options and apply them
         for (size_t i = 0; i < cOptions; i++)
         {
             DispatchTypes::GraphicsOptions opt = rgOptions[i];
             if (s_IsDefaultColorOption(opt))
             {
+                FlushLegacyAttributes();
                 fSuccess = _SetDefaultColorHelper(opt);
             }
             else if (s_IsBoldColorOption(opt))
             {
+                FlushLegacyAttributes();
                 fSuccess = _SetBoldColorHelper(rgOptions[i]);
             }
             else if (s_IsRgbColorOption(opt))
@@ -423,6 +445,8 @@ bool AdaptDispatch::SetGraphicsRendition(_In_reads_(cOptions) const DispatchType
 
                 size_t cOptionsConsumed = 0;
 
+                FlushLegacyAttributes();
+
                 // _SetRgbColorsHelper will call the appropriate ConApi function
                 fSuccess = _SetRgbColorsHelper(&(rgOptions[i]), cOptions - i, &rgbColor, &fIsForeground, &cOptionsConsumed);
 
@@ -431,19 +455,12 @@ bool AdaptDispatch::SetGraphicsRendition(_In_reads_(cOptions) const DispatchType
             else
             {
                 _SetGraphicsOptionHelper(opt, &attr);
-                fSuccess = !!_conApi->PrivateSetLegacyAttributes(attr, _fChangedForeground, _fChangedBackground, _fChangedMetaAttrs);
-
-                // Make sure we un-bold
-                if (fSuccess && opt == DispatchTypes::GraphicsOptions::Off)
-                {
-                    fSuccess = _SetBoldColorHelper(opt);
-                }
-
-                _fChangedForeground = false;
-                _fChangedBackground = false;
-                _fChangedMetaAttrs = false;
+                fPendingLegacyAttrs = true;
+                fSuccess = true;
             }
         }
+
+        FlushLegacyAttributes();
     }
 
     return fSuccess;
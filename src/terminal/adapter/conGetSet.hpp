@@ -93,6 +93,12 @@ namespace Microsoft::Console::VirtualTerminal
         virtual BOOL PrivateWriteConsoleControlInput(_In_ KeyEvent key) = 0;
         virtual BOOL PrivateRefreshWindow() = 0;
 
+        // Brackets a group of region operations (fills, scrolls) so the host
+        // can apply them as one edit: one lock acquisition, one presented
+        // frame. Batches may nest; the scope closes with the outermost End.
+        virtual BOOL PrivateBeginOutputBatch() = 0;
+        virtual BOOL PrivateEndOutputBatch() = 0;
+
         virtual BOOL GetConsoleOutputCP(_Out_ unsigned int* const puiOutputCP) = 0;
 
         virtual BOOL PrivateSuppressResizeRepaint() = 0;
@@ -22,7 +22,7 @@ class Microsoft::Console::VirtualTerminal::TermDispatch : public Microsoft::Cons
 public:
     void Execute(const wchar_t wchControl) override = 0;
     void Print(const wchar_t wchPrintable) override = 0;
-    void PrintString(const wchar_t* const rgwch, const size_t cch) override = 0;
+    void PrintString(const std::wstring_view string) override = 0;
 
     bool CursorUp(const unsigned int /*uiDistance*/) override { return false; } // CUU
     bool CursorDown(const unsigned int /*uiDistance*/) override { return false; } // CUD
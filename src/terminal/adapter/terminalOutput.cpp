@@ -17,9 +17,43 @@ TerminalOutput::~TerminalOutput()
 }
 
 // We include a full table so all we have to do is the lookup.
-// The tables only ever change the values x20 - x7f, hence why the table starts at \x20
+// The table covers the whole 7-bit range so the lookup needs no offset
+// arithmetic; the control region (x00 - x1f) and most of the printable region
+// are identity mappings.
 // From http://vt100.net/docs/vt220-rm/table2-4.html
-const wchar_t TerminalOutput::s_rgDECSpecialGraphicsTranslations[s_uiNumDisplayCharacters]{
+const wchar_t TerminalOutput::s_rgDECSpecialGraphicsTranslations[s_uiTranslationTableSize]{
+    L'\x00',
+    L'\x01',
+    L'\x02',
+    L'\x03',
+    L'\x04',
+    L'\x05',
+    L'\x06',
+    L'\x07',
+    L'\x08',
+    L'\x09',
+    L'\x0a',
+    L'\x0b',
+    L'\x0c',
+    L'\x0d',
+    L'\x0e',
+    L'\x0f',
+    L'\x10',
+    L'\x11',
+    L'\x12',
+    L'\x13',
+    L'\x14',
+    L'\x15',
+    L'\x16',
+    L'\x17',
+    L'\x18',
+    L'\x19',
+    L'\x1a',
+    L'\x1b',
+    L'\x1c',
+    L'\x1d',
+    L'\x1e',
+    L'\x1f',
     L'\x20',
     L'\x21',
     L'\x22',
@@ -121,11 +155,18 @@ const wchar_t TerminalOutput::s_rgDECSpecialGraphicsTranslations[s_uiNumDisplayC
 bool TerminalOutput::DesignateCharset(const wchar_t wchNewCharset)
 {
     bool result = false;
-    if (wchNewCharset == DispatchTypes::VTCharacterSets::DEC_LineDrawing ||
-        wchNewCharset == DispatchTypes::VTCharacterSets::USASCII)
+    switch (wchNewCharset)
     {
+    case DispatchTypes::VTCharacterSets::DEC_LineDrawing:
+        _wchCurrentCharset = wchNewCharset;
+        _pwchTranslationTable = s_rgDECSpecialGraphicsTranslations;
+        result = true;
+        break;
+    case DispatchTypes::VTCharacterSets::USASCII:
         _wchCurrentCharset = wchNewCharset;
+        _pwchTranslationTable = nullptr;
         result = true;
+        break;
     }
     return result;
 }
@@ -138,36 +179,37 @@ bool TerminalOutput::DesignateCharset(const wchar_t wchNewCharset)
 // - True if the current charset is not USASCII
 bool TerminalOutput::NeedToTranslate() const
 {
-    return _wchCurrentCharset != DispatchTypes::VTCharacterSets::USASCII;
+    return _pwchTranslationTable != nullptr;
 }
 
-const wchar_t* TerminalOutput::_GetTranslationTable() const
+wchar_t TerminalOutput::TranslateKey(const wchar_t wch) const
 {
-    const wchar_t* pwchTranslation = nullptr;
-    switch (_wchCurrentCharset)
-    {
-    case DispatchTypes::VTCharacterSets::DEC_LineDrawing:
-        pwchTranslation = TerminalOutput::s_rgDECSpecialGraphicsTranslations;
-        break;
-    }
-    return pwchTranslation;
+    return (_pwchTranslationTable != nullptr && wch <= L'\x7f') ? _pwchTranslationTable[wch] : wch;
 }
 
-wchar_t TerminalOutput::TranslateKey(const wchar_t wch) const
+// Routine Description:
+// - Translates a whole run of characters in place through the active table.
+//   The table pointer is resolved once for the run, so each character costs a
+//   range check and one indexed load - no per-character charset branching.
+// Arguments:
+// - pwchBuffer - the characters to translate, modified in place.
+// - cch - count of characters in pwchBuffer.
+// Return Value:
+// - <none>
+void TerminalOutput::TranslateInPlace(_Inout_updates_(cch) wchar_t* const pwchBuffer, const size_t cch) const
 {
-    wchar_t wchFound = wch;
-    if (_wchCurrentCharset == DispatchTypes::VTCharacterSets::USASCII ||
-        wch < '\x60' || wch > '\x7f') // filter out the region we know is unchanged
+    const wchar_t* const pwchTable = _pwchTranslationTable;
+    if (pwchTable == nullptr)
     {
-        ; // do nothing, these are the same as default.
+        return;
     }
-    else
+
+    for (size_t i = 0; i < cch; i++)
     {
-        const wchar_t* pwchTranslationTable = _GetTranslationTable();
-        if (pwchTranslationTable != nullptr)
+        const wchar_t wch = pwchBuffer[i];
+        if (wch <= L'\x7f')
         {
-            wchFound = (pwchTranslationTable[wch - '\x20']);
+            pwchBuffer[i] = pwchTable[wch];
         }
     }
-    return wchFound;
 }
@@ -27,16 +27,21 @@ namespace Microsoft::Console::VirtualTerminal
         ~TerminalOutput();
 
         wchar_t TranslateKey(const wchar_t wch) const;
+        void TranslateInPlace(_Inout_updates_(cch) wchar_t* const pwchBuffer, const size_t cch) const;
         bool DesignateCharset(const wchar_t wchNewCharset);
         bool NeedToTranslate() const;
 
     private:
         wchar_t _wchCurrentCharset = DispatchTypes::VTCharacterSets::USASCII;
 
-        // The tables only ever change the values x20 - x7f (96 display characters)
-        static const unsigned int s_uiNumDisplayCharacters = 96;
-        static const wchar_t s_rgDECSpecialGraphicsTranslations[s_uiNumDisplayCharacters];
+        // The active table, swapped when a charset is designated. Null means
+        // USASCII (no translation), so the print path's per-character work is
+        // one null check amortized over the string plus one indexed load.
+        const wchar_t* _pwchTranslationTable = nullptr;
 
-        const wchar_t* _GetTranslationTable() const;
+        // The tables cover the full 7-bit range (x00 - x7f) so a lookup is a
+        // single index with no offset arithmetic; only x20 - x7f ever differ.
+        static const unsigned int s_uiTranslationTableSize = 128;
+        static const wchar_t s_rgDECSpecialGraphicsTranslations[s_uiTranslationTableSize];
     };
 }
@@ -708,6 +708,21 @@ public:
         return TRUE;
     }
 
+    BOOL PrivateBeginOutputBatch() override
+    {
+        Log::Comment(L"PrivateBeginOutputBatch MOCK called...");
+        _cBatchDepth++;
+        return TRUE;
+    }
+
+    BOOL PrivateEndOutputBatch() override
+    {
+        Log::Comment(L"PrivateEndOutputBatch MOCK called...");
+        VERIFY_IS_GREATER_THAN(_cBatchDepth, 0u, L"Batches shouldn't be ended without a Begin.");
+        _cBatchDepth--;
+        return TRUE;
+    }
+
     BOOL PrivateSuppressResizeRepaint() override
     {
         Log::Comment(L"PrivateSuppressResizeRepaint MOCK called...");
@@ -1405,6 +1420,8 @@ public:
     bool _fPrivateSetDefaultAttributesResult = false;
     bool _fMoveToBottomResult = false;
 
+    size_t _cBatchDepth = 0;
+
     bool _fPrivateSetColorTableEntryResult = false;
     short _expectedColorTableIndex = -1;
     COLORREF _expectedColorValue = INVALID_COLOR;
@@ -1425,7 +1442,7 @@ class DummyAdapter : public AdaptDefaults
     {
     }
 
-    void PrintString(_In_reads_(_Param_(2)) const wchar_t* const /*rgwch*/, const size_t /*cch*/) override
+    void PrintString(const std::wstring_view /*string*/) override
     {
     }
 
@@ -182,9 +182,6 @@ const TerminalInput::_TermKeyMap TerminalInput::s_rgSimpleModifedKeyMapping[]{
 
 const wchar_t* const CTRL_SLASH_SEQUENCE = L"\x1f";
 
-// Do NOT include the null terminator in the count.
-const size_t TerminalInput::_TermKeyMap::s_cchMaxSequenceLength = 7; // UPDATE THIS DEF WHEN THE LONGEST MAPPED STRING CHANGES
-
 const size_t TerminalInput::s_cCursorKeysNormalMapping = ARRAYSIZE(s_rgCursorKeysNormalMapping);
 const size_t TerminalInput::s_cCursorKeysApplicationMapping = ARRAYSIZE(s_rgCursorKeysApplicationMapping);
 const size_t TerminalInput::s_cKeypadNumericMapping = ARRAYSIZE(s_rgKeypadNumericMapping);
@@ -192,6 +189,70 @@ const size_t TerminalInput::s_cKeypadApplicationMapping = ARRAYSIZE(s_rgKeypadAp
 const size_t TerminalInput::s_cModifierKeyMapping = ARRAYSIZE(s_rgModifierKeyMapping);
 const size_t TerminalInput::s_cSimpleModifedKeyMapping = ARRAYSIZE(s_rgSimpleModifedKeyMapping);
 
+// Routine Description:
+// - Retrieves the direct index for one of the static mapping tables: entry
+//      vk holds the position of that virtual key's first entry in the table,
+//      or s_NotMapped when the key has none. The tables are immutable, so
+//      the indexes are built exactly once on first use and shared; a
+//      keystroke then finds its entry with a single array read instead of
+//      scanning the table.
+// - A table can hold several entries for one virtual key (the simple
+//      modified mappings do); those entries are contiguous, so the index
+//      points at the first and the caller walks forward while the key still
+//      matches.
+// Arguments:
+// - keyMapping - One of the static mapping tables.
+// Return Value:
+// - The 256-entry index for that table, or nullptr for an unknown table.
+const BYTE* TerminalInput::s_GetVkIndexTable(_In_ const _TermKeyMap* const keyMapping) noexcept
+{
+    struct IndexedTable
+    {
+        const _TermKeyMap* pMapping;
+        size_t cMapping;
+        BYTE rgIndex[256];
+    };
+
+    struct IndexedTables
+    {
+        IndexedTable rg[6];
+    };
+
+    static const IndexedTables s_indexes = [] {
+        IndexedTables indexes{ { { s_rgCursorKeysNormalMapping, s_cCursorKeysNormalMapping, {} },
+                                 { s_rgCursorKeysApplicationMapping, s_cCursorKeysApplicationMapping, {} },
+                                 { s_rgKeypadNumericMapping, s_cKeypadNumericMapping, {} },
+                                 { s_rgKeypadApplicationMapping, s_cKeypadApplicationMapping, {} },
+                                 { s_rgModifierKeyMapping, s_cModifierKeyMapping, {} },
+                                 { s_rgSimpleModifedKeyMapping, s_cSimpleModifedKeyMapping, {} } } };
+
+        for (auto& table : indexes.rg)
+        {
+            memset(table.rgIndex, s_NotMapped, sizeof(table.rgIndex));
+            for (size_t i = 0; i < table.cMapping; i++)
+            {
+                const WORD wVirtualKey = table.pMapping[i].wVirtualKey;
+                if (wVirtualKey < ARRAYSIZE(table.rgIndex) && table.rgIndex[wVirtualKey] == s_NotMapped)
+                {
+                    table.rgIndex[wVirtualKey] = static_cast<BYTE>(i);
+                }
+            }
+        }
+
+        return indexes;
+    }();
+
+    for (const auto& table : s_indexes.rg)
+    {
+        if (table.pMapping == keyMapping)
+        {
+            return table.rgIndex;
+        }
+    }
+
+    return nullptr;
+}
+
 void TerminalInput::ChangeKeypadMode(const bool fApplicationMode)
 {
     _fKeypadApplicationMode = fApplicationMode;
@@ -243,19 +304,17 @@ bool TerminalInput::_SearchWithModifier(const KeyEvent& keyEvent) const
         if (SUCCEEDED(StringCchLengthW(pMatchingMapping->pwszSequence, _TermKeyMap::s_cchMaxSequenceLength + 1, &cch)) &&
             cch > 0)
         {
-            wchar_t* rwchModifiedSequence = new (std::nothrow) wchar_t[cch + 1];
-            if (rwchModifiedSequence != nullptr)
-            {
-                memcpy(rwchModifiedSequence, pMatchingMapping->pwszSequence, cch * sizeof(wchar_t));
-                const bool fShift = keyEvent.IsShiftPressed();
-                const bool fAlt = keyEvent.IsAltPressed();
-                const bool fCtrl = keyEvent.IsCtrlPressed();
-                rwchModifiedSequence[cch - 2] = L'1' + (fShift ? 1 : 0) + (fAlt ? 2 : 0) + (fCtrl ? 4 : 0);
-                rwchModifiedSequence[cch] = 0;
-                _SendInputSequence(rwchModifiedSequence);
-                fSuccess = true;
-                delete[] rwchModifiedSequence;
-            }
+            // The sequences are tiny and bounded, so patch the modifier
+            // digit into a stack copy - a keystroke shouldn't hit the heap.
+            wchar_t rgwchModifiedSequence[_TermKeyMap::s_cchMaxSequenceLength + 1];
+            memcpy(rgwchModifiedSequence, pMatchingMapping->pwszSequence, cch * sizeof(wchar_t));
+            const bool fShift = keyEvent.IsShiftPressed();
+            const bool fAlt = keyEvent.IsAltPressed();
+            const bool fCtrl = keyEvent.IsCtrlPressed();
+            rgwchModifiedSequence[cch - 2] = L'1' + (fShift ? 1 : 0) + (fAlt ? 2 : 0) + (fCtrl ? 4 : 0);
+            rgwchModifiedSequence[cch] = 0;
+            _SendInputSequence(rgwchModifiedSequence);
+            fSuccess = true;
         }
     }
     else
@@ -305,11 +364,34 @@ bool TerminalInput::_SearchKeyMapping(const KeyEvent& keyEvent,
                                       const size_t cKeyMapping,
                                       _Out_ const TerminalInput::_TermKeyMap** pMatchingMapping) const
 {
+    const WORD wVirtualKey = keyEvent.GetVirtualKeyCode();
+
+    // The direct index says where this key's entries start, or that there
+    // are none. Unknown tables (there are none today) keep the full scan.
+    size_t iFirst = 0;
+    const BYTE* const rgIndex = s_GetVkIndexTable(keyMapping);
+    if (rgIndex != nullptr && wVirtualKey < 256)
+    {
+        if (rgIndex[wVirtualKey] == s_NotMapped)
+        {
+            return false;
+        }
+
+        iFirst = rgIndex[wVirtualKey];
+    }
+
     bool fKeyTranslated = false;
-    for (size_t i = 0; i < cKeyMapping; i++)
+    for (size_t i = iFirst; i < cKeyMapping; i++)
     {
         const _TermKeyMap* const pMap = &(keyMapping[i]);
 
+        if (pMap->wVirtualKey != wVirtualKey && rgIndex != nullptr)
+        {
+            // Entries for one key are contiguous - once we're past them, no
+            // later entry can match.
+            break;
+        }
+
         if (pMap->wVirtualKey == keyEvent.GetVirtualKeyCode())
         {
             // If the mapping has no modifiers set, then it doesn't really care
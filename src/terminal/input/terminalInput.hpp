@@ -52,7 +52,8 @@ namespace Microsoft::Console::VirtualTerminal
             PCWSTR const pwszSequence;
             DWORD const dwModifiers;
 
-            static const size_t s_cchMaxSequenceLength;
+            // Does NOT include the null terminator.
+            static constexpr size_t s_cchMaxSequenceLength = 7; // UPDATE THIS DEF WHEN THE LONGEST MAPPED STRING CHANGES
 
             _TermKeyMap(const WORD wVirtualKey, _In_ PCWSTR const pwszSequence) :
                 wVirtualKey(wVirtualKey),
@@ -91,6 +92,11 @@ namespace Microsoft::Console::VirtualTerminal
         static const size_t s_cModifierKeyMapping;
         static const size_t s_cSimpleModifedKeyMapping;
 
+        // Marks a virtual key with no entry in a mapping table's direct
+        // index. See s_GetVkIndexTable.
+        static constexpr BYTE s_NotMapped = 0xFF;
+        static const BYTE* s_GetVkIndexTable(_In_ const _TermKeyMap* const keyMapping) noexcept;
+
         bool _SearchKeyMapping(const KeyEvent& keyEvent,
                                _In_reads_(cKeyMapping) const TerminalInput::_TermKeyMap* keyMapping,
                                const size_t cKeyMapping,
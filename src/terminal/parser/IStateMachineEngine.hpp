@@ -22,8 +22,7 @@ namespace Microsoft::Console::VirtualTerminal
         virtual bool ActionExecute(const wchar_t wch) = 0;
         virtual bool ActionExecuteFromEscape(const wchar_t wch) = 0;
         virtual bool ActionPrint(const wchar_t wch) = 0;
-        virtual bool ActionPrintString(const wchar_t* const rgwch,
-                                       size_t const cch) = 0;
+        virtual bool ActionPrintString(const std::wstring_view string) = 0;
 
         virtual bool ActionPassThroughString(const wchar_t* const rgwch,
                                              size_t const cch) = 0;
@@ -50,6 +49,11 @@ namespace Microsoft::Console::VirtualTerminal
                                        _In_reads_(cParams) const unsigned short* const rgusParams,
                                        const unsigned short cParams) = 0;
 
+        // Called once when the state machine finishes processing a string, so
+        //    engines that batch dispatched work can deliver it in a single
+        //    write per processed chunk.
+        virtual bool ActionEndOfString() = 0;
+
         virtual bool FlushAtEndOfString() const = 0;
         virtual bool DispatchControlCharsFromEscape() const = 0;
         virtual bool DispatchIntermediatesFromEscape() const = 0;
@@ -104,7 +104,8 @@ bool InputStateMachineEngine::_DoControlCharacter(const wchar_t wch, const bool
     if (wch == UNICODE_ETX && !writeAlt)
     {
         // This is Ctrl+C, which is handled specially by the host.
-        fSuccess = _pDispatch->WriteCtrlC();
+        // Flush first, so it lands after any keys batched earlier in the chunk.
+        fSuccess = _FlushBatchedInput() && _pDispatch->WriteCtrlC();
     }
     else if (wch >= '\x0' && wch < '\x20')
     {
@@ -213,18 +214,17 @@ bool InputStateMachineEngine::ActionPrint(const wchar_t wch)
 // - Triggers the Print action to indicate that the listener should render the
 //      string of characters given.
 // Arguments:
-// - rgwch - string to dispatch.
-// - cch - length of rgwch
+// - string - string to dispatch.
 // Return Value:
 // - true iff we successfully dispatched the sequence.
-bool InputStateMachineEngine::ActionPrintString(const wchar_t* const rgwch,
-                                                const size_t cch)
+bool InputStateMachineEngine::ActionPrintString(const std::wstring_view string)
 {
-    if (cch == 0)
+    if (string.empty())
     {
         return true;
     }
-    return _pDispatch->WriteString(rgwch, cch);
+    // Flush first, so the string lands after any keys batched earlier in the chunk.
+    return _FlushBatchedInput() && _pDispatch->WriteString(string.data(), string.size());
 }
 
 // Method Description:
@@ -238,7 +238,7 @@ bool InputStateMachineEngine::ActionPrintString(const wchar_t* const rgwch,
 bool InputStateMachineEngine::ActionPassThroughString(const wchar_t* const rgwch,
                                                       _In_ size_t const cch)
 {
-    return ActionPrintString(rgwch, cch);
+    return ActionPrintString({ rgwch, cch });
 }
 
 // Method Description:
@@ -363,7 +363,7 @@ bool InputStateMachineEngine::ActionCsiDispatch(const wchar_t wch,
             // Else, fall though to the _GetCursorKeysModifierState handler.
             if (_lookingForDSR)
             {
-                fSuccess = _pDispatch->MoveCursor(row, col);
+                fSuccess = _FlushBatchedInput() && _pDispatch->MoveCursor(row, col);
                 // Right now we're only looking for on initial cursor
                 //      position response. After that, only look for F3.
                 _lookingForDSR = false;
@@ -384,7 +384,8 @@ bool InputStateMachineEngine::ActionCsiDispatch(const wchar_t wch,
             fSuccess = _WriteSingleKey(vkey, dwModifierState);
             break;
         case CsiActionCodes::DTTERM_WindowManipulation:
-            fSuccess = _pDispatch->WindowManipulation(static_cast<DispatchTypes::WindowManipulationType>(uiFunction),
+            fSuccess = _FlushBatchedInput() &&
+                       _pDispatch->WindowManipulation(static_cast<DispatchTypes::WindowManipulationType>(uiFunction),
                                                       rgusRemainingArgs,
                                                       cRemainingArgs);
             break;
@@ -655,11 +656,45 @@ bool InputStateMachineEngine::_WriteSingleKey(const wchar_t wch, const short vke
     INPUT_RECORD rgInput[WRAPPED_SEQUENCE_MAX_LENGTH];
     size_t cInput = _GenerateWrappedSequence(wch, vkey, dwModifierState, rgInput, WRAPPED_SEQUENCE_MAX_LENGTH);
 
-    std::deque<std::unique_ptr<IInputEvent>> inputEvents = IInputEvent::Create(gsl::make_span(rgInput, cInput));
+    // Don't write the records yet - accumulate them, and ActionEndOfString
+    //      delivers everything decoded from the chunk in one batch.
+    _batchedInput.insert(_batchedInput.end(), rgInput, rgInput + cInput);
+
+    return true;
+}
+
+// Method Description:
+// - Writes any accumulated key records to the dispatch in a single batch, and
+//      resets the accumulator for the next chunk (keeping its storage).
+// Arguments:
+// - <none>
+// Return Value:
+// - true iff there was nothing to write, or we successfully wrote the batch.
+bool InputStateMachineEngine::_FlushBatchedInput()
+{
+    if (_batchedInput.empty())
+    {
+        return true;
+    }
+
+    std::deque<std::unique_ptr<IInputEvent>> inputEvents = IInputEvent::Create(gsl::make_span(_batchedInput.data(), _batchedInput.size()));
+    _batchedInput.clear();
 
     return _pDispatch->WriteInput(inputEvents);
 }
 
+// Method Description:
+// - Called at the end of every processed string. Delivers the key records
+//      batched up by _WriteSingleKey while the chunk was dispatched.
+// Arguments:
+// - <none>
+// Return Value:
+// - true iff we successfully wrote any batched input.
+bool InputStateMachineEngine::ActionEndOfString()
+{
+    return _FlushBatchedInput();
+}
+
 // Method Description:
 // - Helper for writing a single key to the input when you only know the vkey.
 //      Will automatically get the wchar_t associated with that vkey.
@@ -35,8 +35,7 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool ActionPrint(const wchar_t wch) override;
 
-        bool ActionPrintString(const wchar_t* const rgwch,
-                               const size_t cch) override;
+        bool ActionPrintString(const std::wstring_view string) override;
 
         bool ActionPassThroughString(const wchar_t* const rgwch,
                                      size_t const cch) override;
@@ -64,6 +63,8 @@ namespace Microsoft::Console::VirtualTerminal
                                _In_reads_(cParams) const unsigned short* const rgusParams,
                                const unsigned short cParams) override;
 
+        bool ActionEndOfString() override;
+
         bool FlushAtEndOfString() const override;
         bool DispatchControlCharsFromEscape() const override;
         bool DispatchIntermediatesFromEscape() const override;
@@ -72,6 +73,12 @@ namespace Microsoft::Console::VirtualTerminal
         const std::unique_ptr<IInteractDispatch> _pDispatch;
         bool _lookingForDSR;
 
+        // Key records decoded while processing the current string. They're
+        //      accumulated here and written to the dispatch in one batch at the
+        //      end of the chunk, so paste and autorepeat don't pay a write per
+        //      keystroke. The vector is reused across chunks.
+        std::vector<INPUT_RECORD> _batchedInput;
+
         enum CsiActionCodes : wchar_t
         {
             ArrowUp = L'A',
@@ -164,6 +171,7 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool _WriteSingleKey(const short vkey, const DWORD dwModifierState);
         bool _WriteSingleKey(const wchar_t wch, const short vkey, const DWORD dwModifierState);
+        bool _FlushBatchedInput();
 
         size_t _GenerateWrappedSequence(const wchar_t wch,
                                         const short vkey,
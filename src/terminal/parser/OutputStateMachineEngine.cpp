@@ -86,24 +86,23 @@ bool OutputStateMachineEngine::ActionPrint(const wchar_t wch)
 // - Triggers the Print action to indicate that the listener should render the
 //      string of characters given.
 // Arguments:
-// - rgwch - string to dispatch.
-// - cch - length of rgwch
+// - string - string to dispatch.
 // Return Value:
 // - true iff we successfully dispatched the sequence.
-bool OutputStateMachineEngine::ActionPrintString(const wchar_t* const rgwch, const size_t cch)
+bool OutputStateMachineEngine::ActionPrintString(const std::wstring_view string)
 {
-    if (cch == 0)
+    if (string.empty())
     {
         return true;
     }
     // Stash the last character of the string, if it's a graphical character
-    const wchar_t wch = rgwch[cch - 1];
+    const wchar_t wch = string.back();
     if (wch >= AsciiChars::SPC)
     {
         _lastPrintedChar = wch;
     }
 
-    _dispatch->PrintString(rgwch, cch); // call print
+    _dispatch->PrintString(string); // call print
 
     return true;
 }
@@ -283,194 +282,213 @@ bool OutputStateMachineEngine::ActionCsiDispatch(const wchar_t wch,
 
     if (cIntermediate == 0)
     {
-        // fill params
+        // One pass over the final byte: each case validates its parameters and
+        // dispatches immediately, so a sequence is routed through a single dense
+        // switch instead of one walk to fill params and a second one to dispatch.
         switch (wch)
         {
         case VTActionCodes::CUU_CursorUp:
-        case VTActionCodes::CUD_CursorDown:
-        case VTActionCodes::CUF_CursorForward:
-        case VTActionCodes::CUB_CursorBackward:
-        case VTActionCodes::CNL_CursorNextLine:
-        case VTActionCodes::CPL_CursorPrevLine:
-        case VTActionCodes::CHA_CursorHorizontalAbsolute:
-        case VTActionCodes::VPA_VerticalLinePositionAbsolute:
-        case VTActionCodes::ICH_InsertCharacter:
-        case VTActionCodes::DCH_DeleteCharacter:
-        case VTActionCodes::ECH_EraseCharacters:
-            fSuccess = _GetCursorDistance(rgusParams, cParams, &uiDistance);
-            break;
-        case VTActionCodes::HVP_HorizontalVerticalPosition:
-        case VTActionCodes::CUP_CursorPosition:
-            fSuccess = _GetXYPosition(rgusParams, cParams, &uiLine, &uiColumn);
-            break;
-        case VTActionCodes::DECSTBM_SetScrollingRegion:
-            fSuccess = _GetTopBottomMargins(rgusParams, cParams, &sTopMargin, &sBottomMargin);
-            break;
-        case VTActionCodes::ED_EraseDisplay:
-        case VTActionCodes::EL_EraseLine:
-            fSuccess = _GetEraseOperation(rgusParams, cParams, &eraseType);
-            break;
-        case VTActionCodes::SGR_SetGraphicsRendition:
-            fSuccess = _GetGraphicsOptions(rgusParams, cParams, rgGraphicsOptions, &cOptions);
-            break;
-        case VTActionCodes::DSR_DeviceStatusReport:
-            fSuccess = _GetDeviceStatusOperation(rgusParams, cParams, &deviceStatusType);
-            break;
-        case VTActionCodes::DA_DeviceAttributes:
-            fSuccess = _VerifyDeviceAttributesParams(rgusParams, cParams);
-            break;
-        case VTActionCodes::SU_ScrollUp:
-        case VTActionCodes::SD_ScrollDown:
-            fSuccess = _GetScrollDistance(rgusParams, cParams, &uiDistance);
-            break;
-        case VTActionCodes::ANSISYSSC_CursorSave:
-        case VTActionCodes::ANSISYSRC_CursorRestore:
-            fSuccess = _VerifyHasNoParameters(cParams);
-            break;
-        case VTActionCodes::IL_InsertLine:
-        case VTActionCodes::DL_DeleteLine:
-            fSuccess = _GetScrollDistance(rgusParams, cParams, &uiDistance);
-            break;
-        case VTActionCodes::CHT_CursorForwardTab:
-        case VTActionCodes::CBT_CursorBackTab:
-            fSuccess = _GetTabDistance(rgusParams, cParams, &sNumTabs);
-            break;
-        case VTActionCodes::TBC_TabClear:
-            fSuccess = _GetTabClearType(rgusParams, cParams, &sClearType);
-            break;
-        case VTActionCodes::DTTERM_WindowManipulation:
-            fSuccess = _GetWindowManipulationType(rgusParams, cParams, &uiFunction);
-            break;
-        case VTActionCodes::REP_RepeatCharacter:
-            fSuccess = _GetRepeatCount(rgusParams, cParams, &repeatCount);
-            break;
-        default:
-            // If no params to fill, param filling was successful.
-            fSuccess = true;
-            break;
-        }
-
-        // if param filling successful, try to dispatch
-        if (fSuccess)
-        {
-            switch (wch)
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
             {
-            case VTActionCodes::CUU_CursorUp:
                 fSuccess = _dispatch->CursorUp(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CUU);
-                break;
-            case VTActionCodes::CUD_CursorDown:
+            }
+            break;
+        case VTActionCodes::CUD_CursorDown:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorDown(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CUD);
-                break;
-            case VTActionCodes::CUF_CursorForward:
+            }
+            break;
+        case VTActionCodes::CUF_CursorForward:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorForward(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CUF);
-                break;
-            case VTActionCodes::CUB_CursorBackward:
+            }
+            break;
+        case VTActionCodes::CUB_CursorBackward:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorBackward(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CUB);
-                break;
-            case VTActionCodes::CNL_CursorNextLine:
+            }
+            break;
+        case VTActionCodes::CNL_CursorNextLine:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorNextLine(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CNL);
-                break;
-            case VTActionCodes::CPL_CursorPrevLine:
+            }
+            break;
+        case VTActionCodes::CPL_CursorPrevLine:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorPrevLine(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CPL);
-                break;
-            case VTActionCodes::CHA_CursorHorizontalAbsolute:
+            }
+            break;
+        case VTActionCodes::CHA_CursorHorizontalAbsolute:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->CursorHorizontalPositionAbsolute(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CHA);
-                break;
-            case VTActionCodes::VPA_VerticalLinePositionAbsolute:
+            }
+            break;
+        case VTActionCodes::VPA_VerticalLinePositionAbsolute:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->VerticalLinePositionAbsolute(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::VPA);
-                break;
-            case VTActionCodes::CUP_CursorPosition:
-            case VTActionCodes::HVP_HorizontalVerticalPosition:
+            }
+            break;
+        case VTActionCodes::HVP_HorizontalVerticalPosition:
+        case VTActionCodes::CUP_CursorPosition:
+            if (_GetXYPosition(rgusParams, cParams, &uiLine, &uiColumn))
+            {
                 fSuccess = _dispatch->CursorPosition(uiLine, uiColumn);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CUP);
-                break;
-            case VTActionCodes::DECSTBM_SetScrollingRegion:
+            }
+            break;
+        case VTActionCodes::DECSTBM_SetScrollingRegion:
+            if (_GetTopBottomMargins(rgusParams, cParams, &sTopMargin, &sBottomMargin))
+            {
                 fSuccess = _dispatch->SetTopBottomScrollingMargins(sTopMargin, sBottomMargin);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSTBM);
-                break;
-            case VTActionCodes::ICH_InsertCharacter:
+            }
+            break;
+        case VTActionCodes::ICH_InsertCharacter:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->InsertCharacter(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::ICH);
-                break;
-            case VTActionCodes::DCH_DeleteCharacter:
+            }
+            break;
+        case VTActionCodes::DCH_DeleteCharacter:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->DeleteCharacter(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DCH);
-                break;
-            case VTActionCodes::ED_EraseDisplay:
+            }
+            break;
+        case VTActionCodes::ED_EraseDisplay:
+            if (_GetEraseOperation(rgusParams, cParams, &eraseType))
+            {
                 fSuccess = _dispatch->EraseInDisplay(eraseType);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::ED);
-                break;
-            case VTActionCodes::EL_EraseLine:
+            }
+            break;
+        case VTActionCodes::EL_EraseLine:
+            if (_GetEraseOperation(rgusParams, cParams, &eraseType))
+            {
                 fSuccess = _dispatch->EraseInLine(eraseType);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::EL);
-                break;
-            case VTActionCodes::SGR_SetGraphicsRendition:
+            }
+            break;
+        case VTActionCodes::SGR_SetGraphicsRendition:
+            if (_GetGraphicsOptions(rgusParams, cParams, rgGraphicsOptions, &cOptions))
+            {
                 fSuccess = _dispatch->SetGraphicsRendition(rgGraphicsOptions, cOptions);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::SGR);
-                break;
-            case VTActionCodes::DSR_DeviceStatusReport:
+            }
+            break;
+        case VTActionCodes::DSR_DeviceStatusReport:
+            if (_GetDeviceStatusOperation(rgusParams, cParams, &deviceStatusType))
+            {
                 fSuccess = _dispatch->DeviceStatusReport(deviceStatusType);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DSR);
-                break;
-            case VTActionCodes::DA_DeviceAttributes:
+            }
+            break;
+        case VTActionCodes::DA_DeviceAttributes:
+            if (_VerifyDeviceAttributesParams(rgusParams, cParams))
+            {
                 fSuccess = _dispatch->DeviceAttributes();
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DA);
-                break;
-            case VTActionCodes::SU_ScrollUp:
+            }
+            break;
+        case VTActionCodes::SU_ScrollUp:
+            if (_GetScrollDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->ScrollUp(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::SU);
-                break;
-            case VTActionCodes::SD_ScrollDown:
+            }
+            break;
+        case VTActionCodes::SD_ScrollDown:
+            if (_GetScrollDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->ScrollDown(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::SD);
-                break;
-            case VTActionCodes::ANSISYSSC_CursorSave:
+            }
+            break;
+        case VTActionCodes::ANSISYSSC_CursorSave:
+            if (_VerifyHasNoParameters(cParams))
+            {
                 fSuccess = _dispatch->CursorSavePosition();
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::ANSISYSSC);
-                break;
-            case VTActionCodes::ANSISYSRC_CursorRestore:
+            }
+            break;
+        case VTActionCodes::ANSISYSRC_CursorRestore:
+            if (_VerifyHasNoParameters(cParams))
+            {
                 fSuccess = _dispatch->CursorRestorePosition();
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::ANSISYSRC);
-                break;
-            case VTActionCodes::IL_InsertLine:
+            }
+            break;
+        case VTActionCodes::IL_InsertLine:
+            if (_GetScrollDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->InsertLine(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::IL);
-                break;
-            case VTActionCodes::DL_DeleteLine:
+            }
+            break;
+        case VTActionCodes::DL_DeleteLine:
+            if (_GetScrollDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->DeleteLine(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DL);
-                break;
-            case VTActionCodes::CHT_CursorForwardTab:
+            }
+            break;
+        case VTActionCodes::CHT_CursorForwardTab:
+            if (_GetTabDistance(rgusParams, cParams, &sNumTabs))
+            {
                 fSuccess = _dispatch->ForwardTab(sNumTabs);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CHT);
-                break;
-            case VTActionCodes::CBT_CursorBackTab:
+            }
+            break;
+        case VTActionCodes::CBT_CursorBackTab:
+            if (_GetTabDistance(rgusParams, cParams, &sNumTabs))
+            {
                 fSuccess = _dispatch->BackwardsTab(sNumTabs);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::CBT);
-                break;
-            case VTActionCodes::TBC_TabClear:
+            }
+            break;
+        case VTActionCodes::TBC_TabClear:
+            if (_GetTabClearType(rgusParams, cParams, &sClearType))
+            {
                 fSuccess = _dispatch->TabClear(sClearType);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::TBC);
-                break;
-            case VTActionCodes::ECH_EraseCharacters:
+            }
+            break;
+        case VTActionCodes::ECH_EraseCharacters:
+            if (_GetCursorDistance(rgusParams, cParams, &uiDistance))
+            {
                 fSuccess = _dispatch->EraseCharacters(uiDistance);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::ECH);
-                break;
-            case VTActionCodes::DTTERM_WindowManipulation:
+            }
+            break;
+        case VTActionCodes::DTTERM_WindowManipulation:
+            if (_GetWindowManipulationType(rgusParams, cParams, &uiFunction))
+            {
                 fSuccess = _dispatch->WindowManipulation(static_cast<DispatchTypes::WindowManipulationType>(uiFunction),
                                                          rgusRemainingArgs,
                                                          cRemainingArgs);
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::DTTERM_WM);
-                break;
-            case VTActionCodes::REP_RepeatCharacter:
+            }
+            break;
+        case VTActionCodes::REP_RepeatCharacter:
+            if (_GetRepeatCount(rgusParams, cParams, &repeatCount))
+            {
                 // Handled w/o the dispatch. This function is unique in that way
                 // If this were in the ITerminalDispatch, then each
                 // implementation would effectively be the same, calling only
@@ -478,17 +496,17 @@ bool OutputStateMachineEngine::ActionCsiDispatch(const wchar_t wch,
                 // Print the last graphical character a number of times.
                 if (_lastPrintedChar != AsciiChars::NUL)
                 {
-                    std::wstring wstr(repeatCount, _lastPrintedChar);
-                    _dispatch->PrintString(wstr.c_str(), wstr.length());
+                    const std::wstring wstr(repeatCount, _lastPrintedChar);
+                    _dispatch->PrintString(wstr);
                 }
                 fSuccess = true;
                 TermTelemetry::Instance().Log(TermTelemetry::Codes::REP);
-                break;
-            default:
-                // If no functions to call, overall dispatch was a failure.
-                fSuccess = false;
-                break;
             }
+            break;
+        default:
+            // If no functions to call, overall dispatch was a failure.
+            fSuccess = false;
+            break;
         }
     }
     else if (cIntermediate == 1)
@@ -779,6 +797,18 @@ bool OutputStateMachineEngine::ActionSs3Dispatch(const wchar_t /*wch*/,
     return false;
 }
 
+// Routine Description:
+// - Called at the end of every processed string. The output engine dispatches
+//      everything inline, so there's nothing batched to deliver here.
+// Arguments:
+// - <none>
+// Return Value:
+// - true.
+bool OutputStateMachineEngine::ActionEndOfString()
+{
+    return true;
+}
+
 // Routine Description:
 // - Retrieves the listed graphics options to be applied in order to the "font style" of the next characters inserted into the buffer.
 // Arguments:
@@ -28,7 +28,7 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool ActionPrint(const wchar_t wch) override;
 
-        bool ActionPrintString(const wchar_t* const rgwch, const size_t cch) override;
+        bool ActionPrintString(const std::wstring_view string) override;
 
         bool ActionPassThroughString(const wchar_t* const rgwch,
                                      size_t const cch) override;
@@ -56,6 +56,8 @@ namespace Microsoft::Console::VirtualTerminal
                                _In_reads_(cParams) const unsigned short* const rgusParams,
                                const unsigned short cParams) override;
 
+        bool ActionEndOfString() override;
+
         bool FlushAtEndOfString() const override;
         bool DispatchControlCharsFromEscape() const override;
         bool DispatchIntermediatesFromEscape() const override;
@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Throughput benchmark for the VT parser.
+//
+// Replays corpora shaped like common real-world streams (vim scrolling,
+// ninja build output, tmux full redraws, interactive keyboard input) through
+// StateMachine with both engines, so parser changes are gated on numbers.
+// Output is one tab-separated line per corpus:
+//
+//   <corpus>  <bytes/pass>  <median-MB/s>  <median-actions/s>
+//
+// The corpora are synthesized in code rather than checked in as captures:
+// the generators are deterministic, don't bloat the repo, and keep the
+// sequence mix documented right next to the numbers it produces.
+
+#include "precomp.h"
+
+#include "..\stateMachine.hpp"
+#include "..\OutputStateMachineEngine.hpp"
+#include "..\InputStateMachineEngine.hpp"
+#include "..\..\adapter\termDispatch.hpp"
+#include "..\..\adapter\IInteractDispatch.hpp"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+namespace
+{
+    // Counts dispatched actions and otherwise swallows them, so the timings
+    // measure the parser and engine rather than any sink behind them.
+    class CountingDispatch final : public TermDispatch
+    {
+    public:
+        void Execute(const wchar_t /*wchControl*/) override { actions++; }
+        void Print(const wchar_t /*wchPrintable*/) override { actions++; }
+        void PrintString(const std::wstring_view /*string*/) override { actions++; }
+
+        bool CursorUp(const unsigned int /*uiDistance*/) override { return _Count(); }
+        bool CursorDown(const unsigned int /*uiDistance*/) override { return _Count(); }
+        bool CursorPosition(const unsigned int /*uiLine*/, const unsigned int /*uiColumn*/) override { return _Count(); }
+        bool CursorSavePosition() override { return _Count(); }
+        bool CursorRestorePosition() override { return _Count(); }
+        bool CursorVisibility(const bool /*fIsVisible*/) override { return _Count(); }
+        bool EraseInDisplay(const DispatchTypes::EraseType /*eraseType*/) override { return _Count(); }
+        bool EraseInLine(const DispatchTypes::EraseType /*eraseType*/) override { return _Count(); }
+        bool SetGraphicsRendition(_In_reads_(_Param_(2)) const DispatchTypes::GraphicsOptions* const /*rgOptions*/,
+                                  const size_t /*cOptions*/) override { return _Count(); }
+        bool SetTopBottomScrollingMargins(const SHORT /*sTopMargin*/, const SHORT /*sBottomMargin*/) override { return _Count(); }
+        bool ReverseLineFeed() override { return _Count(); }
+
+        size_t actions = 0;
+
+    private:
+        bool _Count()
+        {
+            actions++;
+            return true;
+        }
+    };
+
+    // The input engine's sink. Accepts everything so parse failures don't
+    // fall back to the pass-through path and distort the numbers.
+    class CountingInteractDispatch final : public IInteractDispatch
+    {
+    public:
+        bool WriteInput(_In_ std::deque<std::unique_ptr<IInputEvent>>& /*inputEvents*/) override { return _Count(); }
+        bool WriteCtrlC() override { return _Count(); }
+        bool WriteString(_In_reads_(cch) const wchar_t* const /*pws*/, const size_t /*cch*/) override { return _Count(); }
+        bool WindowManipulation(const DispatchTypes::WindowManipulationType /*uiFunction*/,
+                                _In_reads_(cParams) const unsigned short* const /*rgusParams*/,
+                                const size_t /*cParams*/) override { return _Count(); }
+        bool MoveCursor(const unsigned int /*row*/, const unsigned int /*col*/) override { return _Count(); }
+
+        size_t actions = 0;
+
+    private:
+        bool _Count()
+        {
+            actions++;
+            return true;
+        }
+    };
+
+    double s_NsPerQpcTick()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return 1.0e9 / static_cast<double>(frequency.QuadPart);
+    }
+
+    // Routine Description:
+    // - Replays one corpus through a state machine and prints a report line.
+    // - One untimed pass warms caches, then `iterations` timed passes. We
+    //   report medians so a descheduled pass doesn't skew per-commit numbers.
+    // Arguments:
+    // - name - Stable corpus identifier printed in the report
+    // - machine - The state machine (and engine) under test
+    // - corpus - The byte stream to replay each pass
+    // - actions - The engine sink's action counter, reset around each pass
+    void s_RunReplay(const wchar_t* const name,
+                     StateMachine& machine,
+                     const std::wstring& corpus,
+                     size_t& actions)
+    {
+        static const double nsPerTick = s_NsPerQpcTick();
+        const size_t iterations = 20;
+        const double cbCorpus = static_cast<double>(corpus.size() * sizeof(wchar_t));
+
+        machine.ProcessString(corpus.c_str(), corpus.size());
+
+        std::vector<double> mbPerSecond;
+        std::vector<double> actionsPerSecond;
+        mbPerSecond.reserve(iterations);
+        actionsPerSecond.reserve(iterations);
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            actions = 0;
+            LARGE_INTEGER start;
+            LARGE_INTEGER stop;
+            QueryPerformanceCounter(&start);
+            machine.ProcessString(corpus.c_str(), corpus.size());
+            QueryPerformanceCounter(&stop);
+
+            const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) * nsPerTick / 1.0e9;
+            mbPerSecond.push_back(cbCorpus / (1024.0 * 1024.0) / seconds);
+            actionsPerSecond.push_back(static_cast<double>(actions) / seconds);
+        }
+
+        std::sort(mbPerSecond.begin(), mbPerSecond.end());
+        std::sort(actionsPerSecond.begin(), actionsPerSecond.end());
+        wprintf(L"%-32s\t%zu\t%.1f\t%.0f\n",
+                name,
+                corpus.size() * sizeof(wchar_t),
+                mbPerSecond[mbPerSecond.size() / 2],
+                actionsPerSecond[actionsPerSecond.size() / 2]);
+    }
+
+    // A 50-row pane scrolling through a source file: vim repositions the
+    // cursor, clears the line, and repaints it with a couple of syntax
+    // highlight spans. Mostly short prints between CSI sequences.
+    std::wstring s_BuildVimScrollCorpus()
+    {
+        std::wstring corpus;
+        for (size_t frame = 0; frame < 200; ++frame)
+        {
+            for (size_t row = 1; row <= 50; ++row)
+            {
+                wchar_t prefix[32];
+                swprintf_s(prefix, L"\x1b[%zu;1H\x1b[K", row);
+                corpus.append(prefix);
+                corpus.append(L"\x1b[34mstatic\x1b[0m int s_Function");
+                corpus.append(std::wstring(1, static_cast<wchar_t>(L'A' + (frame + row) % 26)));
+                corpus.append(L"(const size_t cch); \x1b[32m// comment\x1b[0m");
+            }
+            corpus.append(L"\x1b[50;1H");
+        }
+        return corpus;
+    }
+
+    // A build log: long plain-text lines ended by CRLF, with the progress
+    // line overwritten in place. Almost entirely printable runs, which is
+    // the shape the ground-state scan is optimized for.
+    std::wstring s_BuildNinjaOutputCorpus()
+    {
+        std::wstring corpus;
+        for (size_t line = 0; line < 10000; ++line)
+        {
+            wchar_t prefix[32];
+            swprintf_s(prefix, L"[%zu/10000] ", line + 1);
+            corpus.append(L"\r\x1b[K");
+            corpus.append(prefix);
+            corpus.append(L"CXX obj/terminal/parser/stateMachine_unity_0.cpp.obj");
+            if (line % 100 == 0)
+            {
+                corpus.append(L"\r\n\x1b[33mwarning\x1b[0m: unused variable 'cchConsumed'\r\n");
+            }
+        }
+        return corpus;
+    }
+
+    // A full-screen repaint: tmux hides the cursor, walks every row, and
+    // toggles reverse video per status cell. CSI-dense with tiny prints,
+    // which stresses sequence dispatch rather than the printable scan.
+    std::wstring s_BuildTmuxRedrawCorpus()
+    {
+        std::wstring corpus;
+        for (size_t frame = 0; frame < 100; ++frame)
+        {
+            corpus.append(L"\x1b[?25l\x1b" L"7");
+            for (size_t row = 1; row <= 50; ++row)
+            {
+                wchar_t prefix[32];
+                swprintf_s(prefix, L"\x1b[%zu;1H", row);
+                corpus.append(prefix);
+                for (size_t cell = 0; cell < 10; ++cell)
+                {
+                    corpus.append((cell & 1) ? L"\x1b[7m" : L"\x1b[27m");
+                    corpus.append(L"status-c");
+                }
+            }
+            corpus.append(L"\x1b" L"8\x1b[?25h");
+        }
+        return corpus;
+    }
+
+    // Interactive input: bursts of typed characters between cursor key and
+    // function key sequences, the way a terminal feeds the input engine.
+    std::wstring s_BuildKeyboardInputCorpus()
+    {
+        std::wstring corpus;
+        for (size_t burst = 0; burst < 20000; ++burst)
+        {
+            corpus.append(L"git status");
+            corpus.append(L"\x1b[A\x1b[B\x1b[C\x1b[D");
+            corpus.append(L"\x1bOP\x1b[3~");
+            corpus.append(L"\r");
+        }
+        return corpus;
+    }
+}
+
+int __cdecl wmain(int /*argc*/, wchar_t** /*argv*/)
+{
+    wprintf(L"%-32s\t%s\t%s\t%s\n", L"corpus", L"bytes", L"MB/s", L"actions/s");
+
+    {
+        CountingDispatch* dispatch = new CountingDispatch;
+        StateMachine machine(new OutputStateMachineEngine(dispatch));
+
+        s_RunReplay(L"output/vim-scroll", machine, s_BuildVimScrollCorpus(), dispatch->actions);
+        s_RunReplay(L"output/ninja-build", machine, s_BuildNinjaOutputCorpus(), dispatch->actions);
+        s_RunReplay(L"output/tmux-redraw", machine, s_BuildTmuxRedrawCorpus(), dispatch->actions);
+    }
+
+    {
+        CountingInteractDispatch* dispatch = new CountingInteractDispatch;
+        StateMachine machine(new InputStateMachineEngine(dispatch));
+
+        s_RunReplay(L"input/keyboard", machine, s_BuildKeyboardInputCorpus(), dispatch->actions);
+    }
+
+    return 0;
+}
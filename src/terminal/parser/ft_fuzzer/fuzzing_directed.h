@@ -253,7 +253,7 @@ namespace fuzz
         template<class _Type>
         static _Type GetRandom(__in _Type tMin, __in _Type tMax)
         {
-            std::mt19937 engine(m_rd()); // Mersenne twister MT19937
+            std::mt19937 engine(NextEngineSeed()); // Mersenne twister MT19937
             std::uniform_int_distribution<_Type> distribution(tMin, tMax);
             auto generator = std::bind(distribution, engine);
             return generator();
@@ -265,7 +265,7 @@ namespace fuzz
         template<>
         static BYTE GetRandom(__in BYTE tMin, __in BYTE tMax)
         {
-            std::mt19937 engine(m_rd()); // Mersenne twister MT19937
+            std::mt19937 engine(NextEngineSeed()); // Mersenne twister MT19937
             // BYTE is unsiged, so we want to also use an unsigned type to avoid sign
             // extension of tMin and tMax.
             std::uniform_int_distribution<unsigned short> distribution(tMin, tMax);
@@ -298,13 +298,39 @@ namespace fuzz
             return rg[GetRandom<size_t>(_cElems)];
         }
 
+        // Pins all randomness to a deterministic sequence derived from the
+        // given seed.  Every GetRandom call afterwards draws its engine seed
+        // from this sequence instead of the hardware random device, so a
+        // fuzz run (and any corpus it generates) can be replayed exactly.
+        static void SetSeed(__in unsigned int seed) throw()
+        {
+            m_pinnedSequence.seed(seed);
+            m_fPinned = true;
+        }
+
+        // Returns to the default non-deterministic behavior.
+        static void ClearSeed() throw()
+        {
+            m_fPinned = false;
+        }
+
     private:
         CFuzzChance() {}
         virtual ~CFuzzChance() {}
+
+        static unsigned int NextEngineSeed() throw()
+        {
+            return m_fPinned ? m_pinnedSequence() : m_rd();
+        }
+
         static std::random_device m_rd;
+        static std::mt19937 m_pinnedSequence;
+        static bool m_fPinned;
     };
 
     std::random_device CFuzzChance::m_rd;
+    std::mt19937 CFuzzChance::m_pinnedSequence;
+    bool CFuzzChance::m_fPinned = false;
 
     // Provides a common base class between CFuzzArray and CFuzzType,
     // collecting the set of members that are used by both classes.  This
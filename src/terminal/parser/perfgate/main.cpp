@@ -0,0 +1,344 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Performance regression gate for the VT output path.
+//
+// Replays pinned corpora - generated by the ft_fuzzer directed token
+// generators running at fixed seeds - through StateMachine and
+// OutputStateMachineEngine, and enforces two budgets per corpus:
+//
+//   * throughput, as a fraction of this machine's memcpy bandwidth, so the
+//     floor travels with the hardware the gate happens to run on; and
+//   * heap allocations per steady-state pass, counted by a global
+//     operator new hook, which is machine-independent and exact.
+//
+// The exit code is nonzero when any budget is missed, so a CI step running
+// this binary fails the build on regression. Run with --record after an
+// intentional perf change to print measured values in table-initializer
+// form, then refresh the budgets below with roughly 3x headroom.
+//
+// The corpora are pinned by seeding CFuzzChance: the same seed always
+// produces the same token stream, so budget comparisons are apples to
+// apples across commits.
+
+#include "precomp.h"
+
+#include "..\stateMachine.hpp"
+#include "..\OutputStateMachineEngine.hpp"
+#include "..\..\adapter\termDispatch.hpp"
+
+#include "..\ft_fuzzer\fuzzing_directed.h"
+#include "..\ft_fuzzer\string_helper.h"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+// Every allocation made through the global operator new lands here,
+// including the ones inside the parser and engine under test. Passes diff
+// the counter around the replay, so corpus construction isn't charged.
+static size_t g_cAllocations = 0;
+
+void* operator new(size_t size)
+{
+    g_cAllocations++;
+    void* const p = malloc(size);
+    if (!p)
+    {
+        throw std::bad_alloc{};
+    }
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t /*size*/) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p, size_t /*size*/) noexcept
+{
+    free(p);
+}
+
+namespace
+{
+    // Swallows dispatched actions so the gate times the parser and engine,
+    // not a sink behind them.
+    class NullDispatch final : public TermDispatch
+    {
+    public:
+        void Execute(const wchar_t /*wchControl*/) override {}
+        void Print(const wchar_t /*wchPrintable*/) override {}
+        void PrintString(const std::wstring_view /*string*/) override {}
+    };
+
+    // Directed token generators, modeled on the VTCommandFuzzer set but
+    // weighted toward well-formed sequences: the gate measures the fast
+    // paths a real stream exercises, while the fuzzer's job is to wander
+    // off them.
+    std::string s_GenerateTextToken()
+    {
+        std::string s;
+        const SHORT cch = fuzz::CFuzzChance::GetRandom<SHORT>(1, 60);
+        for (SHORT i = 0; i < cch; i++)
+        {
+            s.push_back(static_cast<char>(fuzz::CFuzzChance::GetRandom<BYTE>(0x20, 0x7e)));
+        }
+        return s;
+    }
+
+    std::string s_GenerateSGRToken()
+    {
+        std::string s("\x1b[");
+        const SHORT cParams = fuzz::CFuzzChance::GetRandom<SHORT>(1, 5);
+        for (SHORT i = 0; i < cParams; i++)
+        {
+            static const BYTE rgOptions[]{ 0, 1, 4, 7, 30, 31, 32, 33, 34, 35, 36, 37, 39, 49, 90, 97 };
+            AppendFormat(s, (i > 0) ? ";%d" : "%d", fuzz::CFuzzChance::SelectOne(rgOptions));
+        }
+        s.push_back('m');
+        return s;
+    }
+
+    std::string s_GenerateCursorToken()
+    {
+        std::string s;
+        static const char rgShapes[]{ 'A', 'B', 'C', 'D', 'H' };
+        const char chFinal = fuzz::CFuzzChance::SelectOne(rgShapes);
+        if (chFinal == 'H')
+        {
+            AppendFormat(s,
+                         "\x1b[%d;%dH",
+                         fuzz::CFuzzChance::GetRandom<BYTE>(1, 50),
+                         fuzz::CFuzzChance::GetRandom<BYTE>(1, 120));
+        }
+        else
+        {
+            AppendFormat(s, "\x1b[%d%c", fuzz::CFuzzChance::GetRandom<BYTE>(1, 20), chFinal);
+        }
+        return s;
+    }
+
+    std::string s_GenerateEraseToken()
+    {
+        std::string s;
+        static const char rgKinds[]{ 'J', 'K' };
+        AppendFormat(s,
+                     "\x1b[%d%c",
+                     fuzz::CFuzzChance::GetRandom<BYTE>(0, 2),
+                     fuzz::CFuzzChance::SelectOne(rgKinds));
+        return s;
+    }
+
+    std::string s_GenerateOscTitleToken()
+    {
+        std::string s("\x1b]0;");
+        const SHORT cch = fuzz::CFuzzChance::GetRandom<SHORT>(1, 30);
+        for (SHORT i = 0; i < cch; i++)
+        {
+            s.push_back(static_cast<char>(fuzz::CFuzzChance::GetRandom<BYTE>(0x20, 0x7e)));
+        }
+        s.push_back('\x07');
+        return s;
+    }
+
+    // Routine Description:
+    // - Builds a pinned corpus: the same seed and token count always yield
+    //   the same stream. `textWeight` of every 10 tokens are plain printable
+    //   runs; the rest are control sequences.
+    // Arguments:
+    // - seed - Seed pinning the CFuzzChance sequence
+    // - cTokens - Number of tokens to generate
+    // - textWeight - Out of 10, how many tokens are printable text
+    // Return Value:
+    // - The corpus, widened for StateMachine consumption.
+    std::wstring s_BuildPinnedCorpus(const unsigned int seed, const size_t cTokens, const BYTE textWeight)
+    {
+        fuzz::CFuzzChance::SetSeed(seed);
+
+        std::string narrow;
+        for (size_t i = 0; i < cTokens; i++)
+        {
+            if (fuzz::CFuzzChance::GetRandom<BYTE>(0, 9) < textWeight)
+            {
+                narrow.append(s_GenerateTextToken());
+            }
+            else
+            {
+                static const std::function<std::string()> rgGenerators[]{
+                    s_GenerateSGRToken,
+                    s_GenerateCursorToken,
+                    s_GenerateEraseToken,
+                    s_GenerateOscTitleToken
+                };
+                narrow.append(fuzz::CFuzzChance::SelectOne(rgGenerators)());
+            }
+        }
+
+        fuzz::CFuzzChance::ClearSeed();
+
+        // The generators only emit 7-bit bytes, so widening is a copy.
+        return std::wstring(narrow.begin(), narrow.end());
+    }
+
+    double s_NsPerQpcTick()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return 1.0e9 / static_cast<double>(frequency.QuadPart);
+    }
+
+    // Routine Description:
+    // - Measures this machine's large-block memcpy bandwidth, which anchors
+    //   the throughput budgets: a floor stated as "at least 1/Nth of copy
+    //   bandwidth" holds on both a dev box and a slow CI VM.
+    // Return Value:
+    // - Median bandwidth over several passes, in MB/s.
+    double s_CalibrateMemcpyMBps()
+    {
+        static const double nsPerTick = s_NsPerQpcTick();
+        const size_t cb = 4 * 1024 * 1024;
+        std::vector<BYTE> source(cb, 0xA5);
+        std::vector<BYTE> destination(cb);
+
+        std::vector<double> passes;
+        for (size_t i = 0; i < 9; i++)
+        {
+            LARGE_INTEGER start;
+            LARGE_INTEGER stop;
+            QueryPerformanceCounter(&start);
+            memcpy(destination.data(), source.data(), cb);
+            QueryPerformanceCounter(&stop);
+
+            const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) * nsPerTick / 1.0e9;
+            passes.push_back(static_cast<double>(cb) / (1024.0 * 1024.0) / seconds);
+        }
+
+        std::sort(passes.begin(), passes.end());
+        return passes[passes.size() / 2];
+    }
+
+    struct GateScenario
+    {
+        const wchar_t* name;
+        unsigned int seed;
+        size_t cTokens;
+        BYTE textWeight;
+
+        // Budgets. Throughput must stay above memcpyMBps / maxSlowdown, and
+        // the cheapest steady-state pass must stay under maxAllocsPerPass.
+        double maxSlowdown;
+        size_t maxAllocsPerPass;
+    };
+
+    // Refresh with --record (3x headroom) when a deliberate change moves the
+    // numbers. The seeds are part of the contract: changing one changes the
+    // corpus and invalidates the budgets next to it.
+    static const GateScenario s_rgScenarios[]{
+        { L"directed/text-heavy", 0xC0FFEE01, 150000, 8, 150.0, 4096 },
+        { L"directed/mixed", 0xC0FFEE02, 150000, 5, 300.0, 8192 },
+        { L"directed/csi-dense", 0xC0FFEE03, 150000, 1, 600.0, 16384 },
+    };
+
+    // Routine Description:
+    // - Replays one pinned corpus and checks it against its budgets.
+    // - One untimed pass warms caches, then 15 timed passes. Throughput is
+    //   judged on the median pass; allocations on the cheapest pass, since
+    //   steady state is what the budget describes and a one-off growth of
+    //   some internal buffer shouldn't trip the gate.
+    // Arguments:
+    // - scenario - The corpus recipe and its budgets
+    // - memcpyMBps - This machine's calibrated copy bandwidth
+    // - fRecord - True to print measured values instead of judging them
+    // Return Value:
+    // - true when within budget (always true when recording).
+    bool s_RunGate(const GateScenario& scenario, const double memcpyMBps, const bool fRecord)
+    {
+        static const double nsPerTick = s_NsPerQpcTick();
+
+        const std::wstring corpus = s_BuildPinnedCorpus(scenario.seed, scenario.cTokens, scenario.textWeight);
+        const double cbCorpus = static_cast<double>(corpus.size() * sizeof(wchar_t));
+
+        NullDispatch* dispatch = new NullDispatch;
+        StateMachine machine(new OutputStateMachineEngine(dispatch));
+
+        machine.ProcessString(corpus.c_str(), corpus.size());
+
+        std::vector<double> mbPerSecond;
+        size_t cAllocsBest = SIZE_MAX;
+        for (size_t i = 0; i < 15; i++)
+        {
+            const size_t cAllocsBefore = g_cAllocations;
+            LARGE_INTEGER start;
+            LARGE_INTEGER stop;
+            QueryPerformanceCounter(&start);
+            machine.ProcessString(corpus.c_str(), corpus.size());
+            QueryPerformanceCounter(&stop);
+
+            const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) * nsPerTick / 1.0e9;
+            mbPerSecond.push_back(cbCorpus / (1024.0 * 1024.0) / seconds);
+            cAllocsBest = std::min(cAllocsBest, g_cAllocations - cAllocsBefore);
+        }
+
+        std::sort(mbPerSecond.begin(), mbPerSecond.end());
+        const double median = mbPerSecond[mbPerSecond.size() / 2];
+        const double floor = memcpyMBps / scenario.maxSlowdown;
+
+        if (fRecord)
+        {
+            wprintf(L"{ L\"%s\", 0x%08X, %zu, %d, %.1f, %zu },\n",
+                    scenario.name,
+                    scenario.seed,
+                    scenario.cTokens,
+                    scenario.textWeight,
+                    memcpyMBps / median,
+                    cAllocsBest);
+            return true;
+        }
+
+        const bool fTimeOk = median >= floor;
+        const bool fAllocOk = cAllocsBest <= scenario.maxAllocsPerPass;
+
+        wprintf(L"%-24s\t%.1f MB/s (floor %.1f)\t%zu allocs (budget %zu)\t%s\n",
+                scenario.name,
+                median,
+                floor,
+                cAllocsBest,
+                scenario.maxAllocsPerPass,
+                (fTimeOk && fAllocOk) ? L"PASS" : L"FAIL");
+
+        return fTimeOk && fAllocOk;
+    }
+}
+
+int __cdecl wmain(int argc, wchar_t** argv)
+{
+    const bool fRecord = (argc > 1) && (wcscmp(argv[1], L"--record") == 0);
+
+    const double memcpyMBps = s_CalibrateMemcpyMBps();
+    if (!fRecord)
+    {
+        wprintf(L"calibration: memcpy %.0f MB/s\n", memcpyMBps);
+    }
+
+    bool fAllPassed = true;
+    for (const auto& scenario : s_rgScenarios)
+    {
+        fAllPassed = s_RunGate(scenario, memcpyMBps, fRecord) && fAllPassed;
+    }
+
+    return fAllPassed ? 0 : 1;
+}
@@ -6,6 +6,15 @@
 #include "stateMachine.hpp"
 
 #include "ascii.hpp"
+#include "../../inc/AllocAccounting.hpp"
+
+// The ground-state scan below uses SSE2 on x86/x64 (part of the baseline for
+// those architectures). Other architectures take the scalar path.
+#if defined(_M_X64) || defined(_M_IX86)
+#define STATEMACHINE_VECTORIZED_SCAN 1
+#include <emmintrin.h>
+#include <intrin.h>
+#endif
 
 using namespace Microsoft::Console::VirtualTerminal;
 
@@ -54,6 +63,57 @@ bool StateMachine::s_IsActionableFromGround(const wchar_t wch)
     return (wch <= AsciiChars::US) || s_IsC1Csi(wch) || s_IsDelete(wch);
 }
 
+// Routine Description:
+// - Measures the printable span at the front of the given range: characters
+//   that are not actionable from the ground state and can therefore be handed
+//   to the engine as a single print run. Vectorized so that megabytes of
+//   plain text don't pay the per-character state dispatch.
+// Arguments:
+// - pwch - Array of characters to scan
+// - cch - Count of characters in the array
+// Return Value:
+// - Count of leading non-actionable characters. 0 if the first character is
+//   actionable, cch if none of them are.
+size_t StateMachine::s_FindActionableFromGround(const wchar_t* const pwch, const size_t cch)
+{
+    size_t i = 0;
+
+#ifdef STATEMACHINE_VECTORIZED_SCAN
+    static_assert(sizeof(wchar_t) == 2, "the vectorized scan walks the string as 16-bit lanes");
+
+    // Control characters below SPC are caught with an unsigned less-than,
+    // built from SSE2's signed compare by biasing both sides by 0x8000.
+    // DEL and the C1 CSI are straight equality checks.
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    const __m128i spaceBiased = _mm_set1_epi16(static_cast<short>(AsciiChars::SPC ^ 0x8000));
+    const __m128i del = _mm_set1_epi16(AsciiChars::DEL);
+    const __m128i csi = _mm_set1_epi16(0x9b);
+    for (; i + 8 <= cch; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pwch + i));
+        __m128i actionable = _mm_cmplt_epi16(_mm_xor_si128(v, bias), spaceBiased);
+        actionable = _mm_or_si128(actionable, _mm_cmpeq_epi16(v, del));
+        actionable = _mm_or_si128(actionable, _mm_cmpeq_epi16(v, csi));
+        const unsigned int mask = _mm_movemask_epi8(actionable);
+        if (mask != 0)
+        {
+            unsigned long bit = 0;
+            _BitScanForward(&bit, mask);
+            return i + bit / 2;
+        }
+    }
+#endif
+
+    for (; i < cch; ++i)
+    {
+        if (s_IsActionableFromGround(pwch[i]))
+        {
+            return i;
+        }
+    }
+    return cch;
+}
+
 // Routine Description:
 // - Determines if a character belongs to the C0 escape range.
 //   This is character sequences less than a space character (null, backspace, new line, etc.)
@@ -1342,6 +1402,9 @@ bool StateMachine::FlushToTerminal()
 // - <none>
 void StateMachine::ProcessString(const wchar_t* const rgwch, const size_t cch)
 {
+    // Charge heap traffic below here to the parser in accounting builds.
+    const AllocScope allocScope(AllocAccounting::Tag::Parser);
+
     _pwchCurr = rgwch;
     _pwchSequenceStart = rgwch;
     _currRunLength = 0;
@@ -1366,25 +1429,30 @@ void StateMachine::ProcessString(const wchar_t* const rgwch, const size_t cch)
         }
         else
         {
-            if (s_IsActionableFromGround(*_pwchCurr)) // If the current char is the start of an escape sequence, or should be executed in ground state...
+            // Skip the whole printable span in front of us in one scan instead
+            // of asking about every character; the span joins the current run.
+            const size_t cchPrintable = s_FindActionableFromGround(_pwchCurr, cchCharsRemaining);
+            if (cchPrintable > 0)
             {
-                FAIL_FAST_IF(!(_pwchSequenceStart + _currRunLength <= rgwch + cch));
-                _pEngine->ActionPrintString(_pwchSequenceStart, _currRunLength); // ... print all the chars leading up to it as part of the run...
-                _trace.DispatchPrintRunTrace(_pwchSequenceStart, _currRunLength);
-                s_fProcessIndividually = true; // begin processing future characters individually...
-                _currRunLength = 0;
-                _pwchSequenceStart = _pwchCurr;
-                ProcessCharacter(*_pwchCurr); // ... Then process the character individually.
-                if (_state == VTStates::Ground) // If the character took us right back to ground, start another run after it.
-                {
-                    s_fProcessIndividually = false;
-                    _pwchSequenceStart = _pwchCurr + 1;
-                    _currRunLength = 0;
-                }
+                _currRunLength += cchPrintable;
+                _pwchCurr += cchPrintable;
+                cchCharsRemaining -= cchPrintable - 1; // the loop decrement covers the last one
+                continue;
             }
-            else
+
+            // The current char is the start of an escape sequence, or should be executed in ground state...
+            FAIL_FAST_IF(!(_pwchSequenceStart + _currRunLength <= rgwch + cch));
+            _pEngine->ActionPrintString({ _pwchSequenceStart, _currRunLength }); // ... print all the chars leading up to it as part of the run...
+            _trace.DispatchPrintRunTrace(_pwchSequenceStart, _currRunLength);
+            s_fProcessIndividually = true; // begin processing future characters individually...
+            _currRunLength = 0;
+            _pwchSequenceStart = _pwchCurr;
+            ProcessCharacter(*_pwchCurr); // ... Then process the character individually.
+            if (_state == VTStates::Ground) // If the character took us right back to ground, start another run after it.
             {
-                _currRunLength++; // Otherwise, add this char to the current run to be printed.
+                s_fProcessIndividually = false;
+                _pwchSequenceStart = _pwchCurr + 1;
+                _currRunLength = 0;
             }
             _pwchCurr++;
         }
@@ -1394,7 +1462,7 @@ void StateMachine::ProcessString(const wchar_t* const rgwch, const size_t cch)
     if (!s_fProcessIndividually && _currRunLength > 0)
     {
         // print the rest of the characters in the string
-        _pEngine->ActionPrintString(_pwchSequenceStart, _currRunLength);
+        _pEngine->ActionPrintString({ _pwchSequenceStart, _currRunLength });
         _trace.DispatchPrintRunTrace(_pwchSequenceStart, _currRunLength);
     }
     else if (s_fProcessIndividually)
@@ -1413,27 +1481,36 @@ void StateMachine::ProcessString(const wchar_t* const rgwch, const size_t cch)
             switch (_state)
             {
             case VTStates::Ground:
-                return _ActionExecute(*pwch);
+                _ActionExecute(*pwch);
+                break;
             case VTStates::Escape:
             case VTStates::EscapeIntermediate:
-                return _ActionEscDispatch(*pwch);
+                _ActionEscDispatch(*pwch);
+                break;
             case VTStates::CsiEntry:
             case VTStates::CsiIntermediate:
             case VTStates::CsiIgnore:
             case VTStates::CsiParam:
-                return _ActionCsiDispatch(*pwch);
+                _ActionCsiDispatch(*pwch);
+                break;
             case VTStates::OscParam:
             case VTStates::OscString:
             case VTStates::OscTermination:
-                return _ActionOscDispatch(*pwch);
+                _ActionOscDispatch(*pwch);
+                break;
             case VTStates::Ss3Entry:
             case VTStates::Ss3Param:
-                return _ActionSs3Dispatch(*pwch);
+                _ActionSs3Dispatch(*pwch);
+                break;
             default:
-                return;
+                break;
             }
         }
     }
+
+    // The chunk is complete - let the engine deliver anything it batched up
+    //      while dispatching it (like accumulated input records).
+    _pEngine->ActionEndOfString();
 }
 
 void StateMachine::ProcessString(const std::wstring& wstr)
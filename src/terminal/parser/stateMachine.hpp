@@ -48,6 +48,7 @@ namespace Microsoft::Console::VirtualTerminal
 
     private:
         static bool s_IsActionableFromGround(const wchar_t wch);
+        static size_t s_FindActionableFromGround(const wchar_t* const pwch, const size_t cch);
         static bool s_IsC0Code(const wchar_t wch);
         static bool s_IsC1Csi(const wchar_t wch);
         static bool s_IsIntermediate(const wchar_t wch);
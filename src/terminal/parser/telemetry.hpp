@@ -87,8 +87,56 @@ namespace Microsoft::Console::VirtualTerminal
             // Only use this last enum as a count of the number of codes.
             NUMBER_OF_CODES
         };
-        void Log(const Codes code);
-        void LogFailed(const wchar_t wch);
+        // Routine Description:
+        // - Logs the usage of a particular VT100 code.
+        // - Defined inline, and elidable with TERMINAL_PARSER_NO_TELEMETRY, so the
+        //      dispatch hot loop pays two increments at most and nothing in
+        //      perf-critical builds. The counters are only touched from the thread
+        //      that owns the state machine, so no synchronization is needed.
+        // Arguments:
+        // - code - VT100 code.
+        // Return Value:
+        // - <none>
+        void Log(const Codes code) noexcept
+        {
+#ifndef TERMINAL_PARSER_NO_TELEMETRY
+            // Initially we wanted to pass over a string (ex. "CUU") and use a dictionary data type to hold the counts.
+            // However we would have to search through the dictionary every time we called this method, so we decided
+            // to use an array which has very quick access times.
+            // The downside is we have to create an enum type, and then convert them to strings when we finally
+            // send out the telemetry, but the upside is we should have very good performance.
+            _uiTimesUsed[code]++;
+            _uiTimesUsedCurrent++;
+#else
+            UNREFERENCED_PARAMETER(code);
+#endif
+        }
+
+        // Routine Description:
+        // - Logs a particular VT100 escape code failed or was unsupported.
+        // Arguments:
+        // - wch - escape code.
+        // Return Value:
+        // - <none>
+        void LogFailed(const wchar_t wch) noexcept
+        {
+#ifndef TERMINAL_PARSER_NO_TELEMETRY
+            if (wch > CHAR_MAX)
+            {
+                _uiTimesFailedOutsideRange++;
+                _uiTimesFailedOutsideRangeCurrent++;
+            }
+            else
+            {
+                // Even though we pass over a wide character, we only care about the ASCII single byte character.
+                _uiTimesFailed[wch]++;
+                _uiTimesFailedCurrent++;
+            }
+#else
+            UNREFERENCED_PARAMETER(wch);
+#endif
+        }
+
         void SetShouldWriteFinalLog(const bool writeLog);
         void SetActivityId(const GUID* activityId);
         unsigned int GetAndResetTimesUsedCurrent();
@@ -44,7 +44,7 @@ public:
     {
     }
 
-    virtual void PrintString(const wchar_t* const /*rgwch*/, const size_t /*cch*/) override
+    virtual void PrintString(const std::wstring_view /*string*/) override
     {
     }
 };
@@ -608,7 +608,7 @@ public:
     {
     }
 
-    virtual void PrintString(const wchar_t* const /*rgwch*/, const size_t /*cch*/) override
+    virtual void PrintString(const std::wstring_view /*string*/) override
     {
     }
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT license.
 
 #include <windows.h>
+#include <psapi.h>
 #include <wil\Common.h>
 #include <wil\result.h>
 #include <wil\resource.h>
@@ -18,31 +19,166 @@
 #include <assert.h>
 
 using namespace std;
+
+// An automated resize stress benchmark against the attached conhost. It runs
+//      scripted sequences of buffer/window resizes - a simulated edge drag, a
+//      maximize/restore cycle, and a conpty-style resize storm - timing each
+//      resize call from the client side (the call doesn't return until the
+//      host's ResizeWithReflow/ResizeTraditional has finished) and reporting
+//      the conhost's peak working set. These are the baseline numbers for the
+//      incremental-reflow work. Run it in a conhost window with "Wrap text
+//      output on resize" enabled to measure the reflow path, or with wrapping
+//      off (or under conpty) for the traditional path.
+
 ////////////////////////////////////////////////////////////////////////////////
 // State
 HANDLE hOut;
 HANDLE hIn;
+wil::unique_handle hConhost;
+LARGE_INTEGER qpcFrequency;
+
+struct ResizeStats
+{
+    double totalMs = 0.0;
+    double minMs = 0.0;
+    double maxMs = 0.0;
+    int count = 0;
+
+    void accumulate(const double ms)
+    {
+        totalMs += ms;
+        minMs = (count == 0) ? ms : min(minMs, ms);
+        maxMs = max(maxMs, ms);
+        count++;
+    }
+};
+
+// Finds the process hosting our console, so we can report its memory - the
+//      resize work we're timing happens over there, not in this client. The
+//      window-owner trick doesn't work for a headless conhost; then we just
+//      skip the memory report.
+void openConhost()
+{
+    HWND const hwnd = GetConsoleWindow();
+    if (hwnd != nullptr)
+    {
+        DWORD dwConhostPid = 0;
+        GetWindowThreadProcessId(hwnd, &dwConhostPid);
+        if (dwConhostPid != 0)
+        {
+            hConhost.reset(OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ, FALSE, dwConhostPid));
+        }
+    }
+}
+
+size_t conhostPeakWorkingSetKb()
+{
+    PROCESS_MEMORY_COUNTERS pmc = { 0 };
+    pmc.cb = sizeof(pmc);
+    if (hConhost && GetProcessMemoryInfo(hConhost.get(), &pmc, sizeof(pmc)))
+    {
+        return pmc.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+}
+
+// Fills the buffer with numbered lines longer than any width we'll resize
+//      down to, so every width change has wrapped rows to reflow.
+void fillBuffer(const int lines)
+{
+    for (int i = 0; i < lines; i++)
+    {
+        printf("%05d ", i);
+        for (int j = 0; j < 20; j++)
+        {
+            printf("the quick brown fox jumps over the lazy dog ");
+        }
+        printf("\n");
+    }
+}
+
+// One buffer+window resize, returning how long the host took to service it
+//      in milliseconds. SetConsoleScreenBufferInfoEx changes the buffer width
+//      (which is what triggers the reflow) and the window together, and only
+//      returns once the host is done - so the wall time around the call is
+//      one complete resize cycle.
+double timeResize(const short width, const short height)
+{
+    CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
+    csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
+    THROW_LAST_ERROR_IF(!GetConsoleScreenBufferInfoEx(hOut, &csbiex));
+
+    // Keep the scrollback height; only the width forces a reflow.
+    csbiex.dwSize.X = width;
+    csbiex.srWindow.Left = 0;
+    csbiex.srWindow.Right = width; // srWindow is exclusive when setting
+    csbiex.srWindow.Top = max(0, csbiex.srWindow.Bottom - height);
+
+    LARGE_INTEGER qpcStart;
+    LARGE_INTEGER qpcEnd;
+    QueryPerformanceCounter(&qpcStart);
+    THROW_LAST_ERROR_IF(!SetConsoleScreenBufferInfoEx(hOut, &csbiex));
+    QueryPerformanceCounter(&qpcEnd);
 
-std::string csi(std::string seq)
+    return (qpcEnd.QuadPart - qpcStart.QuadPart) * 1000.0 / qpcFrequency.QuadPart;
+}
+
+void printStats(const char* const pszScenario, const ResizeStats& stats)
 {
-    std::string fullSeq = "\x1b[";
-    fullSeq += seq;
-    return fullSeq;
+    printf("%-18s %5d resizes  total %9.2fms  avg %7.3fms  min %7.3fms  max %7.3fms\n",
+           pszScenario,
+           stats.count,
+           stats.totalMs,
+           stats.count > 0 ? stats.totalMs / stats.count : 0.0,
+           stats.minMs,
+           stats.maxMs);
 }
 
-void printCSI(std::string seq)
+// Scenario: a user dragging the window edge - the width walks down one
+//      column at a time and back up, reflowing the whole buffer every step.
+ResizeStats runDrag(const short startWidth, const short height)
 {
-    printf("%s", csi(seq).c_str()); // save cursor
+    ResizeStats stats;
+    short const narrowest = max(20, startWidth / 2);
+    for (short w = startWidth - 1; w >= narrowest; w--)
+    {
+        stats.accumulate(timeResize(w, height));
+    }
+    for (short w = narrowest + 1; w <= startWidth; w++)
+    {
+        stats.accumulate(timeResize(w, height));
+    }
+    return stats;
 }
 
-void printCUP(int x, int y)
+// Scenario: maximize/restore cycling - alternating between the starting size
+//      and a large one, the biggest single reflows a user commonly causes.
+ResizeStats runMaximizeRestore(const short startWidth, const short startHeight, const int cycles)
 {
-    printf("\x1b[%d;%dH", y + 1, x + 1); // save cursor
+    ResizeStats stats;
+    short const maxWidth = 200;
+    short const maxHeight = 70;
+    for (int i = 0; i < cycles; i++)
+    {
+        stats.accumulate(timeResize(maxWidth, maxHeight));
+        stats.accumulate(timeResize(startWidth, startHeight));
+    }
+    return stats;
 }
 
-void print256color(int bg)
+// Scenario: a conpty resize storm - random dimensions in rapid succession,
+//      the pattern a terminal sends while its window corner is being flung
+//      around or a pane layout animates.
+ResizeStats runStorm(const int resizes)
 {
-    printf("\x1b[48;5;%dm", bg); // save cursor
+    ResizeStats stats;
+    for (int i = 0; i < resizes; i++)
+    {
+        short const w = static_cast<short>(40 + (rand() % 160));
+        short const h = static_cast<short>(10 + (rand() % 60));
+        stats.accumulate(timeResize(w, h));
+    }
+    return stats;
 }
 
 // bin\x64\Debug\buffersize.exe
@@ -51,53 +187,56 @@ int __cdecl wmain(int /*argc*/, WCHAR* /*argv[]*/)
     hOut = GetStdHandle(STD_OUTPUT_HANDLE);
     hIn = GetStdHandle(STD_INPUT_HANDLE);
 
+    srand(static_cast<unsigned int>(time(nullptr)));
+    QueryPerformanceFrequency(&qpcFrequency);
+    openConhost();
+
     DWORD dwMode = 0;
     THROW_LAST_ERROR_IF(!GetConsoleMode(hOut, &dwMode));
     dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
     dwMode |= DISABLE_NEWLINE_AUTO_RETURN;
-    // THROW_LAST_ERROR_IF_FALSE(SetConsoleMode(hOut, dwMode));
     SetConsoleMode(hOut, dwMode);
-    // the resize event doesn't actually have the info we want.
+
     CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
     csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
-    bool fSuccess = !!GetConsoleScreenBufferInfoEx(hOut, &csbiex);
-    if (fSuccess)
-    {
-        SMALL_RECT srViewport = csbiex.srWindow;
-        short width = srViewport.Right - srViewport.Left + 1;
-        short height = srViewport.Bottom - srViewport.Top + 1;
-
-        std::string topBorder = std::string(width, '-');
-        std::string bottomBorder = std::string(width, '=');
-
-        int color = 17;
-        int const colorStep = 1;
-        printf("Buffer size is wxh=%dx%d\n", width, height);
-        printCSI("s"); // save cursor
-        printCSI("H"); // Go Home
-        print256color(color);
-        color += colorStep;
-        printf("%s", topBorder.c_str());
-        printCUP(0, height - 1);
-        print256color(color);
-        color += colorStep;
-        printf("%s", bottomBorder.c_str());
-
-        for (int y = 1; y < height - 1; y++)
-        {
-            printCUP(0, y);
-            print256color(color);
-            color += colorStep;
-            printf("L");
-
-            printCUP(width - 1, y);
-            print256color(color);
-            color += colorStep;
-            printf("R\n");
-        }
+    THROW_LAST_ERROR_IF(!GetConsoleScreenBufferInfoEx(hOut, &csbiex));
+    SMALL_RECT const srViewport = csbiex.srWindow;
+    short const startWidth = srViewport.Right - srViewport.Left + 1;
+    short const startHeight = srViewport.Bottom - srViewport.Top + 1;
+    COORD const originalSize = csbiex.dwSize;
+
+    printf("Window is wxh=%dx%d, buffer is %dx%d\n",
+           startWidth,
+           startHeight,
+           csbiex.dwSize.X,
+           csbiex.dwSize.Y);
+
+    printf("Filling the buffer with wrapped lines...\n");
+    fillBuffer(500);
+
+    size_t const peakBeforeKb = conhostPeakWorkingSetKb();
 
-        printCSI("u"); // restore cursor
-        printCSI("m"); // restore color
+    ResizeStats const dragStats = runDrag(startWidth, startHeight);
+    printStats("drag", dragStats);
+
+    ResizeStats const maxRestoreStats = runMaximizeRestore(startWidth, startHeight, 10);
+    printStats("maximize/restore", maxRestoreStats);
+
+    ResizeStats const stormStats = runStorm(100);
+    printStats("resize storm", stormStats);
+
+    // Put the console back the way we found it.
+    timeResize(originalSize.X, startHeight);
+
+    if (hConhost)
+    {
+        printf("conhost peak working set: %zuKB before, %zuKB after\n",
+               peakBeforeKb,
+               conhostPeakWorkingSetKb());
+    }
+    else
+    {
+        printf("conhost peak working set: unavailable (headless console)\n");
     }
 
     return 0;
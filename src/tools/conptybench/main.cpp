@@ -0,0 +1,387 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// conptybench: macro benchmark for the conpty pipeline.
+//
+// Stands up a headless conhost in PTY mode (through VtConsole, shared with
+// vtpipeterm), attaches a copy of itself as the client, and has that client
+// blast a recorded VT byte stream to its stdout at maximum rate. The parent
+// drains the conhost's output pipe and reports:
+//
+//   - drain throughput: payload bytes over the time from the first to the
+//     last output byte, so conhost startup is excluded;
+//   - render amplification: bytes the VT renderer emitted per payload byte,
+//     which is the knob the deduplication and batching work moves;
+//   - steady-state memory: the conhost working set and private bytes after
+//     the stream has drained.
+//
+// Where the per-subsystem suites (parser perf gate, buffer benches) time one
+// component in isolation, this measures the whole ingest -> buffer -> VT
+// re-encode pipeline the way a terminal sees it. No window, no interaction:
+// it runs headless in CI and the --csv line is stable for tracking.
+//
+// Usage: conptybench.exe [payload.vt] [-n iterations] [-b syntheticBytes]
+//                        [-w width] [-h height] [--csv]
+//   With no payload file a deterministic synthetic stream (colored text,
+//   SGR runs, newlines) of syntheticBytes is used, so CI needs no fixtures.
+
+#include <windows.h>
+#include <psapi.h>
+#include <strsafe.h>
+#include <wil\Common.h>
+#include <wil\result.h>
+#include <wil\resource.h>
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "..\vtpipeterm\VtConsole.hpp"
+
+namespace
+{
+    VtConsole* g_console = nullptr;
+
+    // Updated by the output pipe callback; read by the measurement loop.
+    // QPC ticks of the first and most recent output bytes, and the running
+    // total. The callback runs on VtConsole's reader thread, so these are
+    // interlocked rather than lock-guarded.
+    volatile LONGLONG g_liFirstOutputQpc = 0;
+    volatile LONGLONG g_liLastOutputQpc = 0;
+    volatile LONGLONG g_cbOutputTotal = 0;
+
+    LONGLONG s_QueryQpc()
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        return li.QuadPart;
+    }
+
+    // Function Description:
+    // - Receives everything the conhost VT renderer emits. The benchmark only
+    //   counts and timestamps it; the bytes themselves are dropped on the
+    //   floor, which makes the parent an infinitely fast terminal and leaves
+    //   conhost as the bottleneck under measurement.
+    // Arguments:
+    // - buffer - the bytes read from the output pipe (unused)
+    // - dwRead - how many bytes arrived
+    void OutputReadCallback(BYTE* /*buffer*/, DWORD dwRead)
+    {
+        const LONGLONG liNow = s_QueryQpc();
+        InterlockedCompareExchange64(const_cast<LONGLONG*>(&g_liFirstOutputQpc), liNow, 0);
+        InterlockedExchange64(const_cast<LONGLONG*>(&g_liLastOutputQpc), liNow);
+        InterlockedAdd64(const_cast<LONGLONG*>(&g_cbOutputTotal), dwRead);
+    }
+
+    // Function Description:
+    // - Builds the deterministic synthetic payload used when no recording is
+    //   given: 80-column lines of text with an SGR color change per line and
+    //   an occasional cursor-home-and-overwrite, which exercises the ingest,
+    //   buffer write, and re-encode paths without needing a fixture file.
+    // Arguments:
+    // - cbTarget - approximate size of the payload to build, in bytes
+    // Return Value:
+    // - the payload stream.
+    std::string BuildSyntheticPayload(const size_t cbTarget)
+    {
+        std::string payload;
+        payload.reserve(cbTarget + 128);
+
+        unsigned int line = 0;
+        while (payload.size() < cbTarget)
+        {
+            char szLine[128];
+            const int color = 31 + (line % 7);
+            // Every 64th line, repaint from the top-left so scrolling isn't
+            // the only thing being measured.
+            if ((line % 64) == 63)
+            {
+                payload.append("\x1b[H");
+            }
+            sprintf_s(szLine,
+                      ARRAYSIZE(szLine),
+                      "\x1b[%dmLine %08u: the quick brown fox jumps over the lazy dog 0123456789\x1b[0m\r\n",
+                      color,
+                      line);
+            payload.append(szLine);
+            line++;
+        }
+
+        return payload;
+    }
+
+    // Function Description:
+    // - Reads a recorded payload from disk.
+    // Arguments:
+    // - pwszPath - path of the recording
+    // - payload - receives the file contents
+    // Return Value:
+    // - true if the file was read.
+    bool ReadPayloadFile(PCWSTR pwszPath, std::string& payload)
+    {
+        wil::unique_hfile file(CreateFileW(pwszPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+        if (!file)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER liSize;
+        if (!GetFileSizeEx(file.get(), &liSize) || liSize.QuadPart <= 0)
+        {
+            return false;
+        }
+
+        payload.resize(static_cast<size_t>(liSize.QuadPart));
+        DWORD dwRead = 0;
+        if (!ReadFile(file.get(), &payload[0], static_cast<DWORD>(payload.size()), &dwRead, nullptr))
+        {
+            return false;
+        }
+        payload.resize(dwRead);
+        return dwRead > 0;
+    }
+
+    // Function Description:
+    // - Client mode, running attached to the pseudoconsole under test. Emits
+    //   the payload to stdout at maximum rate for the requested number of
+    //   iterations and exits. stdout here is the conpty slave, so everything
+    //   written lands in conhost as client text.
+    // Arguments:
+    // - pwszPayloadPath - recording path, or nullptr for synthetic
+    // - cbSynthetic - synthetic payload size when no recording is given
+    // - cIterations - how many times to replay the payload
+    // Return Value:
+    // - process exit code.
+    int EmitClientMain(PCWSTR pwszPayloadPath, const size_t cbSynthetic, const unsigned int cIterations)
+    {
+        std::string payload;
+        if (pwszPayloadPath != nullptr)
+        {
+            if (!ReadPayloadFile(pwszPayloadPath, payload))
+            {
+                return 2;
+            }
+        }
+        else
+        {
+            payload = BuildSyntheticPayload(cbSynthetic);
+        }
+
+        const HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        const DWORD cbChunk = 64 * 1024;
+        for (unsigned int i = 0; i < cIterations; i++)
+        {
+            size_t offset = 0;
+            while (offset < payload.size())
+            {
+                const DWORD cbWrite = static_cast<DWORD>(min(static_cast<size_t>(cbChunk), payload.size() - offset));
+                DWORD cbWritten = 0;
+                if (!WriteFile(hOut, payload.data() + offset, cbWrite, &cbWritten, nullptr))
+                {
+                    return 3;
+                }
+                offset += cbWritten;
+            }
+        }
+
+        return 0;
+    }
+
+    void Usage()
+    {
+        wprintf(L"usage: conptybench.exe [payload.vt] [-n iterations] [-b syntheticBytes]\n");
+        wprintf(L"                       [-w width] [-h height] [--csv]\n");
+        wprintf(L"  payload.vt        recorded VT byte stream to replay as client output.\n");
+        wprintf(L"                    Omitted: a deterministic synthetic stream is used.\n");
+        wprintf(L"  -n iterations     number of times the client replays the payload (default 5)\n");
+        wprintf(L"  -b syntheticBytes size of the synthetic payload (default 4194304)\n");
+        wprintf(L"  -w/-h             conpty dimensions (default 80x32)\n");
+        wprintf(L"  --csv             emit one machine-readable result line for CI tracking\n");
+    }
+}
+
+int __cdecl wmain(int argc, WCHAR* argv[])
+{
+    // Client mode: spawned by the parent below, attached to the conpty.
+    if (argc >= 4 && wcscmp(argv[1], L"--emit") == 0)
+    {
+        const unsigned int cIterations = static_cast<unsigned int>(_wtoi(argv[3]));
+        if (wcscmp(argv[2], L"-") == 0)
+        {
+            const size_t cbSynthetic = argc >= 5 ? static_cast<size_t>(_wtoi64(argv[4])) : 0;
+            return EmitClientMain(nullptr, cbSynthetic, cIterations);
+        }
+        return EmitClientMain(argv[2], 0, cIterations);
+    }
+
+    std::wstring payloadPath;
+    unsigned int cIterations = 5;
+    size_t cbSynthetic = 4 * 1024 * 1024;
+    COORD dimensions = { 80, 32 };
+    bool fCsv = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (wcscmp(argv[i], L"-n") == 0 && i + 1 < argc)
+        {
+            cIterations = static_cast<unsigned int>(_wtoi(argv[++i]));
+        }
+        else if (wcscmp(argv[i], L"-b") == 0 && i + 1 < argc)
+        {
+            cbSynthetic = static_cast<size_t>(_wtoi64(argv[++i]));
+        }
+        else if (wcscmp(argv[i], L"-w") == 0 && i + 1 < argc)
+        {
+            dimensions.X = static_cast<SHORT>(_wtoi(argv[++i]));
+        }
+        else if (wcscmp(argv[i], L"-h") == 0 && i + 1 < argc)
+        {
+            dimensions.Y = static_cast<SHORT>(_wtoi(argv[++i]));
+        }
+        else if (wcscmp(argv[i], L"--csv") == 0)
+        {
+            fCsv = true;
+        }
+        else if (wcscmp(argv[i], L"-?") == 0 || wcscmp(argv[i], L"--help") == 0)
+        {
+            Usage();
+            return 0;
+        }
+        else if (argv[i][0] != L'-')
+        {
+            payloadPath = argv[i];
+        }
+        else
+        {
+            Usage();
+            return 1;
+        }
+    }
+
+    if (cIterations == 0 || dimensions.X <= 0 || dimensions.Y <= 0)
+    {
+        Usage();
+        return 1;
+    }
+
+    // Work out the payload size up front; the throughput and amplification
+    // math needs the exact byte count the client will emit.
+    size_t cbPayload;
+    if (!payloadPath.empty())
+    {
+        std::string payload;
+        if (!ReadPayloadFile(payloadPath.c_str(), payload))
+        {
+            fwprintf(stderr, L"conptybench: failed to read payload '%s'\n", payloadPath.c_str());
+            return 1;
+        }
+        cbPayload = payload.size();
+    }
+    else
+    {
+        cbPayload = BuildSyntheticPayload(cbSynthetic).size();
+    }
+    const ULONGLONG cbTotalInput = static_cast<ULONGLONG>(cbPayload) * cIterations;
+
+    // Build the client command line: this binary again, in emit mode.
+    WCHAR wszSelf[MAX_PATH];
+    THROW_LAST_ERROR_IF(GetModuleFileNameW(nullptr, wszSelf, ARRAYSIZE(wszSelf)) == 0);
+
+    WCHAR wszCommand[MAX_PATH * 2];
+    if (!payloadPath.empty())
+    {
+        THROW_IF_FAILED(StringCchPrintfW(wszCommand, ARRAYSIZE(wszCommand), L"\"%s\" --emit \"%s\" %u", wszSelf, payloadPath.c_str(), cIterations));
+    }
+    else
+    {
+        THROW_IF_FAILED(StringCchPrintfW(wszCommand, ARRAYSIZE(wszCommand), L"\"%s\" --emit - %u %zu", wszSelf, cIterations, cbSynthetic));
+    }
+
+    LARGE_INTEGER liFrequency;
+    QueryPerformanceFrequency(&liFrequency);
+
+    // Headless, no conpty API: the manual path hands back the conhost
+    // PROCESS_INFORMATION, which the memory probe below needs.
+    VtConsole console(OutputReadCallback, true, false, dimensions);
+    g_console = &console;
+    console.spawn(wszCommand);
+    console.activate();
+
+    // Wait for the stream to drain: output has started and then stayed
+    // quiet for a full second. The client exits when it finishes writing,
+    // but conhost keeps rendering until its buffers empty, so quiescence on
+    // the output pipe is the end-of-pipeline signal.
+    const ULONGLONG msQuiesce = 1000;
+    const ULONGLONG msTimeout = 120 * 1000;
+    const ULONGLONG msStart = GetTickCount64();
+    for (;;)
+    {
+        Sleep(50);
+
+        const LONGLONG liLast = InterlockedCompareExchange64(const_cast<LONGLONG*>(&g_liLastOutputQpc), 0, 0);
+        if (liLast != 0)
+        {
+            const LONGLONG liSinceLast = s_QueryQpc() - liLast;
+            if ((liSinceLast * 1000) / liFrequency.QuadPart >= static_cast<LONGLONG>(msQuiesce))
+            {
+                break;
+            }
+        }
+
+        if (GetTickCount64() - msStart > msTimeout)
+        {
+            fwprintf(stderr, L"conptybench: timed out waiting for the output pipe to quiesce\n");
+            return 1;
+        }
+    }
+
+    // Steady-state memory of the conhost under test, probed after the
+    // drain so transient render buffers have settled.
+    PROCESS_MEMORY_COUNTERS_EX memory = { 0 };
+    memory.cb = sizeof(memory);
+    const HANDLE hHost = console.hostProcess();
+    const bool fHaveMemory = hHost != nullptr &&
+                             GetProcessMemoryInfo(hHost, reinterpret_cast<PPROCESS_MEMORY_COUNTERS>(&memory), sizeof(memory));
+
+    const LONGLONG liFirst = g_liFirstOutputQpc;
+    const LONGLONG liLast = g_liLastOutputQpc;
+    const LONGLONG cbOutput = g_cbOutputTotal;
+
+    const double sElapsed = static_cast<double>(liLast - liFirst) / static_cast<double>(liFrequency.QuadPart);
+    const double mbPerSecond = sElapsed > 0.0 ? (static_cast<double>(cbTotalInput) / (1024.0 * 1024.0)) / sElapsed : 0.0;
+    const double outPerIn = cbTotalInput > 0 ? static_cast<double>(cbOutput) / static_cast<double>(cbTotalInput) : 0.0;
+
+    if (fCsv)
+    {
+        // payload bytes, iterations, elapsed ms, input MB/s, output bytes,
+        // output bytes per input byte, working set KB, private KB
+        wprintf(L"%zu,%u,%.1f,%.2f,%lld,%.3f,%zu,%zu\n",
+                cbPayload,
+                cIterations,
+                sElapsed * 1000.0,
+                mbPerSecond,
+                cbOutput,
+                outPerIn,
+                fHaveMemory ? memory.WorkingSetSize / 1024 : 0,
+                fHaveMemory ? memory.PrivateUsage / 1024 : 0);
+    }
+    else
+    {
+        wprintf(L"payload:            %zu bytes x %u iterations (%llu total)\n", cbPayload, cIterations, cbTotalInput);
+        wprintf(L"drain time:         %.1f ms (first output byte to last)\n", sElapsed * 1000.0);
+        wprintf(L"drain throughput:   %.2f MB/s\n", mbPerSecond);
+        wprintf(L"renderer output:    %lld bytes (%.3f per input byte)\n", cbOutput, outPerIn);
+        if (fHaveMemory)
+        {
+            wprintf(L"conhost working set: %zu KB\n", memory.WorkingSetSize / 1024);
+            wprintf(L"conhost private:     %zu KB\n", memory.PrivateUsage / 1024);
+        }
+        else
+        {
+            wprintf(L"conhost memory:      unavailable\n");
+        }
+    }
+
+    return 0;
+}
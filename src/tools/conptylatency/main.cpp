@@ -0,0 +1,330 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// conptylatency: measures where conpty output latency goes.
+//
+// The conpty output path is instrumented with one ETW marker per stage:
+//   1. ConptyClientWrite  (Microsoft.Windows.Console.Host)
+//      - client text entered conhost's WriteCharsLegacy.
+//   2. VtEngine_Frame     (Microsoft.Windows.Console.Render.VtEngine)
+//      - the VT renderer finished encoding a frame for the pipe.
+//   3. ConptyOutputRead   (Microsoft.Windows.Terminal.Connection)
+//      - ConhostConnection pulled the frame off the pipe.
+//   4. TerminalWriteText  (Microsoft.Windows.Terminal.Control)
+//      - TermControl handed the text to the terminal parser.
+//
+// This tool runs a real-time trace session over those four providers and, for
+// each marker, records the time since the most recent marker of the previous
+// stage. That attribution is exact for echo-style workloads (type a key, see
+// it appear) and a reasonable approximation for streaming ones, which is
+// enough to tell which stage is eating the budget.
+//
+// Usage: conptylatency.exe
+//   Generate some terminal traffic, then press Ctrl+C to print the report.
+
+#include <windows.h>
+#include <evntrace.h>
+#include <evntcons.h>
+#include <tdh.h>
+#include <wil\Common.h>
+#include <wil\result.h>
+#include <wil\resource.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // {fe1ff234-1f09-50a8-d38d-c44fab43e818} Microsoft.Windows.Console.Host
+    const GUID ConhostProviderGuid = { 0xfe1ff234, 0x1f09, 0x50a8, { 0xd3, 0x8d, 0xc4, 0x4f, 0xab, 0x43, 0xe8, 0x18 } };
+    // {c9ba2a95-d3ca-5e19-2bd6-776a0910cb9d} Microsoft.Windows.Console.Render.VtEngine
+    const GUID VtRendererProviderGuid = { 0xc9ba2a95, 0xd3ca, 0x5e19, { 0x2b, 0xd6, 0x77, 0x6a, 0x09, 0x10, 0xcb, 0x9d } };
+    // {f62733d0-a6ed-4ef4-9ccc-d8249976695f} Microsoft.Windows.Terminal.Connection
+    const GUID ConnectionProviderGuid = { 0xf62733d0, 0xa6ed, 0x4ef4, { 0x9c, 0xcc, 0xd8, 0x24, 0x99, 0x76, 0x69, 0x5f } };
+    // {20b99b57-f58c-4024-998d-bcbcd3b7ff09} Microsoft.Windows.Terminal.Control
+    const GUID ControlProviderGuid = { 0x20b99b57, 0xf58c, 0x4024, { 0x99, 0x8d, 0xbc, 0xbc, 0xd3, 0xb7, 0xff, 0x09 } };
+
+    // The Output keyword in the conhost provider; ConptyClientWrite is the
+    // only INFO-level event behind it, so the session stays quiet.
+    const ULONGLONG ConhostOutputKeyword = 0x008;
+
+    const wchar_t SessionName[] = L"ConptyLatencySession";
+
+    const size_t StageCount = 4;
+    const wchar_t* const StageEventNames[StageCount] = {
+        L"ConptyClientWrite",
+        L"VtEngine_Frame",
+        L"ConptyOutputRead",
+        L"TerminalWriteText"
+    };
+    const char* const StageBoundaryNames[StageCount] = {
+        "(client write - start of pipeline)",
+        "client write -> vt frame encoded",
+        "vt frame encoded -> pipe read",
+        "pipe read -> parser handoff"
+    };
+
+    struct LatencyStats
+    {
+        LONGLONG lastTimestamp = 0; // QPC ticks; 0 = no marker seen yet
+        std::vector<LONGLONG> samples; // deltas from the previous stage, in QPC ticks
+        ULONGLONG cEvents = 0;
+    };
+
+    LatencyStats g_stages[StageCount];
+    std::vector<LONGLONG> g_endToEnd;
+    LONGLONG g_qpcFrequency = 0;
+    TRACEHANDLE g_hSession = 0;
+    HANDLE g_hStopEvent = nullptr;
+
+    // Function Description:
+    // - Maps an event record to a pipeline stage by provider GUID and
+    //   TraceLogging event name. The conhost and renderer providers carry
+    //   plenty of other events; everything that isn't a marker returns -1.
+    // Arguments:
+    // - pEvent - the event record to classify
+    // Return Value:
+    // - the stage index, or -1 if the event is not one of the markers.
+    int StageFromEvent(PEVENT_RECORD pEvent)
+    {
+        int candidate = -1;
+        if (IsEqualGUID(pEvent->EventHeader.ProviderId, ConhostProviderGuid))
+        {
+            candidate = 0;
+        }
+        else if (IsEqualGUID(pEvent->EventHeader.ProviderId, VtRendererProviderGuid))
+        {
+            candidate = 1;
+        }
+        else if (IsEqualGUID(pEvent->EventHeader.ProviderId, ConnectionProviderGuid))
+        {
+            candidate = 2;
+        }
+        else if (IsEqualGUID(pEvent->EventHeader.ProviderId, ControlProviderGuid))
+        {
+            candidate = 3;
+        }
+
+        if (candidate < 0)
+        {
+            return -1;
+        }
+
+        // TraceLogging events carry their name in the decoding information;
+        // TDH surfaces it through the task name.
+        ULONG cbInfo = 0;
+        if (TdhGetEventInformation(pEvent, 0, nullptr, nullptr, &cbInfo) != ERROR_INSUFFICIENT_BUFFER)
+        {
+            return -1;
+        }
+
+        std::vector<BYTE> buffer(cbInfo);
+        PTRACE_EVENT_INFO pInfo = reinterpret_cast<PTRACE_EVENT_INFO>(buffer.data());
+        if (TdhGetEventInformation(pEvent, 0, nullptr, pInfo, &cbInfo) != ERROR_SUCCESS)
+        {
+            return -1;
+        }
+
+        if (pInfo->TaskNameOffset == 0)
+        {
+            return -1;
+        }
+
+        const wchar_t* pszName = reinterpret_cast<const wchar_t*>(buffer.data() + pInfo->TaskNameOffset);
+        if (wcscmp(pszName, StageEventNames[candidate]) != 0)
+        {
+            return -1;
+        }
+
+        return candidate;
+    }
+
+    void WINAPI EventRecordCallback(PEVENT_RECORD pEvent)
+    {
+        const int stage = StageFromEvent(pEvent);
+        if (stage < 0)
+        {
+            return;
+        }
+
+        const LONGLONG timestamp = pEvent->EventHeader.TimeStamp.QuadPart;
+        LatencyStats& stats = g_stages[stage];
+        stats.cEvents++;
+
+        if (stage > 0 && g_stages[stage - 1].lastTimestamp != 0)
+        {
+            stats.samples.push_back(timestamp - g_stages[stage - 1].lastTimestamp);
+        }
+        if (stage == StageCount - 1 && g_stages[0].lastTimestamp != 0)
+        {
+            g_endToEnd.push_back(timestamp - g_stages[0].lastTimestamp);
+        }
+
+        stats.lastTimestamp = timestamp;
+    }
+
+    BOOL WINAPI CtrlHandler(DWORD dwCtrlType)
+    {
+        if (dwCtrlType == CTRL_C_EVENT || dwCtrlType == CTRL_BREAK_EVENT)
+        {
+            SetEvent(g_hStopEvent);
+            return TRUE;
+        }
+        return FALSE;
+    }
+
+    double TicksToMs(const LONGLONG ticks)
+    {
+        return (ticks * 1000.0) / g_qpcFrequency;
+    }
+
+    // Function Description:
+    // - Prints count and percentile latencies for one stage boundary. The
+    //   samples are sorted in place.
+    void PrintDistribution(const char* pszName, std::vector<LONGLONG>& samples)
+    {
+        if (samples.empty())
+        {
+            printf("%-36s no samples\n", pszName);
+            return;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        const auto percentile = [&](const double p) {
+            const size_t index = std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()));
+            return TicksToMs(samples[index]);
+        };
+
+        printf("%-36s n=%-7zu p50=%8.3fms p90=%8.3fms p99=%8.3fms max=%8.3fms\n",
+               pszName,
+               samples.size(),
+               percentile(0.50),
+               percentile(0.90),
+               percentile(0.99),
+               TicksToMs(samples.back()));
+    }
+
+    [[nodiscard]] HRESULT StartSession()
+    {
+        // The properties struct is followed in memory by the session name.
+        const ULONG cbProperties = sizeof(EVENT_TRACE_PROPERTIES) + sizeof(SessionName);
+        std::vector<BYTE> buffer(cbProperties, 0);
+        PEVENT_TRACE_PROPERTIES pProperties = reinterpret_cast<PEVENT_TRACE_PROPERTIES>(buffer.data());
+        pProperties->Wnode.BufferSize = cbProperties;
+        pProperties->Wnode.Flags = WNODE_FLAG_TRACED_GUID;
+        pProperties->Wnode.ClientContext = 1; // QPC timestamps
+        pProperties->LogFileMode = EVENT_TRACE_REAL_TIME_MODE;
+        pProperties->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+
+        ULONG status = StartTraceW(&g_hSession, SessionName, pProperties);
+        if (status == ERROR_ALREADY_EXISTS)
+        {
+            // A previous run didn't shut down cleanly; stop it and retry.
+            ControlTraceW(0, SessionName, pProperties, EVENT_TRACE_CONTROL_STOP);
+            memset(buffer.data(), 0, cbProperties);
+            pProperties->Wnode.BufferSize = cbProperties;
+            pProperties->Wnode.Flags = WNODE_FLAG_TRACED_GUID;
+            pProperties->Wnode.ClientContext = 1;
+            pProperties->LogFileMode = EVENT_TRACE_REAL_TIME_MODE;
+            pProperties->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+            status = StartTraceW(&g_hSession, SessionName, pProperties);
+        }
+        RETURN_IF_WIN32_ERROR(status);
+
+        const auto enableProvider = [&](const GUID& guid, const ULONGLONG matchAnyKeyword) {
+            return EnableTraceEx2(g_hSession,
+                                  &guid,
+                                  EVENT_CONTROL_CODE_ENABLE_PROVIDER,
+                                  TRACE_LEVEL_INFORMATION,
+                                  matchAnyKeyword,
+                                  0,
+                                  0,
+                                  nullptr);
+        };
+
+        RETURN_IF_WIN32_ERROR(enableProvider(ConhostProviderGuid, ConhostOutputKeyword));
+        RETURN_IF_WIN32_ERROR(enableProvider(VtRendererProviderGuid, 0));
+        RETURN_IF_WIN32_ERROR(enableProvider(ConnectionProviderGuid, 0));
+        RETURN_IF_WIN32_ERROR(enableProvider(ControlProviderGuid, 0));
+        return S_OK;
+    }
+
+    void StopSession()
+    {
+        const ULONG cbProperties = sizeof(EVENT_TRACE_PROPERTIES) + sizeof(SessionName);
+        std::vector<BYTE> buffer(cbProperties, 0);
+        PEVENT_TRACE_PROPERTIES pProperties = reinterpret_cast<PEVENT_TRACE_PROPERTIES>(buffer.data());
+        pProperties->Wnode.BufferSize = cbProperties;
+        pProperties->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+        ControlTraceW(g_hSession, SessionName, pProperties, EVENT_TRACE_CONTROL_STOP);
+    }
+}
+
+int __cdecl wmain(int /*argc*/, WCHAR* /*argv[]*/)
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    g_qpcFrequency = frequency.QuadPart;
+
+    g_hStopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    THROW_LAST_ERROR_IF_NULL(g_hStopEvent);
+
+    const HRESULT hr = StartSession();
+    if (FAILED(hr))
+    {
+        // Trace sessions need elevation or membership in the
+        // Performance Log Users group.
+        printf("Failed to start the trace session (0x%08x). Try an elevated prompt.\n", hr);
+        return 1;
+    }
+
+    EVENT_TRACE_LOGFILEW logFile = { 0 };
+    logFile.LoggerName = const_cast<LPWSTR>(SessionName);
+    logFile.ProcessTraceMode = PROCESS_TRACE_MODE_EVENT_RECORD | PROCESS_TRACE_MODE_REAL_TIME;
+    logFile.EventRecordCallback = EventRecordCallback;
+
+    const TRACEHANDLE hTrace = OpenTraceW(&logFile);
+    if (hTrace == INVALID_PROCESSTRACE_HANDLE)
+    {
+        printf("Failed to open the trace session (%u).\n", GetLastError());
+        StopSession();
+        return 1;
+    }
+
+    // ProcessTrace blocks until the session is stopped, so pump it on its
+    // own thread while we wait for Ctrl+C here.
+    std::thread processingThread([hTrace]() {
+        ProcessTrace(const_cast<PTRACEHANDLE>(&hTrace), 1, nullptr, nullptr);
+    });
+
+    SetConsoleCtrlHandler(CtrlHandler, TRUE);
+    printf("Collecting conpty latency markers. Generate some terminal output,\n"
+           "then press Ctrl+C for the per-stage report.\n");
+    WaitForSingleObject(g_hStopEvent, INFINITE);
+
+    StopSession();
+    processingThread.join();
+    CloseTrace(hTrace);
+
+    printf("\nConpty output pipeline latency (per stage boundary):\n");
+    for (size_t i = 1; i < StageCount; i++)
+    {
+        PrintDistribution(StageBoundaryNames[i], g_stages[i].samples);
+    }
+    PrintDistribution("end to end (client write -> parser)", g_endToEnd);
+
+    printf("\nMarkers seen:\n");
+    for (size_t i = 0; i < StageCount; i++)
+    {
+        printf("  %-20ls %llu\n", StageEventNames[i], g_stages[i].cEvents);
+    }
+    if (g_stages[0].cEvents == 0)
+    {
+        printf("\nNo conhost markers - is the session elevated, and is the target\n"
+               "actually running under conpty?\n");
+    }
+
+    return 0;
+}
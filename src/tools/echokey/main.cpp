@@ -12,6 +12,8 @@
 #include <stdio.h>
 
 #include <string>
+#include <vector>
+#include <algorithm>
 using namespace std;
 
 // WIL
@@ -23,6 +25,8 @@ bool gVtInput = false;
 bool gVtOutput = true;
 bool gWindowInput = false;
 bool gUseAltBuffer = false;
+bool gLatencyMode = false;
+int gLatencyCount = 100;
 
 bool gExitRequested = false;
 
@@ -170,6 +174,127 @@ void handleWindowEvent(WINDOW_BUFFER_SIZE_RECORD windowEvent)
     }
 }
 
+double percentile(const std::vector<double>& sorted, const double p)
+{
+    const size_t index = (size_t)((p / 100.0) * (sorted.size() - 1));
+    return sorted[index];
+}
+
+// Measures input latency end to end: injects keystrokes with SendInput, waits
+// for each to come back out of the console input buffer, echoes it, and then
+// polls the screen buffer until the glyph actually lands in the target cell.
+// The first number is the input path alone (window message -> InputBuffer ->
+// ReadConsoleInput); the second adds the output path (WriteConsole -> screen
+// buffer). This is the path users feel most, so run it before and after
+// touching TerminalInput, the InputBuffer, or the API dispatch.
+void runLatencyTest(const int iterations)
+{
+    LARGE_INTEGER qpcFrequency;
+    QueryPerformanceFrequency(&qpcFrequency);
+
+    std::vector<double> inputMs;
+    std::vector<double> echoMs;
+    inputMs.reserve(iterations);
+    echoMs.reserve(iterations);
+
+    wprintf(L"Measuring end-to-end latency over %d keystrokes...\r\n", iterations);
+    wprintf(L"(keep this window focused - the keys are injected with SendInput)\r\n");
+    Sleep(500);
+
+    for (int i = 0; i < iterations; i++)
+    {
+        const char expected = (char)('a' + (i % 26));
+
+        // Where the echoed glyph will land. Clear it first so a leftover
+        // glyph from a previous lap can't satisfy the poll early.
+        CONSOLE_SCREEN_BUFFER_INFOEX csbiex = { 0 };
+        csbiex.cbSize = sizeof(CONSOLE_SCREEN_BUFFER_INFOEX);
+        if (!GetConsoleScreenBufferInfoEx(g_hOut, &csbiex))
+        {
+            wprintf(L"GetConsoleScreenBufferInfoEx failed, gle=%d\r\n", GetLastError());
+            return;
+        }
+        const COORD target = csbiex.dwCursorPosition;
+        DWORD dwFilled = 0;
+        FillConsoleOutputCharacterA(g_hOut, ' ', 1, target, &dwFilled);
+
+        INPUT inputs[2] = { 0 };
+        inputs[0].type = INPUT_KEYBOARD;
+        inputs[0].ki.wVk = (WORD)(VkKeyScanA(expected) & 0xff);
+        inputs[1] = inputs[0];
+        inputs[1].ki.dwFlags = KEYEVENTF_KEYUP;
+
+        LARGE_INTEGER qpcStart;
+        LARGE_INTEGER qpcInput;
+        LARGE_INTEGER qpcEcho;
+        QueryPerformanceCounter(&qpcStart);
+        if (SendInput(2, inputs, sizeof(INPUT)) != 2)
+        {
+            wprintf(L"SendInput failed, gle=%d (is this window focused?)\r\n", GetLastError());
+            return;
+        }
+
+        // Wait for the keystroke to come back out of the input buffer.
+        bool fGotKey = false;
+        while (!fGotKey)
+        {
+            INPUT_RECORD rc;
+            DWORD dwRead = 0;
+            if (!ReadConsoleInputA(g_hIn, &rc, 1, &dwRead) || dwRead == 0)
+            {
+                return;
+            }
+            if (rc.EventType == KEY_EVENT &&
+                rc.Event.KeyEvent.bKeyDown &&
+                rc.Event.KeyEvent.uChar.AsciiChar == expected)
+            {
+                fGotKey = true;
+            }
+        }
+        QueryPerformanceCounter(&qpcInput);
+
+        // Echo it, then poll the screen buffer until the glyph is there.
+        DWORD dwWritten = 0;
+        WriteConsoleA(g_hOut, &expected, 1, &dwWritten, nullptr);
+        char readBack = '\0';
+        do
+        {
+            DWORD dwReadChars = 0;
+            if (!ReadConsoleOutputCharacterA(g_hOut, &readBack, 1, target, &dwReadChars) || dwReadChars == 0)
+            {
+                wprintf(L"\r\nReadConsoleOutputCharacter failed, gle=%d\r\n", GetLastError());
+                return;
+            }
+        } while (readBack != expected);
+        QueryPerformanceCounter(&qpcEcho);
+
+        inputMs.push_back((qpcInput.QuadPart - qpcStart.QuadPart) * 1000.0 / qpcFrequency.QuadPart);
+        echoMs.push_back((qpcEcho.QuadPart - qpcStart.QuadPart) * 1000.0 / qpcFrequency.QuadPart);
+
+        // Back to column 0 so every lap targets a fresh-cleared cell, and
+        // drain the key-up (and any focus noise) before the next lap.
+        wprintf(L"\r");
+        Sleep(5);
+        FlushConsoleInputBuffer(g_hIn);
+    }
+
+    std::sort(inputMs.begin(), inputMs.end());
+    std::sort(echoMs.begin(), echoMs.end());
+
+    wprintf(L"\r\n%d samples (milliseconds):\r\n", (int)inputMs.size());
+    wprintf(L"                          p50      p90      p99      max\r\n");
+    wprintf(L"key -> InputBuffer   %8.3f %8.3f %8.3f %8.3f\r\n",
+            percentile(inputMs, 50),
+            percentile(inputMs, 90),
+            percentile(inputMs, 99),
+            inputMs.back());
+    wprintf(L"key -> screen glyph  %8.3f %8.3f %8.3f %8.3f\r\n",
+            percentile(echoMs, 50),
+            percentile(echoMs, 90),
+            percentile(echoMs, 99),
+            echoMs.back());
+}
+
 BOOL WINAPI CtrlHandler(DWORD fdwCtrlType)
 {
     switch (fdwCtrlType)
@@ -191,6 +316,8 @@ void usage()
     wprintf(L"\t-o: disable VT output.\n");
     wprintf(L"\t-w: enable reading window events.\n");
     wprintf(L"\t--alt: run in the alt buffer. Cannot be combined with `-o`\n");
+    wprintf(L"\t--latency [count]: measure end-to-end input latency over [count]\n");
+    wprintf(L"\t\tinjected keystrokes (default 100) and print percentiles.\n");
     wprintf(L"\t-?: print this help message\n");
 }
 
@@ -226,6 +353,20 @@ int __cdecl wmain(int argc, wchar_t* argv[])
             gVtOutput = false;
             wprintf(L"Disabling VT Output\n");
         }
+        else if (arg.compare(L"--latency") == 0)
+        {
+            gLatencyMode = true;
+            if (i + 1 < argc)
+            {
+                const int count = _wtoi(argv[i + 1]);
+                if (count > 0)
+                {
+                    gLatencyCount = count;
+                    i++;
+                }
+            }
+            wprintf(L"Measuring Input Latency\n");
+        }
         else if (arg.compare(L"-?") == 0)
         {
             usage();
@@ -282,6 +423,20 @@ int __cdecl wmain(int argc, wchar_t* argv[])
 
     wprintf(L"Start Mode (i/o):(0x%4x, 0x%4x)\n", initialInMode, initialOutMode);
     wprintf(L"New Mode   (i/o):(0x%4x, 0x%4x)\n", dwInMode, dwOutMode);
+
+    if (gLatencyMode)
+    {
+        runLatencyTest(gLatencyCount);
+
+        if (gUseAltBuffer)
+        {
+            useMainBuffer();
+        }
+        SetConsoleMode(g_hOut, initialOutMode);
+        SetConsoleMode(g_hIn, initialInMode);
+        exit(0);
+    }
+
     wprintf(L"Press ^D to exit\n");
 
     while (!gExitRequested)
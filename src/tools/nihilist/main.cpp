@@ -3,10 +3,386 @@
 
 #include <windows.h>
 
+#include <stdio.h>
+
 // This application exists to be connected to a console session while doing exactly nothing.
 // This keeps a console session alive and doesn't interfere with tests or other hooks.
-int __cdecl wmain(int /*argc*/, WCHAR* /*argv[]*/)
+//
+// It doubles as the server throughput benchmark: run with --bench it spawns N
+// copies of itself as child processes sharing this console, and each child
+// issues a mix of WriteConsole, ReadConsoleInput, and
+// GetConsoleScreenBufferInfo calls at a configurable rate. Every call is a
+// DeviceIoControl round trip through condrv into the one conhost serving the
+// shared session, so the aggregate exercises the DeviceComm pump, the
+// ApiSorter dispatch path, and the handle table under real multi-client
+// contention - the paths a single-process test can't contend.
+//
+//   Nihilist.exe                              idle keep-alive (unchanged)
+//   Nihilist.exe --bench [-n procs] [-t seconds] [-r opsPerSec]
+//       drive the benchmark; -r 0 (default) means maximum rate.
+//
+// Per-API latencies land in power-of-two microsecond histograms, which merge
+// across processes without shipping raw samples; the parent reports p50/p90/
+// p99/max per API (bucket lower bounds, so read them as "at least") and total
+// IOCTLs per second.
+
+namespace
+{
+    const unsigned int c_cLatencyBuckets = 32;
+    const unsigned int c_cApis = 3;
+    PCWSTR const c_rgApiNames[c_cApis] = { L"WriteConsole", L"ReadConsoleInput", L"GetConsoleScreenBufferInfo" };
+
+    struct ApiStats
+    {
+        ULONGLONG cOps;
+        ULONGLONG rgBuckets[c_cLatencyBuckets];
+    };
+
+    LONGLONG s_QpcFrequency()
+    {
+        static LARGE_INTEGER li = []() {
+            LARGE_INTEGER liFreq;
+            QueryPerformanceFrequency(&liFreq);
+            return liFreq;
+        }();
+        return li.QuadPart;
+    }
+
+    // Function Description:
+    // - Files one latency sample into its power-of-two microsecond bucket.
+    // Arguments:
+    // - stats - the per-API accumulator
+    // - liTicks - elapsed QPC ticks for the call
+    void RecordSample(ApiStats& stats, const LONGLONG liTicks)
+    {
+        const LONGLONG liMicroseconds = (liTicks * 1000000LL) / s_QpcFrequency();
+        unsigned int bucket = 0;
+        while (bucket + 1 < c_cLatencyBuckets && (1LL << (bucket + 1)) <= liMicroseconds)
+        {
+            bucket++;
+        }
+        stats.cOps++;
+        stats.rgBuckets[bucket]++;
+    }
+
+    // Function Description:
+    // - Reads the given percentile out of a merged histogram.
+    // Arguments:
+    // - stats - merged per-API accumulator
+    // - percentile - which percentile, 0-100
+    // Return Value:
+    // - the lower bound of the bucket holding that percentile, in microseconds.
+    ULONGLONG QueryPercentile(const ApiStats& stats, const unsigned int percentile)
+    {
+        const ULONGLONG cTarget = (stats.cOps * percentile + 99) / 100;
+        ULONGLONG cSeen = 0;
+        for (unsigned int bucket = 0; bucket < c_cLatencyBuckets; bucket++)
+        {
+            cSeen += stats.rgBuckets[bucket];
+            if (cSeen >= cTarget)
+            {
+                return bucket == 0 ? 0 : (1ULL << bucket);
+            }
+        }
+        return 1ULL << (c_cLatencyBuckets - 1);
+    }
+
+    // Function Description:
+    // - The hammer loop run inside each child process. Issues a fixed mix of
+    //   the three APIs (50% write, 40% screen buffer info, 10% input round
+    //   trip) against the shared console, timing each call.
+    // Arguments:
+    // - cSeconds - how long to run
+    // - cOpsPerSecond - pacing target, 0 for maximum rate
+    // - rgStats - receives the per-API histograms
+    // Return Value:
+    // - true if every call succeeded.
+    bool RunHammerLoop(const unsigned int cSeconds, const unsigned int cOpsPerSecond, ApiStats (&rgStats)[c_cApis])
+    {
+        const HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        const HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
+
+        WCHAR wszPayload[64];
+        for (unsigned int i = 0; i < ARRAYSIZE(wszPayload); i++)
+        {
+            wszPayload[i] = L'a' + (i % 26);
+        }
+
+        INPUT_RECORD keyEvent = { 0 };
+        keyEvent.EventType = KEY_EVENT;
+        keyEvent.Event.KeyEvent.bKeyDown = TRUE;
+        keyEvent.Event.KeyEvent.wRepeatCount = 1;
+        keyEvent.Event.KeyEvent.uChar.UnicodeChar = L'x';
+
+        LARGE_INTEGER liStart;
+        QueryPerformanceCounter(&liStart);
+        const LONGLONG liDeadline = liStart.QuadPart + cSeconds * s_QpcFrequency();
+
+        bool fSuccess = true;
+        ULONGLONG cTotalOps = 0;
+        unsigned int uMix = GetCurrentProcessId(); // decorrelate the mix across children
+
+        for (;;)
+        {
+            LARGE_INTEGER liNow;
+            QueryPerformanceCounter(&liNow);
+            if (liNow.QuadPart >= liDeadline)
+            {
+                break;
+            }
+
+            // Pacing: don't run ahead of the requested rate.
+            if (cOpsPerSecond != 0)
+            {
+                const ULONGLONG cDue = ((liNow.QuadPart - liStart.QuadPart) * cOpsPerSecond) / s_QpcFrequency();
+                if (cTotalOps > cDue)
+                {
+                    Sleep(1);
+                    continue;
+                }
+            }
+
+            uMix = uMix * 1664525 + 1013904223;
+            const unsigned int draw = (uMix >> 16) % 10;
+
+            LARGE_INTEGER liBefore;
+            LARGE_INTEGER liAfter;
+            if (draw < 5)
+            {
+                DWORD cchWritten = 0;
+                QueryPerformanceCounter(&liBefore);
+                fSuccess = !!WriteConsoleW(hOut, wszPayload, ARRAYSIZE(wszPayload), &cchWritten, nullptr);
+                QueryPerformanceCounter(&liAfter);
+                RecordSample(rgStats[0], liAfter.QuadPart - liBefore.QuadPart);
+            }
+            else if (draw < 9)
+            {
+                CONSOLE_SCREEN_BUFFER_INFO csbi;
+                QueryPerformanceCounter(&liBefore);
+                fSuccess = !!GetConsoleScreenBufferInfo(hOut, &csbi);
+                QueryPerformanceCounter(&liAfter);
+                RecordSample(rgStats[2], liAfter.QuadPart - liBefore.QuadPart);
+            }
+            else
+            {
+                // Seed the shared input buffer, then read back whatever is
+                // there. Another child may race us to the events, so only
+                // block in ReadConsoleInput when something is queued.
+                DWORD cEvents = 0;
+                fSuccess = !!WriteConsoleInputW(hIn, &keyEvent, 1, &cEvents);
+                if (fSuccess && GetNumberOfConsoleInputEvents(hIn, &cEvents) && cEvents > 0)
+                {
+                    INPUT_RECORD rgRecords[16];
+                    DWORD cRead = 0;
+                    QueryPerformanceCounter(&liBefore);
+                    fSuccess = !!ReadConsoleInputW(hIn, rgRecords, ARRAYSIZE(rgRecords), &cRead);
+                    QueryPerformanceCounter(&liAfter);
+                    RecordSample(rgStats[1], liAfter.QuadPart - liBefore.QuadPart);
+                }
+            }
+
+            if (!fSuccess)
+            {
+                break;
+            }
+            cTotalOps++;
+        }
+
+        return fSuccess;
+    }
+
+    // Function Description:
+    // - Child process entry: wait on the shared start gate so all children
+    //   begin hammering together, run the loop, and write the histograms to
+    //   the result file the parent named for us.
+    int BenchChildMain(const unsigned int cSeconds, const unsigned int cOpsPerSecond, PCWSTR pwszResultPath, PCWSTR pwszStartEventName)
+    {
+        HANDLE hStart = OpenEventW(SYNCHRONIZE, FALSE, pwszStartEventName);
+        if (hStart == nullptr)
+        {
+            return 2;
+        }
+        WaitForSingleObject(hStart, INFINITE);
+        CloseHandle(hStart);
+
+        ApiStats rgStats[c_cApis] = { 0 };
+        const bool fSuccess = RunHammerLoop(cSeconds, cOpsPerSecond, rgStats);
+
+        FILE* pFile = nullptr;
+        if (_wfopen_s(&pFile, pwszResultPath, L"w") != 0 || pFile == nullptr)
+        {
+            return 3;
+        }
+        for (unsigned int api = 0; api < c_cApis; api++)
+        {
+            fwprintf(pFile, L"%I64u", rgStats[api].cOps);
+            for (unsigned int bucket = 0; bucket < c_cLatencyBuckets; bucket++)
+            {
+                fwprintf(pFile, L" %I64u", rgStats[api].rgBuckets[bucket]);
+            }
+            fwprintf(pFile, L"\n");
+        }
+        fclose(pFile);
+
+        return fSuccess ? 0 : 1;
+    }
+
+    // Function Description:
+    // - Parent driver: spawn N children sharing this console, release them
+    //   simultaneously, wait them out, merge the result files, and report.
+    int BenchDriverMain(const unsigned int cProcesses, const unsigned int cSeconds, const unsigned int cOpsPerSecond)
+    {
+        WCHAR wszSelf[MAX_PATH];
+        if (GetModuleFileNameW(nullptr, wszSelf, ARRAYSIZE(wszSelf)) == 0)
+        {
+            return 1;
+        }
+
+        WCHAR wszTempDir[MAX_PATH];
+        if (GetTempPathW(ARRAYSIZE(wszTempDir), wszTempDir) == 0)
+        {
+            return 1;
+        }
+
+        WCHAR wszStartEventName[64];
+        swprintf_s(wszStartEventName, L"Local\\NihilistBenchStart-%u", GetCurrentProcessId());
+        HANDLE hStart = CreateEventW(nullptr, TRUE, FALSE, wszStartEventName);
+        if (hStart == nullptr)
+        {
+            return 1;
+        }
+
+        HANDLE* rgChildren = new HANDLE[cProcesses];
+        WCHAR wszResultPath[MAX_PATH];
+        WCHAR wszCommand[MAX_PATH * 2];
+        unsigned int cSpawned = 0;
+        for (unsigned int i = 0; i < cProcesses; i++)
+        {
+            swprintf_s(wszResultPath, L"%sNihilistBench-%u-%u.txt", wszTempDir, GetCurrentProcessId(), i);
+            swprintf_s(wszCommand, L"\"%s\" --bench-child %u %u \"%s\" %s", wszSelf, cSeconds, cOpsPerSecond, wszResultPath, wszStartEventName);
+
+            STARTUPINFOW si = { 0 };
+            si.cb = sizeof(si);
+            PROCESS_INFORMATION pi = { 0 };
+            // No creation flags: the children inherit this console, which is
+            // the whole point - one conhost, many clients.
+            if (!CreateProcessW(nullptr, wszCommand, nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si, &pi))
+            {
+                break;
+            }
+            CloseHandle(pi.hThread);
+            rgChildren[cSpawned++] = pi.hProcess;
+        }
+
+        int iResult = 1;
+        if (cSpawned == cProcesses)
+        {
+            // Give the children a beat to reach the gate, then fire.
+            Sleep(250);
+            SetEvent(hStart);
+            WaitForMultipleObjects(cSpawned, rgChildren, TRUE, (cSeconds + 30) * 1000);
+
+            ApiStats rgMerged[c_cApis] = { 0 };
+            bool fAllResults = true;
+            for (unsigned int i = 0; i < cSpawned; i++)
+            {
+                swprintf_s(wszResultPath, L"%sNihilistBench-%u-%u.txt", wszTempDir, GetCurrentProcessId(), i);
+                FILE* pFile = nullptr;
+                if (_wfopen_s(&pFile, wszResultPath, L"r") != 0 || pFile == nullptr)
+                {
+                    fAllResults = false;
+                    break;
+                }
+                for (unsigned int api = 0; api < c_cApis; api++)
+                {
+                    ULONGLONG cOps = 0;
+                    fwscanf_s(pFile, L"%I64u", &cOps);
+                    rgMerged[api].cOps += cOps;
+                    for (unsigned int bucket = 0; bucket < c_cLatencyBuckets; bucket++)
+                    {
+                        ULONGLONG cSamples = 0;
+                        fwscanf_s(pFile, L"%I64u", &cSamples);
+                        rgMerged[api].rgBuckets[bucket] += cSamples;
+                    }
+                }
+                fclose(pFile);
+                DeleteFileW(wszResultPath);
+            }
+
+            if (fAllResults)
+            {
+                ULONGLONG cTotalOps = 0;
+                wprintf(L"\n%u processes x %u seconds, rate %u ops/s per process (0 = max)\n", cSpawned, cSeconds, cOpsPerSecond);
+                wprintf(L"%-28s %12s %10s %10s %10s %10s\n", L"API", L"calls", L"p50 us", L"p90 us", L"p99 us", L"max us");
+                for (unsigned int api = 0; api < c_cApis; api++)
+                {
+                    cTotalOps += rgMerged[api].cOps;
+                    wprintf(L"%-28s %12I64u %10I64u %10I64u %10I64u %10I64u\n",
+                            c_rgApiNames[api],
+                            rgMerged[api].cOps,
+                            QueryPercentile(rgMerged[api], 50),
+                            QueryPercentile(rgMerged[api], 90),
+                            QueryPercentile(rgMerged[api], 99),
+                            QueryPercentile(rgMerged[api], 100));
+                }
+                wprintf(L"total: %I64u IOCTLs, %.0f IOCTLs/s\n", cTotalOps, static_cast<double>(cTotalOps) / cSeconds);
+                iResult = 0;
+            }
+        }
+
+        for (unsigned int i = 0; i < cSpawned; i++)
+        {
+            CloseHandle(rgChildren[i]);
+        }
+        delete[] rgChildren;
+        CloseHandle(hStart);
+        return iResult;
+    }
+}
+
+int __cdecl wmain(int argc, WCHAR* argv[])
 {
+    if (argc >= 6 && wcscmp(argv[1], L"--bench-child") == 0)
+    {
+        return BenchChildMain(static_cast<unsigned int>(_wtoi(argv[2])),
+                              static_cast<unsigned int>(_wtoi(argv[3])),
+                              argv[4],
+                              argv[5]);
+    }
+
+    if (argc >= 2 && wcscmp(argv[1], L"--bench") == 0)
+    {
+        unsigned int cProcesses = 4;
+        unsigned int cSeconds = 10;
+        unsigned int cOpsPerSecond = 0;
+        for (int i = 2; i < argc; i++)
+        {
+            if (wcscmp(argv[i], L"-n") == 0 && i + 1 < argc)
+            {
+                cProcesses = static_cast<unsigned int>(_wtoi(argv[++i]));
+            }
+            else if (wcscmp(argv[i], L"-t") == 0 && i + 1 < argc)
+            {
+                cSeconds = static_cast<unsigned int>(_wtoi(argv[++i]));
+            }
+            else if (wcscmp(argv[i], L"-r") == 0 && i + 1 < argc)
+            {
+                cOpsPerSecond = static_cast<unsigned int>(_wtoi(argv[++i]));
+            }
+            else
+            {
+                wprintf(L"usage: Nihilist.exe --bench [-n procs] [-t seconds] [-r opsPerSec]\n");
+                return 1;
+            }
+        }
+        if (cProcesses == 0 || cSeconds == 0)
+        {
+            wprintf(L"usage: Nihilist.exe --bench [-n procs] [-t seconds] [-r opsPerSec]\n");
+            return 1;
+        }
+        return BenchDriverMain(cProcesses, cSeconds, cOpsPerSecond);
+    }
+
     while (true)
     {
         SleepEx(INFINITE, FALSE);
@@ -384,6 +384,12 @@ HANDLE VtConsole::outPipe()
 {
     return _outPipe;
 }
+// The conhost hosting the pty. Only populated on the paths that launch
+// conhost themselves (not the conpty API, which hides its conhost).
+HANDLE VtConsole::hostProcess()
+{
+    return _piPty.hProcess;
+}
 
 void VtConsole::signalWindow(unsigned short sx, unsigned short sy)
 {
@@ -31,6 +31,7 @@ public:
 
     HANDLE inPipe();
     HANDLE outPipe();
+    HANDLE hostProcess();
 
     static const DWORD sInPipeOpenMode = PIPE_ACCESS_DUPLEX;
     static const DWORD sOutPipeOpenMode = PIPE_ACCESS_INBOUND;
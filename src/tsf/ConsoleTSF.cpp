@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 #include "TfConvArea.h"
+#include "TfCatUtil.h"
+#include "TfDispAttr.h"
 #include "TfEditSes.h"
 
 /* 626761ad-78d2-44d2-be8b-752cf122acec */
@@ -123,6 +125,20 @@ void CConsoleTSF::Uninitialize()
         _pConversionArea = NULL;
     }
 
+    // Destroy the cached category and display attribute managers.
+
+    if (_pDispAttrMgr)
+    {
+        delete _pDispAttrMgr;
+        _pDispAttrMgr = NULL;
+    }
+
+    if (_pCatMgr)
+    {
+        delete _pCatMgr;
+        _pCatMgr = NULL;
+    }
+
     // Detach Cicero event sinks.
     if (_spITfInputContext)
     {
@@ -451,6 +467,66 @@ STDMETHODIMP CConsoleTSF::EndUIElement(DWORD /*dwUIElementId*/)
     return S_OK;
 }
 
+//+---------------------------------------------------------------------------
+//
+// CConsoleTSF::GetDisplayAttributeManagers
+//
+//----------------------------------------------------------------------------
+
+//
+// Hands out the Cicero category manager and display attribute manager,
+// creating them on first use. They used to be created (two CoCreateInstance
+// calls) and destroyed inside every composition update edit session; caching
+// them here takes that off the per-keystroke path.
+//
+
+[[nodiscard]] HRESULT CConsoleTSF::GetDisplayAttributeManagers(CicCategoryMgr** ppCatMgr,
+                                                               CicDisplayAttributeMgr** ppDispAttr)
+{
+    HRESULT hr = S_OK;
+
+    if (!_pCatMgr || !_pDispAttrMgr)
+    {
+        hr = E_OUTOFMEMORY;
+
+        CicCategoryMgr* pTmpCat = new (std::nothrow) CicCategoryMgr;
+        CicDisplayAttributeMgr* pTmpDispAttr = new (std::nothrow) CicDisplayAttributeMgr;
+
+        if (pTmpCat && pTmpDispAttr)
+        {
+            hr = pTmpCat->InitCategoryInstance();
+            if (SUCCEEDED(hr))
+            {
+                ITfCategoryMgr* pcat = pTmpCat->GetCategoryMgr();
+                hr = pcat ? pTmpDispAttr->InitDisplayAttributeInstance(pcat) : E_FAIL;
+            }
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            _pCatMgr = pTmpCat;
+            _pDispAttrMgr = pTmpDispAttr;
+        }
+        else
+        {
+            if (pTmpCat)
+            {
+                delete pTmpCat;
+            }
+            if (pTmpDispAttr)
+            {
+                delete pTmpDispAttr;
+            }
+            return hr;
+        }
+    }
+
+    *ppCatMgr = _pCatMgr;
+    *ppDispAttr = _pDispAttrMgr;
+
+    return hr;
+}
+
 //+---------------------------------------------------------------------------
 //
 // CConsoleTSF::CreateConversionAreaService
@@ -22,6 +22,8 @@ Notes:
 #pragma once
 
 class CConversionArea;
+class CicCategoryMgr;
+class CicDisplayAttributeMgr;
 
 class CConsoleTSF final :
     public ITfContextOwner,
@@ -132,6 +134,8 @@ public:
 public:
     CConversionArea* CreateConversionArea();
     CConversionArea* GetConversionArea() { return _pConversionArea; }
+    [[nodiscard]] HRESULT GetDisplayAttributeManagers(CicCategoryMgr** ppCatMgr,
+                                                      CicDisplayAttributeMgr** ppDispAttr);
     ITfContext* GetInputContext() { return _spITfInputContext.get(); }
     HWND GetConsoleHwnd() { return _hwndConsole; }
     TfClientId GetTfClientId() { return _tid; }
@@ -195,6 +199,11 @@ private:
     // Conversion area object for the languages.
     CConversionArea* _pConversionArea = nullptr;
 
+    // Cicero category and display attribute managers, created on the first
+    // composition update and reused for every subsequent edit session.
+    CicCategoryMgr* _pCatMgr = nullptr;
+    CicDisplayAttributeMgr* _pDispAttrMgr = nullptr;
+
     // Console info.
     HWND _hwndConsole;
     GetSuggestionWindowPos _pfnPosition;
@@ -825,9 +825,11 @@ CEditSessionObject::Release()
     CicDisplayAttributeMgr* pDispAttr = NULL;
 
     //
-    // Create Cicero Category Manager and Display Attribute Manager
+    // Get the cached Cicero Category Manager and Display Attribute Manager
+    // (kept alive across edit sessions so we don't pay for their creation
+    // on every composition keystroke).
     //
-    hr = _CreateCategoryAndDisplayAttributeManager(&pCicCat, &pDispAttr);
+    hr = g_pConsoleTSF->GetDisplayAttributeManagers(&pCicCat, &pDispAttr);
     if (SUCCEEDED(hr))
     {
         if (fInterim)
@@ -842,19 +844,10 @@ CEditSessionObject::Release()
         }
         else
         {
-            hr = _MakeCompositionString(ec, FullTextRange.get(), bInWriteSession, pCicCat, pDispAttr);
+            hr = _MakeCompositionString(ec, FullTextRange.get(), lTextLength, bInWriteSession, pCicCat, pDispAttr);
         }
     }
 
-    if (pCicCat)
-    {
-        delete pCicCat;
-    }
-    if (pDispAttr)
-    {
-        delete pDispAttr;
-    }
-
     return hr;
 }
 
@@ -911,6 +904,7 @@ CEditSessionObject::Release()
 
 [[nodiscard]] HRESULT CEditSessionUpdateCompositionString::_MakeCompositionString(TfEditCookie ec,
                                                                                   ITfRange* FullTextRange,
+                                                                                  LONG lTextLength,
                                                                                   BOOL bInWriteSession,
                                                                                   CicCategoryMgr* pCicCatMgr,
                                                                                   CicDisplayAttributeMgr* pCicDispAttr)
@@ -921,6 +915,15 @@ CEditSessionObject::Release()
     std::wstring ResultStr;
     BOOL fIgnorePreviousCompositionResult = FALSE;
 
+    // Size the gathering buffers for the full text up front so the range
+    // walk below appends without reallocating.
+    try
+    {
+        CompStr.reserve(gsl::narrow<size_t>(lTextLength));
+        CompGuid.reserve(gsl::narrow<size_t>(lTextLength));
+    }
+    CATCH_RETURN();
+
     RETURN_IF_FAILED(_GetTextAndAttribute(ec,
                                           FullTextRange,
                                           CompStr,
@@ -940,14 +943,6 @@ CEditSessionObject::Release()
 
     RETURN_IF_FAILED(_GetCursorPosition(ec, CompCursorPos));
 
-    // Get display attribute manager
-    ITfDisplayAttributeMgr* dam = pCicDispAttr->GetDisplayAttributeMgr();
-    RETURN_HR_IF_NULL(E_FAIL, dam);
-
-    // Get category manager
-    ITfCategoryMgr* cat = pCicCatMgr->GetCategoryMgr();
-    RETURN_HR_IF_NULL(E_FAIL, cat);
-
     // Allocate and fill TF_DISPLAYATTRIBUTE
     try
     {
@@ -961,29 +956,8 @@ CEditSessionObject::Release()
         }
         if (!CompStr.empty())
         {
-            const size_t cchDisplayAttribute = CompGuid.size();
             std::vector<TF_DISPLAYATTRIBUTE> DisplayAttributes;
-            DisplayAttributes.reserve(cchDisplayAttribute);
-
-            for (size_t i = 0; i < cchDisplayAttribute; i++)
-            {
-                TF_DISPLAYATTRIBUTE da;
-                ZeroMemory(&da, sizeof(da));
-                da.bAttr = TF_ATTR_OTHER;
-
-                GUID guid;
-                if (SUCCEEDED(cat->GetGUID(CompGuid.at(i), &guid)))
-                {
-                    CLSID clsid;
-                    wil::com_ptr_nothrow<ITfDisplayAttributeInfo> dai;
-                    if (SUCCEEDED(dam->GetDisplayAttributeInfo(guid, &dai, &clsid)))
-                    {
-                        dai->GetAttributeInfo(&da);
-                    }
-                }
-
-                DisplayAttributes.emplace_back(da);
-            }
+            RETURN_IF_FAILED(s_BuildDisplayAttributes(pCicCatMgr, pCicDispAttr, CompGuid, DisplayAttributes));
 
             return conv_area->DrawComposition(CompStr, // composition string
                                               DisplayAttributes, // display attributes
@@ -1060,14 +1034,6 @@ CEditSessionObject::Release()
                                           pCicCatMgr,
                                           pCicDispAttr));
 
-    // Get display attribute manager
-    ITfDisplayAttributeMgr* dam = pCicDispAttr->GetDisplayAttributeMgr();
-    RETURN_HR_IF_NULL(E_FAIL, dam);
-
-    // Get category manager
-    ITfCategoryMgr* cat = pCicCatMgr->GetCategoryMgr();
-    RETURN_HR_IF_NULL(E_FAIL, cat);
-
     // Allocate and fill TF_DISPLAYATTRIBUTE
     try
     {
@@ -1077,28 +1043,8 @@ CEditSessionObject::Release()
 
         if (!CompStr.empty())
         {
-            const size_t cchDisplayAttribute = CompGuid.size();
             std::vector<TF_DISPLAYATTRIBUTE> DisplayAttributes;
-            DisplayAttributes.reserve(cchDisplayAttribute);
-
-            for (size_t i = 0; i < cchDisplayAttribute; i++)
-            {
-                TF_DISPLAYATTRIBUTE da;
-                ZeroMemory(&da, sizeof(da));
-                da.bAttr = TF_ATTR_OTHER;
-                GUID guid;
-                if (SUCCEEDED(cat->GetGUID(CompGuid.at(i), &guid)))
-                {
-                    CLSID clsid;
-                    wil::com_ptr_nothrow<ITfDisplayAttributeInfo> dai;
-                    if (SUCCEEDED(dam->GetDisplayAttributeInfo(guid, &dai, &clsid)))
-                    {
-                        dai->GetAttributeInfo(&da);
-                    }
-                }
-
-                DisplayAttributes.emplace_back(da);
-            }
+            RETURN_IF_FAILED(s_BuildDisplayAttributes(pCicCatMgr, pCicDispAttr, CompGuid, DisplayAttributes));
 
             return conv_area->DrawComposition(CompStr, // composition string (Interim string)
                                               DisplayAttributes); // display attributes
@@ -1111,57 +1057,70 @@ CEditSessionObject::Release()
 
 //+---------------------------------------------------------------------------
 //
-// CEditSessionUpdateCompositionString::_CreateCategoryAndDisplayAttributeManager
+// CEditSessionUpdateCompositionString::s_BuildDisplayAttributes
 //
 //----------------------------------------------------------------------------
 
-[[nodiscard]] HRESULT CEditSessionUpdateCompositionString::_CreateCategoryAndDisplayAttributeManager(
-    CicCategoryMgr** pCicCatMgr,
-    CicDisplayAttributeMgr** pCicDispAttr)
+//
+// Expands the per-character GUID atoms gathered from the range walk into
+// TF_DISPLAYATTRIBUTE data for the conversion area. The atoms come in long
+// runs (one per attribute span of the composition), so the GUID and display
+// attribute info lookups are memoized per distinct atom instead of being
+// issued as COM calls for every character.
+//
+
+[[nodiscard]] HRESULT CEditSessionUpdateCompositionString::s_BuildDisplayAttributes(CicCategoryMgr* pCicCatMgr,
+                                                                                    CicDisplayAttributeMgr* pCicDispAttr,
+                                                                                    const std::vector<TfGuidAtom>& CompGuid,
+                                                                                    std::vector<TF_DISPLAYATTRIBUTE>& DisplayAttributes)
 {
-    HRESULT hr = E_OUTOFMEMORY;
+    // Get display attribute manager
+    ITfDisplayAttributeMgr* dam = pCicDispAttr->GetDisplayAttributeMgr();
+    RETURN_HR_IF_NULL(E_FAIL, dam);
 
-    CicCategoryMgr* pTmpCat = NULL;
-    CicDisplayAttributeMgr* pTmpDispAttr = NULL;
+    // Get category manager
+    ITfCategoryMgr* cat = pCicCatMgr->GetCategoryMgr();
+    RETURN_HR_IF_NULL(E_FAIL, cat);
 
-    //
-    // Create Cicero Category Manager
-    //
-    pTmpCat = new (std::nothrow) CicCategoryMgr;
-    if (pTmpCat)
+    try
     {
-        if (SUCCEEDED(hr = pTmpCat->InitCategoryInstance()))
+        DisplayAttributes.reserve(CompGuid.size());
+
+        // Attribute data already resolved for the atoms seen so far.
+        // Compositions carry a handful of distinct atoms at most.
+        std::vector<std::pair<TfGuidAtom, TF_DISPLAYATTRIBUTE>> resolved;
+
+        for (const auto guidatom : CompGuid)
         {
-            ITfCategoryMgr* pcat = pTmpCat->GetCategoryMgr();
-            if (pcat)
+            const auto it = std::find_if(resolved.cbegin(),
+                                         resolved.cend(),
+                                         [guidatom](const auto& entry) { return entry.first == guidatom; });
+            if (it != resolved.cend())
             {
-                //
-                // Create Cicero Display Attribute Manager
-                //
-                pTmpDispAttr = new (std::nothrow) CicDisplayAttributeMgr;
-                if (pTmpDispAttr)
+                DisplayAttributes.emplace_back(it->second);
+                continue;
+            }
+
+            TF_DISPLAYATTRIBUTE da;
+            ZeroMemory(&da, sizeof(da));
+            da.bAttr = TF_ATTR_OTHER;
+
+            GUID guid;
+            if (SUCCEEDED(cat->GetGUID(guidatom, &guid)))
+            {
+                CLSID clsid;
+                wil::com_ptr_nothrow<ITfDisplayAttributeInfo> dai;
+                if (SUCCEEDED(dam->GetDisplayAttributeInfo(guid, &dai, &clsid)))
                 {
-                    if (SUCCEEDED(hr = pTmpDispAttr->InitDisplayAttributeInstance(pcat)))
-                    {
-                        *pCicCatMgr = pTmpCat;
-                        *pCicDispAttr = pTmpDispAttr;
-                    }
+                    dai->GetAttributeInfo(&da);
                 }
             }
-        }
-    }
 
-    if (FAILED(hr))
-    {
-        if (pTmpCat)
-        {
-            delete pTmpCat;
-        }
-        if (pTmpDispAttr)
-        {
-            delete pTmpDispAttr;
+            resolved.emplace_back(guidatom, da);
+            DisplayAttributes.emplace_back(da);
         }
     }
+    CATCH_RETURN();
 
-    return hr;
+    return S_OK;
 }
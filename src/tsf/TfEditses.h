@@ -202,6 +202,7 @@ private:
 
     [[nodiscard]] HRESULT _MakeCompositionString(TfEditCookie ec,
                                                  ITfRange* FullTextRange,
+                                                 LONG lTextLength,
                                                  BOOL bInWriteSession,
                                                  CicCategoryMgr* pCicCatMgr,
                                                  CicDisplayAttributeMgr* pCicDispAttr);
@@ -214,6 +215,8 @@ private:
                                              CicCategoryMgr* pCicCatMgr,
                                              CicDisplayAttributeMgr* pCicDispAttr);
 
-    [[nodiscard]] HRESULT _CreateCategoryAndDisplayAttributeManager(CicCategoryMgr** pCicCatMgr,
-                                                                    CicDisplayAttributeMgr** pCicDispAttr);
+    [[nodiscard]] static HRESULT s_BuildDisplayAttributes(CicCategoryMgr* pCicCatMgr,
+                                                          CicDisplayAttributeMgr* pCicDispAttr,
+                                                          const std::vector<TfGuidAtom>& CompGuid,
+                                                          std::vector<TF_DISPLAYATTRIBUTE>& DisplayAttributes);
 };
@@ -7,11 +7,83 @@
 
 static CodepointWidthDetector widthDetector;
 
+namespace
+{
+    // A small direct-mapped cache sits in front of the detector for the
+    // single-character query, which runs for every cell write. Real streams
+    // are dominated by a handful of codepoints (ASCII, box drawing), so the
+    // common case becomes one array read. The cache is per-thread so no
+    // synchronization is needed on lookup; correctness across font or
+    // fallback changes is handled by a global generation counter that each
+    // thread checks before trusting its entries.
+    struct GlyphWidthCacheEntry
+    {
+        wchar_t ch;
+        bool isWide;
+        bool valid;
+    };
+
+    const size_t GLYPH_WIDTH_CACHE_SLOTS = 256;
+
+    struct GlyphWidthCache
+    {
+        std::array<GlyphWidthCacheEntry, GLYPH_WIDTH_CACHE_SLOTS> entries{};
+        unsigned int generation = 0;
+    };
+
+    std::atomic<unsigned int> g_glyphWidthGeneration{ 1 };
+    thread_local GlyphWidthCache t_glyphWidthCache;
+
+    // Function Description:
+    // - Returns this thread's cache after validating it against the global
+    //   generation, so callers that loop over a string pay for the atomic
+    //   load and the staleness check only once.
+    GlyphWidthCache& GetValidatedGlyphWidthCache()
+    {
+        GlyphWidthCache& cache = t_glyphWidthCache;
+
+        const unsigned int generation = g_glyphWidthGeneration.load(std::memory_order_acquire);
+        if (cache.generation != generation)
+        {
+            // the font or fallback method changed since this thread last looked;
+            // discard everything we've memoized.
+            cache.entries.fill({});
+            cache.generation = generation;
+        }
+
+        return cache;
+    }
+
+    // Function Description:
+    // - Cache-probing single character width check against an already
+    //   validated cache.
+    bool IsWchFullWidth(GlyphWidthCache& cache, const wchar_t wch)
+    {
+        GlyphWidthCacheEntry& entry = cache.entries[wch % GLYPH_WIDTH_CACHE_SLOTS];
+        if (entry.valid && entry.ch == wch)
+        {
+            return entry.isWide;
+        }
+
+        const bool isWide = widthDetector.IsWide(wch);
+        entry.ch = wch;
+        entry.isWide = isWide;
+        entry.valid = true;
+        return isWide;
+    }
+}
+
 // Function Description:
 // - determines if the glyph represented by the string of characters should be
 //      wide or not. See CodepointWidthDetector::IsWide
 bool IsGlyphFullWidth(const std::wstring_view glyph)
 {
+    if (glyph.size() == 1)
+    {
+        // route through the cached single-character path
+        return IsGlyphFullWidth(glyph.front());
+    }
+
     return widthDetector.IsWide(glyph);
 }
 
@@ -20,7 +92,63 @@ bool IsGlyphFullWidth(const std::wstring_view glyph)
 //      wide or not. See CodepointWidthDetector::IsWide
 bool IsGlyphFullWidth(const wchar_t wch)
 {
-    return widthDetector.IsWide(wch);
+    return IsWchFullWidth(GetValidatedGlyphWidthCache(), wch);
+}
+
+// Function Description:
+// - measures the run of leading characters in chars that share one width
+//      classification, so string loops can consume whole runs instead of
+//      asking about every character. CJK text comes out as long full-width
+//      runs and western text as long narrow runs.
+// Arguments:
+// - chars - the characters to classify
+// - isFullWidth - receives the classification of the run (false when chars is empty)
+// Return Value:
+// - the count of leading characters sharing that classification (>= 1 unless chars is empty)
+size_t GetSameWidthGlyphRunLength(const std::wstring_view chars, bool& isFullWidth) noexcept
+{
+    isFullWidth = false;
+    if (chars.empty())
+    {
+        return 0;
+    }
+
+    try
+    {
+        GlyphWidthCache& cache = GetValidatedGlyphWidthCache();
+
+        isFullWidth = IsWchFullWidth(cache, chars.front());
+
+        size_t run = 1;
+        if (!isFullWidth)
+        {
+            while (run < chars.size())
+            {
+                const wchar_t wch = chars[run];
+
+                // ASCII can never be full width, so the common western case
+                // reduces to this one compare per character.
+                if (wch >= 0x80 && IsWchFullWidth(cache, wch))
+                {
+                    break;
+                }
+                ++run;
+            }
+        }
+        else
+        {
+            while (run < chars.size() && IsWchFullWidth(cache, chars[run]))
+            {
+                ++run;
+            }
+        }
+
+        return run;
+    }
+    CATCH_LOG();
+
+    // If classification failed partway, a run of one is always safe.
+    return 1;
 }
 
 // Function Description:
@@ -36,6 +164,7 @@ bool IsGlyphFullWidth(const wchar_t wch)
 void SetGlyphWidthFallback(std::function<bool(const std::wstring_view)> pfnFallback)
 {
     widthDetector.SetFallbackMethod(pfnFallback);
+    g_glyphWidthGeneration.fetch_add(1, std::memory_order_release);
 }
 
 // Function Description:
@@ -47,4 +176,5 @@ void SetGlyphWidthFallback(std::function<bool(const std::wstring_view)> pfnFallb
 void NotifyGlyphWidthFontChanged()
 {
     widthDetector.NotifyFontChanged();
+    g_glyphWidthGeneration.fetch_add(1, std::memory_order_release);
 }
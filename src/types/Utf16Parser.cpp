@@ -62,6 +62,48 @@ std::wstring_view Utf16Parser::ParseNext(std::wstring_view wstr)
 // Return Value:
 // - a vector of utf16 codepoints. glyphs that require surrogate pairs will be grouped
 // together in a vector and codepoints that use only one wchar will be in a vector by themselves.
+// Routine Description:
+// - splits a utf16 encoded string into views over each codepoint in place, in a single pass.
+// - unlike Parse, nothing is copied: each returned view points into the given string, so the
+//   string must outlive the result. glyphs that require surrogate pairs are two wchars wide.
+// - will drop badly formatted leading/trailing char sequences. a pair is only formed by a
+//   leading surrogate directly followed by a trailing one (matching ParseNext), since a
+//   non-adjacent pair cannot be described by a view over the original text.
+// Arguments:
+// - wstr - the string to parse
+// Return Value:
+// - views into wstr, one per codepoint.
+std::vector<std::wstring_view> Utf16Parser::ParseSpans(std::wstring_view wstr)
+{
+    std::vector<std::wstring_view> result;
+    result.reserve(wstr.size());
+
+    for (size_t pos = 0; pos < wstr.size(); ++pos)
+    {
+        const auto wch = wstr.at(pos);
+        if (IsLeadingSurrogate(wch))
+        {
+            const auto posNext = pos + 1;
+            if (posNext < wstr.size() && IsTrailingSurrogate(wstr.at(posNext)))
+            {
+                result.push_back(wstr.substr(pos, 2));
+                ++pos; // the trail is consumed with its lead
+            }
+            // an unpaired lead is dropped
+        }
+        else if (IsTrailingSurrogate(wch))
+        {
+            // an unpaired trail is dropped
+        }
+        else
+        {
+            result.push_back(wstr.substr(pos, 1));
+        }
+    }
+
+    return result;
+}
+
 std::vector<std::vector<wchar_t>> Utf16Parser::Parse(std::wstring_view wstr)
 {
     std::vector<std::vector<wchar_t>> result;
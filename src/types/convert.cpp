@@ -37,22 +37,26 @@ static const WORD leftShiftScanCode = 0x2A;
     int iSource; // convert to int because Mb2Wc requires it.
     THROW_IF_FAILED(SizeTToInt(source.size(), &iSource));
 
-    // Ask how much space we will need.
-    int const iTarget = MultiByteToWideChar(codePage, 0, source.data(), iSource, nullptr, 0);
-    THROW_LAST_ERROR_IF(0 == iTarget);
-
-    size_t cchNeeded;
-    THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
+    // Every multibyte codepage produces at most one UTF-16 code unit per
+    // source byte, so the source length bounds the target size. Converting
+    // into a reused per-thread scratch buffer sized to that bound lets us
+    // make a single conversion pass instead of one call to measure the
+    // target and a second one to fill it.
+    thread_local static std::wstring scratch;
+    if (scratch.size() < source.size())
+    {
+        scratch.resize(source.size());
+    }
 
-    // Allocate ourselves space in a smart pointer.
-    std::unique_ptr<wchar_t[]> pwsOut = std::make_unique<wchar_t[]>(cchNeeded);
-    THROW_IF_NULL_ALLOC(pwsOut);
+    // Attempt conversion.
+    int const iTarget = MultiByteToWideChar(codePage, 0, source.data(), iSource, scratch.data(), gsl::narrow<int>(scratch.size()));
+    THROW_LAST_ERROR_IF(0 == iTarget);
 
-    // Attempt conversion for real.
-    THROW_LAST_ERROR_IF(0 == MultiByteToWideChar(codePage, 0, source.data(), iSource, pwsOut.get(), iTarget));
+    size_t cchConverted;
+    THROW_IF_FAILED(IntToSizeT(iTarget, &cchConverted));
 
     // Return as a string
-    return std::wstring(pwsOut.get(), cchNeeded);
+    return std::wstring(scratch.data(), cchConverted);
 }
 
 // Routine Description:
@@ -75,28 +79,32 @@ static const WORD leftShiftScanCode = 0x2A;
     int iSource; // convert to int because Wc2Mb requires it.
     THROW_IF_FAILED(SizeTToInt(source.size(), &iSource));
 
-    // Ask how much space we will need.
-    // clang-format off
-#pragma prefast(suppress: __WARNING_W2A_BEST_FIT, "WC_NO_BEST_FIT_CHARS doesn't work in many codepages. Retain old behavior.")
-    // clang-format on
-    int const iTarget = WideCharToMultiByte(codepage, 0, source.data(), iSource, nullptr, 0, nullptr, nullptr);
-    THROW_LAST_ERROR_IF(0 == iTarget);
-
-    size_t cchNeeded;
-    THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
+    // No codepage needs more than four bytes per UTF-16 code unit (GB18030
+    // is the worst case), so that bounds the target size. Converting into a
+    // reused per-thread scratch buffer sized to that bound lets us make a
+    // single conversion pass instead of one call to measure the target and
+    // a second one to fill it.
+    size_t cchBound;
+    THROW_IF_FAILED(SizeTMult(source.size(), 4, &cchBound));
 
-    // Allocate ourselves space in a smart pointer
-    std::unique_ptr<char[]> psOut = std::make_unique<char[]>(cchNeeded);
-    THROW_IF_NULL_ALLOC(psOut.get());
+    thread_local static std::string scratch;
+    if (scratch.size() < cchBound)
+    {
+        scratch.resize(cchBound);
+    }
 
-    // Attempt conversion for real.
+    // Attempt conversion.
     // clang-format off
 #pragma prefast(suppress: __WARNING_W2A_BEST_FIT, "WC_NO_BEST_FIT_CHARS doesn't work in many codepages. Retain old behavior.")
     // clang-format on
-    THROW_LAST_ERROR_IF(0 == WideCharToMultiByte(codepage, 0, source.data(), iSource, psOut.get(), iTarget, nullptr, nullptr));
+    int const iTarget = WideCharToMultiByte(codepage, 0, source.data(), iSource, scratch.data(), gsl::narrow<int>(scratch.size()), nullptr, nullptr);
+    THROW_LAST_ERROR_IF(0 == iTarget);
+
+    size_t cchConverted;
+    THROW_IF_FAILED(IntToSizeT(iTarget, &cchConverted));
 
     // Return as a string
-    return std::string(psOut.get(), cchNeeded);
+    return std::string(scratch.data(), cchConverted);
 }
 
 // Routine Description:
@@ -132,149 +140,143 @@ static const WORD leftShiftScanCode = 0x2A;
     return cchTarget;
 }
 
-std::deque<std::unique_ptr<KeyEvent>> CharToKeyEvents(const wchar_t wch,
-                                                      const unsigned int codepage)
+// Routine Description:
+// - appends one KEY_EVENT input record to a vector of records, with a repeat
+// count of one
+// Arguments:
+// - records - the vector to append to
+// - keyDown - whether this is a key down record
+// - virtualKeyCode - the virtual key code of the record
+// - virtualScanCode - the virtual scan code of the record
+// - charData - the character for the record
+// - activeModifierKeys - the control key state flags for the record
+// Return Value:
+// - <none>
+static void s_AppendKeyRecord(std::vector<INPUT_RECORD>& records,
+                              const bool keyDown,
+                              const WORD virtualKeyCode,
+                              const WORD virtualScanCode,
+                              const wchar_t charData,
+                              const DWORD activeModifierKeys)
 {
-    const short invalidKey = -1;
-    short keyState = VkKeyScanW(wch);
-
-    if (keyState == invalidKey)
-    {
-        // Determine DBCS character because these character does not know by VkKeyScan.
-        // GetStringTypeW(CT_CTYPE3) & C3_ALPHA can determine all linguistic characters. However, this is
-        // not include symbolic character for DBCS.
-        WORD CharType = 0;
-        GetStringTypeW(CT_CTYPE3, &wch, 1, &CharType);
-
-        if (WI_IsFlagSet(CharType, C3_ALPHA) || GetQuickCharWidth(wch) == CodepointWidth::Wide)
-        {
-            keyState = 0;
-        }
-    }
-
-    std::deque<std::unique_ptr<KeyEvent>> convertedEvents;
-    if (keyState == invalidKey)
-    {
-        // if VkKeyScanW fails (char is not in kbd layout), we must
-        // emulate the key being input through the numpad
-        convertedEvents = SynthesizeNumpadEvents(wch, codepage);
-    }
-    else
-    {
-        convertedEvents = SynthesizeKeyboardEvents(wch, keyState);
-    }
-
-    return convertedEvents;
+    INPUT_RECORD record;
+    record.EventType = KEY_EVENT;
+    record.Event.KeyEvent.bKeyDown = keyDown;
+    record.Event.KeyEvent.wRepeatCount = 1;
+    record.Event.KeyEvent.wVirtualKeyCode = virtualKeyCode;
+    record.Event.KeyEvent.wVirtualScanCode = virtualScanCode;
+    record.Event.KeyEvent.uChar.UnicodeChar = charData;
+    record.Event.KeyEvent.dwControlKeyState = activeModifierKeys;
+    records.push_back(record);
 }
 
 // Routine Description:
-// - converts a wchar_t into a series of KeyEvents as if it was typed
-// using the keyboard
+// - appends the records for a wchar_t being typed using the keyboard to a
+// vector of input records
 // Arguments:
 // - wch - the wchar_t to convert
+// - keyState - the keyboard state of the typed wchar_t
+// - records - the vector the records are appended to
 // Return Value:
-// - deque of KeyEvents that represent the wchar_t being typed
+// - <none>
 // Note:
 // - will throw exception on error
-std::deque<std::unique_ptr<KeyEvent>> SynthesizeKeyboardEvents(const wchar_t wch, const short keyState)
+static void s_SynthesizeKeyboardEventRecords(const wchar_t wch,
+                                             const short keyState,
+                                             std::vector<INPUT_RECORD>& records)
 {
     const byte modifierState = HIBYTE(keyState);
 
     bool altGrSet = false;
     bool shiftSet = false;
-    std::deque<std::unique_ptr<KeyEvent>> keyEvents;
 
     // add modifier key event if necessary
     if (WI_AreAllFlagsSet(modifierState, VkKeyScanModState::CtrlAndAltPressed))
     {
         altGrSet = true;
-        keyEvents.push_back(std::make_unique<KeyEvent>(true,
-                                                       1ui16,
-                                                       static_cast<WORD>(VK_MENU),
-                                                       altScanCode,
-                                                       UNICODE_NULL,
-                                                       (ENHANCED_KEY | LEFT_CTRL_PRESSED | RIGHT_ALT_PRESSED)));
+        s_AppendKeyRecord(records,
+                          true,
+                          static_cast<WORD>(VK_MENU),
+                          altScanCode,
+                          UNICODE_NULL,
+                          (ENHANCED_KEY | LEFT_CTRL_PRESSED | RIGHT_ALT_PRESSED));
     }
     else if (WI_IsFlagSet(modifierState, VkKeyScanModState::ShiftPressed))
     {
         shiftSet = true;
-        keyEvents.push_back(std::make_unique<KeyEvent>(true,
-                                                       1ui16,
-                                                       static_cast<WORD>(VK_SHIFT),
-                                                       leftShiftScanCode,
-                                                       UNICODE_NULL,
-                                                       SHIFT_PRESSED));
+        s_AppendKeyRecord(records,
+                          true,
+                          static_cast<WORD>(VK_SHIFT),
+                          leftShiftScanCode,
+                          UNICODE_NULL,
+                          SHIFT_PRESSED);
     }
 
-    const WORD virtualScanCode = gsl::narrow<WORD>(MapVirtualKeyW(wch, MAPVK_VK_TO_VSC));
-    KeyEvent keyEvent{ true, 1, LOBYTE(keyState), virtualScanCode, wch, 0 };
-
     // add modifier flags if necessary
+    DWORD modifierFlags = 0;
     if (WI_IsFlagSet(modifierState, VkKeyScanModState::ShiftPressed))
     {
-        keyEvent.ActivateModifierKey(ModifierKeyState::Shift);
+        WI_SetFlag(modifierFlags, SHIFT_PRESSED);
     }
     if (WI_IsFlagSet(modifierState, VkKeyScanModState::CtrlPressed))
     {
-        keyEvent.ActivateModifierKey(ModifierKeyState::LeftCtrl);
+        WI_SetFlag(modifierFlags, LEFT_CTRL_PRESSED);
     }
     if (WI_AreAllFlagsSet(modifierState, VkKeyScanModState::CtrlAndAltPressed))
     {
-        keyEvent.ActivateModifierKey(ModifierKeyState::RightAlt);
+        WI_SetFlag(modifierFlags, RIGHT_ALT_PRESSED);
     }
 
     // add key event down and up
-    keyEvents.push_back(std::make_unique<KeyEvent>(keyEvent));
-    keyEvent.SetKeyDown(false);
-    keyEvents.push_back(std::make_unique<KeyEvent>(keyEvent));
+    const WORD virtualScanCode = gsl::narrow<WORD>(MapVirtualKeyW(wch, MAPVK_VK_TO_VSC));
+    s_AppendKeyRecord(records, true, LOBYTE(keyState), virtualScanCode, wch, modifierFlags);
+    s_AppendKeyRecord(records, false, LOBYTE(keyState), virtualScanCode, wch, modifierFlags);
 
     // add modifier key up event
     if (altGrSet)
     {
-        keyEvents.push_back(std::make_unique<KeyEvent>(false,
-                                                       1ui16,
-                                                       static_cast<WORD>(VK_MENU),
-                                                       altScanCode,
-                                                       UNICODE_NULL,
-                                                       ENHANCED_KEY));
+        s_AppendKeyRecord(records,
+                          false,
+                          static_cast<WORD>(VK_MENU),
+                          altScanCode,
+                          UNICODE_NULL,
+                          ENHANCED_KEY);
     }
     else if (shiftSet)
     {
-        keyEvents.push_back(std::make_unique<KeyEvent>(false,
-                                                       1ui16,
-                                                       static_cast<WORD>(VK_SHIFT),
-                                                       leftShiftScanCode,
-                                                       UNICODE_NULL,
-                                                       0));
+        s_AppendKeyRecord(records,
+                          false,
+                          static_cast<WORD>(VK_SHIFT),
+                          leftShiftScanCode,
+                          UNICODE_NULL,
+                          0);
     }
-
-    return keyEvents;
 }
 
 // Routine Description:
-// - converts a wchar_t into a series of KeyEvents as if it was typed
-// using Alt + numpad
+// - appends the records for a wchar_t being typed using Alt + numpad to a
+// vector of input records
 // Arguments:
 // - wch - the wchar_t to convert
+// - codepage - the codepage that the numpad digits are chosen against
+// - records - the vector the records are appended to
 // Return Value:
-// - deque of KeyEvents that represent the wchar_t being typed using
-// alt + numpad
+// - <none>
 // Note:
 // - will throw exception on error
-std::deque<std::unique_ptr<KeyEvent>> SynthesizeNumpadEvents(const wchar_t wch, const unsigned int codepage)
+static void s_SynthesizeNumpadEventRecords(const wchar_t wch,
+                                           const unsigned int codepage,
+                                           std::vector<INPUT_RECORD>& records)
 {
-    std::deque<std::unique_ptr<KeyEvent>> keyEvents;
-
     //alt keydown
-    keyEvents.push_back(std::make_unique<KeyEvent>(true,
-                                                   1ui16,
-                                                   static_cast<WORD>(VK_MENU),
-                                                   altScanCode,
-                                                   UNICODE_NULL,
-                                                   LEFT_ALT_PRESSED));
-
-    const int radix = 10;
-    std::wstring wstr{ wch };
+    s_AppendKeyRecord(records,
+                      true,
+                      static_cast<WORD>(VK_MENU),
+                      altScanCode,
+                      UNICODE_NULL,
+                      LEFT_ALT_PRESSED);
+
+    const std::wstring wstr{ wch };
     const auto convertedChars = ConvertToA(codepage, wstr);
     if (convertedChars.size() == 1)
     {
@@ -299,31 +301,124 @@ std::deque<std::unique_ptr<KeyEvent>> SynthesizeNumpadEvents(const wchar_t wch,
             const WORD virtualKey = ch - '0' + VK_NUMPAD0;
             const WORD virtualScanCode = gsl::narrow<WORD>(MapVirtualKeyW(virtualKey, MAPVK_VK_TO_VSC));
 
-            keyEvents.push_back(std::make_unique<KeyEvent>(true,
-                                                           1ui16,
-                                                           virtualKey,
-                                                           virtualScanCode,
-                                                           UNICODE_NULL,
-                                                           LEFT_ALT_PRESSED));
-            keyEvents.push_back(std::make_unique<KeyEvent>(false,
-                                                           1ui16,
-                                                           virtualKey,
-                                                           virtualScanCode,
-                                                           UNICODE_NULL,
-                                                           LEFT_ALT_PRESSED));
+            s_AppendKeyRecord(records, true, virtualKey, virtualScanCode, UNICODE_NULL, LEFT_ALT_PRESSED);
+            s_AppendKeyRecord(records, false, virtualKey, virtualScanCode, UNICODE_NULL, LEFT_ALT_PRESSED);
         }
     }
 
     // alt keyup
-    keyEvents.push_back(std::make_unique<KeyEvent>(false,
-                                                   1ui16,
-                                                   static_cast<WORD>(VK_MENU),
-                                                   altScanCode,
-                                                   wch,
-                                                   0));
+    s_AppendKeyRecord(records,
+                      false,
+                      static_cast<WORD>(VK_MENU),
+                      altScanCode,
+                      wch,
+                      0);
+}
+
+// Routine Description:
+// - wraps a vector of KEY_EVENT input records back into heap-allocated
+// KeyEvent objects, for the callers that still want event objects
+// Arguments:
+// - records - the records to wrap
+// Return Value:
+// - deque of KeyEvents equivalent to the records passed in
+static std::deque<std::unique_ptr<KeyEvent>> s_RecordsToKeyEvents(const std::vector<INPUT_RECORD>& records)
+{
+    std::deque<std::unique_ptr<KeyEvent>> keyEvents;
+    for (const auto& record : records)
+    {
+        keyEvents.push_back(std::make_unique<KeyEvent>(record.Event.KeyEvent));
+    }
     return keyEvents;
 }
 
+// Routine Description:
+// - converts a wchar_t into the KEY_EVENT input records that typing it would
+// produce, appending them to a caller-owned vector. This is the bulk
+// conversion path - converting a long run of characters builds one contiguous
+// batch of records with no per-character heap allocations.
+// Arguments:
+// - wch - the wchar_t to convert
+// - codepage - the codepage used when the key has to be emulated via numpad entry
+// - records - the vector the records are appended to
+// Return Value:
+// - <none>
+// Note:
+// - will throw exception on error
+void CharToKeyEventRecords(const wchar_t wch,
+                           const unsigned int codepage,
+                           std::vector<INPUT_RECORD>& records)
+{
+    const short invalidKey = -1;
+    short keyState = VkKeyScanW(wch);
+
+    if (keyState == invalidKey)
+    {
+        // Determine DBCS character because these character does not know by VkKeyScan.
+        // GetStringTypeW(CT_CTYPE3) & C3_ALPHA can determine all linguistic characters. However, this is
+        // not include symbolic character for DBCS.
+        WORD CharType = 0;
+        GetStringTypeW(CT_CTYPE3, &wch, 1, &CharType);
+
+        if (WI_IsFlagSet(CharType, C3_ALPHA) || GetQuickCharWidth(wch) == CodepointWidth::Wide)
+        {
+            keyState = 0;
+        }
+    }
+
+    if (keyState == invalidKey)
+    {
+        // if VkKeyScanW fails (char is not in kbd layout), we must
+        // emulate the key being input through the numpad
+        s_SynthesizeNumpadEventRecords(wch, codepage, records);
+    }
+    else
+    {
+        s_SynthesizeKeyboardEventRecords(wch, keyState, records);
+    }
+}
+
+std::deque<std::unique_ptr<KeyEvent>> CharToKeyEvents(const wchar_t wch,
+                                                      const unsigned int codepage)
+{
+    std::vector<INPUT_RECORD> records;
+    CharToKeyEventRecords(wch, codepage, records);
+    return s_RecordsToKeyEvents(records);
+}
+
+// Routine Description:
+// - converts a wchar_t into a series of KeyEvents as if it was typed
+// using the keyboard
+// Arguments:
+// - wch - the wchar_t to convert
+// Return Value:
+// - deque of KeyEvents that represent the wchar_t being typed
+// Note:
+// - will throw exception on error
+std::deque<std::unique_ptr<KeyEvent>> SynthesizeKeyboardEvents(const wchar_t wch, const short keyState)
+{
+    std::vector<INPUT_RECORD> records;
+    s_SynthesizeKeyboardEventRecords(wch, keyState, records);
+    return s_RecordsToKeyEvents(records);
+}
+
+// Routine Description:
+// - converts a wchar_t into a series of KeyEvents as if it was typed
+// using Alt + numpad
+// Arguments:
+// - wch - the wchar_t to convert
+// Return Value:
+// - deque of KeyEvents that represent the wchar_t being typed using
+// alt + numpad
+// Note:
+// - will throw exception on error
+std::deque<std::unique_ptr<KeyEvent>> SynthesizeNumpadEvents(const wchar_t wch, const unsigned int codepage)
+{
+    std::vector<INPUT_RECORD> records;
+    s_SynthesizeNumpadEventRecords(wch, codepage, records);
+    return s_RecordsToKeyEvents(records);
+}
+
 // Routine Description:
 // - naively determines the width of a UCS2 encoded wchar
 // Arguments:
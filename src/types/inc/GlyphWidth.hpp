@@ -11,5 +11,6 @@ Abstract:
 
 bool IsGlyphFullWidth(const std::wstring_view glyph);
 bool IsGlyphFullWidth(const wchar_t wch);
+size_t GetSameWidthGlyphRunLength(const std::wstring_view chars, bool& isFullWidth) noexcept;
 void SetGlyphWidthFallback(std::function<bool(std::wstring_view)> pfnFallback);
 void NotifyGlyphWidthFontChanged();
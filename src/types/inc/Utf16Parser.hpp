@@ -28,6 +28,7 @@ private:
 
 public:
     static std::vector<std::vector<wchar_t>> Parse(std::wstring_view wstr);
+    static std::vector<std::wstring_view> ParseSpans(std::wstring_view wstr);
     static std::wstring_view ParseNext(std::wstring_view wstr);
 
     // Routine Description:
@@ -16,6 +16,7 @@ Author:
 #pragma once
 #include <deque>
 #include <memory>
+#include <vector>
 #include "IInputEvent.hpp"
 
 enum class CodepointWidth : BYTE
@@ -37,6 +38,10 @@ enum class CodepointWidth : BYTE
 
 std::deque<std::unique_ptr<KeyEvent>> CharToKeyEvents(const wchar_t wch, const unsigned int codepage);
 
+void CharToKeyEventRecords(const wchar_t wch,
+                           const unsigned int codepage,
+                           std::vector<INPUT_RECORD>& records);
+
 std::deque<std::unique_ptr<KeyEvent>> SynthesizeKeyboardEvents(const wchar_t wch,
                                                                const short keyState);
 
@@ -21,45 +21,166 @@ namespace Microsoft::Console::Types
     class Viewport final
     {
     public:
-        ~Viewport() {}
-        Viewport(const Viewport& other) noexcept;
+        ~Viewport() = default;
+        constexpr Viewport(const Viewport&) noexcept = default;
         Viewport(Viewport&&) = default;
         Viewport& operator=(const Viewport&) & = default;
         Viewport& operator=(Viewport&&) & = default;
 
-        static Viewport Empty() noexcept;
+        // The simple factories, accessors, and bounds checks below are defined
+        // inline and constexpr so that per-cell and per-run callers (buffer
+        // iterators, renderer clipping) compile down to plain integer
+        // arithmetic instead of opaque out-of-line calls.
 
-        static Viewport FromInclusive(const SMALL_RECT sr) noexcept;
+        static constexpr Viewport Empty() noexcept
+        {
+            return Viewport({ 0, 0, -1, -1 });
+        }
+
+        static constexpr Viewport FromInclusive(const SMALL_RECT sr) noexcept
+        {
+            return Viewport(sr);
+        }
+
+        static constexpr Viewport FromExclusive(const SMALL_RECT sr) noexcept
+        {
+            SMALL_RECT _sr = sr;
+            _sr.Bottom -= 1;
+            _sr.Right -= 1;
+            return Viewport::FromInclusive(_sr);
+        }
 
-        static Viewport FromExclusive(const SMALL_RECT sr) noexcept;
+        // Function Description:
+        // - Creates a new Viewport at the given origin, with the given dimensions.
+        // Arguments:
+        // - origin: The origin of the new Viewport. Becomes the Viewport's Left, Top
+        // - width: The width of the new viewport
+        // - height: The height of the new viewport
+        // Return Value:
+        // - a new Viewport at the given origin, with the given dimensions.
+        static constexpr Viewport FromDimensions(const COORD origin,
+                                                 const short width,
+                                                 const short height) noexcept
+        {
+            return Viewport::FromExclusive({ origin.X, origin.Y, origin.X + width, origin.Y + height });
+        }
+
+        // Function Description:
+        // - Creates a new Viewport at the given origin, with the given dimensions.
+        // Arguments:
+        // - origin: The origin of the new Viewport. Becomes the Viewport's Left, Top
+        // - dimensions: A coordinate containing the width and height of the new viewport
+        //      in the x and y coordinates respectively.
+        // Return Value:
+        // - a new Viewport at the given origin, with the given dimensions.
+        static constexpr Viewport FromDimensions(const COORD origin,
+                                                 const COORD dimensions) noexcept
+        {
+            return Viewport::FromExclusive({ origin.X, origin.Y, origin.X + dimensions.X, origin.Y + dimensions.Y });
+        }
+
+        // Function Description:
+        // - Creates a new Viewport at the origin, with the given dimensions.
+        // Arguments:
+        // - dimensions: A coordinate containing the width and height of the new viewport
+        //      in the x and y coordinates respectively.
+        // Return Value:
+        // - a new Viewport at the origin, with the given dimensions.
+        static constexpr Viewport FromDimensions(const COORD dimensions) noexcept
+        {
+            return Viewport::FromDimensions({ 0 }, dimensions);
+        }
 
-        static Viewport FromDimensions(const COORD origin,
-                                       const short width,
-                                       const short height) noexcept;
+        // Method Description:
+        // - Creates a Viewport equivalent to a 1x1 rectangle at the given coordinate.
+        // Arguments:
+        // - origin: origin of the rectangle to create.
+        // Return Value:
+        // - a 1x1 Viewport at the given coordinate
+        static constexpr Viewport FromCoord(const COORD origin) noexcept
+        {
+            return Viewport::FromInclusive({ origin.X, origin.Y, origin.X, origin.Y });
+        }
 
-        static Viewport FromDimensions(const COORD origin,
-                                       const COORD dimensions) noexcept;
+        constexpr SHORT Left() const noexcept
+        {
+            return _sr.Left;
+        }
 
-        static Viewport FromDimensions(const COORD dimensions) noexcept;
+        constexpr SHORT RightInclusive() const noexcept
+        {
+            return _sr.Right;
+        }
 
-        static Viewport FromCoord(const COORD origin) noexcept;
+        constexpr SHORT RightExclusive() const noexcept
+        {
+            return _sr.Right + 1;
+        }
 
-        SHORT Left() const noexcept;
-        SHORT RightInclusive() const noexcept;
-        SHORT RightExclusive() const noexcept;
-        SHORT Top() const noexcept;
-        SHORT BottomInclusive() const noexcept;
-        SHORT BottomExclusive() const noexcept;
-        SHORT Height() const noexcept;
-        SHORT Width() const noexcept;
-        COORD Origin() const noexcept;
-        COORD Dimensions() const noexcept;
+        constexpr SHORT Top() const noexcept
+        {
+            return _sr.Top;
+        }
 
-        bool IsInBounds(const Viewport& other) const noexcept;
-        bool IsInBounds(const COORD& pos) const noexcept;
+        constexpr SHORT BottomInclusive() const noexcept
+        {
+            return _sr.Bottom;
+        }
+
+        constexpr SHORT BottomExclusive() const noexcept
+        {
+            return _sr.Bottom + 1;
+        }
+
+        constexpr SHORT Height() const noexcept
+        {
+            return BottomExclusive() - Top();
+        }
+
+        constexpr SHORT Width() const noexcept
+        {
+            return RightExclusive() - Left();
+        }
+
+        constexpr COORD Origin() const noexcept
+        {
+            return { Left(), Top() };
+        }
+
+        constexpr COORD Dimensions() const noexcept
+        {
+            return { Width(), Height() };
+        }
+
+        // Method Description:
+        // - Determines if the given viewport fits within this viewport.
+        // Arguments:
+        // - other - The viewport to fit inside this one
+        // Return Value:
+        // - True if it fits. False otherwise.
+        constexpr bool IsInBounds(const Viewport& other) const noexcept
+        {
+            return other.Left() >= Left() && other.Left() <= RightInclusive() &&
+                   other.RightInclusive() >= Left() && other.RightInclusive() <= RightInclusive() &&
+                   other.Top() >= Top() && other.Top() <= other.BottomInclusive() &&
+                   other.BottomInclusive() >= Top() && other.BottomInclusive() <= BottomInclusive();
+        }
+
+        // Method Description:
+        // - Determines if the given coordinate position lies within this viewport.
+        // Arguments:
+        // - pos - Coordinate position
+        // Return Value:
+        // - True if it lies inside the viewport. False otherwise.
+        constexpr bool IsInBounds(const COORD& pos) const noexcept
+        {
+            return pos.X >= Left() && pos.X < RightExclusive() &&
+                   pos.Y >= Top() && pos.Y < BottomExclusive();
+        }
 
         void Clamp(COORD& pos) const;
-        Viewport Clamp(const Viewport& other) const;
+        Viewport Clamp(const Viewport& other) const noexcept;
+        bool TryClamp(COORD& pos) const noexcept;
 
         bool MoveInBounds(const ptrdiff_t move, COORD& pos) const noexcept;
         bool IncrementInBounds(COORD& pos) const noexcept;
@@ -99,13 +220,27 @@ namespace Microsoft::Console::Types
         void ConvertFromOrigin(_Inout_ COORD* const pcoord) const noexcept;
         [[nodiscard]] Viewport ConvertFromOrigin(const Viewport& other) const noexcept;
 
-        SMALL_RECT ToExclusive() const noexcept;
-        SMALL_RECT ToInclusive() const noexcept;
+        constexpr SMALL_RECT ToExclusive() const noexcept
+        {
+            return { Left(), Top(), RightExclusive(), BottomExclusive() };
+        }
+
+        constexpr SMALL_RECT ToInclusive() const noexcept
+        {
+            return { Left(), Top(), RightInclusive(), BottomInclusive() };
+        }
+
         RECT ToRect() const noexcept;
 
         Viewport ToOrigin() const noexcept;
 
-        bool IsValid() const noexcept;
+        // Method Description:
+        // - Returns true if the rectangle described by this Viewport has internal space
+        // - i.e. it has a positive, non-zero height and width.
+        constexpr bool IsValid() const noexcept
+        {
+            return Height() > 0 && Width() > 0;
+        }
 
         [[nodiscard]] static Viewport Offset(const Viewport& original, const COORD delta);
 
@@ -116,7 +251,10 @@ namespace Microsoft::Console::Types
         [[nodiscard]] static SomeViewports Subtract(const Viewport& original, const Viewport& removeMe) noexcept;
 
     private:
-        Viewport(const SMALL_RECT sr) noexcept;
+        constexpr Viewport(const SMALL_RECT sr) noexcept :
+            _sr(sr)
+        {
+        }
 
         // This is always stored as a Inclusive rect.
         SMALL_RECT _sr;
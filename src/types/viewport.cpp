@@ -6,186 +6,35 @@
 
 using namespace Microsoft::Console::Types;
 
-Viewport::Viewport(const SMALL_RECT sr) noexcept :
-    _sr(sr)
-{
-}
-
-Viewport::Viewport(const Viewport& other) noexcept :
-    _sr(other._sr)
-{
-}
-
-Viewport Viewport::Empty() noexcept
-{
-    return Viewport({ 0, 0, -1, -1 });
-}
-
-Viewport Viewport::FromInclusive(const SMALL_RECT sr) noexcept
-{
-    return Viewport(sr);
-}
-
-Viewport Viewport::FromExclusive(const SMALL_RECT sr) noexcept
-{
-    SMALL_RECT _sr = sr;
-    _sr.Bottom -= 1;
-    _sr.Right -= 1;
-    return Viewport::FromInclusive(_sr);
-}
-
-// Function Description:
-// - Creates a new Viewport at the given origin, with the given dimensions.
-// Arguments:
-// - origin: The origin of the new Viewport. Becomes the Viewport's Left, Top
-// - width: The width of the new viewport
-// - height: The height of the new viewport
-// Return Value:
-// - a new Viewport at the given origin, with the given dimensions.
-Viewport Viewport::FromDimensions(const COORD origin,
-                                  const short width,
-                                  const short height) noexcept
-{
-    return Viewport::FromExclusive({ origin.X, origin.Y, origin.X + width, origin.Y + height });
-}
-
-// Function Description:
-// - Creates a new Viewport at the given origin, with the given dimensions.
-// Arguments:
-// - origin: The origin of the new Viewport. Becomes the Viewport's Left, Top
-// - dimensions: A coordinate containing the width and height of the new viewport
-//      in the x and y coordinates respectively.
-// Return Value:
-// - a new Viewport at the given origin, with the given dimensions.
-Viewport Viewport::FromDimensions(const COORD origin,
-                                  const COORD dimensions) noexcept
-{
-    return Viewport::FromExclusive({ origin.X, origin.Y, origin.X + dimensions.X, origin.Y + dimensions.Y });
-}
-
-// Function Description:
-// - Creates a new Viewport at the origin, with the given dimensions.
-// Arguments:
-// - dimensions: A coordinate containing the width and height of the new viewport
-//      in the x and y coordinates respectively.
-// Return Value:
-// - a new Viewport at the origin, with the given dimensions.
-Viewport Viewport::FromDimensions(const COORD dimensions) noexcept
-{
-    return Viewport::FromDimensions({ 0 }, dimensions);
-}
-
 // Method Description:
-// - Creates a Viewport equivalent to a 1x1 rectangle at the given coordinate.
-// Arguments:
-// - origin: origin of the rectangle to create.
-// Return Value:
-// - a 1x1 Viewport at the given coordinate
-Viewport Viewport::FromCoord(const COORD origin) noexcept
-{
-    return Viewport::FromInclusive({ origin.X, origin.Y, origin.X, origin.Y });
-}
-
-SHORT Viewport::Left() const noexcept
-{
-    return _sr.Left;
-}
-
-SHORT Viewport::RightInclusive() const noexcept
-{
-    return _sr.Right;
-}
-
-SHORT Viewport::RightExclusive() const noexcept
-{
-    return _sr.Right + 1;
-}
-
-SHORT Viewport::Top() const noexcept
-{
-    return _sr.Top;
-}
-
-SHORT Viewport::BottomInclusive() const noexcept
-{
-    return _sr.Bottom;
-}
-
-SHORT Viewport::BottomExclusive() const noexcept
-{
-    return _sr.Bottom + 1;
-}
-
-SHORT Viewport::Height() const noexcept
-{
-    return BottomExclusive() - Top();
-}
-
-SHORT Viewport::Width() const noexcept
-{
-    return RightExclusive() - Left();
-}
-
-// Method Description:
-// - Get a coord representing the origin of this viewport.
+// - Clamps a coordinate position into the inside of this viewport.
 // Arguments:
-// - <none>
+// - pos - coordinate to update/clamp
 // Return Value:
-// - the coordinates of this viewport's origin.
-COORD Viewport::Origin() const noexcept
-{
-    return { Left(), Top() };
-}
-
-// Method Description:
-// - Get a coord representing the dimensions of this viewport.
-// Arguments:
 // - <none>
-// Return Value:
-// - the dimensions of this viewport.
-COORD Viewport::Dimensions() const noexcept
-{
-    return { Width(), Height() };
-}
-
-// Method Description:
-// - Determines if the given viewport fits within this viewport.
-// Arguments:
-// - other - The viewport to fit inside this one
-// Return Value:
-// - True if it fits. False otherwise.
-bool Viewport::IsInBounds(const Viewport& other) const noexcept
-{
-    return other.Left() >= Left() && other.Left() <= RightInclusive() &&
-           other.RightInclusive() >= Left() && other.RightInclusive() <= RightInclusive() &&
-           other.Top() >= Top() && other.Top() <= other.BottomInclusive() &&
-           other.BottomInclusive() >= Top() && other.BottomInclusive() <= BottomInclusive();
-}
-
-// Method Description:
-// - Determines if the given coordinate position lies within this viewport.
-// Arguments:
-// - pos - Coordinate position
-// Return Value:
-// - True if it lies inside the viewport. False otherwise.
-bool Viewport::IsInBounds(const COORD& pos) const noexcept
+void Viewport::Clamp(COORD& pos) const
 {
-    return pos.X >= Left() && pos.X < RightExclusive() &&
-           pos.Y >= Top() && pos.Y < BottomExclusive();
+    THROW_HR_IF(E_NOT_VALID_STATE, !TryClamp(pos)); // we can't clamp to an invalid viewport.
 }
 
 // Method Description:
-// - Clamps a coordinate position into the inside of this viewport.
+// - Clamps a coordinate position into the inside of this viewport without
+//   throwing, for use on hot paths where the exception guard codegen matters.
 // Arguments:
 // - pos - coordinate to update/clamp
 // Return Value:
-// - <none>
-void Viewport::Clamp(COORD& pos) const
+// - True if the coordinate was clamped. False if this viewport is invalid
+//   and there is nothing to clamp to (pos is left untouched).
+bool Viewport::TryClamp(COORD& pos) const noexcept
 {
-    THROW_HR_IF(E_NOT_VALID_STATE, !IsValid()); // we can't clamp to an invalid viewport.
+    if (!IsValid())
+    {
+        return false;
+    }
 
     pos.X = std::clamp(pos.X, Left(), RightInclusive());
     pos.Y = std::clamp(pos.Y, Top(), BottomInclusive());
+    return true;
 }
 
 // Method Description:
@@ -194,7 +43,7 @@ void Viewport::Clamp(COORD& pos) const
 // - other - Viewport to clamp to the inside of this viewport
 // Return Value:
 // - Clamped viewport
-Viewport Viewport::Clamp(const Viewport& other) const
+Viewport Viewport::Clamp(const Viewport& other) const noexcept
 {
     auto clampMe = other.ToInclusive();
 
@@ -693,17 +542,6 @@ void Viewport::ConvertFromOrigin(_Inout_ COORD* const pcoord) const noexcept
     pcoord->Y += Top();
 }
 
-// Method Description:
-// - Returns an exclusive SMALL_RECT equivalent to this viewport.
-// Arguments:
-// - <none>
-// Return Value:
-// - an exclusive SMALL_RECT equivalent to this viewport.
-SMALL_RECT Viewport::ToExclusive() const noexcept
-{
-    return { Left(), Top(), RightExclusive(), BottomExclusive() };
-}
-
 // Method Description:
 // - Returns an exclusive RECT equivalent to this viewport.
 // Arguments:
@@ -720,17 +558,6 @@ RECT Viewport::ToRect() const noexcept
     return r;
 }
 
-// Method Description:
-// - Returns an inclusive SMALL_RECT equivalent to this viewport.
-// Arguments:
-// - <none>
-// Return Value:
-// - an inclusive SMALL_RECT equivalent to this viewport.
-SMALL_RECT Viewport::ToInclusive() const noexcept
-{
-    return { Left(), Top(), RightInclusive(), BottomInclusive() };
-}
-
 // Method Description:
 // - Returns a new viewport representing this viewport at the origin.
 // For example:
@@ -1031,10 +858,3 @@ Viewport Viewport::ToOrigin() const noexcept
     return result;
 }
 
-// Method Description:
-// - Returns true if the rectangle described by this Viewport has internal space
-// - i.e. it has a positive, non-zero height and width.
-bool Viewport::IsValid() const noexcept
-{
-    return Height() > 0 && Width() > 0;
-}
@@ -0,0 +1,39 @@
+@echo off
+
+rem pgo - Build a profile-guided release flavor of the console.
+rem
+rem Runs the full PGO cycle: build Release with instrumentation, train the
+rem instrumented conhost by replaying VT through it with conptybench, then
+rem relink against the collected counts. The result lands in the normal
+rem Release output directory. Requires a razzle environment (razzle.cmd).
+rem
+rem Training uses the conptybench synthetic stream, which leans on the same
+rem WriteCharsLegacy/StateMachine call tree the interactive hot path does; pass
+rem additional arguments to forward a recorded .vt payload instead:
+rem     pgo.cmd [payload.vt]
+
+if (%OPENCON%) == () (
+    echo Run razzle.cmd first to set up the environment.
+    exit /b 1
+)
+
+nuget.exe restore %OPENCON%\OpenConsole.sln
+
+echo Building instrumented Release...
+"%MSBUILD%" %OPENCON%\OpenConsole.sln /t:Build /m /p:Configuration=Release /p:Platform=%ARCH% /p:AppxBundle=false /p:PGOBuildMode=Instrument
+if errorlevel 1 exit /b 1
+
+set _PGO_BIN=%OPENCON%\bin\%PLATFORM%\Release
+
+echo Training (conptybench replay through the instrumented conhost)...
+rem Five passes of the default payload gives the collector enough samples for
+rem stable counts without taking all afternoon.
+%_PGO_BIN%\conptybench.exe %1 -n 5
+if errorlevel 1 exit /b 1
+
+echo Relinking with the collected profile...
+"%MSBUILD%" %OPENCON%\OpenConsole.sln /t:Build /m /p:Configuration=Release /p:Platform=%ARCH% /p:AppxBundle=false /p:PGOBuildMode=Optimize
+if errorlevel 1 exit /b 1
+
+echo PGO build complete: %_PGO_BIN%
+set _PGO_BIN=